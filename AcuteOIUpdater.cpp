@@ -70,11 +70,11 @@ void AcuteOIUpdater::performMonthlyUpdates() {
 	if (patient->getGeneralState()->tracingEnabled) {
 		if (!patient->getDiseaseState()->hasTrueOIHistory[oiType]) {
 			tracer->printTrace(1, "**%d PRIMARY OI %s;\n", patient->getGeneralState()->monthNum,
-				SimContext::OI_STRS[oiType]);
+				simContext->OI_STRS[oiType]);
 		}
 		else {
 			tracer->printTrace(1, "**%d SECONDARY OI %s;\n", patient->getGeneralState()->monthNum,
-				SimContext::OI_STRS[oiType]);
+				simContext->OI_STRS[oiType]);
 		}
 	}
 
@@ -86,12 +86,12 @@ void AcuteOIUpdater::performMonthlyUpdates() {
 	//if patient is not in care - note that only Pediatric HIV infections can clear a false positive linked flag. False positive linked patients who get HIV after breastfeeding remain flagged as linked.
 	if (patient->getMonitoringState()->careState < SimContext::HIV_CARE_IN_CARE && !patient->getPedsState()->isFalsePositiveLinked){
 		//Using HIV testing or EID, depending on whether Peds is enabled and the user-defined test starting age
-		if(simContext->getHIVTestInputs()->enableHIVTesting || (simContext->getPedsInputs()->enablePediatricsModel && simContext->getEIDInputs()->enableHIVTestingEID ))
+		if(simContext->getHIVTestInputs()->enableHIVTesting || (simContext->isPedsModelEnabled() && simContext->isEIDTestingEnabled() ))
 			rollForOIDet = true;
 		else
 			linkToCare = true;
 		//If EID is enabled, pediatric patients use EID inputs for OI detection until they reach adulthood, then they use inputs in the HIVTest tab. If they have transitioned to using adult HIV tests before age 13, they cannot use EID OI detection inputs because they may require confimration by EID tests which are no longer accessible to them  
-		if(simContext->getPedsInputs()->enablePediatricsModel && simContext->getEIDInputs()->enableHIVTestingEID && (patient->getPedsState()->ageCategoryPediatrics < SimContext::PEDS_AGE_ADULT)) { 
+		if(simContext->isPedsModelEnabled() && simContext->isEIDTestingEnabled() && (patient->getPedsState()->ageCategoryPediatrics < SimContext::PEDS_AGE_ADULT)) { 
 			if (!simContext->getHIVTestInputs()->enableHIVTesting || (patient->getGeneralState()->ageMonths < simContext->getHIVTestInputs()->HIVRegularTestingStartAge)){
 				useEIDOIDetection = true;	
 			}
@@ -242,8 +242,6 @@ void AcuteOIUpdater::performMonthlyUpdates() {
 
 /** \brief determineAcuteOI returns the acute OI that occurs this month or OI_NONE if no OI occurs */
 SimContext::OI_TYPE AcuteOIUpdater::determineAcuteOI() {
-	const SimContext::NatHistInputs *natHist = simContext->getNatHistInputs();
-
 	/** First calculate the maximum efficacy of OI prophylaxis */
 	double maxEfficacy[SimContext::OI_NUM];
 	bool hasEfficacy[SimContext::OI_NUM];
@@ -293,15 +291,12 @@ SimContext::OI_TYPE AcuteOIUpdater::determineAcuteOI() {
 
 		if (patient->getGeneralState()->isAdolescent){
 			int ageCatAdolescent = getAgeCategoryAdolescent();
-			/** If an adolescent patient, use the adolescent OI probabilities */
-			double fractionOfBenefit = simContext->getRunSpecsInputs()->OIsFractionOfBenefit[i];
-			double probOIOffART = fractionOfBenefit * simContext->getAdolescentInputs()->monthlyOIProbOffART[currCD4Strata][i][histType][ageCatAdolescent]+
-				(1 - fractionOfBenefit) * simContext->getAdolescentInputs()->monthlyOIProbOffART[minCD4Strata][i][histType][ageCatAdolescent];
+			/** If an adolescent patient, use the adolescent OI probabilities, blended between the current and minimum CD4 strata by the OI fraction of benefit */
+			double probOIOffART = simContext->getOIProbOffARTAdolescent(currCD4Strata, minCD4Strata, i, histType, ageCatAdolescent);
 
 			/** Adjust for ART effect */
 			if (patient->getARTState()->applyARTEffect) {
-				double probOIOnART =  fractionOfBenefit * simContext->getAdolescentInputs()->monthlyOIProbOnART[currCD4Strata][i][histType][ageCatAdolescent]+
-						(1 - fractionOfBenefit) * simContext->getAdolescentInputs()->monthlyOIProbOnART[minCD4Strata][i][histType][ageCatAdolescent];
+				double probOIOnART = simContext->getOIProbOnARTAdolescent(currCD4Strata, minCD4Strata, i, histType, ageCatAdolescent);
 
 				/** Adjust multiplier between full ART effect and no ART effect according
 					to the factor from the ART response type (heterogeneity)*/
@@ -315,17 +310,15 @@ SimContext::OI_TYPE AcuteOIUpdater::determineAcuteOI() {
 			if (pedsAgeCat == SimContext::PEDS_AGE_ADULT) {
 				/** If an adult patient, use the adult OI probabilities */
 				/** Extract the natural history probability based on CD4, and OI history,
-					modify base probability by OI fraction of benefit */
-				double fractionOfBenefit = simContext->getRunSpecsInputs()->OIsFractionOfBenefit[i];
-				probOI[i] = fractionOfBenefit * natHist->monthlyOIProbOffART[currCD4Strata][i][histType] +
-					(1 - fractionOfBenefit) * natHist->monthlyOIProbOffART[minCD4Strata][i][histType];
+					modified by OI fraction of benefit */
+				probOI[i] = simContext->getOIProbOffART(currCD4Strata, minCD4Strata, i, histType);
 				/** Adjust for ART effect */
 				if (patient->getARTState()->applyARTEffect) {
 					double rateMult = simContext->getNatHistInputs()->monthlyOIProbOnARTMult[currCD4Strata][i];
 					/** Adjust multiplier between full ART effect and no ART effect according
 						to the factor from the ART response type (heterogeneity)*/
 					rateMult = 1 - (patient->getARTState()->responseFactorCurrRegimen[SimContext::HET_OUTCOME_ARTEFFECT_OI] * (1 - rateMult));
-					probOI[i] = CepacUtil::probRateMultiply(probOI[i], rateMult);
+					probOI[i] = CepacUtil::probRateMultiplyCached(probOI[i], rateMult);
 				}
 			}
 			else if (pedsAgeCat == SimContext::PEDS_AGE_LATE) {
@@ -337,7 +330,7 @@ SimContext::OI_TYPE AcuteOIUpdater::determineAcuteOI() {
 					// Adjust multiplier between full ART effect and no ART effect according
 					//	to the factor from the ART response type
 					rateMult = 1 - (patient->getARTState()->responseFactorCurrRegimen[SimContext::HET_OUTCOME_ARTEFFECT_OI] * (1 - rateMult));
-					probOI[i] = CepacUtil::probRateMultiply(probOI[i], rateMult);
+					probOI[i] = CepacUtil::probRateMultiplyCached(probOI[i], rateMult);
 				}
 			}
 			else {
@@ -357,7 +350,7 @@ SimContext::OI_TYPE AcuteOIUpdater::determineAcuteOI() {
 					// Adjust multiplier between full ART effect and no ART effect according
 					//	to the factor from the ART response type
 					rateMult = 1 - (patient->getARTState()->responseFactorCurrRegimen[SimContext::HET_OUTCOME_ARTEFFECT_OI] * (1 - rateMult));
-					probOI[i] = CepacUtil::probRateMultiply(probOI[i], rateMult);
+					probOI[i] = CepacUtil::probRateMultiplyCached(probOI[i], rateMult);
 				}
 			}
 		}
@@ -377,7 +370,7 @@ SimContext::OI_TYPE AcuteOIUpdater::determineAcuteOI() {
 				}
 
 			}
-			probOI[i] = CepacUtil::probRateMultiply(probOI[i], 1 - maxEfficacy[i]);
+			probOI[i] = CepacUtil::probRateMultiplyCached(probOI[i], 1 - maxEfficacy[i]);
 		}
 
 		/** If probability is 1, return the OI since it must happen */
@@ -423,7 +416,7 @@ void AcuteOIUpdater::determineDeathRiskSevereOI(SimContext::OI_TYPE oiType){
 	if (patient->getGeneralState()->isAdolescent){
 		SimContext::CD4_STRATA currCD4Strata = patient->getDiseaseState()->currTrueCD4Strata;
 		// Check if this is TB being modeled as a severe OI when the TB tab is not enabled 
-		if(!simContext->getTBInputs()->enableTB && simContext->getRunSpecsInputs()->OIsIncludeTB && oiType==0){
+		if(!simContext->isTBEnabled() && simContext->getRunSpecsInputs()->OIsIncludeTB && oiType==0){
 			OIDeathRateRatio = simContext->getAdolescentInputs()->acuteOIDeathRateRatioTB[currCD4Strata][getAgeCategoryAdolescent()];
 		}
 		// Otherwise, it is a regular severe OI
@@ -435,7 +428,7 @@ void AcuteOIUpdater::determineDeathRiskSevereOI(SimContext::OI_TYPE oiType){
 	else if(pedsAgeCat == SimContext::PEDS_AGE_ADULT){		
 		SimContext::CD4_STRATA currCD4Strata = patient->getDiseaseState()->currTrueCD4Strata;
 		// Check if this is TB being modeled as a severe OI when the TB tab is not enabled 
-		if(!simContext->getTBInputs()->enableTB && simContext->getRunSpecsInputs()->OIsIncludeTB && oiType==0){
+		if(!simContext->isTBEnabled() && simContext->getRunSpecsInputs()->OIsIncludeTB && oiType==0){
 			OIDeathRateRatio = simContext->getNatHistInputs()->acuteOIDeathRateRatioTB[currCD4Strata];
 		}
 		// Otherwise, it is a regular severe OI
@@ -447,7 +440,7 @@ void AcuteOIUpdater::determineDeathRiskSevereOI(SimContext::OI_TYPE oiType){
 	else if (pedsAgeCat == SimContext::PEDS_AGE_LATE){
 		SimContext::CD4_STRATA currCD4Strata = patient->getDiseaseState()->currTrueCD4Strata;
 		// Check if this is TB being modeled as a severe OI when the TB tab is not enabled 
-		if(!simContext->getTBInputs()->enableTB && simContext->getRunSpecsInputs()->OIsIncludeTB && oiType==0){
+		if(!simContext->isTBEnabled() && simContext->getRunSpecsInputs()->OIsIncludeTB && oiType==0){
 			OIDeathRateRatio = simContext->getPedsInputs()->acuteOIDeathRateRatioTBPedsLate[currCD4Strata];
 		}
 		// Otherwise, it is a regular severe OI 
@@ -459,7 +452,7 @@ void AcuteOIUpdater::determineDeathRiskSevereOI(SimContext::OI_TYPE oiType){
 	else{
 		SimContext::PEDS_CD4_PERC cd4PercStrata = patient->getDiseaseState()->currTrueCD4PercentageStrata;
 		// Check if this is TB being modeled as a severe OI when the TB tab is not enabled 
-		if(!simContext->getTBInputs()->enableTB && simContext->getRunSpecsInputs()->OIsIncludeTB && oiType==0){
+		if(!simContext->isTBEnabled() && simContext->getRunSpecsInputs()->OIsIncludeTB && oiType==0){
 			OIDeathRateRatio = simContext->getPedsInputs()->acuteOIDeathRateRatioTBPedsEarly[cd4PercStrata][pedsAgeCat];
 		}
 		// Otherwise, it is a regular severe OI
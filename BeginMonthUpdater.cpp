@@ -17,15 +17,17 @@ void BeginMonthUpdater::performInitialUpdates() {
 	StateUpdater::performInitialUpdates();
 
 	/** Initialize the general patient state */
-	int patientNum = runStats->getPopulationSummary()->numCohorts + 1;
+	int patientNum = runStats->getPatientNumOffset() + runStats->getPopulationSummary()->numCohorts + 1;
 	/** Increase numCohorts here so that the next created patient has a different patientNum, even if this patient isn't dead (i.e. in the transmission model) */
 	this->incrementCohortSize();
-	bool tracingEnabled = (patientNum <= SimContext::numPatientsToTrace);
+	bool tracingEnabled = (patientNum <= simContext->numPatientsToTrace);
 	initializePatient(patientNum, tracingEnabled);
 
-	//Reset seed for patient if using fixed seed
+	//Seed the patient's own random number generator from the patient number, combined with the time seed if using random seed
 	if (!simContext->getRunSpecsInputs()->randomSeedByTime)
-		CepacUtil::setFixedSeed(patient);
+		CepacUtil::setFixedSeed(patient, simContext->getRunSeed());
+	else
+		CepacUtil::setPatientTimeSeed(patient, simContext->getRunSeed());
 
 	/** Determine the patients gender */
 	double randNum = CepacUtil::getRandomDouble(20010, patient);
@@ -74,7 +76,7 @@ void BeginMonthUpdater::performInitialUpdates() {
         double ageMonthsMean;
         double ageMonthsStdDev;
         // Use Peds Tab age input if Peds model is active
-        if (simContext->getPedsInputs()->enablePediatricsModel){
+        if (simContext->isPedsModelEnabled()){
 			ageMonthsMean = simContext->getPedsInputs()->initialAgeMean;
 			ageMonthsStdDev = simContext->getPedsInputs()->initialAgeStdDev;
 		}
@@ -100,8 +102,8 @@ void BeginMonthUpdater::performInitialUpdates() {
 	bool isAdolescent = false;
 	bool isPediatric = false;
 	
-	if(simContext->getAdolescentInputs()->enableAdolescent){
-		if(simContext->getPedsInputs()->enablePediatricsModel && 
+	if(simContext->isAdolescentEnabled()){
+		if(simContext->isPedsModelEnabled() && 
 		 (patient->getGeneralState()->ageMonths < simContext->getAdolescentInputs()->ageTransitionFromPeds))
 			isPediatric = true;
 		else if(simContext->getAdolescentInputs()->transitionToAdult){
@@ -157,7 +159,7 @@ void BeginMonthUpdater::performMonthlyUpdates() {
 				if (patient->getPedsState()->ageCategoryPediatrics < SimContext::PEDS_AGE_ADULT) {
 					tracer->printTrace(1, "  Peds HIV state: %s\n",
 						SimContext::PEDS_HIV_STATE_STRS[patient->getDiseaseState()->infectedPediatricsHIVState]);
-					if (simContext->getEIDInputs()->enableHIVTestingEID)
+					if (simContext->isEIDTestingEnabled())
 						tracer->printTrace(1, "  Age of Seroreversion: %d\n", patient->getPedsState()->ageOfSeroreversion);
 
 					tracer->printTrace(1, "  Maternal State:%s,%s,%s,%s,%s\n", SimContext::PEDS_MATERNAL_STATUS_STRS[patient->getPedsState()->maternalStatus],
@@ -200,7 +202,7 @@ void BeginMonthUpdater::performMonthlyUpdates() {
 				if (patient->getPedsState()->ageCategoryPediatrics < SimContext::PEDS_AGE_ADULT) {
 					tracer->printTrace(1, "  Peds HIV state: %s\n",
 						SimContext::PEDS_HIV_STATE_STRS[patient->getDiseaseState()->infectedPediatricsHIVState]);
-					if (simContext->getEIDInputs()->enableHIVTestingEID)
+					if (simContext->isEIDTestingEnabled())
 						tracer->printTrace(1, "  Age of Seroreversion: %d\n", patient->getPedsState()->ageOfSeroreversion);
 					tracer->printTrace(1, "  Maternal State:%s,%s,%s,%s,%s\n", SimContext::PEDS_MATERNAL_STATUS_STRS[patient->getPedsState()->maternalStatus],
 							SimContext::PEDS_BF_TYPE_STRS[patient->getPedsState()->breastfeedingStatus],
@@ -213,7 +215,7 @@ void BeginMonthUpdater::performMonthlyUpdates() {
 					(patient->getMonitoringState()->isDetectedHIVPositive) ? "detected" : "undetected");
 				for (int i = 0; i < SimContext::OI_NUM; i++) {
 					if (patient->getDiseaseState()->hasTrueOIHistory[i]) {
-						tracer->printTrace(1, "  init OI history: %s\n", SimContext::OI_STRS[i]);
+						tracer->printTrace(1, "  init OI history: %s\n", simContext->OI_STRS[i]);
 					}
 				}
 			} //end if tracing is enabled
@@ -229,16 +231,16 @@ void BeginMonthUpdater::performMonthlyUpdates() {
 							break;
 						}
 					}
-					tracer->printTrace(1, "  init prevalent CHRMs: %s (%d m old, stage %d)\n", SimContext::CHRM_STRS[i], patient->getGeneralState()->monthNum - patient->getDiseaseState()->monthOfCHRMsStageStart[i][0], stage);
+					tracer->printTrace(1, "  init prevalent CHRMs: %s (%d m old, stage %d)\n", simContext->CHRM_STRS[i], patient->getGeneralState()->monthNum - patient->getDiseaseState()->monthOfCHRMsStageStart[i][0], stage);
 				}
 			}
 			for (int i = 0; i < SimContext::RISK_FACT_NUM; i++) {
 				if (patient->getGeneralState()->hasRiskFactor[i]) {
-					tracer->printTrace(1, "  init prevalent Risk Factors: %s\n", SimContext::RISK_FACT_STRS[i]);
+					tracer->printTrace(1, "  init prevalent Risk Factors: %s\n", simContext->RISK_FACT_STRS[i]);
 				}
 			}
 
-			if (simContext->getTBInputs()->enableTB){
+			if (simContext->isTBEnabled()){
 				tracer->printTrace(1, "  TB Init State: %s;\n",
 					SimContext::TB_STATE_STRS[patient->getTBState()->currTrueTBDiseaseState]);
 				
@@ -304,7 +304,7 @@ void BehaviorUpdater::performMonthlyUpdates() {
 		setCurrLTFUState(SimContext::LTFU_STATE_LOST);
 
 		/** Check whether changes are needed to the patient's TB care state at an integrated HIV/TB clinic */
-		if (simContext->getTBInputs()->enableTB && simContext->getTBInputs()->useTBLTFU && simContext->getTBInputs()->isIntegrated){
+		if (simContext->isTBEnabled() && simContext->getTBInputs()->useTBLTFU && simContext->getTBInputs()->isIntegrated){
 			if (patient->getTBState()->careState == SimContext::TB_CARE_IN_CARE){
 				setTBLTFU();
 			}
@@ -395,7 +395,7 @@ void BehaviorUpdater::performMonthlyUpdates() {
 					if (patient->getGeneralState()->tracingEnabled) {
 						tracer->printTrace(1, "**%d STOP %s PROPH %d for OI %s;\n", patient->getGeneralState()->monthNum,
 							SimContext::PROPH_TYPE_STRS[patient->getProphState()->currProphType[i]],
-							patient->getProphState()->currProphNum[i] + 1, SimContext::OI_STRS[i]);
+							patient->getProphState()->currProphNum[i] + 1, simContext->OI_STRS[i]);
 					}
 					stopCurrProph((SimContext::OI_TYPE) i);
 				}
@@ -28,11 +28,9 @@ void CD4HVLUpdater::performMonthlyUpdates() {
 	//Draws the patient specific cd4 decline increment if it hasn't been drawn
 	if (!patient->getDiseaseState()->hasDrawnPatientSpecificCD4Decline){
 		double cd4Perc=CepacUtil::getRandomGaussian(0, natHist->monthlyCD4DeclineBtwSubject,40005,patient);
-		int count = 0;
 		while(cd4Perc<-1)
 		{
-			count++;
-			cd4Perc=CepacUtil::getRandomGaussian(0, natHist->monthlyCD4DeclineBtwSubject,40005+count,patient);
+			cd4Perc=CepacUtil::getRandomGaussian(0, natHist->monthlyCD4DeclineBtwSubject,40005,patient);
 		}
 		setPatientNatHistSlopePerc(cd4Perc);
 	}
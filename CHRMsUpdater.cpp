@@ -137,7 +137,7 @@ void CHRMsUpdater::performMonthlyUpdates() {
 				/** Print out tracing for the incidence of the CHRM */
 				if (patient->getGeneralState()->tracingEnabled) {
 					tracer->printTrace(1, "**%d INCIDENT CHRMs %s;\n",
-							patient->getGeneralState()->monthNum, SimContext::CHRM_STRS[i]);
+							patient->getGeneralState()->monthNum, simContext->CHRM_STRS[i]);
 				}
 			}
 
@@ -154,7 +154,7 @@ void CHRMsUpdater::performMonthlyUpdates() {
 				setRiskFactor(i, true);
 				if (patient->getGeneralState()->tracingEnabled) {
 					tracer->printTrace(1, "**%d INCIDENT RISK FACTOR %s;\n",
-					patient->getGeneralState()->monthNum, SimContext::RISK_FACT_STRS[i]);
+					patient->getGeneralState()->monthNum, simContext->RISK_FACT_STRS[i]);
 				}
 			}
 		}
@@ -26,10 +26,24 @@ const char *CepacUtil::FILE_EXTENSION_FOR_OUTPUT = ".out";
 const char *CepacUtil::FILE_EXTENSION_FOR_COSTS_OUTPUT = ".cout";
 /** .orph */
 const char *CepacUtil::FILE_EXTENSION_FOR_ORPHAN_OUTPUT = ".orph";
+/** .part */
+const char *CepacUtil::FILE_EXTENSION_FOR_PARTIAL_OUTPUT = ".part";
 /** .in */
 const char *CepacUtil::FILE_EXTENSION_FOR_INPUT = ".in";
+/** .inb */
+const char *CepacUtil::FILE_EXTENSION_FOR_INPUT_CACHE = ".inb";
+/** .res */
+const char *CepacUtil::FILE_EXTENSION_FOR_RESULT_CACHE = ".res";
 /** *.in */
 const char *CepacUtil::FILE_EXTENSION_INPUT_SEARCH_STR = "*.in";
+/** .ovl */
+const char *CepacUtil::FILE_EXTENSION_FOR_OVERLAY = ".ovl";
+/** *.ovl */
+const char *CepacUtil::FILE_EXTENSION_OVERLAY_SEARCH_STR = "*.ovl";
+/** .psa */
+const char *CepacUtil::FILE_EXTENSION_FOR_PSA = ".psa";
+/** .psa.out */
+const char *CepacUtil::FILE_EXTENSION_FOR_PSA_OUTPUT = ".psa.out";
 /** popstats.out */
 const char *CepacUtil::FILE_NAME_SUMMARIES = "popstats.out";
 
@@ -39,11 +53,34 @@ std::vector<std::string> CepacUtil::filesToRun;
 std::string CepacUtil::inputsDirectory;
 /** The output directory path */
 std::string CepacUtil::resultsDirectory;
-/** True if we're using random seed, false for fixed seed */
-bool CepacUtil::useRandomSeedByTime;
-
-/** \brief Random number generator class */
-MTRand CepacUtil::mtRand;
+/** The shard of each cohort simulated by this process, numbered from 1 */
+int CepacUtil::shardNum = 0;
+/** The number of shards each cohort is split into, 0 if this process simulates whole cohorts */
+int CepacUtil::numShards = 0;
+/** True if the inputs are loaded from and saved to a binary input cache next to each input file, off unless selected */
+bool CepacUtil::useInputCache = false;
+/** The number of threads the tabs of each input file are read with, 1 to read them one after another */
+int CepacUtil::numInputThreads = 1;
+/** True if the tabs of the disabled TB, Peds, EID and Adolescent modules are skipped after their enable input, unless all tabs are to be read */
+bool CepacUtil::skipDisabledInputTabs = true;
+/** True if the inputs of each run are checked before it is simulated and runs with invalid inputs are not simulated, unless turned off */
+bool CepacUtil::validateInputs = true;
+/** The directory of the result cache, empty unless a result cache is selected */
+std::string CepacUtil::resultCacheDirectory;
+/** True if patients draw from the counter-based generator instead of the Mersenne Twister */
+bool CepacUtil::useCounterRandom = false;
+/** True if all input files share the run seed and the counter-based draws are synchronized by month, requires useCounterRandom */
+bool CepacUtil::useCommonRandomNumbers = false;
+/** The method used to draw normal deviates, the polar Box-Muller method unless selected otherwise */
+CepacUtil::GAUSSIAN_METHOD CepacUtil::gaussianMethod = CepacUtil::GAUSSIAN_POLAR;
+/** True if the results found in the probRateMultiply memo are checked against probRateMultiply, off unless selected */
+bool CepacUtil::checkProbRateCache = false;
+/** The number of results found in the probRateMultiply memo that were checked */
+std::atomic<long long> CepacUtil::numProbRateCacheChecks(0);
+/** The right edges of the ziggurat layers, and the ratio of each to the one below it, computed before main runs */
+double CepacUtil::zigguratX[CepacUtil::ZIGGURAT_NUM_LAYERS + 1];
+double CepacUtil::zigguratRatio[CepacUtil::ZIGGURAT_NUM_LAYERS];
+static bool isZigguratInitialized = CepacUtil::initZigguratTables();
 
 /** \brief useCurrentDirectoryForInputs determines the current directory and sets as inputs directory 
  * Currently handles OS differences for Windows, Linux, and Apple
@@ -66,42 +103,57 @@ void CepacUtil::useCurrentDirectoryForInputs() {
 #endif
 } /* end useCurrentDirectoryForInputs */
 
-/** \brief findInputFiles locates all the .in files in the current directory and adds them
-	to the filesToRun vector */
+/** \brief findInputFiles locates all the .in files in the current directory, followed by all the .ovl scenario
+	overlay files, and adds them to the filesToRun vector */
 void CepacUtil::findInputFiles() {
+	const char *searchStrs[] = {FILE_EXTENSION_INPUT_SEARCH_STR, FILE_EXTENSION_OVERLAY_SEARCH_STR};
+	filesToRun.clear();
+	for (int searchNum = 0; searchNum < 2; searchNum++) {
 #if defined(_WIN32)
-	intptr_t hFile;
-	struct _finddata_t tFileInfo;
-	hFile = _findfirst( FILE_EXTENSION_INPUT_SEARCH_STR, &tFileInfo );
-	int nInputFiles = 0;
-	string fileName;
+		intptr_t hFile;
+		struct _finddata_t tFileInfo;
+		hFile = _findfirst( searchStrs[searchNum], &tFileInfo );
+		if (hFile == -1)
+			continue;
+		string fileName;
 
-	//get the list of files that we have to process
-	filesToRun.clear();
-	do {
-		fileName = (char *) tFileInfo.name;
-		filesToRun.push_back(fileName);
-		nInputFiles++;
-	} while ( _findnext ( hFile, &tFileInfo ) == 0 );
-	_findclose( hFile );
+		//get the list of files that we have to process
+		do {
+			fileName = (char *) tFileInfo.name;
+			filesToRun.push_back(fileName);
+		} while ( _findnext ( hFile, &tFileInfo ) == 0 );
+		_findclose( hFile );
 #else
-	glob_t files;
-	glob(FILE_EXTENSION_INPUT_SEARCH_STR, GLOB_ERR, NULL, &files);
-	int nInputFiles = 0;
-	string fileName;
+		glob_t files;
+		if (glob(searchStrs[searchNum], GLOB_ERR, NULL, &files) != 0) {
+			globfree( &files);
+			continue;
+		}
+		string fileName;
 
-	filesToRun.clear();
-	//get the list of files that we have to process
-	int i;
-	for( i = 0; i < files.gl_pathc; i++) {
-		fileName = (char *) files.gl_pathv[i];
-		filesToRun.push_back(fileName);
-		++nInputFiles;
-	}
-	globfree( &files);
+		//get the list of files that we have to process
+		int i;
+		for( i = 0; i < files.gl_pathc; i++) {
+			fileName = (char *) files.gl_pathv[i];
+			filesToRun.push_back(fileName);
+		}
+		globfree( &files);
 #endif
+	}
 } /* end findInputFiles */
 
+/** \brief getRunName returns the name of the run of an input file or scenario overlay file, its name without the extension
+ *
+ * \param inputFileName a reference to the name of the .in or .ovl file
+ **/
+std::string CepacUtil::getRunName(const std::string &inputFileName) {
+	size_t overlayLength = strlen(FILE_EXTENSION_FOR_OVERLAY);
+	if ((inputFileName.size() > overlayLength) &&
+			(inputFileName.compare(inputFileName.size() - overlayLength, overlayLength, FILE_EXTENSION_FOR_OVERLAY) == 0))
+		return inputFileName.substr(0, inputFileName.size() - overlayLength);
+	return inputFileName.substr(0, inputFileName.find(FILE_EXTENSION_FOR_INPUT));
+} /* end getRunName */
+
 /** \brief createResultsDirectory creates the directory "results" as a subdirectory of the inputs one */
 void CepacUtil::createResultsDirectory() {
 #if defined(_WIN32)
@@ -117,6 +169,18 @@ void CepacUtil::createResultsDirectory() {
 #endif
 } /* end createResultsDirectory */
 
+/** \brief createResultCacheDirectory creates the directory of the result cache if it does not exist, a relative path
+ * being taken from the inputs directory
+ **/
+void CepacUtil::createResultCacheDirectory() {
+	changeDirectoryToInputs();
+#if defined(_WIN32)
+	_mkdir(resultCacheDirectory.c_str());
+#else
+	mkdir(resultCacheDirectory.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+#endif
+} /* end createResultCacheDirectory */
+
 /** \brief changeDirectoryToResults changes the working directory to the results one */
 void CepacUtil::changeDirectoryToResults() {
 #if defined(_WIN32)
@@ -162,6 +226,134 @@ void CepacUtil::getTimeString(char *buffer, int bufsize) {
 #endif
 } /* end getTimeString */
 
+/** \brief getCounterRandomDouble returns a random number within the range [0,1) from the patient's counter-based generator
+ *
+ * Kept out of line so that the Mersenne Twister path of getRandomDouble stays small enough to inline at every call site
+ *
+ * \param callSiteId an integer specifying what function called the random number generator, each call site has its own stream of draws
+ * \param patient a pointer to the Patient whose random number generator is drawn from
+ * \return a double randomly selected in the range [0,1)
+ **/
+double CepacUtil::getCounterRandomDouble(int callSiteId, Patient *patient) {
+	return (*patient->getCounterRandomGenerator())(callSiteId);
+} /* end getCounterRandomDouble */
+
+/** \brief initZigguratTables computes the layers of the ziggurat for 128 layers of equal area under the normal density
+ *
+ * Follows Doornik's ZIGNOR (2005): layer 0 is the base strip together with the tail beyond R
+ *
+ * \return true, so it can initialize a static variable before main runs
+ **/
+bool CepacUtil::initZigguratTables() {
+	const double tailStart = 3.442619855899;
+	const double layerArea = 9.91256303526217e-3;
+	double f = exp(-0.5 * tailStart * tailStart);
+	zigguratX[0] = layerArea / f;
+	zigguratX[1] = tailStart;
+	zigguratX[ZIGGURAT_NUM_LAYERS] = 0;
+	for (int i = 2; i < ZIGGURAT_NUM_LAYERS; i++) {
+		zigguratX[i] = sqrt(-2 * log(layerArea / zigguratX[i - 1] + f));
+		f = exp(-0.5 * zigguratX[i] * zigguratX[i]);
+	}
+	for (int i = 0; i < ZIGGURAT_NUM_LAYERS; i++)
+		zigguratRatio[i] = zigguratX[i + 1] / zigguratX[i];
+	return true;
+} /* end initZigguratTables */
+
+/** \brief getZigguratGaussian returns a standard normal deviate drawn with the ziggurat method
+ *
+ * The top 7 bits of a uniform draw pick the layer and the remaining bits give the position within it, so about
+ * 99% of the deviates take a single uniform draw, a compare and a multiply.  The rest are drawn from the wedge
+ * of the layer or from the tail beyond R, as in Doornik's ZIGNOR (2005)
+ *
+ * \param callSiteId an integer specifying what function called the random number generator, passed on to getRandomDouble
+ * \param patient a pointer to the Patient whose random number generator is drawn from
+ * \return a double drawn from the standard normal distribution
+ **/
+double CepacUtil::getZigguratGaussian(int callSiteId, Patient *patient) {
+	while (true) {
+		double scaled = getRandomDouble(callSiteId, patient) * ZIGGURAT_NUM_LAYERS;
+		int layer = (int) scaled;
+		double u = 2.0 * (scaled - layer) - 1.0;
+		if (fabs(u) < zigguratRatio[layer])
+			return u * zigguratX[layer];
+
+		if (layer == 0) {
+			/** Draw from the tail beyond R with Marsaglia's method */
+			double tailStart = zigguratX[1];
+			double x, y;
+			do {
+				x = log(1.0 - getRandomDouble(callSiteId, patient)) / tailStart;
+				y = log(1.0 - getRandomDouble(callSiteId, patient));
+			} while (-2 * y < x * x);
+			return (u < 0) ? x - tailStart : tailStart - x;
+		}
+
+		/** Accept a point in the wedge of the layer if it falls under the density */
+		double x = u * zigguratX[layer];
+		double f0 = exp(-0.5 * (zigguratX[layer] * zigguratX[layer] - x * x));
+		double f1 = exp(-0.5 * (zigguratX[layer + 1] * zigguratX[layer + 1] - x * x));
+		if (f1 + getRandomDouble(callSiteId, patient) * (f0 - f1) < 1.0)
+			return x;
+	}
+} /* end getZigguratGaussian */
+
+/** ProbRateCacheEntry holds a result of probRateMultiply, keyed by the bits of its probability and rate multiplier */
+class ProbRateCacheEntry {
+public:
+	unsigned long long probBits;
+	unsigned long long rateMultBits;
+	double result;
+};
+/** Direct-mapped memo of probRateMultiply of each thread; it starts zeroed, which matches no key since a rate
+	multiplier of 0 is never looked up */
+static thread_local ProbRateCacheEntry probRateCache[CepacUtil::PROB_RATE_CACHE_SIZE];
+
+/** \brief probRateMultiplyCached returns probRateMultiply(prob, rateMult), looking it up in a memo of recent results of
+ * the thread rather than calling pow when the same probability and multiplier were used recently
+ *
+ * Keys are compared bit for bit, so the result is always that of probRateMultiply.  With checkProbRateCache set, a
+ * result found in the memo is compared with probRateMultiply and the run is stopped if they differ
+ *
+ * \param prob a double representing the probability to be multiplied
+ * \param rateMult a double representing the rate multiplier to apply to the probability
+ * \return a double representing the adjusted probability
+ **/
+double CepacUtil::probRateMultiplyCached(double prob, double rateMult) {
+	if ((rateMult == 0) || (rateMult == 1))
+		return probRateMultiply(prob, rateMult);
+
+	unsigned long long probBits;
+	unsigned long long rateMultBits;
+	memcpy(&probBits, &prob, sizeof(prob));
+	memcpy(&rateMultBits, &rateMult, sizeof(rateMult));
+	unsigned long long hash = (probBits * 0x9E3779B97F4A7C15ULL) ^ (rateMultBits * 0xC2B2AE3D27D4EB4FULL);
+	hash ^= hash >> 29;
+	ProbRateCacheEntry &entry = probRateCache[hash & (PROB_RATE_CACHE_SIZE - 1)];
+	if ((entry.probBits != probBits) || (entry.rateMultBits != rateMultBits)) {
+		entry.probBits = probBits;
+		entry.rateMultBits = rateMultBits;
+		entry.result = probRateMultiply(prob, rateMult);
+	}
+	else if (checkProbRateCache) {
+		double result = probRateMultiply(prob, rateMult);
+		if (memcmp(&result, &entry.result, sizeof(result)) != 0) {
+			printf("   ERROR - probRateMultiply(%.17g, %.17g) is %.17g but its memo gave %.17g\n", prob, rateMult, result, entry.result);
+			fflush(stdout);
+			abort();
+		}
+		numProbRateCacheChecks++;
+	}
+	return entry.result;
+} /* end probRateMultiplyCached */
+
+/** \brief printProbRateCacheCheck prints the number of results of the probRateMultiply memo that were checked, if they were */
+void CepacUtil::printProbRateCacheCheck() {
+	if (!checkProbRateCache)
+		return;
+	printf("Checked %lld results of the probRateMultiply memo, all equal to probRateMultiply\n", numProbRateCacheChecks.load());
+} /* end printProbRateCacheCheck */
+
 /** \brief fileExists returns true if the specified file exists, false otherwise
  * \param filename a pointer to a character array representing the name of the file
  **/
@@ -190,3 +382,46 @@ FILE *CepacUtil::openFile(const char *filename, const char *mode) {
 void CepacUtil::closeFile(FILE *file) {
 	fclose(file);
 } /* end closeFile */
+
+/** \brief getFileHash returns a 64 bit hash of the contents of a file, or 0 if it cannot be read
+ *
+ * FNV-1a applied to 8 byte words rather than single bytes, with the high half of the hash folded into the low half
+ * after each word so that every bit of the file affects every bit of the hash.  Used to tell whether an input file
+ * has changed since a partial statistics file or binary input cache was written from it.
+ *
+ * \param filename a pointer to a character array representing the name of the file
+ **/
+unsigned long long CepacUtil::getFileHash(const char *filename) {
+	FILE *file = fopen(filename, "rb");
+	if (file == NULL)
+		return 0;
+	unsigned long long hash = getFileHash(file);
+	fclose(file);
+	return hash;
+} /* end getFileHash */
+
+/** \brief getFileHash returns the 64 bit hash of the rest of an open file, from its current position to its end, as
+ * getFileHash of a file name hashes a whole file
+ *
+ * \param file a pointer to the FILE, opened for binary reading
+ **/
+unsigned long long CepacUtil::getFileHash(FILE *file) {
+	unsigned long long hash = 14695981039346656037ULL;
+	unsigned char buffer[65536];
+	size_t numRead;
+	/* fread only returns fewer bytes than requested at the end of the file, so the words do not depend on the reads */
+	while ((numRead = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+		size_t i = 0;
+		for (; i + sizeof(unsigned long long) <= numRead; i += sizeof(unsigned long long)) {
+			unsigned long long word;
+			memcpy(&word, buffer + i, sizeof(word));
+			hash = (hash ^ word) * 1099511628211ULL;
+			hash ^= hash >> 32;
+		}
+		for (; i < numRead; i++) {
+			hash ^= buffer[i];
+			hash *= 1099511628211ULL;
+		}
+	}
+	return hash;
+} /* end getFileHash */
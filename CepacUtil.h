@@ -22,8 +22,15 @@ public:
 	static const char *FILE_EXTENSION_FOR_OUTPUT;
 	static const char *FILE_EXTENSION_FOR_COSTS_OUTPUT;
 	static const char *FILE_EXTENSION_FOR_ORPHAN_OUTPUT;
+	static const char *FILE_EXTENSION_FOR_PARTIAL_OUTPUT;
 	static const char *FILE_EXTENSION_FOR_INPUT;
+	static const char *FILE_EXTENSION_FOR_INPUT_CACHE;
+	static const char *FILE_EXTENSION_FOR_RESULT_CACHE;
 	static const char *FILE_EXTENSION_INPUT_SEARCH_STR;
+	static const char *FILE_EXTENSION_FOR_OVERLAY;
+	static const char *FILE_EXTENSION_OVERLAY_SEARCH_STR;
+	static const char *FILE_EXTENSION_FOR_PSA;
+	static const char *FILE_EXTENSION_FOR_PSA_OUTPUT;
 	static const char *FILE_NAME_SUMMARIES;
 
 	/* Vector of the file names to be run, and the inputs and results directories paths */
@@ -31,10 +38,26 @@ public:
 	static std::string inputsDirectory;
 	static std::string resultsDirectory;
 
+	/* Shard of each cohort simulated by this process, numbered from 1; numShards is 0 if whole cohorts are simulated */
+	static int shardNum;
+	static int numShards;
+	/* True if the inputs are loaded from and saved to a binary input cache next to each input file */
+	static bool useInputCache;
+	/* Number of threads the tabs of each input file are read with */
+	static int numInputThreads;
+	/* True if the rest of the tabs of disabled modules (TB, Peds, EID, Adolescent) is not read */
+	static bool skipDisabledInputTabs;
+	/* True if the inputs of each run are checked by an InputValidator before it is simulated */
+	static bool validateInputs;
+	/* Directory of the result cache the results of runs are saved in and restored from, empty if it is not used */
+	static std::string resultCacheDirectory;
+
 	/* Functions for handling directories and locating the input files */
 	static void useCurrentDirectoryForInputs();
 	static void findInputFiles();
+	static std::string getRunName(const std::string &inputFileName);
 	static void createResultsDirectory();
+	static void createResultCacheDirectory();
 	static void changeDirectoryToResults();
 	static void changeDirectoryToInputs();
 
@@ -43,13 +66,26 @@ public:
 	static void getTimeString(char *buffer, int bufsize);
 
 	/* Functions and state variables for generating uniform and gaussian random numbers */
-	static void setRandomSeedType(bool useTimeSeed);
-	static void setFixedSeed(Patient *patient);
+	static unsigned long getRunSeed(bool useTimeSeed);
+	static void setFixedSeed(Patient *patient, unsigned long runSeed);
+	static void setPatientTimeSeed(Patient *patient, unsigned long runSeed);
+	static void setRandomMonth(Patient *patient);
 	static double getRandomDouble(int callSiteId, Patient *patient);
+	static double getCounterRandomDouble(int callSiteId, Patient *patient);
 	static double getRandomGaussian(double mean, double stdDev, int callSiteId, Patient *patient);
-	static int getRandomDiscrete(int min, int numOutcomes);
-	static bool useRandomSeedByTime;
-	static MTRand mtRand;
+	static int getRandomDiscrete(int min, int numOutcomes, int callSiteId, Patient *patient);
+	static bool useCounterRandom;
+	static bool useCommonRandomNumbers;
+
+	/* Methods for drawing normal deviates: the polar Box-Muller method of the model's published results, the same method
+		returning the second deviate of each draw on the next call at that call site, or the ziggurat method */
+	enum GAUSSIAN_METHOD {GAUSSIAN_POLAR, GAUSSIAN_POLAR_CACHED, GAUSSIAN_ZIGGURAT};
+	static GAUSSIAN_METHOD gaussianMethod;
+	static double getZigguratGaussian(int callSiteId, Patient *patient);
+	static const int ZIGGURAT_NUM_LAYERS = 128;
+	static double zigguratX[ZIGGURAT_NUM_LAYERS + 1];
+	static double zigguratRatio[ZIGGURAT_NUM_LAYERS];
+	static bool initZigguratTables();
 
 	/* Probability modification functions */
 	static double probToRate(double prob);
@@ -59,71 +95,171 @@ public:
 	static double logitToProb(double logit);
 	static double probLogitAdjustment(double prob, double logitAdjust);
 
+	/* Memo of probRateMultiply for each thread, used by the OI and TB updaters, which apply the same rate multipliers to
+		the same probabilities month after month; its results are those of probRateMultiply to the last bit */
+	static double probRateMultiplyCached(double prob, double rateMult);
+	static const int PROB_RATE_CACHE_SIZE = 1024;
+	/* True if every result found in the memo is checked against probRateMultiply, and the number of results checked */
+	static bool checkProbRateCache;
+	static std::atomic<long long> numProbRateCacheChecks;
+	static void printProbRateCacheCheck();
+
 	/* Functions for opening and closing files */
 	static bool fileExists(const char *filename);
 	static FILE *openFile(const char *filename, const char *mode);
 	static void closeFile(FILE *file);
+	static unsigned long long getFileHash(const char *filename);
+	static unsigned long long getFileHash(FILE *file);
+
+	/* Functions for writing and reading values that hold no pointers or strings to binary files */
+	template <class T> static void writeBinary(FILE *file, const T &value);
+	template <class T> static void readBinary(FILE *file, T *value);
 };
 
-/** \brief setRandomSeedType sets up the random number generator to use seed by time (i.e. random seed) or fixed seed
+/** \brief writeBinary writes the bytes of a value to a binary file, used for the partial statistics of a shard
+ *
+ * \param file a pointer to the FILE to write to, opened in binary mode
+ * \param value the value to write, which must not hold pointers, strings or containers
+ **/
+template <class T> inline void CepacUtil::writeBinary(FILE *file, const T &value) {
+	static_assert(is_trivially_copyable<T>::value, "writeBinary can only write values without pointers, strings or containers");
+	fwrite(&value, sizeof(T), 1, file);
+} /* end writeBinary */
+
+/** \brief readBinary reads the bytes of a value written by writeBinary, throwing a string error if the file ends first
+ *
+ * \param file a pointer to the FILE to read from, opened in binary mode
+ * \param value a pointer to the value to read into
+ **/
+template <class T> inline void CepacUtil::readBinary(FILE *file, T *value) {
+	static_assert(is_trivially_copyable<T>::value, "readBinary can only read values without pointers, strings or containers");
+	if (fread(value, sizeof(T), 1, file) != 1) {
+		string errorString = "   ERROR - Partial statistics file ended before all the statistics were read";
+		throw errorString;
+	}
+} /* end readBinary */
+
+/** \brief getRunSeed returns the seed of a run, drawn from the time if patients are seeded by time (i.e. random seed)
+ *
+ * Each Patient owns its random number generator, which is seeded from its patient number and the run seed
+ * by setFixedSeed or setPatientTimeSeed.  Called once per input file while its inputs are read, the
+ * result is stored in its SimContext
  *
  * \param useTimeSeed a boolean that determines whether to use fixed or random seed: if true, use random, else use fixed
+ * \return the seed of the run
  **/
-inline void CepacUtil::setRandomSeedType(bool useTimeSeed) {
-	useRandomSeedByTime = useTimeSeed;
-	if (useRandomSeedByTime)
-		mtRand.seed((unsigned int) time(0));
-	else
-		mtRand.seed(8675309);
-} /* end setRandomSeedType */
+inline unsigned long CepacUtil::getRunSeed(bool useTimeSeed) {
+	static unsigned long commonTimeSeed = 0;
+	if (!useTimeSeed)
+		return 8675309;
+	/** With common random numbers every input file reuses the time seed drawn for the first one, so that patient N
+	 sees the same draws in every strategy */
+	if (!useCommonRandomNumbers || (commonTimeSeed == 0))
+		commonTimeSeed = (unsigned int) time(0);
+	return commonTimeSeed;
+} /* end getRunSeed */
 
-/** \brief setfixed seed type sets the seed using the patient number
+/** \brief setfixed seed type sets the seed of the patient's generator using the patient number
  *
+ * The counter-based generator is keyed by the fixed run seed and the patient number
  */
-inline void CepacUtil::setFixedSeed(Patient *patient){
-	mtRand.seed(patient->getGeneralState()->patientNum);
+inline void CepacUtil::setFixedSeed(Patient *patient, unsigned long runSeed){
+	patient->getSpareGaussian()->callSiteId = -1;
+	if (useCounterRandom)
+		patient->getCounterRandomGenerator()->seed(runSeed, patient->getGeneralState()->patientNum);
+	else
+		patient->getRandomGenerator()->seed(patient->getGeneralState()->patientNum);
 }/* end setFixedSeed */
 
+/** \brief setPatientTimeSeed seeds the patient's generator from the run's time seed and the patient number
+ *
+ * Every patient gets its own stream, so the draws for patient N do not depend on the patients simulated
+ * before it or on which thread runs it
+ */
+inline void CepacUtil::setPatientTimeSeed(Patient *patient, unsigned long runSeed){
+	patient->getSpareGaussian()->callSiteId = -1;
+	if (useCounterRandom) {
+		patient->getCounterRandomGenerator()->seed(runSeed, patient->getGeneralState()->patientNum);
+	}
+	else {
+		unsigned long seedArray[2] = {runSeed, (unsigned long) patient->getGeneralState()->patientNum};
+		patient->getRandomGenerator()->seed(seedArray, 2);
+	}
+}/* end setPatientTimeSeed */
+
+/** \brief setRandomMonth keys the patient's subsequent draws by the current month when using common random numbers
+ *
+ * Each call site then starts every month from the same draw whatever happened in earlier months, so input files
+ * that differ only in a few policy inputs keep their patients' draws aligned after their histories diverge
+ */
+inline void CepacUtil::setRandomMonth(Patient *patient){
+	if (useCommonRandomNumbers) {
+		patient->getCounterRandomGenerator()->setMonth(patient->getGeneralState()->monthNum);
+		patient->getSpareGaussian()->callSiteId = -1;
+	}
+}/* end setRandomMonth */
+
 /** \brief getRandomDouble returns a random number within the range [0,1)
  *
- * \param callSiteId an integer specifying what function called the random number generator: was used for synchronized fixed seed and now no longer has a function
- * \param patient a pointer to the Patient; was used for synchronized fixed seed and now no longer has a function
+ * \param callSiteId an integer specifying what function called the random number generator: with the counter-based generator
+ * each call site has its own stream of draws for the patient, otherwise it has no function
+ * \param patient a pointer to the Patient whose random number generator is drawn from
  * \return a double randomly selected in the range [0,1)
  **/
 inline double CepacUtil::getRandomDouble(int callSiteId, Patient *patient) {
-	return mtRand();
+	if (useCounterRandom)
+		return getCounterRandomDouble(callSiteId, patient);
+	return (*patient->getRandomGenerator())();
 } /* end getRandomDouble */
 
 /** \brief getRandomGaussian returns a random normally distributed value with the specified mean and standard deviation
+ *
+ * Uses the method selected by gaussianMethod.  The default polar Box-Muller draws reproduce earlier results; caching its
+ * second deviate halves the uniform draws for call sites that draw repeatedly, and the ziggurat usually needs a single
+ * uniform draw and no log or sqrt.  Both change the random number streams, so results differ from the default by Monte Carlo noise.
  *
  * \param mean a double representing the mean of the normal distribution
  * \param stdDev a double representing the standard deviation of the normal distribution
- * \param callSiteId an integer specifying what function called the random number generator: was used for synchronized fixed seed and now no longer has a function
- * \param patient a pointer to the Patient; was used for synchronized fixed seed and now no longer has a function
+ * \param callSiteId an integer specifying what function called the random number generator, passed on to getRandomDouble
+ * \param patient a pointer to the Patient whose random number generator is drawn from
  * \return a double randomly selected from the defined distribution
  **/
 inline double CepacUtil::getRandomGaussian(double mean, double stdDev, int callSiteId, Patient *patient) {
+	if (gaussianMethod == GAUSSIAN_ZIGGURAT)
+		return (mean + (getZigguratGaussian(callSiteId, patient) * stdDev));
+	Patient::SpareGaussian *spare = patient->getSpareGaussian();
+	if ((gaussianMethod == GAUSSIAN_POLAR_CACHED) && (spare->callSiteId == callSiteId)) {
+		spare->callSiteId = -1;
+		return (mean + (spare->value * stdDev));
+	}
+
 	// Polar form of Box-Muller transformation
     double x1, x2, w, y1, y2;
 	do {
-		x1 = 2.0 * mtRand() - 1.0;
-		x2 = 2.0 * mtRand() - 1.0;
+		x1 = 2.0 * getRandomDouble(callSiteId, patient) - 1.0;
+		x2 = 2.0 * getRandomDouble(callSiteId, patient) - 1.0;
 		w = x1 * x1 + x2 * x2;
 	} while ( w >= 1.0 );
 	w = sqrt( (-2.0 * log( w ) ) / w );
 	y1 = x1 * w;
 	y2 = x2 * w;
 
+	if (gaussianMethod == GAUSSIAN_POLAR_CACHED) {
+		spare->callSiteId = callSiteId;
+		spare->value = y1;
+	}
 	return (mean + (y2 * stdDev));
 } /* end getRandomGaussian */
 
 /** \brief getRandomDiscrete returns a random integer from a discrete uniform integer distribution containing the number of possible values specified
  * \param min an int for the minimum allowed return value
  * \param numOutcomes an int for the number of possible outcomes
+ * \param callSiteId an integer specifying what function called the random number generator, passed on to getRandomDouble
+ * \param patient a pointer to the Patient whose random number generator is drawn from
  * \return an integer from the specified set of possible outcomes
  * */
-inline int CepacUtil::getRandomDiscrete(int min, int numOutcomes){
-	double randNum = mtRand();
+inline int CepacUtil::getRandomDiscrete(int min, int numOutcomes, int callSiteId, Patient *patient){
+	double randNum = getRandomDouble(callSiteId, patient);
 	int outcome = (int) (randNum * numOutcomes) + min;
 	return outcome;
 } /* end getRandomDiscrete */
@@ -303,7 +303,7 @@ void ClinicVisitUpdater::performOIDetectionUpdates() {
 			incrementNumObservedOIs((SimContext::OI_TYPE) i, 1);
 			if (patient->getGeneralState()->tracingEnabled) {
 				tracer->printTrace(1, "**%d OBSV OI %s;\n",
-					patient->getGeneralState()->monthNum, SimContext::OI_STRS[i]);
+					patient->getGeneralState()->monthNum, simContext->OI_STRS[i]);
 			}
 
 			/** If on ART, determine if observed OI should count towards ART failure */
@@ -638,11 +638,19 @@ void ClinicVisitUpdater::performARTProgramUpdates() {
 		int currRegimen = patient->getARTState()->currRegimenNum;
 		int currSubRegimen = patient->getARTState()->currSubRegimenNum;
 		const SimContext::ARTInputs *artInput = simContext->getARTInputs(currRegimen);
-		const SimContext::PedsARTInputs *pedsART = simContext->getPedsARTInputs(currRegimen);
-		const SimContext::AdolescentARTInputs *ayaART = simContext->getAdolescentARTInputs(currRegimen);
-
 		SimContext::PEDS_AGE_CAT pedsAgeCat = patient->getPedsState()->ageCategoryPediatrics;
-		int ayaAgeCat = getAgeCategoryAdolescent();
+
+		/** The Adolescent and Peds ART inputs are only looked up for those patients, their tabs are not read if the module is disabled */
+		const SimContext::PedsARTInputs *pedsART = NULL;
+		const SimContext::AdolescentARTInputs *ayaART = NULL;
+		int ayaAgeCat = SimContext::NOT_APPL;
+		if (patient->getGeneralState()->isAdolescent) {
+			ayaART = simContext->getAdolescentARTInputs(currRegimen);
+			ayaAgeCat = getAgeCategoryAdolescent();
+		}
+		else if (pedsAgeCat != SimContext::PEDS_AGE_ADULT) {
+			pedsART = simContext->getPedsARTInputs(currRegimen);
+		}
 
 		/** Determine and set the ART response type for this regimen */
 		double responseLogit = patient->getGeneralState()->responseBaselineLogit;
@@ -1649,7 +1657,7 @@ void ClinicVisitUpdater::performProphProgramUpdates() {
 					if (patient->getGeneralState()->tracingEnabled) {
 						tracer->printTrace(1, "**%d STOP %s PROPH %d for OI %s;\n", patient->getGeneralState()->monthNum,
 							SimContext::PROPH_TYPE_STRS[SimContext::PROPH_PRIMARY],
-							prophNum + 1, SimContext::OI_STRS[i]);
+							prophNum + 1, simContext->OI_STRS[i]);
 					}
 				}
 				// Set the next proph that is available for use
@@ -1701,7 +1709,7 @@ void ClinicVisitUpdater::performProphProgramUpdates() {
 				if (patient->getGeneralState()->tracingEnabled) {
 					tracer->printTrace(1, "**%d STOP %s PROPH %d for OI %s;\n", patient->getGeneralState()->monthNum,
 						SimContext::PROPH_TYPE_STRS[prophType],
-						prophNum + 1, SimContext::OI_STRS[i]);
+						prophNum + 1, simContext->OI_STRS[i]);
 				}
 
 				// Set the next proph that is available for use
@@ -1729,7 +1737,7 @@ void ClinicVisitUpdater::performProphProgramUpdates() {
 					if (patient->getGeneralState()->tracingEnabled) {
 						tracer->printTrace(1, "**%d SWITCH %s PROPH TO %d for OI %s;\n", patient->getGeneralState()->monthNum,
 							SimContext::PROPH_TYPE_STRS[prophType],
-							nextProphNum + 1, SimContext::OI_STRS[i]);
+							nextProphNum + 1, simContext->OI_STRS[i]);
 					}
 				}
 			}
@@ -1759,7 +1767,7 @@ void ClinicVisitUpdater::performProphProgramUpdates() {
 				if (patient->getGeneralState()->tracingEnabled) {
 					tracer->printTrace(1, "**%d STOP %s PROPH %d for OI %s;\n", patient->getGeneralState()->monthNum,
 						SimContext::PROPH_TYPE_STRS[prophType],
-						prophNum + 1, SimContext::OI_STRS[i]);
+						prophNum + 1, simContext->OI_STRS[i]);
 				}
 			}
 		}
@@ -1794,7 +1802,7 @@ void ClinicVisitUpdater::performProphProgramUpdates() {
 				if (patient->getGeneralState()->tracingEnabled) {
 					tracer->printTrace(1, "**%d START %s PROPH %d for OI %s;\n", patient->getGeneralState()->monthNum,
 						SimContext::PROPH_TYPE_STRS[patient->getProphState()->currProphType[i]],
-						patient->getProphState()->currProphNum[i] + 1, SimContext::OI_STRS[i]);
+						patient->getProphState()->currProphNum[i] + 1, simContext->OI_STRS[i]);
 				}
 			}
 		}
@@ -0,0 +1,344 @@
+#include "include.h"
+
+/** \brief Constructor takes in the simulation context and the statistics and trace objects the cohort is added to
+ *
+ * \param simContext a pointer to the SimContext for the run
+ * \param runStats a pointer to the RunStats object that will hold the cohort statistics
+ * \param costStats a pointer to the CostStats object that will hold the cohort cost statistics
+ * \param tracer a pointer to the Tracer object for the run, its trace file should already be open
+ * \param numThreads the number of threads the blocks may be simulated on, with one thread the patients are simulated serially
+ **/
+CohortRunner::CohortRunner(SimContext *simContext, RunStats *runStats, CostStats *costStats, Tracer *tracer, int numThreads) {
+	this->simContext = simContext;
+	this->runStats = runStats;
+	this->costStats = costStats;
+	this->tracer = tracer;
+	this->numThreads = max(numThreads, 1);
+	this->maxBlocksAhead = this->numThreads * MAX_BLOCKS_AHEAD_PER_THREAD;
+
+	loadStoppingRules();
+} /* end Constructor */
+
+/** \brief Destructor frees any blocks simulated past the stopping point that were not discarded */
+CohortRunner::~CohortRunner(void) {
+	for (map<int, CohortBlock *>::iterator b = finishedBlocks.begin(); b != finishedBlocks.end(); b++)
+		deleteBlock(b->second);
+	finishedBlocks.clear();
+} /* end Destructor */
+
+/** \brief startCohort prepares the blocks of the cohort, must be called before any blocks are claimed
+ *
+ * With more than one thread the cohort is simulated in blocks, which merge to the same results as a serial run.  With
+ * one thread, where blocks would only add the cost of merging them, and for dynamic transmission, where the
+ * transmission rates for each patient depend on the incidence of the patients simulated before it, the patients are
+ * run one after another as a single block.  When CepacUtil::numShards is set, only the blocks of shard
+ * CepacUtil::shardNum are simulated, on any number of threads, and the statistics start after the patients of the
+ * shards before it.  Sharding needs the size of the cohort to be known before it is simulated, so a string error is
+ * thrown for dynamic transmission and the alternate stopping rule.
+ *
+ * \return true if the stopping rule is already met and there is nothing to simulate
+ **/
+bool CohortRunner::startCohort() {
+	const SimContext::CohortInputs *cohortInputs = simContext->getCohortInputs();
+	bool useDynamicTransm = cohortInputs->showTransmissionOutput && cohortInputs->useDynamicTransm;
+	useSerialRun = useDynamicTransm || ((numThreads == 1) && (CepacUtil::numShards == 0));
+
+	maxCohortSize = getMaxCohortSize();
+	if (useSerialRun)
+		numBlocks = 1;
+	else
+		numBlocks = (maxCohortSize + PATIENT_BLOCK_SIZE - 1) / PATIENT_BLOCK_SIZE;
+	firstBlockNum = 0;
+	if (CepacUtil::numShards > 0) {
+		if (useDynamicTransm || (useAlternateStopping && !useCohortParsing)) {
+			string errorString = "   ERROR - Cannot split a cohort into shards with dynamic transmission or the alternate stopping rule";
+			throw errorString;
+		}
+		/** The shards are whole blocks, so the patients in each block are the same as for the unsharded run; rounding up
+			gives the first shard the first block, which holds all the traced patients */
+		firstBlockNum = (int) (((long long) numBlocks * (CepacUtil::shardNum - 1) + CepacUtil::numShards - 1) / CepacUtil::numShards);
+		numBlocks = (int) (((long long) numBlocks * CepacUtil::shardNum + CepacUtil::numShards - 1) / CepacUtil::numShards);
+		runStats->setPatientNumOffset(min(firstBlockNum * PATIENT_BLOCK_SIZE, maxCohortSize));
+	}
+	nextBlockNum = firstBlockNum;
+	nextBlockToMerge = firstBlockNum;
+	numBlocksInProgress = 0;
+	isMerging = false;
+	stopRun = false;
+	isComplete = false;
+
+	if ((firstBlockNum >= numBlocks) ||
+			isStoppingRuleMet(runStats->getPatientNumOffset() + runStats->getPopulationSummary()->numCohorts, runStats->getPopulationSummary()->numCohortsHIVPositive)) {
+		stopRun = true;
+		isComplete = true;
+	}
+	return isComplete;
+} /* end startCohort */
+
+/** \brief claimBlock reserves the next block of patients for the calling worker to simulate
+ *
+ * \return the index of the block to pass to runBlock, or -1 if no block can be claimed now, either because the
+ * cohort is finished or because too many blocks are already waiting to be merged
+ **/
+int CohortRunner::claimBlock() {
+	lock_guard<mutex> lock(blockMutex);
+	if (stopRun || (nextBlockNum >= numBlocks) || (nextBlockNum >= nextBlockToMerge + maxBlocksAhead))
+		return -1;
+	numBlocksInProgress++;
+	return nextBlockNum++;
+} /* end claimBlock */
+
+/** \brief getNumUnclaimedPatients returns the number of patients in the blocks not claimed yet, used to find the largest remaining run */
+int CohortRunner::getNumUnclaimedPatients() {
+	lock_guard<mutex> lock(blockMutex);
+	if (stopRun || (nextBlockNum >= numBlocks))
+		return 0;
+	if (useSerialRun)
+		return maxCohortSize;
+	return min(maxCohortSize, numBlocks * PATIENT_BLOCK_SIZE) - nextBlockNum * PATIENT_BLOCK_SIZE;
+} /* end getNumUnclaimedPatients */
+
+/** \brief runBlock simulates a claimed block and merges all the finished blocks that are next in patient order
+ *
+ * Each patient is seeded from its patient number, so a block can be simulated on any thread with the same result.
+ * Whichever worker finishes the next block to be merged merges it, along with any later blocks that are already
+ * finished.  With the alternate stopping rule, blocks are simulated speculatively; the block in which the rule
+ * is met is resimulated with only the patients the serial loop would have run, and later blocks are discarded.
+ *
+ * \param blockNum the index of the block returned by claimBlock
+ * \return true if the cohort was completed by this call, which happens exactly once; the statistics may then be finalized
+ **/
+bool CohortRunner::runBlock(int blockNum) {
+	CohortBlock *block = NULL;
+	if (useSerialRun) {
+		runSerial();
+	}
+	else {
+		block = createBlock(blockNum, getBlockSize(blockNum));
+		simulateBlock(block);
+	}
+
+	unique_lock<mutex> lock(blockMutex);
+	numBlocksInProgress--;
+	if (useSerialRun)
+		stopRun = true;
+	else if (stopRun)
+		deleteBlock(block);
+	else
+		finishedBlocks[blockNum] = block;
+
+	/** Merge the finished blocks in patient order until the stopping rule is met, one worker at a time */
+	while (!isMerging && !stopRun && (finishedBlocks.find(nextBlockToMerge) != finishedBlocks.end())) {
+		CohortBlock *nextBlock = finishedBlocks[nextBlockToMerge];
+		finishedBlocks.erase(nextBlockToMerge);
+		isMerging = true;
+		lock.unlock();
+		bool isLastBlock = mergeNextBlock(nextBlock);
+		lock.lock();
+		isMerging = false;
+		nextBlockToMerge++;
+		if (isLastBlock)
+			stopRun = true;
+	}
+
+	/** The cohort is complete once the stopping rule is met and no worker is still simulating or merging a block */
+	if (stopRun && !isMerging && (numBlocksInProgress == 0) && !isComplete) {
+		for (map<int, CohortBlock *>::iterator b = finishedBlocks.begin(); b != finishedBlocks.end(); b++)
+			deleteBlock(b->second);
+		finishedBlocks.clear();
+		isComplete = true;
+		return true;
+	}
+	return false;
+} /* end runBlock */
+
+/** \brief loadStoppingRules loads the number of cohorts and settings for stopping the simulation */
+void CohortRunner::loadStoppingRules() {
+	numCohortsLimit = simContext->getRunSpecsInputs()->numCohorts;
+
+	useAlternateStopping = false;
+	totalHIVPositiveLimit = 0;
+	totalCohortsLimit = 0;
+
+	if (simContext->getHIVTestInputs()->enableHIVTesting){
+		useAlternateStopping = simContext->getHIVTestInputs()->useAlternateStoppingRule;
+		totalHIVPositiveLimit = simContext->getHIVTestInputs()->totalCohortsWithHIVPositiveLimit;
+		totalCohortsLimit = simContext->getHIVTestInputs()->totalCohortsLimit;
+	}
+	else if (simContext->isEIDTestingEnabled()){
+		useAlternateStopping = simContext->getEIDInputs()->useAlternateStoppingRuleEID;
+		totalHIVPositiveLimit = simContext->getEIDInputs()->totalCohortsWithHIVPositiveLimitEID;
+		totalCohortsLimit = simContext->getEIDInputs()->totalCohortsLimitEID;
+	}
+
+	useCohortParsing = simContext->getOutputInputs()->enableSubCohorts;
+	//determine max subcohort size
+	runsizeSubcohorts = 0;
+	if (useCohortParsing){
+		for(int i =0; i < SimContext::MAX_NUM_SUBCOHORTS; i++){
+			int nextCohortSize = simContext->getOutputInputs()->subCohorts[i];
+			if (nextCohortSize > runsizeSubcohorts)
+				runsizeSubcohorts = nextCohortSize;
+			else
+				break;
+		}
+	}
+} /* end loadStoppingRules */
+
+/** \brief isStoppingRuleMet returns true if no more patients should be simulated
+ *
+ * \param numCohorts the number of patients simulated so far
+ * \param numCohortsHIVPositive the number of those patients that were ever HIV positive
+ **/
+bool CohortRunner::isStoppingRuleMet(int numCohorts, int numCohortsHIVPositive) {
+	if (useCohortParsing)
+		return (numCohorts >= runsizeSubcohorts);
+	if (!useAlternateStopping)
+		return (numCohorts >= numCohortsLimit);
+	return ((numCohortsHIVPositive >= totalHIVPositiveLimit) || (numCohorts >= totalCohortsLimit));
+} /* end isStoppingRuleMet */
+
+/** \brief getMaxCohortSize returns the largest number of patients the stopping rule allows to be simulated */
+int CohortRunner::getMaxCohortSize() {
+	if (useCohortParsing)
+		return runsizeSubcohorts;
+	if (!useAlternateStopping)
+		return numCohortsLimit;
+	return totalCohortsLimit;
+} /* end getMaxCohortSize */
+
+/** \brief runSerial simulates the patients one after another on the calling thread, adding them directly to the
+ * statistics of the run, used with one thread and for dynamic transmission */
+void CohortRunner::runSerial() {
+	/** Loop over the patient simulations for this context */
+	int numRun = 0;
+
+	while (true) {
+		if (isStoppingRuleMet(runStats->getPopulationSummary()->numCohorts, runStats->getPopulationSummary()->numCohortsHIVPositive))
+			break;
+
+		/** If using dynamic transmission, the warmup run will be used to calculate monthly transmission rate multipliers from the monthly incidence. After the warmup period all other outputs will be discarded and the run will restart anew.*/
+		if (simContext->getCohortInputs()->showTransmissionOutput && simContext->getCohortInputs()->useDynamicTransm &&
+				numRun == simContext->getCohortInputs()->dynamicTransmWarmupSize){
+			// reinitializing the outputs after the warmup run, but keeping the dynamic transmission incidence outputs to use in calculating monthly transmission rates and multipliers for the rest of the run
+			// since stopping the main run is based on runStats this restarts the run; the first 50 patients will be traced again and show up twice in the trace file
+			runStats->initRunStats(true);
+
+			simContext->disableDynamicTransmInc();
+
+			simContext->enablePrEP(simContext->getCohortInputs()->keepPrEPAfterWarmup);
+		}
+
+		/** Create a new patient with the given simulation context*/
+		Patient *patient = new Patient(simContext, runStats, costStats, tracer);
+
+		/** Loop over the lifetime of the patient and simulate months */
+		while (patient->isAlive()) {
+			patient->simulateMonth();
+		}
+
+		delete patient;
+		numRun++;
+	}
+} /* end runSerial */
+
+/** \brief mergeNextBlock merges a finished block into the run, truncating it if the stopping rule is met partway through
+ *
+ * \param block the CohortBlock to merge, must be the next block in patient order; it is deleted
+ * \return true if no more blocks should be merged after this one
+ **/
+bool CohortRunner::mergeNextBlock(CohortBlock *block) {
+	/** Find the patient after which the serial loop would have stopped, if it is in this block */
+	int numCohortsBefore = runStats->getPatientNumOffset() + runStats->getPopulationSummary()->numCohorts;
+	int numHIVPositiveBefore = runStats->getPopulationSummary()->numCohortsHIVPositive;
+	int numPatientsToKeep = block->numPatients;
+	bool isLastBlock = (block->blockNum == numBlocks - 1);
+	for (int i = 0; i < block->numPatients; i++) {
+		if (isStoppingRuleMet(numCohortsBefore + i + 1, numHIVPositiveBefore + block->numHIVPositiveAfterPatient[i])) {
+			numPatientsToKeep = i + 1;
+			isLastBlock = true;
+			break;
+		}
+	}
+	if (numPatientsToKeep < block->numPatients) {
+		int blockNum = block->blockNum;
+		deleteBlock(block);
+		block = createBlock(blockNum, numPatientsToKeep);
+		simulateBlock(block);
+	}
+
+	mergeBlock(block);
+	deleteBlock(block);
+	return isLastBlock;
+} /* end mergeNextBlock */
+
+/** \brief getBlockSize returns the number of patients in a full block, which is less than PATIENT_BLOCK_SIZE only for the last block
+ *
+ * \param blockNum the index of the block in the cohort
+ **/
+int CohortRunner::getBlockSize(int blockNum) {
+	return min(PATIENT_BLOCK_SIZE, maxCohortSize - blockNum * PATIENT_BLOCK_SIZE);
+} /* end getBlockSize */
+
+/** \brief createBlock allocates a block of patients and its statistics objects
+ *
+ * \param blockNum the index of the block in the cohort
+ * \param numPatients the number of patients to simulate in the block
+ **/
+CohortRunner::CohortBlock *CohortRunner::createBlock(int blockNum, int numPatients) {
+	string runName = simContext->getRunSpecsInputs()->runName;
+	int firstPatientNum = blockNum * PATIENT_BLOCK_SIZE + 1;
+
+	CohortBlock *block = new CohortBlock();
+	block->blockNum = blockNum;
+	block->numPatients = numPatients;
+	block->runStats = new RunStats(runName, simContext);
+	block->runStats->setPatientNumOffset(firstPatientNum - 1);
+	block->costStats = new CostStats(runName, simContext);
+	block->tracer = new Tracer(runName, simContext, 1);
+	/** Only blocks that contain traced patients need a trace buffer */
+	if (firstPatientNum <= simContext->numPatientsToTrace)
+		block->tracer->openTraceBuffer();
+	return block;
+} /* end createBlock */
+
+/** \brief simulateBlock simulates all the patients of a block into its own statistics objects
+ *
+ * \param block the CohortBlock to simulate
+ **/
+void CohortRunner::simulateBlock(CohortBlock *block) {
+	for (int i = 0; i < block->numPatients; i++) {
+		/** Create a new patient with the given simulation context*/
+		Patient *patient = new Patient(simContext, block->runStats, block->costStats, block->tracer);
+
+		/** Loop over the lifetime of the patient and simulate months */
+		while (patient->isAlive()) {
+			patient->simulateMonth();
+		}
+
+		delete patient;
+		block->numHIVPositiveAfterPatient.push_back(block->runStats->getPopulationSummary()->numCohortsHIVPositive);
+	}
+} /* end simulateBlock */
+
+/** \brief mergeBlock adds the statistics and trace of a finished block to those of the run
+ *
+ * \param block the CohortBlock to merge, must be the next block in patient order
+ **/
+void CohortRunner::mergeBlock(CohortBlock *block) {
+	runStats->merge(*block->runStats);
+	costStats->merge(*block->costStats);
+	tracer->appendTraceBuffer(block->tracer);
+} /* end mergeBlock */
+
+/** \brief deleteBlock closes the trace buffer of a block and frees it and its statistics objects
+ *
+ * \param block the CohortBlock to delete
+ **/
+void CohortRunner::deleteBlock(CohortBlock *block) {
+	block->tracer->closeTraceFile();
+	delete block->tracer;
+	delete block->runStats;
+	delete block->costStats;
+	delete block;
+} /* end deleteBlock */
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "include.h"
+
+/**
+	CohortRunner simulates the cohort of patients for a single simulation context until its stopping
+	rule is met, adding their outcomes to the RunStats, CostStats, and Tracer for that context.
+	With more than one thread the cohort is split into fixed size blocks of consecutive patients; each block is
+	simulated into its own RunStats, CostStats, and buffered Tracer, possibly on a worker thread, and the blocks are
+	merged back in patient order.  The totals are FixedPointSums, which add exactly in any grouping, so the results do
+	not depend on the number of threads used.  With one thread the patients are added to the statistics of the run one
+	after another, which gives the same results without the cost of merging blocks; a shard of a cohort is always
+	simulated in blocks.  CohortRunner has no threads of its own: the workers of
+	the RunScheduler claim blocks with claimBlock and simulate them with runBlock, which may be called concurrently.
+*/
+class CohortRunner
+{
+public:
+	/* Constructor and Destructor */
+	CohortRunner(SimContext *simContext, RunStats *runStats, CostStats *costStats, Tracer *tracer, int numThreads);
+	~CohortRunner(void);
+
+	/* Functions for the workers to simulate the cohort block by block */
+	bool startCohort();
+	int claimBlock();
+	int getNumUnclaimedPatients();
+	bool runBlock(int blockNum);
+
+	/** Number of consecutive patients simulated as one unit of parallel work, must not depend on the number of threads */
+	static const int PATIENT_BLOCK_SIZE = 500;
+	/** Maximum number of blocks that may be finished ahead of the next block to be merged, per thread */
+	static const int MAX_BLOCKS_AHEAD_PER_THREAD = 4;
+
+private:
+	/** CohortBlock holds the statistics for a block of consecutive patients simulated on one thread */
+	class CohortBlock {
+	public:
+		/** Index of the block in the cohort */
+		int blockNum;
+		/** Number of patients simulated in this block */
+		int numPatients;
+		/** Statistics and trace for the patients in this block */
+		RunStats *runStats;
+		CostStats *costStats;
+		Tracer *tracer;
+		/** Cumulative number of HIV positive patients in the block after each patient, used for the alternate stopping rule */
+		vector<int> numHIVPositiveAfterPatient;
+	};
+
+	/** The simulation context and the statistics and trace objects the cohort is added to */
+	SimContext *simContext;
+	RunStats *runStats;
+	CostStats *costStats;
+	Tracer *tracer;
+
+	/** Stopping rule settings loaded from the simulation context */
+	int numCohortsLimit;
+	bool useAlternateStopping;
+	int totalHIVPositiveLimit;
+	int totalCohortsLimit;
+	bool useCohortParsing;
+	int runsizeSubcohorts;
+	/** Number of threads the blocks may be simulated on */
+	int numThreads;
+	/** True for one thread without shards, or dynamic transmission, where the whole cohort is a single block simulated by runSerial */
+	bool useSerialRun;
+
+	/** State shared by the workers simulating this cohort, guarded by blockMutex */
+	mutex blockMutex;
+	/** The blocks from firstBlockNum up to numBlocks are simulated, fewer than all of them when only a shard of the cohort is run */
+	int firstBlockNum;
+	int numBlocks;
+	int maxCohortSize;
+	int nextBlockNum;
+	int nextBlockToMerge;
+	int maxBlocksAhead;
+	int numBlocksInProgress;
+	bool isMerging;
+	bool stopRun;
+	bool isComplete;
+	map<int, CohortBlock *> finishedBlocks;
+
+	/* Functions for the stopping rules */
+	void loadStoppingRules();
+	bool isStoppingRuleMet(int numCohorts, int numCohortsHIVPositive);
+	int getMaxCohortSize();
+
+	/* Functions to simulate the cohort serially or as blocks of patients */
+	void runSerial();
+	bool mergeNextBlock(CohortBlock *block);
+	int getBlockSize(int blockNum);
+	CohortBlock *createBlock(int blockNum, int numPatients);
+	void simulateBlock(CohortBlock *block);
+	void mergeBlock(CohortBlock *block);
+	void deleteBlock(CohortBlock *block);
+};
@@ -24,10 +24,83 @@
 /** \brief Main function for a console based application */
 int main(int argc, char *argv[]) {
 
+	/** Parse the command line options, the first other argument is the inputs directory */
+	int numThreads = 1;
+	int maxOpenRuns = 0;
+	const char *inputsDirectoryArg = NULL;
+	const char *psaFileArg = NULL;
+	bool isValidateOnly = false;
+	for (int i = 1; i < argc; i++) {
+		if ((strcmp(argv[i], "--threads") == 0) && (i + 1 < argc)) {
+			numThreads = atoi(argv[++i]);
+			if (numThreads < 1)
+				numThreads = 1;
+		}
+		else if ((strcmp(argv[i], "--files") == 0) && (i + 1 < argc)) {
+			maxOpenRuns = atoi(argv[++i]);
+			if (maxOpenRuns < 1)
+				maxOpenRuns = 1;
+		}
+		else if (strcmp(argv[i], "--counter-rng") == 0) {
+			CepacUtil::useCounterRandom = true;
+		}
+		else if (strcmp(argv[i], "--crn") == 0) {
+			CepacUtil::useCounterRandom = true;
+			CepacUtil::useCommonRandomNumbers = true;
+		}
+		else if ((strcmp(argv[i], "--psa") == 0) && (i + 1 < argc)) {
+			psaFileArg = argv[++i];
+		}
+		else if (strcmp(argv[i], "--input-cache") == 0)
+			CepacUtil::useInputCache = true;
+		else if (strcmp(argv[i], "--read-all-tabs") == 0)
+			CepacUtil::skipDisabledInputTabs = false;
+		else if (strcmp(argv[i], "--validate") == 0)
+			isValidateOnly = true;
+		else if (strcmp(argv[i], "--no-validate") == 0)
+			CepacUtil::validateInputs = false;
+		else if ((strcmp(argv[i], "--result-cache") == 0) && (i + 1 < argc))
+			CepacUtil::resultCacheDirectory = argv[++i];
+		else if (strcmp(argv[i], "--check-prob-cache") == 0)
+			CepacUtil::checkProbRateCache = true;
+		else if ((strcmp(argv[i], "--input-threads") == 0) && (i + 1 < argc)) {
+			CepacUtil::numInputThreads = atoi(argv[++i]);
+			if (CepacUtil::numInputThreads < 1)
+				CepacUtil::numInputThreads = 1;
+		}
+		else if ((strcmp(argv[i], "--gaussian") == 0) && (i + 1 < argc)) {
+			i++;
+			if (strcmp(argv[i], "polar") == 0)
+				CepacUtil::gaussianMethod = CepacUtil::GAUSSIAN_POLAR;
+			else if (strcmp(argv[i], "cached") == 0)
+				CepacUtil::gaussianMethod = CepacUtil::GAUSSIAN_POLAR_CACHED;
+			else if (strcmp(argv[i], "ziggurat") == 0)
+				CepacUtil::gaussianMethod = CepacUtil::GAUSSIAN_ZIGGURAT;
+			else {
+				printf("   ERROR - --gaussian must be polar, cached or ziggurat\n");
+				return 1;
+			}
+		}
+		else if ((strcmp(argv[i], "--shard") == 0) && (i + 1 < argc)) {
+			if ((sscanf(argv[++i], "%d/%d", &CepacUtil::shardNum, &CepacUtil::numShards) != 2) ||
+					(CepacUtil::numShards < 1) || (CepacUtil::shardNum < 1) || (CepacUtil::shardNum > CepacUtil::numShards)) {
+				printf("   ERROR - --shard must be given as i/N with i from 1 to N\n");
+				return 1;
+			}
+		}
+		else if (inputsDirectoryArg == NULL) {
+			inputsDirectoryArg = argv[i];
+		}
+	}
+	if ((psaFileArg != NULL) && (CepacUtil::numShards > 0)) {
+		printf("   ERROR - --psa cannot be combined with --shard\n");
+		return 1;
+	}
+
 	/** Console application uses the directory given on the command line or the
 		current directory if none is given (like the old model) */
-	if (argc > 1) {
-		CepacUtil::inputsDirectory = argv[1];
+	if (inputsDirectoryArg != NULL) {
+		CepacUtil::inputsDirectory = inputsDirectoryArg;
 		CepacUtil::changeDirectoryToInputs();
 	}
 	else {
@@ -38,174 +111,90 @@ int main(int argc, char *argv[]) {
 			CepacUtil::changeDirectoryToInputs();
 		#endif
 	}
+	if (!CepacUtil::resultCacheDirectory.empty())
+		CepacUtil::createResultCacheDirectory();
+
+	/** With --validate, only read and check the inputs of the input files or of the PSA draws, without simulating them */
+	if (isValidateOnly) {
+		bool areAllValid = false;
+		PSADriver *psaDriver = NULL;
+		try {
+			if (psaFileArg != NULL) {
+				psaDriver = new PSADriver(psaFileArg);
+				psaDriver->readPSAFile();
+			}
+			else {
+				CepacUtil::findInputFiles();
+			}
+			areAllValid = InputValidator::validateInputFiles(psaDriver);
+		}
+		catch (string &errorString) {
+			printf("%s\n", errorString.c_str());
+		}
+		delete psaDriver;
+		SimContext::deleteOverlayBases();
+		return areAllValid ? 0 : 1;
+	}
 
 	/** Create the results directory and the summaries stats object */
 	CepacUtil::createResultsDirectory();
 	string summariesFileName = CepacUtil::FILE_NAME_SUMMARIES;
 	SummaryStats *summaryStats = new SummaryStats(summariesFileName);
 
-	/** Determine and loop over the list of input files in the working directory */
-	CepacUtil::findInputFiles();
-	for (vector<string>::iterator inputFileIter = CepacUtil::filesToRun.begin();
-		inputFileIter != CepacUtil::filesToRun.end(); inputFileIter++) {
-
-		/** Display the file name being run */
-		printf("Running File: %s\n", (*inputFileIter).c_str());
-
-		/** Get the input file name and strip off the extension to get the run name */
-		string inputFileName = *inputFileIter;
-		string runName = inputFileName.substr(0, inputFileName.find(CepacUtil::FILE_EXTENSION_FOR_INPUT));
-
-		/** Create the simulation context and read in the input file */
-		SimContext *simContext = new SimContext(runName);
+	/** By default as many input files may be open as there are threads */
+	if (maxOpenRuns == 0)
+		maxOpenRuns = numThreads;
 
+	/** For a PSA, run the draws of the .psa file instead of the input files and write their results table */
+	if (psaFileArg != NULL) {
+		int exitCode = 0;
+		PSADriver *psaDriver = new PSADriver(psaFileArg);
 		try {
-			simContext->readInputs();
+			psaDriver->readPSAFile();
+			RunScheduler *runScheduler = new RunScheduler(summaryStats, numThreads, maxOpenRuns, psaDriver);
+			runScheduler->runFiles();
+			if (runScheduler->getNumInvalidRuns() > 0)
+				exitCode = 1;
+			delete runScheduler;
+			psaDriver->writeResultsFile();
 		}
 		catch (string &errorString) {
 			printf("%s\n", errorString.c_str());
-			continue;
-		}
-
-		/** Initializes the random number generator with either a random or fixed seed */
-		CepacUtil::setRandomSeedType(simContext->getRunSpecsInputs()->randomSeedByTime);
-
-		/** Create a new run statistics object for this simulation context */
-		RunStats *runStats = new RunStats(runName, simContext);
-		CostStats *costStats = new CostStats(runName, simContext);
-
-		/** Create a tracing object for this simulation context and print out the trace file header */
-		Tracer *tracer = new Tracer(runName, simContext, 1);
-		tracer->openTraceFile();
-		tracer->printTraceHeader();
-
-		/** Load the number of cohorts and settings for stopping simulation */
-		int numCohortsLimit = simContext->getRunSpecsInputs()->numCohorts;
-
-		bool useAlternateStopping = false;
-		int totalHIVPositiveLimit = 0;
-		int totalCohortsLimit = 0;
-
-		if (simContext->getHIVTestInputs()->enableHIVTesting){
-			useAlternateStopping = simContext->getHIVTestInputs()->useAlternateStoppingRule;
-			totalHIVPositiveLimit = simContext->getHIVTestInputs()->totalCohortsWithHIVPositiveLimit;
-			totalCohortsLimit = simContext->getHIVTestInputs()->totalCohortsLimit;
-		}
-		else if (simContext->getEIDInputs()->enableHIVTestingEID){
-			useAlternateStopping = simContext->getEIDInputs()->useAlternateStoppingRuleEID;
-			totalHIVPositiveLimit = simContext->getEIDInputs()->totalCohortsWithHIVPositiveLimitEID;
-			totalCohortsLimit = simContext->getEIDInputs()->totalCohortsLimitEID;
-		}
-
-
-		bool useCohortParsing = simContext->getOutputInputs()->enableSubCohorts;
-		//determine max subcohort size
-		int runsizeSubcohorts = 0;
-		if (useCohortParsing){
-			for(int i =0; i < SimContext::MAX_NUM_SUBCOHORTS; i++){
-				int nextCohortSize = simContext->getOutputInputs()->subCohorts[i];
-				if (nextCohortSize > runsizeSubcohorts)
-					runsizeSubcohorts = nextCohortSize;
-				else
-					break;
-			}
-		}
-
-		/** Loop over the patient simulations for this context */
-		int numRun = 0;
-
-		while (true) {
-			if (useCohortParsing){
-				if (runStats->getPopulationSummary()->numCohorts >= runsizeSubcohorts)
-					break;
-			}
-			else{
-				if (!useAlternateStopping) {
-					if (runStats->getPopulationSummary()->numCohorts >= numCohortsLimit)
-						break;
-				}
-				else {
-					if ((runStats->getPopulationSummary()->numCohortsHIVPositive >= totalHIVPositiveLimit)||(runStats->getPopulationSummary()->numCohorts >= totalCohortsLimit))
-						break;
-				}
-			}
-
-			/** If using dynamic transmission, the warmup run will be used to calculate monthly transmission rate multipliers from the monthly incidence. After the warmup period all other outputs will be discarded and the run will restart anew.*/
-			if (simContext->getCohortInputs()->showTransmissionOutput && simContext->getCohortInputs()->useDynamicTransm &&
-					numRun == simContext->getCohortInputs()->dynamicTransmWarmupSize){
-				// reinitializing the outputs after the warmup run, but keeping the dynamic transmission incidence outputs to use in calculating monthly transmission rates and multipliers for the rest of the run  
-				// since stopping the main run is based on runStats this restarts the run; the first 50 patients will be traced again and show up twice in the trace file
-				runStats->initRunStats(true);
-
-				simContext->disableDynamicTransmInc();
-				
-				simContext->enablePrEP(simContext->getCohortInputs()->keepPrEPAfterWarmup);
-			}
-
-			/** Create a new patient with the given simulation context*/
-			Patient *patient = new Patient(simContext, runStats, costStats, tracer);
-
-
-			/** Loop over the lifetime of the patient and simulate months */
-			while (patient->isAlive()) {
-				patient->simulateMonth();
-			}
-
-			delete patient;
-			numRun++;
+			exitCode = 1;
 		}
+		delete psaDriver;
+		delete summaryStats;
+		SimContext::deleteOverlayBases();
+		return exitCode;
+	}
 
-		/** Write out the stats file for this simulation context and add to the summary stats */
-		runStats->finalizeStats();
+	/** Determine the list of input files in the working directory and run them */
+	CepacUtil::findInputFiles();
+	RunScheduler *runScheduler = new RunScheduler(summaryStats, numThreads, maxOpenRuns);
+	runScheduler->runFiles();
+	int numInvalidRuns = runScheduler->getNumInvalidRuns();
+	delete runScheduler;
+	SimContext::deleteOverlayBases();
+
+	/** Finalize the summary stats and print to the popstats file, which cepac-merge writes instead
+		for a sharded run, destroy the summary stats object */
+	if (CepacUtil::numShards == 0) {
+		summaryStats->finalizeStats();
 		try {
-			runStats->writeStatsFile();
+			summaryStats->writeSummariesFile();
 		}
 		catch (string &errorString) {
 			printf("%s\n", errorString.c_str());
 		}
-
-		if (simContext->getOutputInputs()->enableDetailedCostOutputs){
-			costStats->finalizeStats();
-			/** Write out the cost stats file for this simulation context*/
-			try {
-				costStats->writeStatsFile();
-			}
-			catch (string &errorString) {
-				printf("%s\n", errorString.c_str());
-			}
-		}
-
-		/** Add the individual run stats to the summary stats object */
-		summaryStats->addRunStats(runStats);
-
-		/** Display the summary stats for this run in the results window */
-		printf("%s\t cost $%0.0f \t LMs %0.2f \t QALMs %0.2f \n",
-			runStats->getPopulationSummary()->runName.c_str(),
-			runStats->getPopulationSummary()->costsAverage,
-			runStats->getPopulationSummary()->LMsAverage,
-			runStats->getPopulationSummary()->QALMsAverage);
-
-		/** Close the trace file and destroy the tracer object */
-		tracer->closeTraceFile();
-		delete tracer;
-
-		/** Destroy the runStats and simContext objects */
-		delete runStats;
-		delete costStats;
-		delete simContext;
-	}
-
-	/** Finalize the summary stats and print to the popstats file,
-		destroy the summary stats object */
-	summaryStats->finalizeStats();
-	try {
-		summaryStats->writeSummariesFile();
-	}
-	catch (string &errorString) {
-		printf("%s\n", errorString.c_str());
 	}
 	delete summaryStats;
 
+	/** Fail if any input file was not run, so that a sweep job does not take the missing runs for results */
+	if (numInvalidRuns > 0) {
+		printf("   ERROR - %d input file%s not run since %s inputs are not valid\n", numInvalidRuns,
+			(numInvalidRuns == 1) ? " was" : "s were", (numInvalidRuns == 1) ? "its" : "their");
+		return 1;
+	}
 	return 0;
 } /* end main */
 
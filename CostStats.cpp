@@ -4,10 +4,13 @@
  *
  * \param runName a string representing the run name associated with this costStats object
  * \param simContext a pointer to the SimContext representing the inputs associated with this CostSTats object*/
-CostStats::CostStats(string runName, SimContext *simContext) {
+CostStats::CostStats(string runName, SimContext *simContext) :
+	/** Value initializing the subclasses zeroes the padding between fields, as for RunStats */
+	popSummary(), allStats(), eventStats() {
 	costStatsFileName = runName;
 	costStatsFileName.append(CepacUtil::FILE_EXTENSION_FOR_COSTS_OUTPUT);
 	this->simContext = simContext;
+	isFinalized = false;
 
 	/** Initialize the statistics subclasses */
 	initCostPopulationSummary();
@@ -27,6 +30,7 @@ CostStats::~CostStats(void) {
  * - CostStats::finalizeCostPopulationSummary();
 */
 void CostStats::finalizeStats() {
+	isFinalized = true;
 	finalizeCostPopulationSummary();
 	finalizeAllStats();
 	finalizeEventStats();
@@ -139,6 +143,136 @@ void CostStats::initEventStats() {
 	}
 }
 
+/** \brief merge adds the statistics accumulated by another CostStats object into this one
+ *
+ * Used to combine CostStats shards that were each filled by a disjoint set of patients, must be called before finalizeStats().
+ * All the statistics are counts or FixedPointSum totals, so the result does not depend on the order of the merges.
+ * Throws a string error if either object has been finalized.
+ *
+ * \param other a CostStats object for the same SimContext that has not yet been finalized
+ **/
+void CostStats::merge(const CostStats &other) {
+	if (isFinalized || other.isFinalized) {
+		string errorString = "   ERROR - Cannot merge cost statistics that have already been finalized";
+		throw errorString;
+	}
+
+	mergeCostPopulationSummary(other);
+	mergeAllStats(other);
+	mergeEventStats(other);
+} /* end merge */
+
+/** \brief mergeCostPopulationSummary adds the CostPopulationSummary totals of another CostStats object to this one */
+void CostStats::mergeCostPopulationSummary(const CostStats &other) {
+	popSummary.numPatients += other.popSummary.numPatients;
+	popSummary.numPatientsHIVPositive += other.popSummary.numPatientsHIVPositive;
+	popSummary.numDetected += other.popSummary.numDetected;
+	popSummary.numInCare += other.popSummary.numInCare;
+	for (int i = 0; i < SimContext::ART_NUM_LINES; i++){
+		popSummary.numEverOnART[i] += other.popSummary.numEverOnART[i];
+	}
+	for (int i = 0; i < SimContext::CD4_NUM_STRATA; i++){
+		popSummary.observedCD4DistributionAtLinkage[i] += other.popSummary.observedCD4DistributionAtLinkage[i];
+		popSummary.observedCD4DistributionAtARTStart[i] += other.popSummary.observedCD4DistributionAtARTStart[i];
+	}
+	for (int i = 0; i < SimContext::GENDER_NUM; i++){
+		popSummary.genderDistributionAtLinkage[i] += other.popSummary.genderDistributionAtLinkage[i];
+		popSummary.genderDistributionAtARTStart[i] += other.popSummary.genderDistributionAtARTStart[i];
+	}
+	for (int i = 0; i < SimContext::LINKAGE_STATS_AGE_CAT_NUM; i++){
+		popSummary.ageDistributionAtLinkage[i] += other.popSummary.ageDistributionAtLinkage[i];
+		popSummary.ageDistributionAtARTStart[i] += other.popSummary.ageDistributionAtARTStart[i];
+	}
+}
+
+/** \brief mergeAllStats adds the AllStats totals of another CostStats object to this one */
+void CostStats::mergeAllStats(const CostStats &other) {
+	for (int i = 0; i < SimContext::COST_REPORT_DISCOUNT_NUM; i++){
+		for (int j = 0; j < SimContext::COST_CD4_STRATA_NUM; j++){
+			for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++){
+				allStats[i][j][k].LMs += other.allStats[i][j][k].LMs;
+				allStats[i][j][k].costs += other.allStats[i][j][k].costs;
+				allStats[i][j][k].costsART += other.allStats[i][j][k].costsART;
+				allStats[i][j][k].costsOIProph += other.allStats[i][j][k].costsOIProph;
+				allStats[i][j][k].costsTBProph += other.allStats[i][j][k].costsTBProph;
+				allStats[i][j][k].costsCD4Testing += other.allStats[i][j][k].costsCD4Testing;
+				allStats[i][j][k].costsHVLTesting += other.allStats[i][j][k].costsHVLTesting;
+				allStats[i][j][k].costsInterventionStartup += other.allStats[i][j][k].costsInterventionStartup;
+				allStats[i][j][k].costsInterventionMonthly += other.allStats[i][j][k].costsInterventionMonthly;
+				allStats[i][j][k].costsClinicVisit += other.allStats[i][j][k].costsClinicVisit;
+				allStats[i][j][k].costsRoutineCare += other.allStats[i][j][k].costsRoutineCare;
+				allStats[i][j][k].costsGeneralMedicine += other.allStats[i][j][k].costsGeneralMedicine;
+				allStats[i][j][k].costsOITreatment += other.allStats[i][j][k].costsOITreatment;
+				allStats[i][j][k].costsOIUntreated += other.allStats[i][j][k].costsOIUntreated;
+				allStats[i][j][k].costsToxicity += other.allStats[i][j][k].costsToxicity;
+				allStats[i][j][k].costsDeath += other.allStats[i][j][k].costsDeath;
+				allStats[i][j][k].costsHIVScreeningTests += other.allStats[i][j][k].costsHIVScreeningTests;
+				allStats[i][j][k].costsHIVScreeningMisc += other.allStats[i][j][k].costsHIVScreeningMisc;
+				allStats[i][j][k].costsLabStagingTests += other.allStats[i][j][k].costsLabStagingTests;
+				allStats[i][j][k].costsLabStagingMisc += other.allStats[i][j][k].costsLabStagingMisc;
+				allStats[i][j][k].costsTBTreatment += other.allStats[i][j][k].costsTBTreatment;
+				for (int l = 0; l < SimContext::COST_NUM_TYPES; l++){
+					allStats[i][j][k].costsCD4TestingCategory[l] += other.allStats[i][j][k].costsCD4TestingCategory[l];
+					allStats[i][j][k].costsHVLTestingCategory[l] += other.allStats[i][j][k].costsHVLTestingCategory[l];
+					allStats[i][j][k].costsClinicVisitCategory[l] += other.allStats[i][j][k].costsClinicVisitCategory[l];
+					allStats[i][j][k].costsRoutineCareCategory[l] += other.allStats[i][j][k].costsRoutineCareCategory[l];
+					allStats[i][j][k].costsGeneralMedicineCategory[l] += other.allStats[i][j][k].costsGeneralMedicineCategory[l];
+					allStats[i][j][k].costsOITreatmentCategory[l] += other.allStats[i][j][k].costsOITreatmentCategory[l];
+					allStats[i][j][k].costsOIUntreatedCategory[l] += other.allStats[i][j][k].costsOIUntreatedCategory[l];
+					allStats[i][j][k].costsDeathCategory[l] += other.allStats[i][j][k].costsDeathCategory[l];
+				}
+			}
+		}
+	}
+}
+
+/** \brief mergeEventStats adds the EventStats totals of another CostStats object to this one */
+void CostStats::mergeEventStats(const CostStats &other) {
+	for (int j = 0; j < SimContext::COST_CD4_STRATA_NUM; j++){
+		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++){
+			eventStats[j][k].numToxicityCases += other.eventStats[j][k].numToxicityCases;
+			eventStats[j][k].numTBInfections += other.eventStats[j][k].numTBInfections;
+			eventStats[j][k].numOIEvents += other.eventStats[j][k].numOIEvents;
+			eventStats[j][k].numDeaths += other.eventStats[j][k].numDeaths;
+			eventStats[j][k].numCD4Tests += other.eventStats[j][k].numCD4Tests;
+			eventStats[j][k].numHVLTests += other.eventStats[j][k].numHVLTests;
+			eventStats[j][k].numClinicVisits += other.eventStats[j][k].numClinicVisits;
+			eventStats[j][k].numHIVTests += other.eventStats[j][k].numHIVTests;
+			eventStats[j][k].numLabStagingTests += other.eventStats[j][k].numLabStagingTests;
+		}
+	}
+}
+
+/** \brief writePartialStats writes the totals of a CostStats object that has not been finalized to a partial statistics file
+ *
+ * \param file a pointer to the partial statistics FILE, opened for binary writing
+ **/
+void CostStats::writePartialStats(FILE *file) {
+	int layoutSize = sizeof(CostPopulationSummary) + sizeof(allStats) + sizeof(eventStats);
+	CepacUtil::writeBinary(file, layoutSize);
+	CepacUtil::writeBinary(file, popSummary);
+	CepacUtil::writeBinary(file, allStats);
+	CepacUtil::writeBinary(file, eventStats);
+} /* end writePartialStats */
+
+/** \brief readPartialStats reads the totals written by writePartialStats into a newly constructed CostStats object
+ *
+ * Throws a string error if the file ends early or was written by a build with different statistics
+ *
+ * \param file a pointer to the partial statistics FILE, opened for binary reading
+ **/
+void CostStats::readPartialStats(FILE *file) {
+	int layoutSize;
+	CepacUtil::readBinary(file, &layoutSize);
+	if (layoutSize != (int) (sizeof(CostPopulationSummary) + sizeof(allStats) + sizeof(eventStats))) {
+		string errorString = "   ERROR - Partial statistics file was written by a version of CEPAC with different cost statistics";
+		throw errorString;
+	}
+	CepacUtil::readBinary(file, &popSummary);
+	CepacUtil::readBinary(file, &allStats);
+	CepacUtil::readBinary(file, &eventStats);
+} /* end readPartialStats */
+
 /** \brief finalizeCostPopulationSummary calculates aggregate statistics for the CostPopulationSummary object */
 void CostStats::finalizeCostPopulationSummary() {
 
@@ -219,150 +353,150 @@ void CostStats::writeAllStats(SimContext::COST_REPORT_DISCOUNT disc) {
 		//total patient months
 		fprintf(costStatsFile, "\n\tTotal Patient Mths");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].LMs);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].LMs);
 
 		//total costs
 		fprintf(costStatsFile, "\n\tTotal Costs");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costs);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costs);
 
 		//ART Costs
 		fprintf(costStatsFile, "\n\tART Costs");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsART);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsART);
 
 		//OI proph costs
 		fprintf(costStatsFile, "\n\tOI Prophylaxis Costs");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsOIProph);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsOIProph);
 
 		//TB proph costs
 		fprintf(costStatsFile, "\n\tTB Prophylaxis Costs");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsTBProph);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsTBProph);
 
 		//Intervention costs
 		fprintf(costStatsFile, "\n\tIntervention Startup Costs");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsInterventionStartup);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsInterventionStartup);
 
 		fprintf(costStatsFile, "\n\tIntervention Monthly Costs");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsInterventionMonthly);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsInterventionMonthly);
 
 		//CD4 Test costs
 		fprintf(costStatsFile, "\n\tCD4 Test Costs");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsCD4Testing);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsCD4Testing);
 
 		for (int l = 0; l < SimContext::COST_NUM_TYPES; l++){
 			fprintf(costStatsFile, "\n\tCD4 Test Costs %s", SimContext::COST_TYPES_STRS[l]);
 			for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-				fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsCD4TestingCategory[l]);
+				fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsCD4TestingCategory[l]);
 		}
 
 		//HVL Test costs
 		fprintf(costStatsFile, "\n\tHVL Test Costs");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsHVLTesting);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsHVLTesting);
 
 		for (int l = 0; l < SimContext::COST_NUM_TYPES; l++){
 			fprintf(costStatsFile, "\n\tHVL Test Costs %s", SimContext::COST_TYPES_STRS[l]);
 			for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-				fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsHVLTestingCategory[l]);
+				fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsHVLTestingCategory[l]);
 		}
 
 		//Clinic Visit costs
 		fprintf(costStatsFile, "\n\tClinic Visit Costs");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsClinicVisit);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsClinicVisit);
 
 		for (int l = 0; l < SimContext::COST_NUM_TYPES; l++){
 			fprintf(costStatsFile, "\n\tClinic Visit Costs %s", SimContext::COST_TYPES_STRS[l]);
 			for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-				fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsClinicVisitCategory[l]);
+				fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsClinicVisitCategory[l]);
 		}
 
 		//Routine care costs
 		fprintf(costStatsFile, "\n\tRoutine Care Costs");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsRoutineCare);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsRoutineCare);
 
 		for (int l = 0; l < SimContext::COST_NUM_TYPES; l++){
 			fprintf(costStatsFile, "\n\tRoutine Care Costs %s", SimContext::COST_TYPES_STRS[l]);
 			for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-				fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsRoutineCareCategory[l]);
+				fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsRoutineCareCategory[l]);
 		}
 
 		//General Medicine
 		fprintf(costStatsFile, "\n\tGeneral Medicine Costs");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsGeneralMedicine);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsGeneralMedicine);
 
 		for (int l = 0; l < SimContext::COST_NUM_TYPES; l++){
 			fprintf(costStatsFile, "\n\tGeneral Medicine Costs %s", SimContext::COST_TYPES_STRS[l]);
 			for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-				fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsGeneralMedicineCategory[l]);
+				fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsGeneralMedicineCategory[l]);
 		}
 
 		//Acute OI Treatment
 		fprintf(costStatsFile, "\n\tOI Treatment Costs");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsOITreatment);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsOITreatment);
 
 		for (int l = 0; l < SimContext::COST_NUM_TYPES; l++){
 			fprintf(costStatsFile, "\n\tOI Treatment Costs %s", SimContext::COST_TYPES_STRS[l]);
 			for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-				fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsOITreatmentCategory[l]);
+				fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsOITreatmentCategory[l]);
 		}
 
 		fprintf(costStatsFile, "\n\tUntreated Acute OI Costs");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsOIUntreated);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsOIUntreated);
 
 		for (int l = 0; l < SimContext::COST_NUM_TYPES; l++){
 			fprintf(costStatsFile, "\n\tUntreated Acute OI Costs %s", SimContext::COST_TYPES_STRS[l]);
 			for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-				fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsOIUntreatedCategory[l]);
+				fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsOIUntreatedCategory[l]);
 		}
 
 
 		//Toxicity Costs
 		fprintf(costStatsFile, "\n\tToxicity Costs");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsToxicity);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsToxicity);
 
 		//Death Costs
 		fprintf(costStatsFile, "\n\tDeath Costs");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsDeath);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsDeath);
 
 		for (int l = 0; l < SimContext::COST_NUM_TYPES; l++){
 			fprintf(costStatsFile, "\n\tDeath Costs %s", SimContext::COST_TYPES_STRS[l]);
 			for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-				fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsDeathCategory[l]);
+				fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsDeathCategory[l]);
 		}
 
 		//Screening Costs
 		fprintf(costStatsFile, "\n\tHIV Screening Tests Cost");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsHIVScreeningTests);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsHIVScreeningTests);
 		fprintf(costStatsFile, "\n\tHIV Screening Misc Cost");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsHIVScreeningMisc);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsHIVScreeningMisc);
 
 		//Lab Staging Costs
 		fprintf(costStatsFile, "\n\tLab Staging Tests Cost");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsLabStagingTests);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsLabStagingTests);
 		fprintf(costStatsFile, "\n\tLab Staging Misc Cost");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsLabStagingMisc);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsLabStagingMisc);
 
 		//TB Treatment Costs
 		fprintf(costStatsFile, "\n\tTB Treatment Cost");
 		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++)
-			fprintf(costStatsFile, "\t%1.2lf", allStats[disc][j][k].costsTBTreatment);
+			fprintf(costStatsFile, "\t%1.2lf", (double) allStats[disc][j][k].costsTBTreatment);
 
 
 	}
@@ -51,59 +51,59 @@ public:
 	class AllStats {
 	public:
 		//Life months lived by patient
-		double LMs;
+		FixedPointSum LMs;
 		//Overall costs accrued by patient
-		double costs;
+		FixedPointSum costs;
 		//ART costs
-		double costsART;
+		FixedPointSum costsART;
 		//OI Prohylaxis costs
-		double costsOIProph;
+		FixedPointSum costsOIProph;
 		//TB Prophylaxis costs
-		double costsTBProph;
+		FixedPointSum costsTBProph;
 		//CD4 HVL test costs
-		double costsCD4Testing;
-		double costsHVLTesting;
-		double costsCD4TestingCategory[SimContext::COST_NUM_TYPES];
-		double costsHVLTestingCategory[SimContext::COST_NUM_TYPES];
+		FixedPointSum costsCD4Testing;
+		FixedPointSum costsHVLTesting;
+		FixedPointSum costsCD4TestingCategory[SimContext::COST_NUM_TYPES];
+		FixedPointSum costsHVLTestingCategory[SimContext::COST_NUM_TYPES];
 		//intervention costs
-		double costsInterventionStartup;
-		double costsInterventionMonthly;
+		FixedPointSum costsInterventionStartup;
+		FixedPointSum costsInterventionMonthly;
 
 		//Visit costs
-		double costsClinicVisit;
-		double costsClinicVisitCategory[SimContext::COST_NUM_TYPES];
+		FixedPointSum costsClinicVisit;
+		FixedPointSum costsClinicVisitCategory[SimContext::COST_NUM_TYPES];
 
 		//routine care costs
-		double costsRoutineCare;
-		double costsRoutineCareCategory[SimContext::COST_NUM_TYPES];
+		FixedPointSum costsRoutineCare;
+		FixedPointSum costsRoutineCareCategory[SimContext::COST_NUM_TYPES];
 
 		//general medicine costs
-		double costsGeneralMedicine;
-		double costsGeneralMedicineCategory[SimContext::COST_NUM_TYPES];
+		FixedPointSum costsGeneralMedicine;
+		FixedPointSum costsGeneralMedicineCategory[SimContext::COST_NUM_TYPES];
 
 		//treated and untreated acute OI costs
-		double costsOITreatment;
-		double costsOITreatmentCategory[SimContext::COST_NUM_TYPES];
-		double costsOIUntreated;
-		double costsOIUntreatedCategory[SimContext::COST_NUM_TYPES];
+		FixedPointSum costsOITreatment;
+		FixedPointSum costsOITreatmentCategory[SimContext::COST_NUM_TYPES];
+		FixedPointSum costsOIUntreated;
+		FixedPointSum costsOIUntreatedCategory[SimContext::COST_NUM_TYPES];
 
 		//Toxicity costs
-		double costsToxicity;
+		FixedPointSum costsToxicity;
 
 		//death costs
-		double costsDeath;
-		double costsDeathCategory[SimContext::COST_NUM_TYPES];
+		FixedPointSum costsDeath;
+		FixedPointSum costsDeathCategory[SimContext::COST_NUM_TYPES];
 
 		//screening costs
-		double costsHIVScreeningTests;
-		double costsHIVScreeningMisc;
+		FixedPointSum costsHIVScreeningTests;
+		FixedPointSum costsHIVScreeningMisc;
 
 		//lab staging costs
-		double costsLabStagingTests;
-		double costsLabStagingMisc;
+		FixedPointSum costsLabStagingTests;
+		FixedPointSum costsLabStagingMisc;
 
 		//TB treatment cost
-		double costsTBTreatment;
+		FixedPointSum costsTBTreatment;
 	};
 
 	/** class for stats for counts of events can by any cd4 strata*/
@@ -135,8 +135,13 @@ public:
 	const EventStats *getEventStats(SimContext::CD4_STRATA obsvCD4Strata, SimContext::COST_SUBGROUPS subgroup);
 
 	/* Functions to calculate final aggregate statistics and to write out the stats file */
+	void merge(const CostStats &other);
 	void finalizeStats();
 	void writeStatsFile();
+
+	/* Functions to write and read the totals in a partial statistics file, called by the RunStats partial statistics file functions */
+	void writePartialStats(FILE *file);
+	void readPartialStats(FILE *file);
 private:
 	/** Pointer to the associated simulation context */
 	SimContext *simContext;
@@ -144,6 +149,8 @@ private:
 	string costStatsFileName;
 	/** Stats file pointer */
 	FILE *costStatsFile;
+	/** True once finalizeStats has turned the totals into averages, after which no more shards may be merged */
+	bool isFinalized;
 
 	/** Statistics subclass object */
 	CostPopulationSummary popSummary;
@@ -156,6 +163,11 @@ private:
 	void initAllStats();
 	void initEventStats();
 
+	/* Functions to add the statistics of another CostStats object, called by merge */
+	void mergeCostPopulationSummary(const CostStats &other);
+	void mergeAllStats(const CostStats &other);
+	void mergeEventStats(const CostStats &other);
+
 	/* Functions to finalize aggregate statistics before printing out */
 	void finalizeCostPopulationSummary();
 	void finalizeAllStats();
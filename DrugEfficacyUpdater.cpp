@@ -43,10 +43,19 @@ void DrugEfficacyUpdater::performARTEfficacyUpdates() {
 	SimContext::CD4_RESPONSE_TYPE cd4Response = patient->getARTState()->CD4ResponseType;
 
 	const SimContext::ARTInputs *artInputs = simContext->getARTInputs(artLineNum);
-	const SimContext::PedsARTInputs *pedsART = simContext->getPedsARTInputs(artLineNum);
-	const SimContext::AdolescentARTInputs *ayaART = simContext->getAdolescentARTInputs(artLineNum);
 	SimContext::PEDS_AGE_CAT pedsAgeCat = patient->getPedsState()->ageCategoryPediatrics;
-	int ayaAgeCat = getAgeCategoryAdolescent();
+
+	/** The Adolescent and Peds ART inputs are only looked up for those patients, their tabs are not read if the module is disabled */
+	const SimContext::PedsARTInputs *pedsART = NULL;
+	const SimContext::AdolescentARTInputs *ayaART = NULL;
+	int ayaAgeCat = SimContext::NOT_APPL;
+	if (patient->getGeneralState()->isAdolescent) {
+		ayaART = simContext->getAdolescentARTInputs(artLineNum);
+		ayaAgeCat = getAgeCategoryAdolescent();
+	}
+	else if (pedsAgeCat != SimContext::PEDS_AGE_ADULT) {
+		pedsART = simContext->getPedsARTInputs(artLineNum);
+	}
 
 	/** Increment the number of months on failed ART for resistance,
 	/*	only count if patient is a full/partial responder */
@@ -34,7 +34,7 @@ void DrugToxicityUpdater::performMonthlyUpdates() {
 		if (patient->getProphState()->currTotalNumProphsOn > 0)
 			performProphToxicityUpdates();
 	}
-	if (simContext->getTBInputs()->enableTB){
+	if (simContext->isTBEnabled()){
 		if (patient->getTBState()->isOnProph)
 			performTBProphToxicityUpdates();
 
@@ -200,7 +200,7 @@ void DrugToxicityUpdater::performProphToxicityUpdates() {
 			// Print tracing information if enabled
 			if (patient->getGeneralState()->tracingEnabled) {
 				tracer->printTrace(1, "**%d MAJ TOX: OI %s %s PROPH %d, %1.2lf QAred, $ %1.0lf;\n",
-					patient->getGeneralState()->monthNum, SimContext::OI_STRS[i],
+					patient->getGeneralState()->monthNum, simContext->OI_STRS[i],
 					SimContext::PROPH_TYPE_STRS[prophType],
 					prophNum + 1, patient->getGeneralState()->QOLValue,
 					patient->getGeneralState()->costsDiscounted);
@@ -223,7 +223,7 @@ void DrugToxicityUpdater::performProphToxicityUpdates() {
 			/** Print tracing information if enabled */
 			if (patient->getGeneralState()->tracingEnabled) {
 				tracer->printTrace(1, "**%d MIN TOX: OI %s %s PROPH %d, %1.2lf QAred, $ %1.0lf;\n",
-					patient->getGeneralState()->monthNum, SimContext::OI_STRS[i],
+					patient->getGeneralState()->monthNum, simContext->OI_STRS[i],
 					SimContext::PROPH_TYPE_STRS[prophType],
 					prophNum + 1, patient->getGeneralState()->QOLValue,
 					patient->getGeneralState()->costsDiscounted);
@@ -343,7 +343,7 @@ void EndMonthUpdater::performMonthlyUpdates() {
 			}
 
 			tracer->printTrace(1, "  %d mth: ", patient->getGeneralState()->monthNum);
-			if (simContext->getTBInputs()->enableTB)
+			if (simContext->isTBEnabled())
 				tracer->printTrace(1, "TB Symptoms: %s, ", patient->getTBState()->currTrueTBTracker[SimContext::TB_TRACKER_SYMPTOMS]?"Yes":"No");
 
 			tracer->printTrace(1, "LM %1.2lf QA %1.2lf, $ %1.0lf;\n",
@@ -372,7 +372,7 @@ void EndMonthUpdater::performMonthlyUpdates() {
 		/** If tracing is enabled, print out death tracing */
 		if (patient->getGeneralState()->tracingEnabled) {
 			tracer->printTrace(1, "**%d DEATH %s;\n", patient->getGeneralState()->monthNum,
-				SimContext::DTH_CAUSES_STRS[patient->getDiseaseState()->causeOfDeath]);
+				simContext->DTH_CAUSES_STRS[patient->getDiseaseState()->causeOfDeath]);
 			tracer->printTrace(1, "  LMs %1.2lf QA %1.2lf $ %1.0lf ;\n",
 				patient->getGeneralState()->LMsDiscounted,
 				patient->getGeneralState()->qualityAdjustLMsDiscounted,
@@ -0,0 +1,100 @@
+#pragma once
+
+/**
+	FixedPointSum holds a total of doubles as a 128 bit fixed point number with FRACTION_BITS fractional bits.
+	Each value is rounded to the nearest multiple of 2^-FRACTION_BITS when it is added, and the total of the
+	rounded values is exact, so it is the same whatever order the values are added in and however they are
+	grouped.  The statistics totals summed over patients use it, so that merging the totals of blocks or shards
+	of a cohort gives exactly the totals of adding the patients one after another.  The range is about +-1.5e26
+	and the resolution about 9.1e-13, far beyond the precision the outputs are written with.
+
+	The class has no constructors, so that the statistics classes holding it stay plain data that can be value
+	initialized and written to partial statistics files as they are; assign 0 to clear it.
+*/
+class FixedPointSum
+{
+public:
+	/* Functions to set, add to, and read the total */
+	FixedPointSum &operator=(double value);
+	FixedPointSum &operator+=(double value);
+	FixedPointSum &operator+=(const FixedPointSum &other);
+	operator double() const;
+	bool operator==(const FixedPointSum &other) const;
+
+	/** Number of bits after the binary point */
+	static const int FRACTION_BITS = 40;
+
+private:
+	/** The total times 2^FRACTION_BITS as a two's complement 128 bit integer, highBits * 2^64 + lowBits */
+	long long highBits;
+	unsigned long long lowBits;
+
+	void addBits(long long high, unsigned long long low);
+};
+
+/** \brief operator= sets the total to a single value, rounded to the resolution of the total */
+inline FixedPointSum &FixedPointSum::operator=(double value) {
+	highBits = 0;
+	lowBits = 0;
+	return *this += value;
+} /* end operator= */
+
+/** \brief operator+= rounds a value to the nearest multiple of 2^-FRACTION_BITS, halves to even, and adds it to the total
+ *
+ * Scaling by a power of 2 is exact.  Most values are rounded without branching by adding and subtracting 1.5 * 2^52,
+ * which leaves a double of magnitude below 2^51 rounded to an integer; larger values have at most one bit after the
+ * binary point and are rounded by llrint, and every double of magnitude 2^63 or more is an integer, so splitting it
+ * into two 64 bit words is exact.  The value must be finite and within the range of the total.
+ **/
+inline FixedPointSum &FixedPointSum::operator+=(double value) {
+	const double TWO_TO_51 = 2251799813685248.0;
+	const double TWO_TO_63 = 9223372036854775808.0;
+	const double TWO_TO_64 = 18446744073709551616.0;
+	const double ROUNDING_CONSTANT = 6755399441055744.0;
+	double scaled = value * (double) (1LL << FRACTION_BITS);
+	if (fabs(scaled) < TWO_TO_63) {
+		long long units;
+		if (fabs(scaled) < TWO_TO_51)
+			units = (long long) ((scaled + ROUNDING_CONSTANT) - ROUNDING_CONSTANT);
+		else
+			units = llrint(scaled);
+		addBits((units < 0) ? -1 : 0, (unsigned long long) units);
+	}
+	else {
+		double high = floor(scaled / TWO_TO_64);
+		addBits((long long) high, (unsigned long long) (scaled - high * TWO_TO_64));
+	}
+	return *this;
+} /* end operator+= */
+
+/** \brief operator+= adds another total exactly, used to merge statistics */
+inline FixedPointSum &FixedPointSum::operator+=(const FixedPointSum &other) {
+	addBits(other.highBits, other.lowBits);
+	return *this;
+} /* end operator+= */
+
+/** \brief operator double returns the total as a double, rounding its magnitude so that negative totals are as precise as positive ones */
+inline FixedPointSum::operator double() const {
+	const double TWO_TO_64 = 18446744073709551616.0;
+	bool isNegative = (highBits < 0);
+	unsigned long long high = (unsigned long long) highBits;
+	unsigned long long low = lowBits;
+	if (isNegative) {
+		high = ~high + ((low == 0) ? 1 : 0);
+		low = ~low + 1;
+	}
+	double magnitude = ((double) high * TWO_TO_64 + (double) low) / (double) (1LL << FRACTION_BITS);
+	return isNegative ? -magnitude : magnitude;
+} /* end operator double */
+
+/** \brief operator== returns true if two totals are exactly equal */
+inline bool FixedPointSum::operator==(const FixedPointSum &other) const {
+	return (highBits == other.highBits) && (lowBits == other.lowBits);
+} /* end operator== */
+
+/** \brief addBits adds a two's complement 128 bit integer to the total, carrying from the low word into the high word */
+inline void FixedPointSum::addBits(long long high, unsigned long long low) {
+	unsigned long long sumLow = lowBits + low;
+	highBits = (long long) ((unsigned long long) highBits + (unsigned long long) high + ((sumLow < low) ? 1 : 0));
+	lowBits = sumLow;
+} /* end addBits */
@@ -23,7 +23,7 @@ void HIVInfectionUpdater::performInitialUpdates() {
 	bool isHighRisk = true;
 	setHIVIncReducMultiplier(1.0);
 	// Start with Pediatric initial breastfeeding, maternal, and HIV states if enabled
-	if (simContext->getPedsInputs()->enablePediatricsModel) {
+	if (simContext->isPedsModelEnabled()) {
 		/** For pediatrics: */
 		setInitialMaternalState();
 
@@ -175,7 +175,7 @@ void HIVInfectionUpdater::performInitialUpdates() {
 		setInfectedHIVState(infectedState, true, true);
 		
 		//Roll for age of serorversion
-		if (simContext->getEIDInputs()->enableHIVTestingEID){
+		if (simContext->isEIDTestingEnabled()){
 			int ageOfSeroreversion = (int)(CepacUtil::getRandomGaussian(simContext->getEIDInputs()->ageOfSeroreversionMean, simContext->getEIDInputs()->ageOfSeroreversionStdDev, 90018, patient)+0.5);
 			setAgeOfSeroreversion(ageOfSeroreversion);
 		}
@@ -258,19 +258,16 @@ void HIVInfectionUpdater::performInitialUpdates() {
 			cd4Mean = simContext->getCohortInputs()->initialCD4Mean;
 			cd4StdDev = simContext->getCohortInputs()->initialCD4StdDev;
 		}
-		int count = 0;
 		// If we are using the square root transformation the drawn value is squared to get the actual CD4
 		if (simContext->getCohortInputs()->enableSquareRootTransform){
 			while ((cd4Value < 0) || ((simContext->getRunSpecsInputs()->maxPatientCD4 != SimContext::NOT_APPL) && (cd4Value*cd4Value > simContext->getRunSpecsInputs()->maxPatientCD4))){
-				cd4Value = CepacUtil::getRandomGaussian(cd4Mean, cd4StdDev, 90040+count, patient);
-				count++;
+				cd4Value = CepacUtil::getRandomGaussian(cd4Mean, cd4StdDev, 90040, patient);
 			}
 			cd4Value = cd4Value * cd4Value;
 		}
 		else{
 			while ((cd4Value < 0) || ((simContext->getRunSpecsInputs()->maxPatientCD4 != SimContext::NOT_APPL) && (cd4Value > simContext->getRunSpecsInputs()->maxPatientCD4))){
-				cd4Value = CepacUtil::getRandomGaussian(cd4Mean, cd4StdDev, 90040+count, patient);
-				count++;
+				cd4Value = CepacUtil::getRandomGaussian(cd4Mean, cd4StdDev, 90040, patient);
 			}
 		}
 
@@ -400,14 +397,8 @@ void HIVInfectionUpdater::performHIVNegativeUpdates() {
 	!patient->getMonitoringState()->everPrEP && 
 	(simContext->getHIVTestInputs()->PrEPAfterRollout[risk] || patient->getGeneralState()->monthNum < simContext->getHIVTestInputs()->PrEPRolloutDuration[risk])){
 
-		double probPrEP;
-		double coverage = simContext->getHIVTestInputs()->PrEPCoverage[risk];
-		int duration = simContext->getHIVTestInputs()->PrEPRolloutDuration[risk];
-		double shape = simContext->getHIVTestInputs()->PrEPShape[risk];
-		int month = patient->getGeneralState()->monthNum;
-
 		//prob from Weibull distribution
-		probPrEP = 1-pow(1-coverage,(pow(month+1,shape)-pow(month,shape))/pow(duration,shape));
+		double probPrEP = simContext->getPrEPUptakeProb(risk, patient->getGeneralState()->monthNum);
 		//log probability of age-eligible patients joining
         updatePrEPProbLogging(probPrEP, risk);
 		if(!patient->getGeneralState()->isPediatric && 
@@ -445,13 +436,8 @@ void HIVInfectionUpdater::performHIVNegativeUpdates() {
 			if(patient->getGeneralState()->monthNum <= simContext->getHIVTestInputs()->HIVIncReducStageBounds[SimContext::INC_REDUC_PERIODS_NUM - 1]){	
 				// accumulate a new multplier if a new stage bound was reached this month
 				double newReducMult = patient->getMonitoringState()->HIVIncReducMultiplier;
-				for(int i = 0; i < SimContext::INC_REDUC_PERIODS_NUM; i++){
-					if(patient->getGeneralState()->monthNum == simContext->getHIVTestInputs()->HIVIncReducStageBounds[i]){
-						newReducMult *= simContext->getHIVTestInputs()->HIVIncReducMultipliers[i];
-						setHIVIncReducMultiplier(newReducMult);
-						break;
-					}
-				}
+				newReducMult *= simContext->getHIVIncReducStageMultiplier(patient->getGeneralState()->monthNum);
+				setHIVIncReducMultiplier(newReducMult);
 			}
 			probInfect *= patient->getMonitoringState()->HIVIncReducMultiplier;
 		}
@@ -555,18 +541,15 @@ void HIVInfectionUpdater::performHIVNewInfectionUpdates(){
 		double cd4Mean = simContext->getHIVTestInputs()->initialAcuteCD4DistributionMean;
 		double cd4StdDev = simContext->getHIVTestInputs()->initialAcuteCD4DistributionStdDev;
 		double cd4Value = -1;
-		int count = 0;
 		if (simContext->getCohortInputs()->enableSquareRootTransform){
 			while ((cd4Value < 0) || ((simContext->getRunSpecsInputs()->maxPatientCD4 != SimContext::NOT_APPL) && (cd4Value*cd4Value > simContext->getRunSpecsInputs()->maxPatientCD4))){
-				cd4Value = CepacUtil::getRandomGaussian(cd4Mean, cd4StdDev, 90067+count, patient);
-				count++;
+				cd4Value = CepacUtil::getRandomGaussian(cd4Mean, cd4StdDev, 90067, patient);
 			}
 			cd4Value = cd4Value * cd4Value;
 		}
 		else{
 			while ((cd4Value < 0) || ((simContext->getRunSpecsInputs()->maxPatientCD4 != SimContext::NOT_APPL) && (cd4Value > simContext->getRunSpecsInputs()->maxPatientCD4))){
-				cd4Value = CepacUtil::getRandomGaussian(cd4Mean, cd4StdDev, 90068+count, patient);
-				count++;
+				cd4Value = CepacUtil::getRandomGaussian(cd4Mean, cd4StdDev, 90068, patient);
 			}
 		}
 		setTrueCD4(cd4Value, true);
@@ -841,7 +824,7 @@ void HIVInfectionUpdater::performPediatricDiseaseUpdates() {
 	bool ageEligible = false;
 	if ((!simContext->getHIVTestInputs()->enableHIVTesting || patient->getGeneralState()->ageMonths < simContext->getHIVTestInputs()->HIVRegularTestingStartAge))
 		ageEligible = true;
-	if (simContext->getEIDInputs()->enableHIVTestingEID && ageEligible && (patient->getMonitoringState()->careState < SimContext::HIV_CARE_IN_CARE)){
+	if (simContext->isEIDTestingEnabled() && ageEligible && (patient->getMonitoringState()->careState < SimContext::HIV_CARE_IN_CARE)){
 		// For each Infant HIV Prophylaxis regimen
         for (int i = 0; i < SimContext::INFANT_HIV_PROPHS_NUM; ++i){
            	const SimContext::EIDInputs::InfantHIVProph &infantProph = simContext->getEIDInputs()->infantHIVProphs[i];
@@ -1002,7 +985,7 @@ void HIVInfectionUpdater::performPediatricDiseaseUpdates() {
 	}
 
 	/** Handle conversions if this is the month of transition to adolescent model*/
-	if (simContext->getAdolescentInputs()->enableAdolescent &&
+	if (simContext->isAdolescentEnabled() &&
 		(patient->getGeneralState()->ageMonths == simContext->getAdolescentInputs()->ageTransitionFromPeds)){
 		// Change their patient status from Pediatric to Adolescent
 		setPediatricState(false);
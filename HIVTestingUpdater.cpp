@@ -29,7 +29,7 @@ void HIVTestingUpdater::performInitialUpdates() {
 	//Use either the HIVTest inputs or the EID inputs for initial states, depending on whether the Peds Module is enabled 
 	if(simContext->getHIVTestInputs()->enableHIVTesting)
 		useHIVTesting = true;
-	if(simContext->getPedsInputs()->enablePediatricsModel && simContext->getEIDInputs()->enableHIVTestingEID){
+	if(simContext->isPedsModelEnabled() && simContext->isEIDTestingEnabled()){
 		useHIVTesting = true;
 		useEID = true;
 	}
@@ -165,8 +165,8 @@ void HIVTestingUpdater::performMonthlyUpdates() {
 	//Use either the HIVTest inputs or the EID inputs, depending on whether the Peds Module is enabled
 	if(simContext->getHIVTestInputs()->enableHIVTesting)
 		useHIVTesting = true;
-	if (simContext->getPedsInputs()->enablePediatricsModel){
-		if(simContext->getEIDInputs()->enableHIVTestingEID){
+	if (simContext->isPedsModelEnabled()){
+		if(simContext->isEIDTestingEnabled()){
 			useHIVTesting = true;
 			if(!simContext->getHIVTestInputs()->enableHIVTesting || patient->getGeneralState()->ageMonths < simContext->getHIVTestInputs()->HIVRegularTestingStartAge)
 				useEID = true;
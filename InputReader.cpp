@@ -0,0 +1,478 @@
+#include "include.h"
+
+/** \brief Constructor creates an empty reader, the file is loaded by open */
+InputReader::InputReader(void) {
+	data = "";
+	length = 0;
+	pos = 0;
+	isMapped = false;
+	isTokenIndexBuilt = false;
+	viewSource = NULL;
+	numFailedSearches = 0;
+	numBadValues = 0;
+	firstBadValuePosition = -1;
+	lastBadValuePosition = -1;
+} /* end Constructor */
+
+/** \brief Destructor releases the contents of the file */
+InputReader::~InputReader(void) {
+	close();
+} /* end Destructor */
+
+/** \brief open loads the whole file into memory and moves the read position to its start
+ *
+ * The file is mapped with mmap where available, and otherwise read into memory in binary mode; the read functions
+ * treat the carriage returns of Windows line endings as whitespace
+ *
+ * \param fileName a pointer to a character array representing the name of the file
+ * \return false if the file could not be opened
+ **/
+bool InputReader::open(const char *fileName) {
+	close();
+#if !defined(_WIN32)
+	int fileDescriptor = ::open(fileName, O_RDONLY);
+	if (fileDescriptor < 0)
+		return false;
+	struct stat fileStat;
+	if ((fstat(fileDescriptor, &fileStat) == 0) && (fileStat.st_size > 0)) {
+		void *mapping = mmap(NULL, (size_t) fileStat.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+		if (mapping != MAP_FAILED) {
+			::close(fileDescriptor);
+			data = (const char *) mapping;
+			length = (long) fileStat.st_size;
+			isMapped = true;
+			return true;
+		}
+	}
+	::close(fileDescriptor);
+#endif
+
+	/* Read the file into memory if it could not be mapped */
+	FILE *file = CepacUtil::openFile(fileName, "rb");
+	if (file == NULL)
+		return false;
+	char buffer[65536];
+	size_t numRead;
+	while ((numRead = fread(buffer, 1, sizeof(buffer), file)) > 0)
+		fileContents.append(buffer, numRead);
+	CepacUtil::closeFile(file);
+	data = fileContents.c_str();
+	length = (long) fileContents.size();
+	return true;
+} /* end open */
+
+/** \brief openContents takes over the given contents as if they had been read from a file, leaving the string empty
+ *
+ * \param contents a pointer to the string of contents to read
+ **/
+void InputReader::openContents(string *contents) {
+	close();
+	fileContents.swap(*contents);
+	data = fileContents.c_str();
+	length = (long) fileContents.size();
+} /* end openContents */
+
+/** \brief close releases the contents of the file and its token index */
+void InputReader::close() {
+#if !defined(_WIN32)
+	if (isMapped)
+		munmap((void *) data, (size_t) length);
+#endif
+	isMapped = false;
+	string().swap(fileContents);
+	data = "";
+	length = 0;
+	pos = 0;
+	isTokenIndexBuilt = false;
+	tokenIndex.clear();
+	viewSource = NULL;
+	numFailedSearches = 0;
+	numBadValues = 0;
+	firstBadValuePosition = -1;
+	lastBadValuePosition = -1;
+} /* end close */
+
+/** \brief openView makes this reader read the contents of another reader from the given offset
+ *
+ * The view shares the contents and token index of the source, which must stay open while the view is used.  Each view
+ * may be read by its own thread; the token index is built by the first view that needs it.
+ *
+ * \param source a pointer to the InputReader that loaded the file
+ * \param position a long representing the offset of the first character the view reads
+ **/
+void InputReader::openView(InputReader *source, long position) {
+	close();
+	if (source->viewSource != NULL)
+		source = source->viewSource;
+	viewSource = source;
+	data = source->data;
+	length = source->length;
+	pos = position;
+} /* end openView */
+
+/** \brief findToken returns the offset of the first occurrence of a token that starts after the given offset
+ *
+ * Searches the contents directly rather than the token index, which is usually not needed; the token must be surrounded
+ * by whitespace or the ends of the file
+ *
+ * \param token a pointer to a character array representing the token to search for
+ * \param afterPosition a long representing the offset the token must start after, or -1 to search the whole file
+ * \return the offset of the first character of the token, or -1 if it does not occur after afterPosition
+ **/
+long InputReader::findToken(const char *token, long afterPosition) {
+	long tokenLength = (long) strlen(token);
+	if (tokenLength == 0)
+		return -1;
+	long start = afterPosition + 1;
+	while (start + tokenLength <= length) {
+		const char *match = (const char *) memchr(data + start, token[0], length - tokenLength + 1 - start);
+		if (match == NULL)
+			return -1;
+		long matchStart = (long) (match - data);
+		long matchEnd = matchStart + tokenLength;
+		if ((memcmp(match, token, tokenLength) == 0) && ((matchStart == 0) || isWhitespace(data[matchStart - 1])) &&
+				((matchEnd == length) || isWhitespace(data[matchEnd])))
+			return matchStart;
+		start = matchStart + 1;
+	}
+	return -1;
+} /* end findToken */
+
+/** \brief scan reads values from the file according to the format, as fscanf does
+ *
+ * Whitespace in the format skips any whitespace in the file; each conversion skips whitespace and then reads one value,
+ * %d and %ld with parseLong and %lf and %f with parseDouble, or %s a token of up to the given width.  Reading stops at
+ * the first value that cannot be converted.
+ *
+ * \param format a pointer to a character array with the conversions, as for fscanf
+ * \return the number of values assigned, or EOF if the end of the file is reached before the first conversion
+ **/
+int InputReader::scan(const char *format, ...) {
+	va_list args;
+	va_start(args, format);
+	int numAssigned = 0;
+	const char *formatChar = format;
+	const char *limit = data + length;
+	while (*formatChar != '\0') {
+		if (isWhitespace(*formatChar)) {
+			skipWhitespace();
+			formatChar++;
+			continue;
+		}
+		if (*formatChar != '%') {
+			/* Other characters of the format must match the next character of the file */
+			if ((pos < length) && (data[pos] == *formatChar)) {
+				pos++;
+				formatChar++;
+				continue;
+			}
+			break;
+		}
+
+		/* Parse the width, size and type of the conversion */
+		formatChar++;
+		long width = 0;
+		while ((*formatChar >= '0') && (*formatChar <= '9')) {
+			width = width * 10 + (*formatChar - '0');
+			formatChar++;
+		}
+		bool isLong = false;
+		if (*formatChar == 'l') {
+			isLong = true;
+			formatChar++;
+		}
+		char conversion = *formatChar;
+		formatChar++;
+
+		skipWhitespace();
+		if (pos >= length) {
+			va_end(args);
+			return (numAssigned == 0) ? EOF : numAssigned;
+		}
+		const char *start = data + pos;
+		const char *end;
+		if (conversion == 'd') {
+			long value;
+			end = parseLong(start, limit, &value);
+			if (end == start) {
+				recordBadValue();
+				break;
+			}
+			if (isLong)
+				*va_arg(args, long *) = value;
+			else
+				*va_arg(args, int *) = (int) value;
+		}
+		else if (conversion == 'f') {
+			double value;
+			end = parseDouble(start, limit, &value);
+			if (end == start) {
+				recordBadValue();
+				break;
+			}
+			if (isLong)
+				*va_arg(args, double *) = value;
+			else
+				*va_arg(args, float *) = (float) value;
+		}
+		else if (conversion == 's') {
+			long tokenEnd = getTokenEnd(pos, width);
+			char *buffer = va_arg(args, char *);
+			memcpy(buffer, start, tokenEnd - pos);
+			buffer[tokenEnd - pos] = '\0';
+			end = data + tokenEnd;
+		}
+		else {
+			va_end(args);
+			string errorString = "   ERROR - Unsupported conversion in input format ";
+			errorString.append(format);
+			throw errorString;
+		}
+		pos = (long) (end - data);
+		numAssigned++;
+	}
+	va_end(args);
+	return numAssigned;
+} /* end scan */
+
+/** \brief parseDouble parses a decimal number at the start of the characters, giving the same value and end as strtod
+ *
+ * Numbers with at most 19 significant digits whose mantissa is below 2^53 and whose power of ten is at most 22 in magnitude
+ * are converted with a single multiplication or division of two exactly represented doubles, which is correctly rounded
+ * and so equal to the result of strtod (Clinger's fast path).  All other numbers, including hexadecimal ones, infinity
+ * and NaN, are converted by strtod itself.
+ *
+ * \param start a pointer to the first character of the number
+ * \param limit a pointer just past the last character that may be read
+ * \param value a pointer to the double to store the number in
+ * \return a pointer just past the number, or start if there is no number to convert
+ **/
+const char *InputReader::parseDouble(const char *start, const char *limit, double *value) {
+	static const double POWERS_OF_TEN[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+	const char *c = start;
+	bool isNegative = false;
+	if ((c < limit) && ((*c == '-') || (*c == '+'))) {
+		isNegative = (*c == '-');
+		c++;
+	}
+
+	/* Read the significant digits into the mantissa, counting the digits after the decimal point in the exponent */
+	uint64_t mantissa = 0;
+	int numSignificantDigits = 0;
+	int exponent = 0;
+	bool hasDigits = false;
+	bool isMantissaExact = true;
+	while ((c < limit) && (*c >= '0') && (*c <= '9')) {
+		hasDigits = true;
+		if (numSignificantDigits < 19) {
+			mantissa = mantissa * 10 + (*c - '0');
+			if (mantissa > 0)
+				numSignificantDigits++;
+		}
+		else
+			isMantissaExact = false;
+		c++;
+	}
+	if ((c < limit) && (*c == '.')) {
+		c++;
+		while ((c < limit) && (*c >= '0') && (*c <= '9')) {
+			hasDigits = true;
+			if (numSignificantDigits < 19) {
+				mantissa = mantissa * 10 + (*c - '0');
+				if (mantissa > 0)
+					numSignificantDigits++;
+				exponent--;
+			}
+			else
+				isMantissaExact = false;
+			c++;
+		}
+	}
+	if (!hasDigits || ((c < limit) && ((*c == 'x') || (*c == 'X'))))
+		return parseWithLibrary(start, limit, value, NULL);
+
+	/* The exponent is only part of the number if at least one digit follows the e */
+	if ((c < limit) && ((*c == 'e') || (*c == 'E'))) {
+		const char *exponentChar = c + 1;
+		bool isExponentNegative = false;
+		if ((exponentChar < limit) && ((*exponentChar == '-') || (*exponentChar == '+'))) {
+			isExponentNegative = (*exponentChar == '-');
+			exponentChar++;
+		}
+		if ((exponentChar < limit) && (*exponentChar >= '0') && (*exponentChar <= '9')) {
+			int exponentValue = 0;
+			while ((exponentChar < limit) && (*exponentChar >= '0') && (*exponentChar <= '9')) {
+				if (exponentValue < 100000)
+					exponentValue = exponentValue * 10 + (*exponentChar - '0');
+				exponentChar++;
+			}
+			exponent += isExponentNegative ? -exponentValue : exponentValue;
+			c = exponentChar;
+		}
+	}
+
+#if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0)
+	if (isMantissaExact && (mantissa <= ((uint64_t) 1 << 53)) && (exponent >= -22) && (exponent <= 22)) {
+		double result = (double) mantissa;
+		if (exponent >= 0)
+			result *= POWERS_OF_TEN[exponent];
+		else
+			result /= POWERS_OF_TEN[-exponent];
+		*value = isNegative ? -result : result;
+		return c;
+	}
+#endif
+	return parseWithLibrary(start, limit, value, NULL);
+} /* end parseDouble */
+
+/** \brief parseLong parses a decimal integer at the start of the characters, giving the same value and end as strtol with base 10
+ *
+ * \param start a pointer to the first character of the number
+ * \param limit a pointer just past the last character that may be read
+ * \param value a pointer to the long to store the number in
+ * \return a pointer just past the number, or start if there is no number to convert
+ **/
+const char *InputReader::parseLong(const char *start, const char *limit, long *value) {
+	const char *c = start;
+	bool isNegative = false;
+	if ((c < limit) && ((*c == '-') || (*c == '+'))) {
+		isNegative = (*c == '-');
+		c++;
+	}
+	const char *firstDigit = c;
+	const int maxExactDigits = (sizeof(long) >= 8) ? 18 : 9;
+	long result = 0;
+	while ((c < limit) && (*c >= '0') && (*c <= '9')) {
+		/* Leave numbers that might not fit in a long to strtol, which saturates them */
+		if (c - firstDigit >= maxExactDigits)
+			return parseWithLibrary(start, limit, NULL, value);
+		result = result * 10 + (*c - '0');
+		c++;
+	}
+	if (c == firstDigit)
+		return start;
+	*value = isNegative ? -result : result;
+	return c;
+} /* end parseLong */
+
+/** \brief parseWithLibrary converts the number at the start of the characters with strtod or strtol
+ *
+ * The file contents are not null terminated, so the token is first copied to a buffer
+ *
+ * \param start a pointer to the first character of the number
+ * \param limit a pointer just past the last character that may be read
+ * \param doubleValue a pointer to the double to store the number in, or NULL to convert it with strtol
+ * \param longValue a pointer to the long to store the number in if doubleValue is NULL
+ * \return a pointer just past the number, or start if there is no number to convert
+ **/
+const char *InputReader::parseWithLibrary(const char *start, const char *limit, double *doubleValue, long *longValue) {
+	char buffer[MAX_TOKEN_LENGTH + 1];
+	int tokenLength = 0;
+	while ((start + tokenLength < limit) && (tokenLength < MAX_TOKEN_LENGTH) && !isWhitespace(start[tokenLength]))
+		tokenLength++;
+	memcpy(buffer, start, tokenLength);
+	buffer[tokenLength] = '\0';
+	char *end;
+	if (doubleValue != NULL)
+		*doubleValue = strtod(buffer, &end);
+	else
+		*longValue = strtol(buffer, &end, 10);
+	return start + (end - buffer);
+} /* end parseWithLibrary */
+
+/** \brief skipPast moves the read position just past the next token that matches the search string
+ *
+ * Matches the result of reading tokens with fscanf and %512s until one matches: the search string is not found if it
+ * only occurs as the last characters of the file after other tokens, since fscanf reaches the end of the file reading it.
+ *
+ * \param searchStr a pointer to a character array representing the token to search for
+ * \return false if the search string was not found, in which case the read position is moved to the end of the file
+ **/
+bool InputReader::skipPast(const char *searchStr) {
+	long searchLength = (long) strlen(searchStr);
+
+	/* Labels are almost always the next token, compare it directly */
+	skipWhitespace();
+	long firstTokenStart = pos;
+	long firstTokenEnd = getTokenEnd(pos, MAX_TOKEN_LENGTH);
+	if ((firstTokenStart < length) && (firstTokenEnd - firstTokenStart == searchLength) &&
+			(memcmp(data + firstTokenStart, searchStr, searchLength) == 0)) {
+		pos = firstTokenEnd;
+		return true;
+	}
+
+	/* Otherwise find the next occurrence after the first token in the index */
+	const unordered_map<string, vector<long> > &index = getTokenIndex();
+	unordered_map<string, vector<long> >::const_iterator occurrences = index.find(string(searchStr, searchLength));
+	if (occurrences != index.end()) {
+		vector<long>::const_iterator next = upper_bound(occurrences->second.begin(), occurrences->second.end(), firstTokenStart);
+		if ((next != occurrences->second.end()) && (*next + searchLength < length)) {
+			pos = *next + searchLength;
+			return true;
+		}
+	}
+	pos = length;
+	numFailedSearches++;
+	return false;
+} /* end skipPast */
+
+/** \brief getLineNumber returns the line of the file the given offset is on, counting from 1
+ *
+ * \param position a long representing an offset in the file
+ **/
+int InputReader::getLineNumber(long position) {
+	int lineNumber = 1;
+	const char *next = data;
+	const char *limit = data + min(position, length);
+	while ((next < limit) && ((next = (const char *) memchr(next, '\n', limit - next)) != NULL)) {
+		lineNumber++;
+		next++;
+	}
+	return lineNumber;
+} /* end getLineNumber */
+
+/** \brief recordBadValue records that scan found characters that are not a number where a number was expected,
+ * counting each such value once even if several conversions fail on it */
+void InputReader::recordBadValue() {
+	if ((numBadValues > 0) && (pos == lastBadValuePosition))
+		return;
+	if (numBadValues == 0)
+		firstBadValuePosition = pos;
+	lastBadValuePosition = pos;
+	numBadValues++;
+} /* end recordBadValue */
+
+/** \brief isAtLineEnd moves the read position past any spaces and tabs and returns true if it is then at the end of a line
+ *
+ * \return true if the next character is a line break or the end of the file has been reached
+ **/
+bool InputReader::isAtLineEnd() {
+	while ((pos < length) && ((data[pos] == ' ') || (data[pos] == '\t')))
+		pos++;
+	return (pos >= length) || (data[pos] == '\n') || (data[pos] == '\r');
+} /* end isAtLineEnd */
+
+/** \brief buildTokenIndex records the offsets of every token of the file, split as fscanf with %512s splits them */
+void InputReader::buildTokenIndex() {
+	long tokenStart = 0;
+	while (true) {
+		while ((tokenStart < length) && isWhitespace(data[tokenStart]))
+			tokenStart++;
+		if (tokenStart >= length)
+			break;
+		long tokenEnd = getTokenEnd(tokenStart, MAX_TOKEN_LENGTH);
+		tokenIndex[string(data + tokenStart, tokenEnd - tokenStart)].push_back(tokenStart);
+		tokenStart = tokenEnd;
+	}
+	isTokenIndexBuilt = true;
+} /* end buildTokenIndex */
+
+/** \brief getTokenIndex returns the token index of the file, building it if needed; a view uses the index of its source */
+const unordered_map<string, vector<long> > &InputReader::getTokenIndex() {
+	InputReader *source = (viewSource != NULL) ? viewSource : this;
+	lock_guard<mutex> lock(source->tokenIndexMutex);
+	if (!source->isTokenIndexBuilt)
+		source->buildTokenIndex();
+	return source->tokenIndex;
+} /* end getTokenIndex */
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "include.h"
+
+/** Lets gcc and clang check the conversions of calls to InputReader::scan against the types of their arguments, as for fscanf */
+#if defined(__GNUC__)
+	#define INPUT_READER_SCAN_FORMAT __attribute__((format(scanf, 2, 3)))
+#else
+	#define INPUT_READER_SCAN_FORMAT
+#endif
+
+/**
+	InputReader holds the whole of an input file in memory and reads the inputs from it the way fscanf reads them
+	from a file, so the file is read from disk once instead of one token at a time.  On Linux and Mac the file is
+	mapped into memory with mmap and read in place.  scan supports the conversions used by SimContext (%d, %ld, %lf,
+	%f and %s with a width) and parses numbers directly from the file contents, giving the same values as fscanf.
+	skipPast moves past the next occurrence of a label: it compares the next token directly, and only if the label is
+	not the next token looks up its next occurrence in an index of all the tokens of the file, which is built the
+	first time it is needed.  A reader opened with openView reads the contents of another reader from a given offset and
+	shares its token index, so several parts of one file can be read at once by different threads.
+*/
+class InputReader
+{
+public:
+	/* Constructor and Destructor */
+	InputReader(void);
+	~InputReader(void);
+
+	/* Functions to load the input file and read from it */
+	bool open(const char *fileName);
+	void openContents(string *contents);
+	void close();
+	int scan(const char *format, ...) INPUT_READER_SCAN_FORMAT;
+	bool skipPast(const char *searchStr);
+	bool isAtLineEnd();
+	void setPosition(long position);
+	const char *getContents();
+	long getLength();
+
+	/* Functions to read part of the file from another thread, see openView */
+	void openView(InputReader *source, long position);
+	long findToken(const char *token, long afterPosition);
+	long getPosition();
+	bool isView();
+	int getNumFailedSearches();
+
+	/* Functions to locate problems in the file, for reporting them */
+	int getLineNumber(long position);
+	int getNumBadValues();
+	long getFirstBadValuePosition();
+
+	/* Functions to parse a number at the start of a character array, as strtod and strtol do, used by scan */
+	static const char *parseDouble(const char *start, const char *limit, double *value);
+	static const char *parseLong(const char *start, const char *limit, long *value);
+
+	/** Maximum length of a token compared by skipPast, longer tokens are split as fscanf with %512s splits them */
+	static const int MAX_TOKEN_LENGTH = 512;
+
+private:
+	/** Contents of the input file, either mapped into memory or read into fileContents, and the offset of the next character to be read */
+	const char *data;
+	long length;
+	long pos;
+	bool isMapped;
+	string fileContents;
+	/** Offsets of every occurrence of each token in the file, in increasing order, built by buildTokenIndex */
+	bool isTokenIndexBuilt;
+	unordered_map<string, vector<long> > tokenIndex;
+	/** The reader whose contents and token index a view reads, NULL if this reader loaded the file itself */
+	InputReader *viewSource;
+	/** Number of calls to skipPast that did not find their search string */
+	int numFailedSearches;
+	/** Number of values scan found that were not numbers where numbers were expected, and the offsets of the first and last */
+	int numBadValues;
+	long firstBadValuePosition;
+	long lastBadValuePosition;
+	/** Held while the token index is built, since the views of a reader may need it at the same time */
+	mutex tokenIndexMutex;
+
+	/* Functions to find and index the tokens of the file */
+	void skipWhitespace();
+	long getTokenEnd(long start, long maxLength);
+	void buildTokenIndex();
+	const unordered_map<string, vector<long> > &getTokenIndex();
+	void recordBadValue();
+	static bool isWhitespace(char c);
+	static const char *parseWithLibrary(const char *start, const char *limit, double *doubleValue, long *longValue);
+};
+
+/** \brief isWhitespace returns true for the characters that fscanf treats as whitespace in the C locale */
+inline bool InputReader::isWhitespace(char c) {
+	return (c == ' ') || (c == '\n') || (c == '\r') || (c == '\t') || (c == '\v') || (c == '\f');
+}
+
+/** \brief skipWhitespace moves the read position past any whitespace */
+inline void InputReader::skipWhitespace() {
+	while ((pos < length) && isWhitespace(data[pos]))
+		pos++;
+}
+
+/** \brief getTokenEnd returns the offset just past the token starting at the given offset
+ * \param start a long representing the offset of the first character of the token
+ * \param maxLength a long representing the most characters to take, or 0 for no limit
+ **/
+inline long InputReader::getTokenEnd(long start, long maxLength) {
+	long limit = length;
+	if ((maxLength > 0) && (start + maxLength < limit))
+		limit = start + maxLength;
+	long end = start;
+	while ((end < limit) && !isWhitespace(data[end]))
+		end++;
+	return end;
+}
+
+/** \brief getPosition returns the offset of the next character to be read */
+inline long InputReader::getPosition() {
+	return pos;
+}
+
+/** \brief setPosition moves the read position to the given offset */
+inline void InputReader::setPosition(long position) {
+	pos = position;
+}
+
+/** \brief getContents returns the contents of the file, which are not null terminated */
+inline const char *InputReader::getContents() {
+	return data;
+}
+
+/** \brief getLength returns the number of characters in the file */
+inline long InputReader::getLength() {
+	return length;
+}
+
+/** \brief isView returns true if the reader was opened with openView */
+inline bool InputReader::isView() {
+	return (viewSource != NULL);
+}
+
+/** \brief getNumFailedSearches returns the number of calls to skipPast that did not find their search string */
+inline int InputReader::getNumFailedSearches() {
+	return numFailedSearches;
+}
+
+/** \brief getNumBadValues returns the number of values scan could not convert since they were not numbers */
+inline int InputReader::getNumBadValues() {
+	return numBadValues;
+}
+
+/** \brief getFirstBadValuePosition returns the offset of the first value scan could not convert, or -1 if there was none */
+inline long InputReader::getFirstBadValuePosition() {
+	return firstBadValuePosition;
+}
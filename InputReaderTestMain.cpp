@@ -0,0 +1,280 @@
+// InputReaderTestMain.cpp : Defines the main entry point for cepac-input-reader-test, which checks and times the number parsing of InputReader
+//
+
+#include "include.h"
+
+/** Number of lines of the generated input file, and the number of values after the label on each line */
+static const int NUM_GENERATED_LINES = 50000;
+static const int NUM_VALUES_PER_LINE = 10;
+/** Number of times the generated file is parsed by each method for the benchmark */
+static const int NUM_BENCHMARK_REPEATS = 5;
+
+/** Numbers that are hard to round or that parseDouble hands to strtod, and tokens that are only partly numbers */
+static const char *EDGE_CASE_TOKENS[] = {"0", "-0", "+0.0", "0.1", "-.5", "5.", ".25", "007.5", "1e22", "1e23", "1e-22",
+	"1e-23", "9007199254740992", "9007199254740993", "123456789012345678", "1234567890123456789", "12345678901234567890",
+	"0.30000000000000004", "2.2250738585072014e-308", "4.9e-324", "1.7976931348623157e308", "1e400", "-1e400", "1e-400",
+	"0.0000000000000000000000000000001", "00000000000000000000001.5", "1e99999999999", "0e99999", "0x1p3", "0X1A",
+	"inf", "-Infinity", "nan", "1e", "1e+", "1.5e-", ".", "-", "+", "e5", "123abc", "1,5", "--1"};
+
+/** \brief appendRandomNumber appends a number in one of the forms found in input files to the string
+ *
+ * The forms include fixed point with few and many decimals, the shortest and full precision %g forms, exponents,
+ * integers, and numbers with a leading plus sign or zeros, so both the fast path of parseDouble and strtod are used
+ **/
+static void appendRandomNumber(MTRand_int32 &generator, string *contents) {
+	char buffer[64];
+	double magnitude = pow(10.0, (int) (generator() % 61) - 30);
+	double value = ((double) generator() + (double) generator() / 4294967296.0) / 4294967296.0 * magnitude;
+	if (generator() % 4 == 0)
+		value = -value;
+	switch (generator() % 8) {
+		case 0:
+			snprintf(buffer, sizeof(buffer), "%.*f", (int) (generator() % 7), fmod(value, 1e6));
+			break;
+		case 1:
+			snprintf(buffer, sizeof(buffer), "%.*f", (int) (generator() % 20), fmod(value, 1e3));
+			break;
+		case 2:
+			snprintf(buffer, sizeof(buffer), "%.*g", 1 + (int) (generator() % 20), value);
+			break;
+		case 3:
+			snprintf(buffer, sizeof(buffer), "%.17g", value);
+			break;
+		case 4:
+			snprintf(buffer, sizeof(buffer), "%.*e", (int) (generator() % 18), value);
+			break;
+		case 5:
+			snprintf(buffer, sizeof(buffer), "%ld", (long) (generator() % 1000000) - 500000);
+			break;
+		case 6:
+			snprintf(buffer, sizeof(buffer), "+%.*f", (int) (generator() % 10), fabs(fmod(value, 1e4)));
+			break;
+		default:
+			snprintf(buffer, sizeof(buffer), "%0*.*f", 12, (int) (generator() % 6), fabs(fmod(value, 1e4)));
+			break;
+	}
+	contents->append(buffer);
+} /* end appendRandomNumber */
+
+/** \brief generateInputFile returns the contents of an input file of labelled lines of numbers, from a fixed seed */
+static string generateInputFile() {
+	MTRand_int32 generator(20240101UL);
+	string contents;
+	char label[32];
+	for (int lineNum = 0; lineNum < NUM_GENERATED_LINES; lineNum++) {
+		snprintf(label, sizeof(label), "Value%d", lineNum);
+		contents.append(label);
+		for (int i = 0; i < NUM_VALUES_PER_LINE; i++) {
+			contents.append((i == 0) ? "\t" : " ");
+			appendRandomNumber(generator, &contents);
+		}
+		contents.append((lineNum % 2 == 0) ? "\r\n" : "\n");
+	}
+	return contents;
+} /* end generateInputFile */
+
+/** \brief openTempFile returns a temporary file holding the contents, positioned at its start for fscanf */
+static FILE *openTempFile(const string &contents) {
+	FILE *file = tmpfile();
+	if (file == NULL)
+		return NULL;
+	fwrite(contents.data(), 1, contents.size(), file);
+	rewind(file);
+	return file;
+} /* end openTempFile */
+
+/** \brief checkGeneratedFile reads every label and value of the generated file with InputReader::scan and with fscanf,
+ * and checks that the values are identical bit for bit and that both stop at the same offset after each value
+ *
+ * \return true if the check passed
+ **/
+static bool checkGeneratedFile(const string &contents) {
+	FILE *file = openTempFile(contents);
+	if (file == NULL) {
+		printf("   ERROR - Could not create a temporary file\n");
+		return false;
+	}
+	string readerContents = contents;
+	InputReader reader;
+	reader.openContents(&readerContents);
+
+	int numValues = 0;
+	int numMismatches = 0;
+	bool isInStep = true;
+	char readerLabel[256], fileLabel[256];
+	while (isInStep) {
+		int readerResult = reader.scan("%255s", readerLabel);
+		int fileResult = fscanf(file, "%255s", fileLabel);
+		if ((readerResult != fileResult) || ((readerResult == 1) && (strcmp(readerLabel, fileLabel) != 0))) {
+			printf("   ERROR - The labels differ after %d values\n", numValues);
+			numMismatches++;
+			break;
+		}
+		if (readerResult != 1)
+			break;
+		for (int i = 0; (i < NUM_VALUES_PER_LINE) && isInStep; i++) {
+			double readerValue = 0, fileValue = 0;
+			readerResult = reader.scan("%lf", &readerValue);
+			fileResult = fscanf(file, "%lf", &fileValue);
+			numValues++;
+			/** Once the readers stop at different offsets the later values cannot be compared */
+			isInStep = (readerResult == fileResult) && (reader.getPosition() == ftell(file));
+			if (!isInStep || (memcmp(&readerValue, &fileValue, sizeof(double)) != 0)) {
+				numMismatches++;
+				if (numMismatches <= 20) {
+					long end = reader.getPosition();
+					long start = end;
+					while ((start > 0) && !isspace((unsigned char) contents[start - 1]))
+						start--;
+					printf("   ERROR - %s value %d \"%s\": InputReader %.17g, fscanf %.17g\n", readerLabel, i,
+						contents.substr(start, end - start).c_str(), readerValue, fileValue);
+				}
+			}
+		}
+	}
+	fclose(file);
+	printf("Generated file: %d values compared with fscanf, %d differ\n", numValues, numMismatches);
+	return (numMismatches == 0) && (numValues == NUM_GENERATED_LINES * NUM_VALUES_PER_LINE);
+} /* end checkGeneratedFile */
+
+/** \brief checkToken checks that InputReader::parseDouble gives the same value bit for bit and the same end as strtod for a token
+ *
+ * \return true if they match
+ **/
+static bool checkToken(const char *token, const char *context) {
+	size_t tokenLength = strlen(token);
+	double parsedValue = 0;
+	const char *parsedEnd = InputReader::parseDouble(token, token + tokenLength, &parsedValue);
+	char *libraryEnd;
+	double libraryValue = strtod(token, &libraryEnd);
+	bool isConverted = (parsedEnd != token);
+	if ((parsedEnd != libraryEnd) || (isConverted && (memcmp(&parsedValue, &libraryValue, sizeof(double)) != 0))) {
+		printf("   ERROR - %s \"%s\": parseDouble %.17g using %d characters, strtod %.17g using %d characters\n", context,
+			token, parsedValue, (int) (parsedEnd - token), libraryValue, (int) (libraryEnd - token));
+		return false;
+	}
+	return true;
+} /* end checkToken */
+
+/** \brief checkEdgeCases checks parseDouble against strtod for the EDGE_CASE_TOKENS
+ *
+ * \return true if the check passed
+ **/
+static bool checkEdgeCases() {
+	int numTokens = (int) (sizeof(EDGE_CASE_TOKENS) / sizeof(EDGE_CASE_TOKENS[0]));
+	int numMismatches = 0;
+	for (int i = 0; i < numTokens; i++) {
+		if (!checkToken(EDGE_CASE_TOKENS[i], "edge case"))
+			numMismatches++;
+	}
+	printf("Edge cases: %d tokens compared with strtod, %d differ\n", numTokens, numMismatches);
+	return (numMismatches == 0);
+} /* end checkEdgeCases */
+
+/** \brief checkInputFile checks parseDouble against strtod for every token of an input file
+ *
+ * \return true if the check passed
+ **/
+static bool checkInputFile(const char *fileName) {
+	InputReader reader;
+	if (!reader.open(fileName)) {
+		printf("   ERROR - Could not open %s\n", fileName);
+		return false;
+	}
+	int numTokens = 0;
+	int numMismatches = 0;
+	char token[InputReader::MAX_TOKEN_LENGTH + 1];
+	while (reader.scan("%512s", token) == 1) {
+		numTokens++;
+		if (!checkToken(token, fileName))
+			numMismatches++;
+	}
+	printf("%s: %d tokens compared with strtod, %d differ\n", fileName, numTokens, numMismatches);
+	return (numMismatches == 0);
+} /* end checkInputFile */
+
+/** \brief benchmarkParsing times reading every value of the generated file with InputReader::scan, fscanf and strtod,
+ * taking the fastest of NUM_BENCHMARK_REPEATS passes of each */
+static void benchmarkParsing(const string &contents) {
+	int numValues = NUM_GENERATED_LINES * NUM_VALUES_PER_LINE;
+	double bestSeconds[3] = {1e30, 1e30, 1e30};
+	const char *methodNames[3] = {"InputReader::scan", "fscanf", "strtod"};
+	double checksums[3] = {0, 0, 0};
+	char label[256];
+	double value;
+	for (int repeat = 0; repeat < NUM_BENCHMARK_REPEATS; repeat++) {
+		/** InputReader reads the file contents in memory, as it does once the file is mapped */
+		string readerContents = contents;
+		InputReader reader;
+		reader.openContents(&readerContents);
+		chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+		while (reader.scan("%255s", label) == 1) {
+			for (int i = 0; i < NUM_VALUES_PER_LINE; i++) {
+				reader.scan("%lf", &value);
+				checksums[0] += value;
+			}
+		}
+		bestSeconds[0] = min(bestSeconds[0], chrono::duration<double>(chrono::steady_clock::now() - startTime).count());
+
+		FILE *file = openTempFile(contents);
+		if (file == NULL)
+			return;
+		startTime = chrono::steady_clock::now();
+		while (fscanf(file, "%255s", label) == 1) {
+			for (int i = 0; i < NUM_VALUES_PER_LINE; i++) {
+				if (fscanf(file, "%lf", &value) == 1)
+					checksums[1] += value;
+			}
+		}
+		bestSeconds[1] = min(bestSeconds[1], chrono::duration<double>(chrono::steady_clock::now() - startTime).count());
+		fclose(file);
+
+		/** strtod alone, on the null terminated contents, is the least any parser built on it could take */
+		startTime = chrono::steady_clock::now();
+		const char *next = contents.c_str();
+		while (*next != '\0') {
+			while (isspace((unsigned char) *next))
+				next++;
+			while ((*next != '\0') && !isspace((unsigned char) *next))
+				next++;
+			for (int i = 0; i < NUM_VALUES_PER_LINE; i++) {
+				char *end;
+				checksums[2] += strtod(next, &end);
+				next = end;
+			}
+			while (isspace((unsigned char) *next))
+				next++;
+		}
+		bestSeconds[2] = min(bestSeconds[2], chrono::duration<double>(chrono::steady_clock::now() - startTime).count());
+	}
+
+	printf("Parsing %d values (%.1f MB), fastest of %d passes:\n", numValues, contents.size() / 1e6, NUM_BENCHMARK_REPEATS);
+	for (int i = 0; i < 3; i++) {
+		printf("   %-18s %8.1f ms  %6.1f ns/value  %6.1f MB/s  (checksum %.6g)\n", methodNames[i], bestSeconds[i] * 1e3,
+			bestSeconds[i] * 1e9 / numValues, contents.size() / 1e6 / bestSeconds[i], checksums[i] / NUM_BENCHMARK_REPEATS);
+	}
+} /* end benchmarkParsing */
+
+/** \brief Main function for cepac-input-reader-test, optionally run with input files whose tokens are also checked;
+ * returns 1 if InputReader parses any number differently from fscanf or strtod */
+int main(int argc, char *argv[]) {
+	/** parseDouble only takes its fast path when doubles are evaluated in double precision, see InputReader::parseDouble */
+#if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0)
+	printf("FLT_EVAL_METHOD is 0, parseDouble uses its fast path\n");
+#else
+	printf("FLT_EVAL_METHOD is not 0, parseDouble converts every number with strtod\n");
+#endif
+
+	string contents = generateInputFile();
+	bool isValid = checkGeneratedFile(contents);
+	if (!checkEdgeCases())
+		isValid = false;
+	for (int i = 1; i < argc; i++) {
+		if (!checkInputFile(argv[i]))
+			isValid = false;
+	}
+	benchmarkParsing(contents);
+
+	printf("%s\n", isValid ? "All checks passed" : "Some checks FAILED");
+	return isValid ? 0 : 1;
+} /* end main */
@@ -0,0 +1,378 @@
+#include "include.h"
+
+/** Largest difference from 1 allowed for the sum of a distribution, or the end of a cumulative distribution */
+const double InputValidator::DISTRIBUTION_SUM_TOLERANCE = 0.001;
+
+/** \brief Constructor takes in the SimContext whose inputs are checked, once they have been read
+ *
+ * \param simContext a pointer to the SimContext holding the inputs
+ **/
+InputValidator::InputValidator(SimContext *simContext) {
+	this->simContext = simContext;
+	isInputFileOpen = false;
+} /* end Constructor */
+
+/** \brief Destructor closes the input files opened to look up the lines of labels */
+InputValidator::~InputValidator(void) {
+	inputFile.close();
+	baseInputFile.close();
+} /* end Destructor */
+
+/** \brief validateInputs checks the inputs, recording the issues and warnings found
+ *
+ * The labels that were missing and the values that were not numbers when the inputs were read are issues too; if a
+ * label was missing, the inputs after it were not read, so the values are not checked.  The inputs of the TB and Peds
+ * tabs are only checked if those modules are enabled, since they are not read otherwise
+ *
+ * \return true if there were no issues with the inputs, there may be warnings
+ **/
+bool InputValidator::validateInputs() {
+	issues = simContext->getInputIssues();
+	for (unsigned int i = 0; i < issues.size(); i++) {
+		if (issues[i].isLabelMissing)
+			return false;
+	}
+	validateCohortInputs();
+	validateTreatmentInputs();
+	if (simContext->getHIVTestInputs()->enableHIVTesting)
+		validateHIVTestInputs();
+	if (simContext->isTBEnabled())
+		validateTBInputs();
+	if (simContext->isPedsModelEnabled())
+		validatePedsInputs();
+	return issues.empty();
+} /* end validateInputs */
+
+/** \brief getNumIssues returns the number of issues found by validateInputs */
+int InputValidator::getNumIssues() {
+	return issues.size();
+} /* end getNumIssues */
+
+/** \brief printIssues prints the issues found by validateInputs, one per line as file:line: label: message */
+void InputValidator::printIssues() {
+	if (!simContext->getInputIssues().empty())
+		printf("\n");
+	printf("   ERROR - Inputs of %s are not valid, %d issue%s found:\n", simContext->getRunSpecsInputs()->runName.c_str(),
+		getNumIssues(), (getNumIssues() == 1) ? "" : "s");
+	printIssueList(issues);
+} /* end printIssues */
+
+/** \brief getNumWarnings returns the number of warnings found by validateInputs */
+int InputValidator::getNumWarnings() {
+	return warnings.size();
+} /* end getNumWarnings */
+
+/** \brief printWarnings prints the warnings found by validateInputs, if any, in the same form as the issues */
+void InputValidator::printWarnings() {
+	if (warnings.empty())
+		return;
+	printf("   WARNING - Inputs of %s may not be as intended, %d warning%s found:\n", simContext->getRunSpecsInputs()->runName.c_str(),
+		getNumWarnings(), (getNumWarnings() == 1) ? "" : "s");
+	printIssueList(warnings);
+} /* end printWarnings */
+
+/** \brief printIssueList prints a list of issues or warnings, one per line as file:line: label: message */
+void InputValidator::printIssueList(const vector<SimContext::InputIssue> &issueList) {
+	for (unsigned int i = 0; i < issueList.size(); i++) {
+		const SimContext::InputIssue &issue = issueList[i];
+		if (issue.lineNumber > 0)
+			printf("      %s:%d: %s: %s\n", issue.fileName.c_str(), issue.lineNumber, issue.label.c_str(), issue.message.c_str());
+		else
+			printf("      %s: %s: %s\n", issue.fileName.c_str(), issue.label.c_str(), issue.message.c_str());
+	}
+} /* end printIssueList */
+
+/** \brief validateInputFiles reads and checks the inputs of every input file to run, or of every draw of a PSA, without
+ * simulating them, printing the issues found
+ *
+ * \param psaDriver a pointer to the PSADriver whose draws are checked, or NULL to check the files of CepacUtil::filesToRun
+ * \return true if the inputs of every file or draw were read and had no issues
+ **/
+bool InputValidator::validateInputFiles(PSADriver *psaDriver) {
+	bool areAllValid = true;
+	int numFiles = (psaDriver != NULL) ? psaDriver->getNumDraws() : CepacUtil::filesToRun.size();
+	for (int i = 0; i < numFiles; i++) {
+		string inputFileName;
+		string runName;
+		if (psaDriver != NULL) {
+			runName = psaDriver->getDrawName(i);
+			inputFileName = psaDriver->getPSAFileName();
+		}
+		else {
+			inputFileName = CepacUtil::filesToRun[i];
+			runName = CepacUtil::getRunName(inputFileName);
+		}
+
+		SimContext *simContext = new SimContext(runName, inputFileName);
+		try {
+			if (psaDriver != NULL)
+				psaDriver->readDrawInputs(i, simContext);
+			else
+				simContext->readInputs();
+			InputValidator inputValidator(simContext);
+			bool isValid = inputValidator.validateInputs();
+			inputValidator.printWarnings();
+			if (isValid) {
+				printf("Inputs of %s are valid\n", runName.c_str());
+			}
+			else {
+				inputValidator.printIssues();
+				areAllValid = false;
+			}
+		}
+		catch (string &errorString) {
+			printf("%s\n", errorString.c_str());
+			areAllValid = false;
+		}
+		delete simContext;
+	}
+	return areAllValid;
+} /* end validateInputFiles */
+
+/** \brief validateCohortInputs checks the initial CD4, HVL, age, gender and OI history inputs of the Cohort tab */
+void InputValidator::validateCohortInputs() {
+	const SimContext::CohortInputs *cohortInputs = simContext->getCohortInputs();
+
+	checkNonNegative("InitCD4", NULL, &cohortInputs->initialCD4Mean, 1);
+	checkNonNegative("InitCD4", NULL, &cohortInputs->initialCD4StdDev, 1);
+	for (int j = SimContext::CD4_NUM_STRATA - 1; j >= 0; --j)
+		checkDistribution("InitHVL", SimContext::CD4_STRATA_STRS[j], cohortInputs->initialHVLDistribution[j], SimContext::HVL_NUM_STRATA);
+	if (cohortInputs->useCustomAgeDist)
+		checkCumulativeDistribution("AgeStratProbs", NULL, cohortInputs->ageProbs, SimContext::INIT_AGE_NUM_STRATA);
+	checkProbabilities("InitGender", NULL, &cohortInputs->maleGenderDistribution, 1);
+	checkProbabilities("ProphNonCompliance", NULL, &cohortInputs->OIProphNonComplianceRisk, 1);
+	checkPartialDistribution("PatClinicTypes", NULL, cohortInputs->clinicVisitTypeDistribution, SimContext::CLINIC_VISITS_NUM);
+	checkPartialDistribution("PatTreatmentTypes", NULL, cohortInputs->therapyImplementationDistribution, SimContext::THERAPY_IMPL_NUM);
+	checkPartialDistribution("PatCD4ResponeTypeOnART", NULL, cohortInputs->CD4ResponseTypeOnARTDistribution, SimContext::CD4_RESPONSE_NUM_TYPES);
+	for (int i = 0; i < SimContext::OI_NUM; ++i) {
+		for (int k = SimContext::HVL_NUM_STRATA - 1; k >= 0; --k) {
+			for (int j = SimContext::CD4_NUM_STRATA - 1; j >= 0; --j) {
+				double probOIHistory = cohortInputs->probOIHistoryAtEntry[j][k][i];
+				if ((probOIHistory < 0) || (probOIHistory > 1)) {
+					char message[256];
+					sprintf(message, "probability %g for %s, HVL %s, CD4 %s is not between 0 and 1", probOIHistory,
+						simContext->OI_STRS[i], SimContext::HVL_STRATA_STRS[k], SimContext::CD4_STRATA_STRS[j]);
+					addIssue("PriorOIHistAtEntry", NULL, message);
+				}
+			}
+		}
+	}
+	checkProbabilities("ProbRiskFactorPrev", NULL, cohortInputs->probRiskFactorPrev, SimContext::RISK_FACT_NUM);
+	checkProbabilities("ProbRiskFactorIncid", NULL, cohortInputs->probRiskFactorIncid, SimContext::RISK_FACT_NUM);
+} /* end validateCohortInputs */
+
+/** \brief validateTreatmentInputs checks the probabilities of detecting OI history of the Treatment tab */
+void InputValidator::validateTreatmentInputs() {
+	const SimContext::TreatmentInputs *treatmentInputs = simContext->getTreatmentInputs();
+
+	checkProbabilities("ProbDetOI_Entry", NULL, treatmentInputs->probDetectOIAtEntry, SimContext::OI_NUM);
+	checkProbabilities("ProbDetOI_LastVst", NULL, treatmentInputs->probDetectOISinceLastVisit, SimContext::OI_NUM);
+} /* end validateTreatmentInputs */
+
+/** \brief validateHIVTestInputs checks the initial HIV state, risk and HVL distributions of the HIVTest tab */
+void InputValidator::validateHIVTestInputs() {
+	const SimContext::HIVTestInputs *testingInputs = simContext->getHIVTestInputs();
+
+	checkDistribution("HIVdistNeg", NULL, testingInputs->initialHIVDistribution, SimContext::HIV_INF_NUM);
+	checkDistribution("HIVNegRiskDist", NULL, testingInputs->initialRiskDistribution, SimContext::HIV_BEHAV_NUM);
+	checkDistribution("HIVacuteHVLdist", NULL, testingInputs->initialAcuteHVLDistribution[0], SimContext::HVL_NUM_STRATA);
+	for (int i = SimContext::HVL_NUM_STRATA - 1; i >= 0; --i)
+		checkDistribution("HVLDistribAtChrHIVTrans", SimContext::HVL_STRATA_STRS[i], testingInputs->HVLDistributionAtChronicHIV[i], SimContext::HVL_NUM_STRATA);
+} /* end validateHIVTestInputs */
+
+/** \brief validateTBInputs checks the TB state and strain distributions at entry and the TB incidence of the TB tab */
+void InputValidator::validateTBInputs() {
+	const SimContext::TBInputs *tbInputs = simContext->getTBInputs();
+
+	checkDistribution("ProbTB_Entry", "HIV_Neg", tbInputs->distributionTBStateAtEntryHIVNeg, SimContext::TB_NUM_STATES);
+	for (int i = SimContext::CD4_NUM_STRATA - 1; i >= 0; --i)
+		checkDistribution("ProbTB_Entry", SimContext::CD4_STRATA_STRS[i], tbInputs->distributionTBStateAtEntryHIVPos[i], SimContext::TB_NUM_STATES);
+	checkDistribution("DistTB_Entry_Strain", NULL, tbInputs->distributionTBStrainAtEntry, SimContext::TB_NUM_STRAINS);
+	checkProbabilities("ProbMthTBIncid", "HIV_Neg", tbInputs->probInfectionHIVNeg, SimContext::TB_INFECT_NUM_AGE_CAT);
+	for (int i = SimContext::CD4_NUM_STRATA - 1; i >= 0; --i)
+		checkProbabilities("ProbMthTBIncid", SimContext::CD4_STRATA_STRS[i], tbInputs->probInfectionHIVPos[i], SimContext::TB_INFECT_NUM_AGE_CAT);
+} /* end validateTBInputs */
+
+/** \brief validatePedsInputs checks the maternal status and breastfeeding inputs of the Peds tab */
+void InputValidator::validatePedsInputs() {
+	const SimContext::PedsInputs *pedsInputs = simContext->getPedsInputs();
+
+	checkDistribution("DistMatStat", NULL, pedsInputs->maternalStatusDistribution, SimContext::PEDS_MATERNAL_STATUS_NUM);
+	checkProbabilities("ProbInfectionMom", NULL, pedsInputs->probMotherIncidentInfection, SimContext::PEDS_MATERNAL_STATUS_NUM);
+	checkProbabilities("ProbMatMort", NULL, pedsInputs->probMaternalDeath, SimContext::PEDS_MATERNAL_STATUS_NUM);
+	checkPartialDistribution("BreastfedDist", NULL, pedsInputs->initialBFDistribution, SimContext::PEDS_BF_NUM);
+} /* end validatePedsInputs */
+
+/** \brief checkNonNegative records an issue if any of the values is negative
+ *
+ * \param label a pointer to a character array holding the label the values are read after
+ * \param subLabel a pointer to a character array holding the token after the label on its line, or NULL
+ * \param values a pointer to the values to check
+ * \param numValues the number of values
+ **/
+void InputValidator::checkNonNegative(const char *label, const char *subLabel, const double *values, int numValues) {
+	for (int i = 0; i < numValues; i++) {
+		if (values[i] < 0) {
+			char message[128];
+			if (numValues == 1)
+				sprintf(message, "value %g is negative", values[i]);
+			else
+				sprintf(message, "value %d of %d, %g, is negative", i + 1, numValues, values[i]);
+			addIssue(label, subLabel, message);
+		}
+	}
+} /* end checkNonNegative */
+
+/** \brief checkProbabilities records an issue if any of the values is not a probability between 0 and 1
+ *
+ * \param label a pointer to a character array holding the label the values are read after
+ * \param subLabel a pointer to a character array holding the token after the label on its line, or NULL
+ * \param values a pointer to the values to check
+ * \param numValues the number of values
+ **/
+void InputValidator::checkProbabilities(const char *label, const char *subLabel, const double *values, int numValues) {
+	for (int i = 0; i < numValues; i++) {
+		if ((values[i] < 0) || (values[i] > 1)) {
+			char message[128];
+			if (numValues == 1)
+				sprintf(message, "probability %g is not between 0 and 1", values[i]);
+			else
+				sprintf(message, "probability %d of %d, %g, is not between 0 and 1", i + 1, numValues, values[i]);
+			addIssue(label, subLabel, message);
+		}
+	}
+} /* end checkProbabilities */
+
+/** \brief checkDistribution records an issue if the values are not probabilities, and a warning if they do not sum to 1
+ *
+ * \param label a pointer to a character array holding the label the values are read after
+ * \param subLabel a pointer to a character array holding the token after the label on its line, or NULL
+ * \param values a pointer to the probabilities of the distribution
+ * \param numValues the number of probabilities
+ **/
+void InputValidator::checkDistribution(const char *label, const char *subLabel, const double *values, int numValues) {
+	int numIssues = issues.size();
+	checkProbabilities(label, subLabel, values, numValues);
+	if ((int) issues.size() > numIssues)
+		return;
+	double sum = 0;
+	for (int i = 0; i < numValues; i++)
+		sum += values[i];
+	if (fabs(sum - 1) > DISTRIBUTION_SUM_TOLERANCE) {
+		char message[128];
+		sprintf(message, "distribution sums to %g, not 1", sum);
+		addIssue(label, subLabel, message, true);
+	}
+} /* end checkDistribution */
+
+/** \brief checkPartialDistribution records an issue if the values are not probabilities, and a warning if they sum
+ * to more than 1, for distributions whose last probability is not an input but what remains of 1
+ *
+ * \param label a pointer to a character array holding the label the values are read after
+ * \param subLabel a pointer to a character array holding the token after the label on its line, or NULL
+ * \param values a pointer to the probabilities of the distribution, including the remainder
+ * \param numValues the number of probabilities, including the remainder
+ **/
+void InputValidator::checkPartialDistribution(const char *label, const char *subLabel, const double *values, int numValues) {
+	int numIssues = issues.size();
+	checkProbabilities(label, subLabel, values, numValues - 1);
+	if ((int) issues.size() > numIssues)
+		return;
+	double sum = 0;
+	for (int i = 0; i < numValues - 1; i++)
+		sum += values[i];
+	if (sum > 1 + DISTRIBUTION_SUM_TOLERANCE) {
+		char message[128];
+		sprintf(message, "probabilities sum to %g, more than 1", sum);
+		addIssue(label, subLabel, message, true);
+	}
+} /* end checkPartialDistribution */
+
+/** \brief checkCumulativeDistribution records an issue if the values, read as probabilities and summed into a
+ * cumulative distribution, do not increase from 0 to 1
+ *
+ * \param label a pointer to a character array holding the label the values are read after
+ * \param subLabel a pointer to a character array holding the token after the label on its line, or NULL
+ * \param values a pointer to the cumulative probabilities
+ * \param numValues the number of cumulative probabilities
+ **/
+void InputValidator::checkCumulativeDistribution(const char *label, const char *subLabel, const double *values, int numValues) {
+	for (int i = 0; i < numValues; i++) {
+		double prob = (i == 0) ? values[0] : values[i] - values[i - 1];
+		if ((prob < 0) || (prob > 1)) {
+			char message[128];
+			sprintf(message, "probability %d of %d, %g, is not between 0 and 1", i + 1, numValues, prob);
+			addIssue(label, subLabel, message);
+			return;
+		}
+	}
+	if (fabs(values[numValues - 1] - 1) > DISTRIBUTION_SUM_TOLERANCE) {
+		char message[128];
+		sprintf(message, "cumulative distribution ends at %g, not 1", values[numValues - 1]);
+		addIssue(label, subLabel, message);
+	}
+} /* end checkCumulativeDistribution */
+
+/** \brief addIssue records an issue or a warning with the values after a label, looking up the file and line of the label
+ *
+ * The input file is opened the first time an issue is found; for a scenario overlay or PSA file, the label is
+ * looked up in it first and then in its base input file
+ *
+ * \param label a pointer to a character array holding the label the values are read after
+ * \param subLabel a pointer to a character array holding the token after the label on its line, or NULL
+ * \param message a string describing the issue
+ * \param isWarning true if the run may still be simulated, false if it is an issue that stops it
+ **/
+void InputValidator::addIssue(const char *label, const char *subLabel, string message, bool isWarning) {
+	if (!isInputFileOpen) {
+		isInputFileOpen = true;
+		char buffer[InputReader::MAX_TOKEN_LENGTH + 1];
+		if (inputFile.open(simContext->getInputFileName().c_str()) && (inputFile.scan("%512s", buffer) == 1) &&
+				(strcmp(buffer, SimContext::OVERLAY_BASE_LABEL) == 0) && (inputFile.scan("%512s", buffer) == 1)) {
+			baseInputFileName = buffer;
+			baseInputFile.open(baseInputFileName.c_str());
+		}
+	}
+
+	SimContext::InputIssue issue;
+	issue.label = label;
+	if (subLabel != NULL) {
+		issue.label.append(" ");
+		issue.label.append(subLabel);
+	}
+	issue.fileName = simContext->getInputFileName();
+	issue.lineNumber = findLabelLine(&inputFile, label, subLabel);
+	if ((issue.lineNumber == 0) && !baseInputFileName.empty()) {
+		issue.fileName = baseInputFileName;
+		issue.lineNumber = findLabelLine(&baseInputFile, label, subLabel);
+	}
+	issue.message = message;
+	issue.isLabelMissing = false;
+	if (isWarning)
+		warnings.push_back(issue);
+	else
+		issues.push_back(issue);
+} /* end addIssue */
+
+/** \brief findLabelLine returns the line of the first occurrence of a label in a file, or if a sublabel is given of
+ * the first occurrence of the sublabel as the token following the label
+ *
+ * \param reader a pointer to the InputReader of the file, empty if it could not be opened
+ * \param label a pointer to a character array holding the label
+ * \param subLabel a pointer to a character array holding the token after the label on its line, or NULL
+ * \return the line of the label or sublabel, counting from 1, or 0 if it is not in the file
+ **/
+int InputValidator::findLabelLine(InputReader *reader, const char *label, const char *subLabel) {
+	char buffer[InputReader::MAX_TOKEN_LENGTH + 1];
+	long labelStart = reader->findToken(label, -1);
+	while (labelStart >= 0) {
+		if (subLabel == NULL)
+			return reader->getLineNumber(labelStart);
+		InputReader labelReader;
+		labelReader.openView(reader, labelStart + strlen(label));
+		if ((labelReader.scan("%512s", buffer) == 1) && (strcmp(buffer, subLabel) == 0))
+			return reader->getLineNumber(labelReader.getPosition() - 1);
+		labelStart = reader->findToken(label, labelStart);
+	}
+	return 0;
+} /* end findLabelLine */
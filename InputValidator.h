@@ -0,0 +1,64 @@
+#pragma once
+
+#include "include.h"
+
+/**
+	InputValidator checks the inputs of a run once they are read, before it is simulated: it reports the labels
+	that were missing and the values that were not numbers when the input file was read, and checks that the
+	probabilities of the cohort, treatment, HIV testing, TB and Peds inputs are between 0 and 1 and that the
+	cumulative age distribution ends at 1 as BeginMonthUpdater expects.  A distribution whose probabilities do not
+	sum to 1 is only a warning, since the simulation has always accepted them, drawing the last stratum for what
+	remains.  Each issue or warning is reported with the input file, line, and label it concerns, looked up in the
+	input file only when there are any.  The inputs of modules that are disabled are not checked.  The RunScheduler
+	checks the inputs of each run before simulating it, and does not simulate a run with issues.
+*/
+class InputValidator
+{
+public:
+	/* Constructor and Destructor */
+	InputValidator(SimContext *simContext);
+	~InputValidator(void);
+
+	/** Largest difference from 1 allowed for the sum of a distribution, or the end of a cumulative distribution */
+	static const double DISTRIBUTION_SUM_TOLERANCE;
+
+	/* Functions to check the inputs and report the issues found */
+	bool validateInputs();
+	int getNumIssues();
+	void printIssues();
+	int getNumWarnings();
+	void printWarnings();
+
+	/* Function to read and check the inputs of every input file or PSA draw without simulating them */
+	static bool validateInputFiles(PSADriver *psaDriver);
+
+private:
+	/** The run whose inputs are checked */
+	SimContext *simContext;
+	/** Issues found, those found while reading the input file first */
+	vector<SimContext::InputIssue> issues;
+	/** Warnings found, about inputs the simulation accepts but that are likely mistakes */
+	vector<SimContext::InputIssue> warnings;
+	/** The input file, and the base input file if it is a scenario overlay or PSA, opened to look up the lines of labels */
+	bool isInputFileOpen;
+	InputReader inputFile;
+	InputReader baseInputFile;
+	string baseInputFileName;
+
+	/* Functions to check the inputs of each tab */
+	void validateCohortInputs();
+	void validateTreatmentInputs();
+	void validateHIVTestInputs();
+	void validateTBInputs();
+	void validatePedsInputs();
+
+	/* Functions to check input values and record their issues */
+	void checkNonNegative(const char *label, const char *subLabel, const double *values, int numValues);
+	void checkProbabilities(const char *label, const char *subLabel, const double *values, int numValues);
+	void checkDistribution(const char *label, const char *subLabel, const double *values, int numValues);
+	void checkPartialDistribution(const char *label, const char *subLabel, const double *values, int numValues);
+	void checkCumulativeDistribution(const char *label, const char *subLabel, const double *values, int numValues);
+	void addIssue(const char *label, const char *subLabel, string message, bool isWarning = false);
+	int findLabelLine(InputReader *reader, const char *label, const char *subLabel);
+	static void printIssueList(const vector<SimContext::InputIssue> &issueList);
+};
@@ -0,0 +1,141 @@
+// MergeMain.cpp : Defines the main entry point for cepac-merge, which merges the shards of sharded runs
+//
+
+#include "include.h"
+
+/** \brief mergeShards merges the partial statistics files of all the shards of an input file and writes its output files
+ *
+ * The shards are merged in patient order, so the output files are those of the whole cohort, identical to those of an
+ * unsharded run with the same seed
+ *
+ * \param inputFileName the name of the input file the shards were run from
+ * \param numShards the number of shards the cohort was split into
+ * \param runOrder the index of the input file, used to keep the summaries in popstats.out in the order of the input files
+ * \param summaryStats a pointer to the SummaryStats object the merged run is added to
+ **/
+static void mergeShards(string inputFileName, int numShards, int runOrder, SummaryStats *summaryStats) {
+	/** Strip off the extension to get the run name and read in the input file */
+	string runName = CepacUtil::getRunName(inputFileName);
+	printf("Merging File: %s\n", inputFileName.c_str());
+
+	SimContext *simContext = new SimContext(runName, inputFileName);
+	try {
+		simContext->readInputs();
+	}
+	catch (string &errorString) {
+		printf("%s\n", errorString.c_str());
+		delete simContext;
+		return;
+	}
+	RunStats *runStats = new RunStats(runName, simContext);
+	CostStats *costStats = new CostStats(runName, simContext);
+
+	/** Read in each shard and add it to the statistics of the shards before it */
+	for (int shardNum = 1; shardNum <= numShards; shardNum++) {
+		RunStats *shardRunStats = new RunStats(runName, simContext);
+		CostStats *shardCostStats = new CostStats(runName, simContext);
+		bool isMerged = true;
+		try {
+			shardRunStats->readPartialStatsFile(shardCostStats, shardNum, numShards);
+			runStats->merge(*shardRunStats);
+			costStats->merge(*shardCostStats);
+		}
+		catch (string &errorString) {
+			printf("%s\n", errorString.c_str());
+			isMerged = false;
+		}
+		delete shardRunStats;
+		delete shardCostStats;
+		if (!isMerged) {
+			delete runStats;
+			delete costStats;
+			delete simContext;
+			return;
+		}
+	}
+
+	/** Write out the stats files for the whole cohort and add to the summary stats */
+	runStats->finalizeStats();
+	try {
+		runStats->writeStatsFile();
+	}
+	catch (string &errorString) {
+		printf("%s\n", errorString.c_str());
+	}
+	if (simContext->getOutputInputs()->enableDetailedCostOutputs) {
+		costStats->finalizeStats();
+		try {
+			costStats->writeStatsFile();
+		}
+		catch (string &errorString) {
+			printf("%s\n", errorString.c_str());
+		}
+	}
+	summaryStats->addRunStats(runStats, simContext, runOrder);
+
+	/** Display the summary stats for this run in the results window */
+	printf("%s\t cost $%0.0f \t LMs %0.2f \t QALMs %0.2f \n",
+		runStats->getPopulationSummary()->runName.c_str(),
+		runStats->getPopulationSummary()->costsAverage,
+		runStats->getPopulationSummary()->LMsAverage,
+		runStats->getPopulationSummary()->QALMsAverage);
+
+	delete runStats;
+	delete costStats;
+	delete simContext;
+} /* end mergeShards */
+
+/** \brief Main function for cepac-merge, run with the inputs directory and number of shards of a run made with cepac --shard i/N */
+int main(int argc, char *argv[]) {
+
+	/** Parse the command line options, the first other argument is the inputs directory */
+	int numShards = 0;
+	const char *inputsDirectoryArg = NULL;
+	for (int i = 1; i < argc; i++) {
+		if ((strcmp(argv[i], "--shards") == 0) && (i + 1 < argc)) {
+			numShards = atoi(argv[++i]);
+		}
+		else if (inputsDirectoryArg == NULL) {
+			inputsDirectoryArg = argv[i];
+		}
+	}
+	if (numShards < 1) {
+		printf("   ERROR - cepac-merge needs the number of shards the cohorts were split into, --shards N\n");
+		return 1;
+	}
+
+	/** Use the directory given on the command line or the current directory, as the console application does */
+	if (inputsDirectoryArg != NULL) {
+		CepacUtil::inputsDirectory = inputsDirectoryArg;
+		CepacUtil::changeDirectoryToInputs();
+	}
+	else {
+		CepacUtil::useCurrentDirectoryForInputs();
+		#if __APPLE__
+			CepacUtil::changeDirectoryToInputs();
+		#endif
+	}
+
+	/** The partial statistics files are in the results directory, where the merged outputs are written */
+	CepacUtil::createResultsDirectory();
+	string summariesFileName = CepacUtil::FILE_NAME_SUMMARIES;
+	SummaryStats *summaryStats = new SummaryStats(summariesFileName);
+
+	/** Merge the shards of every input file in the inputs directory */
+	CepacUtil::findInputFiles();
+	for (int i = 0; i < (int) CepacUtil::filesToRun.size(); i++)
+		mergeShards(CepacUtil::filesToRun[i], numShards, i, summaryStats);
+	SimContext::deleteOverlayBases();
+
+	/** Finalize the summary stats and print to the popstats file, destroy the summary stats object */
+	summaryStats->finalizeStats();
+	try {
+		summaryStats->writeSummariesFile();
+	}
+	catch (string &errorString) {
+		printf("%s\n", errorString.c_str());
+	}
+	delete summaryStats;
+
+	return 0;
+} /* end main */
@@ -0,0 +1,746 @@
+// MergeTestMain.cpp : Defines the main entry point for cepac-merge-test, which checks that merging blocks of patients matches adding them serially
+//
+
+#include "include.h"
+
+/** Fields of each statistics subclass in declaration order, compared one by one with StatsComparison::compareValue,
+	which picks the comparison for the type of the field.  checkFieldLists verifies that each list names every field
+	of its class, so these lists must be updated whenever a field is added to RunStats.h or CostStats.h */
+#define PATIENT_SUMMARY_FIELDS(FIELD) \
+	FIELD(costs) FIELD(LMs) FIELD(QALMs)
+
+#define POPULATION_SUMMARY_FIELDS(FIELD) \
+	FIELD(runSetName) FIELD(runName) FIELD(runDate) FIELD(runTime) FIELD(numCohorts) FIELD(numCohortsHIVPositive) \
+	FIELD(totalClinicVisits) FIELD(costsSum) FIELD(costsAverage) FIELD(costsSumSquares) FIELD(costsStdDev) \
+	FIELD(costsLowerBound) FIELD(costsUpperBound) FIELD(LMsSum) FIELD(LMsAverage) FIELD(LMsSumSquares) FIELD(LMsStdDev) \
+	FIELD(LMsLowerBound) FIELD(LMsUpperBound) FIELD(QALMsSum) FIELD(QALMsAverage) FIELD(QALMsSumSquares) \
+	FIELD(QALMsStdDev) FIELD(QALMsLowerBound) FIELD(QALMsUpperBound) FIELD(costsSumCohortParsing) \
+	FIELD(costsAverageCohortParsing) FIELD(costsSumSquaresCohortParsing) FIELD(costsStdDevCohortParsing) \
+	FIELD(LMsSumCohortParsing) FIELD(LMsAverageCohortParsing) FIELD(LMsSumSquaresCohortParsing) \
+	FIELD(LMsStdDevCohortParsing) FIELD(QALMsSumCohortParsing) FIELD(QALMsAverageCohortParsing) \
+	FIELD(QALMsSumSquaresCohortParsing) FIELD(QALMsStdDevCohortParsing) FIELD(multDiscCostsAverage) \
+	FIELD(multDiscCostsSum) FIELD(multDiscCostsSumSquares) FIELD(multDiscCostsStdDev) FIELD(multDiscLMsAverage) \
+	FIELD(multDiscLMsSum) FIELD(multDiscLMsSumSquares) FIELD(multDiscLMsStdDev) FIELD(multDiscQALMsAverage) \
+	FIELD(multDiscQALMsSum) FIELD(multDiscQALMsSumSquares) FIELD(multDiscQALMsStdDev) FIELD(numFailART) \
+	FIELD(costsFailARTSum) FIELD(costsFailARTAverage) FIELD(LMsFailARTSum) FIELD(LMsFailARTAverage) FIELD(QALMsFailARTSum) \
+	FIELD(QALMsFailARTAverage) FIELD(costsHIVPositiveSum) FIELD(costsHIVPositiveAverage) FIELD(LMsHIVPositiveSum) \
+	FIELD(LMsHIVPositiveAverage) FIELD(QALMsHIVPositiveSum) FIELD(QALMsHIVPositiveAverage)
+
+#define HIV_SCREENING_FIELDS(FIELD) \
+	FIELD(numPrevalentCases) FIELD(numIncidentCases) FIELD(numIncidentCasesByPrEPState) FIELD(numHIVNegativeAtInit) \
+	FIELD(numHIVPositiveTotal) FIELD(numNeverHIVPositive) FIELD(LMsHIVNegativeSum) FIELD(LMsHIVNegativeAverage) \
+	FIELD(QALMsHIVNegativeSum) FIELD(QALMsHIVNegativeAverage) FIELD(numHIVExposed) FIELD(numNeverHIVExposed) \
+	FIELD(numPatientsInitialHIVState) FIELD(numLinkedAtInit) FIELD(numAtDetectionPrevalent) \
+	FIELD(numAtDetectionPrevalentCD4Metric) FIELD(numAtDetectionPrevalentHIV) FIELD(numAtDetectionPrevalentHIVCD4Metric) \
+	FIELD(numAtDetectionPrevalentCD4) FIELD(numAtDetectionPrevalentCD4HIV) FIELD(numAtDetectionPrevalentHVL) \
+	FIELD(numAtDetectionPrevalentHVLHIV) FIELD(numAtDetectionIncident) FIELD(numAtDetectionIncidentCD4Metric) \
+	FIELD(numAtDetectionIncidentHIV) FIELD(numAtDetectionIncidentHIVCD4Metric) FIELD(numAtDetectionIncidentCD4) \
+	FIELD(percentAtDetectionIncidentCD4) FIELD(numAtDetectionIncidentCD4HIV) FIELD(numAtDetectionIncidentHVL) \
+	FIELD(percentAtDetectionIncidentHVL) FIELD(numAtDetectionIncidentHVLHIV) FIELD(numAtLinkage) \
+	FIELD(numAtLinkageCD4Metric) FIELD(numAtLinkageHIV) FIELD(numAtLinkageHIVCD4Metric) FIELD(numAtLinkageCD4) \
+	FIELD(numAtLinkageHVL) FIELD(numAtLinkageHVLHIV) FIELD(numAtLinkageCD4HIV) FIELD(CD4AtDetectionPrevalentSum) \
+	FIELD(CD4AtDetectionPrevalentAverage) FIELD(CD4AtDetectionPrevalentSumHIV) FIELD(CD4AtDetectionPrevalentAverageHIV) \
+	FIELD(CD4AtDetectionIncidentSum) FIELD(CD4AtDetectionIncidentAverage) FIELD(CD4AtDetectionIncidentSumHIV) \
+	FIELD(CD4AtDetectionIncidentAverageHIV) FIELD(CD4AtLinkageSum) FIELD(CD4AtLinkageAverage) FIELD(CD4AtLinkageSumHIV) \
+	FIELD(CD4AtLinkageAverageHIV) FIELD(monthsToInfectionSum) FIELD(monthsToInfectionAverage) \
+	FIELD(monthsToInfectionSumSquares) FIELD(monthsToInfectionStdDev) FIELD(monthsAfterInfectionToDetectionSum) \
+	FIELD(monthsAfterInfectionToDetectionAverage) FIELD(monthsAfterInfectionToDetectionSumSquares) \
+	FIELD(monthsAfterInfectionToDetectionStdDev) FIELD(monthsToDetectionPrevalentSum) \
+	FIELD(monthsToDetectionPrevalentAverage) FIELD(monthsToDetectionPrevalentSumSquares) \
+	FIELD(monthsToDetectionPrevalentStdDev) FIELD(monthsToDetectionIncidentSum) FIELD(monthsToDetectionIncidentAverage) \
+	FIELD(monthsToDetectionIncidentSumSquares) FIELD(monthsToDetectionIncidentStdDev) FIELD(monthsToLinkageSum) \
+	FIELD(monthsToLinkageAverage) FIELD(monthsToLinkageSumSquares) FIELD(monthsToLinkageStdDev) \
+	FIELD(monthsToLinkageSumMeans) FIELD(monthsToLinkageAverageMeans) FIELD(monthsToLinkageSumSquaresMeans) \
+	FIELD(monthsToLinkageStdDevMeans) FIELD(ageMonthsAtDetectionPrevalentSum) FIELD(ageMonthsAtDetectionPrevalentAverage) \
+	FIELD(ageMonthsAtDetectionPrevalentSumSquares) FIELD(ageMonthsAtDetectionPrevalentStdDev) \
+	FIELD(ageMonthsAtDetectionIncidentSum) FIELD(ageMonthsAtDetectionIncidentAverage) \
+	FIELD(ageMonthsAtDetectionIncidentSumSquares) FIELD(ageMonthsAtDetectionIncidentStdDev) FIELD(ageMonthsAtLinkageSum) \
+	FIELD(ageMonthsAtLinkageAverage) FIELD(ageMonthsAtLinkageSumSquares) FIELD(ageMonthsAtLinkageStdDev) \
+	FIELD(numDetectedGender) FIELD(numDetectedPrevalentMeans) FIELD(numDetectedIncidentMeans) FIELD(numLinkedMeans) \
+	FIELD(numDetectedByOIs) FIELD(numDetectedByOIsPrevDetected) FIELD(numTestingAcceptProb) FIELD(numTestingInterval) \
+	FIELD(numAcceptTest) FIELD(numRefuseTest) FIELD(numReturnForResults) FIELD(numNoReturnForResults) \
+	FIELD(numAcceptLabStaging) FIELD(numRefuseLabStaging) FIELD(numReturnForResultsLabStaging) \
+	FIELD(numNoReturnForResultsLabStaging) FIELD(numLinkLabStaging) FIELD(numNoLinkLabStaging) \
+	FIELD(numAcceptLabStagingHIVState) FIELD(numReturnLabStagingHIVState) FIELD(numReturnLabStagingObsvCD4) \
+	FIELD(numReturnLabStagingTrueCD4) FIELD(numReturnLabStagingObsvTrueCD4) FIELD(numLinkLabStagingObsvCD4) \
+	FIELD(numLinkLabStagingTrueCD4) FIELD(numLinkLabStagingObsvTrueCD4) FIELD(numTestsHIVState) \
+	FIELD(numTestResultsPrevalent) FIELD(numTestResultsPrevalentType) FIELD(numTestResultsIncident) \
+	FIELD(numTestResultsIncidentType) FIELD(numTestResultsHIVNegative) FIELD(numTestResultsHIVNegativeType) \
+	FIELD(numEverPrEP) FIELD(numDropoutPrEP) FIELD(numStopPrEPMaxAge) FIELD(numEIDTestsGivenType) \
+	FIELD(numTruePositiveEIDTestResultsType) FIELD(numTrueNegativeEIDTestResultsType) \
+	FIELD(numFalsePositiveEIDTestResultsType) FIELD(numFalseNegativeEIDTestResultsType) FIELD(numEIDTestsGivenTest) \
+	FIELD(numTruePositiveEIDTestResultsTest) FIELD(numTrueNegativeEIDTestResultsTest) \
+	FIELD(numFalsePositiveEIDTestResultsTest) FIELD(numFalseNegativeEIDTestResultsTest) FIELD(LMsFalsePositive) \
+	FIELD(LMsFalsePositiveLinked)
+
+#define SURVIVAL_STATS_FIELDS(FIELD) \
+	FIELD(LMsHistogram) FIELD(LMsMin) FIELD(LMsMax) FIELD(LMsMedian) FIELD(LMsSumDeviationMedian) \
+	FIELD(LMsAverageDeviationMedian) FIELD(LMsSum) FIELD(LMsMean) FIELD(LMsSumDeviation) FIELD(LMsAverageDeviation) \
+	FIELD(LMsSumDeviationSquares) FIELD(LMsStdDev) FIELD(LMsVariance) FIELD(LMsSumDeviationCubes) FIELD(LMsSkew) \
+	FIELD(LMsSumDeviationQuads) FIELD(LMsKurtosis) FIELD(costsSum) FIELD(costsMean) FIELD(costsSumSquares) \
+	FIELD(costsStdDev) FIELD(QALMsSum) FIELD(QALMsMean) FIELD(QALMsSumSquares) FIELD(QALMsStdDev)
+
+#define INITIAL_DISTRIBUTIONS_FIELDS(FIELD) \
+	FIELD(numPatientsCD4Level) FIELD(numPatientsHVLLevel) FIELD(numPatientsHVLSetpointLevel) FIELD(sumInitialAgeMonths) \
+	FIELD(averageInitialAgeMonths) FIELD(numMalePatients) FIELD(numFemalePatients) FIELD(numPriorOIHistories) \
+	FIELD(numARTResposneTypes) FIELD(numRiskFactors) FIELD(numInitialPediatrics)
+
+#define CHRMS_STATS_FIELDS(FIELD) \
+	FIELD(numPatientsWithCHRM) FIELD(numPatientsWithCHRMHIVPos) FIELD(numPatientsWithCHRMHIVNeg) FIELD(numPrevalentCHRM) \
+	FIELD(numPrevalentCHRMHIVNeg) FIELD(numHIVNegWithPrevalentCHRMs) FIELD(numPrevalentCD4) FIELD(numPrevalentCHRMCD4) \
+	FIELD(numIncidentCHRM) FIELD(numIncidentCHRMHIVneg) FIELD(numHIVNegWithIncidentCHRMs) FIELD(numIncidentCD4) \
+	FIELD(numIncidentCHRMCD4) FIELD(numDeathsCHRM) FIELD(numDeathsCD4) FIELD(numDeathsCHRMCD4)
+
+#define OI_STATS_FIELDS(FIELD) \
+	FIELD(numPrimaryOIsOI) FIELD(numPrimaryOIsCD4) FIELD(numPrimaryOIsCD4OI) FIELD(numSecondaryOIsOI) \
+	FIELD(numSecondaryOIsCD4) FIELD(numSecondaryOIsCD4OI) FIELD(numDetectedOIsOI) FIELD(numDetectedOIsCD4) \
+	FIELD(numDetectedOIsCD4OI) FIELD(numOIEventsTotal) FIELD(numPatientsHVL) FIELD(numPatientsCD4) \
+	FIELD(numPatientsHVLCD4) FIELD(numPatientsOIHistoryHVL) FIELD(numPatientsOIHistoryCD4) \
+	FIELD(numPatientsOIHistoryHVLCD4) FIELD(probPatientsOIHistoryHVL) FIELD(probPatientsOIHistoryCD4) \
+	FIELD(probPatientsOIHistoryHVLCD4) FIELD(numMonthsHVL) FIELD(numMonthsCD4) FIELD(numMonthsHVLCD4) \
+	FIELD(numMonthsOIHistoryHVL) FIELD(numMonthsOIHistoryCD4) FIELD(numMonthsOIHistoryHVLCD4) \
+	FIELD(probMonthsOIHistoryHVL) FIELD(probMonthsOIHistoryCD4) FIELD(probMonthsOIHistoryHVLCD4)
+
+#define DEATH_STATS_FIELDS(FIELD) \
+	FIELD(numDeathsHIVPosType) FIELD(numDeathsType) FIELD(numDeathsTypeAge) FIELD(numDeathsCD4) FIELD(numDeathsCD4Type) \
+	FIELD(numDeathsCare) FIELD(numDeathsCareType) FIELD(numARTToxDeaths) FIELD(numARTToxDeathsCD4Metric) \
+	FIELD(numARTToxDeathsCD4) FIELD(numARTToxDeathsCD4HVL) FIELD(numARTToxDeathsCD4HVLOIHist) \
+	FIELD(probOIHistARTToxDeathsCD4HVL) FIELD(hvlDistribToxDeathCD4HVL) FIELD(numDeathsUninfected) FIELD(numDeathsHVLCD4) \
+	FIELD(numDeathsHVL) FIELD(numHIVDeathsNoOIHistory) FIELD(numHIVDeathsNoOIHistoryCD4) FIELD(numHIVDeathsOIHistory) \
+	FIELD(numHIVDeathsOIHistoryCD4) FIELD(numBackgroundMortDeathsNoOIHistory) FIELD(numBackgroundMortDeathsNoOIHistoryCD4) \
+	FIELD(numBackgroundMortDeathsOIHistory) FIELD(numBackgroundMortDeathsOIHistoryCD4) FIELD(ARTToxDeathsCD4Sum) \
+	FIELD(ARTToxDeathsCD4SumSquares) FIELD(ARTToxDeathsCD4Mean) FIELD(ARTToxDeathsCD4StdDev)
+
+#define OVERALL_SURVIVAL_FIELDS(FIELD) \
+	FIELD(LMsNoOIHistory) FIELD(LMsNoOIHistoryCD4) FIELD(LMsOIHistory) FIELD(LMsOIHistoryCD4) FIELD(LMsTotal) \
+	FIELD(LMsTotalCD4) FIELD(LMsHVL) FIELD(LMsHVLSetpoint) FIELD(LMsNoOIHistoryOIs) FIELD(LMsOIHistoryOIs) \
+	FIELD(LMsCHRMHistoryCHRMsHIVPos) FIELD(LMsCHRMHistoryCHRMsHIVNeg) FIELD(LMsHIVPositive) FIELD(LMsHIVState) \
+	FIELD(QALMsHIVPositive) FIELD(QALMsHIVState) FIELD(LMsInScreening) FIELD(QALMsInScreening) FIELD(LMsHIVNegativeOnPrEP) \
+	FIELD(LMsInRegularCEPAC) FIELD(LMsGender) FIELD(QALMsGender)
+
+#define OVERALL_COSTS_FIELDS(FIELD) \
+	FIELD(costsNoOIHistory) FIELD(costsNoOIHistoryCD4) FIELD(costsOIHistory) FIELD(costsOIHistoryCD4) FIELD(costsTotal) \
+	FIELD(costsTotalCD4) FIELD(costsHVL) FIELD(costsHVLSetpoint) FIELD(directCostsProph) FIELD(directCostsProphOIs) \
+	FIELD(directCostsProphOIsProph) FIELD(directCostsART) FIELD(directCostsARTLine) FIELD(directCostsARTMultDisc) \
+	FIELD(directCostsARTLineMultDisc) FIELD(costsARTInit) FIELD(costsARTInitLine) FIELD(costsARTMonthly) \
+	FIELD(costsARTMonthlyLine) FIELD(costsARTInitMultDisc) FIELD(costsARTInitLineMultDisc) FIELD(costsARTMonthlyMultDisc) \
+	FIELD(costsARTMonthlyLineMultDisc) FIELD(costsHIVPositive) FIELD(costsHIVState) FIELD(costsCD4Testing) \
+	FIELD(costsHVLTesting) FIELD(costsCD4TestingMultDisc) FIELD(costsHVLTestingMultDisc) FIELD(costsTBTotal) \
+	FIELD(costsTBTests) FIELD(costsTBTestsInit) FIELD(costsTBTestsDST) FIELD(costsTBTreatment) \
+	FIELD(costsTBTreatmentByLine) FIELD(costsTBTreatmentToxByLine) FIELD(costsTBProviderVisits) \
+	FIELD(costsTBMedicationVisits) FIELD(costsClinicVisits) FIELD(costsPrEP) FIELD(costsPrEPNeverHIV) \
+	FIELD(costsPrEPHIVPos) FIELD(costsHIVScreeningTests) FIELD(costsHIVScreeningMisc) FIELD(costsLabStagingTests) \
+	FIELD(costsEIDTests) FIELD(costsLabStagingMisc) FIELD(costsEIDMisc) FIELD(costsEIDVisits) FIELD(costsInfantHIVProph) \
+	FIELD(totalUndiscountedCosts) FIELD(totalUndiscountedCostsUnclassified) FIELD(totalDiscountedCosts) \
+	FIELD(totalDiscountedCostsUnclassified) FIELD(costsDrugs) FIELD(costsDrugsDiscounted) FIELD(costsInterventionStartup) \
+	FIELD(costsInterventionMonthly) FIELD(costsToxicity) FIELD(costsToxicityDiscounted) FIELD(costsCHRMs) \
+	FIELD(costsGender)
+
+#define TB_STATS_FIELDS(FIELD) \
+	FIELD(numInStateAtEntryStrain) FIELD(numUninfectedTBAtEntry) FIELD(numWithUnfavorableOutcome) \
+	FIELD(numStartOnTreatment) FIELD(numDropoutTreatment) FIELD(numTransitionsToTBTreatmentDefault) \
+	FIELD(numFinishTreatment) FIELD(numCuredAtTreatmentFinish) FIELD(numIncreaseResistanceAtTreatmentStop) \
+	FIELD(numInfections) FIELD(numReactivationsLatent) FIELD(numReactivationsPulmLatent) \
+	FIELD(numReactivationsExtraPulmLatent) FIELD(numRelapses) FIELD(numRelapsesPulm) FIELD(numRelapsesExtraPulm) \
+	FIELD(numTBSelfCures) FIELD(numDeaths) FIELD(numDeathsHIVPos) FIELD(numDeathsHIVNeg) FIELD(numTreatmentMinorToxicity) \
+	FIELD(numTreatmentMajorToxicity) FIELD(numProphMinorToxicity) FIELD(numProphMajorToxicity) \
+	FIELD(numDSTTestResultsUninfectedTB) FIELD(numDSTTestResultsByTrueTBStrain)
+
+#define LTFU_STATS_FIELDS(FIELD) \
+	FIELD(numPatientsLost) FIELD(numPatientsReturned) FIELD(numDeathsWhileLost) FIELD(numLostToFollowUp) \
+	FIELD(numLostToFollowUpCD4) FIELD(numReturnToCare) FIELD(numReturnToCareCD4) FIELD(numDeathsWhileLostCD4) \
+	FIELD(monthsLostBeforeReturnSum) FIELD(monthsLostBeforeReturnMean) FIELD(monthsLostBeforeReturnSumSquares) \
+	FIELD(monthsLostBeforeReturnStdDev) FIELD(numLostToFollowUpART) FIELD(numLostToFollowUpPreART) \
+	FIELD(numLostToFollowUpPostART) FIELD(numReturnOnPrevART) FIELD(numReturnOnNextART) FIELD(numReturnToCarePreART) \
+	FIELD(numReturnToCarePostART) FIELD(numDeathsWhileLostART) FIELD(numDeathsWhileLostPreART) \
+	FIELD(numDeathsWhileLostPostART)
+
+#define PROPH_STATS_FIELDS(FIELD) \
+	FIELD(numMinorToxicity) FIELD(numMinorToxicityTotal) FIELD(numMajorToxicity) FIELD(numMajorToxicityTotal) \
+	FIELD(trueCD4InitProphSum) FIELD(trueCD4InitProphMean) FIELD(observedCD4InitProphSum) FIELD(observedCD4InitProphMean) \
+	FIELD(numTimesInitProph) FIELD(numTimesInitProphCD4Metric) FIELD(numTimesInitProphWithObservedCD4)
+
+#define ART_STATS_FIELDS(FIELD) \
+	FIELD(monthsSuppressed) FIELD(monthsSuppressedLine) FIELD(monthsFailedLine) FIELD(monthsFailedHVL) \
+	FIELD(monthsFailedLineHVL) FIELD(numOnARTAtInit) FIELD(numOnARTAtInitCD4Metric) FIELD(numOnARTAtInitResp) \
+	FIELD(trueCD4AtInitSum) FIELD(trueCD4AtInitMean) FIELD(trueCD4AtInitSumResp) FIELD(trueCD4AtInitMeanResp) \
+	FIELD(numWithObservedCD4AtInitResp) FIELD(observedCD4AtInitSum) FIELD(numWithObservedCD4AtInit) \
+	FIELD(observedCD4AtInitMean) FIELD(observedCD4AtInitSumResp) FIELD(observedCD4AtInitMeanResp) \
+	FIELD(numDrawEfficacyAtInit) FIELD(numDrawEfficacyAtInitResp) FIELD(numCD4ResponseTypeAtInit) \
+	FIELD(numCD4ResponseTypeAtInitResp) FIELD(numWithRiskFactorAtInit) FIELD(numWithRiskFactorAtInitResp) \
+	FIELD(numTrueFailure) FIELD(numTrueFailureCD4Metric) FIELD(numTrueFailureResp) FIELD(trueCD4AtTrueFailureSum) \
+	FIELD(trueCD4AtTrueFailureMean) FIELD(trueCD4AtTrueFailureSumResp) FIELD(trueCD4AtTrueFailureMeanResp) \
+	FIELD(observedCD4AtTrueFailureSum) FIELD(numWithObservedCD4AtTrueFailure) FIELD(observedCD4AtTrueFailureMean) \
+	FIELD(observedCD4AtTrueFailureSumResp) FIELD(numWithObservedCD4AtTrueFailureResp) \
+	FIELD(observedCD4AtTrueFailureMeanResp) FIELD(monthsToTrueFailureSum) FIELD(monthsToTrueFailureMean) \
+	FIELD(monthsToTrueFailureSumResp) FIELD(monthsToTrueFailureMeanResp) FIELD(monthsToTrueFailureSumSquares) \
+	FIELD(monthsToTrueFailureStdDev) FIELD(monthsToTrueFailureSumSquaresResp) FIELD(monthsToTrueFailureStdDevResp) \
+	FIELD(numObservedFailure) FIELD(numObservedFailureCD4Metric) FIELD(numObservedFailureType) \
+	FIELD(numObservedFailureTypeCD4Metric) FIELD(numObservedFailureAfterTrue) FIELD(numObservedFailureAfterTrueType) \
+	FIELD(numNeverObservedFailure) FIELD(trueCD4AtObservedFailureSum) FIELD(trueCD4AtObservedFailureMean) \
+	FIELD(trueCD4AtObservedFailureSumType) FIELD(trueCD4AtObservedFailureMeanType) FIELD(numObservedCD4atObservedFailure) \
+	FIELD(observedCD4AtObservedFailureSum) FIELD(observedCD4AtObservedFailureMean) \
+	FIELD(numObservedCD4atObservedFailureType) FIELD(observedCD4AtObservedFailureSumType) \
+	FIELD(observedCD4AtObservedFailureMeanType) FIELD(monthsToObservedFailureSum) FIELD(monthsToObservedFailureMean) \
+	FIELD(monthsToObservedFailureSumType) FIELD(monthsToObservedFailureMeanType) FIELD(monthsToObservedFailureSumSquares) \
+	FIELD(monthsToObservedFailureStdDev) FIELD(monthsToObservedFailureSumSquaresType) \
+	FIELD(monthsToObservedFailureStdDevType) FIELD(numStop) FIELD(numStopCD4Metric) FIELD(numStopType) \
+	FIELD(numStopTypeCD4Metric) FIELD(numStopAfterTrueFailure) FIELD(numStopAfterTrueFailureType) FIELD(numNeverStop) \
+	FIELD(trueCD4AtStopSum) FIELD(trueCD4AtStopMean) FIELD(trueCD4AtStopSumType) FIELD(trueCD4AtStopMeanType) \
+	FIELD(numWithObservedCD4Stop) FIELD(numWithObservedCD4StopType) FIELD(observedCD4AtStopSum) \
+	FIELD(observedCD4AtStopMean) FIELD(observedCD4AtStopSumType) FIELD(observedCD4AtStopMeanType) FIELD(monthsToStopSum) \
+	FIELD(monthsToStopMean) FIELD(monthsToStopSumType) FIELD(monthsToStopMeanType) FIELD(monthsToStopSumSquares) \
+	FIELD(monthsToStopStdDev) FIELD(monthsToStopSumSquaresType) FIELD(monthsToStopStdDevType) FIELD(numARTDeath) \
+	FIELD(numARTDeathCD4Metric) FIELD(trueCD4AtARTDeathSum) FIELD(trueCD4AtARTDeathMean) FIELD(observedCD4AtARTDeathSum) \
+	FIELD(numWithObservedCD4AtARTDeath) FIELD(observedCD4AtARTDeathMean) FIELD(propensityAtARTDeathSum) \
+	FIELD(propensityAtARTDeathMean) FIELD(numARTDeathCause) FIELD(numARTDeathCauseCD4Metric) \
+	FIELD(trueCD4AtARTDeathCauseSum) FIELD(trueCD4AtARTDeathCauseMean) FIELD(observedCD4AtARTDeathCauseSum) \
+	FIELD(numWithObservedCD4AtARTDeathCause) FIELD(observedCD4AtARTDeathCauseMean) FIELD(propensityAtARTDeathCauseSum) \
+	FIELD(propensityAtARTDeathCauseMean) FIELD(numARTOI) FIELD(numARTOICD4Metric) FIELD(trueCD4AtARTOISum) \
+	FIELD(trueCD4AtARTOIMean) FIELD(observedCD4AtARTOISum) FIELD(numWithObservedCD4AtARTOI) FIELD(observedCD4AtARTOIMean) \
+	FIELD(propensityAtARTOISum) FIELD(propensityAtARTOIMean) FIELD(numARTEverInit) FIELD(numARTEverInitCD4Metric) \
+	FIELD(trueCD4AtARTEverInitSum) FIELD(trueCD4AtARTEverInitMean) FIELD(observedCD4AtARTEverInitSum) \
+	FIELD(numWithObservedCD4AtARTEverInit) FIELD(observedCD4AtARTEverInitMean) FIELD(propensityAtARTEverInitSum) \
+	FIELD(propensityAtARTEverInitMean) FIELD(numOnARTAtMonth) FIELD(numSuppressedAtMonth) FIELD(HVLDropsAtMonthSum) \
+	FIELD(HVLDropsAtMonthMean) FIELD(HVLDropsAtMonthSumSquares) FIELD(HVLDropsAtMonthStdDev) FIELD(distributionAtInit) \
+	FIELD(numToxicityCases) FIELD(numToxicityDeaths) FIELD(numSTIInterruptions) FIELD(numSTIRestarts) \
+	FIELD(numSTIEndpoints) FIELD(numPatientsWithSTIInterruptions) FIELD(numSTIInterruptionsSum) \
+	FIELD(numSTIInterruptionsMean) FIELD(monthsOnSTIInterruptionSum) FIELD(monthsOnSTIInterruptionMean)
+
+#define TIME_SUMMARY_FIELDS(FIELD) \
+	FIELD(timePeriod) FIELD(numAlive) FIELD(numAliveTB) FIELD(numAliveTBTrackerCare) FIELD(numTBLTFU) FIELD(numOnTBProph) \
+	FIELD(numCompletedTBProph) FIELD(numIncreaseResistanceDueToProph) FIELD(numTBProphMinorTox) FIELD(numTBProphMajorTox) \
+	FIELD(numOnTBTreatmentByState) FIELD(numOnEmpiricTBTreatmentByState) FIELD(numOnTBTreatmentTotal) \
+	FIELD(numOnEmpiricTBTreatmentTotal) FIELD(numTBStrain) FIELD(numHIVTBTrackerCD4) FIELD(numTBInfections) \
+	FIELD(numTBReactivationsLatent) FIELD(numTBReactivationsPulmLatentHIVNegative) \
+	FIELD(numTBReactivationsExtraPulmLatentHIVNegative) FIELD(numTBReactivationsPulmLatentHIVPositive) \
+	FIELD(numTBReactivationsExtraPulmLatentHIVPositive) FIELD(numTBRelapses) FIELD(numTBRelapsesPulm) \
+	FIELD(numTBRelapsesExtraPulm) FIELD(numObservedTBUninfectedTB) FIELD(numObservedTBByTrueTBStrain) \
+	FIELD(numTBTestResults) FIELD(numTBDiagnosticResults) FIELD(numDSTTestResultsUninfectedTB) \
+	FIELD(numDSTTestResultsByTrueTBStrain) FIELD(numTBUnfavorableOutcome) FIELD(numDeathsTBUnfavorableOutcome) \
+	FIELD(numOnSuccessfulTBTreatment) FIELD(numOnSuccessfulTBTreatmentPulm) FIELD(numOnSuccessfulTBTreatmentExtraPulm) \
+	FIELD(numOnFailedTBTreatment) FIELD(numOnFailedTBTreatmentPulm) FIELD(numOnFailedTBTreatmentExtraPulm) \
+	FIELD(numDefaultTBTreatment) FIELD(numDefaultTBTreatmentPulm) FIELD(numDefaultTBTreatmentExtraPulm) \
+	FIELD(numDropoutTBTreatment) FIELD(numDeathsTB) FIELD(numDeathsTBPulmHIVNegative) FIELD(numDeathsTBPulmHIVPositive) \
+	FIELD(numDeathsTBExtraPulmHIVNegative) FIELD(numDeathsTBExtraPulmHIVPositive) FIELD(numDeathsTBLTFUHIVNegative) \
+	FIELD(numDeathsTBLTFUHIVPositive) FIELD(numDeathsTBWhileFailedTBTreatment) FIELD(numAllDeathsWhileFailedTBTreatment) \
+	FIELD(numAliveWithCHRMs) FIELD(numAliveWithoutCHRMs) FIELD(numAliveCHRM) FIELD(numAliveCare) \
+	FIELD(numAliveCareCD4Metric) FIELD(numAliveInCareOffART) FIELD(numAliveInCareOffARTCD4Metric) FIELD(numAlivePositive) \
+	FIELD(numAlivePositiveCD4Metric) FIELD(totalAliveOnART) FIELD(numAliveOnART) FIELD(numAliveOnARTCD4Metric) \
+	FIELD(numAliveWithCHRMsDetState) FIELD(numAliveWithoutCHRMsDetState) FIELD(numAliveTypeCHRMs) \
+	FIELD(numAlivePediatrics) FIELD(numAlivePediatricsMotherAlive) FIELD(numAlivePediatricsMotherDead) \
+	FIELD(numHIVExposedUninf) FIELD(numNeverHIVExposed) FIELD(numNewlyDetectedPediatricsMotherStatusUnknown) \
+	FIELD(numEIDTestsGivenType) FIELD(numTruePositiveEIDTestResultsType) FIELD(numTrueNegativeEIDTestResultsType) \
+	FIELD(numFalsePositiveEIDTestResultsType) FIELD(numFalseNegativeEIDTestResultsType) FIELD(numEIDTestsGivenTest) \
+	FIELD(numTruePositiveEIDTestResultsTest) FIELD(numTrueNegativeEIDTestResultsTest) \
+	FIELD(numFalsePositiveEIDTestResultsTest) FIELD(numFalseNegativeEIDTestResultsTest) FIELD(numAliveFalsePositive) \
+	FIELD(numAliveFalsePositiveLinked) FIELD(numIncidentPPInfections) FIELD(numIncidentHIVInfections) \
+	FIELD(dynamicNumIncidentHIVInfections) FIELD(debugNumHIVNegAtStartMonth) FIELD(dynamicNumHIVNegAtStartMonth) \
+	FIELD(dynamicSelfTransmissionMult) FIELD(numAliveNegRisk) FIELD(probPrepUptake) FIELD(numHIVDetections) \
+	FIELD(cumulativeNumHIVDetections) FIELD(numHIVTestsPerformed) FIELD(numHIVTestsPerformedAtInitOffer) \
+	FIELD(numHIVTestsPerformedPostStartup) FIELD(cumulativeNumHIVTests) FIELD(cumulativeNumHIVTestsAtInitOffer) \
+	FIELD(cumulativeNumHIVTestsPostStartup) FIELD(numIncidentCHRMs) FIELD(numWithOIHistExt) FIELD(numWithOIHistExtCare) \
+	FIELD(numWithOIHistExtInCareOffART) FIELD(numWithOIHistExtOnART) FIELD(numWithOIHistExtPositive) FIELD(numGender) \
+	FIELD(numGenderCare) FIELD(numGenderInCareOffART) FIELD(numGenderOnART) FIELD(numGenderPositive) \
+	FIELD(sumQOLModifiers) FIELD(propRespSum) FIELD(propRespMean) FIELD(propRespSumSquares) FIELD(propRespStdDev) \
+	FIELD(propRespSumCare) FIELD(propRespMeanCare) FIELD(propRespSumSquaresCare) FIELD(propRespStdDevCare) \
+	FIELD(propRespSumInCareOffART) FIELD(propRespSumOnART) FIELD(propRespSumPositive) FIELD(propRespMeanInCareOffART) \
+	FIELD(propRespMeanOnART) FIELD(propRespMeanPositive) FIELD(propRespSumSquaresInCareOffART) \
+	FIELD(propRespSumSquaresOnART) FIELD(propRespSumSquaresPositive) FIELD(propRespStdDevInCareOffART) \
+	FIELD(propRespStdDevOnART) FIELD(propRespStdDevPositive) FIELD(ageSum) FIELD(ageMean) FIELD(ageSumSquares) \
+	FIELD(ageStdDev) FIELD(ageSumCare) FIELD(ageMeanCare) FIELD(ageSumSquaresCare) FIELD(ageStdDevCare) \
+	FIELD(ageSumInCareOffART) FIELD(ageSumOnART) FIELD(ageSumPositive) FIELD(ageMeanInCareOffART) FIELD(ageMeanOnART) \
+	FIELD(ageMeanPositive) FIELD(ageSumSquaresInCareOffART) FIELD(ageSumSquaresOnART) FIELD(ageSumSquaresPositive) \
+	FIELD(ageStdDevInCareOffART) FIELD(ageStdDevOnART) FIELD(ageStdDevPositive) FIELD(numAgeBracketCare) \
+	FIELD(numAgeBracketOnART) FIELD(numAgeBracketInCareOffART) FIELD(numAgeBracketHIVPositive) FIELD(numAgeBracketAlive) \
+	FIELD(numDeathsAgeBracketCare) FIELD(numDeathsAgeBracketOnART) FIELD(numDeathsAgeBracketInCareOffART) \
+	FIELD(numDeathsAgeBracketHIVPositive) FIELD(numDeathsAgeBracket) FIELD(trueCD4Sum) FIELD(trueCD4Mean) \
+	FIELD(trueCD4SumSquares) FIELD(trueCD4StdDev) FIELD(trueCD4SumCare) FIELD(trueCD4MeanCare) \
+	FIELD(trueCD4SumSquaresCare) FIELD(trueCD4StdDevCare) FIELD(trueCD4SumInCareOffART) FIELD(trueCD4SumOnART) \
+	FIELD(trueCD4MeanInCareOffART) FIELD(trueCD4MeanOnART) FIELD(trueCD4SumSquaresInCareOffART) \
+	FIELD(trueCD4SumSquaresOnART) FIELD(trueCD4StdDevInCareOffART) FIELD(trueCD4StdDevOnART) FIELD(observedCD4Sum) \
+	FIELD(observedCD4Mean) FIELD(observedCD4SumSquares) FIELD(observedCD4StdDev) FIELD(observedCD4SumCare) \
+	FIELD(observedCD4MeanCare) FIELD(observedCD4SumSquaresCare) FIELD(observedCD4StdDevCare) \
+	FIELD(observedCD4SumInCareOffART) FIELD(observedCD4SumOnART) FIELD(observedCD4MeanInCareOffART) \
+	FIELD(observedCD4MeanOnART) FIELD(observedCD4SumSquaresInCareOffART) FIELD(observedCD4SumSquaresOnART) \
+	FIELD(observedCD4StdDevInCareOffART) FIELD(observedCD4StdDevOnART) FIELD(trueCD4PercentageSum) \
+	FIELD(trueCD4PercentageMean) FIELD(trueCD4PercentageSumSquares) FIELD(trueCD4PercentageStdDev) FIELD(trueHVLSum) \
+	FIELD(trueHVLMean) FIELD(trueHVLSumSquares) FIELD(trueHVLStdDev) FIELD(observedHVLSum) FIELD(observedHVLMean) \
+	FIELD(observedHVLSumSquares) FIELD(observedHVLStdDev) FIELD(trueCD4ARTDistribution) FIELD(observedCD4Distribution) \
+	FIELD(observedCD4DistributionCare) FIELD(observedCD4DistributionOnART) FIELD(numWithObservedCD4InCareOffART) \
+	FIELD(numHIVPosWithObservedCD4) FIELD(trueHVLDistribution) FIELD(observedHVLDistribution) \
+	FIELD(trueCD4HVLARTDistribution) FIELD(numTransmissions) FIELD(numTransmissionsHVL) FIELD(numTransmissionsRisk) \
+	FIELD(numARTEfficacyState) FIELD(numPrimaryOIs) FIELD(numSecondaryOIs) FIELD(numPrimaryOIsTotal) \
+	FIELD(numSecondaryOIsTotal) FIELD(numOIsTotal) FIELD(numWithOIHistory) FIELD(numWithoutOIHistory) \
+	FIELD(numWithFirstOI) FIELD(numDeaths) FIELD(numDeathsCare) FIELD(numDeathsInCareOffART) FIELD(totalDeathsOnART) \
+	FIELD(numDeathsOnART) FIELD(numDeathsPositive) FIELD(numCHRMsAgeTotal) FIELD(numCHRMsGenderTotal) \
+	FIELD(numCHRMsCD4Total) FIELD(numCHRMsAge) FIELD(numCHRMsGender) FIELD(numCHRMsCD4) FIELD(numDeathsFromFirstOI) \
+	FIELD(numDeathsType) FIELD(numHIVPosDeathsType) FIELD(numDeathsTypeCare) FIELD(numDeathsWithCHRMsTypeCHRM) \
+	FIELD(numDeathsWithCHRMsCHRM) FIELD(numDeathsWithoutCHRMsType) FIELD(numDeathsWithoutCHRMs) FIELD(costsCD4Testing) \
+	FIELD(costsHVLTesting) FIELD(costsClinicVisits) FIELD(costsEIDVisits) FIELD(costsPrEP) FIELD(costsHIVTests) \
+	FIELD(costsHIVMisc) FIELD(costsLabStagingTests) FIELD(costsEIDTests) FIELD(costsInfantHIVProphDirect) \
+	FIELD(costsInfantHIVProphTox) FIELD(costsLabStagingMisc) FIELD(costsEIDMisc) FIELD(costsInterventionStartup) \
+	FIELD(costsInterventionMonthly) FIELD(totalMonthlyCohortCosts) FIELD(totalMonthlyTBCohortCosts) \
+	FIELD(totalMonthlyCohortCostsType) FIELD(costsProph) FIELD(costsART) FIELD(costsCHRMs) FIELD(cumulativeCohortCosts) \
+	FIELD(cumulativeCohortCostsType) FIELD(cumulativeARTCosts) FIELD(cumulativeCD4TestingCosts) \
+	FIELD(cumulativeHVLTestingCosts) FIELD(cumulativeHIVTestingCosts) FIELD(cumulativeHIVMiscCosts) FIELD(numOnPrEP) \
+	FIELD(incidentToxicities) FIELD(prevalentChronicToxicities) FIELD(numOnART) FIELD(numInCarePreART) \
+	FIELD(numInCarePostART) FIELD(numStartingART) FIELD(numStartingPreART) FIELD(numStartingPostART) \
+	FIELD(numLostToFollowUpART) FIELD(numStartingLostToFollowUpART) FIELD(numLostToFollowUpPreART) \
+	FIELD(numStartingLostToFollowUpPreART) FIELD(numLostToFollowUpPostART) FIELD(numStartingLostToFollowUpPostART) \
+	FIELD(numReturnOnPrevART) FIELD(numReturnOnNextART) FIELD(numReturnToCarePreART) FIELD(numReturnToCarePostART) \
+	FIELD(numDeathsWhileLostART) FIELD(numDeathsWhileLostPreART) FIELD(numDeathsWhileLostPostART) \
+	FIELD(numDeathsHIVPosNeverVisitedClinic) FIELD(numDeathsHIVPosHadClinicVisit) FIELD(numDeathsUninfected)
+
+#define ORPHAN_STATS_FIELDS(FIELD) \
+	FIELD(timePeriod) FIELD(numOrphans) FIELD(numOrphansAge)
+
+#define COST_POPULATION_SUMMARY_FIELDS(FIELD) \
+	FIELD(numPatients) FIELD(numPatientsHIVPositive) FIELD(numDetected) FIELD(numInCare) FIELD(numEverOnART) \
+	FIELD(observedCD4DistributionAtLinkage) FIELD(genderDistributionAtLinkage) FIELD(ageDistributionAtLinkage) \
+	FIELD(observedCD4DistributionAtARTStart) FIELD(genderDistributionAtARTStart) FIELD(ageDistributionAtARTStart)
+
+#define ALL_STATS_FIELDS(FIELD) \
+	FIELD(LMs) FIELD(costs) FIELD(costsART) FIELD(costsOIProph) FIELD(costsTBProph) FIELD(costsCD4Testing) \
+	FIELD(costsHVLTesting) FIELD(costsCD4TestingCategory) FIELD(costsHVLTestingCategory) FIELD(costsInterventionStartup) \
+	FIELD(costsInterventionMonthly) FIELD(costsClinicVisit) FIELD(costsClinicVisitCategory) FIELD(costsRoutineCare) \
+	FIELD(costsRoutineCareCategory) FIELD(costsGeneralMedicine) FIELD(costsGeneralMedicineCategory) \
+	FIELD(costsOITreatment) FIELD(costsOITreatmentCategory) FIELD(costsOIUntreated) FIELD(costsOIUntreatedCategory) \
+	FIELD(costsToxicity) FIELD(costsDeath) FIELD(costsDeathCategory) FIELD(costsHIVScreeningTests) \
+	FIELD(costsHIVScreeningMisc) FIELD(costsLabStagingTests) FIELD(costsLabStagingMisc) FIELD(costsTBTreatment)
+
+#define EVENT_STATS_FIELDS(FIELD) \
+	FIELD(numToxicityCases) FIELD(numTBInfections) FIELD(numOIEvents) FIELD(numDeaths) FIELD(numCD4Tests) \
+	FIELD(numHVLTests) FIELD(numClinicVisits) FIELD(numHIVTests) FIELD(numLabStagingTests)
+
+/** \brief FieldLayout checks that the fields listed for a statistics subclass cover all of it, the only bytes left
+ * between them being the padding needed to align the next field */
+class FieldLayout {
+public:
+	FieldLayout(const string &className, size_t classSize, size_t classAlignment);
+	void addField(const string &fieldName, size_t offset, size_t size, size_t alignment);
+	bool isComplete();
+
+private:
+	string className;
+	size_t classSize;
+	size_t classAlignment;
+	/** Offset just past the last field added */
+	size_t endOffset;
+	bool isValid;
+
+	static size_t alignOffset(size_t offset, size_t alignment);
+};
+
+/** \brief Constructor takes in the name, size and alignment of the class whose fields are added */
+FieldLayout::FieldLayout(const string &className, size_t classSize, size_t classAlignment) {
+	this->className = className;
+	this->classSize = classSize;
+	this->classAlignment = classAlignment;
+	endOffset = 0;
+	isValid = true;
+} /* end Constructor */
+
+/** \brief addField adds the next listed field, reporting any bytes before it that are not padding */
+void FieldLayout::addField(const string &fieldName, size_t offset, size_t size, size_t alignment) {
+	if (offset != alignOffset(endOffset, alignment)) {
+		printf("   ERROR - The field list of %s is missing the fields from byte %d up to %s\n", className.c_str(),
+			(int) endOffset, fieldName.c_str());
+		isValid = false;
+	}
+	endOffset = offset + size;
+} /* end addField */
+
+/** \brief isComplete returns true if the fields added so far cover the whole class, reporting any fields missing at its end */
+bool FieldLayout::isComplete() {
+	if (alignOffset(endOffset, classAlignment) != classSize) {
+		printf("   ERROR - The field list of %s is missing the fields from byte %d on\n", className.c_str(), (int) endOffset);
+		isValid = false;
+	}
+	return isValid;
+} /* end isComplete */
+
+/** \brief alignOffset returns the offset rounded up to a multiple of the alignment */
+size_t FieldLayout::alignOffset(size_t offset, size_t alignment) {
+	return (offset + alignment - 1) / alignment * alignment;
+} /* end alignOffset */
+
+/** Adds a field of object to the layout, used with the field lists */
+#define ADD_FIELD_LAYOUT(field) \
+	layout.addField(#field, (size_t) ((const char *) &object.field - (const char *) &object), sizeof(object.field), alignof(decltype(object.field)));
+
+/** Checks the field list of a statistics subclass, setting isValid to false if it does not cover the class */
+#define CHECK_FIELD_LIST(StatsClass, FIELDS) { \
+	static StatsClass object; \
+	FieldLayout layout(#StatsClass, sizeof(StatsClass), alignof(StatsClass)); \
+	FIELDS(ADD_FIELD_LAYOUT) \
+	if (!layout.isComplete()) \
+		isValid = false; \
+}
+
+/** \brief checkFieldLists checks that the field list of every statistics subclass names all of its fields
+ *
+ * A field is only missed if it is a 4 byte value that happens to sit in the place of the padding before an 8 byte
+ * aligned field, so StatsComparison also compares the bytes of the plain data subclasses as a whole.
+ *
+ * \return false if any field list is incomplete
+ **/
+static bool checkFieldLists() {
+	bool isValid = true;
+	CHECK_FIELD_LIST(RunStats::PatientSummary, PATIENT_SUMMARY_FIELDS)
+	CHECK_FIELD_LIST(RunStats::PopulationSummary, POPULATION_SUMMARY_FIELDS)
+	CHECK_FIELD_LIST(RunStats::HIVScreening, HIV_SCREENING_FIELDS)
+	CHECK_FIELD_LIST(RunStats::SurvivalStats, SURVIVAL_STATS_FIELDS)
+	CHECK_FIELD_LIST(RunStats::InitialDistributions, INITIAL_DISTRIBUTIONS_FIELDS)
+	CHECK_FIELD_LIST(RunStats::CHRMsStats, CHRMS_STATS_FIELDS)
+	CHECK_FIELD_LIST(RunStats::OIStats, OI_STATS_FIELDS)
+	CHECK_FIELD_LIST(RunStats::DeathStats, DEATH_STATS_FIELDS)
+	CHECK_FIELD_LIST(RunStats::OverallSurvival, OVERALL_SURVIVAL_FIELDS)
+	CHECK_FIELD_LIST(RunStats::OverallCosts, OVERALL_COSTS_FIELDS)
+	CHECK_FIELD_LIST(RunStats::TBStats, TB_STATS_FIELDS)
+	CHECK_FIELD_LIST(RunStats::LTFUStats, LTFU_STATS_FIELDS)
+	CHECK_FIELD_LIST(RunStats::ProphStats, PROPH_STATS_FIELDS)
+	CHECK_FIELD_LIST(RunStats::ARTStats, ART_STATS_FIELDS)
+	CHECK_FIELD_LIST(RunStats::TimeSummary, TIME_SUMMARY_FIELDS)
+	CHECK_FIELD_LIST(RunStats::OrphanStats, ORPHAN_STATS_FIELDS)
+	CHECK_FIELD_LIST(CostStats::CostPopulationSummary, COST_POPULATION_SUMMARY_FIELDS)
+	CHECK_FIELD_LIST(CostStats::AllStats, ALL_STATS_FIELDS)
+	CHECK_FIELD_LIST(CostStats::EventStats, EVENT_STATS_FIELDS)
+	return isValid;
+} /* end checkFieldLists */
+
+/** \brief StatsComparison compares the statistics of a serial run with those of a run merged from blocks, field by
+ * field; every value must be exactly equal, doubles bit for bit, since merging adds the same values as a serial run */
+class StatsComparison {
+public:
+	StatsComparison();
+	void compare(RunStats *serialRunStats, CostStats *serialCostStats, RunStats *mergedRunStats, CostStats *mergedCostStats);
+	int getNumMismatches();
+
+private:
+	int numMismatches;
+
+	/* Functions to compare a field of each type, named by its place in the statistics */
+	void compareValue(const string &name, int serialValue, int mergedValue);
+	void compareValue(const string &name, unsigned int serialValue, unsigned int mergedValue);
+	void compareValue(const string &name, double serialValue, double mergedValue);
+	void compareValue(const string &name, const FixedPointSum &serialValue, const FixedPointSum &mergedValue);
+	void compareValue(const string &name, const string &serialValue, const string &mergedValue);
+	void compareValue(const string &name, const map<int, int> &serialValue, const map<int, int> &mergedValue);
+	template <class T, size_t N> void compareValue(const string &name, const T (&serialValue)[N], const T (&mergedValue)[N]);
+
+	/* Function to compare every field of a statistics subclass, defined for each subclass with its field list */
+	template <class StatsClass> void compareStats(const string &name, const StatsClass *serialStats, const StatsClass *mergedStats);
+	void compareBytes(const string &name, const void *serialStats, const void *mergedStats, size_t size);
+	void reportMismatch(const string &name, const char *format, ...);
+};
+
+/** \brief Constructor starts with no mismatches */
+StatsComparison::StatsComparison() {
+	numMismatches = 0;
+} /* end Constructor */
+
+/** \brief getNumMismatches returns the number of values that differ */
+int StatsComparison::getNumMismatches() {
+	return numMismatches;
+} /* end getNumMismatches */
+
+/** \brief compareValue compares an int field */
+void StatsComparison::compareValue(const string &name, int serialValue, int mergedValue) {
+	if (serialValue != mergedValue)
+		reportMismatch(name, "int serial %d, merged %d", serialValue, mergedValue);
+} /* end compareValue */
+
+/** \brief compareValue compares an unsigned int field */
+void StatsComparison::compareValue(const string &name, unsigned int serialValue, unsigned int mergedValue) {
+	if (serialValue != mergedValue)
+		reportMismatch(name, "unsigned int serial %u, merged %u", serialValue, mergedValue);
+} /* end compareValue */
+
+/** \brief compareValue compares a double field bit for bit, so signed zeros and NaNs must match as well */
+void StatsComparison::compareValue(const string &name, double serialValue, double mergedValue) {
+	if (memcmp(&serialValue, &mergedValue, sizeof(double)) != 0)
+		reportMismatch(name, "double serial %.17g, merged %.17g", serialValue, mergedValue);
+} /* end compareValue */
+
+/** \brief compareValue compares a FixedPointSum total exactly */
+void StatsComparison::compareValue(const string &name, const FixedPointSum &serialValue, const FixedPointSum &mergedValue) {
+	if (!(serialValue == mergedValue))
+		reportMismatch(name, "FixedPointSum serial %.17g, merged %.17g", (double) serialValue, (double) mergedValue);
+} /* end compareValue */
+
+/** \brief compareValue compares a string field */
+void StatsComparison::compareValue(const string &name, const string &serialValue, const string &mergedValue) {
+	if (serialValue != mergedValue)
+		reportMismatch(name, "string serial \"%s\", merged \"%s\"", serialValue.c_str(), mergedValue.c_str());
+} /* end compareValue */
+
+/** \brief compareValue compares a histogram field */
+void StatsComparison::compareValue(const string &name, const map<int, int> &serialValue, const map<int, int> &mergedValue) {
+	if (serialValue != mergedValue)
+		reportMismatch(name, "map<int,int> serial %d entries, merged %d entries", (int) serialValue.size(), (int) mergedValue.size());
+} /* end compareValue */
+
+/** \brief compareValue compares each element of an array field, naming it by its index */
+template <class T, size_t N> void StatsComparison::compareValue(const string &name, const T (&serialValue)[N], const T (&mergedValue)[N]) {
+	for (size_t i = 0; i < N; i++) {
+		char index[16];
+		sprintf(index, "[%d]", (int) i);
+		compareValue(name + index, serialValue[i], mergedValue[i]);
+	}
+} /* end compareValue */
+
+/** \brief compareBytes compares a plain data subclass as a whole once its listed fields all match, which would only
+ * find a difference in a field missing from its list, since the padding is zeroed by value initialization */
+void StatsComparison::compareBytes(const string &name, const void *serialStats, const void *mergedStats, size_t size) {
+	if (memcmp(serialStats, mergedStats, size) != 0)
+		reportMismatch(name, "bytes outside the listed fields differ, the field list is out of date");
+} /* end compareBytes */
+
+/** \brief reportMismatch counts a value that differs, only the first few are printed */
+void StatsComparison::reportMismatch(const string &name, const char *format, ...) {
+	numMismatches++;
+	if (numMismatches > 20)
+		return;
+	char buffer[256];
+	va_list args;
+	va_start(args, format);
+	vsnprintf(buffer, sizeof(buffer), format, args);
+	va_end(args);
+	printf("   ERROR - %s differs: %s\n", name.c_str(), buffer);
+} /* end reportMismatch */
+
+/** Compares a field of the serial and merged statistics, used with the field lists */
+#define COMPARE_FIELD(field) \
+	compareValue(name + "." #field, serialStats->field, mergedStats->field);
+
+/** Defines compareStats for a statistics subclass from its field list, comparing the bytes of the plain data subclasses
+	as a whole as well */
+#define DEFINE_COMPARE_STATS(StatsClass, FIELDS) \
+template <> void StatsComparison::compareStats(const string &name, const StatsClass *serialStats, const StatsClass *mergedStats) { \
+	int mismatchesBefore = numMismatches; \
+	FIELDS(COMPARE_FIELD) \
+	if (is_trivially_copyable<StatsClass>::value && (numMismatches == mismatchesBefore)) \
+		compareBytes(name, serialStats, mergedStats, sizeof(StatsClass)); \
+}
+
+DEFINE_COMPARE_STATS(RunStats::PatientSummary, PATIENT_SUMMARY_FIELDS)
+DEFINE_COMPARE_STATS(RunStats::PopulationSummary, POPULATION_SUMMARY_FIELDS)
+DEFINE_COMPARE_STATS(RunStats::HIVScreening, HIV_SCREENING_FIELDS)
+DEFINE_COMPARE_STATS(RunStats::SurvivalStats, SURVIVAL_STATS_FIELDS)
+DEFINE_COMPARE_STATS(RunStats::InitialDistributions, INITIAL_DISTRIBUTIONS_FIELDS)
+DEFINE_COMPARE_STATS(RunStats::CHRMsStats, CHRMS_STATS_FIELDS)
+DEFINE_COMPARE_STATS(RunStats::OIStats, OI_STATS_FIELDS)
+DEFINE_COMPARE_STATS(RunStats::DeathStats, DEATH_STATS_FIELDS)
+DEFINE_COMPARE_STATS(RunStats::OverallSurvival, OVERALL_SURVIVAL_FIELDS)
+DEFINE_COMPARE_STATS(RunStats::OverallCosts, OVERALL_COSTS_FIELDS)
+DEFINE_COMPARE_STATS(RunStats::TBStats, TB_STATS_FIELDS)
+DEFINE_COMPARE_STATS(RunStats::LTFUStats, LTFU_STATS_FIELDS)
+DEFINE_COMPARE_STATS(RunStats::ProphStats, PROPH_STATS_FIELDS)
+DEFINE_COMPARE_STATS(RunStats::ARTStats, ART_STATS_FIELDS)
+DEFINE_COMPARE_STATS(RunStats::TimeSummary, TIME_SUMMARY_FIELDS)
+DEFINE_COMPARE_STATS(RunStats::OrphanStats, ORPHAN_STATS_FIELDS)
+DEFINE_COMPARE_STATS(CostStats::CostPopulationSummary, COST_POPULATION_SUMMARY_FIELDS)
+DEFINE_COMPARE_STATS(CostStats::AllStats, ALL_STATS_FIELDS)
+DEFINE_COMPARE_STATS(CostStats::EventStats, EVENT_STATS_FIELDS)
+
+/** \brief compare compares every statistics subclass of the serial and merged runs, RunStats then CostStats */
+void StatsComparison::compare(RunStats *serialRunStats, CostStats *serialCostStats, RunStats *mergedRunStats, CostStats *mergedCostStats) {
+	char name[64];
+	compareValue("patientNumOffset", serialRunStats->getPatientNumOffset(), mergedRunStats->getPatientNumOffset());
+	compareStats("PopulationSummary", serialRunStats->getPopulationSummary(), mergedRunStats->getPopulationSummary());
+	compareStats("HIVScreening", serialRunStats->getHIVScreening(), mergedRunStats->getHIVScreening());
+	for (int i = 0; i < RunStats::NUM_SURVIVAL_GROUPS; i++) {
+		sprintf(name, "SurvivalStats[%d]", i);
+		compareStats(name, serialRunStats->getSurvivalStats(i), mergedRunStats->getSurvivalStats(i));
+	}
+	compareStats("InitialDistributions", serialRunStats->getInitialDistributions(), mergedRunStats->getInitialDistributions());
+	compareStats("CHRMsStats", serialRunStats->getCHRMsStats(), mergedRunStats->getCHRMsStats());
+	compareStats("OIStats", serialRunStats->getOIStats(), mergedRunStats->getOIStats());
+	compareStats("DeathStats", serialRunStats->getDeathStats(), mergedRunStats->getDeathStats());
+	compareStats("OverallSurvival", serialRunStats->getOverallSurvival(), mergedRunStats->getOverallSurvival());
+	compareStats("OverallCosts", serialRunStats->getOverallCosts(), mergedRunStats->getOverallCosts());
+	compareStats("TBStats", serialRunStats->getTBStats(), mergedRunStats->getTBStats());
+	compareStats("LTFUStats", serialRunStats->getLTFUStats(), mergedRunStats->getLTFUStats());
+	compareStats("ProphStats", serialRunStats->getProphStats(), mergedRunStats->getProphStats());
+	compareStats("ARTStats", serialRunStats->getARTStats(), mergedRunStats->getARTStats());
+
+	/** The vectors must have the same number of elements, and each element must match */
+	for (unsigned int i = 0; serialRunStats->getPatientSummary(i) || mergedRunStats->getPatientSummary(i); i++) {
+		sprintf(name, "PatientSummary[%u]", i);
+		if (!serialRunStats->getPatientSummary(i) || !mergedRunStats->getPatientSummary(i))
+			reportMismatch(name, "present in only one of the runs");
+		else
+			compareStats(name, serialRunStats->getPatientSummary(i), mergedRunStats->getPatientSummary(i));
+	}
+	for (unsigned int i = 0; serialRunStats->getTimeSummary(i) || mergedRunStats->getTimeSummary(i); i++) {
+		sprintf(name, "TimeSummary[%u]", i);
+		if (!serialRunStats->getTimeSummary(i) || !mergedRunStats->getTimeSummary(i))
+			reportMismatch(name, "present in only one of the runs");
+		else
+			compareStats(name, serialRunStats->getTimeSummary(i), mergedRunStats->getTimeSummary(i));
+	}
+	for (unsigned int i = 0; serialRunStats->getOrphanStats(i) || mergedRunStats->getOrphanStats(i); i++) {
+		sprintf(name, "OrphanStats[%u]", i);
+		if (!serialRunStats->getOrphanStats(i) || !mergedRunStats->getOrphanStats(i))
+			reportMismatch(name, "present in only one of the runs");
+		else
+			compareStats(name, serialRunStats->getOrphanStats(i), mergedRunStats->getOrphanStats(i));
+	}
+
+	compareStats("CostPopulationSummary", serialCostStats->getCostPopulationSummary(), mergedCostStats->getCostPopulationSummary());
+	for (int j = 0; j < SimContext::COST_CD4_STRATA_NUM; j++) {
+		SimContext::CD4_STRATA cd4Strata = (SimContext::CD4_STRATA) j;
+		for (int k = 0; k < SimContext::COST_SUBGROUPS_NUM; k++) {
+			SimContext::COST_SUBGROUPS subgroup = (SimContext::COST_SUBGROUPS) k;
+			for (int i = 0; i < SimContext::COST_REPORT_DISCOUNT_NUM; i++) {
+				SimContext::COST_REPORT_DISCOUNT disc = (SimContext::COST_REPORT_DISCOUNT) i;
+				sprintf(name, "AllStats[%d][%d][%d]", i, j, k);
+				compareStats(name, serialCostStats->getAllStats(disc, cd4Strata, subgroup), mergedCostStats->getAllStats(disc, cd4Strata, subgroup));
+			}
+			sprintf(name, "EventStats[%d][%d]", j, k);
+			compareStats(name, serialCostStats->getEventStats(cd4Strata, subgroup), mergedCostStats->getEventStats(cd4Strata, subgroup));
+		}
+	}
+} /* end compare */
+
+/** \brief readTempFile returns the contents of a temporary file and closes it */
+static string readTempFile(FILE *file) {
+	string contents;
+	char buffer[65536];
+	size_t numRead;
+	rewind(file);
+	while ((numRead = fread(buffer, 1, sizeof(buffer), file)) > 0)
+		contents.append(buffer, numRead);
+	fclose(file);
+	return contents;
+} /* end readTempFile */
+
+/** SimulatedCohort holds the statistics and trace of a cohort simulated by simulateCohort */
+struct SimulatedCohort {
+	SimContext *simContext;
+	RunStats *runStats;
+	CostStats *costStats;
+	string trace;
+};
+
+/** \brief deleteCohort frees the objects of a cohort simulated by simulateCohort */
+static void deleteCohort(SimulatedCohort *cohort) {
+	delete cohort->runStats;
+	delete cohort->costStats;
+	delete cohort->simContext;
+} /* end deleteCohort */
+
+/** \brief simulateCohort simulates the cohort of an input file with a CohortRunner on the calling thread
+ *
+ * \param inputFileName the name of the input file to simulate
+ * \param runSeed the seed of the run, the same for the serial and merged runs
+ * \param numThreads the number of threads passed to the CohortRunner: one to add the patients serially, more to merge them as blocks
+ * \param cohort set to the statistics, which are not finalized, and the text traced for the patients
+ * \param isSkipped set to true if the cohort is always simulated serially, so there are no blocks to merge
+ * \return false if the input file could not be read or the cohort is skipped
+ **/
+static bool simulateCohort(string inputFileName, unsigned long runSeed, int numThreads, SimulatedCohort *cohort, bool *isSkipped) {
+	string runName = CepacUtil::getRunName(inputFileName);
+	SimContext *simContext = new SimContext(runName, inputFileName);
+	try {
+		simContext->readInputs();
+	}
+	catch (string &errorString) {
+		printf("%s\n", errorString.c_str());
+		delete simContext;
+		return false;
+	}
+	if (simContext->getCohortInputs()->showTransmissionOutput && simContext->getCohortInputs()->useDynamicTransm) {
+		printf("   Skipped, dynamic transmission is always simulated serially\n");
+		*isSkipped = true;
+		delete simContext;
+		return false;
+	}
+	simContext->setRunSeed(runSeed);
+	simContext->buildDerivedTables();
+
+	RunStats *runStats = new RunStats(runName, simContext);
+	CostStats *costStats = new CostStats(runName, simContext);
+	Tracer *tracer = new Tracer(runName, simContext, 1);
+	tracer->openTraceBuffer();
+
+	/** Simulate the blocks one after another, each is merged as soon as it is finished */
+	CohortRunner *cohortRunner = new CohortRunner(simContext, runStats, costStats, tracer, numThreads);
+	bool isComplete = cohortRunner->startCohort();
+	while (!isComplete) {
+		int blockNum = cohortRunner->claimBlock();
+		if (blockNum < 0)
+			break;
+		isComplete = cohortRunner->runBlock(blockNum);
+	}
+	delete cohortRunner;
+
+	FILE *file = tmpfile();
+	tracer->writeCachedTrace(file);
+	cohort->trace = readTempFile(file);
+	tracer->closeTraceFile();
+	delete tracer;
+
+	cohort->simContext = simContext;
+	cohort->runStats = runStats;
+	cohort->costStats = costStats;
+	return true;
+} /* end simulateCohort */
+
+/** \brief testMerge simulates the cohort of an input file serially and as merged blocks and compares the results
+ *
+ * A cohort of no more than CohortRunner::PATIENT_BLOCK_SIZE patients is a single block, which is always identical
+ *
+ * \return false if the input file cannot be read, or any statistic or the trace differs
+ **/
+static bool testMerge(string inputFileName) {
+	printf("Testing File: %s\n", inputFileName.c_str());
+	unsigned long runSeed = CepacUtil::getRunSeed(false);
+	SimulatedCohort serial, merged;
+	bool isSkipped = false;
+	if (!simulateCohort(inputFileName, runSeed, 1, &serial, &isSkipped))
+		return isSkipped;
+	if (!simulateCohort(inputFileName, runSeed, 2, &merged, &isSkipped)) {
+		deleteCohort(&serial);
+		return isSkipped;
+	}
+
+	StatsComparison comparison;
+	comparison.compare(serial.runStats, serial.costStats, merged.runStats, merged.costStats);
+	bool isValid = (comparison.getNumMismatches() == 0);
+	if (serial.trace != merged.trace) {
+		printf("   ERROR - The traces differ\n");
+		isValid = false;
+	}
+	if (isValid)
+		printf("   All values are identical\n");
+	else if (comparison.getNumMismatches() > 0)
+		printf("   %d values differ\n", comparison.getNumMismatches());
+	deleteCohort(&serial);
+	deleteCohort(&merged);
+	return isValid;
+} /* end testMerge */
+
+/** \brief Main function for cepac-merge-test, run with the inputs directory; returns 1 if merging differs from serial accumulation in any value */
+int main(int argc, char *argv[]) {
+	/** Use the directory given on the command line or the current directory, as the console application does */
+	if (argc > 1) {
+		CepacUtil::inputsDirectory = argv[1];
+		CepacUtil::changeDirectoryToInputs();
+	}
+	else {
+		CepacUtil::useCurrentDirectoryForInputs();
+	}
+
+	bool isValid = checkFieldLists();
+	CepacUtil::findInputFiles();
+	for (int i = 0; i < (int) CepacUtil::filesToRun.size(); i++) {
+		if (!testMerge(CepacUtil::filesToRun[i]))
+			isValid = false;
+	}
+	SimContext::deleteOverlayBases();
+
+	printf("%s\n", isValid ? "All checks passed" : "Some checks FAILED");
+	return isValid ? 0 : 1;
+} /* end main */
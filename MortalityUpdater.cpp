@@ -31,7 +31,7 @@ void MortalityUpdater::performMonthlyUpdates() {
 	// if the patient's age is greater than the maximum allowed, death occurs and the cause is set as background mortality 
 	if (ageYears > SimContext::AGE_MAXIMUM){
 		/* set unfavorable outcome for TB if death occurs during initial treatment*/
-		if (simContext->getTBInputs()->enableTB){
+		if (simContext->isTBEnabled()){
 			if ((patient->getTBState()->isOnTreatment || patient->getTBState()->isOnEmpiricTreatment) && !patient->getTBState()->everHadNonInitialTreatmentOrEmpiric)
 				setTBUnfavorableOutcome(SimContext::TB_UNFAVORABLE_DEATH);
 		}
@@ -41,24 +41,8 @@ void MortalityUpdater::performMonthlyUpdates() {
 
 	// Add mortality risks for adolescents
 	if (patient->getGeneralState()->isAdolescent){
-		backgroundDeathRate = natHist->monthlyBackgroundDeathRate[gender][ageYears];
-		// Adjust background mortality by overall modifier if applicable
-		if (simContext->getNatHistInputs()->backgroundMortModifierType== SimContext::MORT_MOD_INCREMENTAL){
-			//Incremental method increments probability of death in proportion to the probability of not dying to ensure it stays less than or equal to 1
-			double extraBackgroundMortRisk = simContext->getNatHistInputs()->backgroundMortModifier;
-			//Convert rate to prob first
-			double probDeathBackgroundMort = CepacUtil::rateToProb(backgroundDeathRate);
-			probDeathBackgroundMort =probDeathBackgroundMort + extraBackgroundMortRisk - (probDeathBackgroundMort*extraBackgroundMortRisk);
-			probDeathBackgroundMort = max(probDeathBackgroundMort, 0.0);
-			// Do data validation check here since it can't be done in the input sheet
-			if(probDeathBackgroundMort < 1.0){
-				backgroundDeathRate = CepacUtil::probToRate(probDeathBackgroundMort);
-			}
-		}
-		else if (simContext->getNatHistInputs()->backgroundMortModifierType == SimContext::MORT_MOD_MULT){
-			backgroundDeathRate *= simContext->getNatHistInputs()->backgroundMortModifier;
-		}	
-		// Add background mortality, using adult inputs from the NatHist tab
+		// Add background mortality, using adult inputs from the NatHist tab adjusted by the overall modifier
+		backgroundDeathRate = simContext->getBackgroundDeathRate(SimContext::BKGD_MORT_RATIO_NONE, gender, ageYears);
 		addMortalityRisk(SimContext::DTH_BKGD_MORT, backgroundDeathRate);
 		// Add risk of death from the generic risk factors if applicable
 		for (int i = 0; i < SimContext::RISK_FACT_NUM; i++){
@@ -82,7 +66,7 @@ void MortalityUpdater::performMonthlyUpdates() {
 				if(patient->getDiseaseState()->hasTrueOIHistory[oiType] &&  simContext->getRunSpecsInputs()->severeOIs[oiType]){
 					int monthsSince = monthNum - patient->getDiseaseState()->lastMonthSevereOI[oiType];
 					// Check if this is TB being modeled as a severe OI when the TB tab is not enabled 
-					if(!simContext->getTBInputs()->enableTB && simContext->getRunSpecsInputs()->OIsIncludeTB && oiType==0){
+					if(!simContext->isTBEnabled() && simContext->getRunSpecsInputs()->OIsIncludeTB && oiType==0){
 						if(monthNum > 0 && monthsSince <=  simContext->getAdolescentInputs()->TB_OIHistEffectDuration){
 							OIHistDeathRateRatio = simContext->getAdolescentInputs()->TB_OIHistDeathRateRatio[getAgeCategoryAdolescent()];
 							maxOIHistDeathRateRatio = max(maxOIHistDeathRateRatio, OIHistDeathRateRatio);
@@ -105,24 +89,8 @@ void MortalityUpdater::performMonthlyUpdates() {
 	}	
 	// Add mortality risks for adults
 	else if(pedsAgeCat == SimContext::PEDS_AGE_ADULT){
-		backgroundDeathRate = natHist->monthlyBackgroundDeathRate[gender][ageYears];
-		// Adjust background mortality by overall modifier if applicable
-		if (simContext->getNatHistInputs()->backgroundMortModifierType== SimContext::MORT_MOD_INCREMENTAL){
-			//Incremental method increments probability of death in proportion to the probability of not dying to ensure it stays less than or equal to 1
-			double extraBackgroundMortRisk = simContext->getNatHistInputs()->backgroundMortModifier;
-			//Convert rate to prob first
-			double probDeathBackgroundMort = CepacUtil::rateToProb(backgroundDeathRate);
-			probDeathBackgroundMort =probDeathBackgroundMort + extraBackgroundMortRisk - (probDeathBackgroundMort*extraBackgroundMortRisk);
-			probDeathBackgroundMort = max(probDeathBackgroundMort, 0.0);
-			// Do data validation check here since it can't be done in the input sheet
-			if(probDeathBackgroundMort < 1.0){
-				backgroundDeathRate = CepacUtil::probToRate(probDeathBackgroundMort);
-			}
-		}
-		else if (simContext->getNatHistInputs()->backgroundMortModifierType == SimContext::MORT_MOD_MULT){
-			backgroundDeathRate *= simContext->getNatHistInputs()->backgroundMortModifier;
-		}	
-		// Add background mortality 
+		// Add background mortality, adjusted by the overall modifier
+		backgroundDeathRate = simContext->getBackgroundDeathRate(SimContext::BKGD_MORT_RATIO_NONE, gender, ageYears);
 		addMortalityRisk(SimContext::DTH_BKGD_MORT, backgroundDeathRate);
 		// Add risk of death from the generic risk factors if applicable
 		for (int i = 0; i < SimContext::RISK_FACT_NUM; i++){
@@ -145,7 +113,7 @@ void MortalityUpdater::performMonthlyUpdates() {
 				if(patient->getDiseaseState()->hasTrueOIHistory[oiType] && simContext->getRunSpecsInputs()->severeOIs[oiType]){
 					int monthsSince = monthNum - patient->getDiseaseState()->lastMonthSevereOI[oiType];
 					// Check if this is TB being modeled as a severe OI when the TB tab is not enabled 
-					if(!simContext->getTBInputs()->enableTB && simContext->getRunSpecsInputs()->OIsIncludeTB && oiType==0){
+					if(!simContext->isTBEnabled() && simContext->getRunSpecsInputs()->OIsIncludeTB && oiType==0){
 						if(monthNum > 0 && monthsSince <=natHist->TB_OIHistEffectDuration){
 							OIHistDeathRateRatio = natHist->TB_OIHistDeathRateRatio;
 							maxOIHistDeathRateRatio = max(maxOIHistDeathRateRatio, OIHistDeathRateRatio);
@@ -168,35 +136,17 @@ void MortalityUpdater::performMonthlyUpdates() {
 	}		
 	// Add mortality risks for late childhood
 	else if (pedsAgeCat == SimContext::PEDS_AGE_LATE){
-		// Add background mortality; start with the adult background death rates from the NatHist tab
-		backgroundDeathRate = natHist->monthlyBackgroundDeathRate[gender][ageYears];
-		// Modify by maternal mortality death rate ratio for late childhood if applicable
+		// Add background mortality; the adult background death rates from the NatHist tab, modified by the maternal mortality death rate ratio for late childhood if applicable and by the overall modifier
+		SimContext::BKGD_MORT_RATIO_TYPE ratioType = SimContext::BKGD_MORT_RATIO_NONE;
 		if (!patient->getPedsState()->isMotherAlive && monthNum < patient->getPedsState()->monthOfMaternalDeath + simContext->getPedsInputs()->durationMaternalMortDeathRateRatioLate){
 			if(patient->getDiseaseState()->infectedHIVState == SimContext::HIV_INF_NEG){
-				backgroundDeathRate *= simContext->getPedsInputs()->maternalMortDeathRateRatioLateHIVNeg;	
-			}	
-			else{
-				backgroundDeathRate *= simContext->getPedsInputs()->maternalMortDeathRateRatioLateHIVPos;
+				ratioType = SimContext::BKGD_MORT_RATIO_MATERNAL_HIV_NEG;
 			}
-		}	
-		
-		// Adjust background mortality by overall modifier if applicable
-		if (simContext->getNatHistInputs()->backgroundMortModifierType== SimContext::MORT_MOD_INCREMENTAL){
-			//Incremental method increments probability of death in proportion to the probability of not dying to ensure it stays less than or equal to 1
-			double extraBackgroundMortRisk = simContext->getNatHistInputs()->backgroundMortModifier;
-			//Convert rate to prob first
-			double probDeathBackgroundMort = CepacUtil::rateToProb(backgroundDeathRate);
-			probDeathBackgroundMort =probDeathBackgroundMort + extraBackgroundMortRisk - (probDeathBackgroundMort*extraBackgroundMortRisk);
-			probDeathBackgroundMort = max(probDeathBackgroundMort, 0.0);
-			// Do data validation check here since it can't be done in the input sheet
-			if(probDeathBackgroundMort < 1.0){
-				backgroundDeathRate = CepacUtil::probToRate(probDeathBackgroundMort);
+			else{
+				ratioType = SimContext::BKGD_MORT_RATIO_MATERNAL_HIV_POS;
 			}
 		}
-		else if (simContext->getNatHistInputs()->backgroundMortModifierType == SimContext::MORT_MOD_MULT){
-			backgroundDeathRate *= simContext->getNatHistInputs()->backgroundMortModifier;
-		}	
-		
+		backgroundDeathRate = simContext->getBackgroundDeathRate(ratioType, gender, ageYears);
 		addMortalityRisk(SimContext::DTH_BKGD_MORT, backgroundDeathRate);
 		// Add risk of death from the generic risk factors if applicable
 		for (int i = 0; i < SimContext::RISK_FACT_NUM; i++){
@@ -228,7 +178,7 @@ void MortalityUpdater::performMonthlyUpdates() {
 				if(patient->getDiseaseState()->hasTrueOIHistory[oiType] && simContext->getRunSpecsInputs()->severeOIs[oiType]){
 					int monthsSince = monthNum - patient->getDiseaseState()->lastMonthSevereOI[oiType];
 					// Check if this is TB being modeled as a severe OI when the TB tab is not enabled 
-					if(!simContext->getTBInputs()->enableTB && simContext->getRunSpecsInputs()->OIsIncludeTB && oiType==0){
+					if(!simContext->isTBEnabled() && simContext->getRunSpecsInputs()->OIsIncludeTB && oiType==0){
 						if(monthNum > 0 && monthsSince <= simContext->getPedsInputs()->TB_OIHistEffectDurationPedsLate){
 							OIHistDeathRateRatio = simContext->getPedsInputs()->TB_OIHistDeathRateRatioPedsLate;
 							maxOIHistDeathRateRatio = max(maxOIHistDeathRateRatio, OIHistDeathRateRatio);
@@ -251,47 +201,17 @@ void MortalityUpdater::performMonthlyUpdates() {
 	}	
 	// Add mortality risks for early childhood
 	else {		
-		// Add background mortality; start with the pediatric background death rates
-		if (simContext->getPedsInputs()->useExposedUninfectedDefs && patient->getDiseaseState()->useHEUMortality){	
-			backgroundDeathRate = simContext->getPedsInputs()->backgroundDeathRateExposedUninfectedEarly[gender][pedsAgeCat];
-		}
-		else{
-			backgroundDeathRate = simContext->getPedsInputs()->backgroundDeathRateEarly[gender][pedsAgeCat];
-		}	
-		// Modify by maternal mortality death rate ratios for early childhood if applicable 
+		// Add background mortality; the pediatric background death rates, modified by the maternal mortality or replacement feeding death rate ratios for early childhood if applicable and by the overall modifier
+		SimContext::BKGD_MORT_RATIO_TYPE ratioType = SimContext::BKGD_MORT_RATIO_NONE;
+		bool isHIVNeg = (patient->getDiseaseState()->infectedHIVState == SimContext::HIV_INF_NEG);
 		if (!patient->getPedsState()->isMotherAlive && monthNum < patient->getPedsState()->monthOfMaternalDeath + simContext->getPedsInputs()->durationMaternalMortDeathRateRatioEarly){
-			if(patient->getDiseaseState()->infectedHIVState == SimContext::HIV_INF_NEG){
-				backgroundDeathRate *= simContext->getPedsInputs()->maternalMortDeathRateRatioEarlyHIVNeg;
-			}	
-			else {
-				backgroundDeathRate *= simContext->getPedsInputs()->maternalMortDeathRateRatioEarlyHIVPos;
-			}	
+			ratioType = isHIVNeg ? SimContext::BKGD_MORT_RATIO_MATERNAL_HIV_NEG : SimContext::BKGD_MORT_RATIO_MATERNAL_HIV_POS;
 		}
-		// Modify by replacement feeding death rate ratios if applicable - only if the mother is alive, to avoid the potential for applying both this and the maternal mortality death rate ratio in the same month
+		// Replacement feeding death rate ratios only apply if the mother is alive, to avoid the potential for applying both this and the maternal mortality death rate ratio in the same month
 		if (patient->getPedsState()->isMotherAlive && patient->getPedsState()->breastfeedingStoppedEarly && (monthNum < patient->getPedsState()->monthOfReplacementFeedingStart + simContext->getPedsInputs()->durationReplacementFedDeathRateRatioEarly)){
-			if(patient->getDiseaseState()->infectedHIVState == SimContext::HIV_INF_NEG){
-				backgroundDeathRate *= simContext->getPedsInputs()->replacementFedDeathRateRatioEarlyHIVNeg;
-			}	
-			else{
-				backgroundDeathRate *= simContext->getPedsInputs()->replacementFedDeathRateRatioEarlyHIVPos;	
-			}	
+			ratioType = isHIVNeg ? SimContext::BKGD_MORT_RATIO_REPLACEMENT_FED_HIV_NEG : SimContext::BKGD_MORT_RATIO_REPLACEMENT_FED_HIV_POS;
 		}
-		// Adjust background mortality by overall modifier if applicable
-		if (simContext->getNatHistInputs()->backgroundMortModifierType== SimContext::MORT_MOD_INCREMENTAL){
-			//Incremental method increments probability of death in proportion to the probability of not dying to ensure it stays less than or equal to 1
-			double extraBackgroundMortRisk = simContext->getNatHistInputs()->backgroundMortModifier;
-			//Convert rate to prob first
-			double probDeathBackgroundMort = CepacUtil::rateToProb(backgroundDeathRate);
-			probDeathBackgroundMort =probDeathBackgroundMort + extraBackgroundMortRisk - (probDeathBackgroundMort*extraBackgroundMortRisk);
-			probDeathBackgroundMort = max(probDeathBackgroundMort, 0.0);
-			// Do data validation check here since it can't be done in the input sheet
-			if(probDeathBackgroundMort < 1.0){
-				backgroundDeathRate = CepacUtil::probToRate(probDeathBackgroundMort);
-			}
-		}
-		else if (simContext->getNatHistInputs()->backgroundMortModifierType == SimContext::MORT_MOD_MULT){
-			backgroundDeathRate *= simContext->getNatHistInputs()->backgroundMortModifier;
-		}	
+		backgroundDeathRate = simContext->getBackgroundDeathRateEarly(patient->getDiseaseState()->useHEUMortality, ratioType, gender, pedsAgeCat);
 		addMortalityRisk(SimContext::DTH_BKGD_MORT, backgroundDeathRate);
 		// Add risk of death from the generic risk factors if applicable
 		for (int i = 0; i < SimContext::RISK_FACT_NUM; i++){
@@ -323,7 +243,7 @@ void MortalityUpdater::performMonthlyUpdates() {
 				if(patient->getDiseaseState()->hasTrueOIHistory[oiType] && simContext->getRunSpecsInputs()->severeOIs[oiType]){
 					int monthsSince = monthNum - patient->getDiseaseState()->lastMonthSevereOI[oiType];
 					// Check if this is TB being modeled as a severe OI when the TB tab is not enabled 
-					if(!simContext->getTBInputs()->enableTB && simContext->getRunSpecsInputs()->OIsIncludeTB && oiType==0){
+					if(!simContext->isTBEnabled() && simContext->getRunSpecsInputs()->OIsIncludeTB && oiType==0){
 						if(monthNum > 0 && monthsSince <= simContext->getPedsInputs()->TB_OIHistEffectDurationPedsEarly){
 							OIHistDeathRateRatio = simContext->getPedsInputs()->TB_OIHistDeathRateRatioPedsEarly[pedsAgeCat];
 							maxOIHistDeathRateRatio = max(maxOIHistDeathRateRatio, OIHistDeathRateRatio);	
@@ -349,42 +269,32 @@ void MortalityUpdater::performMonthlyUpdates() {
 	int causeOfDeathId = 0;
 	double probDeath = 0.0;
 
-	const vector<SimContext::MortalityRisk> &mortalityRisks = patient->getDiseaseState()->mortalityRisks;
+	const SimContext::MortalityRiskList &mortalityRisks = patient->getDiseaseState()->mortalityRisks;
 	int numRisks = mortalityRisks.size();
-	double rateRatioProduct = 1.0;
-	for(int i=0;i< numRisks;i++){
-		rateRatioProduct *= mortalityRisks[i].deathRateRatio;
-	}
+	double rateRatioProduct = mortalityRisks.getRateRatioProduct();
 	probDeath = CepacUtil::rateToProb(rateRatioProduct);
 	double randNum = CepacUtil::getRandomDouble(120010, patient);
 	if (randNum < probDeath)
 		deathOccurs = true;
 	if (deathOccurs) {
-		double *indivDeathRate = new double[numRisks];
+		// Choose the cause of death in proportion to the death rate of each risk, computing the rates again rather than storing them
 		double sumOfRates = 0.0;
 		for (int i = 0; i < numRisks; i++){
-			if (mortalityRisks[i].causeOfDeath == SimContext::DTH_BKGD_MORT){
-				indivDeathRate[i] = natHist->monthlyBackgroundDeathRate[gender][ageYears];
-			}
-			else{
-				indivDeathRate[i] = natHist->monthlyBackgroundDeathRate[gender][ageYears] * mortalityRisks[i].deathRateRatio;
-			}
-			sumOfRates += indivDeathRate[i];
+			sumOfRates += getRiskDeathRate(mortalityRisks[i], gender, ageYears);
 		}
 		randNum = CepacUtil::getRandomDouble(120020, patient);
 		for (int i = 0; i < numRisks; i++){
-			indivDeathRate[i] = indivDeathRate[i] / sumOfRates;
-			if ((indivDeathRate[i] > 0) && (randNum < indivDeathRate[i])){
+			double indivDeathProportion = getRiskDeathRate(mortalityRisks[i], gender, ageYears) / sumOfRates;
+			if ((indivDeathProportion > 0) && (randNum < indivDeathProportion)){
 				causeOfDeathId = i;
 				break;
 			}
-			randNum -= indivDeathRate[i];
+			randNum -= indivDeathProportion;
 		}
-		delete[] indivDeathRate;
 
 		/** Perform death-related updates */
 		/* Set unfavorable outcome for TB if death occurs during initial treatment*/
-		if (simContext->getTBInputs()->enableTB){
+		if (simContext->isTBEnabled()){
 			if ((patient->getTBState()->isOnTreatment || patient->getTBState()->isOnEmpiricTreatment) && !patient->getTBState()->everHadNonInitialTreatmentOrEmpiric)
 				setTBUnfavorableOutcome(SimContext::TB_UNFAVORABLE_DEATH);
 		}
@@ -399,3 +309,17 @@ void MortalityUpdater::performMonthlyUpdates() {
 		}		
 	}
 } /* end performMonthlyUpdates */
+
+/** \brief getRiskDeathRate returns the death rate of a mortality risk used to choose the cause of death: the background
+ * death rate, multiplied by the death rate ratio of the risk unless it is background mortality
+ *
+ * \param mortalityRisk the risk of death
+ * \param gender the gender of the patient
+ * \param ageYears the age of the patient in years
+ **/
+double MortalityUpdater::getRiskDeathRate(const SimContext::MortalityRisk &mortalityRisk, SimContext::GENDER_TYPE gender, int ageYears) {
+	double backgroundDeathRate = simContext->getNatHistInputs()->monthlyBackgroundDeathRate[gender][ageYears];
+	if (mortalityRisk.causeOfDeath == SimContext::DTH_BKGD_MORT)
+		return backgroundDeathRate;
+	return backgroundDeathRate * mortalityRisk.deathRateRatio;
+} /* end getRiskDeathRate */
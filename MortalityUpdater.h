@@ -16,4 +16,7 @@ public:
 	void performInitialUpdates();
 	/* performMonthlyUpdates perform all of the state and statistics updates for a simulated month */
 	void performMonthlyUpdates();
+private:
+	/* getRiskDeathRate returns the death rate of a mortality risk used to choose the cause of death */
+	double getRiskDeathRate(const SimContext::MortalityRisk &mortalityRisk, SimContext::GENDER_TYPE gender, int ageYears);
 };
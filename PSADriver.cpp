@@ -0,0 +1,342 @@
+#include "include.h"
+
+/** Names of the distributions in the .psa file and their numbers of parameters, in the order of PSADriver::Distribution */
+const char *PSADriver::DIST_STRS[] = {
+	"uniform", "uniformint", "normal", "lognormal", "beta", "gamma", "triangular"
+};
+const int PSADriver::DIST_NUM_PARAMS[] = {
+	2, 2, 2, 2, 2, 2, 3
+};
+
+/** \brief Constructor takes the name of the .psa file, which is read by readPSAFile
+ *
+ * \param psaFileName the name of the .psa file in the inputs directory
+ **/
+PSADriver::PSADriver(string psaFileName) {
+	this->psaFileName = psaFileName;
+	psaName = psaFileName;
+	size_t psaLength = strlen(CepacUtil::FILE_EXTENSION_FOR_PSA);
+	if ((psaName.size() > psaLength) &&
+			(psaName.compare(psaName.size() - psaLength, psaLength, CepacUtil::FILE_EXTENSION_FOR_PSA) == 0))
+		psaName.erase(psaName.size() - psaLength);
+	numDraws = 0;
+	seed = 1;
+} /* end Constructor */
+
+/** \brief Destructor is empty, no cleanup required */
+PSADriver::~PSADriver(void) {
+
+} /* end Destructor */
+
+/** \brief readPSAFile reads the .psa file and samples the values of all the draws, throws the error if the file is invalid
+ *
+ * The first line of the .psa file is BaseInputFile and the name of the base input file.  The other lines are
+ * PSANumDraws and the number of draws, optionally PSASeed and the seed the values are sampled with (1 if not
+ * given), and one line per sampled input value: a label of the base input file, followed by the name of a
+ * distribution and its parameters.  The value sampled replaces the first value after the label, label#n samples
+ * the value after its nth occurrence and label@k its kth value.  The distributions are uniform min max,
+ * uniformint min max, normal mean stdDev, lognormal mean stdDev (of the log of the value), beta alpha beta,
+ * gamma shape scale, and triangular min mode max.  Inputs read as integers must be sampled with uniformint
+ **/
+void PSADriver::readPSAFile() {
+	InputReader psaFile;
+	if (!psaFile.open(psaFileName.c_str())) {
+		string errorString = "   ERROR - Could not open PSA file ";
+		errorString.append(psaFileName);
+		throw errorString;
+	}
+	char buffer[InputReader::MAX_TOKEN_LENGTH + 1];
+	if ((psaFile.scan("%512s", buffer) != 1) || (strcmp(buffer, SimContext::OVERLAY_BASE_LABEL) != 0) ||
+			psaFile.isAtLineEnd() || (psaFile.scan("%512s", buffer) != 1)) {
+		string errorString = "   ERROR - PSA file ";
+		errorString.append(psaFileName);
+		errorString.append(" does not start with ");
+		errorString.append(SimContext::OVERLAY_BASE_LABEL);
+		errorString.append(" and the name of its base input file");
+		throw errorString;
+	}
+	baseFileName = buffer;
+
+	while (psaFile.scan("%512s", buffer) == 1) {
+		string name = buffer;
+		if (name == "PSANumDraws") {
+			if (psaFile.isAtLineEnd() || (psaFile.scan("%d", &numDraws) != 1) || (numDraws < 1)) {
+				string errorString = "   ERROR - PSANumDraws of PSA file ";
+				errorString.append(psaFileName);
+				errorString.append(" must be a positive number");
+				throw errorString;
+			}
+			continue;
+		}
+		if (name == "PSASeed") {
+			long seedValue;
+			if (psaFile.isAtLineEnd() || (psaFile.scan("%ld", &seedValue) != 1) || (seedValue < 0)) {
+				string errorString = "   ERROR - PSASeed of PSA file ";
+				errorString.append(psaFileName);
+				errorString.append(" must be a number");
+				throw errorString;
+			}
+			seed = (unsigned long) seedValue;
+			continue;
+		}
+
+		/** The label is followed by #occurrence and @value number, in either order */
+		Parameter parameter;
+		parameter.name = name;
+		parameter.overlayValue.label = name;
+		parameter.overlayValue.occurrence = 1;
+		parameter.overlayValue.firstValue = 0;
+		size_t suffixStart = parameter.overlayValue.label.find_first_of("#@", 1);
+		if (suffixStart != string::npos) {
+			const char *occurrenceStr = strchr(name.c_str() + suffixStart, '#');
+			const char *valueNumStr = strchr(name.c_str() + suffixStart, '@');
+			if (occurrenceStr != NULL)
+				parameter.overlayValue.occurrence = atoi(occurrenceStr + 1);
+			if (valueNumStr != NULL)
+				parameter.overlayValue.firstValue = atoi(valueNumStr + 1) - 1;
+			parameter.overlayValue.label.erase(suffixStart);
+		}
+		int distribution = DIST_NUM_TYPES;
+		if (!psaFile.isAtLineEnd() && (psaFile.scan("%512s", buffer) == 1)) {
+			for (distribution = 0; distribution < DIST_NUM_TYPES; distribution++) {
+				if (strcmp(buffer, DIST_STRS[distribution]) == 0)
+					break;
+			}
+		}
+		bool isValid = (distribution < DIST_NUM_TYPES) && (parameter.overlayValue.occurrence >= 1) &&
+			(parameter.overlayValue.firstValue >= 0);
+		for (int i = 0; isValid && (i < DIST_NUM_PARAMS[distribution]); i++) {
+			if (psaFile.isAtLineEnd() || (psaFile.scan("%lf", &parameter.distributionParams[i]) != 1))
+				isValid = false;
+		}
+		if (isValid) {
+			parameter.distribution = (Distribution) distribution;
+			const double *params = parameter.distributionParams;
+			switch (parameter.distribution) {
+				case DIST_UNIFORM:
+				case DIST_UNIFORM_INT:
+					isValid = (params[0] <= params[1]);
+					break;
+				case DIST_NORMAL:
+				case DIST_LOGNORMAL:
+					isValid = (params[1] >= 0);
+					break;
+				case DIST_BETA:
+				case DIST_GAMMA:
+					isValid = (params[0] > 0) && (params[1] > 0);
+					break;
+				case DIST_TRIANGULAR:
+					isValid = (params[0] <= params[1]) && (params[1] <= params[2]) && (params[0] < params[2]);
+					break;
+			}
+		}
+		if (!isValid || !psaFile.isAtLineEnd()) {
+			string errorString = "   ERROR - PSA file ";
+			errorString.append(psaFileName);
+			errorString.append(" has an invalid label, distribution or parameters for ");
+			errorString.append(name);
+			throw errorString;
+		}
+		parameters.push_back(parameter);
+	}
+	if (numDraws == 0) {
+		string errorString = "   ERROR - PSA file ";
+		errorString.append(psaFileName);
+		errorString.append(" does not give PSANumDraws");
+		throw errorString;
+	}
+
+	sampleDraws();
+	DrawResults notRun;
+	notRun.isRun = false;
+	drawResults.assign(numDraws, notRun);
+} /* end readPSAFile */
+
+/** \brief getPSAFileName returns the name of the .psa file */
+string PSADriver::getPSAFileName() {
+	return psaFileName;
+} /* end getPSAFileName */
+
+/** \brief getNumDraws returns the number of draws of the PSA */
+int PSADriver::getNumDraws() {
+	return numDraws;
+} /* end getNumDraws */
+
+/** \brief getDrawName returns the run name of a draw, the name of the .psa file followed by the draw number from 1
+ *
+ * \param drawNum the index of the draw, from 0
+ **/
+string PSADriver::getDrawName(int drawNum) {
+	char buffer[32];
+	sprintf(buffer, "_%d", drawNum + 1);
+	string drawName = psaName;
+	drawName.append(buffer);
+	return drawName;
+} /* end getDrawName */
+
+/** \brief readDrawInputs reads the inputs of a draw into a SimContext: the inputs of the base input file with the draw's sampled values
+ *
+ * Throws the error if the values cannot be read, e.g. if a label is not in the base input file
+ *
+ * \param drawNum the index of the draw, from 0
+ * \param simContext a pointer to the new SimContext of the draw
+ **/
+void PSADriver::readDrawInputs(int drawNum, SimContext *simContext) {
+	vector<SimContext::OverlayValue> overlayValues;
+	char buffer[32];
+	for (unsigned int i = 0; i < parameters.size(); i++) {
+		SimContext::OverlayValue overlayValue = parameters[i].overlayValue;
+		if (parameters[i].distribution == DIST_UNIFORM_INT)
+			sprintf(buffer, "%d", (int) drawValues[drawNum][i]);
+		else
+			sprintf(buffer, "%.10g", drawValues[drawNum][i]);
+		overlayValue.values.push_back(buffer);
+		overlayValues.push_back(overlayValue);
+	}
+	CepacUtil::changeDirectoryToInputs();
+	simContext->readOverlayValues(baseFileName, overlayValues);
+} /* end readDrawInputs */
+
+/** \brief addDrawResults records the outcomes of a draw whose cohort is complete, may be called concurrently
+ *
+ * \param drawNum the index of the draw, from 0
+ * \param runStats a pointer to the finalized RunStats of the draw
+ **/
+void PSADriver::addDrawResults(int drawNum, RunStats *runStats) {
+	const RunStats::PopulationSummary *popSummary = runStats->getPopulationSummary();
+	lock_guard<mutex> lock(resultsMutex);
+	DrawResults &results = drawResults[drawNum];
+	results.isRun = true;
+	results.numCohorts = popSummary->numCohorts;
+	results.costsAverage = popSummary->costsAverage;
+	results.LMsAverage = popSummary->LMsAverage;
+	results.QALMsAverage = popSummary->QALMsAverage;
+	results.costsHIVPositiveAverage = popSummary->costsHIVPositiveAverage;
+	results.LMsHIVPositiveAverage = popSummary->LMsHIVPositiveAverage;
+	results.QALMsHIVPositiveAverage = popSummary->QALMsHIVPositiveAverage;
+} /* end addDrawResults */
+
+/** \brief writeResultsFile writes the sampled values and outcomes of every draw, one row per draw in draw order, to the PSA results file
+ *
+ * Draws whose inputs could not be read are written with their sampled values only
+ **/
+void PSADriver::writeResultsFile() {
+	CepacUtil::changeDirectoryToResults();
+	string resultsFileName = psaName;
+	resultsFileName.append(CepacUtil::FILE_EXTENSION_FOR_PSA_OUTPUT);
+	FILE *resultsFile = CepacUtil::openFile(resultsFileName.c_str(), "w");
+	if (resultsFile == NULL) {
+		string errorString = "   ERROR - Could not write PSA results file ";
+		errorString.append(resultsFileName);
+		throw errorString;
+	}
+
+	fprintf(resultsFile, "PSA \t%s\tBASE INPUT FILE \t%s\tDRAWS \t%d\tSEED \t%lu\n", psaName.c_str(), baseFileName.c_str(), numDraws, seed);
+	fprintf(resultsFile, "DRAW ");
+	for (unsigned int i = 0; i < parameters.size(); i++)
+		fprintf(resultsFile, "\t%s", parameters[i].name.c_str());
+	fprintf(resultsFile, "\tCOHORT \tCOST \tLMs \tQALMs \tHIV+ COST \tHIV+ LMs \tHIV+ QALMs\n");
+	for (int i = 0; i < numDraws; i++) {
+		fprintf(resultsFile, "%d", i + 1);
+		for (unsigned int j = 0; j < parameters.size(); j++) {
+			if (parameters[j].distribution == DIST_UNIFORM_INT)
+				fprintf(resultsFile, "\t%d", (int) drawValues[i][j]);
+			else
+				fprintf(resultsFile, "\t%.10g", drawValues[i][j]);
+		}
+		const DrawResults &results = drawResults[i];
+		if (results.isRun) {
+			fprintf(resultsFile, "\t%d\t%1.2lf\t%1.4lf\t%1.4lf\t%1.2lf\t%1.4lf\t%1.4lf\n", results.numCohorts,
+				results.costsAverage, results.LMsAverage, results.QALMsAverage,
+				results.costsHIVPositiveAverage, results.LMsHIVPositiveAverage, results.QALMsHIVPositiveAverage);
+		}
+		else {
+			fprintf(resultsFile, "\tNOT RUN\n");
+		}
+	}
+	CepacUtil::closeFile(resultsFile);
+} /* end writeResultsFile */
+
+/** \brief sampleDraws samples the values of every draw, draw by draw, from a generator seeded with the PSA seed */
+void PSADriver::sampleDraws() {
+	MTRand_open randomGenerator(seed);
+	drawValues.assign(numDraws, vector<double>(parameters.size()));
+	for (int i = 0; i < numDraws; i++) {
+		for (unsigned int j = 0; j < parameters.size(); j++)
+			drawValues[i][j] = sampleValue(parameters[j], &randomGenerator);
+	}
+} /* end sampleDraws */
+
+/** \brief sampleValue returns a value sampled from the distribution of a parameter
+ *
+ * \param parameter the sampled input value, with its distribution and parameters
+ * \param randomGenerator a pointer to the generator of uniform draws in (0, 1)
+ **/
+double PSADriver::sampleValue(const Parameter &parameter, MTRand_open *randomGenerator) {
+	const double *params = parameter.distributionParams;
+	switch (parameter.distribution) {
+		case DIST_UNIFORM:
+			return params[0] + (params[1] - params[0]) * (*randomGenerator)();
+		case DIST_UNIFORM_INT: {
+			double numValues = floor(params[1]) - ceil(params[0]) + 1;
+			return ceil(params[0]) + min(floor(numValues * (*randomGenerator)()), numValues - 1);
+		}
+		case DIST_NORMAL:
+			return params[0] + params[1] * sampleGaussian(randomGenerator);
+		case DIST_LOGNORMAL:
+			return exp(params[0] + params[1] * sampleGaussian(randomGenerator));
+		case DIST_BETA: {
+			double x = sampleGamma(params[0], randomGenerator);
+			double y = sampleGamma(params[1], randomGenerator);
+			return x / (x + y);
+		}
+		case DIST_GAMMA:
+			return params[1] * sampleGamma(params[0], randomGenerator);
+		case DIST_TRIANGULAR: {
+			/** Inverse of the cumulative distribution function */
+			double randNum = (*randomGenerator)();
+			double modeFraction = (params[1] - params[0]) / (params[2] - params[0]);
+			if (randNum < modeFraction)
+				return params[0] + sqrt(randNum * (params[2] - params[0]) * (params[1] - params[0]));
+			return params[2] - sqrt((1 - randNum) * (params[2] - params[0]) * (params[2] - params[1]));
+		}
+	}
+	return 0;
+} /* end sampleValue */
+
+/** \brief sampleGaussian returns a standard normal value, using the polar method as CepacUtil::getRandomGaussian does
+ *
+ * \param randomGenerator a pointer to the generator of uniform draws in (0, 1)
+ **/
+double PSADriver::sampleGaussian(MTRand_open *randomGenerator) {
+	double x, y, radiusSquared;
+	do {
+		x = 2 * (*randomGenerator)() - 1;
+		y = 2 * (*randomGenerator)() - 1;
+		radiusSquared = x * x + y * y;
+	} while ((radiusSquared >= 1) || (radiusSquared == 0));
+	return x * sqrt(-2 * log(radiusSquared) / radiusSquared);
+} /* end sampleGaussian */
+
+/** \brief sampleGamma returns a value from a gamma distribution with the given shape and a scale of 1, using the
+ * method of Marsaglia and Tsang, with a shape below 1 boosted to shape + 1
+ *
+ * \param shape the shape of the gamma distribution, greater than 0
+ * \param randomGenerator a pointer to the generator of uniform draws in (0, 1)
+ **/
+double PSADriver::sampleGamma(double shape, MTRand_open *randomGenerator) {
+	if (shape < 1)
+		return sampleGamma(shape + 1, randomGenerator) * pow((*randomGenerator)(), 1.0 / shape);
+	double d = shape - 1.0 / 3.0;
+	double c = 1.0 / sqrt(9.0 * d);
+	while (true) {
+		double x = sampleGaussian(randomGenerator);
+		double v = 1 + c * x;
+		if (v <= 0)
+			continue;
+		v = v * v * v;
+		double randNum = (*randomGenerator)();
+		if (log(randNum) < 0.5 * x * x + d - d * v + d * log(v))
+			return d * v;
+	}
+} /* end sampleGamma */
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "include.h"
+
+/**
+	PSADriver runs a probabilistic sensitivity analysis (PSA) described by a .psa file: a base input file, the
+	number of draws, and the distribution each of a set of labeled input values is sampled from.  The values of
+	all the draws are sampled when the .psa file is read, from a generator seeded by the file, so the draws do
+	not depend on the number of threads.  Each draw is read as a scenario overlay of the base input file with its
+	sampled values, sharing the parsed base inputs, and is run by the RunScheduler like an input file; instead of
+	writing output files, its results are added to one table written to the PSA results file at the end.
+*/
+class PSADriver
+{
+public:
+	/* Constructor and Destructor */
+	PSADriver(string psaFileName);
+	~PSADriver(void);
+
+	/** Distributions the input values may be sampled from, their names in the .psa file and their numbers of parameters */
+	enum Distribution {DIST_UNIFORM, DIST_UNIFORM_INT, DIST_NORMAL, DIST_LOGNORMAL, DIST_BETA, DIST_GAMMA, DIST_TRIANGULAR};
+	static const int DIST_NUM_TYPES = 7;
+	static const char *DIST_STRS[];
+	static const int DIST_NUM_PARAMS[];
+	static const int DIST_MAX_PARAMS = 3;
+
+	/* Functions to read the .psa file, read in a draw's inputs and record its results, and write the results table */
+	void readPSAFile();
+	string getPSAFileName();
+	int getNumDraws();
+	string getDrawName(int drawNum);
+	void readDrawInputs(int drawNum, SimContext *simContext);
+	void addDrawResults(int drawNum, RunStats *runStats);
+	void writeResultsFile();
+
+private:
+	/** Parameter is an input value sampled for each draw, the value after an occurrence of a label */
+	class Parameter {
+	public:
+		/** The label, occurrence, and value number as written in the .psa file */
+		string name;
+		SimContext::OverlayValue overlayValue;
+		Distribution distribution;
+		double distributionParams[DIST_MAX_PARAMS];
+	};
+
+	/** DrawResults holds the outcomes of a draw written to the PSA results file */
+	class DrawResults {
+	public:
+		bool isRun;
+		int numCohorts;
+		double costsAverage;
+		double LMsAverage;
+		double QALMsAverage;
+		double costsHIVPositiveAverage;
+		double LMsHIVPositiveAverage;
+		double QALMsHIVPositiveAverage;
+	};
+
+	/** Names of the .psa file, of the analysis (the .psa file name without its extension), and of the base input file */
+	string psaFileName;
+	string psaName;
+	string baseFileName;
+	/** Number of draws, and the seed of the generator their values are sampled with */
+	int numDraws;
+	unsigned long seed;
+	/** The sampled inputs, and the values sampled for each draw, indexed by draw then parameter */
+	vector<Parameter> parameters;
+	vector<vector<double> > drawValues;
+	/** Results of each draw, guarded by resultsMutex since draws may finish concurrently */
+	vector<DrawResults> drawResults;
+	mutex resultsMutex;
+
+	/* Functions for sampling the values of the draws */
+	void sampleDraws();
+	double sampleValue(const Parameter &parameter, MTRand_open *randomGenerator);
+	double sampleGaussian(MTRand_open *randomGenerator);
+	double sampleGamma(double shape, MTRand_open *randomGenerator);
+};
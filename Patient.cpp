@@ -5,7 +5,8 @@
 #pragma warning(disable:4355)
 
 /** Constructor takes in the patient number, simulation context, run stats object, and tracing object
-	Initializes all subclass state values
+	Initializes all subclass state values; the state objects are value initialized so that any field not set by the
+	updaters starts at zero rather than holding whatever the previous patient left in the reused memory
 
 	\param *simContext a pointer to the SimContext the patient should use for inputs
 	\param *runStats a pointer to the RunStats the patient should use for outputs
@@ -22,6 +23,14 @@ Patient::Patient(SimContext *simContext, RunStats *runStats, CostStats *costStat
 		runStats(runStats),
 		costStats(costStats),
 		tracer(tracer),
+		randomGenerator(MTRand_unseeded()),
+		generalState(),
+		pedsState(),
+		diseaseState(),
+		monitoringState(),
+		prophState(),
+		artState(),
+		tbState(),
 		beginMonthUpdater(this),
 		hivInfectionUpdater(this),
 		chrmsUpdater(this),
@@ -255,8 +255,8 @@ public:
 		int monthOfCHRMsStageStart[SimContext::CHRM_NUM][SimContext::CHRM_TIME_PER_NUM];
 		/** A boolean that is true if the patient is currently alive*/
 		bool isAlive;
-		/** A vector of the patient's mortality risks*/
-		vector<SimContext::MortalityRisk> mortalityRisks;
+		/** The patient's mortality risks for the current month*/
+		SimContext::MortalityRiskList mortalityRisks;
 		/** The patient's cause of death (not assigned until death)*/
 		SimContext::DTH_CAUSES causeOfDeath;
 		/** True if the patient is HIV negative and fits user definitions of HIV exposure (used for mortality with peds early childhood)*/
@@ -715,6 +715,15 @@ public:
 		int incompleteTreatmentLine;
 	}; /* end TBState */
 
+	/** SpareGaussian holds the unused second deviate of a polar Box-Muller draw, returned by the next normal draw at the same call site */
+	class SpareGaussian {
+	public:
+		/** Call site the deviate was drawn for, -1 if there is no spare deviate */
+		int callSiteId;
+		/** Standard normal deviate */
+		double value;
+	}; /* end SpareGaussian */
+
 	/* Accessor functions return const pointers to the Patient state subclass objects */
 	const GeneralState *getGeneralState();
 	const PedsState *getPedsState();
@@ -728,6 +737,11 @@ public:
 	CD4TestUpdater *getCD4TestUpdater();
 	HVLTestUpdater *getHVLTestUpdater();
 
+	/* Accessor functions return pointers to the patient's own random number generators */
+	MTRand *getRandomGenerator();
+	PhiloxRand *getCounterRandomGenerator();
+	SpareGaussian *getSpareGaussian();
+
 	/* simulateMonth runs a single month of simulation for this patient, and updates
 		its state and runStats statistics */
 	void simulateMonth();
@@ -747,6 +761,12 @@ private:
 	CostStats *costStats;
 	/** pointer to the trace object */
 	Tracer *tracer;
+	/** random number generator for this patient, left unseeded by the constructor and seeded by BeginMonthUpdater from the patient number, so its draws do not depend on other patients or threads */
+	MTRand randomGenerator;
+	/** counter-based random number generator for this patient, used instead of randomGenerator if CepacUtil::useCounterRandom is set */
+	PhiloxRand counterRandomGenerator;
+	/** spare normal deviate, only used if CepacUtil::gaussianMethod is GAUSSIAN_POLAR_CACHED */
+	SpareGaussian spareGaussian;
 
 	/** Patient state subclass object */
 	GeneralState generalState;
@@ -841,6 +861,21 @@ inline HVLTestUpdater *Patient::getHVLTestUpdater() {
 	return &hvlTestUpdater;
 }
 
+/** getRandomGenerator returns a pointer to the patient's random number generator */
+inline MTRand *Patient::getRandomGenerator() {
+	return &randomGenerator;
+}
+
+/** getCounterRandomGenerator returns a pointer to the patient's counter-based random number generator */
+inline PhiloxRand *Patient::getCounterRandomGenerator() {
+	return &counterRandomGenerator;
+}
+
+/** getSpareGaussian returns a pointer to the patient's spare normal deviate */
+inline Patient::SpareGaussian *Patient::getSpareGaussian() {
+	return &spareGaussian;
+}
+
 /** Force new infection if the patient is negative; to be called by the transmission model*/
 inline void Patient::forceNewInfection() {
 	if (diseaseState.infectedHIVState == SimContext::HIV_INF_NEG){
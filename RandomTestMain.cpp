@@ -0,0 +1,366 @@
+// RandomTestMain.cpp : Defines the main entry point for cepac-random-test, which checks and times the random number generators
+//
+
+#include "include.h"
+
+/** Functions that draw random numbers, and the position of their call site id argument */
+static const char *RANDOM_FUNCTION_NAMES[] = {"getRandomDouble", "getRandomGaussian", "getRandomDiscrete", "getZigguratGaussian", "getCounterRandomDouble"};
+static const int RANDOM_FUNCTION_CALL_SITE_ARGS[] = {0, 2, 2, 0, 0};
+static const int NUM_RANDOM_FUNCTIONS = 5;
+
+/** Variables that are added to a call site id to give one stream to each of a fixed number of items, and their number */
+static const char *CALL_SITE_OFFSET_NAMES[] = {"assayNum"};
+static const int CALL_SITE_OFFSET_COUNTS[] = {SimContext::EID_NUM_ASSAYS};
+static const int NUM_CALL_SITE_OFFSETS = 1;
+
+/** \brief findSourceFiles returns the names of the .cpp and .h files in the current directory */
+static vector<string> findSourceFiles() {
+	const char *searchStrs[] = {"*.cpp", "*.h"};
+	vector<string> fileNames;
+	for (int searchNum = 0; searchNum < 2; searchNum++) {
+#if defined(_WIN32)
+		intptr_t hFile;
+		struct _finddata_t tFileInfo;
+		hFile = _findfirst( searchStrs[searchNum], &tFileInfo );
+		if (hFile == -1)
+			continue;
+		do {
+			fileNames.push_back((char *) tFileInfo.name);
+		} while ( _findnext ( hFile, &tFileInfo ) == 0 );
+		_findclose( hFile );
+#else
+		glob_t files;
+		if (glob(searchStrs[searchNum], GLOB_ERR, NULL, &files) != 0) {
+			globfree( &files);
+			continue;
+		}
+		for (size_t i = 0; i < files.gl_pathc; i++)
+			fileNames.push_back((char *) files.gl_pathv[i]);
+		globfree( &files);
+#endif
+	}
+	return fileNames;
+} /* end findSourceFiles */
+
+/** \brief getCallArgument returns an argument of the function call whose argument list starts at the given offset,
+ * with its whitespace removed, or an empty string if the call has fewer arguments
+ *
+ * \param contents the contents of the source file
+ * \param start the offset just past the opening parenthesis of the call
+ * \param argNum the index of the argument to return
+ **/
+static string getCallArgument(const string &contents, size_t start, int argNum) {
+	string argument;
+	int depth = 1;
+	int currArg = 0;
+	for (size_t i = start; (i < contents.size()) && (depth > 0); i++) {
+		char c = contents[i];
+		if ((c == '(') || (c == '['))
+			depth++;
+		else if ((c == ')') || (c == ']'))
+			depth--;
+		if (depth == 0)
+			break;
+		if ((c == ',') && (depth == 1))
+			currArg++;
+		else if ((currArg == argNum) && !isspace((unsigned char) c))
+			argument += c;
+	}
+	return argument;
+} /* end getCallArgument */
+
+/** \brief checkCallSites checks that every call site id passed to the random number functions in the sources is a
+ * fixed number, or a fixed number plus one of the bounded offsets, and that there are no more distinct ids than the
+ * counter-based generator holds for a patient
+ *
+ * Must be run in the source directory.  CepacUtil, which passes the ids of its callers on, and the test drivers are skipped.
+ *
+ * \return true if the check passed
+ **/
+static bool checkCallSites() {
+	vector<string> fileNames = findSourceFiles();
+	if (fileNames.empty()) {
+		printf("   ERROR - No source files were found, run cepac-random-test in the source directory\n");
+		return false;
+	}
+
+	set<int> callSiteIds;
+	bool isValid = true;
+	for (size_t fileNum = 0; fileNum < fileNames.size(); fileNum++) {
+		const string &fileName = fileNames[fileNum];
+		if ((fileName.compare(0, 9, "CepacUtil") == 0) || (fileName.find("TestMain") != string::npos))
+			continue;
+		FILE *file = fopen(fileName.c_str(), "rb");
+		if (file == NULL)
+			continue;
+		string contents;
+		char buffer[4096];
+		size_t numRead;
+		while ((numRead = fread(buffer, 1, sizeof(buffer), file)) > 0)
+			contents.append(buffer, numRead);
+		fclose(file);
+
+		for (int funcNum = 0; funcNum < NUM_RANDOM_FUNCTIONS; funcNum++) {
+			string callStr = RANDOM_FUNCTION_NAMES[funcNum];
+			callStr += "(";
+			for (size_t pos = contents.find(callStr); pos != string::npos; pos = contents.find(callStr, pos + 1)) {
+				string argument = getCallArgument(contents, pos + callStr.size(), RANDOM_FUNCTION_CALL_SITE_ARGS[funcNum]);
+				size_t numDigits = 0;
+				while ((numDigits < argument.size()) && isdigit((unsigned char) argument[numDigits]))
+					numDigits++;
+				int baseId = atoi(argument.substr(0, numDigits).c_str());
+				int numIds = -1;
+				if ((numDigits > 0) && (numDigits == argument.size()))
+					numIds = 1;
+				else if ((numDigits > 0) && (argument[numDigits] == '+')) {
+					for (int offsetNum = 0; offsetNum < NUM_CALL_SITE_OFFSETS; offsetNum++) {
+						if (argument.compare(numDigits + 1, string::npos, CALL_SITE_OFFSET_NAMES[offsetNum]) == 0)
+							numIds = CALL_SITE_OFFSET_COUNTS[offsetNum];
+					}
+				}
+				if (numIds < 0) {
+					int lineNum = 1 + (int) count(contents.begin(), contents.begin() + pos, '\n');
+					printf("   ERROR - %s:%d: call site id %s of %s is not a fixed number\n", fileName.c_str(), lineNum,
+						argument.c_str(), RANDOM_FUNCTION_NAMES[funcNum]);
+					isValid = false;
+					continue;
+				}
+				for (int i = 0; i < numIds; i++)
+					callSiteIds.insert(baseId + i);
+			}
+		}
+	}
+
+	int numCallSites = (int) callSiteIds.size();
+	printf("Call sites: %d distinct ids, the counter-based generator holds %d\n", numCallSites, PhiloxRand::MAX_CALL_SITES);
+	if (numCallSites > PhiloxRand::MAX_CALL_SITES) {
+		printf("   ERROR - There are more call site ids than PhiloxRand::MAX_CALL_SITES\n");
+		isValid = false;
+	}
+	return isValid;
+} /* end checkCallSites */
+
+/** \brief checkMersenneTwister checks that MTRand_int32, whose state is regenerated with SSE2 unless MTRAND_NO_SSE2 is
+ * defined, gives the same sequence as the scalar MT19937 of the standard library for the seeds the model uses, and the
+ * published outputs of the reference implementation for seeding with an array
+ *
+ * \return true if the check passed
+ **/
+static bool checkMersenneTwister() {
+	/** Run seed, default seed, and patient numbers, which seed the generators of patients with fixed seeds */
+	const unsigned long seeds[] = {8675309UL, 5489UL, 0UL, 1UL, 2UL, 3UL, 500UL, 501UL, 99999UL, 4294967295UL};
+	const int numSeeds = (int) (sizeof(seeds) / sizeof(seeds[0]));
+	const int numDrawsPerSeed = 1000000;
+	bool isValid = true;
+	for (int seedNum = 0; seedNum < numSeeds; seedNum++) {
+		MTRand_int32 generator(seeds[seedNum]);
+		mt19937 reference((uint32_t) seeds[seedNum]);
+		for (int i = 0; i < numDrawsPerSeed; i++) {
+			unsigned long value = generator();
+			unsigned long referenceValue = reference();
+			if (value != referenceValue) {
+				printf("   ERROR - MTRand seeded with %lu gives %lu at draw %d, MT19937 gives %lu\n", seeds[seedNum], value,
+					i, referenceValue);
+				isValid = false;
+				break;
+			}
+		}
+	}
+
+	/** First outputs of mt19937ar.c for init_by_array({0x123, 0x234, 0x345, 0x456}), which setPatientTimeSeed's seeding follows */
+	const unsigned long seedArray[] = {0x123UL, 0x234UL, 0x345UL, 0x456UL};
+	const unsigned long expectedValues[] = {1067595299UL, 955945823UL, 477289528UL, 4107218783UL, 4228976476UL};
+	MTRand_int32 arrayGenerator(seedArray, 4);
+	for (int i = 0; i < 5; i++) {
+		unsigned long value = arrayGenerator();
+		if (value != expectedValues[i]) {
+			printf("   ERROR - MTRand seeded with an array gives %lu at draw %d, MT19937 gives %lu\n", value, i, expectedValues[i]);
+			isValid = false;
+			break;
+		}
+	}
+
+#ifdef MTRAND_USE_SSE2
+	const char *implementation = "SSE2";
+#else
+	const char *implementation = "scalar";
+#endif
+	printf("Mersenne Twister (%s): %d seeds x %d draws compared with std::mt19937, %s\n", implementation, numSeeds,
+		numDrawsPerSeed, isValid ? "identical" : "DIFFERENT");
+	return isValid;
+} /* end checkMersenneTwister */
+
+/** \brief benchmarkMersenneTwister times drawing integers and doubles from MTRand against the scalar std::mt19937 */
+static void benchmarkMersenneTwister() {
+	const int numDraws = 100000000;
+	const char *methodNames[] = {"MTRand_int32", "std::mt19937", "MTRand (double)"};
+	double seconds[3];
+	unsigned long checksums[3] = {0, 0, 0};
+
+	MTRand_int32 generator(8675309UL);
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+	for (int i = 0; i < numDraws; i++)
+		checksums[0] ^= generator();
+	seconds[0] = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+
+	mt19937 reference(8675309U);
+	startTime = chrono::steady_clock::now();
+	for (int i = 0; i < numDraws; i++)
+		checksums[1] ^= reference();
+	seconds[1] = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+
+	MTRand doubleGenerator(8675309UL);
+	double sum = 0;
+	startTime = chrono::steady_clock::now();
+	for (int i = 0; i < numDraws; i++)
+		sum += doubleGenerator();
+	seconds[2] = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+	checksums[2] = (unsigned long) sum;
+
+	printf("Drawing %d numbers:\n", numDraws);
+	for (int i = 0; i < 3; i++)
+		printf("   %-18s %8.1f ms  %5.2f ns/draw  (checksum %lu)\n", methodNames[i], seconds[i] * 1e3, seconds[i] * 1e9 / numDraws, checksums[i]);
+} /* end benchmarkMersenneTwister */
+
+/** \brief createPatient reads an input file and creates a patient of its cohort, whose generator the normal deviates are drawn from
+ *
+ * \return a pointer to the new Patient, or NULL if the input file could not be read; the objects it uses are returned through the other arguments
+ **/
+static Patient *createPatient(const char *inputFileName, SimContext **simContext, RunStats **runStats, CostStats **costStats, Tracer **tracer) {
+	string runName = CepacUtil::getRunName(inputFileName);
+	*simContext = new SimContext(runName, inputFileName);
+	try {
+		(*simContext)->readInputs();
+	}
+	catch (string &errorString) {
+		printf("%s\n", errorString.c_str());
+		delete *simContext;
+		return NULL;
+	}
+	(*simContext)->setRunSeed(CepacUtil::getRunSeed(false));
+	(*simContext)->buildDerivedTables();
+	*runStats = new RunStats(runName, *simContext);
+	*costStats = new CostStats(runName, *simContext);
+	*tracer = new Tracer(runName, *simContext, 1);
+	return new Patient(*simContext, *runStats, *costStats, *tracer);
+} /* end createPatient */
+
+/** \brief checkGaussianDistribution checks the mean, variance, symmetry, and tail probabilities of the deviates drawn
+ * with the method set in CepacUtil::gaussianMethod, allowing six standard errors for each
+ *
+ * \return true if the check passed
+ **/
+static bool checkGaussianDistribution(Patient *patient, const char *methodName) {
+	const int numDraws = 10000000;
+	/** Tails from the center of the distribution out to beyond the start of the ziggurat's tail */
+	const double tailStarts[] = {0.5, 1.0, 1.5, 2.0, 2.5, 3.0, CepacUtil::zigguratX[1], 4.0, 4.5};
+	const int numTails = (int) (sizeof(tailStarts) / sizeof(tailStarts[0]));
+	int tailCounts[numTails] = {0};
+	int numPositive = 0;
+	double sum = 0, sumSquares = 0;
+	CepacUtil::setFixedSeed(patient, 8675309UL);
+	for (int i = 0; i < numDraws; i++) {
+		double value = CepacUtil::getRandomGaussian(0, 1, 0, patient);
+		sum += value;
+		sumSquares += value * value;
+		if (value > 0)
+			numPositive++;
+		for (int tailNum = 0; (tailNum < numTails) && (fabs(value) > tailStarts[tailNum]); tailNum++)
+			tailCounts[tailNum]++;
+	}
+
+	bool isValid = true;
+	double mean = sum / numDraws;
+	double variance = sumSquares / numDraws - mean * mean;
+	if ((fabs(mean) > 6 / sqrt((double) numDraws)) || (fabs(variance - 1) > 6 * sqrt(2.0 / numDraws))) {
+		printf("   ERROR - %s deviates have mean %.5f and variance %.5f\n", methodName, mean, variance);
+		isValid = false;
+	}
+	if (fabs(numPositive - 0.5 * numDraws) > 6 * sqrt(0.25 * numDraws)) {
+		printf("   ERROR - %d of %d %s deviates are positive\n", numPositive, numDraws, methodName);
+		isValid = false;
+	}
+	for (int tailNum = 0; tailNum < numTails; tailNum++) {
+		double tailProb = erfc(tailStarts[tailNum] / sqrt(2.0));
+		double expected = tailProb * numDraws;
+		if (fabs(tailCounts[tailNum] - expected) > 6 * sqrt(expected * (1 - tailProb))) {
+			printf("   ERROR - %d %s deviates beyond +-%.3f, %.0f expected\n", tailCounts[tailNum], methodName,
+				tailStarts[tailNum], expected);
+			isValid = false;
+		}
+	}
+	printf("Normal deviates (%s): mean %.5f, variance %.5f, %d beyond +-%.2f (%.0f expected), %s\n", methodName, mean,
+		variance, tailCounts[numTails - 3], tailStarts[numTails - 3], erfc(tailStarts[numTails - 3] / sqrt(2.0)) * numDraws,
+		isValid ? "normal" : "NOT NORMAL");
+	return isValid;
+} /* end checkGaussianDistribution */
+
+/** \brief checkGaussians checks and times each method of drawing normal deviates, and getRandomDouble for comparison
+ *
+ * \return true if the deviates of every method pass checkGaussianDistribution
+ **/
+static bool checkGaussians(const char *inputFileName) {
+	SimContext *simContext;
+	RunStats *runStats;
+	CostStats *costStats;
+	Tracer *tracer;
+	Patient *patient = createPatient(inputFileName, &simContext, &runStats, &costStats, &tracer);
+	if (patient == NULL)
+		return false;
+
+	const CepacUtil::GAUSSIAN_METHOD methods[] = {CepacUtil::GAUSSIAN_POLAR, CepacUtil::GAUSSIAN_POLAR_CACHED, CepacUtil::GAUSSIAN_ZIGGURAT};
+	const char *methodNames[] = {"polar", "polar cached", "ziggurat"};
+	const int numMethods = 3;
+	bool isValid = true;
+	for (int methodNum = 0; methodNum < numMethods; methodNum++) {
+		CepacUtil::gaussianMethod = methods[methodNum];
+		if (!checkGaussianDistribution(patient, methodNames[methodNum]))
+			isValid = false;
+	}
+
+	const int numDraws = 20000000;
+	printf("Drawing %d normal deviates at one call site:\n", numDraws);
+	for (int methodNum = -1; methodNum < numMethods; methodNum++) {
+		double sum = 0;
+		CepacUtil::setFixedSeed(patient, 8675309UL);
+		chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+		if (methodNum < 0) {
+			for (int i = 0; i < numDraws; i++)
+				sum += CepacUtil::getRandomDouble(0, patient);
+		}
+		else {
+			CepacUtil::gaussianMethod = methods[methodNum];
+			for (int i = 0; i < numDraws; i++)
+				sum += CepacUtil::getRandomGaussian(0, 1, 0, patient);
+		}
+		double seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+		printf("   %-18s %8.1f ms  %5.2f ns/draw  (checksum %.4f)\n", (methodNum < 0) ? "uniform" : methodNames[methodNum],
+			seconds * 1e3, seconds * 1e9 / numDraws, sum / numDraws);
+	}
+	CepacUtil::gaussianMethod = CepacUtil::GAUSSIAN_POLAR;
+
+	delete patient;
+	delete tracer;
+	delete runStats;
+	delete costStats;
+	delete simContext;
+	return isValid;
+} /* end checkGaussians */
+
+/** \brief Main function for cepac-random-test, run in the source directory, optionally with an input file for the normal deviate
+ * checks, which draw from the generator of one of its patients; returns 1 if any check fails */
+int main(int argc, char *argv[]) {
+	bool isValid = checkCallSites();
+	if (!checkMersenneTwister())
+		isValid = false;
+	benchmarkMersenneTwister();
+	if (argc > 1) {
+		if (!checkGaussians(argv[1]))
+			isValid = false;
+	}
+	else {
+		printf("Normal deviates are not checked, give an input file to draw them for one of its patients\n");
+	}
+	printf("%s\n", isValid ? "All checks passed" : "Some checks FAILED");
+	return isValid ? 0 : 1;
+} /* end main */
@@ -0,0 +1,193 @@
+#include "include.h"
+
+/** Number of runs restored from the cache */
+atomic<int> ResultCache::numHits(0);
+/** Number of cacheable runs that were not in the cache and were simulated */
+atomic<int> ResultCache::numMisses(0);
+/** Number of runs that could not be cached since they were seeded by time */
+atomic<int> ResultCache::numNotCacheable(0);
+
+/** \brief Constructor takes in the SimContext of a run whose inputs are read and whose seed is set, and computes its key
+ *
+ * The key hashes the version and build of CEPAC, the run seed and random number options, and the values of all the
+ * inputs, written as the binary input cache writes them
+ *
+ * \param simContext a pointer to the SimContext of the run
+ **/
+ResultCache::ResultCache(SimContext *simContext) {
+	this->simContext = simContext;
+	key = 0;
+
+	FILE *keyFile = tmpfile();
+	if (keyFile != NULL) {
+		writeEntryHeader(keyFile);
+		simContext->writeInputValues(keyFile);
+		rewind(keyFile);
+		key = CepacUtil::getFileHash(keyFile);
+		fclose(keyFile);
+	}
+
+	char buffer[32];
+	sprintf(buffer, "%016llx", key);
+	entryFileName = CepacUtil::resultCacheDirectory;
+	entryFileName.append("/");
+	entryFileName.append(buffer);
+	entryFileName.append(CepacUtil::FILE_EXTENSION_FOR_RESULT_CACHE);
+} /* end Constructor */
+
+/** \brief Destructor is empty, no cleanup required */
+ResultCache::~ResultCache(void) {
+
+} /* end Destructor */
+
+/** \brief isRunCacheable returns true if a result cache is used and the results of the run are deterministic, counting
+ * the runs that are not cacheable for printReport
+ *
+ * Runs seeded by time are not cached; sharded runs and PSA draws, which write no output files, are not either, and are
+ * not passed to this function
+ *
+ * \param simContext a pointer to the SimContext of the run, whose inputs are read
+ **/
+bool ResultCache::isRunCacheable(SimContext *simContext) {
+	if (CepacUtil::resultCacheDirectory.empty())
+		return false;
+	if (simContext->getRunSpecsInputs()->randomSeedByTime) {
+		numNotCacheable++;
+		return false;
+	}
+	return true;
+} /* end isRunCacheable */
+
+/** \brief readResults restores the results of the run from its cache entry, if there is one
+ *
+ * An entry that cannot be read, or that was written for other inputs, is treated as missing and is replaced once the
+ * run is simulated; as the statistics of a partly read entry may have been read, the caller replaces them
+ *
+ * \param runStats a pointer to the newly constructed RunStats object of the run
+ * \param costStats a pointer to the newly constructed CostStats object of the run
+ * \param tracer a pointer to the Tracer of the run, with its header printed
+ * \return true if the results were restored, and the run need not be simulated
+ **/
+bool ResultCache::readResults(RunStats *runStats, CostStats *costStats, Tracer *tracer) {
+	CepacUtil::changeDirectoryToInputs();
+	FILE *file = CepacUtil::openFile(entryFileName.c_str(), "rb");
+	if (file == NULL) {
+		numMisses++;
+		return false;
+	}
+
+	bool isRead = false;
+	try {
+		if (isEntryHeaderValid(file)) {
+			runStats->readCachedStats(costStats, file);
+			tracer->readCachedTrace(file);
+			isRead = (fgetc(file) == EOF);
+		}
+	}
+	catch (string &errorString) {
+		isRead = false;
+	}
+	CepacUtil::closeFile(file);
+	if (!isRead) {
+		numMisses++;
+		return false;
+	}
+	numHits++;
+	return true;
+} /* end readResults */
+
+/** \brief writeResults saves the results of a simulated run in its cache entry
+ *
+ * The entry is written to a temporary file that is then renamed, so that other runs sharing the cache directory never
+ * read a partly written entry.  Failing to write the entry is not an error.
+ *
+ * \param runStats a pointer to the RunStats object of the run, before it is finalized
+ * \param costStats a pointer to the CostStats object of the run, before it is finalized
+ * \param tracer a pointer to the Tracer of the run, still open
+ **/
+void ResultCache::writeResults(RunStats *runStats, CostStats *costStats, Tracer *tracer) {
+	CepacUtil::changeDirectoryToInputs();
+	string tempFileName = entryFileName;
+	tempFileName.append(CepacUtil::FILE_EXTENSION_FOR_TEMP);
+	FILE *file = CepacUtil::openFile(tempFileName.c_str(), "wb");
+	if (file == NULL)
+		return;
+
+	bool isWriteError = false;
+	try {
+		writeEntryHeader(file);
+		CepacUtil::writeBinary(file, key);
+		runStats->writeCachedStats(costStats, file);
+		tracer->writeCachedTrace(file);
+	}
+	catch (string &errorString) {
+		isWriteError = true;
+	}
+	isWriteError = isWriteError || (fflush(file) != 0) || (ferror(file) != 0);
+	CepacUtil::closeFile(file);
+	if (isWriteError) {
+		remove(tempFileName.c_str());
+		return;
+	}
+	/* rename does not replace an existing file on Windows */
+	remove(entryFileName.c_str());
+	if (rename(tempFileName.c_str(), entryFileName.c_str()) != 0)
+		remove(tempFileName.c_str());
+} /* end writeResults */
+
+/** \brief printReport prints the number of runs restored from the result cache and simulated, if the cache is used */
+void ResultCache::printReport() {
+	if (CepacUtil::resultCacheDirectory.empty())
+		return;
+	printf("Result cache: %d hit%s, %d miss%s", numHits.load(), (numHits == 1) ? "" : "s",
+		numMisses.load(), (numMisses == 1) ? "" : "es");
+	if (numNotCacheable > 0)
+		printf(", %d run%s seeded by time not cached", numNotCacheable.load(), (numNotCacheable == 1) ? "" : "s");
+	printf("\n");
+} /* end printReport */
+
+/** \brief writeEntryHeader writes the file tag and everything besides the inputs that the results of a run depend on:
+ * the layout version, the version and build of CEPAC, the run seed and the random number options
+ *
+ * \param file a pointer to the entry FILE, or the file the key is hashed from, opened for binary writing
+ **/
+void ResultCache::writeEntryHeader(FILE *file) {
+	char fileTag[8] = "CEPACRC";
+	int formatVersion = RESULT_CACHE_FORMAT_VERSION;
+	char versionString[16] = {0};
+	char buildStamp[32] = {0};
+	strncpy(versionString, CepacUtil::CEPAC_VERSION_STRING, sizeof(versionString) - 1);
+	strncpy(buildStamp, SimContext::INPUT_CACHE_BUILD_STAMP, sizeof(buildStamp) - 1);
+	CepacUtil::writeBinary(file, fileTag);
+	CepacUtil::writeBinary(file, formatVersion);
+	CepacUtil::writeBinary(file, versionString);
+	CepacUtil::writeBinary(file, buildStamp);
+	CepacUtil::writeBinary(file, simContext->getRunSeed());
+	CepacUtil::writeBinary(file, CepacUtil::useCounterRandom);
+	CepacUtil::writeBinary(file, CepacUtil::useCommonRandomNumbers);
+	CepacUtil::writeBinary(file, CepacUtil::gaussianMethod);
+} /* end writeEntryHeader */
+
+/** \brief isEntryHeaderValid returns true if an entry was written by this build with the same run options and key,
+ * throwing a string error if it ends early
+ *
+ * \param file a pointer to the entry FILE, opened for binary reading at its start
+ **/
+bool ResultCache::isEntryHeaderValid(FILE *file) {
+	FILE *headerFile = tmpfile();
+	if (headerFile == NULL)
+		return false;
+	writeEntryHeader(headerFile);
+	long headerLength = ftell(headerFile);
+	rewind(headerFile);
+	bool isValid = true;
+	for (long i = 0; (i < headerLength) && isValid; i++)
+		isValid = (fgetc(headerFile) == fgetc(file));
+	fclose(headerFile);
+	if (!isValid)
+		return false;
+
+	unsigned long long entryKey;
+	CepacUtil::readBinary(file, &entryKey);
+	return (entryKey == key);
+} /* end isEntryHeaderValid */
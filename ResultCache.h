@@ -0,0 +1,47 @@
+#pragma once
+
+#include "include.h"
+
+/**
+	ResultCache saves the results of runs in a directory shared by any number of runs and restores them for a later run
+	with the same inputs, without simulating it.  An entry is keyed by a hash of the values of all the inputs as they
+	are read, so input files that differ only in their text, such as in the number of digits of values that round to the
+	same double, or in their run name, share an entry; the key also includes the version and build of CEPAC and the
+	random number options of the run.  Only runs with a fixed seed are cached, since their results are deterministic.
+	An entry holds the totals of the cohort, as the partial statistics of a shard, and the text of the trace after its
+	header; a restored run writes its output files, its trace and its popstats row as if it had been simulated.
+*/
+class ResultCache
+{
+public:
+	/* Constructor and Destructor */
+	ResultCache(SimContext *simContext);
+	~ResultCache(void);
+
+	/** Version of the result cache entry layout, to be increased whenever writeResults changes */
+	static const int RESULT_CACHE_FORMAT_VERSION = 3;
+
+	/* Functions to tell whether a run may be cached, and to restore and save its results */
+	static bool isRunCacheable(SimContext *simContext);
+	bool readResults(RunStats *runStats, CostStats *costStats, Tracer *tracer);
+	void writeResults(RunStats *runStats, CostStats *costStats, Tracer *tracer);
+
+	/* Function to print the number of runs restored from the cache and simulated, at the end of the run */
+	static void printReport();
+
+private:
+	/** The run whose results are cached */
+	SimContext *simContext;
+	/** Hash of the inputs and run options the entry is keyed by, and the name of its file in the cache directory */
+	unsigned long long key;
+	string entryFileName;
+
+	/** Numbers of runs restored from the cache, of cacheable runs that were simulated, and of runs that could not be cached */
+	static atomic<int> numHits;
+	static atomic<int> numMisses;
+	static atomic<int> numNotCacheable;
+
+	/* Functions for the file of an entry */
+	void writeEntryHeader(FILE *file);
+	bool isEntryHeaderValid(FILE *file);
+};
@@ -0,0 +1,424 @@
+#include "include.h"
+
+/** \brief Constructor takes in the summary statistics object and the sizes of the worker pool
+ *
+ * \param summaryStats a pointer to the SummaryStats object that each finished run is added to
+ * \param numThreads the number of worker threads to run the input files on
+ * \param maxOpenRuns the maximum number of input files that may be open at once
+ * \param psaDriver a pointer to the PSADriver whose draws are run instead of the input files, or NULL
+ **/
+RunScheduler::RunScheduler(SummaryStats *summaryStats, int numThreads, int maxOpenRuns, PSADriver *psaDriver) {
+	this->summaryStats = summaryStats;
+	this->numThreads = max(numThreads, 1);
+	this->maxOpenRuns = max(maxOpenRuns, 1);
+	this->psaDriver = psaDriver;
+	numRuns = 0;
+	nextFileIndex = 0;
+	numOpenRuns = 0;
+	numInvalidRuns = 0;
+} /* end Constructor */
+
+/** \brief Destructor is empty, no cleanup required */
+RunScheduler::~RunScheduler(void) {
+
+} /* end Destructor */
+
+/** \brief runFiles runs every input file in CepacUtil::filesToRun, or every draw of the PSA, and returns once all of them are written out
+ *
+ * The calling thread is the first worker.  With a single thread the input files are run one after another,
+ * as before.  The summaries are put back into the order of the input files by SummaryStats::finalizeStats, so
+ * no output depends on the number of threads or open runs
+ **/
+void RunScheduler::runFiles() {
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+	numRuns = (psaDriver != NULL) ? psaDriver->getNumDraws() : (int) CepacUtil::filesToRun.size();
+	nextFileIndex = 0;
+	numOpenRuns = 0;
+	numInvalidRuns = 0;
+	activeRuns.clear();
+	workerStats.assign(numThreads, WorkerStats());
+	for (int i = 0; i < numThreads; i++) {
+		workerStats[i].numBlocks = 0;
+		workerStats[i].numFiles = 0;
+		workerStats[i].numBlocksStolen = 0;
+		workerStats[i].secondsSimulating = 0;
+		workerStats[i].secondsReadingWriting = 0;
+		workerStats[i].secondsWaiting = 0;
+	}
+
+	vector<thread> workers;
+	for (int i = 1; i < numThreads; i++)
+		workers.push_back(thread(&RunScheduler::runWorker, this, i));
+	runWorker(0);
+	for (unsigned int i = 0; i < workers.size(); i++)
+		workers[i].join();
+
+	if (numThreads > 1)
+		printWorkerStats(chrono::duration<double>(chrono::steady_clock::now() - startTime).count());
+	if ((CepacUtil::numShards == 0) && (psaDriver == NULL))
+		ResultCache::printReport();
+	CepacUtil::printProbRateCacheCheck();
+} /* end runFiles */
+
+/** \brief getNumInvalidRuns returns the number of runs of the last call to runFiles that were not simulated because
+ * their inputs are not valid */
+int RunScheduler::getNumInvalidRuns() {
+	return numInvalidRuns;
+} /* end getNumInvalidRuns */
+
+/** \brief runWorker is the worker thread loop, taking the next task until all the input files are finished
+ *
+ * \param workerNum the index of the worker, used for its utilization statistics
+ **/
+void RunScheduler::runWorker(int workerNum) {
+	WorkerStats &stats = workerStats[workerNum];
+	int homeFileIndex = -1;
+
+	while (true) {
+		Run *run = NULL;
+		int blockNum = -1;
+		int fileIndex = -1;
+
+		/** Find the next task: a block of an open run, else the next input file, else wait for one of those */
+		chrono::steady_clock::time_point waitStart = chrono::steady_clock::now();
+		{
+			unique_lock<mutex> lock(scheduleMutex);
+			while (true) {
+				run = claimBlock(homeFileIndex, &blockNum);
+				if (run != NULL)
+					break;
+				if ((nextFileIndex < numRuns) && (numOpenRuns < maxOpenRuns)) {
+					fileIndex = nextFileIndex;
+					nextFileIndex++;
+					numOpenRuns++;
+					break;
+				}
+				if ((nextFileIndex >= numRuns) && (numOpenRuns == 0))
+					break;
+				scheduleCondition.wait(lock);
+			}
+		}
+		chrono::steady_clock::time_point taskStart = chrono::steady_clock::now();
+		stats.secondsWaiting += chrono::duration<double>(taskStart - waitStart).count();
+
+		if (run != NULL) {
+			/** Simulate the block, and write out the run if that completed its cohort */
+			if (run->fileIndex != homeFileIndex) {
+				if (homeFileIndex >= 0)
+					stats.numBlocksStolen++;
+				homeFileIndex = run->fileIndex;
+			}
+			bool isRunComplete = run->cohortRunner->runBlock(blockNum);
+			chrono::steady_clock::time_point blockEnd = chrono::steady_clock::now();
+			stats.secondsSimulating += chrono::duration<double>(blockEnd - taskStart).count();
+			stats.numBlocks++;
+			if (isRunComplete) {
+				finishRun(run);
+				stats.secondsReadingWriting += chrono::duration<double>(chrono::steady_clock::now() - blockEnd).count();
+			}
+		}
+		else if (fileIndex >= 0) {
+			/** Read in the next input file, its blocks become available to all the workers */
+			run = startRun(fileIndex);
+			stats.numFiles++;
+			if (run != NULL)
+				homeFileIndex = fileIndex;
+			stats.secondsReadingWriting += chrono::duration<double>(chrono::steady_clock::now() - taskStart).count();
+		}
+		else {
+			return;
+		}
+
+		scheduleCondition.notify_all();
+	}
+} /* end runWorker */
+
+/** \brief claimBlock claims a block of patients from the worker's current run, or else from the open run with the most unclaimed patients
+ *
+ * Must be called with scheduleMutex held
+ *
+ * \param homeFileIndex the index of the input file of the run the worker simulated last, or -1
+ * \param blockNum a pointer to an integer set to the index of the claimed block
+ * \return a pointer to the Run the block belongs to, or NULL if no open run has a block that can be claimed now
+ **/
+RunScheduler::Run *RunScheduler::claimBlock(int homeFileIndex, int *blockNum) {
+	for (unsigned int i = 0; i < activeRuns.size(); i++) {
+		if (activeRuns[i]->fileIndex == homeFileIndex) {
+			*blockNum = activeRuns[i]->cohortRunner->claimBlock();
+			if (*blockNum >= 0)
+				return activeRuns[i];
+		}
+	}
+
+	/** Steal from the other runs, largest remaining run first; a run may have unclaimed blocks that cannot
+		be claimed yet because too many of its blocks are waiting to be merged */
+	vector<pair<int, int> > runsBySize;
+	for (unsigned int i = 0; i < activeRuns.size(); i++) {
+		if (activeRuns[i]->fileIndex != homeFileIndex)
+			runsBySize.push_back(make_pair(-activeRuns[i]->cohortRunner->getNumUnclaimedPatients(), (int) i));
+	}
+	sort(runsBySize.begin(), runsBySize.end());
+	for (unsigned int i = 0; i < runsBySize.size(); i++) {
+		if (runsBySize[i].first == 0)
+			break;
+		Run *run = activeRuns[runsBySize[i].second];
+		*blockNum = run->cohortRunner->claimBlock();
+		if (*blockNum >= 0)
+			return run;
+	}
+	return NULL;
+} /* end claimBlock */
+
+/** \brief startRun reads in an input file and creates the objects to simulate it, adding it to the active runs
+ *
+ * A PSA draw is read from the base input file of the PSA with its sampled values, and writes no trace file.  A run
+ * whose results are in the result cache is restored and finished without being simulated.
+ *
+ * \param fileIndex the index of the input file in CepacUtil::filesToRun, or of the PSA draw
+ * \return a pointer to the new Run, or NULL if the input file could not be read or there was nothing to simulate
+ **/
+RunScheduler::Run *RunScheduler::startRun(int fileIndex) {
+	/** Get the input file name and strip off the extension to get the run name */
+	string inputFileName;
+	string runName;
+	if (psaDriver != NULL) {
+		runName = psaDriver->getDrawName(fileIndex);
+		inputFileName = psaDriver->getPSAFileName();
+	}
+	else {
+		inputFileName = CepacUtil::filesToRun[fileIndex];
+		runName = CepacUtil::getRunName(inputFileName);
+	}
+
+	Run *run = new Run();
+	run->fileIndex = fileIndex;
+	run->simContext = new SimContext(runName, inputFileName);
+	run->cohortRunner = NULL;
+	run->resultCache = NULL;
+	bool isRestored = false;
+
+	{
+		lock_guard<mutex> lock(fileSystemMutex);
+
+		/** Display the file name being run, and read in the input file */
+		try {
+			if (psaDriver != NULL) {
+				psaDriver->readDrawInputs(fileIndex, run->simContext);
+			}
+			else {
+				printf("Running File: %s\n", inputFileName.c_str());
+				run->simContext->readInputs();
+			}
+		}
+		catch (string &errorString) {
+			printf("%s\n", errorString.c_str());
+			delete run->simContext;
+			delete run;
+			lock_guard<mutex> scheduleLock(scheduleMutex);
+			numOpenRuns--;
+			return NULL;
+		}
+
+		/** Check the inputs before simulating them, an input file with issues is not run and is counted so that
+			main can fail; warnings are printed but the file is run */
+		if (CepacUtil::validateInputs) {
+			InputValidator inputValidator(run->simContext);
+			bool isValid = inputValidator.validateInputs();
+			inputValidator.printWarnings();
+			if (!isValid) {
+				inputValidator.printIssues();
+				delete run->simContext;
+				delete run;
+				lock_guard<mutex> scheduleLock(scheduleMutex);
+				numOpenRuns--;
+				numInvalidRuns++;
+				return NULL;
+			}
+		}
+
+		/** Determine the seed for the patients' random number generators, either random or fixed */
+		run->simContext->setRunSeed(CepacUtil::getRunSeed(run->simContext->getRunSpecsInputs()->randomSeedByTime));
+
+		/** Precompute the tables that the updaters look up every patient-month from the inputs */
+		run->simContext->buildDerivedTables();
+
+		/** Create a new run statistics object for this simulation context */
+		run->runStats = new RunStats(runName, run->simContext);
+		run->costStats = new CostStats(runName, run->simContext);
+
+		/** Create a tracing object for this simulation context and print out the trace file header; the traced
+			patients are the first ones, so of a sharded cohort only the first shard writes the trace file */
+		run->tracer = new Tracer(runName, run->simContext, 1);
+		if ((CepacUtil::shardNum <= 1) && (psaDriver == NULL)) {
+			run->tracer->openTraceFile();
+			run->tracer->printTraceHeader();
+		}
+
+		/** Restore the results of a run with the same inputs and seed from the result cache, if there is one */
+		if ((CepacUtil::numShards == 0) && (psaDriver == NULL) && ResultCache::isRunCacheable(run->simContext)) {
+			run->resultCache = new ResultCache(run->simContext);
+			isRestored = run->resultCache->readResults(run->runStats, run->costStats, run->tracer);
+			if (isRestored) {
+				delete run->resultCache;
+				run->resultCache = NULL;
+			}
+			else {
+				delete run->runStats;
+				delete run->costStats;
+				run->runStats = new RunStats(runName, run->simContext);
+				run->costStats = new CostStats(runName, run->simContext);
+			}
+		}
+	}
+	if (isRestored) {
+		finishRun(run);
+		return NULL;
+	}
+
+	/** Split the cohort into blocks for the workers to simulate until its stopping rule is met */
+	run->cohortRunner = new CohortRunner(run->simContext, run->runStats, run->costStats, run->tracer, numThreads);
+	bool isRunComplete;
+	try {
+		isRunComplete = run->cohortRunner->startCohort();
+	}
+	catch (string &errorString) {
+		printf("%s\n", errorString.c_str());
+		lock_guard<mutex> lock(fileSystemMutex);
+		run->tracer->closeTraceFile();
+		delete run->cohortRunner;
+		delete run->resultCache;
+		delete run->tracer;
+		delete run->runStats;
+		delete run->costStats;
+		delete run->simContext;
+		delete run;
+		lock_guard<mutex> scheduleLock(scheduleMutex);
+		numOpenRuns--;
+		return NULL;
+	}
+	if (isRunComplete) {
+		finishRun(run);
+		return NULL;
+	}
+
+	lock_guard<mutex> lock(scheduleMutex);
+	activeRuns.push_back(run);
+	return run;
+} /* end startRun */
+
+/** \brief finishRun writes the output files of a run whose cohort is complete, adds it to the summary stats and frees it
+ *
+ * When only a shard of the cohort was simulated, its partial statistics file is written instead, to be merged
+ * with the other shards by cepac-merge
+ *
+ * \param run a pointer to the Run to finish, it is deleted
+ **/
+void RunScheduler::finishRun(Run *run) {
+	{
+		lock_guard<mutex> lock(scheduleMutex);
+		for (unsigned int i = 0; i < activeRuns.size(); i++) {
+			if (activeRuns[i] == run) {
+				activeRuns.erase(activeRuns.begin() + i);
+				break;
+			}
+		}
+	}
+
+	RunStats *runStats = run->runStats;
+	CostStats *costStats = run->costStats;
+	SimContext *simContext = run->simContext;
+	if (CepacUtil::numShards > 0) {
+		lock_guard<mutex> lock(fileSystemMutex);
+
+		/** Write out the totals of the shard for cepac-merge, the statistics are finalized once all shards are merged */
+		try {
+			runStats->writePartialStatsFile(costStats, CepacUtil::shardNum, CepacUtil::numShards);
+		}
+		catch (string &errorString) {
+			printf("%s\n", errorString.c_str());
+		}
+		printf("%s\t shard %d of %d \t patients %d \n",
+			simContext->getRunSpecsInputs()->runName.c_str(), CepacUtil::shardNum, CepacUtil::numShards,
+			runStats->getPopulationSummary()->numCohorts);
+
+		run->tracer->closeTraceFile();
+	}
+	else if (psaDriver != NULL) {
+		/** Add the results of the PSA draw to its row of the PSA results, no output files are written */
+		runStats->finalizeStats();
+		psaDriver->addDrawResults(run->fileIndex, runStats);
+		printf("%s\t cost $%0.0f \t LMs %0.2f \t QALMs %0.2f \n",
+			runStats->getPopulationSummary()->runName.c_str(),
+			runStats->getPopulationSummary()->costsAverage,
+			runStats->getPopulationSummary()->LMsAverage,
+			runStats->getPopulationSummary()->QALMsAverage);
+	}
+	else {
+		lock_guard<mutex> lock(fileSystemMutex);
+
+		/** Save the totals and trace of a simulated run to the result cache before they are finalized */
+		if (run->resultCache != NULL)
+			run->resultCache->writeResults(runStats, costStats, run->tracer);
+
+		/** Write out the stats file for this simulation context and add to the summary stats */
+		runStats->finalizeStats();
+		try {
+			runStats->writeStatsFile();
+		}
+		catch (string &errorString) {
+			printf("%s\n", errorString.c_str());
+		}
+
+		if (simContext->getOutputInputs()->enableDetailedCostOutputs){
+			costStats->finalizeStats();
+			/** Write out the cost stats file for this simulation context*/
+			try {
+				costStats->writeStatsFile();
+			}
+			catch (string &errorString) {
+				printf("%s\n", errorString.c_str());
+			}
+		}
+
+		/** Add the individual run stats to the summary stats object */
+		summaryStats->addRunStats(runStats, simContext, run->fileIndex);
+
+		/** Display the summary stats for this run in the results window */
+		printf("%s\t cost $%0.0f \t LMs %0.2f \t QALMs %0.2f \n",
+			runStats->getPopulationSummary()->runName.c_str(),
+			runStats->getPopulationSummary()->costsAverage,
+			runStats->getPopulationSummary()->LMsAverage,
+			runStats->getPopulationSummary()->QALMsAverage);
+
+		/** Close the trace file and destroy the tracer object */
+		run->tracer->closeTraceFile();
+	}
+	delete run->cohortRunner;
+	delete run->resultCache;
+	delete run->tracer;
+
+	/** Destroy the runStats and simContext objects */
+	delete runStats;
+	delete costStats;
+	delete simContext;
+	delete run;
+
+	lock_guard<mutex> lock(scheduleMutex);
+	numOpenRuns--;
+} /* end finishRun */
+
+/** \brief printWorkerStats prints how each worker thread spent its time to the console
+ *
+ * \param secondsTotal the wall clock time of the whole run in seconds
+ **/
+void RunScheduler::printWorkerStats(double secondsTotal) {
+	printf("Worker utilization over %0.2f s:\n", secondsTotal);
+	for (int i = 0; i < numThreads; i++) {
+		const WorkerStats &stats = workerStats[i];
+		double secondsBusy = stats.secondsSimulating + stats.secondsReadingWriting;
+		printf("  worker %d: busy %5.1f%% \t blocks %d (%d stolen) \t files %d \t simulating %0.2f s \t reading/writing %0.2f s \t waiting %0.2f s\n",
+			i + 1, (secondsTotal > 0) ? 100.0 * secondsBusy / secondsTotal : 0.0,
+			stats.numBlocks, stats.numBlocksStolen, stats.numFiles,
+			stats.secondsSimulating, stats.secondsReadingWriting, stats.secondsWaiting);
+	}
+} /* end printWorkerStats */
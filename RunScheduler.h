@@ -0,0 +1,90 @@
+#pragma once
+
+#include "include.h"
+
+/**
+	RunScheduler runs each of the input files found by CepacUtil::findInputFiles on a single pool of worker
+	threads.  Each input file is read into its own SimContext and simulated into its own RunStats, CostStats,
+	and Tracer by a CohortRunner, then its summary is added to the shared SummaryStats.  The tasks are reading
+	an input file, simulating a block of patients of an open run, and writing the outputs of a finished run.
+	A worker keeps simulating blocks of the run it is working on; when that run has no blocks left to claim it
+	steals a block from the open run with the most unclaimed patients, and only when no open run has a block to
+	claim does it open the next input file.  Reading the inputs and writing the outputs change the working
+	directory, which is shared by all threads, so these steps are done one input file at a time.
+	For a probabilistic sensitivity analysis the runs are the draws of a PSADriver instead of the input files.
+*/
+class RunScheduler
+{
+public:
+	/* Constructor and Destructor */
+	RunScheduler(SummaryStats *summaryStats, int numThreads, int maxOpenRuns, PSADriver *psaDriver = NULL);
+	~RunScheduler(void);
+
+	/* Function to run all the input files */
+	void runFiles();
+	/* Function to get the number of runs not simulated because their inputs are not valid */
+	int getNumInvalidRuns();
+
+private:
+	/** Run holds the objects of an input file that is being simulated */
+	class Run {
+	public:
+		/** Index of the input file in CepacUtil::filesToRun, or of the PSA draw */
+		int fileIndex;
+		SimContext *simContext;
+		RunStats *runStats;
+		CostStats *costStats;
+		Tracer *tracer;
+		CohortRunner *cohortRunner;
+		/** The result cache entry the results of the run are saved to once it is simulated, or NULL if it is not cached */
+		ResultCache *resultCache;
+	};
+
+	/** WorkerStats records how a worker thread spent its time, printed at the end of the run */
+	class WorkerStats {
+	public:
+		/** Number of patient blocks simulated and input files read in */
+		int numBlocks;
+		int numFiles;
+		/** Number of blocks taken from a run other than the one the worker was working on */
+		int numBlocksStolen;
+		/** Seconds spent simulating and merging blocks, reading inputs and writing outputs, and waiting for work */
+		double secondsSimulating;
+		double secondsReadingWriting;
+		double secondsWaiting;
+	};
+
+	/** The summary statistics that each finished run is added to */
+	SummaryStats *summaryStats;
+	/** Number of worker threads, including the calling thread */
+	int numThreads;
+	/** Maximum number of input files that may be open at once */
+	int maxOpenRuns;
+	/** The PSA whose draws are run instead of the input files, or NULL */
+	PSADriver *psaDriver;
+	/** Number of input files or PSA draws to run */
+	int numRuns;
+
+	/** Scheduling state shared by the workers, guarded by scheduleMutex */
+	mutex scheduleMutex;
+	condition_variable scheduleCondition;
+	/** Index in CepacUtil::filesToRun of the next input file to open */
+	int nextFileIndex;
+	/** Number of input files being read, simulated, or written */
+	int numOpenRuns;
+	/** Number of runs not simulated because InputValidator found issues with their inputs */
+	int numInvalidRuns;
+	/** Runs that have blocks left to simulate, in the order they were opened */
+	vector<Run *> activeRuns;
+	vector<WorkerStats> workerStats;
+
+	/** Held while reading inputs and writing outputs, since both change the working directory */
+	mutex fileSystemMutex;
+
+	/* Functions for the worker threads and their tasks */
+	void runWorker(int workerNum);
+	Run *claimBlock(int homeFileIndex, int *blockNum);
+	Run *startRun(int fileIndex);
+	void finishRun(Run *run);
+	void printWorkerStats(double secondsTotal);
+};
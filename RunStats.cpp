@@ -4,7 +4,11 @@
  *
  * \param runName a string representing the run name associated with this RunStats object
  * \param simContext a pointer to the SimContext representing the inputs associated with this RunStats object*/
-RunStats::RunStats(string runName, SimContext *simContext) {
+RunStats::RunStats(string runName, SimContext *simContext) :
+	/** Value initializing the subclasses zeroes the values only calculated by finalizeStats and the padding between
+		fields, so the totals saved by writePartialStats and writeCachedStats do not depend on leftover memory */
+	popSummary(), hivScreening(), survivalStats(), initialDistributions(), chrmsStats(), oiStats(), deathStats(), overallSurvival(),
+	overallCosts(), tbStats(), ltfuStats(), prophStats(), artStats() {
 
 	statsFileName = runName;
 	statsFileName.append(CepacUtil::FILE_EXTENSION_FOR_OUTPUT);
@@ -12,6 +16,8 @@ RunStats::RunStats(string runName, SimContext *simContext) {
 	orphanFileName = runName;
 	orphanFileName.append(CepacUtil::FILE_EXTENSION_FOR_ORPHAN_OUTPUT);
 	this->simContext = simContext;
+	patientNumOffset = 0;
+	isFinalized = false;
 
 	initRunStats(false);
 } /* end Constructor */
@@ -88,6 +94,7 @@ void RunStats::initRunStats(bool isDynamic) {
  * - RunStats::finalizeTimeSummaries();
 */
 void RunStats::finalizeStats() {
+	isFinalized = true;
 	finalizePopulationSummary();
 	finalizeHIVScreening();
 	finalizeSurvivalStats();
@@ -143,7 +150,7 @@ void RunStats::writeStatsFile() {
 	writeDeathStats();
 	writeOverallSurvival();
 	writeOverallCosts();
-	if (simContext->getTBInputs()->enableTB)
+	if (simContext->isTBEnabled())
 		writeTBStats();
 	writeLTFUStats();
 	writeProphStats();
@@ -170,6 +177,147 @@ void RunStats::writeStatsFile() {
 	}
 } /* end writeStatsFile */
 
+/** \brief writePartialStatsFile writes the totals of a shard of the cohort to its partial statistics file in the results directory
+ *
+ * Used instead of finalizeStats and writeStatsFile when this process simulates only one shard of each cohort.
+ * cepac-merge reads the partial statistics files of all the shards back with readPartialStatsFile, merges them in
+ * patient order and writes the usual output files.  The file starts with the shard number and a hash of the input
+ * file, so that shards of different runs or inputs are never merged, followed by the totals of the statistics subclasses.
+ *
+ * \param costStats a pointer to the CostStats object of the same shard, written after the run statistics
+ * \param shardNum the number of the shard, from 1 to numShards
+ * \param numShards the number of shards the cohort is split into
+ **/
+void RunStats::writePartialStatsFile(CostStats *costStats, int shardNum, int numShards) {
+	if (isFinalized) {
+		string errorString = "   ERROR - Cannot write partial statistics that have already been finalized";
+		throw errorString;
+	}
+
+	string inputFileName = simContext->getInputFileName();
+	CepacUtil::changeDirectoryToInputs();
+	unsigned long long inputFileHash = CepacUtil::getFileHash(inputFileName.c_str());
+
+	string partialFileName = getPartialStatsFileName(shardNum, numShards);
+	CepacUtil::changeDirectoryToResults();
+	FILE *file = CepacUtil::openFile(partialFileName.c_str(), "wb");
+	if (file == NULL) {
+		string errorString = "   ERROR - Could not write partial stats file ";
+		errorString.append(partialFileName);
+		throw errorString;
+	}
+
+	char fileTag[8] = "CEPACPS";
+	int formatVersion = PARTIAL_STATS_FORMAT_VERSION;
+	CepacUtil::writeBinary(file, fileTag);
+	CepacUtil::writeBinary(file, formatVersion);
+	CepacUtil::writeBinary(file, shardNum);
+	CepacUtil::writeBinary(file, numShards);
+	CepacUtil::writeBinary(file, inputFileHash);
+	writePartialStats(file);
+	costStats->writePartialStats(file);
+
+	bool isWriteError = (fflush(file) != 0) || (ferror(file) != 0);
+	CepacUtil::closeFile(file);
+	if (isWriteError) {
+		string errorString = "   ERROR - Could not write all of partial stats file ";
+		errorString.append(partialFileName);
+		throw errorString;
+	}
+} /* end writePartialStatsFile */
+
+/** \brief readPartialStatsFile reads the partial statistics file of a shard into newly constructed RunStats and CostStats objects
+ *
+ * The shard can then be merged into the statistics of the whole cohort, after the shards before it.  Throws a string
+ * error if the file is missing, is for another shard, was written for a different input file or by a version of CEPAC
+ * with different statistics, or is incomplete.
+ *
+ * \param costStats a pointer to the newly constructed CostStats object to read the cost statistics of the shard into
+ * \param shardNum the number of the shard, from 1 to numShards
+ * \param numShards the number of shards the cohort is split into
+ **/
+void RunStats::readPartialStatsFile(CostStats *costStats, int shardNum, int numShards) {
+	string inputFileName = simContext->getInputFileName();
+	CepacUtil::changeDirectoryToInputs();
+	unsigned long long inputFileHash = CepacUtil::getFileHash(inputFileName.c_str());
+
+	string partialFileName = getPartialStatsFileName(shardNum, numShards);
+	CepacUtil::changeDirectoryToResults();
+	FILE *file = CepacUtil::openFile(partialFileName.c_str(), "rb");
+	if (file == NULL) {
+		string errorString = "   ERROR - Could not open partial stats file ";
+		errorString.append(partialFileName);
+		throw errorString;
+	}
+
+	try {
+		char fileTag[8];
+		int formatVersion, fileShardNum, fileNumShards;
+		unsigned long long fileInputHash;
+		CepacUtil::readBinary(file, &fileTag);
+		CepacUtil::readBinary(file, &formatVersion);
+		if ((strncmp(fileTag, "CEPACPS", sizeof(fileTag)) != 0) || (formatVersion != PARTIAL_STATS_FORMAT_VERSION)) {
+			string errorString = "   ERROR - Not a partial statistics file of this version of CEPAC";
+			throw errorString;
+		}
+		CepacUtil::readBinary(file, &fileShardNum);
+		CepacUtil::readBinary(file, &fileNumShards);
+		CepacUtil::readBinary(file, &fileInputHash);
+		if ((fileShardNum != shardNum) || (fileNumShards != numShards)) {
+			string errorString = "   ERROR - Partial statistics file is for a different shard";
+			throw errorString;
+		}
+		if (fileInputHash != inputFileHash) {
+			string errorString = "   ERROR - Partial statistics file was written for a different version of input file ";
+			errorString.append(inputFileName);
+			throw errorString;
+		}
+
+		readPartialStats(file);
+		costStats->readPartialStats(file);
+		if (fgetc(file) != EOF) {
+			string errorString = "   ERROR - Partial statistics file has data after the statistics";
+			throw errorString;
+		}
+	}
+	catch (string &errorString) {
+		CepacUtil::closeFile(file);
+		errorString.append(" (");
+		errorString.append(partialFileName);
+		errorString.append(")");
+		throw;
+	}
+	CepacUtil::closeFile(file);
+} /* end readPartialStatsFile */
+
+/** \brief writeCachedStats writes the totals of a whole cohort that has not been finalized to a result cache entry, as
+ * writePartialStatsFile writes those of a shard
+ *
+ * \param costStats a pointer to the CostStats object of the cohort
+ * \param file a pointer to the result cache FILE, opened for binary writing
+ **/
+void RunStats::writeCachedStats(CostStats *costStats, FILE *file) {
+	if (isFinalized) {
+		string errorString = "   ERROR - Cannot cache statistics that have already been finalized";
+		throw errorString;
+	}
+	writePartialStats(file);
+	costStats->writePartialStats(file);
+} /* end writeCachedStats */
+
+/** \brief readCachedStats reads the totals written by writeCachedStats into newly constructed RunStats and CostStats objects,
+ * which can then be finalized and written out as if the cohort had been simulated
+ *
+ * Throws a string error if the entry ends early or was written by a build with different statistics
+ *
+ * \param costStats a pointer to the newly constructed CostStats object to read the cost statistics into
+ * \param file a pointer to the result cache FILE, opened for binary reading
+ **/
+void RunStats::readCachedStats(CostStats *costStats, FILE *file) {
+	readPartialStats(file);
+	costStats->readPartialStats(file);
+} /* end readCachedStats */
+
 /** \brief initPopulationSummary initializes the PopulationSummary object */
 void RunStats::initPopulationSummary() {
 	popSummary.numCohorts = 0;
@@ -1690,6 +1838,1478 @@ void RunStats::initOrphanStats(OrphanStats *currTime) {
 	}
 } /* end initOrphanStats */
 
+/** \brief merge adds the statistics accumulated by another RunStats object into this one
+ *
+ * Used to combine RunStats shards that were each filled by a disjoint, contiguous range of patients (e.g. by
+ * the worker threads of a CohortRunner).  Shards must be merged in patient order before finalizeStats() is called;
+ * the per-patient summaries are appended in that order and the cumulative time summary values are recomputed.
+ * Every counter, sum and sum of squares written by the StateUpdaters is added, and the sums are FixedPointSums,
+ * so the statistics equal those of accumulating the same patients into a single object.  Statistics derived from these (averages, standard deviations, survival
+ * and cumulative values) are left to finalizeStats.  Merging is associative, so shards may also be combined in
+ * stages, as long as each stage keeps patient order.
+ *
+ * Throws a string error if either object has been finalized or the other shard does not start with the
+ * patient after the last one in this object.
+ *
+ * \param other a RunStats object for the same SimContext that has not yet been finalized
+ **/
+void RunStats::merge(const RunStats &other) {
+	if (isFinalized || other.isFinalized) {
+		string errorString = "   ERROR - Cannot merge run statistics that have already been finalized";
+		throw errorString;
+	}
+	if (other.patientNumOffset != patientNumOffset + popSummary.numCohorts) {
+		char buffer[256];
+		sprintf(buffer, "   ERROR - Run statistics shard starting after patient %d merged after patient %d, shards must be merged in patient order",
+			other.patientNumOffset, patientNumOffset + popSummary.numCohorts);
+		string errorString = buffer;
+		throw errorString;
+	}
+
+	mergePopulationSummary(other);
+	mergeHIVScreening(other);
+	mergeInitialDistributions(other);
+	mergeCHRMsStats(other);
+	mergeOIStats(other);
+	mergeDeathStats(other);
+	mergeOverallSurvival(other);
+	mergeOverallCosts(other);
+	mergeTBStats(other);
+	mergeLTFUStats(other);
+	mergeProphStats(other);
+	mergeARTStats(other);
+
+	/** Append the patient summaries, survival stats are calculated from these at finalization */
+	patients.insert(patients.end(), other.patients.begin(), other.patients.end());
+
+	/** Add new time summaries until there is one for every time period of the other object */
+	for (int i = 0; i < (int) other.timeSummaries.size(); i++) {
+		if (i >= (int) timeSummaries.size()) {
+			TimeSummary *currTime = new TimeSummary();
+			initTimeSummary(currTime);
+			currTime->timePeriod = i;
+			timeSummaries.push_back(currTime);
+		}
+		mergeTimeSummary(timeSummaries[i], other.timeSummaries[i]);
+	}
+	updateCumulativeTimeSummaries();
+
+	for (int i = 0; i < (int) other.orphanStats.size(); i++) {
+		if (i >= (int) orphanStats.size()) {
+			OrphanStats *currTime = new OrphanStats();
+			initOrphanStats(currTime);
+			currTime->timePeriod = i;
+			orphanStats.push_back(currTime);
+		}
+		mergeOrphanStats(orphanStats[i], other.orphanStats[i]);
+	}
+} /* end merge */
+
+/** \brief updateCumulativeTimeSummaries recalculates the running cumulative costs, tests and detections of every TimeSummary */
+void RunStats::updateCumulativeTimeSummaries() {
+	//Add monthly cumulative costs
+	double cumulCohortCosts= 0;
+	double cumulCohortCostsType[SimContext::COST_NUM_TYPES];
+	for (int i = 0; i < SimContext::COST_NUM_TYPES; i++) {
+		cumulCohortCostsType[i] = 0;
+	}
+	double cumulARTCosts = 0;
+	double cumulCD4Costs = 0;
+	double cumulHVLCosts = 0;
+	double cumulHIVTestCosts = 0;
+	double cumulHIVMiscCosts = 0;
+
+	for (vector<TimeSummary *>::iterator t = timeSummaries.begin(); t != timeSummaries.end(); t++) {
+		TimeSummary *currTime = *t;
+		cumulCohortCosts += currTime->totalMonthlyCohortCosts;
+		for (int i = 0; i < SimContext::COST_NUM_TYPES; i++) {
+			cumulCohortCostsType[i] += currTime->totalMonthlyCohortCostsType[i];
+		}
+
+		for (int i = 0; i < SimContext::ART_NUM_LINES; i++)
+			cumulARTCosts += currTime->costsART[i];
+		cumulCD4Costs += currTime->costsCD4Testing;
+		cumulHVLCosts += currTime->costsHVLTesting;
+		cumulHIVTestCosts += currTime->costsHIVTests;
+		cumulHIVMiscCosts += currTime->costsHIVMisc;
+		currTime->cumulativeCohortCosts = cumulCohortCosts;
+		for (int i = 0; i < SimContext::COST_NUM_TYPES; i++) {
+			currTime->cumulativeCohortCostsType[i] = cumulCohortCostsType[i];
+		}
+		currTime->cumulativeARTCosts = cumulARTCosts;
+		currTime->cumulativeCD4TestingCosts = cumulCD4Costs;
+		currTime->cumulativeHVLTestingCosts = cumulHVLCosts;
+		currTime->cumulativeHIVTestingCosts = cumulHIVTestCosts;
+		currTime->cumulativeHIVMiscCosts = cumulHIVMiscCosts;
+	}
+
+	// Add cumulative HIV detection and testing numbers
+	int cumulHIVDetections[SimContext::HIV_DET_NUM];
+	for (int i = 0; i < SimContext::HIV_DET_NUM; i++) {
+		cumulHIVDetections[i] = 0;
+	}
+	int cumulHIVTests = 0;
+	int cumulHIVTestsAtInitOffer = 0;
+	int cumulHIVTestsPostStartup = 0;
+
+	for (vector<TimeSummary *>::iterator t = timeSummaries.begin(); t != timeSummaries.end(); t++) {
+		TimeSummary *currTime = *t;
+
+		for (int i = 0; i < SimContext::HIV_DET_NUM; i++) {
+			cumulHIVDetections[i] += currTime->numHIVDetections[i];
+		}
+		cumulHIVTests += currTime->numHIVTestsPerformed;
+		cumulHIVTestsAtInitOffer += currTime->numHIVTestsPerformedAtInitOffer;
+		cumulHIVTestsPostStartup += currTime->numHIVTestsPerformedPostStartup;
+
+		for (int i = 0; i < SimContext::HIV_DET_NUM; i++) {
+			currTime->cumulativeNumHIVDetections[i] = cumulHIVDetections[i];
+		}
+		currTime->cumulativeNumHIVTests = cumulHIVTests;
+		currTime->cumulativeNumHIVTestsAtInitOffer = cumulHIVTestsAtInitOffer;
+		currTime->cumulativeNumHIVTestsPostStartup = cumulHIVTestsPostStartup;
+	}
+} /* end updateCumulativeTimeSummaries */
+
+/** \brief mergePopulationSummary adds the PopulationSummary totals of another RunStats object to this one */
+void RunStats::mergePopulationSummary(const RunStats &other) {
+	popSummary.numCohorts += other.popSummary.numCohorts;
+	popSummary.numCohortsHIVPositive += other.popSummary.numCohortsHIVPositive;
+	popSummary.costsSum += other.popSummary.costsSum;
+	popSummary.costsSumSquares += other.popSummary.costsSumSquares;
+	popSummary.LMsSum += other.popSummary.LMsSum;
+	popSummary.LMsSumSquares += other.popSummary.LMsSumSquares;
+	popSummary.QALMsSum += other.popSummary.QALMsSum;
+	popSummary.QALMsSumSquares += other.popSummary.QALMsSumSquares;
+
+	for(int i = 0; i<SimContext::MAX_NUM_SUBCOHORTS; i++){
+		popSummary.costsSumCohortParsing[i] += other.popSummary.costsSumCohortParsing[i];
+		popSummary.costsSumSquaresCohortParsing[i] += other.popSummary.costsSumSquaresCohortParsing[i];
+		popSummary.LMsSumCohortParsing[i] += other.popSummary.LMsSumCohortParsing[i];
+		popSummary.LMsSumSquaresCohortParsing[i] += other.popSummary.LMsSumSquaresCohortParsing[i];
+		popSummary.QALMsSumCohortParsing[i] += other.popSummary.QALMsSumCohortParsing[i];
+		popSummary.QALMsSumSquaresCohortParsing[i] += other.popSummary.QALMsSumSquaresCohortParsing[i];
+	}
+
+	for(int i = 0; i<SimContext::NUM_DISCOUNT_RATES; i++){
+		popSummary.multDiscCostsSum[i] += other.popSummary.multDiscCostsSum[i];
+		popSummary.multDiscCostsSumSquares[i] += other.popSummary.multDiscCostsSumSquares[i];
+		popSummary.multDiscLMsSum[i] += other.popSummary.multDiscLMsSum[i];
+		popSummary.multDiscLMsSumSquares[i] += other.popSummary.multDiscLMsSumSquares[i];
+		popSummary.multDiscQALMsSum[i] += other.popSummary.multDiscQALMsSum[i];
+		popSummary.multDiscQALMsSumSquares[i] += other.popSummary.multDiscQALMsSumSquares[i];
+	}
+
+	for (int i = 0; i <= SimContext::ART_NUM_LINES; i++) {
+		popSummary.numFailART[i] += other.popSummary.numFailART[i];
+		popSummary.costsFailARTSum[i] += other.popSummary.costsFailARTSum[i];
+		popSummary.LMsFailARTSum[i] += other.popSummary.LMsFailARTSum[i];
+		popSummary.QALMsFailARTSum[i] += other.popSummary.QALMsFailARTSum[i];
+	}
+	popSummary.totalClinicVisits += other.popSummary.totalClinicVisits;
+	popSummary.costsHIVPositiveSum += other.popSummary.costsHIVPositiveSum;
+	popSummary.LMsHIVPositiveSum += other.popSummary.LMsHIVPositiveSum;
+	popSummary.QALMsHIVPositiveSum += other.popSummary.QALMsHIVPositiveSum;
+} /* end mergePopulationSummary */
+
+/** \brief mergeHIVScreening adds the HIVScreening totals of another RunStats object to this one */
+void RunStats::mergeHIVScreening(const RunStats &other) {
+	hivScreening.numPrevalentCases += other.hivScreening.numPrevalentCases;
+	hivScreening.numIncidentCases += other.hivScreening.numIncidentCases;
+	for(int i = 0; i < SimContext::HIV_POS_PREP_STATES_NUM; i++)
+		hivScreening.numIncidentCasesByPrEPState[i] += other.hivScreening.numIncidentCasesByPrEPState[i];
+	for( int i = 0; i < 3; i++)
+		hivScreening.numHIVExposed[i] += other.hivScreening.numHIVExposed[i];
+	hivScreening.numNeverHIVExposed += other.hivScreening.numNeverHIVExposed;
+	hivScreening.numHIVNegativeAtInit += other.hivScreening.numHIVNegativeAtInit;
+	for(int i = 0; i < SimContext::EVER_PREP_NUM; i++){
+		hivScreening.numNeverHIVPositive[i] += other.hivScreening.numNeverHIVPositive[i];
+	}
+	for (int i = 0; i < SimContext::EVER_PREP_NUM; i++) {
+		hivScreening.LMsHIVNegativeSum[i] += other.hivScreening.LMsHIVNegativeSum[i];
+		hivScreening.QALMsHIVNegativeSum[i] += other.hivScreening.QALMsHIVNegativeSum[i];
+	}
+	for (int i = 0; i < SimContext::HIV_EXT_INF_NUM; i++) {
+		hivScreening.numPatientsInitialHIVState[i] += other.hivScreening.numPatientsInitialHIVState[i];
+		hivScreening.numTestsHIVState[i] += other.hivScreening.numTestsHIVState[i];
+	}
+	for(int i = 0; i < SimContext::PEDS_CD4_AGE_CAT_NUM; i++){
+		hivScreening.numAtDetectionPrevalentCD4Metric[i] += other.hivScreening.numAtDetectionPrevalentCD4Metric[i];
+		hivScreening.numAtDetectionIncidentCD4Metric[i] += other.hivScreening.numAtDetectionIncidentCD4Metric[i];
+		hivScreening.numAtLinkageCD4Metric[i] += other.hivScreening.numAtLinkageCD4Metric[i];
+	}
+	for (int j = 0; j < SimContext::HIV_POS_NUM; j++) {
+		hivScreening.numLinkedAtInit[j] += other.hivScreening.numLinkedAtInit[j];
+		for(int i = 0; i < SimContext::PEDS_CD4_AGE_CAT_NUM; i++){
+			hivScreening.numAtDetectionPrevalentHIVCD4Metric[j][i] += other.hivScreening.numAtDetectionPrevalentHIVCD4Metric[j][i];
+			hivScreening.numAtDetectionIncidentHIVCD4Metric[j][i] += other.hivScreening.numAtDetectionIncidentHIVCD4Metric[j][i];
+			hivScreening.numAtLinkageHIVCD4Metric[j][i] += other.hivScreening.numAtLinkageHIVCD4Metric[j][i];
+		}
+		for (int i = 0; i < SimContext::CD4_NUM_STRATA; i++) {
+			hivScreening.numAtDetectionPrevalentCD4HIV[i][j] += other.hivScreening.numAtDetectionPrevalentCD4HIV[i][j];
+			hivScreening.numAtDetectionIncidentCD4HIV[i][j] += other.hivScreening.numAtDetectionIncidentCD4HIV[i][j];
+			hivScreening.numAtLinkageCD4HIV[i][j] += other.hivScreening.numAtLinkageCD4HIV[i][j];
+		}
+		for (int i = 0; i < SimContext::HVL_NUM_STRATA; i++) {
+			hivScreening.numAtDetectionPrevalentHVLHIV[i][j] += other.hivScreening.numAtDetectionPrevalentHVLHIV[i][j];
+			hivScreening.numAtDetectionIncidentHVLHIV[i][j] += other.hivScreening.numAtDetectionIncidentHVLHIV[i][j];
+			hivScreening.numAtLinkageHVLHIV[i][j] += other.hivScreening.numAtLinkageHVLHIV[i][j];
+		}
+	}
+	for (int i = 0; i < SimContext::HIV_POS_NUM; i++) {
+		hivScreening.CD4AtDetectionPrevalentSumHIV[i] += other.hivScreening.CD4AtDetectionPrevalentSumHIV[i];
+		hivScreening.CD4AtDetectionIncidentSumHIV[i] += other.hivScreening.CD4AtDetectionIncidentSumHIV[i];
+		hivScreening.CD4AtLinkageSumHIV[i] += other.hivScreening.CD4AtLinkageSumHIV[i];
+	}
+	hivScreening.monthsToInfectionSum += other.hivScreening.monthsToInfectionSum;
+	hivScreening.monthsToInfectionSumSquares += other.hivScreening.monthsToInfectionSumSquares;
+	hivScreening.monthsAfterInfectionToDetectionSum += other.hivScreening.monthsAfterInfectionToDetectionSum;
+	hivScreening.monthsAfterInfectionToDetectionSumSquares += other.hivScreening.monthsAfterInfectionToDetectionSumSquares;
+	hivScreening.monthsToDetectionPrevalentSum += other.hivScreening.monthsToDetectionPrevalentSum;
+	hivScreening.monthsToDetectionPrevalentSumSquares += other.hivScreening.monthsToDetectionPrevalentSumSquares;
+	hivScreening.monthsToDetectionIncidentSum += other.hivScreening.monthsToDetectionIncidentSum;
+	hivScreening.monthsToDetectionIncidentSumSquares += other.hivScreening.monthsToDetectionIncidentSumSquares;
+	hivScreening.monthsToLinkageSum += other.hivScreening.monthsToLinkageSum;
+	hivScreening.monthsToLinkageSumSquares += other.hivScreening.monthsToLinkageSumSquares;
+	hivScreening.ageMonthsAtDetectionPrevalentSum += other.hivScreening.ageMonthsAtDetectionPrevalentSum;
+	hivScreening.ageMonthsAtDetectionPrevalentSumSquares += other.hivScreening.ageMonthsAtDetectionPrevalentSumSquares;
+	hivScreening.ageMonthsAtDetectionIncidentSum += other.hivScreening.ageMonthsAtDetectionIncidentSum;
+	hivScreening.ageMonthsAtDetectionIncidentSumSquares += other.hivScreening.ageMonthsAtDetectionIncidentSumSquares;
+	hivScreening.ageMonthsAtLinkageSum += other.hivScreening.ageMonthsAtLinkageSum;
+	hivScreening.ageMonthsAtLinkageSumSquares += other.hivScreening.ageMonthsAtLinkageSumSquares;
+	hivScreening.numDetectedGender[SimContext::GENDER_MALE] += other.hivScreening.numDetectedGender[SimContext::GENDER_MALE];
+	hivScreening.numDetectedGender[SimContext::GENDER_FEMALE] += other.hivScreening.numDetectedGender[SimContext::GENDER_FEMALE];
+	for (int i = 0; i < SimContext::HIV_DET_NUM; i++) {
+		hivScreening.numDetectedPrevalentMeans[i] += other.hivScreening.numDetectedPrevalentMeans[i];
+		hivScreening.numDetectedIncidentMeans[i] += other.hivScreening.numDetectedIncidentMeans[i];
+		hivScreening.numLinkedMeans[i] += other.hivScreening.numLinkedMeans[i];
+		hivScreening.monthsToLinkageSumMeans[i] += other.hivScreening.monthsToLinkageSumMeans[i];
+		hivScreening.monthsToLinkageSumSquaresMeans[i] += other.hivScreening.monthsToLinkageSumSquaresMeans[i];
+	}
+	for (int i = 0; i < SimContext::OI_NUM; i++) {
+		hivScreening.numDetectedByOIs[i] += other.hivScreening.numDetectedByOIs[i];
+		hivScreening.numDetectedByOIsPrevDetected[i] += other.hivScreening.numDetectedByOIsPrevDetected[i];
+	}
+	for (int i = 0; i < SimContext::TEST_ACCEPT_NUM; i++) {
+		for (int j = 0; j < SimContext::HIV_EXT_INF_NUM; j++) {
+			hivScreening.numTestingAcceptProb[i][j] += other.hivScreening.numTestingAcceptProb[i][j];
+		}
+	}
+	for (int i = 0; i < SimContext::HIV_TEST_FREQ_NUM; i++) {
+		hivScreening.numTestingInterval[i] += other.hivScreening.numTestingInterval[i];
+	}
+	hivScreening.numAcceptTest += other.hivScreening.numAcceptTest;
+	hivScreening.numRefuseTest += other.hivScreening.numRefuseTest;
+	hivScreening.numReturnForResults += other.hivScreening.numReturnForResults;
+	hivScreening.numNoReturnForResults += other.hivScreening.numNoReturnForResults;
+
+	hivScreening.numAcceptLabStaging += other.hivScreening.numAcceptLabStaging;
+	hivScreening.numRefuseLabStaging += other.hivScreening.numRefuseLabStaging;
+	hivScreening.numReturnForResultsLabStaging += other.hivScreening.numReturnForResultsLabStaging;
+	hivScreening.numNoReturnForResultsLabStaging += other.hivScreening.numNoReturnForResultsLabStaging;
+	hivScreening.numLinkLabStaging += other.hivScreening.numLinkLabStaging;
+	hivScreening.numNoLinkLabStaging += other.hivScreening.numNoLinkLabStaging;
+	for (int i=0; i< SimContext::HIV_POS_NUM;i++){
+		hivScreening.numAcceptLabStagingHIVState[i] += other.hivScreening.numAcceptLabStagingHIVState[i];
+		hivScreening.numReturnLabStagingHIVState[i] += other.hivScreening.numReturnLabStagingHIVState[i];
+	}
+	for (int i = 0; i < SimContext::CD4_NUM_STRATA; i++){
+		hivScreening.numReturnLabStagingObsvCD4[i] += other.hivScreening.numReturnLabStagingObsvCD4[i];
+		hivScreening.numReturnLabStagingTrueCD4[i] += other.hivScreening.numReturnLabStagingTrueCD4[i];
+		hivScreening.numLinkLabStagingObsvCD4[i] += other.hivScreening.numLinkLabStagingObsvCD4[i];
+		hivScreening.numLinkLabStagingTrueCD4[i] += other.hivScreening.numLinkLabStagingTrueCD4[i];
+		for (int j = 0; j < SimContext::CD4_NUM_STRATA; j++){
+			hivScreening.numLinkLabStagingObsvTrueCD4[i][j] += other.hivScreening.numLinkLabStagingObsvTrueCD4[i][j];
+			hivScreening.numReturnLabStagingObsvTrueCD4[i][j] += other.hivScreening.numReturnLabStagingObsvTrueCD4[i][j];
+		}
+	}
+
+	for (int i = 0; i < SimContext::TEST_RESULT_NUM; i++) {
+		hivScreening.numTestResultsPrevalentType[i] += other.hivScreening.numTestResultsPrevalentType[i];
+		hivScreening.numTestResultsIncidentType[i] += other.hivScreening.numTestResultsIncidentType[i];
+		hivScreening.numTestResultsHIVNegativeType[i] += other.hivScreening.numTestResultsHIVNegativeType[i];
+	}
+
+	hivScreening.numEverPrEP += other.hivScreening.numEverPrEP;
+	hivScreening.numDropoutPrEP += other.hivScreening.numDropoutPrEP;
+	hivScreening.numStopPrEPMaxAge += other.hivScreening.numStopPrEPMaxAge;
+
+	for (int i = 0; i < SimContext::EID_TEST_TYPE_NUM; i++) {
+		hivScreening.numEIDTestsGivenType[i] += other.hivScreening.numEIDTestsGivenType[i];
+		hivScreening.numTruePositiveEIDTestResultsType[i] += other.hivScreening.numTruePositiveEIDTestResultsType[i];
+		hivScreening.numTrueNegativeEIDTestResultsType[i] += other.hivScreening.numTrueNegativeEIDTestResultsType[i];
+		hivScreening.numFalsePositiveEIDTestResultsType[i] += other.hivScreening.numFalsePositiveEIDTestResultsType[i];
+		hivScreening.numFalseNegativeEIDTestResultsType[i] += other.hivScreening.numFalseNegativeEIDTestResultsType[i];
+	}
+	for (int i = 0; i < SimContext::EID_NUM_TESTS; i++) {
+		hivScreening.numEIDTestsGivenTest[i] += other.hivScreening.numEIDTestsGivenTest[i];
+		hivScreening.numTruePositiveEIDTestResultsTest[i] += other.hivScreening.numTruePositiveEIDTestResultsTest[i];
+		hivScreening.numTrueNegativeEIDTestResultsTest[i] += other.hivScreening.numTrueNegativeEIDTestResultsTest[i];
+		hivScreening.numFalsePositiveEIDTestResultsTest[i] += other.hivScreening.numFalsePositiveEIDTestResultsTest[i];
+		hivScreening.numFalseNegativeEIDTestResultsTest[i] += other.hivScreening.numFalseNegativeEIDTestResultsTest[i];
+	}
+
+	hivScreening.LMsFalsePositive += other.hivScreening.LMsFalsePositive;
+	hivScreening.LMsFalsePositiveLinked += other.hivScreening.LMsFalsePositiveLinked;
+} /* end mergeHIVScreening */
+
+/** \brief mergeInitialDistributions adds the InitialDistributions totals of another RunStats object to this one */
+void RunStats::mergeInitialDistributions(const RunStats &other) {
+	for (int i = 0; i < SimContext::CD4_NUM_STRATA; i++) {
+		initialDistributions.numPatientsCD4Level[i] += other.initialDistributions.numPatientsCD4Level[i];
+	}
+	for (int i = 0; i < SimContext::HVL_NUM_STRATA; i++) {
+		initialDistributions.numPatientsHVLLevel[i] += other.initialDistributions.numPatientsHVLLevel[i];
+		initialDistributions.numPatientsHVLSetpointLevel[i] += other.initialDistributions.numPatientsHVLSetpointLevel[i];
+	}
+	initialDistributions.sumInitialAgeMonths += other.initialDistributions.sumInitialAgeMonths;
+	initialDistributions.numMalePatients += other.initialDistributions.numMalePatients;
+	initialDistributions.numFemalePatients += other.initialDistributions.numFemalePatients;
+	for (int i = 0; i < SimContext::OI_NUM; i++) {
+		initialDistributions.numPriorOIHistories[i] += other.initialDistributions.numPriorOIHistories[i];
+	}
+	for (int i = 0; i < SimContext::CD4_RESPONSE_NUM_TYPES; i++) {
+		initialDistributions.numARTResposneTypes[i] += other.initialDistributions.numARTResposneTypes[i];
+	}
+	for (int i = 0; i < SimContext::RISK_FACT_NUM; i++) {
+		initialDistributions.numRiskFactors[i] += other.initialDistributions.numRiskFactors[i];
+	}
+	for (int i = 0; i < SimContext::PEDS_HIV_NUM; i++) {
+		for (int j = 0; j < SimContext::PEDS_MATERNAL_STATUS_NUM; j++) {
+			initialDistributions.numInitialPediatrics[i][j] += other.initialDistributions.numInitialPediatrics[i][j];
+		}
+	}
+} /* end mergeInitialDistributions */
+
+/** \brief mergeCHRMsStats adds the CHRMsStats totals of another RunStats object to this one */
+void RunStats::mergeCHRMsStats(const RunStats &other) {
+	for (int i = 0; i < SimContext::CHRM_NUM; i++) {
+		chrmsStats.numPatientsWithCHRM[i] += other.chrmsStats.numPatientsWithCHRM[i];
+		chrmsStats.numPatientsWithCHRMHIVPos[i] += other.chrmsStats.numPatientsWithCHRMHIVPos[i];
+		chrmsStats.numPatientsWithCHRMHIVNeg[i] += other.chrmsStats.numPatientsWithCHRMHIVNeg[i];
+		chrmsStats.numPrevalentCHRMHIVNeg[i] += other.chrmsStats.numPrevalentCHRMHIVNeg[i];
+		chrmsStats.numIncidentCHRMHIVneg[i] += other.chrmsStats.numIncidentCHRMHIVneg[i];
+	}
+	for (int i = 0; i < SimContext::CHRM_NUM; i++) {
+		for (int j = 0; j < SimContext::CD4_NUM_STRATA; j++) {
+			chrmsStats.numPrevalentCHRMCD4[i][j] += other.chrmsStats.numPrevalentCHRMCD4[i][j];
+			chrmsStats.numIncidentCHRMCD4[i][j] += other.chrmsStats.numIncidentCHRMCD4[i][j];
+			chrmsStats.numDeathsCHRMCD4[i][j] += other.chrmsStats.numDeathsCHRMCD4[i][j];
+		}
+	}
+} /* end mergeCHRMsStats */
+
+/** \brief mergeOIStats adds the OIStats totals of another RunStats object to this one */
+void RunStats::mergeOIStats(const RunStats &other) {
+	for (int i = 0; i < SimContext::CD4_NUM_STRATA; i++) {
+		for (int j = 0; j < SimContext::OI_NUM; j++) {
+			oiStats.numPrimaryOIsCD4OI[i][j] += other.oiStats.numPrimaryOIsCD4OI[i][j];
+			oiStats.numSecondaryOIsCD4OI[i][j] += other.oiStats.numSecondaryOIsCD4OI[i][j];
+			oiStats.numDetectedOIsCD4OI[i][j] += other.oiStats.numDetectedOIsCD4OI[i][j];
+		}
+	}
+	for (int i = 0; i < SimContext::HVL_NUM_STRATA; i++) {
+		for (int j = 0; j < SimContext::CD4_NUM_STRATA; j++) {
+			oiStats.numPatientsHVLCD4[i][j] += other.oiStats.numPatientsHVLCD4[i][j];
+			oiStats.numMonthsHVLCD4[i][j] += other.oiStats.numMonthsHVLCD4[i][j];
+		}
+	}
+	for (int i = 0; i < SimContext::OI_NUM; i++) {
+		for (int j = 0; j < SimContext::HVL_NUM_STRATA; j++) {
+			for (int k = 0; k < SimContext::CD4_NUM_STRATA; k++) {
+				oiStats.numPatientsOIHistoryHVLCD4[i][j][k] += other.oiStats.numPatientsOIHistoryHVLCD4[i][j][k];
+				oiStats.numMonthsOIHistoryHVLCD4[i][j][k] += other.oiStats.numMonthsOIHistoryHVLCD4[i][j][k];
+			}
+		}
+	}
+} /* end mergeOIStats */
+
+/** \brief mergeDeathStats adds the DeathStats totals of another RunStats object to this one */
+void RunStats::mergeDeathStats(const RunStats &other) {
+	deathStats.numDeathsUninfected += other.deathStats.numDeathsUninfected;
+	deathStats.numARTToxDeaths += other.deathStats.numARTToxDeaths;
+	for(int i = 0; i < SimContext::PEDS_CD4_AGE_CAT_NUM; i++){
+		deathStats.numARTToxDeathsCD4Metric[i] += other.deathStats.numARTToxDeathsCD4Metric[i];
+	}
+
+	for (int i = 0; i < SimContext::DTH_NUM_CAUSES; i++) {
+		deathStats.numDeathsType[i] += other.deathStats.numDeathsType[i];
+        for(int j = 0; j < SimContext::OUTPUT_AGE_CAT_NUM; j++){
+            deathStats.numDeathsTypeAge[i][j] += other.deathStats.numDeathsTypeAge[i][j];
+        }
+	}
+
+	for (int i = 0; i < SimContext::CD4_NUM_STRATA; i++) {
+		for (int j = 0; j < SimContext::DTH_NUM_CAUSES; j++) {
+			deathStats.numDeathsCD4Type[i][j] += other.deathStats.numDeathsCD4Type[i][j];
+		}
+	}
+	for (int i = 0; i < SimContext::HVL_NUM_STRATA; i++) {
+		for (int j = 0; j < SimContext::CD4_NUM_STRATA; j++) {
+			deathStats.numDeathsHVLCD4[i][j] += other.deathStats.numDeathsHVLCD4[i][j];
+		}
+	}
+
+	for (int i = 0; i < SimContext::HIV_CARE_NUM; i++){
+		for (int j = 0; j < SimContext::DTH_NUM_CAUSES; j++){
+			deathStats.numDeathsCareType[i][j] += other.deathStats.numDeathsCareType[i][j];
+		}
+	}
+
+	for (int i=0;i<SimContext::CD4_NUM_STRATA;i++){
+		deathStats.numARTToxDeathsCD4[i] += other.deathStats.numARTToxDeathsCD4[i];
+		for (int j=0;j<SimContext::HVL_NUM_STRATA;j++){
+			deathStats.numARTToxDeathsCD4HVL[i][j] += other.deathStats.numARTToxDeathsCD4HVL[i][j];
+			for (int k=0;k<SimContext::OI_NUM;k++){
+				deathStats.numARTToxDeathsCD4HVLOIHist[i][j][k] += other.deathStats.numARTToxDeathsCD4HVLOIHist[i][j][k];
+			}
+		}
+	}
+
+	for (int i = 0; i < SimContext::CD4_NUM_STRATA; i++) {
+		deathStats.numHIVDeathsNoOIHistoryCD4[i] += other.deathStats.numHIVDeathsNoOIHistoryCD4[i];
+		deathStats.numHIVDeathsOIHistoryCD4[i] += other.deathStats.numHIVDeathsOIHistoryCD4[i];
+		deathStats.numBackgroundMortDeathsNoOIHistoryCD4[i] += other.deathStats.numBackgroundMortDeathsNoOIHistoryCD4[i];
+		deathStats.numBackgroundMortDeathsOIHistoryCD4[i] += other.deathStats.numBackgroundMortDeathsOIHistoryCD4[i];
+	}
+	deathStats.ARTToxDeathsCD4Sum += other.deathStats.ARTToxDeathsCD4Sum;
+	deathStats.ARTToxDeathsCD4SumSquares += other.deathStats.ARTToxDeathsCD4SumSquares;
+} /* end mergeDeathStats */
+
+/** \brief mergeOverallSurvival adds the OverallSurvival totals of another RunStats object to this one */
+void RunStats::mergeOverallSurvival(const RunStats &other) {
+	for (int i = 0; i < SimContext::CD4_NUM_STRATA; i++) {
+		overallSurvival.LMsNoOIHistoryCD4[i] += other.overallSurvival.LMsNoOIHistoryCD4[i];
+		overallSurvival.LMsOIHistoryCD4[i] += other.overallSurvival.LMsOIHistoryCD4[i];
+	}
+	for (int i = 0; i < SimContext::HVL_NUM_STRATA; i++) {
+		overallSurvival.LMsHVL[i] += other.overallSurvival.LMsHVL[i];
+		overallSurvival.LMsHVLSetpoint[i] += other.overallSurvival.LMsHVLSetpoint[i];
+	}
+	for (int i = 0; i < SimContext::OI_NUM; i++) {
+		overallSurvival.LMsNoOIHistoryOIs[i] += other.overallSurvival.LMsNoOIHistoryOIs[i];
+		overallSurvival.LMsOIHistoryOIs[i] += other.overallSurvival.LMsOIHistoryOIs[i];
+	}
+	for (int i=0;i<SimContext::CHRM_NUM;i++){
+		overallSurvival.LMsCHRMHistoryCHRMsHIVPos[i] += other.overallSurvival.LMsCHRMHistoryCHRMsHIVPos[i];
+		overallSurvival.LMsCHRMHistoryCHRMsHIVNeg[i] += other.overallSurvival.LMsCHRMHistoryCHRMsHIVNeg[i];
+	}
+	for (int i = 0; i < SimContext::HIV_ID_NUM; i++) {
+		overallSurvival.LMsHIVState[i] += other.overallSurvival.LMsHIVState[i];
+		overallSurvival.QALMsHIVState[i] += other.overallSurvival.QALMsHIVState[i];
+	}
+	overallSurvival.LMsInScreening += other.overallSurvival.LMsInScreening;
+	overallSurvival.QALMsInScreening += other.overallSurvival.QALMsInScreening;
+	overallSurvival.LMsHIVNegativeOnPrEP += other.overallSurvival.LMsHIVNegativeOnPrEP;
+	overallSurvival.LMsInRegularCEPAC += other.overallSurvival.LMsInRegularCEPAC;
+
+	for (int i = 0; i < SimContext::GENDER_NUM; i++) {
+		overallSurvival.LMsGender[i] += other.overallSurvival.LMsGender[i];
+		overallSurvival.QALMsGender[i] += other.overallSurvival.QALMsGender[i];
+	}
+} /* end mergeOverallSurvival */
+
+/** \brief mergeOverallCosts adds the OverallCosts totals of another RunStats object to this one */
+void RunStats::mergeOverallCosts(const RunStats &other) {
+	overallCosts.costsTBTotal += other.overallCosts.costsTBTotal;
+	for (int i = 0; i < SimContext::CD4_NUM_STRATA; i++) {
+		overallCosts.costsNoOIHistoryCD4[i] += other.overallCosts.costsNoOIHistoryCD4[i];
+		overallCosts.costsOIHistoryCD4[i] += other.overallCosts.costsOIHistoryCD4[i];
+		overallCosts.costsTotalCD4[i] += other.overallCosts.costsTotalCD4[i];
+	}
+	for (int i = 0; i < SimContext::HVL_NUM_STRATA; i++) {
+		overallCosts.costsHVL[i] += other.overallCosts.costsHVL[i];
+		overallCosts.costsHVLSetpoint[i] += other.overallCosts.costsHVLSetpoint[i];
+	}
+	for (int i = 0; i < SimContext::OI_NUM; i++) {
+		for (int j = 0; j < SimContext::PROPH_NUM; j++) {
+			overallCosts.directCostsProphOIsProph[i][j] += other.overallCosts.directCostsProphOIsProph[i][j];
+		}
+	}
+	overallCosts.directCostsART += other.overallCosts.directCostsART;
+	for (int i = 0; i < SimContext::ART_NUM_LINES; i++) {
+		overallCosts.directCostsARTLine[i] += other.overallCosts.directCostsARTLine[i];
+		overallCosts.costsARTInitLine[i] += other.overallCosts.costsARTInitLine[i];
+		overallCosts.costsARTMonthlyLine[i] += other.overallCosts.costsARTMonthlyLine[i];
+		for (int j = 0; j < SimContext::NUM_DISCOUNT_RATES; j++){
+			overallCosts.directCostsARTLineMultDisc[i][j] += other.overallCosts.directCostsARTLineMultDisc[i][j];
+			overallCosts.costsARTInitLineMultDisc[i][j] += other.overallCosts.costsARTInitLineMultDisc[i][j];
+			overallCosts.costsARTMonthlyLineMultDisc[i][j] += other.overallCosts.costsARTMonthlyLineMultDisc[i][j];
+		}
+	}
+	for (int i = 0; i < SimContext::HIV_ID_NUM; i++) {
+		overallCosts.costsHIVState[i] += other.overallCosts.costsHIVState[i];
+	}
+	overallCosts.costsCD4Testing += other.overallCosts.costsCD4Testing;
+	overallCosts.costsHVLTesting += other.overallCosts.costsHVLTesting;
+
+	for (int j = 0; j < SimContext::NUM_DISCOUNT_RATES; j++){
+		overallCosts.costsCD4TestingMultDisc[j] += other.overallCosts.costsCD4TestingMultDisc[j];
+		overallCosts.costsHVLTestingMultDisc[j] += other.overallCosts.costsHVLTestingMultDisc[j];
+	}
+
+	for (int j = 0; j < SimContext::COST_NUM_TYPES; j++){
+        overallCosts.costsTBProviderVisits[j] += other.overallCosts.costsTBProviderVisits[j];
+        overallCosts.costsTBMedicationVisits[j] += other.overallCosts.costsTBMedicationVisits[j];
+	}
+
+	overallCosts.costsTBTests += other.overallCosts.costsTBTests;
+
+	for (int j = 0; j < SimContext::TB_NUM_TESTS; j++){
+        overallCosts.costsTBTestsInit[j] += other.overallCosts.costsTBTestsInit[j];
+        overallCosts.costsTBTestsDST[j] += other.overallCosts.costsTBTestsDST[j];
+	}
+
+	overallCosts.costsTBTreatment += other.overallCosts.costsTBTreatment;
+
+	for (int j = 0; j < SimContext::TB_NUM_TREATMENTS; j++){
+        overallCosts.costsTBTreatmentByLine[j] += other.overallCosts.costsTBTreatmentByLine[j];
+        overallCosts.costsTBTreatmentToxByLine[j] += other.overallCosts.costsTBTreatmentToxByLine[j];
+	}
+
+	overallCosts.costsClinicVisits += other.overallCosts.costsClinicVisits;
+	overallCosts.costsEIDVisits += other.overallCosts.costsEIDVisits;
+	overallCosts.costsPrEP += other.overallCosts.costsPrEP;
+	overallCosts.costsPrEPNeverHIV += other.overallCosts.costsPrEPNeverHIV;
+	for(int j = 0; j < SimContext::HIV_POS_NEVER_PREP; j++)
+		overallCosts.costsPrEPHIVPos[j] += other.overallCosts.costsPrEPHIVPos[j];
+	overallCosts.costsHIVScreeningTests += other.overallCosts.costsHIVScreeningTests;
+	overallCosts.costsHIVScreeningMisc += other.overallCosts.costsHIVScreeningMisc;
+	overallCosts.costsLabStagingTests += other.overallCosts.costsLabStagingTests;
+	overallCosts.costsEIDTests += other.overallCosts.costsEIDTests;
+	overallCosts.costsInfantHIVProph += other.overallCosts.costsInfantHIVProph;
+	overallCosts.costsLabStagingMisc += other.overallCosts.costsLabStagingMisc;
+	overallCosts.costsEIDMisc += other.overallCosts.costsEIDMisc;
+	for (int i = 0; i < SimContext::COST_NUM_TYPES; i++) {
+		overallCosts.totalUndiscountedCosts[i] += other.overallCosts.totalUndiscountedCosts[i];
+		overallCosts.totalDiscountedCosts[i] += other.overallCosts.totalDiscountedCosts[i];
+	}
+
+	overallCosts.costsDrugs += other.overallCosts.costsDrugs;
+	overallCosts.costsInterventionStartup += other.overallCosts.costsInterventionStartup;
+	overallCosts.costsInterventionMonthly += other.overallCosts.costsInterventionMonthly;
+	overallCosts.costsToxicity += other.overallCosts.costsToxicity;
+
+	overallCosts.costsDrugsDiscounted += other.overallCosts.costsDrugsDiscounted;
+	overallCosts.costsToxicityDiscounted += other.overallCosts.costsToxicityDiscounted;
+
+	for (int i=0;i<SimContext::CHRM_NUM;i++){
+		overallCosts.costsCHRMs[i] += other.overallCosts.costsCHRMs[i];
+	}
+
+	for (int i = 0; i < SimContext::GENDER_NUM; i++) {
+		overallCosts.costsGender[i] += other.overallCosts.costsGender[i];
+	}
+} /* end mergeOverallCosts */
+
+/** \brief mergeTBStats adds the TBStats totals of another RunStats object to this one */
+void RunStats::mergeTBStats(const RunStats &other) {
+	for (int i = 0; i < SimContext::TB_NUM_STATES; i++)
+		for (int j = 0; j < SimContext::TB_NUM_STRAINS; j++)
+			tbStats.numInfections[i][j] += other.tbStats.numInfections[i][j];
+
+	for (int i = 0; i < SimContext::TB_NUM_STRAINS; i++) {
+		tbStats.numReactivationsLatent[i] += other.tbStats.numReactivationsLatent[i];
+		tbStats.numReactivationsPulmLatent[i] += other.tbStats.numReactivationsPulmLatent[i];
+		tbStats.numReactivationsExtraPulmLatent[i] += other.tbStats.numReactivationsExtraPulmLatent[i];
+
+		tbStats.numRelapses[i] += other.tbStats.numRelapses[i];
+		tbStats.numRelapsesPulm[i] += other.tbStats.numRelapsesPulm[i];
+		tbStats.numRelapsesExtraPulm[i] += other.tbStats.numRelapsesExtraPulm[i];
+
+		tbStats.numTBSelfCures[i] += other.tbStats.numTBSelfCures[i];
+		tbStats.numDeathsHIVPos[i] += other.tbStats.numDeathsHIVPos[i];
+		tbStats.numDeathsHIVNeg[i] += other.tbStats.numDeathsHIVNeg[i];
+	}
+	for (int i = 0; i < SimContext::TB_NUM_TREATMENTS; i++) {
+		tbStats.numTreatmentMinorToxicity[i] += other.tbStats.numTreatmentMinorToxicity[i];
+		tbStats.numTreatmentMajorToxicity[i] += other.tbStats.numTreatmentMajorToxicity[i];
+	}
+	for (int i = 0; i < SimContext::TB_NUM_PROPHS; i++) {
+		tbStats.numProphMinorToxicity[i] += other.tbStats.numProphMinorToxicity[i];
+		tbStats.numProphMajorToxicity[i] += other.tbStats.numProphMajorToxicity[i];
+	}
+	for (int i = 0; i < SimContext::TB_NUM_STRAINS; i++) {
+		for (int j = 0; j < SimContext::TB_NUM_STATES; j++) {
+			tbStats.numInStateAtEntryStrain[i][j] += other.tbStats.numInStateAtEntryStrain[i][j];
+		}
+	}
+	tbStats.numUninfectedTBAtEntry += other.tbStats.numUninfectedTBAtEntry;
+	for(int i =0; i <2; i++){
+		for(int j = 0; j < 2; j++){
+			for (int k = 0; k < 2; k++){
+				for (int l = 0; l < 2; l++){
+					tbStats.numWithUnfavorableOutcome[i][j][k][l] += other.tbStats.numWithUnfavorableOutcome[i][j][k][l];
+				}
+			}
+		}
+	}
+	for (int i = 0; i < SimContext::TB_NUM_STRAINS; i++) {
+		for (int j = 0; j < SimContext::TB_NUM_TREATMENTS; j++) {
+			tbStats.numStartOnTreatment[i][j] += other.tbStats.numStartOnTreatment[i][j];
+			tbStats.numDropoutTreatment[i][j] += other.tbStats.numDropoutTreatment[i][j];
+			tbStats.numTransitionsToTBTreatmentDefault[i][j] += other.tbStats.numTransitionsToTBTreatmentDefault[i][j];
+			tbStats.numFinishTreatment[i][j] += other.tbStats.numFinishTreatment[i][j];
+			tbStats.numCuredAtTreatmentFinish[i][j] += other.tbStats.numCuredAtTreatmentFinish[i][j];
+			tbStats.numIncreaseResistanceAtTreatmentStop[i][j] += other.tbStats.numIncreaseResistanceAtTreatmentStop[i][j];
+		}
+	}
+
+	for (int i = 0; i < SimContext::TB_NUM_STRAINS; i++){
+		tbStats.numDSTTestResultsUninfectedTB[i] += other.tbStats.numDSTTestResultsUninfectedTB[i];
+		for (int j = 0; j < SimContext::TB_NUM_STRAINS; j++)
+			tbStats.numDSTTestResultsByTrueTBStrain[i][j] += other.tbStats.numDSTTestResultsByTrueTBStrain[i][j];
+	}
+} /* end mergeTBStats */
+
+/** \brief mergeLTFUStats adds the LTFUStats totals of another RunStats object to this one */
+void RunStats::mergeLTFUStats(const RunStats &other) {
+	ltfuStats.numPatientsLost += other.ltfuStats.numPatientsLost;
+	ltfuStats.numPatientsReturned += other.ltfuStats.numPatientsReturned;
+	for (int i = 0; i < SimContext::CD4_NUM_STRATA; i++) {
+		ltfuStats.numLostToFollowUpCD4[i] += other.ltfuStats.numLostToFollowUpCD4[i];
+		ltfuStats.numReturnToCareCD4[i] += other.ltfuStats.numReturnToCareCD4[i];
+		ltfuStats.numDeathsWhileLostCD4[i] += other.ltfuStats.numDeathsWhileLostCD4[i];
+	}
+	ltfuStats.monthsLostBeforeReturnSum += other.ltfuStats.monthsLostBeforeReturnSum;
+	ltfuStats.monthsLostBeforeReturnSumSquares += other.ltfuStats.monthsLostBeforeReturnSumSquares;
+	ltfuStats.numLostToFollowUpPreART += other.ltfuStats.numLostToFollowUpPreART;
+	ltfuStats.numLostToFollowUpPostART += other.ltfuStats.numLostToFollowUpPostART;
+	ltfuStats.numReturnToCarePreART += other.ltfuStats.numReturnToCarePreART;
+	ltfuStats.numReturnToCarePostART += other.ltfuStats.numReturnToCarePostART;
+	ltfuStats.numDeathsWhileLostPreART += other.ltfuStats.numDeathsWhileLostPreART;
+	ltfuStats.numDeathsWhileLostPostART += other.ltfuStats.numDeathsWhileLostPostART;
+	for (int i = 0; i < SimContext::ART_NUM_LINES; i++) {
+		ltfuStats.numLostToFollowUpART[i] += other.ltfuStats.numLostToFollowUpART[i];
+		ltfuStats.numReturnOnPrevART[i] += other.ltfuStats.numReturnOnPrevART[i];
+		ltfuStats.numReturnOnNextART[i] += other.ltfuStats.numReturnOnNextART[i];
+		ltfuStats.numDeathsWhileLostART[i] += other.ltfuStats.numDeathsWhileLostART[i];
+	}
+} /* end mergeLTFUStats */
+
+/** \brief mergeProphStats adds the ProphStats totals of another RunStats object to this one */
+void RunStats::mergeProphStats(const RunStats &other) {
+	for (int i = 0; i < SimContext::OI_NUM; i++) {
+		for (int j = 0; j < SimContext::PROPH_NUM; j++) {
+			prophStats.numMinorToxicity[i][j] += other.prophStats.numMinorToxicity[i][j];
+			prophStats.numMajorToxicity[i][j] += other.prophStats.numMajorToxicity[i][j];
+			for (int k = 0; k < SimContext::PROPH_NUM_TYPES; k++) {
+				prophStats.trueCD4InitProphSum[k][i][j] += other.prophStats.trueCD4InitProphSum[k][i][j];
+				prophStats.observedCD4InitProphSum[k][i][j] += other.prophStats.observedCD4InitProphSum[k][i][j];
+				prophStats.numTimesInitProph[k][i][j] += other.prophStats.numTimesInitProph[k][i][j];
+				prophStats.numTimesInitProphWithObservedCD4[k][i][j] += other.prophStats.numTimesInitProphWithObservedCD4[k][i][j];
+				for(int l = 0; l < SimContext::PEDS_CD4_AGE_CAT_NUM; l++)
+					prophStats.numTimesInitProphCD4Metric[k][i][j][l] += other.prophStats.numTimesInitProphCD4Metric[k][i][j][l];
+			}
+		}
+	}
+} /* end mergeProphStats */
+
+/** \brief mergeARTStats adds the ARTStats totals of another RunStats object to this one */
+void RunStats::mergeARTStats(const RunStats &other) {
+	for (int i = 0; i < SimContext::ART_NUM_LINES; i++) {
+		artStats.monthsSuppressedLine[i] += other.artStats.monthsSuppressedLine[i];
+		artStats.numOnARTAtInit[i] += other.artStats.numOnARTAtInit[i];
+		for(int j = 0; j < SimContext::PEDS_CD4_AGE_CAT_NUM; j++){
+			artStats.numOnARTAtInitCD4Metric[i][j] += other.artStats.numOnARTAtInitCD4Metric[i][j];
+			artStats.trueCD4AtInitSum[i][j] += other.artStats.trueCD4AtInitSum[i][j];
+		}
+		artStats.observedCD4AtInitSum[i] += other.artStats.observedCD4AtInitSum[i];
+		artStats.numWithObservedCD4AtInit[i] += other.artStats.numWithObservedCD4AtInit[i];
+		for (int j = 0; j < SimContext::ART_EFF_NUM_TYPES; j++) {
+			artStats.numDrawEfficacyAtInit[i][j] += other.artStats.numDrawEfficacyAtInit[i][j];
+		}
+		for (int j = 0; j < SimContext::CD4_RESPONSE_NUM_TYPES; j++) {
+			artStats.numCD4ResponseTypeAtInit[i][j] += other.artStats.numCD4ResponseTypeAtInit[i][j];
+		}
+		for (int j = 0; j < SimContext::RISK_FACT_NUM; j++) {
+			artStats.numWithRiskFactorAtInit[i][j] += other.artStats.numWithRiskFactorAtInit[i][j];
+		}
+		artStats.numTrueFailure[i] += other.artStats.numTrueFailure[i];
+		for (int j = 0; j < SimContext::PEDS_CD4_AGE_CAT_NUM; j++) {
+			artStats.numTrueFailureCD4Metric[i][j] += other.artStats.numTrueFailureCD4Metric[i][j];
+			artStats.trueCD4AtTrueFailureSum[i][j] += other.artStats.trueCD4AtTrueFailureSum[i][j];
+		}
+		artStats.observedCD4AtTrueFailureSum[i] += other.artStats.observedCD4AtTrueFailureSum[i];
+		artStats.numWithObservedCD4AtTrueFailure[i] += other.artStats.numWithObservedCD4AtTrueFailure[i];
+		artStats.monthsToTrueFailureSum[i] += other.artStats.monthsToTrueFailureSum[i];
+		artStats.monthsToTrueFailureSumSquares[i] += other.artStats.monthsToTrueFailureSumSquares[i];
+
+		for (int j = 0; j < SimContext::RESP_NUM_TYPES; j++) {
+			for(int k=0;k<SimContext::HET_NUM_OUTCOMES;k++){
+				artStats.numOnARTAtInitResp[i][k][j] += other.artStats.numOnARTAtInitResp[i][k][j];
+				artStats.trueCD4AtInitSumResp[i][k][j] += other.artStats.trueCD4AtInitSumResp[i][k][j];
+				artStats.numWithObservedCD4AtInitResp[i][k][j] += other.artStats.numWithObservedCD4AtInitResp[i][k][j];
+				artStats.observedCD4AtInitSumResp[i][k][j] += other.artStats.observedCD4AtInitSumResp[i][k][j];
+			}
+
+			for (int k = 0; k < SimContext::ART_EFF_NUM_TYPES; k++) {
+				for(int l=0;l<SimContext::HET_NUM_OUTCOMES;l++){
+					artStats.numDrawEfficacyAtInitResp[i][k][l][j] += other.artStats.numDrawEfficacyAtInitResp[i][k][l][j];
+				}
+			}
+
+			for (int k = 0; k < SimContext::CD4_RESPONSE_NUM_TYPES; k++) {
+				for (int l=0;l<SimContext::HET_NUM_OUTCOMES;l++){
+					artStats.numCD4ResponseTypeAtInitResp[i][k][l][j] += other.artStats.numCD4ResponseTypeAtInitResp[i][k][l][j];
+				}
+			}
+			for (int k = 0; k < SimContext::RISK_FACT_NUM; k++) {
+				for (int l=0;l <SimContext::HET_NUM_OUTCOMES;l++){
+					artStats.numWithRiskFactorAtInitResp[i][k][l][j] += other.artStats.numWithRiskFactorAtInitResp[i][k][l][j];
+				}
+			}
+
+			for(int k=0;k<SimContext::HET_NUM_OUTCOMES;k++){
+				artStats.numTrueFailureResp[i][k][j] += other.artStats.numTrueFailureResp[i][k][j];
+				artStats.trueCD4AtTrueFailureSumResp[i][k][j] += other.artStats.trueCD4AtTrueFailureSumResp[i][k][j];
+				artStats.numWithObservedCD4AtTrueFailureResp[i][k][j] += other.artStats.numWithObservedCD4AtTrueFailureResp[i][k][j];
+				artStats.observedCD4AtTrueFailureSumResp[i][k][j] += other.artStats.observedCD4AtTrueFailureSumResp[i][k][j];
+				artStats.monthsToTrueFailureSumResp[i][k][j] += other.artStats.monthsToTrueFailureSumResp[i][k][j];
+				artStats.monthsToTrueFailureSumSquaresResp[i][k][j] += other.artStats.monthsToTrueFailureSumSquaresResp[i][k][j];
+			}
+		}
+
+		artStats.monthsOnSTIInterruptionSum[i] += other.artStats.monthsOnSTIInterruptionSum[i];
+		for (int j = 0; j < SimContext::HVL_NUM_STRATA; j++) {
+			artStats.monthsFailedLineHVL[i][j] += other.artStats.monthsFailedLineHVL[i][j];
+		}
+		for(int j = 0; j < SimContext::PEDS_CD4_AGE_CAT_NUM; j++){
+			artStats.numObservedFailureCD4Metric[i][j] += other.artStats.numObservedFailureCD4Metric[i][j];
+		}
+		for (int j = 0; j < SimContext::ART_NUM_FAIL_TYPES; j++) {
+			artStats.numObservedFailureType[i][j] += other.artStats.numObservedFailureType[i][j];
+			for(int k = 0; k < SimContext::PEDS_CD4_AGE_CAT_NUM; k++){
+				artStats.numObservedFailureTypeCD4Metric[i][j][k] += other.artStats.numObservedFailureTypeCD4Metric[i][j][k];
+				artStats.trueCD4AtObservedFailureSumType[i][j][k] += other.artStats.trueCD4AtObservedFailureSumType[i][j][k];
+			}
+			artStats.numObservedFailureAfterTrueType[i][j] += other.artStats.numObservedFailureAfterTrueType[i][j];
+			artStats.numObservedCD4atObservedFailureType[i][j] += other.artStats.numObservedCD4atObservedFailureType[i][j];
+			artStats.observedCD4AtObservedFailureSumType[i][j] += other.artStats.observedCD4AtObservedFailureSumType[i][j];
+			artStats.monthsToObservedFailureSumType[i][j] += other.artStats.monthsToObservedFailureSumType[i][j];
+			artStats.monthsToObservedFailureSumSquaresType[i][j] += other.artStats.monthsToObservedFailureSumSquaresType[i][j];
+		}
+		for (int j = 0; j < SimContext::ART_NUM_STOP_TYPES; j++) {
+			artStats.numStopType[i][j] += other.artStats.numStopType[i][j];
+			artStats.numStopAfterTrueFailureType[i][j] += other.artStats.numStopAfterTrueFailureType[i][j];
+			for(int k = 0; k < SimContext::PEDS_CD4_AGE_CAT_NUM; k++){
+				artStats.numStopTypeCD4Metric[i][j][k] += other.artStats.numStopTypeCD4Metric[i][j][k];
+				artStats.trueCD4AtStopSumType[i][j][k] += other.artStats.trueCD4AtStopSumType[i][j][k];
+			}
+			artStats.numWithObservedCD4StopType[i][j] += other.artStats.numWithObservedCD4StopType[i][j];
+			artStats.observedCD4AtStopSumType[i][j] += other.artStats.observedCD4AtStopSumType[i][j];
+			artStats.monthsToStopSumType[i][j] += other.artStats.monthsToStopSumType[i][j];
+			artStats.monthsToStopSumSquaresType[i][j] += other.artStats.monthsToStopSumSquaresType[i][j];
+		}
+		for (int j = 0; j < SimContext::ART_NUM_MTHS_RECORD; j++) {
+			artStats.numOnARTAtMonth[i][j] += other.artStats.numOnARTAtMonth[i][j];
+			artStats.numSuppressedAtMonth[i][j] += other.artStats.numSuppressedAtMonth[i][j];
+			artStats.HVLDropsAtMonthSum[i][j] += other.artStats.HVLDropsAtMonthSum[i][j];
+			artStats.HVLDropsAtMonthSumSquares[i][j] += other.artStats.HVLDropsAtMonthSumSquares[i][j];
+		}
+
+		artStats.numARTDeath[i] += other.artStats.numARTDeath[i];
+		for(int j = 0; j < SimContext::PEDS_CD4_AGE_CAT_NUM; j++){
+			artStats.numARTDeathCD4Metric[i][j] += other.artStats.numARTDeathCD4Metric[i][j];
+			artStats.trueCD4AtARTDeathSum[i][j] += other.artStats.trueCD4AtARTDeathSum[i][j];
+		}
+		artStats.numWithObservedCD4AtARTDeath[i] += other.artStats.numWithObservedCD4AtARTDeath[i];
+		artStats.observedCD4AtARTDeathSum[i] += other.artStats.observedCD4AtARTDeathSum[i];
+		artStats.propensityAtARTDeathSum[i] += other.artStats.propensityAtARTDeathSum[i];
+
+		for (int j = 0; j < SimContext::DTH_NUM_CAUSES; j++){
+			artStats.numARTDeathCause[i][j] += other.artStats.numARTDeathCause[i][j];
+			for(int k = 0; k < SimContext::PEDS_CD4_AGE_CAT_NUM; k++){
+				artStats.numARTDeathCauseCD4Metric[i][j][k] += other.artStats.numARTDeathCauseCD4Metric[i][j][k];
+				artStats.trueCD4AtARTDeathCauseSum[i][j][k] += other.artStats.trueCD4AtARTDeathCauseSum[i][j][k];
+			}
+			artStats.numWithObservedCD4AtARTDeathCause[i][j] += other.artStats.numWithObservedCD4AtARTDeathCause[i][j];
+			artStats.observedCD4AtARTDeathCauseSum[i][j] += other.artStats.observedCD4AtARTDeathCauseSum[i][j];
+			artStats.propensityAtARTDeathCauseSum[i][j] += other.artStats.propensityAtARTDeathCauseSum[i][j];
+		}
+
+		for (int j = 0; j < SimContext::OI_NUM; j++){
+			artStats.numARTOI[i][j] += other.artStats.numARTOI[i][j];
+			for(int k = 0; k < SimContext::PEDS_CD4_AGE_CAT_NUM; k++){
+				artStats.numARTOICD4Metric[i][j][k] += other.artStats.numARTOICD4Metric[i][j][k];
+				artStats.trueCD4AtARTOISum[i][j][k] += other.artStats.trueCD4AtARTOISum[i][j][k];
+			}
+			artStats.numWithObservedCD4AtARTOI[i][j] += other.artStats.numWithObservedCD4AtARTOI[i][j];
+			artStats.observedCD4AtARTOISum[i][j] += other.artStats.observedCD4AtARTOISum[i][j];
+			artStats.propensityAtARTOISum[i][j] += other.artStats.propensityAtARTOISum[i][j];
+		}
+
+		artStats.numARTEverInit[i] += other.artStats.numARTEverInit[i];
+		for(int j = 0; j < SimContext::PEDS_CD4_AGE_CAT_NUM; j++){
+			artStats.numARTEverInitCD4Metric[i][j] += other.artStats.numARTEverInitCD4Metric[i][j];
+			artStats.trueCD4AtARTEverInitSum[i][j] += other.artStats.trueCD4AtARTEverInitSum[i][j];
+		}
+		artStats.numWithObservedCD4AtARTEverInit[i] += other.artStats.numWithObservedCD4AtARTEverInit[i];
+		artStats.observedCD4AtARTEverInitSum[i] += other.artStats.observedCD4AtARTEverInitSum[i];
+		artStats.propensityAtARTEverInitSum[i] += other.artStats.propensityAtARTEverInitSum[i];
+
+		for (int j = 0; j < SimContext::CD4_NUM_STRATA; j++) {
+			for (int k = 0; k < SimContext::HVL_NUM_STRATA; k++) {
+				artStats.distributionAtInit[i][j][k] += other.artStats.distributionAtInit[i][j][k];
+			}
+		}
+		for (int j = 0; j < SimContext::ART_NUM_TOX_SEVERITY; j++) {
+			for (int k = 0; k < SimContext::HVL_NUM_STRATA; k++) {
+				artStats.numToxicityCases[i][j][k] += other.artStats.numToxicityCases[i][j][k];
+			}
+		}
+		for (int j = 0; j < SimContext::HVL_NUM_STRATA; j++) {
+			artStats.numToxicityDeaths[i][j] += other.artStats.numToxicityDeaths[i][j];
+		}
+		for (int j = 0; j < SimContext::STI_NUM_TRACKED; j++) {
+			artStats.numSTIInterruptions[i][j] += other.artStats.numSTIInterruptions[i][j];
+			artStats.numSTIRestarts[i][j] += other.artStats.numSTIRestarts[i][j];
+			artStats.numSTIEndpoints[i][j] += other.artStats.numSTIEndpoints[i][j];
+			artStats.numPatientsWithSTIInterruptions[i][j] += other.artStats.numPatientsWithSTIInterruptions[i][j];
+		}
+	}
+} /* end mergeARTStats */
+
+/** \brief mergeTimeSummary adds the totals of another TimeSummary for the same time period to the given TimeSummary */
+void RunStats::mergeTimeSummary(TimeSummary *currTime, const TimeSummary *otherTime) {
+	currTime->numAlive += otherTime->numAlive;
+
+	//TB longitudinal outputs
+	for (int i = 0; i < SimContext::TB_NUM_STATES; i++)
+		currTime->numAliveTB[i] += otherTime->numAliveTB[i];
+
+	for (int i = 0; i < SimContext::TB_NUM_TRACKER; i++){
+		for (int j = 0; j < SimContext::HIV_CARE_NUM; j++){
+			currTime->numAliveTBTrackerCare[i][j] += otherTime->numAliveTBTrackerCare[i][j];
+		}
+	}
+
+	currTime->numTBLTFU += otherTime->numTBLTFU;
+
+	for (int i = 0; i < SimContext::TB_NUM_PROPHS; i++){
+		currTime->numTBProphMinorTox[i] += otherTime->numTBProphMinorTox[i];
+		currTime->numTBProphMajorTox[i] += otherTime->numTBProphMajorTox[i];
+		for(int j =0; j < SimContext::TB_NUM_STRAINS; j++){
+			currTime->numIncreaseResistanceDueToProph[j][i] += otherTime->numIncreaseResistanceDueToProph[j][i];
+		}
+		for( int j = 0; j < SimContext::TB_NUM_STATES; j++){
+			currTime->numOnTBProph[i][j] += otherTime->numOnTBProph[i][j];
+			currTime->numCompletedTBProph[i][j] += otherTime->numCompletedTBProph[i][j];
+		}
+	}
+
+	for (int i = 0; i < SimContext::TB_NUM_TREATMENTS; i++){
+		currTime->numOnTBTreatmentTotal[i] += otherTime->numOnTBTreatmentTotal[i];
+		currTime->numOnEmpiricTBTreatmentTotal[i] += otherTime->numOnEmpiricTBTreatmentTotal[i];
+		for (int j = 0; j < SimContext::TB_NUM_STATES; j++){
+			currTime->numOnTBTreatmentByState[j][i] += otherTime->numOnTBTreatmentByState[j][i];
+			currTime->numOnEmpiricTBTreatmentByState[j][i] += otherTime->numOnEmpiricTBTreatmentByState[j][i];
+		}
+	}
+
+	for (int i = 0; i < SimContext::TB_NUM_STRAINS; i++)
+		currTime->numTBStrain[i] += otherTime->numTBStrain[i];
+
+	for (int i = 0; i < SimContext::TB_NUM_TRACKER; i++){
+		for (int j = 0; j < SimContext::CD4_NUM_STRATA; j++){
+			currTime->numHIVTBTrackerCD4[i][j] += otherTime->numHIVTBTrackerCD4[i][j];
+		}
+	}
+
+	for (int i = 0; i < SimContext::TB_NUM_STATES; i++){
+		for (int j = 0; j < SimContext::TB_NUM_STRAINS; j++){
+			currTime->numTBInfections[i][j] += otherTime->numTBInfections[i][j];
+		}
+	}
+
+	for (int i = 0; i < SimContext::TB_NUM_STRAINS; i++) {
+		currTime->numTBReactivationsLatent[i] += otherTime->numTBReactivationsLatent[i];
+		currTime->numTBReactivationsPulmLatentHIVNegative[i] += otherTime->numTBReactivationsPulmLatentHIVNegative[i];
+		currTime->numTBReactivationsExtraPulmLatentHIVNegative[i] += otherTime->numTBReactivationsExtraPulmLatentHIVNegative[i];
+
+		currTime->numTBRelapses[i] += otherTime->numTBRelapses[i];
+		currTime->numTBRelapsesPulm[i] += otherTime->numTBRelapsesPulm[i];
+		currTime->numTBRelapsesExtraPulm[i] += otherTime->numTBRelapsesExtraPulm[i];
+
+		for(int j=0;j<SimContext::CD4_NUM_STRATA;j++){
+			currTime->numTBReactivationsPulmLatentHIVPositive[j][i] += otherTime->numTBReactivationsPulmLatentHIVPositive[j][i];
+			currTime->numTBReactivationsExtraPulmLatentHIVPositive[j][i] += otherTime->numTBReactivationsExtraPulmLatentHIVPositive[j][i];
+		}
+	}
+
+	for (int i = 0; i < SimContext::TB_NUM_STRAINS; i++){
+		currTime->numObservedTBUninfectedTB[i] += otherTime->numObservedTBUninfectedTB[i];
+		for (int j = 0; j < SimContext::TB_NUM_STRAINS; j++)
+			currTime->numObservedTBByTrueTBStrain[i][j] += otherTime->numObservedTBByTrueTBStrain[i][j];
+	}
+
+	for (int i = 0; i < SimContext::TB_NUM_STATES; i++){
+		for (int j = 0; j < SimContext::TB_DIAG_STATUS_NUM; j++){
+			for (int k = 0; k < SimContext::TB_NUM_TESTS; k++)
+				currTime->numTBTestResults[k][i][j] += otherTime->numTBTestResults[k][i][j];
+			currTime->numTBDiagnosticResults[i][j] += otherTime->numTBDiagnosticResults[i][j];
+		}
+	}
+
+	for (int i = 0; i < SimContext::TB_NUM_STRAINS; i++){
+		currTime->numDSTTestResultsUninfectedTB[i] += otherTime->numDSTTestResultsUninfectedTB[i];
+		for (int j = 0; j < SimContext::TB_NUM_STRAINS; j++)
+			currTime->numDSTTestResultsByTrueTBStrain[i][j] += otherTime->numDSTTestResultsByTrueTBStrain[i][j];
+	}
+
+	for(int i =0; i <2; i++){
+		for(int j = 0; j < 2; j++){
+			for (int k = 0; k < 2; k++){
+				for (int l = 0; l < 2; l++){
+					currTime->numTBUnfavorableOutcome[i][j][k][l] += otherTime->numTBUnfavorableOutcome[i][j][k][l];
+					currTime->numDeathsTBUnfavorableOutcome[i][j][k][l] += otherTime->numDeathsTBUnfavorableOutcome[i][j][k][l];
+				}
+			}
+		}
+	}
+	for (int i = 0; i < SimContext::TB_NUM_TREATMENTS; i++){
+		currTime->numOnSuccessfulTBTreatment[i] += otherTime->numOnSuccessfulTBTreatment[i];
+		currTime->numOnSuccessfulTBTreatmentPulm[i] += otherTime->numOnSuccessfulTBTreatmentPulm[i];
+		currTime->numOnSuccessfulTBTreatmentExtraPulm[i] += otherTime->numOnSuccessfulTBTreatmentExtraPulm[i];
+
+		currTime->numOnFailedTBTreatment[i] += otherTime->numOnFailedTBTreatment[i];
+		currTime->numOnFailedTBTreatmentPulm[i] += otherTime->numOnFailedTBTreatmentPulm[i];
+		currTime->numOnFailedTBTreatmentExtraPulm[i] += otherTime->numOnFailedTBTreatmentExtraPulm[i];
+
+		currTime->numDefaultTBTreatment[i] += otherTime->numDefaultTBTreatment[i];
+		currTime->numDefaultTBTreatmentPulm[i] += otherTime->numDefaultTBTreatmentPulm[i];
+		currTime->numDefaultTBTreatmentExtraPulm[i] += otherTime->numDefaultTBTreatmentExtraPulm[i];
+	}
+
+	for (int i = 0; i < SimContext::TB_NUM_STRAINS; i++){
+		for (int j = 0; j < SimContext::TB_NUM_TREATMENTS; j++){
+			currTime->numDropoutTBTreatment[i][j] += otherTime->numDropoutTBTreatment[i][j];
+		}
+	}
+
+	currTime->numDeathsTB += otherTime->numDeathsTB;
+	currTime->numDeathsTBPulmHIVNegative += otherTime->numDeathsTBPulmHIVNegative;
+	currTime->numDeathsTBExtraPulmHIVNegative += otherTime->numDeathsTBExtraPulmHIVNegative;
+	currTime->numDeathsTBLTFUHIVNegative += otherTime->numDeathsTBLTFUHIVNegative;
+	for(int j=0;j<SimContext::CD4_NUM_STRATA;j++){
+		currTime->numDeathsTBPulmHIVPositive[j] += otherTime->numDeathsTBPulmHIVPositive[j];
+		currTime->numDeathsTBExtraPulmHIVPositive[j] += otherTime->numDeathsTBExtraPulmHIVPositive[j];
+		currTime->numDeathsTBLTFUHIVPositive[j] += otherTime->numDeathsTBLTFUHIVPositive[j];
+	}
+	currTime->numDeathsTBWhileFailedTBTreatment += otherTime->numDeathsTBWhileFailedTBTreatment;
+	currTime->numAllDeathsWhileFailedTBTreatment += otherTime->numAllDeathsWhileFailedTBTreatment;
+
+	for(int i = 0; i < SimContext::HIST_EXT_NUM; i++){
+		currTime->numWithOIHistExt[i] += otherTime->numWithOIHistExt[i];
+	}
+	for(int i = 0; i < SimContext::GENDER_NUM; i++){
+		currTime->numGender[i] += otherTime->numGender[i];
+	}
+
+	currTime->numDeaths += otherTime->numDeaths;
+
+	for (int j=0;j<SimContext::CHRM_AGE_CAT_NUM;j++){
+		currTime->numCHRMsAgeTotal[j] += otherTime->numCHRMsAgeTotal[j];
+	}
+	for (int j=0;j<SimContext::GENDER_NUM;j++){
+		currTime->numCHRMsGenderTotal[j] += otherTime->numCHRMsGenderTotal[j];
+	}
+	for(int j=0;j<SimContext::CD4_NUM_STRATA;j++){
+		currTime->numCHRMsCD4Total[j] += otherTime->numCHRMsCD4Total[j];
+	}
+
+	for (int i = 0; i < SimContext::HIV_ID_NUM; i++) {
+		currTime->numAliveWithCHRMsDetState[i] += otherTime->numAliveWithCHRMsDetState[i];
+		currTime->numAliveWithoutCHRMsDetState[i] += otherTime->numAliveWithoutCHRMsDetState[i];
+		for(int j=0;j<SimContext::CHRM_NUM;j++){
+			currTime->numAliveTypeCHRMs[i][j] += otherTime->numAliveTypeCHRMs[i][j];
+		}
+	}
+	for (int i = 0; i < SimContext::HIV_CARE_NUM; i++){
+		currTime->numAliveCare[i] += otherTime->numAliveCare[i];
+		currTime->numDeathsCare[i] += otherTime->numDeathsCare[i];
+
+		for(int j = 0; j < SimContext::HIST_EXT_NUM; j++){
+			currTime->numWithOIHistExtCare[j][i] += otherTime->numWithOIHistExtCare[j][i];
+		}
+		for(int j = 0; j < SimContext::GENDER_NUM; j++){
+			currTime->numGenderCare[j][i] += otherTime->numGenderCare[j][i];
+		}
+		currTime->trueCD4SumCare[i] += otherTime->trueCD4SumCare[i];
+		currTime->trueCD4SumSquaresCare[i] += otherTime->trueCD4SumSquaresCare[i];
+		currTime->observedCD4SumCare[i] += otherTime->observedCD4SumCare[i];
+		currTime->observedCD4SumSquaresCare[i] += otherTime->observedCD4SumSquaresCare[i];
+
+		currTime->propRespSumCare[i] += otherTime->propRespSumCare[i];
+		currTime->propRespSumSquaresCare[i] += otherTime->propRespSumSquaresCare[i];
+
+		currTime->ageSumCare[i] += otherTime->ageSumCare[i];
+		currTime->ageSumSquaresCare[i] += otherTime->ageSumSquaresCare[i];
+
+		for (int j = 0; j < SimContext::OUTPUT_AGE_CAT_NUM; j++){
+			currTime->numAgeBracketCare[i][j] += otherTime->numAgeBracketCare[i][j];
+			currTime->numDeathsAgeBracketCare[i][j] += otherTime->numDeathsAgeBracketCare[i][j];
+		}
+	}
+
+	for (int j = 0; j < SimContext::OUTPUT_AGE_CAT_NUM; j++){
+		currTime->numAgeBracketOnART[j] += otherTime->numAgeBracketOnART[j];
+		currTime->numAgeBracketInCareOffART[j] += otherTime->numAgeBracketInCareOffART[j];
+		currTime->numAgeBracketHIVPositive[j] += otherTime->numAgeBracketHIVPositive[j];
+		currTime->numAgeBracketAlive[j] += otherTime->numAgeBracketAlive[j];
+		currTime->numDeathsAgeBracketOnART[j] += otherTime->numDeathsAgeBracketOnART[j];
+		currTime->numDeathsAgeBracketInCareOffART[j] += otherTime->numDeathsAgeBracketInCareOffART[j];
+		currTime->numDeathsAgeBracketHIVPositive[j] += otherTime->numDeathsAgeBracketHIVPositive[j];
+		currTime->numDeathsAgeBracket[j] += otherTime->numDeathsAgeBracket[j];
+	}
+	currTime->totalAliveOnART += otherTime->totalAliveOnART;
+	currTime->totalDeathsOnART += otherTime->totalDeathsOnART;
+	for (int i = 0; i < SimContext::ART_NUM_LINES; i++){
+		for (int j = 0; j < SimContext::ART_EFF_NUM_TYPES; j++){
+			currTime->numAliveOnART[i][j] += otherTime->numAliveOnART[i][j];
+			for(int k = 0; k < SimContext::PEDS_CD4_AGE_CAT_NUM; k++)
+				currTime->numAliveOnARTCD4Metric[i][j][k] += otherTime->numAliveOnARTCD4Metric[i][j][k];
+			currTime->numDeathsOnART[i][j] += otherTime->numDeathsOnART[i][j];
+			for(int k = 0; k < SimContext::HIST_EXT_NUM; k++){
+				currTime->numWithOIHistExtOnART[k][i][j] += otherTime->numWithOIHistExtOnART[k][i][j];
+			}
+			for(int k = 0; k < SimContext::GENDER_NUM; k++){
+				currTime->numGenderOnART[k][i][j] += otherTime->numGenderOnART[k][i][j];
+			}
+			currTime->trueCD4SumOnART[i][j] += otherTime->trueCD4SumOnART[i][j];
+			currTime->trueCD4SumSquaresOnART[i][j] += otherTime->trueCD4SumSquaresOnART[i][j];
+			currTime->observedCD4SumOnART[i][j] += otherTime->observedCD4SumOnART[i][j];
+			currTime->observedCD4SumSquaresOnART[i][j] += otherTime->observedCD4SumSquaresOnART[i][j];
+
+			currTime->propRespSumOnART[i][j] += otherTime->propRespSumOnART[i][j];
+			currTime->propRespSumSquaresOnART[i][j] += otherTime->propRespSumSquaresOnART[i][j];
+
+			currTime->ageSumOnART[i][j] += otherTime->ageSumOnART[i][j];
+			currTime->ageSumSquaresOnART[i][j] += otherTime->ageSumSquaresOnART[i][j];
+		}
+	}
+	currTime->numAlivePositive += otherTime->numAlivePositive;
+	currTime->numAliveInCareOffART += otherTime->numAliveInCareOffART;
+	for(int j = 0; j < SimContext::PEDS_CD4_AGE_CAT_NUM; j++){
+		currTime->numAlivePositiveCD4Metric[j] += otherTime->numAlivePositiveCD4Metric[j];
+		currTime->numAliveInCareOffARTCD4Metric[j] += otherTime->numAliveInCareOffARTCD4Metric[j];
+		for(int i = 0; i < SimContext::HIV_CARE_NUM; i++){
+			currTime->numAliveCareCD4Metric[i][j] += otherTime->numAliveCareCD4Metric[i][j];
+		}
+	}
+	currTime->numDeathsInCareOffART += otherTime->numDeathsInCareOffART;
+	currTime->numDeathsPositive += otherTime->numDeathsPositive;
+
+	for(int i = 0; i < SimContext::HIST_EXT_NUM; i++){
+		currTime->numWithOIHistExtInCareOffART[i] += otherTime->numWithOIHistExtInCareOffART[i];
+		currTime->numWithOIHistExtPositive[i] += otherTime->numWithOIHistExtPositive[i];
+	}
+	for(int i = 0; i < SimContext::GENDER_NUM; i++){
+		currTime->numGenderInCareOffART[i] += otherTime->numGenderInCareOffART[i];
+		currTime->numGenderPositive[i] += otherTime->numGenderPositive[i];
+	}
+	currTime->trueCD4SumInCareOffART += otherTime->trueCD4SumInCareOffART;
+	currTime->trueCD4SumSquaresInCareOffART += otherTime->trueCD4SumSquaresInCareOffART;
+	currTime->observedCD4SumInCareOffART += otherTime->observedCD4SumInCareOffART;
+	currTime->observedCD4SumSquaresInCareOffART += otherTime->observedCD4SumSquaresInCareOffART;
+
+	currTime->propRespSumInCareOffART += otherTime->propRespSumInCareOffART;
+	currTime->propRespSumSquaresInCareOffART += otherTime->propRespSumSquaresInCareOffART;
+
+	currTime->ageSumInCareOffART += otherTime->ageSumInCareOffART;
+	currTime->ageSumSquaresInCareOffART += otherTime->ageSumSquaresInCareOffART;
+
+	currTime->propRespSumPositive += otherTime->propRespSumPositive;
+	currTime->propRespSumSquaresPositive += otherTime->propRespSumSquaresPositive;
+
+	currTime->ageSumPositive += otherTime->ageSumPositive;
+	currTime->ageSumSquaresPositive += otherTime->ageSumSquaresPositive;
+
+	for (int i = 0; i < SimContext::PEDS_HIV_NUM; i++) {
+		currTime->numAlivePediatrics[i] += otherTime->numAlivePediatrics[i];
+	}
+	for (int i = 0; i < SimContext::PEDS_MATERNAL_STATUS_NUM; i++)
+		currTime->numAlivePediatricsMotherAlive[i] += otherTime->numAlivePediatricsMotherAlive[i];
+	currTime->numAlivePediatricsMotherDead += otherTime->numAlivePediatricsMotherDead;
+	currTime->numNewlyDetectedPediatricsMotherStatusUnknown += otherTime->numNewlyDetectedPediatricsMotherStatusUnknown;
+	for(int i = 0; i < SimContext::PEDS_EXPOSED_BREASTFEEDING_NUM; i++)
+		currTime->numHIVExposedUninf[i] += otherTime->numHIVExposedUninf[i];
+	currTime->numNeverHIVExposed += otherTime->numNeverHIVExposed;
+
+	for (int i = 0; i < SimContext::EID_TEST_TYPE_NUM;i++){
+		currTime->numEIDTestsGivenType[i] += otherTime->numEIDTestsGivenType[i];
+		currTime->numTruePositiveEIDTestResultsType[i] += otherTime->numTruePositiveEIDTestResultsType[i];
+		currTime->numTrueNegativeEIDTestResultsType[i] += otherTime->numTrueNegativeEIDTestResultsType[i];
+		currTime->numFalsePositiveEIDTestResultsType[i] += otherTime->numFalsePositiveEIDTestResultsType[i];
+		currTime->numFalseNegativeEIDTestResultsType[i] += otherTime->numFalseNegativeEIDTestResultsType[i];
+	}
+	for (int i = 0; i < SimContext::EID_NUM_TESTS;i++){
+		currTime->numEIDTestsGivenTest[i] += otherTime->numEIDTestsGivenTest[i];
+		currTime->numTruePositiveEIDTestResultsTest[i] += otherTime->numTruePositiveEIDTestResultsTest[i];
+		currTime->numTrueNegativeEIDTestResultsTest[i] += otherTime->numTrueNegativeEIDTestResultsTest[i];
+		currTime->numFalsePositiveEIDTestResultsTest[i] += otherTime->numFalsePositiveEIDTestResultsTest[i];
+		currTime->numFalseNegativeEIDTestResultsTest[i] += otherTime->numFalseNegativeEIDTestResultsTest[i];
+	}
+
+	currTime->numAliveFalsePositive += otherTime->numAliveFalsePositive;
+	currTime->numAliveFalsePositiveLinked += otherTime->numAliveFalsePositiveLinked;
+	currTime->numIncidentPPInfections += otherTime->numIncidentPPInfections;
+
+	for(int i=0;i<SimContext::CHRM_NUM;i++){
+		currTime->numIncidentCHRMs[i] += otherTime->numIncidentCHRMs[i];
+	}
+	currTime->numIncidentHIVInfections += otherTime->numIncidentHIVInfections;
+	currTime->dynamicNumIncidentHIVInfections += otherTime->dynamicNumIncidentHIVInfections;
+	currTime->dynamicNumHIVNegAtStartMonth += otherTime->dynamicNumHIVNegAtStartMonth;
+	currTime->debugNumHIVNegAtStartMonth += otherTime->debugNumHIVNegAtStartMonth;
+	// Multipliers and logged probabilities are overwritten by every patient in the period, so the later shard's value wins
+	if (otherTime->dynamicSelfTransmissionMult != 0)
+		currTime->dynamicSelfTransmissionMult = otherTime->dynamicSelfTransmissionMult;
+	for(int i = 0; i< SimContext::HIV_BEHAV_NUM; i++){
+		currTime->numAliveNegRisk[i] += otherTime->numAliveNegRisk[i];
+		if (otherTime->probPrepUptake[i] != 0)
+			currTime->probPrepUptake[i] = otherTime->probPrepUptake[i];
+	}
+	for(int i = 0; i < SimContext::HIV_DET_NUM; i++){
+		currTime->numHIVDetections[i] += otherTime->numHIVDetections[i];
+	}
+	currTime->numHIVTestsPerformed += otherTime->numHIVTestsPerformed;
+	currTime->numHIVTestsPerformedAtInitOffer += otherTime->numHIVTestsPerformedAtInitOffer;
+	currTime->numHIVTestsPerformedPostStartup += otherTime->numHIVTestsPerformedPostStartup;
+
+	currTime->sumQOLModifiers += otherTime->sumQOLModifiers;
+	currTime->trueCD4Sum += otherTime->trueCD4Sum;
+	currTime->trueCD4SumSquares += otherTime->trueCD4SumSquares;
+	currTime->observedCD4Sum += otherTime->observedCD4Sum;
+	currTime->observedCD4SumSquares += otherTime->observedCD4SumSquares;
+
+	currTime->propRespSum += otherTime->propRespSum;
+	currTime->propRespSumSquares += otherTime->propRespSumSquares;
+
+	currTime->ageSum += otherTime->ageSum;
+	currTime->ageSumSquares += otherTime->ageSumSquares;
+
+	currTime->trueCD4PercentageSum += otherTime->trueCD4PercentageSum;
+	currTime->trueCD4PercentageSumSquares += otherTime->trueCD4PercentageSumSquares;
+	currTime->trueHVLSum += otherTime->trueHVLSum;
+	currTime->trueHVLSumSquares += otherTime->trueHVLSumSquares;
+	currTime->observedHVLSum += otherTime->observedHVLSum;
+	currTime->observedHVLSumSquares += otherTime->observedHVLSumSquares;
+	for (int i = 0; i < SimContext::CD4_NUM_STRATA; i++) {
+		currTime->observedCD4Distribution[i] += otherTime->observedCD4Distribution[i];
+		for (int j = 0; j < SimContext::HIV_CARE_NUM; j++){
+			currTime->observedCD4DistributionCare[i][j] += otherTime->observedCD4DistributionCare[i][j];
+		}
+	}
+
+	currTime->numWithObservedCD4InCareOffART += otherTime->numWithObservedCD4InCareOffART;
+	currTime->numHIVPosWithObservedCD4 += otherTime->numHIVPosWithObservedCD4;
+	for (int i = 0; i < SimContext::ART_NUM_LINES; i++){
+		for (int j = 0; j < SimContext::ART_EFF_NUM_TYPES; j++){
+			currTime->observedCD4DistributionOnART[i][j] += otherTime->observedCD4DistributionOnART[i][j];
+		}
+	}
+
+	for (int i = 0; i < SimContext::HVL_NUM_STRATA; i++) {
+		currTime->observedHVLDistribution[i] += otherTime->observedHVLDistribution[i];
+	}
+	for (int i = 0; i < SimContext::ART_NUM_STATES; i++) {
+		for (int j = 0; j < SimContext::CD4_NUM_STRATA; j++) {
+			for (int k = 0; k < SimContext::HVL_NUM_STRATA; k++) {
+				currTime->trueCD4HVLARTDistribution[i][j][k] += otherTime->trueCD4HVLARTDistribution[i][j][k];
+			}
+		}
+	}
+
+	currTime->numTransmissions += otherTime->numTransmissions;
+	for (int j = 0; j < SimContext::HVL_NUM_STRATA; j++) {
+		currTime->numTransmissionsHVL[j] += otherTime->numTransmissionsHVL[j];
+	}
+	for (int j = 0; j < SimContext::TRANSM_RISK_NUM; j++) {
+		currTime->numTransmissionsRisk[j] += otherTime->numTransmissionsRisk[j];
+	}
+
+	for (int i = 0; i < SimContext::ART_EFF_NUM_TYPES; i++) {
+		currTime->numARTEfficacyState[i] += otherTime->numARTEfficacyState[i];
+	}
+	currTime->numWithoutOIHistory += otherTime->numWithoutOIHistory;
+	currTime->numPrimaryOIsTotal += otherTime->numPrimaryOIsTotal;
+	currTime->numSecondaryOIsTotal += otherTime->numSecondaryOIsTotal;
+	currTime->numOIsTotal += otherTime->numOIsTotal;
+	for (int i = 0; i < SimContext::OI_NUM; i++) {
+		currTime->numPrimaryOIs[i] += otherTime->numPrimaryOIs[i];
+		currTime->numSecondaryOIs[i] += otherTime->numSecondaryOIs[i];
+		currTime->numWithOIHistory[i] += otherTime->numWithOIHistory[i];
+		currTime->numWithFirstOI[i] += otherTime->numWithFirstOI[i];
+		currTime->numDeathsFromFirstOI[i] += otherTime->numDeathsFromFirstOI[i];
+	}
+	for (int i=0; i<SimContext::CHRM_NUM;i++){
+		for (int j=0;j<SimContext::CHRM_AGE_CAT_NUM;j++){
+			currTime->numCHRMsAge[i][j] += otherTime->numCHRMsAge[i][j];
+		}
+		for (int j=0;j<SimContext::GENDER_NUM;j++){
+			currTime->numCHRMsGender[i][j] += otherTime->numCHRMsGender[i][j];
+		}
+		for(int j=0;j<SimContext::CD4_NUM_STRATA;j++){
+			currTime->numCHRMsCD4[i][j] += otherTime->numCHRMsCD4[i][j];
+		}
+	}
+	currTime->numDeathsWithoutCHRMs += otherTime->numDeathsWithoutCHRMs;
+	for (int i = 0; i < SimContext::CHRM_NUM; i++) {
+		currTime->numDeathsWithCHRMsCHRM[i] += otherTime->numDeathsWithCHRMsCHRM[i];
+	}
+	for (int i = 0; i < SimContext::DTH_NUM_CAUSES; i++) {
+		currTime->numDeathsType[i] += otherTime->numDeathsType[i];
+		currTime->numDeathsWithoutCHRMsType[i] += otherTime->numDeathsWithoutCHRMsType[i];
+		for(int j=0;j<SimContext::CHRM_NUM;j++){
+			currTime->numDeathsWithCHRMsTypeCHRM[i][j] += otherTime->numDeathsWithCHRMsTypeCHRM[i][j];
+		}
+		for (int j = 0; j < SimContext::HIV_CARE_NUM; j++)
+			currTime->numDeathsTypeCare[i][j] += otherTime->numDeathsTypeCare[i][j];
+	}
+	currTime->costsCD4Testing += otherTime->costsCD4Testing;
+	currTime->costsHVLTesting += otherTime->costsHVLTesting;
+	currTime->costsClinicVisits += otherTime->costsClinicVisits;
+	currTime->costsEIDVisits += otherTime->costsEIDVisits;
+	currTime->costsPrEP += otherTime->costsPrEP;
+	currTime->costsHIVTests += otherTime->costsHIVTests;
+	currTime->costsHIVMisc += otherTime->costsHIVMisc;
+	currTime->costsLabStagingTests += otherTime->costsLabStagingTests;
+	currTime->costsEIDTests += otherTime->costsEIDTests;
+	currTime->costsInfantHIVProphDirect += otherTime->costsInfantHIVProphDirect;
+    currTime->costsInfantHIVProphTox += otherTime->costsInfantHIVProphTox;
+	currTime->costsLabStagingMisc += otherTime->costsLabStagingMisc;
+	currTime->costsEIDMisc += otherTime->costsEIDMisc;
+	currTime->costsInterventionStartup += otherTime->costsInterventionStartup;
+	currTime->costsInterventionMonthly += otherTime->costsInterventionMonthly;
+
+	currTime->totalMonthlyCohortCosts += otherTime->totalMonthlyCohortCosts;
+	currTime->totalMonthlyTBCohortCosts += otherTime->totalMonthlyTBCohortCosts;
+
+	for (int i = 0; i < SimContext::COST_NUM_TYPES; i++) {
+		currTime->totalMonthlyCohortCostsType[i] += otherTime->totalMonthlyCohortCostsType[i];
+	}
+
+	for (int i = 0; i < SimContext::OI_NUM; i++) {
+		for (int j = 0; j < SimContext::PROPH_NUM; j++) {
+			currTime->costsProph[i][j] += otherTime->costsProph[i][j];
+		}
+	}
+
+    for (int i = 0; i < SimContext::HIV_BEHAV_NUM; i++) {
+        currTime->numOnPrEP[i] += otherTime->numOnPrEP[i];
+    }
+	for (int i = 0; i < SimContext::ART_NUM_LINES; i++) {
+		currTime->costsART[i] += otherTime->costsART[i];
+		currTime->numOnART[i] += otherTime->numOnART[i];
+		currTime->numStartingART[i] += otherTime->numStartingART[i];
+		currTime->numLostToFollowUpART[i] += otherTime->numLostToFollowUpART[i];
+		currTime->numStartingLostToFollowUpART[i] += otherTime->numStartingLostToFollowUpART[i];
+		currTime->numReturnOnPrevART[i] += otherTime->numReturnOnPrevART[i];
+		currTime->numReturnOnNextART[i] += otherTime->numReturnOnNextART[i];
+		currTime->numDeathsWhileLostART[i] += otherTime->numDeathsWhileLostART[i];
+        for (int j = 0; j < SimContext::ART_NUM_SUBREGIMENS; j++){
+            for (int k = 0; k < SimContext::ART_NUM_TOX_SEVERITY; k++){
+                for (int m = 0; m < SimContext::ART_NUM_TOX_PER_SEVERITY; m++){
+                    currTime->incidentToxicities[i][j][k][m] += otherTime->incidentToxicities[i][j][k][m];
+                }
+            }
+            for (int m = 0; m < SimContext::ART_NUM_TOX_PER_SEVERITY; m++){
+                currTime->prevalentChronicToxicities[i][j][m] += otherTime->prevalentChronicToxicities[i][j][m];
+            }
+        }
+	}
+	currTime->numInCarePostART += otherTime->numInCarePostART;
+	currTime->numInCarePreART += otherTime->numInCarePreART;
+	currTime->numStartingPreART += otherTime->numStartingPreART;
+	currTime->numStartingPostART += otherTime->numStartingPostART;
+	for (int i=0;i<SimContext::CHRM_NUM;i++){
+		currTime->costsCHRMs[i] += otherTime->costsCHRMs[i];
+	}
+	currTime->numLostToFollowUpPreART += otherTime->numLostToFollowUpPreART;
+	currTime->numLostToFollowUpPostART += otherTime->numLostToFollowUpPostART;
+	currTime->numStartingLostToFollowUpPreART += otherTime->numStartingLostToFollowUpPreART;
+	currTime->numStartingLostToFollowUpPostART += otherTime->numStartingLostToFollowUpPostART;
+	currTime->numReturnToCarePreART += otherTime->numReturnToCarePreART;
+	currTime->numReturnToCarePostART += otherTime->numReturnToCarePostART;
+	currTime->numDeathsWhileLostPreART += otherTime->numDeathsWhileLostPreART;
+	currTime->numDeathsWhileLostPostART += otherTime->numDeathsWhileLostPostART;
+	currTime->numDeathsHIVPosNeverVisitedClinic += otherTime->numDeathsHIVPosNeverVisitedClinic;
+	currTime->numDeathsHIVPosHadClinicVisit += otherTime->numDeathsHIVPosHadClinicVisit;
+	currTime->numDeathsUninfected += otherTime->numDeathsUninfected;
+} /* end mergeTimeSummary */
+
+/** \brief mergeOrphanStats adds the totals of another OrphanStats for the same time period to the given OrphanStats */
+void RunStats::mergeOrphanStats(OrphanStats *currTime, const OrphanStats *otherTime) {
+	currTime->numOrphans += otherTime->numOrphans;
+	for (int i = 0; i < SimContext::CHRM_ORPHANS_OUTPUT_AGE_CAT_NUM; i++){
+		currTime->numOrphansAge[i] += otherTime->numOrphansAge[i];
+	}
+} /* end mergeOrphanStats */
+
+/** \brief getPartialStatsFileName returns the name of the partial statistics file of a shard, e.g. run.shard2of8.part
+ *
+ * \param shardNum the number of the shard, from 1 to numShards
+ * \param numShards the number of shards the cohort is split into
+ **/
+string RunStats::getPartialStatsFileName(int shardNum, int numShards) {
+	char buffer[64];
+	sprintf(buffer, ".shard%dof%d", shardNum, numShards);
+	string partialFileName = simContext->getRunSpecsInputs()->runName;
+	partialFileName.append(buffer);
+	partialFileName.append(CepacUtil::FILE_EXTENSION_FOR_PARTIAL_OUTPUT);
+	return partialFileName;
+} /* end getPartialStatsFileName */
+
+/** \brief getPartialStatsLayoutSize returns the combined size of the statistics subclasses written as raw bytes, used to reject partial statistics files of other builds */
+int RunStats::getPartialStatsLayoutSize() {
+	return (int) (sizeof(PatientSummary) + sizeof(HIVScreening) + sizeof(InitialDistributions) + sizeof(CHRMsStats) +
+		sizeof(OIStats) + sizeof(DeathStats) + sizeof(OverallSurvival) + sizeof(OverallCosts) + sizeof(TBStats) +
+		sizeof(LTFUStats) + sizeof(ProphStats) + sizeof(ARTStats) + sizeof(TimeSummary) + sizeof(OrphanStats));
+} /* end getPartialStatsLayoutSize */
+
+/** \brief writePartialStats writes every total that merge adds together to a partial statistics file
+ *
+ * The survival stats are not written since finalizeStats calculates them from the patient summaries
+ *
+ * \param file a pointer to the partial statistics FILE, opened for binary writing
+ **/
+void RunStats::writePartialStats(FILE *file) {
+	CepacUtil::writeBinary(file, getPartialStatsLayoutSize());
+	CepacUtil::writeBinary(file, patientNumOffset);
+	writePartialPopulationSummary(file);
+	CepacUtil::writeBinary(file, hivScreening);
+	CepacUtil::writeBinary(file, initialDistributions);
+	CepacUtil::writeBinary(file, chrmsStats);
+	CepacUtil::writeBinary(file, oiStats);
+	CepacUtil::writeBinary(file, deathStats);
+	CepacUtil::writeBinary(file, overallSurvival);
+	CepacUtil::writeBinary(file, overallCosts);
+	CepacUtil::writeBinary(file, tbStats);
+	CepacUtil::writeBinary(file, ltfuStats);
+	CepacUtil::writeBinary(file, prophStats);
+	CepacUtil::writeBinary(file, artStats);
+
+	int numPatients = (int) patients.size();
+	CepacUtil::writeBinary(file, numPatients);
+	for (int i = 0; i < numPatients; i++)
+		CepacUtil::writeBinary(file, patients[i]);
+	int numTimeSummaries = (int) timeSummaries.size();
+	CepacUtil::writeBinary(file, numTimeSummaries);
+	for (int i = 0; i < numTimeSummaries; i++)
+		CepacUtil::writeBinary(file, *timeSummaries[i]);
+	int numOrphanStats = (int) orphanStats.size();
+	CepacUtil::writeBinary(file, numOrphanStats);
+	for (int i = 0; i < numOrphanStats; i++)
+		CepacUtil::writeBinary(file, *orphanStats[i]);
+} /* end writePartialStats */
+
+/** \brief readPartialStats reads the totals written by writePartialStats into a newly constructed RunStats object
+ *
+ * \param file a pointer to the partial statistics FILE, opened for binary reading
+ **/
+void RunStats::readPartialStats(FILE *file) {
+	int layoutSize;
+	CepacUtil::readBinary(file, &layoutSize);
+	if (layoutSize != getPartialStatsLayoutSize()) {
+		string errorString = "   ERROR - Partial statistics file was written by a version of CEPAC with different run statistics";
+		throw errorString;
+	}
+	CepacUtil::readBinary(file, &patientNumOffset);
+	readPartialPopulationSummary(file);
+	CepacUtil::readBinary(file, &hivScreening);
+	CepacUtil::readBinary(file, &initialDistributions);
+	CepacUtil::readBinary(file, &chrmsStats);
+	CepacUtil::readBinary(file, &oiStats);
+	CepacUtil::readBinary(file, &deathStats);
+	CepacUtil::readBinary(file, &overallSurvival);
+	CepacUtil::readBinary(file, &overallCosts);
+	CepacUtil::readBinary(file, &tbStats);
+	CepacUtil::readBinary(file, &ltfuStats);
+	CepacUtil::readBinary(file, &prophStats);
+	CepacUtil::readBinary(file, &artStats);
+
+	int numPatients, numTimeSummaries, numOrphanStats;
+	CepacUtil::readBinary(file, &numPatients);
+	patients.resize(max(numPatients, 0));
+	for (int i = 0; i < numPatients; i++)
+		CepacUtil::readBinary(file, &patients[i]);
+	CepacUtil::readBinary(file, &numTimeSummaries);
+	for (int i = 0; i < numTimeSummaries; i++) {
+		timeSummaries.push_back(new TimeSummary());
+		CepacUtil::readBinary(file, timeSummaries.back());
+	}
+	CepacUtil::readBinary(file, &numOrphanStats);
+	for (int i = 0; i < numOrphanStats; i++) {
+		orphanStats.push_back(new OrphanStats());
+		CepacUtil::readBinary(file, orphanStats.back());
+	}
+} /* end readPartialStats */
+
+/** \brief writePartialPopulationSummary writes the PopulationSummary totals added by mergePopulationSummary, the run names are set by finalizeStats */
+void RunStats::writePartialPopulationSummary(FILE *file) {
+	CepacUtil::writeBinary(file, popSummary.numCohorts);
+	CepacUtil::writeBinary(file, popSummary.numCohortsHIVPositive);
+	CepacUtil::writeBinary(file, popSummary.costsSum);
+	CepacUtil::writeBinary(file, popSummary.costsSumSquares);
+	CepacUtil::writeBinary(file, popSummary.LMsSum);
+	CepacUtil::writeBinary(file, popSummary.LMsSumSquares);
+	CepacUtil::writeBinary(file, popSummary.QALMsSum);
+	CepacUtil::writeBinary(file, popSummary.QALMsSumSquares);
+	CepacUtil::writeBinary(file, popSummary.costsSumCohortParsing);
+	CepacUtil::writeBinary(file, popSummary.costsSumSquaresCohortParsing);
+	CepacUtil::writeBinary(file, popSummary.LMsSumCohortParsing);
+	CepacUtil::writeBinary(file, popSummary.LMsSumSquaresCohortParsing);
+	CepacUtil::writeBinary(file, popSummary.QALMsSumCohortParsing);
+	CepacUtil::writeBinary(file, popSummary.QALMsSumSquaresCohortParsing);
+	CepacUtil::writeBinary(file, popSummary.multDiscCostsSum);
+	CepacUtil::writeBinary(file, popSummary.multDiscCostsSumSquares);
+	CepacUtil::writeBinary(file, popSummary.multDiscLMsSum);
+	CepacUtil::writeBinary(file, popSummary.multDiscLMsSumSquares);
+	CepacUtil::writeBinary(file, popSummary.multDiscQALMsSum);
+	CepacUtil::writeBinary(file, popSummary.multDiscQALMsSumSquares);
+	CepacUtil::writeBinary(file, popSummary.numFailART);
+	CepacUtil::writeBinary(file, popSummary.costsFailARTSum);
+	CepacUtil::writeBinary(file, popSummary.LMsFailARTSum);
+	CepacUtil::writeBinary(file, popSummary.QALMsFailARTSum);
+	CepacUtil::writeBinary(file, popSummary.totalClinicVisits);
+	CepacUtil::writeBinary(file, popSummary.costsHIVPositiveSum);
+	CepacUtil::writeBinary(file, popSummary.LMsHIVPositiveSum);
+	CepacUtil::writeBinary(file, popSummary.QALMsHIVPositiveSum);
+} /* end writePartialPopulationSummary */
+
+/** \brief readPartialPopulationSummary reads the PopulationSummary totals written by writePartialPopulationSummary */
+void RunStats::readPartialPopulationSummary(FILE *file) {
+	CepacUtil::readBinary(file, &popSummary.numCohorts);
+	CepacUtil::readBinary(file, &popSummary.numCohortsHIVPositive);
+	CepacUtil::readBinary(file, &popSummary.costsSum);
+	CepacUtil::readBinary(file, &popSummary.costsSumSquares);
+	CepacUtil::readBinary(file, &popSummary.LMsSum);
+	CepacUtil::readBinary(file, &popSummary.LMsSumSquares);
+	CepacUtil::readBinary(file, &popSummary.QALMsSum);
+	CepacUtil::readBinary(file, &popSummary.QALMsSumSquares);
+	CepacUtil::readBinary(file, &popSummary.costsSumCohortParsing);
+	CepacUtil::readBinary(file, &popSummary.costsSumSquaresCohortParsing);
+	CepacUtil::readBinary(file, &popSummary.LMsSumCohortParsing);
+	CepacUtil::readBinary(file, &popSummary.LMsSumSquaresCohortParsing);
+	CepacUtil::readBinary(file, &popSummary.QALMsSumCohortParsing);
+	CepacUtil::readBinary(file, &popSummary.QALMsSumSquaresCohortParsing);
+	CepacUtil::readBinary(file, &popSummary.multDiscCostsSum);
+	CepacUtil::readBinary(file, &popSummary.multDiscCostsSumSquares);
+	CepacUtil::readBinary(file, &popSummary.multDiscLMsSum);
+	CepacUtil::readBinary(file, &popSummary.multDiscLMsSumSquares);
+	CepacUtil::readBinary(file, &popSummary.multDiscQALMsSum);
+	CepacUtil::readBinary(file, &popSummary.multDiscQALMsSumSquares);
+	CepacUtil::readBinary(file, &popSummary.numFailART);
+	CepacUtil::readBinary(file, &popSummary.costsFailARTSum);
+	CepacUtil::readBinary(file, &popSummary.LMsFailARTSum);
+	CepacUtil::readBinary(file, &popSummary.QALMsFailARTSum);
+	CepacUtil::readBinary(file, &popSummary.totalClinicVisits);
+	CepacUtil::readBinary(file, &popSummary.costsHIVPositiveSum);
+	CepacUtil::readBinary(file, &popSummary.LMsHIVPositiveSum);
+	CepacUtil::readBinary(file, &popSummary.QALMsHIVPositiveSum);
+} /* end readPartialPopulationSummary */
+
 /** \brief finalizePopulationSummary calculates aggregate statistics for the PopulationSummary object */
 void RunStats::finalizePopulationSummary() {
 	char tmpbuf[256];
@@ -2112,7 +3732,8 @@ void RunStats::finalizeOverallSurvival() {
 /** \brief finalizeOverallCosts calculates aggregate statistics for the OverallCosts object */
 void RunStats::finalizeOverallCosts() {
 	for (int i = 0; i < SimContext::CD4_NUM_STRATA; i++) {
-		overallCosts.costsTotalCD4[i] = overallCosts.costsOIHistoryCD4[i] + overallCosts.costsNoOIHistoryCD4[i];
+		overallCosts.costsTotalCD4[i] = overallCosts.costsOIHistoryCD4[i];
+		overallCosts.costsTotalCD4[i] += overallCosts.costsNoOIHistoryCD4[i];
 		overallCosts.costsTotal += overallCosts.costsTotalCD4[i];
 		overallCosts.costsOIHistory += overallCosts.costsOIHistoryCD4[i];
 		overallCosts.costsNoOIHistory += overallCosts.costsNoOIHistoryCD4[i];
@@ -2609,7 +4230,7 @@ void RunStats::writeHIVScreening() {
 	fprintf(statsFile, "\t%lu\t%lu", hivScreening.numHIVExposed[SimContext::MOM_ACUTE_BREASTFEEDING], hivScreening.numNeverHIVExposed);
 
 	fprintf(statsFile, "\n\t\tFalse Positive\tFalse Positive Linked");
-	fprintf(statsFile, "\n\tLife Months\t%1.0lf\t%1.0lf", hivScreening.LMsFalsePositive, hivScreening.LMsFalsePositiveLinked);
+	fprintf(statsFile, "\n\tLife Months\t%1.0lf\t%1.0lf", (double) hivScreening.LMsFalsePositive, (double) hivScreening.LMsFalsePositiveLinked);
 	
 	fprintf(statsFile, "\n\t");
 	for (i = 0; i < SimContext::HIV_EXT_INF_NUM; ++i)
@@ -2639,7 +4260,7 @@ void RunStats::writeHIVScreening() {
 		fprintf(statsFile, "\t%1.2lf", hivScreening.CD4AtDetectionPrevalentAverageHIV[i]);
 	}
 	fprintf(statsFile, "\t%1.2lf", hivScreening.CD4AtDetectionPrevalentAverage);
-	if(simContext->getPedsInputs()->enablePediatricsModel){
+	if(simContext->isPedsModelEnabled()){
 		fprintf(statsFile, "\n\tNum w.Absolute CD4 Metric at Detection (Preval):");
 		for (i = 0; i  < SimContext::HIV_POS_NUM; i++)
 			fprintf(statsFile, "\t%lu", hivScreening.numAtDetectionPrevalentHIVCD4Metric[i][SimContext::CD4_ABSOLUTE]);
@@ -2685,7 +4306,7 @@ void RunStats::writeHIVScreening() {
 		fprintf(statsFile, "\t%1.2lf", hivScreening.CD4AtDetectionIncidentAverageHIV[i]);
 	}
 	fprintf(statsFile, "\t%1.2lf", hivScreening.CD4AtDetectionIncidentAverage);
-	if(simContext->getPedsInputs()->enablePediatricsModel){
+	if(simContext->isPedsModelEnabled()){
 		fprintf(statsFile, "\n\tNum w.Absolute CD4 Metric at Detection (Incid):");
 		for (i = 0; i  < SimContext::HIV_POS_NUM; i++)
 			fprintf(statsFile, "\t%lu", hivScreening.numAtDetectionIncidentHIVCD4Metric[i][SimContext::CD4_ABSOLUTE]);
@@ -2733,7 +4354,7 @@ void RunStats::writeHIVScreening() {
 		fprintf(statsFile, "\t%1.2lf", hivScreening.CD4AtLinkageAverageHIV[i]);
 	}
 	fprintf(statsFile, "\t%1.2lf", hivScreening.CD4AtLinkageAverage);
-	if(simContext->getPedsInputs()->enablePediatricsModel){
+	if(simContext->isPedsModelEnabled()){
 		fprintf(statsFile, "\n\tNum w.Absolute CD4 Metric at Linkage:");
 		for (i = 0; i  < SimContext::HIV_POS_NUM; i++)
 			fprintf(statsFile, "\t%lu", hivScreening.numAtLinkageHIVCD4Metric[i][SimContext::CD4_ABSOLUTE]);
@@ -2784,7 +4405,7 @@ void RunStats::writeHIVScreening() {
 
 	fprintf(statsFile, "\n\t");
 	for (i = 0; i < SimContext::OI_NUM; ++i)
-		fprintf(statsFile, "\t%s", SimContext::OI_STRS[i]);
+		fprintf(statsFile, "\t%s", simContext->OI_STRS[i]);
 	fprintf(statsFile, "\n\tPresenting OI:");
 	for (i = 0; i < SimContext::OI_NUM; ++i)
 		fprintf(statsFile, "\t%lu", hivScreening.numDetectedByOIs[i]);
@@ -3018,7 +4639,7 @@ void RunStats::writeInitialDistributions() {
 		initialDistributions.averageInitialAgeMonths,
 		initialDistributions.numMalePatients, initialDistributions.numFemalePatients);
 	for (i = 0; i < SimContext::OI_NUM; ++i)
-		fprintf(statsFile," \t%s", SimContext::OI_STRS[i]);
+		fprintf(statsFile," \t%s", simContext->OI_STRS[i]);
 	fprintf(statsFile,"\n\tPrior OI Histories Distrib:");
 	for (i = 0; i < SimContext::OI_NUM; ++i)
 		fprintf(statsFile," \t%ld", initialDistributions.numPriorOIHistories[i]);
@@ -3031,7 +4652,7 @@ void RunStats::writeInitialDistributions() {
 
 	fprintf(statsFile, "\n\t");
 	for (i = 0; i < SimContext::RISK_FACT_NUM; i++) {
-		fprintf(statsFile, "\t%s", SimContext::RISK_FACT_STRS[i]);
+		fprintf(statsFile, "\t%s", simContext->RISK_FACT_STRS[i]);
 	}
 	fprintf(statsFile, "\n\tRisk Factors");
 	for (i = 0; i < SimContext::RISK_FACT_NUM; i++) {
@@ -3056,7 +4677,7 @@ void RunStats::writeCHRMsStats() {
 	fprintf(statsFile, "\nCHRMs SUMMARIES");
 	fprintf(statsFile, "\n\tTotal Patients with CHRM\n\t");
 	for (int i = 0; i < SimContext::CHRM_NUM; i++) {
-		fprintf(statsFile, "\t%s", SimContext::CHRM_STRS[i]);
+		fprintf(statsFile, "\t%s", simContext->CHRM_STRS[i]);
 	}
 	fprintf(statsFile, "\n\tHIV+");
 	for (int i = 0; i < SimContext::CHRM_NUM; i++) {
@@ -3072,7 +4693,7 @@ void RunStats::writeCHRMsStats() {
 	}
 	fprintf(statsFile, "\n\tAvg Mths with CHRM\n\t");
 	for (int i = 0; i < SimContext::CHRM_NUM; i++) {
-		fprintf(statsFile, "\t%s", SimContext::CHRM_STRS[i]);
+		fprintf(statsFile, "\t%s", simContext->CHRM_STRS[i]);
 	}
 	fprintf(statsFile, "\n\tHIV+");
 	for (int i = 0; i < SimContext::CHRM_NUM; i++) {
@@ -3085,7 +4706,7 @@ void RunStats::writeCHRMsStats() {
 	fprintf(statsFile, "\n\tHIV+ Patients");
 	fprintf(statsFile, "\n\tPrevalent");
 	for (int i = 0; i < SimContext::CHRM_NUM; i++) {
-		fprintf(statsFile, "\t%s", SimContext::CHRM_STRS[i]);
+		fprintf(statsFile, "\t%s", simContext->CHRM_STRS[i]);
 	}
 	fprintf(statsFile, "\tTotal");
 	for (int j = SimContext::CD4_NUM_STRATA - 1; j >= 0; j--) {
@@ -3102,7 +4723,7 @@ void RunStats::writeCHRMsStats() {
 
 	fprintf(statsFile, "\n\tIncident");
 	for (int i = 0; i < SimContext::CHRM_NUM; i++) {
-		fprintf(statsFile, "\t%s", SimContext::CHRM_STRS[i]);
+		fprintf(statsFile, "\t%s", simContext->CHRM_STRS[i]);
 	}
 	fprintf(statsFile, "\tTotal");
 	for (int j = SimContext::CD4_NUM_STRATA - 1; j >= 0; j--) {
@@ -3119,7 +4740,7 @@ void RunStats::writeCHRMsStats() {
 
 	fprintf(statsFile, "\n\tDeaths");
 	for (int i = 0; i < SimContext::CHRM_NUM; i++) {
-		fprintf(statsFile, "\t%s", SimContext::CHRM_STRS[i]);
+		fprintf(statsFile, "\t%s", simContext->CHRM_STRS[i]);
 	}
 	fprintf(statsFile, "\tTotal");
 	for (int j = SimContext::CD4_NUM_STRATA - 1; j >= 0; j--) {
@@ -3136,7 +4757,7 @@ void RunStats::writeCHRMsStats() {
 	fprintf(statsFile, "\n\tHIV- Patients");
 	fprintf(statsFile, "\n\t");
 	for (int i = 0; i < SimContext::CHRM_NUM; i++) {
-		fprintf(statsFile, "\t%s", SimContext::CHRM_STRS[i]);
+		fprintf(statsFile, "\t%s", simContext->CHRM_STRS[i]);
 	}
 	fprintf(statsFile, "\tTotal");
 	fprintf(statsFile, "\n\tPrevalent");
@@ -3159,7 +4780,7 @@ void RunStats::writeOIStats() {
 
 	// Write out total OI summaries
 	for (i = 0; i < SimContext::OI_NUM; ++i)
-		fprintf(statsFile," \t%s", SimContext::OI_STRS[i] );
+		fprintf(statsFile," \t%s", simContext->OI_STRS[i] );
 	fprintf(statsFile,"\n\t# Primary OIs");
 	for (i = 0; i < SimContext::OI_NUM; ++i)
 		fprintf(statsFile," \t%1lu", oiStats.numPrimaryOIsOI[i]);
@@ -3170,7 +4791,7 @@ void RunStats::writeOIStats() {
 	// Write out number of primary, secondary, and detected OIs
 	fprintf(statsFile,"\n\tPrimary OIs");
 	for (i = 0; i < SimContext::OI_NUM; ++i)
-		fprintf(statsFile," \t%s", SimContext::OI_STRS[i]);
+		fprintf(statsFile," \t%s", simContext->OI_STRS[i]);
 	fprintf(statsFile," \tTotal");
 	for (j = SimContext::CD4_NUM_STRATA - 1; j >= 0; --j) {
 		fprintf(statsFile,"\n\t%s", SimContext::CD4_STRATA_STRS[j]);
@@ -3180,7 +4801,7 @@ void RunStats::writeOIStats() {
 	}
 	fprintf(statsFile,"\n\tSecondary OIs");
 	for (i = 0; i < SimContext::OI_NUM; ++i)
-		fprintf(statsFile," \t%s", SimContext::OI_STRS[i]);
+		fprintf(statsFile," \t%s", simContext->OI_STRS[i]);
 	fprintf(statsFile," \tTotal");
 	for (j = SimContext::CD4_NUM_STRATA - 1; j >= 0; --j) {
 		fprintf(statsFile,"\n\t%s", SimContext::CD4_STRATA_STRS[j]);
@@ -3190,7 +4811,7 @@ void RunStats::writeOIStats() {
 	}
 	fprintf(statsFile,"\n\tDetected OIs");
 	for (i = 0; i < SimContext::OI_NUM; ++i)
-		fprintf(statsFile," \t%s", SimContext::OI_STRS[i]);
+		fprintf(statsFile," \t%s", simContext->OI_STRS[i]);
 	fprintf(statsFile," \tTotal");
 	for (j = SimContext::CD4_NUM_STRATA - 1; j >= 0; --j) {
 		fprintf(statsFile,"\n\t%s", SimContext::CD4_STRATA_STRS[j]);
@@ -3207,7 +4828,7 @@ void RunStats::writeOIStats() {
 	// Print out prior OI history logging information
 	fprintf(statsFile,"\nPRIOR OI HIST PROB AS PROPORTION OF PATIENTS (LOGGED)");
 	for (i = 0; i < SimContext::OI_NUM; ++i) {
-		fprintf(statsFile,"\n\tOI: %s", SimContext::OI_STRS[i]);
+		fprintf(statsFile,"\n\tOI: %s", simContext->OI_STRS[i]);
 		for (j = SimContext::CD4_NUM_STRATA - 1; j >= 0; --j)
 			fprintf(statsFile,"\t%s", SimContext::CD4_STRATA_STRS[j]);
 		fprintf(statsFile,"\tTotal");
@@ -3235,7 +4856,7 @@ void RunStats::writeOIStats() {
 	}  // for i
 	fprintf(statsFile,"\nPRIOR OI HIST PROB BY PATIENT MTHS (LOGGED)");
 	for (i = 0; i < SimContext::OI_NUM; ++i) {
-		fprintf(statsFile,"\n\tOI: %s", SimContext::OI_STRS[i]);
+		fprintf(statsFile,"\n\tOI: %s", simContext->OI_STRS[i]);
 		for (j = SimContext::CD4_NUM_STRATA - 1; j >= 0; --j)
 			fprintf(statsFile,"\t%s", SimContext::CD4_STRATA_STRS[j]);
 		fprintf(statsFile,"\tTotal");
@@ -3271,7 +4892,7 @@ void RunStats::writeDeathStats() {
 	// Print out OI and other causes of death statistics
 	fprintf(statsFile,"\n\tCD4 Count Level");
 	for (i = 0; i < SimContext::DTH_NUM_CAUSES; ++i)
-		fprintf(statsFile," \t%s", SimContext::DTH_CAUSES_STRS[i] );
+		fprintf(statsFile," \t%s", simContext->DTH_CAUSES_STRS[i] );
 	fprintf(statsFile," \tTotal");
 	for (j = SimContext::CD4_NUM_STRATA - 1; j >= 0; --j) {
 		fprintf(statsFile,"\n\t%s", SimContext::CD4_STRATA_STRS[j]);
@@ -3286,7 +4907,7 @@ void RunStats::writeDeathStats() {
 
 	fprintf(statsFile,"\n\n\tStatus");
 	for (i = 0; i < SimContext::DTH_NUM_CAUSES; ++i)
-		fprintf(statsFile," \t%s", SimContext::DTH_CAUSES_STRS[i] );
+		fprintf(statsFile," \t%s", simContext->DTH_CAUSES_STRS[i] );
 	fprintf(statsFile," \tTotal");
 	for (j = 0; j < SimContext::HIV_CARE_NUM; j++) {
 		fprintf(statsFile,"\n\t%s", SimContext::HIV_CARE_STRS[j]);
@@ -3307,7 +4928,7 @@ void RunStats::writeDeathStats() {
     // Deaths by age and cause
     fprintf(statsFile,"\n\n\tAge Bracket");
     for ( j = 0; j < SimContext::DTH_NUM_CAUSES; ++j )
-        fprintf(statsFile," \t%s", SimContext::DTH_CAUSES_STRS[j]);
+        fprintf(statsFile," \t%s", simContext->DTH_CAUSES_STRS[j]);
     for (k = 0; k < SimContext::OUTPUT_AGE_CAT_NUM; k++){
         fprintf(statsFile,"\n\t%s", SimContext::OUTPUT_AGE_CAT_STRS[k]);
         for ( j = 0; j < SimContext::DTH_NUM_CAUSES; ++j)
@@ -3369,7 +4990,7 @@ void RunStats::writeDeathStats() {
 	if(deathStats.numARTToxDeathsCD4Metric[SimContext::CD4_ABSOLUTE] > 0){
 		fprintf(statsFile,"\n\t\tMean\t%1.0lf",deathStats.ARTToxDeathsCD4Mean);
 		fprintf(statsFile,"\n\t\tStd Dev\t%1.0lf",deathStats.ARTToxDeathsCD4StdDev);
-		if(simContext->getPedsInputs()->enablePediatricsModel){
+		if(simContext->isPedsModelEnabled()){
 			fprintf(statsFile, "\n\t\tNum w.Absolute CD4 Metric at ART Tox Death\t%lu", deathStats.numARTToxDeathsCD4Metric[SimContext::CD4_ABSOLUTE]);	
 		}
 		else{
@@ -3395,7 +5016,7 @@ void RunStats::writeDeathStats() {
 
 	fprintf(statsFile,"\n\n\t\tProbability of OI History at ART Tox Death");
 	for (k=0;k<SimContext::OI_NUM;k++){
-		fprintf(statsFile,"\n\t\t%s",SimContext::OI_STRS[k]);
+		fprintf(statsFile,"\n\t\t%s",simContext->OI_STRS[k]);
 		for(int i=0;i<SimContext::CD4_NUM_STRATA;i++){
 			fprintf(statsFile,"\t%s",SimContext::CD4_STRATA_STRS[i]);
 		}
@@ -3420,12 +5041,12 @@ void RunStats::writeOverallSurvival() {
     fprintf(statsFile,"\tTotal");
     fprintf(statsFile,"\n\tLife Months [woOIHist]");
 	for (i = SimContext::CD4_NUM_STRATA - 1; i >= 0; --i) {
-		fprintf(statsFile,"\t%1.0lf", overallSurvival.LMsNoOIHistoryCD4[i]);
+		fprintf(statsFile,"\t%1.0lf", (double) overallSurvival.LMsNoOIHistoryCD4[i]);
 	}
 	fprintf(statsFile,"\t%1.0lf", overallSurvival.LMsNoOIHistory);
     fprintf(statsFile,"\n\tLife Months [w.OIHist]");
 	for (i = SimContext::CD4_NUM_STRATA - 1; i >= 0; --i) {
-		fprintf(statsFile,"\t%1.0lf", overallSurvival.LMsOIHistoryCD4[i]);
+		fprintf(statsFile,"\t%1.0lf", (double) overallSurvival.LMsOIHistoryCD4[i]);
 	}
 	fprintf(statsFile,"\t%1.0lf", overallSurvival.LMsOIHistory);
     fprintf(statsFile,"\n\tLife Months [Total]");
@@ -3440,29 +5061,29 @@ void RunStats::writeOverallSurvival() {
 		fprintf(statsFile,"\t%s", SimContext::HVL_STRATA_STRS[i]);
     fprintf(statsFile,"\n\tLife Mths, HVL Setpt ");
 	for (i = SimContext::HVL_NUM_STRATA - 1; i >= 0; --i)
-	    fprintf(statsFile," \t%1.0lf", overallSurvival.LMsHVLSetpoint[i]);
+	    fprintf(statsFile," \t%1.0lf", (double) overallSurvival.LMsHVLSetpoint[i]);
     fprintf(statsFile,"\n\tLife Mths, Curr HVL ");
 	for (i = SimContext::HVL_NUM_STRATA - 1; i >= 0; --i)
-	    fprintf(statsFile," \t%1.0lf", overallSurvival.LMsHVL[i]);
+	    fprintf(statsFile," \t%1.0lf", (double) overallSurvival.LMsHVL[i]);
 
 	// output total LMs by history or no history of each indiv OI
     fprintf(statsFile,"\n\tOI: ");
 	for (i = 0; i < SimContext::OI_NUM; ++i)
-		fprintf(statsFile,"\t%s", SimContext::OI_STRS[i]);
+		fprintf(statsFile,"\t%s", simContext->OI_STRS[i]);
     fprintf(statsFile,"\n\tLife Mths, no OI hist");
 	for (i = 0; i < SimContext::OI_NUM; ++i)
-	    fprintf(statsFile," \t%1.0lf", overallSurvival.LMsNoOIHistoryOIs[i]);
+	    fprintf(statsFile," \t%1.0lf", (double) overallSurvival.LMsNoOIHistoryOIs[i]);
     fprintf(statsFile,"\n\tLife Mths, with OI hist");
 	for (i = 0; i < SimContext::OI_NUM; ++i)
-	    fprintf(statsFile," \t%1.0lf", overallSurvival.LMsOIHistoryOIs[i]);
+	    fprintf(statsFile," \t%1.0lf", (double) overallSurvival.LMsOIHistoryOIs[i]);
 
 	// output total LMs by history of individual chrms
     fprintf(statsFile,"\n\tCHRMs: ");
 	for (i = 0; i < SimContext::CHRM_NUM; ++i)
-		fprintf(statsFile,"\t%s", SimContext::CHRM_STRS[i]);
+		fprintf(statsFile,"\t%s", simContext->CHRM_STRS[i]);
     fprintf(statsFile,"\n\tLife Mths, with CHRM hist (HIV+)");
 	for (i = 0; i < SimContext::CHRM_NUM; ++i)
-	    fprintf(statsFile," \t%1.0lf", overallSurvival.LMsCHRMHistoryCHRMsHIVPos[i]);
+	    fprintf(statsFile," \t%1.0lf", (double) overallSurvival.LMsCHRMHistoryCHRMsHIVPos[i]);
 
 
 	// output LMs by HIV screening states
@@ -3472,15 +5093,15 @@ void RunStats::writeOverallSurvival() {
 	fprintf(statsFile, "\tHIVpos (All)");
 	fprintf(statsFile, "\n\tLMs by HIV State:");
 	for (i = 0; i < SimContext::HIV_ID_NUM; ++i)
-		fprintf(statsFile, "\t%1.0lf", overallSurvival.LMsHIVState[i]);
+		fprintf(statsFile, "\t%1.0lf", (double) overallSurvival.LMsHIVState[i]);
 	fprintf(statsFile, "\t%1.0lf", overallSurvival.LMsHIVPositive);
 
 	// output other misc LM stats
 	fprintf(statsFile, "\n\t\tLMs\tQALMs");
 	fprintf(statsFile, "\n\tLMs in HIV Scr Module:\t%1.0lf\t%1.0lf",
-		overallSurvival.LMsInScreening, overallSurvival.QALMsInScreening);
-	fprintf(statsFile, "\t\tLMs in \"Reg CEPAC\":\t%1.0lf", overallSurvival.LMsInRegularCEPAC);
-	fprintf(statsFile, "\n\tLMs on PrEP (HIV-):\t%1.0lf", overallSurvival.LMsHIVNegativeOnPrEP);
+		(double) overallSurvival.LMsInScreening, (double) overallSurvival.QALMsInScreening);
+	fprintf(statsFile, "\t\tLMs in \"Reg CEPAC\":\t%1.0lf", (double) overallSurvival.LMsInRegularCEPAC);
+	fprintf(statsFile, "\n\tLMs on PrEP (HIV-):\t%1.0lf", (double) overallSurvival.LMsHIVNegativeOnPrEP);
 
 	// output survival by gender
 	fprintf(statsFile, "\n\t");
@@ -3488,10 +5109,10 @@ void RunStats::writeOverallSurvival() {
 		fprintf(statsFile, "\t%s", SimContext::GENDER_STRS[i]);
 	fprintf(statsFile, "\n\tLMs Gender");
 	for (i = 0; i < SimContext::GENDER_NUM; i++)
-		fprintf(statsFile, "\t%1.0lf", overallSurvival.LMsGender[i]);
+		fprintf(statsFile, "\t%1.0lf", (double) overallSurvival.LMsGender[i]);
 	fprintf(statsFile, "\n\tQALMs Gender");
 	for (i = 0; i < SimContext::GENDER_NUM; i++)
-		fprintf(statsFile, "\t%1.0lf", overallSurvival.QALMsGender[i]);
+		fprintf(statsFile, "\t%1.0lf", (double) overallSurvival.QALMsGender[i]);
 } /* end writeOverallSurvival */
 
 /** \brief writeOverallCosts outputs the OverallCosts statistics to the stats file */
@@ -3505,7 +5126,7 @@ void RunStats::writeOverallCosts() {
 		for (i = 0; i < simContext->NUM_DISCOUNT_RATES; i++){
 			double annualRateCost = pow(simContext->getRunSpecsInputs()->multDiscountRatesCost[i],12.0)-1;
 			fprintf(statsFile,"\n\tOverall Discounted Cost\t%1.2lf\t%1.0lf",
-				annualRateCost, popSummary.multDiscCostsSum[i]);
+				annualRateCost, (double) popSummary.multDiscCostsSum[i]);
 		}
 	}
 	else{
@@ -3520,28 +5141,28 @@ void RunStats::writeOverallCosts() {
     fprintf(statsFile,"\tTotal");
     fprintf(statsFile,"\n\tCosts [woOIHist]");
 	for (i = SimContext::CD4_NUM_STRATA - 1; i >= 0; --i) {
-	    fprintf(statsFile," \t%1.0lf", overallCosts.costsNoOIHistoryCD4[i]);
+	    fprintf(statsFile," \t%1.0lf", (double) overallCosts.costsNoOIHistoryCD4[i]);
 	}
 	fprintf(statsFile,"\t%1.0lf", overallCosts.costsNoOIHistory);
     fprintf(statsFile,"\n\tCosts [w.OIHist]");
 	for (i = SimContext::CD4_NUM_STRATA - 1; i >= 0; --i) {
-		fprintf(statsFile," \t%1.0lf", overallCosts.costsOIHistoryCD4[i]);
+		fprintf(statsFile," \t%1.0lf", (double) overallCosts.costsOIHistoryCD4[i]);
 	}
 	fprintf(statsFile,"\t%1.0lf", overallCosts.costsOIHistory);
     fprintf(statsFile,"\n\tCosts [Total]");
 	for (i = SimContext::CD4_NUM_STRATA - 1; i >= 0; --i) {
-	    fprintf(statsFile," \t%1.0lf", overallCosts.costsTotalCD4[i]);
+	    fprintf(statsFile," \t%1.0lf", (double) overallCosts.costsTotalCD4[i]);
 	}
 	fprintf(statsFile,"\t%1.0lf", overallCosts.costsTotal);
 
 	//Chrms costs
 	fprintf(statsFile, "\n\t");
 	for(int i=0;i<SimContext::CHRM_NUM;i++){
-		fprintf(statsFile,"\t%s", SimContext::CHRM_STRS[i]);
+		fprintf(statsFile,"\t%s", simContext->CHRM_STRS[i]);
 	}
 	fprintf(statsFile,"\n\tCHRMs Costs:");
 	for(int i=0;i<SimContext::CHRM_NUM;i++){
-		fprintf(statsFile,"\t%1.0lf",overallCosts.costsCHRMs[i]);
+		fprintf(statsFile,"\t%1.0lf",(double) overallCosts.costsCHRMs[i]);
 	}
 
 	// output costs by HVL and HVL setpoint
@@ -3550,20 +5171,20 @@ void RunStats::writeOverallCosts() {
 		fprintf(statsFile,"\t%s", SimContext::HVL_STRATA_STRS[i]);
     fprintf(statsFile,"\n\tCosts, HVL Setpt ");
 	for (i = SimContext::HVL_NUM_STRATA - 1; i >= 0; --i)
-	    fprintf(statsFile," \t%1.0lf", overallCosts.costsHVLSetpoint[i]);
+	    fprintf(statsFile," \t%1.0lf", (double) overallCosts.costsHVLSetpoint[i]);
     fprintf(statsFile,"\n\tCosts, Curr HVL ");
 	for (i = SimContext::HVL_NUM_STRATA - 1; i >= 0; --i)
-	    fprintf(statsFile," \t%1.0lf", overallCosts.costsHVL[i]);
+	    fprintf(statsFile," \t%1.0lf", (double) overallCosts.costsHVL[i]);
 
 	// output proph and art costs
     fprintf(statsFile,"\n\tDirect Proph Costs");
 	for (i = 0; i < SimContext::OI_NUM; ++i)
-		fprintf(statsFile," \t%s", SimContext::OI_STRS[i]);
+		fprintf(statsFile," \t%s", simContext->OI_STRS[i]);
     fprintf(statsFile," \tAll");
 	for (j = 0; j < SimContext::PROPH_NUM; ++j) {
 	    fprintf(statsFile,"\n\tProph %d", j + 1);
 		for (i = 0; i < SimContext::OI_NUM; ++i)
-		    fprintf(statsFile," \t%1.0lf", overallCosts.directCostsProphOIsProph[i][j]);
+		    fprintf(statsFile," \t%1.0lf", (double) overallCosts.directCostsProphOIsProph[i][j]);
 	}
     fprintf(statsFile,"\n\tTotal Proph Costs");
 	for (i = 0; i < SimContext::OI_NUM; ++i) {
@@ -3581,7 +5202,7 @@ void RunStats::writeOverallCosts() {
 		    fprintf(statsFile,"\n\tDirect ART Costs:");
 		    fprintf(statsFile,"\t%1.2lf", pow(simContext->getRunSpecsInputs()->multDiscountRatesCost[j],12.0)-1);
 			for (i = 0; i < SimContext::ART_NUM_LINES; ++i) {
-			    fprintf(statsFile," \t%1.0lf", overallCosts.directCostsARTLineMultDisc[i][j]);
+			    fprintf(statsFile," \t%1.0lf", (double) overallCosts.directCostsARTLineMultDisc[i][j]);
 			}
 			fprintf(statsFile,"\t%1.0lf", overallCosts.directCostsARTMultDisc[j]);
 		}
@@ -3590,7 +5211,7 @@ void RunStats::writeOverallCosts() {
 		    fprintf(statsFile,"\n\tInit ART Costs:");
 		    fprintf(statsFile,"\t%1.2lf", pow(simContext->getRunSpecsInputs()->multDiscountRatesCost[j],12.0)-1);
 			for (i = 0; i < SimContext::ART_NUM_LINES; ++i) {
-			    fprintf(statsFile," \t%1.0lf", overallCosts.costsARTInitLineMultDisc[i][j]);
+			    fprintf(statsFile," \t%1.0lf", (double) overallCosts.costsARTInitLineMultDisc[i][j]);
 			}
 			fprintf(statsFile,"\t%1.0lf", overallCosts.costsARTInitMultDisc[j]);
 		}
@@ -3599,7 +5220,7 @@ void RunStats::writeOverallCosts() {
 		    fprintf(statsFile,"\n\tMonthly ART Costs:");
 		    fprintf(statsFile,"\t%1.2lf", pow(simContext->getRunSpecsInputs()->multDiscountRatesCost[j],12.0)-1);
 			for (i = 0; i < SimContext::ART_NUM_LINES; ++i) {
-			    fprintf(statsFile," \t%1.0lf", overallCosts.costsARTMonthlyLineMultDisc[i][j]);
+			    fprintf(statsFile," \t%1.0lf", (double) overallCosts.costsARTMonthlyLineMultDisc[i][j]);
 			}
 			fprintf(statsFile,"\t%1.0lf", overallCosts.costsARTMonthlyMultDisc[j]);
 		}
@@ -3610,19 +5231,19 @@ void RunStats::writeOverallCosts() {
 		fprintf(statsFile,"\tTotal");
 	    fprintf(statsFile,"\n\tDirect ART Costs:");
 		for (i = 0; i < SimContext::ART_NUM_LINES; ++i) {
-		    fprintf(statsFile," \t%1.0lf", overallCosts.directCostsARTLine[i]);
+		    fprintf(statsFile," \t%1.0lf", (double) overallCosts.directCostsARTLine[i]);
 		}
-	    fprintf(statsFile,"\t%1.0lf", overallCosts.directCostsART);
+	    fprintf(statsFile,"\t%1.0lf", (double) overallCosts.directCostsART);
 
 	    fprintf(statsFile,"\n\tInit ART Costs:");
 		for (i = 0; i < SimContext::ART_NUM_LINES; ++i) {
-		    fprintf(statsFile," \t%1.0lf", overallCosts.costsARTInitLine[i]);
+		    fprintf(statsFile," \t%1.0lf", (double) overallCosts.costsARTInitLine[i]);
 		}
 	    fprintf(statsFile,"\t%1.0lf", overallCosts.costsARTInit);
 
 	    fprintf(statsFile,"\n\tMonthly ART Costs:");
 		for (i = 0; i < SimContext::ART_NUM_LINES; ++i) {
-		    fprintf(statsFile," \t%1.0lf", overallCosts.costsARTMonthlyLine[i]);
+		    fprintf(statsFile," \t%1.0lf", (double) overallCosts.costsARTMonthlyLine[i]);
 		}
 	    fprintf(statsFile,"\t%1.0lf", overallCosts.costsARTMonthly);
 
@@ -3633,51 +5254,51 @@ void RunStats::writeOverallCosts() {
 		fprintf(statsFile,"\n\t\tDiscountFactor\tCD4 Tests \tHVL Tests");
 		for (j = 0; j < simContext->NUM_DISCOUNT_RATES; j++){
 		    fprintf(statsFile,"\n\tTesting Costs:\t%1.2lf\t%1.0lf \t%1.0lf",
-		    		pow(simContext->getRunSpecsInputs()->multDiscountRatesCost[j],12.0)-1,overallCosts.costsCD4TestingMultDisc[j], overallCosts.costsHVLTestingMultDisc[j]);
+		    		pow(simContext->getRunSpecsInputs()->multDiscountRatesCost[j],12.0)-1,(double) overallCosts.costsCD4TestingMultDisc[j], (double) overallCosts.costsHVLTestingMultDisc[j]);
 		}
 	}
 	else{
 		fprintf(statsFile,"\n\t\tCD4 Tests \tHVL Tests");
 	    fprintf(statsFile,"\n\tTesting Costs: \t%1.0lf \t%1.0lf",
-			overallCosts.costsCD4Testing, overallCosts.costsHVLTesting);
+			(double) overallCosts.costsCD4Testing, (double) overallCosts.costsHVLTesting);
 	}
 
-	fprintf(statsFile,"\n\tClinic Visit Costs: \t%1.0lf", overallCosts.costsClinicVisits);
+	fprintf(statsFile,"\n\tClinic Visit Costs: \t%1.0lf", (double) overallCosts.costsClinicVisits);
 	fprintf(statsFile, "\n\t\tTests\tMisc");
 	fprintf(statsFile, "\n\tHIV Screening Costs:\t%1.0lf\t%1.0lf",
-		overallCosts.costsHIVScreeningTests, overallCosts.costsHIVScreeningMisc);
+		(double) overallCosts.costsHIVScreeningTests, (double) overallCosts.costsHIVScreeningMisc);
 
 	fprintf(statsFile, "\n\tLab Staging Costs:\t%1.0lf\t%1.0lf",
-		overallCosts.costsLabStagingTests, overallCosts.costsLabStagingMisc);	
+		(double) overallCosts.costsLabStagingTests, (double) overallCosts.costsLabStagingMisc);	
 
 	fprintf(statsFile, "\n\n\t\tNever HIV\tOn PrEP When Infected\tPrEP Stopped Due to Age When Infected\tPrEP Dropout When Infected\tTotal");
 	fprintf(statsFile, "\n\tPrEP Costs:\t%1.0lf\t%1.0lf\t%1.0lf\t%1.0lf\t%1.0lf", 
-		overallCosts.costsPrEPNeverHIV,
-		overallCosts.costsPrEPHIVPos[SimContext::HIV_POS_ON_PREP], 
-		overallCosts.costsPrEPHIVPos[SimContext::HIV_POS_PREP_AGESTOP], 
-		overallCosts.costsPrEPHIVPos[SimContext::HIV_POS_PREP_DROPOUT], 
-		overallCosts.costsPrEP);
+		(double) overallCosts.costsPrEPNeverHIV,
+		(double) overallCosts.costsPrEPHIVPos[SimContext::HIV_POS_ON_PREP], 
+		(double) overallCosts.costsPrEPHIVPos[SimContext::HIV_POS_PREP_AGESTOP], 
+		(double) overallCosts.costsPrEPHIVPos[SimContext::HIV_POS_PREP_DROPOUT], 
+		(double) overallCosts.costsPrEP);
 	fprintf(statsFile, "\n\t\tStartup\tMonthly");
 	fprintf(statsFile, "\n\tIntervention Costs:\t%1.0lf\t%1.0lf",
-		overallCosts.costsInterventionStartup, overallCosts.costsInterventionMonthly);
+		(double) overallCosts.costsInterventionStartup, (double) overallCosts.costsInterventionMonthly);
 
-	if (simContext->getPedsInputs()->enablePediatricsModel && simContext->getEIDInputs()->enableHIVTestingEID){
+	if (simContext->isPedsModelEnabled() && simContext->isEIDTestingEnabled()){
         fprintf(statsFile, "\n\t\tTests\tMisc");
 		fprintf(statsFile, "\n\tEID Screening Costs:\t%1.0lf\t%1.0lf",
-				overallCosts.costsEIDTests, overallCosts.costsEIDMisc);
+				(double) overallCosts.costsEIDTests, (double) overallCosts.costsEIDMisc);
         fprintf(statsFile, "\n\t\tTotal");
-        fprintf(statsFile, "\n\tInfant HIV Proph Costs:\t%1.0f", overallCosts.costsInfantHIVProph);
+        fprintf(statsFile, "\n\tInfant HIV Proph Costs:\t%1.0f", (double) overallCosts.costsInfantHIVProph);
 	}
 	fprintf(statsFile, "\n\t\tDirectMedical\tDirectNonMedical\tTimeCosts\tIndirect\tUnclassified\tDrugCosts\tToxicity");
 	fprintf(statsFile, "\n\tTotal Undiscounted Costs:\t%1.0lf\t%1.0lf\t%1.0lf\t%1.0lf\t%1.0lf\t%1.0lf\t%1.0lf",
-		overallCosts.totalUndiscountedCosts[0], overallCosts.totalUndiscountedCosts[1],
-		overallCosts.totalUndiscountedCosts[2], overallCosts.totalUndiscountedCosts[3],
-		overallCosts.totalUndiscountedCostsUnclassified, overallCosts.costsDrugs, overallCosts.costsToxicity);
+		(double) overallCosts.totalUndiscountedCosts[0], (double) overallCosts.totalUndiscountedCosts[1],
+		(double) overallCosts.totalUndiscountedCosts[2], (double) overallCosts.totalUndiscountedCosts[3],
+		overallCosts.totalUndiscountedCostsUnclassified, (double) overallCosts.costsDrugs, (double) overallCosts.costsToxicity);
 
 	fprintf(statsFile, "\n\tTotal Discounted Costs:\t%1.0lf\t%1.0lf\t%1.0lf\t%1.0lf\t%1.0lf\t%1.0lf\t%1.0lf",
-		overallCosts.totalDiscountedCosts[0], overallCosts.totalDiscountedCosts[1],
-		overallCosts.totalDiscountedCosts[2], overallCosts.totalDiscountedCosts[3],
-		overallCosts.totalDiscountedCostsUnclassified, overallCosts.costsDrugsDiscounted, overallCosts.costsToxicityDiscounted);
+		(double) overallCosts.totalDiscountedCosts[0], (double) overallCosts.totalDiscountedCosts[1],
+		(double) overallCosts.totalDiscountedCosts[2], (double) overallCosts.totalDiscountedCosts[3],
+		overallCosts.totalDiscountedCostsUnclassified, (double) overallCosts.costsDrugsDiscounted, (double) overallCosts.costsToxicityDiscounted);
 
 
 	// output costs by gender
@@ -3686,13 +5307,13 @@ void RunStats::writeOverallCosts() {
 		fprintf(statsFile, "\t%s", SimContext::GENDER_STRS[i]);
 	fprintf(statsFile, "\n\tCosts Gender");
 	for (i = 0; i < SimContext::GENDER_NUM; i++)
-		fprintf(statsFile, "\t%1.0lf", overallCosts.costsGender[i]);
+		fprintf(statsFile, "\t%1.0lf", (double) overallCosts.costsGender[i]);
 
     // TB Costs
 
     /** Total TB Cost*/
 	fprintf(statsFile, "\n\tTotal TB Costs");
-	fprintf(statsFile, "\t%1.0lf", overallCosts.costsTBTotal);
+	fprintf(statsFile, "\t%1.0lf", (double) overallCosts.costsTBTotal);
 
 	/** Visit Costs */
 	fprintf(statsFile, "\n\t");
@@ -3700,10 +5321,10 @@ void RunStats::writeOverallCosts() {
         fprintf(statsFile, "\t%s", SimContext::COST_TYPES_STRS[i]);
     fprintf(statsFile, "\n\tTB Provider Visit Costs");
     for (i = 0; i < SimContext::COST_NUM_TYPES; i++)
-        fprintf(statsFile, "\t%1.0lf", overallCosts.costsTBProviderVisits[i]);
+        fprintf(statsFile, "\t%1.0lf", (double) overallCosts.costsTBProviderVisits[i]);
     fprintf(statsFile, "\n\tTB Med Pick-Up Costs");
     for (i = 0; i < SimContext::COST_NUM_TYPES; i++)
-        fprintf(statsFile, "\t%1.0lf", overallCosts.costsTBMedicationVisits[i]);
+        fprintf(statsFile, "\t%1.0lf", (double) overallCosts.costsTBMedicationVisits[i]);
 
     /** Diagnostic Testing Costs */
     fprintf(statsFile, "\n\tTB Diagnostic Number");
@@ -3711,12 +5332,12 @@ void RunStats::writeOverallCosts() {
         fprintf(statsFile, "\t%d", i);
     fprintf(statsFile, "\n\tInitial Costs");
     for (i = 0; i < SimContext::TB_NUM_TESTS; i++)
-        fprintf(statsFile, "\t%1.0lf", overallCosts.costsTBTestsInit[i]);
+        fprintf(statsFile, "\t%1.0lf", (double) overallCosts.costsTBTestsInit[i]);
     fprintf(statsFile, "\n\tDST Costs");
     for (i = 0; i < SimContext::TB_NUM_TESTS; i++)
-        fprintf(statsFile, "\t%1.0lf", overallCosts.costsTBTestsDST[i]);
+        fprintf(statsFile, "\t%1.0lf", (double) overallCosts.costsTBTestsDST[i]);
     fprintf(statsFile, "\n\tTotal TB Diagnostic Costs");
-	fprintf(statsFile, "\t%1.0lf", overallCosts.costsTBTests);
+	fprintf(statsFile, "\t%1.0lf", (double) overallCosts.costsTBTests);
 
     /** Treatment Costs */
     fprintf(statsFile, "\n\tTB Treatment Number");
@@ -3724,12 +5345,12 @@ void RunStats::writeOverallCosts() {
         fprintf(statsFile, "\t%d", i);
     fprintf(statsFile, "\n\tDirect Costs");
     for (i = 0; i < SimContext::TB_NUM_TREATMENTS; i++)
-        fprintf(statsFile, "\t%1.0lf", overallCosts.costsTBTreatmentByLine[i]);
+        fprintf(statsFile, "\t%1.0lf", (double) overallCosts.costsTBTreatmentByLine[i]);
     fprintf(statsFile, "\n\tToxicity Costs");
     for (i = 0; i < SimContext::TB_NUM_TREATMENTS; i++)
-        fprintf(statsFile, "\t%1.0lf", overallCosts.costsTBTreatmentToxByLine[i]);
+        fprintf(statsFile, "\t%1.0lf", (double) overallCosts.costsTBTreatmentToxByLine[i]);
     fprintf(statsFile, "\n\tTB Treatment Total Direct Costs");
-	fprintf(statsFile, "\t%1.0lf", overallCosts.costsTBTreatment);
+	fprintf(statsFile, "\t%1.0lf", (double) overallCosts.costsTBTreatment);
 } /* end writeOverallCosts */
 
 /** \brief writeTBStats outputs the TBStats statistics to the stats file */
@@ -3956,7 +5577,7 @@ void RunStats::writeProphStats() {
 	fprintf(statsFile,"\nOI PROPH TOXICITY EVENTS");
 	fprintf(statsFile,"\n\tMinor Tox Events");
 	for (i = 0; i < SimContext::OI_NUM; ++i)
-		fprintf(statsFile," \t%s", SimContext::OI_STRS[i]);
+		fprintf(statsFile," \t%s", simContext->OI_STRS[i]);
 	for (i = 0; i < SimContext::PROPH_NUM; ++i) {
 		fprintf(statsFile,"\n\tProph %d", i+1);
 		for (j = 0; j < SimContext::OI_NUM; ++j)
@@ -3967,7 +5588,7 @@ void RunStats::writeProphStats() {
 		fprintf(statsFile," \t%1lu", prophStats.numMinorToxicityTotal[j]);
 	fprintf(statsFile,"\n\tMajor Tox Events");
 	for (i = 0; i < SimContext::OI_NUM; ++i)
-		fprintf(statsFile," \t%s", SimContext::OI_STRS[i]);
+		fprintf(statsFile," \t%s", simContext->OI_STRS[i]);
 	for (i = 0; i < SimContext::PROPH_NUM; ++i) {
 		fprintf(statsFile,"\n\tProph %d", i+1);
 		for (j = 0; j < SimContext::OI_NUM; ++j)
@@ -3982,7 +5603,7 @@ void RunStats::writeProphStats() {
 	for ( i = 0; i < SimContext::PROPH_NUM; ++i )
 		fprintf(statsFile, "\tProph%d True\tObsv CD4\tTimes Init'd w.Absolute CD4 Metric\tTotal Times Init'd", i+1, i+1);
 	for ( j = 0; j < SimContext::OI_NUM; ++j ) {
-		fprintf(statsFile, "\n\t%s", SimContext::OI_STRS[j]);
+		fprintf(statsFile, "\n\t%s", simContext->OI_STRS[j]);
 		for ( i = 0; i < SimContext::PROPH_NUM; ++i ) {
 			fprintf(statsFile, "\t%1.0lf \t%1.0lf \t%d \t%d",
 				prophStats.trueCD4InitProphMean[SimContext::PROPH_PRIMARY][j][i],
@@ -3996,7 +5617,7 @@ void RunStats::writeProphStats() {
 	for ( i = 0; i < SimContext::PROPH_NUM; ++i )
 		fprintf(statsFile, "\tProph%d True\tObsv CD4\tTimes Init'd w.Absolute CD4 Metric\tTotal Times Init'd", i+1, i+1);
 	for ( j = 0; j < SimContext::OI_NUM; ++j ) {
-		fprintf(statsFile, "\n\t%s", SimContext::OI_STRS[j]);
+		fprintf(statsFile, "\n\t%s", simContext->OI_STRS[j]);
 		for ( i = 0; i < SimContext::PROPH_NUM; ++i ) {
 			fprintf(statsFile, "\t%1.0lf \t%1.0lf \t%d \t%d",
 				prophStats.trueCD4InitProphMean[SimContext::PROPH_SECONDARY][j][i],
@@ -4047,7 +5668,7 @@ void RunStats::writeARTStats() {
 			fprintf(statsFile, "\tCD4 Type %1lu", k + 1);
 		}
 		for (k = 0; k < SimContext::RISK_FACT_NUM; k++) {
-			fprintf(statsFile, "\t%s", SimContext::RISK_FACT_STRS[k]);
+			fprintf(statsFile, "\t%s", simContext->RISK_FACT_STRS[k]);
 		}
 		fprintf(statsFile, "\n\tAny response: \t%1lu \t%1.2lf \t%1.2lf \t%1.2lf \t%1lu \t%1lu ",
 			artStats.numOnARTAtInit[j], artStats.trueCD4AtInitMean[j][SimContext::CD4_PERC], artStats.trueCD4AtInitMean[j][SimContext::CD4_ABSOLUTE], artStats.observedCD4AtInitMean[j], artStats.numOnARTAtInitCD4Metric[j][SimContext::CD4_PERC], artStats.numOnARTAtInitCD4Metric[j][SimContext::CD4_ABSOLUTE]);
@@ -4128,7 +5749,7 @@ void RunStats::writeARTStats() {
 		//print ART death statistics
 		fprintf(statsFile, "\n\tAt Death on ART Line: \t# Total");
 		for (i =0; i < SimContext::DTH_NUM_CAUSES; i++){
-			fprintf(statsFile,"\t%s", SimContext::DTH_CAUSES_STRS[i]);
+			fprintf(statsFile,"\t%s", simContext->DTH_CAUSES_STRS[i]);
 		}
 
 		fprintf(statsFile,"\n\tNum Deaths (Total)\t%1lu",artStats.numARTDeath[j]);
@@ -4156,7 +5777,7 @@ void RunStats::writeARTStats() {
 		//print ART OI statistics
 		fprintf(statsFile, "\n\tOI on ART Line:");
 		for (i =0; i < SimContext::OI_NUM; i++){
-			fprintf(statsFile,"\t%s", SimContext::OI_STRS[i]);
+			fprintf(statsFile,"\t%s", simContext->OI_STRS[i]);
 		}
 		fprintf(statsFile,"\n\tNum OI");
 		for (i =0; i < SimContext::OI_NUM; i++)
@@ -4272,7 +5893,7 @@ void RunStats::writeTimeSummaries() {
 
 		//output cohort characteristics by care state
 		fprintf(statsFile,"\n\tCare State\t#Alive\t#Deaths\tTrue CD4 Mean\tTrue CD4 SD\tObserved CD4 Mean\tObserved CD4 SD\tProp Resp Mean\tProp Resp SD\tAge Mean\tAge SD\tNum Mild OI Hist\tNum Sevr OI Hist\tNum Male");
-		if(simContext->getPedsInputs()->enablePediatricsModel)
+		if(simContext->isPedsModelEnabled())
 			fprintf(statsFile,"\tNum w.Perc CD4 Metric (Peds < 5)\tNum w.Absolute CD4 Metric");
 		for (j = 0; j < SimContext::HIV_CARE_NUM; j++){
 			fprintf(statsFile, "\n\t%s", SimContext::HIV_CARE_STRS[j]);
@@ -4281,7 +5902,7 @@ void RunStats::writeTimeSummaries() {
 			fprintf(statsFile, "\t%1.4lf\t%1.4lf", currTime->propRespMeanCare[j], currTime->propRespStdDevCare[j]);
 			fprintf(statsFile, "\t%1.2lf\t%1.2lf", currTime->ageMeanCare[j], currTime->ageStdDevCare[j]);
 			fprintf(statsFile, "\t%1lu\t%1lu\t%1lu",currTime->numWithOIHistExtCare[SimContext::HIST_EXT_MILD][j],currTime->numWithOIHistExtCare[SimContext::HIST_EXT_SEVR][j], currTime->numGenderCare[SimContext::GENDER_MALE][j]);
-			if(simContext->getPedsInputs()->enablePediatricsModel){
+			if(simContext->isPedsModelEnabled()){
 				fprintf(statsFile, "\t%lu\t%lu", currTime->numAliveCareCD4Metric[j][SimContext::CD4_PERC], currTime->numAliveCareCD4Metric[j][SimContext::CD4_ABSOLUTE]);
 			}
 		}
@@ -4301,7 +5922,7 @@ void RunStats::writeTimeSummaries() {
 				fprintf(statsFile, "\t%1.4lf\t%1.4lf", currTime->propRespMeanOnART[j][effToUse], currTime->propRespStdDevOnART[j][effToUse]);
 				fprintf(statsFile, "\t%1.2lf\t%1.2lf", currTime->ageMeanOnART[j][effToUse], currTime->ageStdDevOnART[j][effToUse]);
 				fprintf(statsFile, "\t%1lu\t%1lu\t%1lu",currTime->numWithOIHistExtOnART[SimContext::HIST_EXT_MILD][j][effToUse],currTime->numWithOIHistExtOnART[SimContext::HIST_EXT_SEVR][j][effToUse], currTime->numGenderOnART[SimContext::GENDER_MALE][j][effToUse]);
-				if(simContext->getPedsInputs()->enablePediatricsModel){
+				if(simContext->isPedsModelEnabled()){
 					fprintf(statsFile, "\t%lu\t%lu", currTime->numAliveOnARTCD4Metric[j][effToUse][SimContext::CD4_PERC], currTime->numAliveOnARTCD4Metric[j][effToUse][SimContext::CD4_ABSOLUTE]);
 				}
 			}
@@ -4312,7 +5933,7 @@ void RunStats::writeTimeSummaries() {
 		fprintf(statsFile, "\t%1.4lf\t%1.4lf", currTime->propRespMeanInCareOffART, currTime->propRespStdDevInCareOffART);
 		fprintf(statsFile, "\t%1.2lf\t%1.2lf", currTime->ageMeanInCareOffART, currTime->ageStdDevInCareOffART);
 		fprintf(statsFile, "\t%1lu\t%1lu\t%1lu",currTime->numWithOIHistExtInCareOffART[SimContext::HIST_EXT_MILD],currTime->numWithOIHistExtInCareOffART[SimContext::HIST_EXT_SEVR], currTime->numGenderInCareOffART[SimContext::GENDER_MALE]);
-		if(simContext->getPedsInputs()->enablePediatricsModel){
+		if(simContext->isPedsModelEnabled()){
 			fprintf(statsFile, "\t%lu\t%lu", currTime->numAliveInCareOffARTCD4Metric[SimContext::CD4_PERC], currTime->numAliveInCareOffARTCD4Metric[SimContext::CD4_ABSOLUTE]);
 		}
 
@@ -4322,7 +5943,7 @@ void RunStats::writeTimeSummaries() {
 		fprintf(statsFile, "\t%1.4lf\t%1.4lf", currTime->propRespMeanPositive, currTime->propRespStdDevPositive);
 		fprintf(statsFile, "\t%1.2lf\t%1.2lf", currTime->ageMeanPositive, currTime->ageStdDevPositive);
 		fprintf(statsFile, "\t%1lu\t%1lu\t%1lu",currTime->numWithOIHistExtPositive[SimContext::HIST_EXT_MILD],currTime->numWithOIHistExtPositive[SimContext::HIST_EXT_SEVR], currTime->numGenderPositive[SimContext::GENDER_MALE]);
-		if(simContext->getPedsInputs()->enablePediatricsModel){
+		if(simContext->isPedsModelEnabled()){
 			fprintf(statsFile, "\t%lu\t%lu", currTime->numAlivePositiveCD4Metric[SimContext::CD4_PERC], currTime->numAlivePositiveCD4Metric[SimContext::CD4_ABSOLUTE]);
 		}
 
@@ -4332,7 +5953,7 @@ void RunStats::writeTimeSummaries() {
 		fprintf(statsFile, "\t%1.4lf\t%1.4lf", currTime->propRespMean, currTime->propRespStdDev);
 		fprintf(statsFile, "\t%1.2lf\t%1.2lf", currTime->ageMean, currTime->ageStdDev);
 		fprintf(statsFile, "\t%1lu\t%1lu\t%1lu",currTime->numWithOIHistExt[SimContext::HIST_EXT_MILD],currTime->numWithOIHistExt[SimContext::HIST_EXT_SEVR], currTime->numGender[SimContext::GENDER_MALE]);
-		if(simContext->getPedsInputs()->enablePediatricsModel){
+		if(simContext->isPedsModelEnabled()){
 			fprintf(statsFile, "\t%lu\t%lu", currTime->numAlivePositiveCD4Metric[SimContext::CD4_PERC]+currTime->numAliveCareCD4Metric[SimContext::HIV_CARE_NEG][SimContext::CD4_PERC], currTime->numAlivePositiveCD4Metric[SimContext::CD4_ABSOLUTE]+currTime->numAliveCareCD4Metric[SimContext::HIV_CARE_NEG][SimContext::CD4_ABSOLUTE]);
 		}
 
@@ -4398,7 +6019,7 @@ void RunStats::writeTimeSummaries() {
 		}
 		fprintf(statsFile, "\n\t%1lu", currTime->numIncidentHIVInfections);
 		if (runSpecs->longitLoggingLevel == SimContext::LONGIT_SUMM_MTH_DET){
-			fprintf(statsFile, "\t\t%1.2f", currTime->sumQOLModifiers);
+			fprintf(statsFile, "\t\t%1.2f", (double) currTime->sumQOLModifiers);
 		}
 		fprintf(statsFile,"\n\t\tHighRisk\tLowRisk");
 		fprintf(statsFile,"\n\tNum on PrEP:");
@@ -4419,7 +6040,7 @@ void RunStats::writeTimeSummaries() {
 		fprintf(statsFile, "\n\tCumulative\t%1lu\t%1lu\t%1lu", currTime->cumulativeNumHIVTestsAtInitOffer, currTime->cumulativeNumHIVTestsPostStartup, currTime->cumulativeNumHIVTests);
 
 		//Output peds information if enabled
-		if (simContext->getPedsInputs()->enablePediatricsModel){
+		if (simContext->isPedsModelEnabled()){
 			fprintf(statsFile, "\n\t");
 			for (j = 0; j < SimContext::PEDS_HIV_NUM; ++j)
 				fprintf(statsFile, "\t%s", SimContext::PEDS_HIV_STATE_STRS[j]);
@@ -4530,7 +6151,7 @@ void RunStats::writeTimeSummaries() {
 			}
 
 			for(int i=0;i<SimContext::CHRM_NUM;i++){
-				fprintf(statsFile,"\n\t%s",SimContext::CHRM_STRS[i]);
+				fprintf(statsFile,"\n\t%s",simContext->CHRM_STRS[i]);
 				for (j = 0; j < SimContext::HIV_ID_NUM; ++j) {
 					fprintf(statsFile, "\t%1lu", currTime->numAliveTypeCHRMs[j][i]);
 				}
@@ -4554,7 +6175,7 @@ void RunStats::writeTimeSummaries() {
 			//output chrms incidence for this month
 			fprintf(statsFile,"\n\t");
 			for(j=0;j<SimContext::CHRM_NUM;j++){
-				fprintf(statsFile," \t%s",SimContext::CHRM_STRS[j]);
+				fprintf(statsFile," \t%s",simContext->CHRM_STRS[j]);
 			}
 			fprintf(statsFile,"\n\tIncident CHRMs evts");
 			for(j=0;j<SimContext::CHRM_NUM;j++){
@@ -4567,7 +6188,7 @@ void RunStats::writeTimeSummaries() {
 			fprintf(statsFile,"\t\tMeanTrueHVL (HIV+): \t%1.0lf", currTime->trueHVLMean );
 		}
 		else {
-			if (simContext->getHIVTestInputs()->enableHIVTesting || simContext->getPedsInputs()->enablePediatricsModel){
+			if (simContext->getHIVTestInputs()->enableHIVTesting || simContext->isPedsModelEnabled()){
 				fprintf(statsFile,"\n\t\tMean True CD4\tSD\t\tMean Observed CD4\tSD");
 				for (int i = 1; i < SimContext::HIV_CARE_NUM; i++){
 					fprintf(statsFile,"\n\t%s\t%1.0lf\t%1.0lf\t\t%1.0lf\t%1.0lf",simContext->HIV_CARE_STRS[i],currTime->trueCD4MeanCare[i],currTime->trueCD4StdDevCare[i],currTime->observedCD4MeanCare[i],currTime->observedCD4StdDevCare[i]);
@@ -4685,20 +6306,20 @@ void RunStats::writeTimeSummaries() {
 				fprintf(statsFile,"\tTotal");
 				fprintf(statsFile,"\n\tPrimary Transmissions by True HVL");
 				for ( k = 0; k < SimContext::HVL_NUM_STRATA; ++k )
-					fprintf(statsFile," \t%1.3lf", currTime->numTransmissionsHVL[k]);
-				fprintf(statsFile," \t%1.3lf", currTime->numTransmissions);
+					fprintf(statsFile," \t%1.3lf", (double) currTime->numTransmissionsHVL[k]);
+				fprintf(statsFile," \t%1.3lf", (double) currTime->numTransmissions);
 
 				fprintf(statsFile, "\n\t");
 				for (k = 0; k < SimContext::TRANSM_RISK_NUM; k++)
 					fprintf(statsFile, "\t%s", SimContext::TRANSM_RISK_STRS[k]);
 				fprintf(statsFile, "\n\tPrimary Transmissions by Risk");
 				for (k = 0; k < SimContext::TRANSM_RISK_NUM; k++)
-					fprintf(statsFile," \t%1.3lf", currTime->numTransmissionsRisk[k]);
+					fprintf(statsFile," \t%1.3lf", (double) currTime->numTransmissionsRisk[k]);
 			}
 		} // end detailed CD4 and HVL outputs, ART toxicity outputs and transmission outputs if logging level is not SimContext::LONGIT_SUMM_MTH_BRF
 
 		//output monthly TB stats (if tb module is enabled)
-		if (simContext->getTBInputs()->enableTB){
+		if (simContext->isTBEnabled()){
 			fprintf(statsFile,"\n\t");
 			for (j = 0; j < SimContext::TB_NUM_STATES; j++)
 				fprintf(statsFile, "\t%s", SimContext::TB_STATE_STRS[j]);
@@ -4983,13 +6604,13 @@ void RunStats::writeTimeSummaries() {
 			fprintf(statsFile, "\t%lu", currTime->numDeathsTBWhileFailedTBTreatment);
 
 			fprintf(statsFile,"\n\tTB Monthly Costs");
-			fprintf(statsFile, "\t%1.0lf", currTime->totalMonthlyTBCohortCosts);
+			fprintf(statsFile, "\t%1.0lf", (double) currTime->totalMonthlyTBCohortCosts);
 		} //end if TB is enabled
 
 		// output OI distribs for only this month (not cumulative)
 		fprintf(statsFile,"\n\n\tOIs Distrib");
 		for ( j = 0; j < SimContext::OI_NUM; ++j )
-			fprintf(statsFile," \t%s", SimContext::OI_STRS[j]);
+			fprintf(statsFile," \t%s", simContext->OI_STRS[j]);
 		fprintf(statsFile, "\tTotal");
 		if (runSpecs->longitLoggingLevel == SimContext::LONGIT_SUMM_MTH_BRF) {
 			fprintf(statsFile,"\n\tTot OI evts:");
@@ -5028,8 +6649,8 @@ void RunStats::writeTimeSummaries() {
 		// output dth distribs for only this month (not cumulative)
 		fprintf(statsFile,"\n\tDths Distrib");
 		for ( j = 0; j < SimContext::DTH_NUM_CAUSES; ++j )
-			fprintf(statsFile," \t%s", SimContext::DTH_CAUSES_STRS[j]);
-		if (simContext->getHIVTestInputs()->enableHIVTesting || simContext->getPedsInputs()->enablePediatricsModel){
+			fprintf(statsFile," \t%s", simContext->DTH_CAUSES_STRS[j]);
+		if (simContext->getHIVTestInputs()->enableHIVTesting || simContext->isPedsModelEnabled()){
 			fprintf(statsFile,"\n\tDth events:");
 			for ( j = 0; j < SimContext::DTH_NUM_CAUSES; ++j )
 				fprintf(statsFile," \t%1lu", currTime->numDeathsType[j]);
@@ -5057,7 +6678,7 @@ void RunStats::writeTimeSummaries() {
 			fprintf(statsFile,"\n\tPatients without CHRMs");
 			fprintf(statsFile,"\n\tDths Distrib");
 			for ( j = 0; j < SimContext::DTH_NUM_CAUSES; ++j )
-				fprintf(statsFile," \t%s", SimContext::DTH_CAUSES_STRS[j]);
+				fprintf(statsFile," \t%s", simContext->DTH_CAUSES_STRS[j]);
 			fprintf(statsFile," \t%s","Total");
 			fprintf(statsFile,"\n\tNum Dths:");
 			for ( j = 0; j < SimContext::DTH_NUM_CAUSES; ++j )
@@ -5067,10 +6688,10 @@ void RunStats::writeTimeSummaries() {
 			//output dth distribs for those with CHRMs when they died (not cumulative)
 			fprintf(statsFile,"\n\tPatients with CHRMs");
 			for(int i=0;i<SimContext::CHRM_NUM;i++){
-				fprintf(statsFile,"\n\t%s",SimContext::CHRM_STRS[i]);
+				fprintf(statsFile,"\n\t%s",simContext->CHRM_STRS[i]);
 				fprintf(statsFile,"\n\tDths Distrib");
 				for ( j = 0; j < SimContext::DTH_NUM_CAUSES; ++j )
-					fprintf(statsFile," \t%s", SimContext::DTH_CAUSES_STRS[j]);
+					fprintf(statsFile," \t%s", simContext->DTH_CAUSES_STRS[j]);
 				fprintf(statsFile," \t%s","Total");
 				fprintf(statsFile,"\n\tNum Dths:");
 				for ( j = 0; j < SimContext::DTH_NUM_CAUSES; ++j )
@@ -5079,54 +6700,54 @@ void RunStats::writeTimeSummaries() {
 			}
 			fprintf(statsFile,"\n\t");
 			for (j = 0; j < SimContext::CHRM_NUM; ++j)
-				fprintf(statsFile, " \t%s",SimContext::CHRM_STRS[j]);
+				fprintf(statsFile, " \t%s",simContext->CHRM_STRS[j]);
 			fprintf(statsFile,"\n\tCHRMs Costs:");
 			for (j = 0; j < SimContext::CHRM_NUM; ++j)
-				fprintf(statsFile," \t%1.0lf", currTime->costsCHRMs[j]);
+				fprintf(statsFile," \t%1.0lf", (double) currTime->costsCHRMs[j]);
 		} //end if CHRMs outputs are enabled
 
 		// output cost distribs 
 		fprintf(statsFile,"\n\tHIV Screening Costs\n\t\tHIVtests\tHIVmisc\tLab Stage Tests\tLab Stage Misc");
 
-		fprintf(statsFile,"\n\tCurrent costs:\t%1.0lf \t%1.0lf \t%1.0lf\t%1.0lf", currTime->costsHIVTests, currTime->costsHIVMisc, currTime->costsLabStagingTests, currTime->costsLabStagingMisc);
-		fprintf(statsFile, "\t\tPrEP Costs:\t%1.0lf", currTime->costsPrEP);	
+		fprintf(statsFile,"\n\tCurrent costs:\t%1.0lf \t%1.0lf \t%1.0lf\t%1.0lf", (double) currTime->costsHIVTests, (double) currTime->costsHIVMisc, (double) currTime->costsLabStagingTests, (double) currTime->costsLabStagingMisc);
+		fprintf(statsFile, "\t\tPrEP Costs:\t%1.0lf", (double) currTime->costsPrEP);	
 		fprintf(statsFile,"\n\tCumulative costs:\t%1.0lf \t%1.0lf", currTime->cumulativeHIVTestingCosts, currTime->cumulativeHIVMiscCosts);
 
-		if (simContext->getPedsInputs()->enablePediatricsModel && simContext->getEIDInputs()->enableHIVTestingEID){
+		if (simContext->isPedsModelEnabled() && simContext->isEIDTestingEnabled()){
 			fprintf(statsFile, "\n\t\tEID Tests\tEID Misc");
 			fprintf(statsFile,"\n\tEID costs:\t%1.0lf \t%1.0lf",
-					currTime->costsEIDTests, currTime->costsEIDMisc);
+					(double) currTime->costsEIDTests, (double) currTime->costsEIDMisc);
 			fprintf(statsFile, "\n\t\tDirect\tTox");
 			fprintf(statsFile,"\n\tInfant HIV Proph Cost:\t%1.0lf \t%1.0lf",
-					currTime->costsInfantHIVProphDirect, currTime->costsInfantHIVProphTox);
+					(double) currTime->costsInfantHIVProphDirect, (double) currTime->costsInfantHIVProphTox);
 		}	
 
 		fprintf(statsFile,"\n\t\tStartup\tMonthly");
 		fprintf(statsFile,"\n\tIntervention costs:\t%1.0lf \t%1.0lf",
-				currTime->costsInterventionStartup, currTime->costsInterventionMonthly);
+				(double) currTime->costsInterventionStartup, (double) currTime->costsInterventionMonthly);
 
 		fprintf(statsFile, "\n\t\tCD4 Test Costs (All)\tHVL Test Costs (All)");
-		fprintf(statsFile, "\n\tCurrent Cost Totals\t%1.0lf \t%1.0lf", currTime->costsCD4Testing, currTime->costsHVLTesting);
+		fprintf(statsFile, "\n\tCurrent Cost Totals\t%1.0lf \t%1.0lf", (double) currTime->costsCD4Testing, (double) currTime->costsHVLTesting);
 
 		fprintf(statsFile, "\n\tCumulative Cost Totals\t%1.0lf \t%1.0lf ",currTime->cumulativeCD4TestingCosts,
 				currTime->cumulativeHVLTestingCosts);
 
-		fprintf(statsFile,"\n\tClinic Visit Costs (Current %s)\t%1.2lf", (runSpecs->longitLoggingLevel == SimContext::LONGIT_SUMM_YR_DET)?"Year":"Month", currTime->costsClinicVisits);
+		fprintf(statsFile,"\n\tClinic Visit Costs (Current %s)\t%1.2lf", (runSpecs->longitLoggingLevel == SimContext::LONGIT_SUMM_YR_DET)?"Year":"Month", (double) currTime->costsClinicVisits);
 		fprintf(statsFile, "\n\tCategorized Cost Totals\n\t\tDirectMedical\tDirectNonMedical\tTimeCosts\tIndirect");
 		fprintf(statsFile, "\n\tCurrent Categorized Costs\t%1.0lf\t%1.0lf\t%1.0lf\t%1.0lf",
-			currTime->totalMonthlyCohortCostsType[0], currTime->totalMonthlyCohortCostsType[1],
-			currTime->totalMonthlyCohortCostsType[2], currTime->totalMonthlyCohortCostsType[3]);
+			(double) currTime->totalMonthlyCohortCostsType[0], (double) currTime->totalMonthlyCohortCostsType[1],
+			(double) currTime->totalMonthlyCohortCostsType[2], (double) currTime->totalMonthlyCohortCostsType[3]);
 		fprintf(statsFile, "\n\tCumulative Categorized Costs\t%1.0lf\t%1.0lf\t%1.0lf\t%1.0lf",
 			currTime->cumulativeCohortCostsType[0], currTime->cumulativeCohortCostsType[1],
 			currTime->cumulativeCohortCostsType[2], currTime->cumulativeCohortCostsType[3]);	
 
 		fprintf(statsFile,"\n\tProph Costs");
 		for (j = 0; j < SimContext::OI_NUM; ++j)
-			fprintf(statsFile," \t%s", SimContext::OI_STRS[j]);
+			fprintf(statsFile," \t%s", simContext->OI_STRS[j]);
 		for (j = 0; j < SimContext::PROPH_NUM; ++j) {
 			fprintf(statsFile,"\n\tProph %d", j + 1);
 			for (k = 0; k < SimContext::OI_NUM; ++k)
-				fprintf(statsFile," \t%1.0lf", currTime->costsProph[k][j]);
+				fprintf(statsFile," \t%1.0lf", (double) currTime->costsProph[k][j]);
 		}
 
 		fprintf(statsFile,"\n\t");
@@ -5135,7 +6756,7 @@ void RunStats::writeTimeSummaries() {
 		fprintf(statsFile, " \tPre-ART \tPost-ART (Off ART)");
 		fprintf(statsFile,"\n\tART Costs:");
 		for (j = 0; j < SimContext::ART_NUM_LINES; ++j)
-			fprintf(statsFile," \t%1.0lf", currTime->costsART[j]);
+			fprintf(statsFile," \t%1.0lf", (double) currTime->costsART[j]);
 		fprintf(statsFile,"\n\tNum HIV+in_care (Starting this month):");
 		for (j = 0; j < SimContext::ART_NUM_LINES; ++j)
 			fprintf(statsFile," \t%lu", currTime->numStartingART[j]);
@@ -5170,7 +6791,7 @@ void RunStats::writeTimeSummaries() {
 		fprintf(statsFile," \t%lu", currTime->numDeathsWhileLostPreART);
 		fprintf(statsFile," \t%lu", currTime->numDeathsWhileLostPostART);
 
-		if (simContext->getHIVTestInputs()->enableHIVTesting || simContext->getPedsInputs()->enablePediatricsModel){
+		if (simContext->getHIVTestInputs()->enableHIVTesting || simContext->isPedsModelEnabled()){
 			fprintf(statsFile, "\n\n\tNum Deaths HIV+ (at least one clinic visit):\t%lu", currTime->numDeathsHIVPosHadClinicVisit);
 			fprintf(statsFile, "\n\tNum Deaths HIV+ (never visited clinic):\t%lu", currTime->numDeathsHIVPosNeverVisitedClinic);
 			fprintf(statsFile, "\n\tNum Deaths HIV-:\t%lu", currTime->numDeathsUninfected);
@@ -5180,7 +6801,7 @@ void RunStats::writeTimeSummaries() {
 		fprintf(statsFile, "\n\n\t\tCumulative ART Costs");
 		fprintf(statsFile, "\n\tTotal (up to this month)\t%1.0lf", currTime->cumulativeARTCosts);
 		fprintf(statsFile,"\n\t\tTotal Cohort Costs");
-		fprintf(statsFile, "\n\tCurrent Total\t%1.2lf", currTime->totalMonthlyCohortCosts);
+		fprintf(statsFile, "\n\tCurrent Total\t%1.2lf", (double) currTime->totalMonthlyCohortCosts);
 		fprintf(statsFile, "\n\tCumulative Total\t%1.2lf", currTime->cumulativeCohortCosts);
 	}
 } /* end writeTimeSummaries */
@@ -65,11 +65,11 @@ public:
 		int totalClinicVisits;
 		// Overall costs, life months, and quality adjusted life month statistics
 		/** The total cost accrued in this run*/
-		double costsSum;
+		FixedPointSum costsSum;
 		/** The average costs per Person */
 		double costsAverage;
 		/** The sum of the squares of the costs per person (for calculating the standard deviation) */
-		double costsSumSquares;
+		FixedPointSum costsSumSquares;
 		/** The standard deviation of the costs per person */
 		double costsStdDev;
 		/** The lowest cost per person */
@@ -77,11 +77,11 @@ public:
 		/** The highest cost per person */
 		double costsUpperBound;
 		/** The total number of life months lived in this run */
-		double LMsSum;
+		FixedPointSum LMsSum;
 		/** The average life months lived per Person */
 		double LMsAverage;
 		/** The sum of the squares of the life months lived per person (for calculating the standard deviation) */
-		double LMsSumSquares;
+		FixedPointSum LMsSumSquares;
 		/** The standard deviation of the life months lived per person */
 		double LMsStdDev;
 		/** The lowest life months lived per person */
@@ -89,11 +89,11 @@ public:
 		/** The highest life months lived per person */
 		double LMsUpperBound;
 		/** The total number of quality adjusted life months lived in this run */
-		double QALMsSum;
+		FixedPointSum QALMsSum;
 		/** The average quality adjusted life months lived per Person */
 		double QALMsAverage;
 		/** The sum of the squares of the quality adjusted life months lived per person (for calculating the standard deviation) */
-		double QALMsSumSquares;
+		FixedPointSum QALMsSumSquares;
 		/** The standard deviation of the quality adjusted life months lived per person */
 		double QALMsStdDev;
 		/** The lowest quality adjusted life months lived per person */
@@ -103,52 +103,52 @@ public:
 
 		// Overall costs, life months, and quality adjusted life month statistics for use if cohort parsing is turned on
 		/** The total cost accrued in this run*/
-		double costsSumCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
+		FixedPointSum costsSumCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
 		/** The average costs per Person */
 		double costsAverageCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
 		/** The sum of the squares of the costs per person (for calculating the standard deviation) */
-		double costsSumSquaresCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
+		FixedPointSum costsSumSquaresCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
 		/** The standard deviation of the costs per person */
 		double costsStdDevCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
 		/** The total number of life months lived in this run */
-		double LMsSumCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
+		FixedPointSum LMsSumCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
 		/** The average life months lived per Person */
 		double LMsAverageCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
 		/** The sum of the squares of the life months lived per person (for calculating the standard deviation) */
-		double LMsSumSquaresCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
+		FixedPointSum LMsSumSquaresCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
 		/** The standard deviation of the life months lived per person */
 		double LMsStdDevCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
 		/** The total number of quality adjusted life months lived in this run */
-		double QALMsSumCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
+		FixedPointSum QALMsSumCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
 		/** The average quality adjusted life months lived per Person */
 		double QALMsAverageCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
 		/** The sum of the squares of the quality adjusted life months lived per person (for calculating the standard deviation) */
-		double QALMsSumSquaresCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
+		FixedPointSum QALMsSumSquaresCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
 		/** The standard deviation of the quality adjusted life months lived per person */
 		double QALMsStdDevCohortParsing[SimContext::MAX_NUM_SUBCOHORTS];
 
 		/** The average costs per Person using multiple discount rates*/
 		double multDiscCostsAverage[SimContext::NUM_DISCOUNT_RATES];
 		/** The total costs using multiple discount rates*/
-		double multDiscCostsSum[SimContext::NUM_DISCOUNT_RATES];
+		FixedPointSum multDiscCostsSum[SimContext::NUM_DISCOUNT_RATES];
 		/** The sum square costs per Person using multiple discount rates*/
-		double multDiscCostsSumSquares[SimContext::NUM_DISCOUNT_RATES];
+		FixedPointSum multDiscCostsSumSquares[SimContext::NUM_DISCOUNT_RATES];
 		/** The standard deviation of the costs per person using multiple discount rates*/
 		double multDiscCostsStdDev[SimContext::NUM_DISCOUNT_RATES];
 		/** The average LMs per Person using multiple discount rates*/
 		double multDiscLMsAverage[SimContext::NUM_DISCOUNT_RATES];
 		/** The total LMs per Person using multiple discount rates*/
-		double multDiscLMsSum[SimContext::NUM_DISCOUNT_RATES];
+		FixedPointSum multDiscLMsSum[SimContext::NUM_DISCOUNT_RATES];
 		/** The sum square LMs per Person using multiple discount rates*/
-		double multDiscLMsSumSquares[SimContext::NUM_DISCOUNT_RATES];
+		FixedPointSum multDiscLMsSumSquares[SimContext::NUM_DISCOUNT_RATES];
 		/** The standard deviation of the LMs per person using multiple discount rates*/
 		double multDiscLMsStdDev[SimContext::NUM_DISCOUNT_RATES];
 		/** The average QALMs per Person using multiple discount rates*/
 		double multDiscQALMsAverage[SimContext::NUM_DISCOUNT_RATES];
 		/** The total QALMs per Person using multiple discount rates*/
-		double multDiscQALMsSum[SimContext::NUM_DISCOUNT_RATES];
+		FixedPointSum multDiscQALMsSum[SimContext::NUM_DISCOUNT_RATES];
 		/** The sum square QALMs per Person using multiple discount rates*/
-		double multDiscQALMsSumSquares[SimContext::NUM_DISCOUNT_RATES];
+		FixedPointSum multDiscQALMsSumSquares[SimContext::NUM_DISCOUNT_RATES];
 		/** The standard deviation of the QALMs per person using multiple discount rates*/
 		double multDiscQALMsStdDev[SimContext::NUM_DISCOUNT_RATES];
 
@@ -157,28 +157,28 @@ public:
 		/** The number of ART failures stratified by ART line */
 		int numFailART[SimContext::ART_NUM_LINES+1];
 		/** The total costs stratified by most recent ART line failed */
-		double costsFailARTSum[SimContext::ART_NUM_LINES+1];
+		FixedPointSum costsFailARTSum[SimContext::ART_NUM_LINES+1];
 		/** The average cost per person stratified by most recent ART line failed */
 		double costsFailARTAverage[SimContext::ART_NUM_LINES+1];
 		/** The total life months lived stratified by most recent ART line failed */
-		double LMsFailARTSum[SimContext::ART_NUM_LINES+1];
+		FixedPointSum LMsFailARTSum[SimContext::ART_NUM_LINES+1];
 		/** The average life months lived per person stratified by most recent ART line failed */
 		double LMsFailARTAverage[SimContext::ART_NUM_LINES+1];
 		/** The total quality adjusted life months lived stratified by most recent ART line failed */
-		double QALMsFailARTSum[SimContext::ART_NUM_LINES+1];
+		FixedPointSum QALMsFailARTSum[SimContext::ART_NUM_LINES+1];
 		/** The average quality adjusted life months lived per person stratified by most recent ART line failed */
 		double QALMsFailARTAverage[SimContext::ART_NUM_LINES+1];
 		// Overall statistics for HIV positive only
 		/** The total costs accrued for HIV positive persons */
-		double costsHIVPositiveSum;
+		FixedPointSum costsHIVPositiveSum;
 		/** The average costs per person accrued for HIV positive persons */
 		double costsHIVPositiveAverage;
 		/** The total life months lived by HIV positive Persons*/
-		double LMsHIVPositiveSum;
+		FixedPointSum LMsHIVPositiveSum;
 		/** The average life months per person lived by HIV positive Persons*/
 		double LMsHIVPositiveAverage;
 		/** The total quality adjusted life months lived by HIV positive Persons */
-		double QALMsHIVPositiveSum;
+		FixedPointSum QALMsHIVPositiveSum;
 		/** The average quality adjusted life months per person lived by HIV positive Persons */
 		double QALMsHIVPositiveAverage;
 	}; /* end PopulationSummary */
@@ -200,11 +200,11 @@ public:
 		/** The number of HIV-negative patients in this cohort who are never infected with HIV, stratified by whether they ever took PrEP */
 		int numNeverHIVPositive[SimContext::EVER_PREP_NUM];
 		/** The total life months lived by HIV-negative, never infected Persons, stratified by whether they ever took PrEP*/
-		double LMsHIVNegativeSum[SimContext::EVER_PREP_NUM];
+		FixedPointSum LMsHIVNegativeSum[SimContext::EVER_PREP_NUM];
 		/** The average life months per person lived by HIV-negative, never infected Persons, stratified by whether they ever took PrEP*/
 		double LMsHIVNegativeAverage[SimContext::EVER_PREP_NUM];
 		/** The total quality adjusted life months lived by HIV-negative, never infected Persons, stratified by whether they ever took PrEP*/
-		double QALMsHIVNegativeSum[SimContext::EVER_PREP_NUM];
+		FixedPointSum QALMsHIVNegativeSum[SimContext::EVER_PREP_NUM];
 		/** The average quality adjusted life months per person lived by HIV-negative, never infected Persons, stratified by whether they ever took PrEP*/
 		double QALMsHIVNegativeAverage[SimContext::EVER_PREP_NUM];
 		/** Total number of children whose mother is infected before model start but are themselves uninfected at model start, and total number of children who were ever HIV exposed uninfected after initiation (i.e. were breastfeeding and HIV negative at the time of maternal infection)  */
@@ -281,7 +281,7 @@ public:
 		/** Average CD4 count (prevalent cases) at time of detection */
 		double CD4AtDetectionPrevalentAverage;
 		/** Total CD4 count (prevalent cases) at time of detection stratified by HIV state at detection - absolute CD4 metric only */
-		double CD4AtDetectionPrevalentSumHIV[SimContext::HIV_POS_NUM];
+		FixedPointSum CD4AtDetectionPrevalentSumHIV[SimContext::HIV_POS_NUM];
 		/** Average CD4 count (prevalent cases) at time of detection stratified by HIV state at detection */
 		double CD4AtDetectionPrevalentAverageHIV[SimContext::HIV_POS_NUM];
 		/** Total CD4 count (incident cases) at time of detection */
@@ -289,7 +289,7 @@ public:
 		/** Average CD4 count (incident cases) at time of detection */
 		double CD4AtDetectionIncidentAverage;
 		/** Total CD4 count (incident cases) at time of detection stratified by HIV state at detection - absolute CD4 metric only */
-		double CD4AtDetectionIncidentSumHIV[SimContext::HIV_POS_NUM];
+		FixedPointSum CD4AtDetectionIncidentSumHIV[SimContext::HIV_POS_NUM];
 		/** Average CD4 count (incident cases) at time of detection stratified by HIV state at detection */
 		double CD4AtDetectionIncidentAverageHIV[SimContext::HIV_POS_NUM];
 		// average CD4 levels at the time of linkage,
@@ -299,83 +299,83 @@ public:
 		/** Average CD4 count at time of linkage*/
 		double CD4AtLinkageAverage;
 		/** Total CD4 count at time of linkage stratified by HIV state at linkage - absolute CD4 metric only*/
-		double CD4AtLinkageSumHIV[SimContext::HIV_POS_NUM];
+		FixedPointSum CD4AtLinkageSumHIV[SimContext::HIV_POS_NUM];
 		/** Average CD4 count at time of linkage stratified by HIV state at linkage */
 		double CD4AtLinkageAverageHIV[SimContext::HIV_POS_NUM];
 		// number of months until infection for incident cases
 		/** Total number of months until infection for incident cases */
-		double monthsToInfectionSum;
+		FixedPointSum monthsToInfectionSum;
 		/** Average number of months until infection for incident cases */
 		double monthsToInfectionAverage;
 		/** Sum of squares of the number of months until infection for incident cases (for calculating standard deviation) */
-		double monthsToInfectionSumSquares;
+		FixedPointSum monthsToInfectionSumSquares;
 		/** Standard deviation of months until infection for incident cases */
 		double monthsToInfectionStdDev;
 		// number of months after infection until detection for incident cases
 		/** Total number of months after infection until detection for incident cases */
-		double monthsAfterInfectionToDetectionSum;
+		FixedPointSum monthsAfterInfectionToDetectionSum;
 		/** Average number of months after infection until detection for incident cases */
 		double monthsAfterInfectionToDetectionAverage;
 		/** Sum of squares of the number of months after infection until detection for incident cases */
-		double monthsAfterInfectionToDetectionSumSquares;
+		FixedPointSum monthsAfterInfectionToDetectionSumSquares;
 		/** Standard deviation of the number of months after infection until detection for incident cases */
 		double monthsAfterInfectionToDetectionStdDev;
 		// number of months to detection for incident and prevalent cases
 		/** Total number of months to detection for prevalent cases */
-		double monthsToDetectionPrevalentSum;
+		FixedPointSum monthsToDetectionPrevalentSum;
 		/** Average number of months to detection for prevalent cases */
 		double monthsToDetectionPrevalentAverage;
 		/** Sum of squares of the number of months to detection for prevalent cases (for calculating standard deviation) */
-		double monthsToDetectionPrevalentSumSquares;
+		FixedPointSum monthsToDetectionPrevalentSumSquares;
 		/** Standard deviation of the number of months to detection for prevalent cases */
 		double monthsToDetectionPrevalentStdDev;
 		/** Total number of months to detection for incident cases from model start */
-		double monthsToDetectionIncidentSum;
+		FixedPointSum monthsToDetectionIncidentSum;
 		/** Average number of months to detection for incident cases from model start */
 		double monthsToDetectionIncidentAverage;
 		/** Sum of squares of the number of months to detection for incident cases from model start (for calculating standard deviation) */
-		double monthsToDetectionIncidentSumSquares;
+		FixedPointSum monthsToDetectionIncidentSumSquares;
 		/** Standard deviation of the number of months to detection for incident cases from model start */
 		double monthsToDetectionIncidentStdDev;
 		// number of months to linkage
 		/** Total number of months to linkage*/
-		double monthsToLinkageSum;
+		FixedPointSum monthsToLinkageSum;
 		/** Average number of months to linkage*/
 		double monthsToLinkageAverage;
 		/** Sum of squares of the number of months to linkage (for calculating standard deviation) */
-		double monthsToLinkageSumSquares;
+		FixedPointSum monthsToLinkageSumSquares;
 		/** Standard deviation of the number of months to linkage */
 		double monthsToLinkageStdDev;
 		// number of months to linkage stratified by means of detection
-		double monthsToLinkageSumMeans[SimContext::HIV_DET_NUM];
+		FixedPointSum monthsToLinkageSumMeans[SimContext::HIV_DET_NUM];
 		double monthsToLinkageAverageMeans[SimContext::HIV_DET_NUM];
-		double monthsToLinkageSumSquaresMeans[SimContext::HIV_DET_NUM];
+		FixedPointSum monthsToLinkageSumSquaresMeans[SimContext::HIV_DET_NUM];
 		double monthsToLinkageStdDevMeans[SimContext::HIV_DET_NUM];
 
 		// age months at time of detection for incident and prevalent cases
 		/** Total age months at time of detection for prevalent cases*/
-		double ageMonthsAtDetectionPrevalentSum;
+		FixedPointSum ageMonthsAtDetectionPrevalentSum;
 		/** Average age months at time of detection for prevalent cases*/
 		double ageMonthsAtDetectionPrevalentAverage;
 		/** Sum of squares of age months at time of detection for prevalent cases (for calculating standard deviation) */
-		double ageMonthsAtDetectionPrevalentSumSquares;
+		FixedPointSum ageMonthsAtDetectionPrevalentSumSquares;
 		/** Standard deviation of age months at time of detection for prevalent cases*/
 		double ageMonthsAtDetectionPrevalentStdDev;
 		/** Total age months at time of detection for incident cases*/
-		double ageMonthsAtDetectionIncidentSum;
+		FixedPointSum ageMonthsAtDetectionIncidentSum;
 		/** Average age months at time of detection for incident cases*/
 		double ageMonthsAtDetectionIncidentAverage;
 		/** Sum of squares of age months at time of detection for incident cases (for calculating standard deviation) */
-		double ageMonthsAtDetectionIncidentSumSquares;
+		FixedPointSum ageMonthsAtDetectionIncidentSumSquares;
 		/** Standard deviation of age months at time of detection for incident cases*/
 		double ageMonthsAtDetectionIncidentStdDev;
 		// age months at time of linkage
 		/** Total age months at time of linkage*/
-		double ageMonthsAtLinkageSum;
+		FixedPointSum ageMonthsAtLinkageSum;
 		/** Average age months at time of linkage*/
 		double ageMonthsAtLinkageAverage;
 		/** Sum of squares of age months at time of linkage (for calculating standard deviation) */
-		double ageMonthsAtLinkageSumSquares;
+		FixedPointSum ageMonthsAtLinkageSumSquares;
 		/** Standard deviation of age months at time of linkage*/
 		double ageMonthsAtLinkageStdDev;
 
@@ -478,8 +478,8 @@ public:
 		int numFalseNegativeEIDTestResultsTest[SimContext::EID_NUM_TESTS];
 
 		/** Number of months spent false positive*/
-		double LMsFalsePositive;
-		double LMsFalsePositiveLinked;
+		FixedPointSum LMsFalsePositive;
+		FixedPointSum LMsFalsePositiveLinked;
 	};
 
 	/** SurvivalStats holds total survival statistics, used with different survival
@@ -552,7 +552,7 @@ public:
 		int numPatientsHVLSetpointLevel[SimContext::HVL_NUM_STRATA];
 		// Age and gender statistics
 		/** Total initial age (in months) - HIV+ only; if a patient starts HIV-negative their age at time of infection is added */
-		double sumInitialAgeMonths;
+		FixedPointSum sumInitialAgeMonths;
 		/** Average initial age in months - HIV+ only; if they start the model HIV-negative this is their age at the time of infection */
 		double averageInitialAgeMonths;
 		/** Total number of male patients */
@@ -731,9 +731,9 @@ public:
 		/** Number of background mortality deaths with OI history stratified by CD4 strata */
 		int numBackgroundMortDeathsOIHistoryCD4[SimContext::CD4_NUM_STRATA];
 		/** Sum of CD4's of all patients who died from art Tox*/
-		double ARTToxDeathsCD4Sum;
+		FixedPointSum ARTToxDeathsCD4Sum;
 		/** Sum of Squares of CD4's of all patients who died from Tox*/
-		double ARTToxDeathsCD4SumSquares;
+		FixedPointSum ARTToxDeathsCD4SumSquares;
 		/** mean CD4 of all patients who died from art Tox*/
 		double ARTToxDeathsCD4Mean;
 		/** std dev CD4 of all patients who died from art Tox*/
@@ -750,53 +750,53 @@ public:
 		/** Total life months lived without OI history by HIV+ patients*/
 		double LMsNoOIHistory;
 		/** Total life months lived without OI history by HIV+ patients stratified by CD4 strata */
-		double LMsNoOIHistoryCD4[SimContext::CD4_NUM_STRATA];
+		FixedPointSum LMsNoOIHistoryCD4[SimContext::CD4_NUM_STRATA];
 		/** Total life months lived with OI history */
 		double LMsOIHistory;
 		/** Total life months lived with OI history stratified by CD4 strata */
-		double LMsOIHistoryCD4[SimContext::CD4_NUM_STRATA];
+		FixedPointSum LMsOIHistoryCD4[SimContext::CD4_NUM_STRATA];
 		/** Total life months lived by HIV+ patients*/
 		double LMsTotal;
 		/** Total life months lived stratified by CD4 strata */
 		double LMsTotalCD4[SimContext::CD4_NUM_STRATA];
 		// life months stratified by HVL and HVL setpoint
 		/** Total life months lived stratified by HVL strata */
-		double LMsHVL[SimContext::HVL_NUM_STRATA];
+		FixedPointSum LMsHVL[SimContext::HVL_NUM_STRATA];
 		/** Total life months lived stratified by setpoint HVL strata */
-		double LMsHVLSetpoint[SimContext::HVL_NUM_STRATA];
+		FixedPointSum LMsHVLSetpoint[SimContext::HVL_NUM_STRATA];
 		// life months with and without OI history, stratified by OI type
 		/** Total life months lived without OI history stratified by OI type */
-		double LMsNoOIHistoryOIs[SimContext::OI_NUM];
+		FixedPointSum LMsNoOIHistoryOIs[SimContext::OI_NUM];
 		/** Total life months lived with OI history stratified by OI type */
-		double LMsOIHistoryOIs[SimContext::OI_NUM];
+		FixedPointSum LMsOIHistoryOIs[SimContext::OI_NUM];
 		/** Total life months lived with CHRM History for HIV+ patients stratified by CHRM type */
-		double LMsCHRMHistoryCHRMsHIVPos[SimContext::CHRM_NUM];
+		FixedPointSum LMsCHRMHistoryCHRMsHIVPos[SimContext::CHRM_NUM];
 		/** Total life months lived with CHRM History for HIV- patients stratified by CHRM type */
-		double LMsCHRMHistoryCHRMsHIVNeg[SimContext::CHRM_NUM];
+		FixedPointSum LMsCHRMHistoryCHRMsHIVNeg[SimContext::CHRM_NUM];
 		// life months stratified by HIV state and HIV positive total
 		/** Total life months lived with HIV */
 		double LMsHIVPositive;
 		/** Total life months lived in each HIV state */
-		double LMsHIVState[SimContext::HIV_ID_NUM];
+		FixedPointSum LMsHIVState[SimContext::HIV_ID_NUM];
 		/** Total quality adjusted life months lived with HIV */
 		double QALMsHIVPositive;
 		/** Total quality adjusted life months lived in each HIV state */
-		double QALMsHIVState[SimContext::HIV_ID_NUM];
+		FixedPointSum QALMsHIVState[SimContext::HIV_ID_NUM];
 		// life months in screening state and regular model
 		/** Total life months lived in the screening state */
-		double LMsInScreening;
+		FixedPointSum LMsInScreening;
 		/** Total quality adjusted life months lived in the screening state */
-		double QALMsInScreening;
+		FixedPointSum QALMsInScreening;
 		// Total life months lived by HIV-negative patients on PrEP
-		double LMsHIVNegativeOnPrEP;
+		FixedPointSum LMsHIVNegativeOnPrEP;
 		/** Total life months lived in "regular CEPAC" (i.e. non-screening state) */
-		double LMsInRegularCEPAC;
+		FixedPointSum LMsInRegularCEPAC;
 		
 		// life months by gender
 		/** Total life months lived stratified by gender */
-		double LMsGender[SimContext::GENDER_NUM];
+		FixedPointSum LMsGender[SimContext::GENDER_NUM];
 		/** Total quality adjusted life months lived stratified by gender */
-		double QALMsGender[SimContext::GENDER_NUM];
+		FixedPointSum QALMsGender[SimContext::GENDER_NUM];
 	}; /* end OverallSurvival */
 
 	/** OverallCosts class contains aggregate cost stats */
@@ -807,125 +807,125 @@ public:
 		/** Total costs accrued without OI history */
 		double costsNoOIHistory;
 		/** Total costs accrued without OI history stratified by CD4 */
-		double costsNoOIHistoryCD4[SimContext::CD4_NUM_STRATA];
+		FixedPointSum costsNoOIHistoryCD4[SimContext::CD4_NUM_STRATA];
 		/** Total costs accrued with OI history */
 		double costsOIHistory;
 		/** Total costs accrued with OI history stratified by CD4 */
-		double costsOIHistoryCD4[SimContext::CD4_NUM_STRATA];
+		FixedPointSum costsOIHistoryCD4[SimContext::CD4_NUM_STRATA];
 		/** Total costs accrued */
 		double costsTotal;
 		/** Total costs accrued stratified by CD4 */
-		double costsTotalCD4[SimContext::CD4_NUM_STRATA];
+		FixedPointSum costsTotalCD4[SimContext::CD4_NUM_STRATA];
 		// costs stratified by HVL and HVL setpoint
 		/** Total costs accrued stratified by HVL */
-		double costsHVL[SimContext::HVL_NUM_STRATA];
+		FixedPointSum costsHVL[SimContext::HVL_NUM_STRATA];
 		/** Total costs accrued stratified by HVL setpoint */
-		double costsHVLSetpoint[SimContext::HVL_NUM_STRATA];
+		FixedPointSum costsHVLSetpoint[SimContext::HVL_NUM_STRATA];
 		// direct medical costs for prophylaxis, stratified by total, OI, and OI x proph line
 		/** Total direct medical costs for prophylaxis */
 		double directCostsProph;
 		/** Direct medical costs for prophylaxis stratified by OI type */
 		double directCostsProphOIs[SimContext::OI_NUM];
 		/** Direct medical costs for prophylaxis stratified by OI type and prophylaxis line */
-		double directCostsProphOIsProph[SimContext::OI_NUM][SimContext::PROPH_NUM];
+		FixedPointSum directCostsProphOIsProph[SimContext::OI_NUM][SimContext::PROPH_NUM];
 		// direct costs for ART, stratified by total and ART line
 		/** Direct costs for ART */
-		double directCostsART;
+		FixedPointSum directCostsART;
 		/** Direct costs for ART stratified by ART line*/
-		double directCostsARTLine[SimContext::ART_NUM_LINES];
+		FixedPointSum directCostsARTLine[SimContext::ART_NUM_LINES];
 		/** Direct costs for ART if using mult discount rates*/
 		double directCostsARTMultDisc[SimContext::NUM_DISCOUNT_RATES];
-		double directCostsARTLineMultDisc[SimContext::ART_NUM_LINES][SimContext::NUM_DISCOUNT_RATES];
+		FixedPointSum directCostsARTLineMultDisc[SimContext::ART_NUM_LINES][SimContext::NUM_DISCOUNT_RATES];
 		/**Costs for initiating a line of art*/
 		double costsARTInit;
 		/**Costs for initiating a line of art by art line*/
-		double costsARTInitLine[SimContext::ART_NUM_LINES];
+		FixedPointSum costsARTInitLine[SimContext::ART_NUM_LINES];
 		/**Monthly costs of art*/
 		double costsARTMonthly;
 		/**Monthly costs of art by art line*/
-		double costsARTMonthlyLine[SimContext::ART_NUM_LINES];
+		FixedPointSum costsARTMonthlyLine[SimContext::ART_NUM_LINES];
 		/** monthly and init costs for art if using  multiple discount rates*/
 		double costsARTInitMultDisc[SimContext::NUM_DISCOUNT_RATES];
-		double costsARTInitLineMultDisc[SimContext::ART_NUM_LINES][SimContext::NUM_DISCOUNT_RATES];
+		FixedPointSum costsARTInitLineMultDisc[SimContext::ART_NUM_LINES][SimContext::NUM_DISCOUNT_RATES];
 		double costsARTMonthlyMultDisc[SimContext::NUM_DISCOUNT_RATES];
-		double costsARTMonthlyLineMultDisc[SimContext::ART_NUM_LINES][SimContext::NUM_DISCOUNT_RATES];
+		FixedPointSum costsARTMonthlyLineMultDisc[SimContext::ART_NUM_LINES][SimContext::NUM_DISCOUNT_RATES];
 
 		// costs stratified by HIV states and total for HIV positives
 		/** Total costs for HIV positive patients */
 		double costsHIVPositive;
 		/** Total costs stratified by HIV states */
-		double costsHIVState[SimContext::HIV_ID_NUM];
+		FixedPointSum costsHIVState[SimContext::HIV_ID_NUM];
 		// costs for various screening and testing
 		/** Total costs for CD4 tests */
-		double costsCD4Testing;
+		FixedPointSum costsCD4Testing;
 		/** Total costs for HVL tests */
-		double costsHVLTesting;
+		FixedPointSum costsHVLTesting;
 		/** costs of cd4 and hvl testing for multiple discount rates*/
-		double costsCD4TestingMultDisc[SimContext::NUM_DISCOUNT_RATES];
-		double costsHVLTestingMultDisc[SimContext::NUM_DISCOUNT_RATES];
+		FixedPointSum costsCD4TestingMultDisc[SimContext::NUM_DISCOUNT_RATES];
+		FixedPointSum costsHVLTestingMultDisc[SimContext::NUM_DISCOUNT_RATES];
 
 		/** Total TB costs (Discounted)*/
-		double costsTBTotal;
+		FixedPointSum costsTBTotal;
 		/** Costs of TB tests */
-		double costsTBTests;
-		double costsTBTestsInit[SimContext::TB_NUM_TESTS];
-		double costsTBTestsDST[SimContext::TB_NUM_TESTS];
+		FixedPointSum costsTBTests;
+		FixedPointSum costsTBTestsInit[SimContext::TB_NUM_TESTS];
+		FixedPointSum costsTBTestsDST[SimContext::TB_NUM_TESTS];
 		/** costs of TB treatment */
-		double costsTBTreatment;
-		double costsTBTreatmentByLine[SimContext::TB_NUM_TREATMENTS];
-		double costsTBTreatmentToxByLine[SimContext::TB_NUM_TREATMENTS];
+		FixedPointSum costsTBTreatment;
+		FixedPointSum costsTBTreatmentByLine[SimContext::TB_NUM_TREATMENTS];
+		FixedPointSum costsTBTreatmentToxByLine[SimContext::TB_NUM_TREATMENTS];
 		/** TB Visit Costs */
-		double costsTBProviderVisits[SimContext::COST_NUM_TYPES];
-		double costsTBMedicationVisits[SimContext::COST_NUM_TYPES];
+		FixedPointSum costsTBProviderVisits[SimContext::COST_NUM_TYPES];
+		FixedPointSum costsTBMedicationVisits[SimContext::COST_NUM_TYPES];
 
 		/** Total costs for clinic visits */
-		double costsClinicVisits;
+		FixedPointSum costsClinicVisits;
 		/** Total PrEP costs */
-		double costsPrEP;
+		FixedPointSum costsPrEP;
 		/** Total PrEP costs for those never infected with HIV */
-		double costsPrEPNeverHIV;
+		FixedPointSum costsPrEPNeverHIV;
 		/** Total PrEP costs for those who have had PrEP but get HIV by PrEP status*/
-		double costsPrEPHIVPos[SimContext::HIV_POS_PREP_STATES_NUM-1];
+		FixedPointSum costsPrEPHIVPos[SimContext::HIV_POS_PREP_STATES_NUM-1];
 		/** Total costs for HIV screening tests */
-		double costsHIVScreeningTests;
+		FixedPointSum costsHIVScreeningTests;
 		/** Total costs for HIV screening miscellaneous costs */
-		double costsHIVScreeningMisc;
+		FixedPointSum costsHIVScreeningMisc;
 		/** Total Costs for Lab Staging tests */
-		double costsLabStagingTests;
+		FixedPointSum costsLabStagingTests;
 		/** Total Costs for EID tests */
-		double costsEIDTests;
+		FixedPointSum costsEIDTests;
 		/** Total costs for Lab Staging misc costs*/
-		double costsLabStagingMisc;
+		FixedPointSum costsLabStagingMisc;
 		/** Total Costs for EID misc costs */
-		double costsEIDMisc;
+		FixedPointSum costsEIDMisc;
 		/** Total costs for EID visits */
-		double costsEIDVisits;
+		FixedPointSum costsEIDVisits;
 		/** Total costs for Infant HIV Proph */
-		double costsInfantHIVProph;
+		FixedPointSum costsInfantHIVProph;
 		// undiscounted costs stratified by cost type and unclassified costs
 		/** Total undiscounted costs stratified by cost type */
-		double totalUndiscountedCosts[SimContext::COST_NUM_TYPES];
+		FixedPointSum totalUndiscountedCosts[SimContext::COST_NUM_TYPES];
 		/** Total undiscounted unclassified costs */
 		double totalUndiscountedCostsUnclassified;
 		// discounted costs stratified by cost type and unclassified costs
 		/** Total discounted costs stratified by cost type */
-		double totalDiscountedCosts[SimContext::COST_NUM_TYPES];
+		FixedPointSum totalDiscountedCosts[SimContext::COST_NUM_TYPES];
 		/** Total discounted unclassified costs */
 		double totalDiscountedCostsUnclassified;
 		// costs for drugs and toxicities
 		/** Costs due to drugs */
-		double costsDrugs;
-		double costsDrugsDiscounted;
+		FixedPointSum costsDrugs;
+		FixedPointSum costsDrugsDiscounted;
 		/**costs due to adherence interventions*/
-		double costsInterventionStartup;
-		double costsInterventionMonthly;
+		FixedPointSum costsInterventionStartup;
+		FixedPointSum costsInterventionMonthly;
 		/** Costs due to toxicity*/
-		double costsToxicity;
-		double costsToxicityDiscounted;
+		FixedPointSum costsToxicity;
+		FixedPointSum costsToxicityDiscounted;
 		/** Costs due to CHRMs*/
-		double costsCHRMs[SimContext::CHRM_NUM];
+		FixedPointSum costsCHRMs[SimContext::CHRM_NUM];
 		/** Total costs stratified by gender */
-		double costsGender[SimContext::GENDER_NUM];
+		FixedPointSum costsGender[SimContext::GENDER_NUM];
 
 	}; /* end OverallCosts */
 
@@ -1010,11 +1010,11 @@ public:
 		int numDeathsWhileLostCD4[SimContext::CD4_NUM_STRATA];
 		// time lost before returning to care
 		/** Total time lost before returning to care */
-		double monthsLostBeforeReturnSum;
+		FixedPointSum monthsLostBeforeReturnSum;
 		/** Average time lost before returning to care per patient*/
 		double monthsLostBeforeReturnMean;
 		/** Sum of squares of total time lost before returning to care (for calculating standard deviation) */
-		double monthsLostBeforeReturnSumSquares;
+		FixedPointSum monthsLostBeforeReturnSumSquares;
 		/** Standard deviation of time lost before returning to care per patient*/
 		double monthsLostBeforeReturnStdDev;
 		// number lost to follow up during ART line or pre/post ART
@@ -1057,11 +1057,11 @@ public:
 		// average true CD4, observed CD4, and times prophylaxis initiated for primary and
 		//	secondary OIs, stratified by OI type x proph line
 		/** Total true CD4 initiated for primary and secondary OIs, stratified by OI type and proph line*/
-		double trueCD4InitProphSum[SimContext::PROPH_NUM_TYPES][SimContext::OI_NUM][SimContext::PROPH_NUM];
+		FixedPointSum trueCD4InitProphSum[SimContext::PROPH_NUM_TYPES][SimContext::OI_NUM][SimContext::PROPH_NUM];
 		/** Average true CD4 initiated for primary and secondary OIs, stratified by OI type and proph line*/
 		double trueCD4InitProphMean[SimContext::PROPH_NUM_TYPES][SimContext::OI_NUM][SimContext::PROPH_NUM];
 		/** Total observed CD4 initiated for primary and secondary OIs, stratified by OI type and proph line*/
-		double observedCD4InitProphSum[SimContext::PROPH_NUM_TYPES][SimContext::OI_NUM][SimContext::PROPH_NUM];
+		FixedPointSum observedCD4InitProphSum[SimContext::PROPH_NUM_TYPES][SimContext::OI_NUM][SimContext::PROPH_NUM];
 		/** Average observed CD4 initiated for primary and secondary OIs, stratified by OI type and proph line*/
 		double observedCD4InitProphMean[SimContext::PROPH_NUM_TYPES][SimContext::OI_NUM][SimContext::PROPH_NUM];
 		/** Total number of times primary and secondary prophylaxis was started, stratified by OI type and proph line*/
@@ -1094,23 +1094,23 @@ public:
 		/** Total number with absolute CD4 metric initiating ART stratified by ART line, and response type - currently unused output, should be double checked before use; may need to add another output to accommodate Peds < 5 and CD4 percent metric */
 		int numOnARTAtInitResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
 		/** Total true CD4 counts at ART initialization stratified by ART line and CD4 metric */
-		double trueCD4AtInitSum[SimContext::ART_NUM_LINES][SimContext::PEDS_CD4_AGE_CAT_NUM];
+		FixedPointSum trueCD4AtInitSum[SimContext::ART_NUM_LINES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Average true CD4 counts at ART initialization stratified by ART line and CD4 metric */
 		double trueCD4AtInitMean[SimContext::ART_NUM_LINES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Total true CD4 counts at ART initialization stratified by ART line,hetergeneity outcomes, and response type */
-		double trueCD4AtInitSumResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
+		FixedPointSum trueCD4AtInitSumResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
 		/** Average true CD4 counts at ART initialization stratified by ART line and response type - currently unused output, should be double checked before use*/
 		double trueCD4AtInitMeanResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
 		/** Total number initiating ART with observed CD4 (Absolute CD4 metric only) stratified by ART line, and response type - currently unused output, should be double checked before use */
 		int numWithObservedCD4AtInitResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
 		/** Total observed CD4 counts at ART initialization stratified by ART line */
-		double observedCD4AtInitSum[SimContext::ART_NUM_LINES];
+		FixedPointSum observedCD4AtInitSum[SimContext::ART_NUM_LINES];
 		/** Number of patients with observed CD4 (absolute CD4 metric) at ART initialization stratified by ART line */
 		int numWithObservedCD4AtInit[SimContext::ART_NUM_LINES];
 		/** Average observed CD4 counts at ART initialization stratified by ART line */
 		double observedCD4AtInitMean[SimContext::ART_NUM_LINES];
 		/** Total observed CD4 counts at ART initialization stratified by ART line and response type */
-		double observedCD4AtInitSumResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
+		FixedPointSum observedCD4AtInitSumResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
 		/** Average observed CD4 counts at ART initialization stratified by ART line and response type */
 		double observedCD4AtInitMeanResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
 		/** Histogram of ART efficacies drawn at ART initialization stratified by ART line and efficacy type */
@@ -1133,39 +1133,39 @@ public:
 		/** Number of ART true failure in those with absolute CD4 metric, stratified by ART line x response type */
 		int numTrueFailureResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
 		/** Total true CD4 at true failure stratified by ART line and CD4 metric*/
-		double trueCD4AtTrueFailureSum[SimContext::ART_NUM_LINES][SimContext::PEDS_CD4_AGE_CAT_NUM];
+		FixedPointSum trueCD4AtTrueFailureSum[SimContext::ART_NUM_LINES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Average true CD4 at true failure stratified by ART line and CD4 metric*/
 		double trueCD4AtTrueFailureMean[SimContext::ART_NUM_LINES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Total true CD4 (Absolute CD4 metric only) at true failure stratified by ART line x response type */
-		double trueCD4AtTrueFailureSumResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
+		FixedPointSum trueCD4AtTrueFailureSumResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
 		/** Average true CD4 at true failure stratified by ART line x response type */
 		double trueCD4AtTrueFailureMeanResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
 		/** Total observed CD4 at true failure stratified by ART line */
-		double observedCD4AtTrueFailureSum[SimContext::ART_NUM_LINES];
+		FixedPointSum observedCD4AtTrueFailureSum[SimContext::ART_NUM_LINES];
 		/** Number of patients with observed CD4 (Absolute Metric Only) at true failure stratified by ART line */
 		int numWithObservedCD4AtTrueFailure[SimContext::ART_NUM_LINES];
 		/** Average observed CD4 at true failure stratified by ART line */
 		double observedCD4AtTrueFailureMean[SimContext::ART_NUM_LINES];
 		/** Total observed CD4 at true failure stratified by ART line x response type */
-		double observedCD4AtTrueFailureSumResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
+		FixedPointSum observedCD4AtTrueFailureSumResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
 		/** Number of patients with observed CD4 (Absolute Metric Only) at true failure stratified by ART line x response type */
 		int numWithObservedCD4AtTrueFailureResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
 		/** Average observed CD4 at true failure stratified by ART line x response type */
 		double observedCD4AtTrueFailureMeanResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
 		/** Total months to true failure stratified by ART line */
-		double monthsToTrueFailureSum[SimContext::ART_NUM_LINES];
+		FixedPointSum monthsToTrueFailureSum[SimContext::ART_NUM_LINES];
 		/** Average months to true failure stratified by ART line */
 		double monthsToTrueFailureMean[SimContext::ART_NUM_LINES];
 		/** Total months to true failure stratified by ART line and response type */
-		double monthsToTrueFailureSumResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
+		FixedPointSum monthsToTrueFailureSumResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
 		/** Average months to true failure stratified by ART line and response type */
 		double monthsToTrueFailureMeanResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
 		/** Sum of squares of months to true failure stratified by ART line (used to calculate standard deviation) */
-		double monthsToTrueFailureSumSquares[SimContext::ART_NUM_LINES];
+		FixedPointSum monthsToTrueFailureSumSquares[SimContext::ART_NUM_LINES];
 		/** Standard deviation of months to true failure stratified by ART line */
 		double monthsToTrueFailureStdDev[SimContext::ART_NUM_LINES];
 		/** Sum of squares of months to true failure stratified by ART line and response type (used to calculate standard deviation) */
-		double monthsToTrueFailureSumSquaresResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
+		FixedPointSum monthsToTrueFailureSumSquaresResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
 		/** Standard deviation of months to true failure stratified by ART line and response type */
 		double monthsToTrueFailureStdDevResp[SimContext::ART_NUM_LINES][SimContext::HET_NUM_OUTCOMES][SimContext::RESP_NUM_TYPES];
 		// total number and true/observed CD4 at observed failure,
@@ -1189,7 +1189,7 @@ public:
 		/** Average true CD4 at observed failure stratified by ART line and CD4 metric */
 		double trueCD4AtObservedFailureMean[SimContext::ART_NUM_LINES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Total true CD4 at observed failure stratified by ART line, failure type and CD4 metric*/
-		double trueCD4AtObservedFailureSumType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_FAIL_TYPES][SimContext::PEDS_CD4_AGE_CAT_NUM];
+		FixedPointSum trueCD4AtObservedFailureSumType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_FAIL_TYPES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Average true CD4 at observed failure stratified by ART line, failure type and CD4 metric */
 		double trueCD4AtObservedFailureMeanType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_FAIL_TYPES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 
@@ -1202,7 +1202,7 @@ public:
 		/** Total number of patients with observed CD4 (Absolute CD4 metric only) at observed failure stratified by ART line and failure type */
 		int numObservedCD4atObservedFailureType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_FAIL_TYPES];
 		/** Total observed CD4 at observed failure stratified by ART line and failure type */
-		double observedCD4AtObservedFailureSumType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_FAIL_TYPES];
+		FixedPointSum observedCD4AtObservedFailureSumType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_FAIL_TYPES];
 		/** Average observed CD4 at observed failure stratified by ART line and failure type */
 		double observedCD4AtObservedFailureMeanType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_FAIL_TYPES];
 		// average and std dev of number of months between true failure and observed failure,
@@ -1212,7 +1212,7 @@ public:
 		/** Average months to observed failure stratified by ART line */
 		double monthsToObservedFailureMean[SimContext::ART_NUM_LINES];
 		/** Total months to observed failure stratified by ART line and failure type */
-		double monthsToObservedFailureSumType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_FAIL_TYPES];
+		FixedPointSum monthsToObservedFailureSumType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_FAIL_TYPES];
 		/** Average months to observed failure stratified by ART line and failure type */
 		double monthsToObservedFailureMeanType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_FAIL_TYPES];
 		/** Total sum of squares of months to observed failure stratified by ART line (used for calculating standard deviation) */
@@ -1220,7 +1220,7 @@ public:
 		/** Standard deviation of months to observed failure stratified by ART line */
 		double monthsToObservedFailureStdDev[SimContext::ART_NUM_LINES];
 		/** Total sum of squares of months to observed failure stratified by ART line and failure type (used for calculating standard deviation) */
-		double monthsToObservedFailureSumSquaresType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_FAIL_TYPES];
+		FixedPointSum monthsToObservedFailureSumSquaresType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_FAIL_TYPES];
 		/** Standard deviation of months to observed failure stratified by ART line and failure type */
 		double monthsToObservedFailureStdDevType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_FAIL_TYPES];
 		// number who stop ART and true/observed CD4, stratified by ART line and ART line x stop type
@@ -1243,7 +1243,7 @@ public:
 		/** Average true CD4 at ART stop, stratified by ART line and CD4 metric*/
 		double trueCD4AtStopMean[SimContext::ART_NUM_LINES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Total true CD4 at ART stop, stratified by ART line x stop type and CD4 metric*/
-		double trueCD4AtStopSumType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_STOP_TYPES][SimContext::PEDS_CD4_AGE_CAT_NUM];
+		FixedPointSum trueCD4AtStopSumType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_STOP_TYPES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Average true CD4 at ART stop, stratified by ART line x stop type and CD4 metric*/
 		double trueCD4AtStopMeanType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_STOP_TYPES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Total number with observed CD4 (Absolute CD4 metric only) at ART stop stratified by ART line*/
@@ -1255,7 +1255,7 @@ public:
 		/** Average observed CD4 at ART stop, stratified by ART line */
 		double observedCD4AtStopMean[SimContext::ART_NUM_LINES];
 		/** Total observed CD4 at ART stop, stratified by ART line x stop type*/
-		double observedCD4AtStopSumType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_STOP_TYPES];
+		FixedPointSum observedCD4AtStopSumType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_STOP_TYPES];
 		/** Average observed CD4 at ART stop, stratified by ART line x stop type*/
 		double observedCD4AtStopMeanType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_STOP_TYPES];
 		// months on art before stopping, stratified by ART line and ART line x stop type
@@ -1264,7 +1264,7 @@ public:
 		/** Average months on art before stopping, stratified by ART line */
 		double monthsToStopMean[SimContext::ART_NUM_LINES];
 		/** Total months on art before stopping, stratified by ART line x stop type */
-		double monthsToStopSumType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_STOP_TYPES];
+		FixedPointSum monthsToStopSumType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_STOP_TYPES];
 		/** Average months on art before stopping, stratified by ART line x stop type */
 		double monthsToStopMeanType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_STOP_TYPES];
 		/** Sum of squares of months on art before stopping, stratified by ART line (for calculating standard deviation) */
@@ -1272,7 +1272,7 @@ public:
 		/** Standard deviation of months on art before stopping, stratified by ART line */
 		double monthsToStopStdDev[SimContext::ART_NUM_LINES];
 		/** Sum of squares of months on art before stopping, stratified by ART line x stop type (for calculating standard deviation) */
-		double monthsToStopSumSquaresType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_STOP_TYPES];
+		FixedPointSum monthsToStopSumSquaresType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_STOP_TYPES];
 		/** Standard deviation of months on art before stopping, stratified by ART line x stop type */
 		double monthsToStopStdDevType[SimContext::ART_NUM_LINES][SimContext::ART_NUM_STOP_TYPES];
 		//number of deaths while on ART line
@@ -1281,17 +1281,17 @@ public:
 		/** num deaths on ART stratified by ART line and CD4 metric*/
 		int numARTDeathCD4Metric[SimContext::ART_NUM_LINES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Total true CD4 at death on ART, stratified by ART line and CD4 metric */
-		double trueCD4AtARTDeathSum[SimContext::ART_NUM_LINES][SimContext::PEDS_CD4_AGE_CAT_NUM];
+		FixedPointSum trueCD4AtARTDeathSum[SimContext::ART_NUM_LINES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Average true CD4 at death on ART, stratified by ART line and CD4 metric */
 		double trueCD4AtARTDeathMean[SimContext::ART_NUM_LINES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Total observed CD4 at death on ART, stratified by ART line */
-		double observedCD4AtARTDeathSum[SimContext::ART_NUM_LINES];
+		FixedPointSum observedCD4AtARTDeathSum[SimContext::ART_NUM_LINES];
 		/** Number of HIV+ patients with observed CD4 at death on ART, stratified by ART line */
 		int numWithObservedCD4AtARTDeath[SimContext::ART_NUM_LINES];
 		/** Average observed CD4 death on ART, stratified by ART line */
 		double observedCD4AtARTDeathMean[SimContext::ART_NUM_LINES];
 		/** Total propensity at death on ART, stratified by ART line */
-		double propensityAtARTDeathSum[SimContext::ART_NUM_LINES];
+		FixedPointSum propensityAtARTDeathSum[SimContext::ART_NUM_LINES];
 		/** Average propensity at death on ART, stratified by ART line */
 		double propensityAtARTDeathMean[SimContext::ART_NUM_LINES];
 		/** num deaths on ART*/
@@ -1299,17 +1299,17 @@ public:
 		/** num deaths on ART stratified by CD4 metric*/
 		int numARTDeathCauseCD4Metric[SimContext::ART_NUM_LINES][SimContext::DTH_NUM_CAUSES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Total true CD4 at death on ART, stratified by ART line, cause of death and CD4 metric */
-		double trueCD4AtARTDeathCauseSum[SimContext::ART_NUM_LINES][SimContext::DTH_NUM_CAUSES][SimContext::PEDS_CD4_AGE_CAT_NUM];
+		FixedPointSum trueCD4AtARTDeathCauseSum[SimContext::ART_NUM_LINES][SimContext::DTH_NUM_CAUSES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Average true CD4 at death on ART, stratified by ART line, cause of death and CD4 metric */
 		double trueCD4AtARTDeathCauseMean[SimContext::ART_NUM_LINES][SimContext::DTH_NUM_CAUSES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Total observed CD4 at death on ART, stratified by ART line and cause of death*/
-		double observedCD4AtARTDeathCauseSum[SimContext::ART_NUM_LINES][SimContext::DTH_NUM_CAUSES];
+		FixedPointSum observedCD4AtARTDeathCauseSum[SimContext::ART_NUM_LINES][SimContext::DTH_NUM_CAUSES];
 		/** Number of HIV+ patients with observed CD4 at death on ART, stratified by ART line and cause of death*/
 		int numWithObservedCD4AtARTDeathCause[SimContext::ART_NUM_LINES][SimContext::DTH_NUM_CAUSES];
 		/** Average observed CD4 death on ART, stratified by ART line and cause of death*/
 		double observedCD4AtARTDeathCauseMean[SimContext::ART_NUM_LINES][SimContext::DTH_NUM_CAUSES];
 		/** Total propensity at death on ART, stratified by ART line and cause of death*/
-		double propensityAtARTDeathCauseSum[SimContext::ART_NUM_LINES][SimContext::DTH_NUM_CAUSES];
+		FixedPointSum propensityAtARTDeathCauseSum[SimContext::ART_NUM_LINES][SimContext::DTH_NUM_CAUSES];
 		/** Average propensity at death on ART, stratified by ART line and cause of death*/
 		double propensityAtARTDeathCauseMean[SimContext::ART_NUM_LINES][SimContext::DTH_NUM_CAUSES];
 
@@ -1318,17 +1318,17 @@ public:
 		/** num OIs on ART stratified by ART line, OI type and CD4 metric*/
 		int numARTOICD4Metric[SimContext::ART_NUM_LINES][SimContext::OI_NUM][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Total true CD4 at OI on ART, stratified by ART line, OI and CD4 metric*/
-		double trueCD4AtARTOISum[SimContext::ART_NUM_LINES][SimContext::OI_NUM][SimContext::PEDS_CD4_AGE_CAT_NUM];
+		FixedPointSum trueCD4AtARTOISum[SimContext::ART_NUM_LINES][SimContext::OI_NUM][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Average true CD4 at OI on ART, stratified by ART line, OI and CD4 metric*/
 		double trueCD4AtARTOIMean[SimContext::ART_NUM_LINES][SimContext::OI_NUM][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Total observed CD4 at oi on ART, stratified by ART line and OI*/
-		double observedCD4AtARTOISum[SimContext::ART_NUM_LINES][SimContext::OI_NUM];
+		FixedPointSum observedCD4AtARTOISum[SimContext::ART_NUM_LINES][SimContext::OI_NUM];
 		/** Number of HIV+ patients with observed CD4 at OI on ART, stratified by ART line and OI type*/
 		int numWithObservedCD4AtARTOI[SimContext::ART_NUM_LINES][SimContext::OI_NUM];
 		/** Average observed CD4 oi on ART, stratified by ART line and OI*/
 		double observedCD4AtARTOIMean[SimContext::ART_NUM_LINES][SimContext::OI_NUM];
 		/** Total propensity at oi on ART, stratified by ART line and OI*/
-		double propensityAtARTOISum[SimContext::ART_NUM_LINES][SimContext::OI_NUM];
+		FixedPointSum propensityAtARTOISum[SimContext::ART_NUM_LINES][SimContext::OI_NUM];
 		/** Average propensity at oi on ART, stratified by ART line and OI*/
 		double propensityAtARTOIMean[SimContext::ART_NUM_LINES][SimContext::OI_NUM];
 
@@ -1337,17 +1337,17 @@ public:
 		/** num people who ever Ever Initiated each ART line stratified by CD4 measurement age category */
 		int numARTEverInitCD4Metric[SimContext::ART_NUM_LINES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Total true CD4 at ART EverInit first time regimen, stratified by ART line and CD4 metric*/
-		double trueCD4AtARTEverInitSum[SimContext::ART_NUM_LINES][SimContext::PEDS_CD4_AGE_CAT_NUM];
+		FixedPointSum trueCD4AtARTEverInitSum[SimContext::ART_NUM_LINES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Average true CD4 at EverInit first time regimen, stratified by ART line and CD4 metric */
 		double trueCD4AtARTEverInitMean[SimContext::ART_NUM_LINES][SimContext::PEDS_CD4_AGE_CAT_NUM];
 		/** Total observed CD4 at  EverInit first time regimen, stratified by ART line*/
-		double observedCD4AtARTEverInitSum[SimContext::ART_NUM_LINES];
+		FixedPointSum observedCD4AtARTEverInitSum[SimContext::ART_NUM_LINES];
 		/** Number of HIV+ patients with observed CD4 at EverInit first time regimen, stratified by ART line*/
 		int numWithObservedCD4AtARTEverInit[SimContext::ART_NUM_LINES];
 		/** Average observed CD4 EverInit first time regimen, stratified by ART line*/
 		double observedCD4AtARTEverInitMean[SimContext::ART_NUM_LINES];
 		/** Total propensity at EverInit first time regimen, stratified by ART line*/
-		double propensityAtARTEverInitSum[SimContext::ART_NUM_LINES];
+		FixedPointSum propensityAtARTEverInitSum[SimContext::ART_NUM_LINES];
 		/** Average propensity at EverInit first time regimen, stratified by ART line*/
 		double propensityAtARTEverInitMean[SimContext::ART_NUM_LINES];
 
@@ -1358,11 +1358,11 @@ public:
 		/** Number suppressed on ART stratified by ART line and month to record */
 		unsigned int numSuppressedAtMonth[SimContext::ART_NUM_LINES][SimContext::ART_NUM_MTHS_RECORD];
 		/** Total number of HVL drops stratified by ART line and month to record */
-		double HVLDropsAtMonthSum[SimContext::ART_NUM_LINES][SimContext::ART_NUM_MTHS_RECORD];
+		FixedPointSum HVLDropsAtMonthSum[SimContext::ART_NUM_LINES][SimContext::ART_NUM_MTHS_RECORD];
 		/** Average number of HVL drops stratified by ART line and month to record */
 		double HVLDropsAtMonthMean[SimContext::ART_NUM_LINES][SimContext::ART_NUM_MTHS_RECORD];
 		/** Sum of squares of HVL drops stratified by ART line and month to record (for calculating standard deviation) */
-		double HVLDropsAtMonthSumSquares[SimContext::ART_NUM_LINES][SimContext::ART_NUM_MTHS_RECORD];
+		FixedPointSum HVLDropsAtMonthSumSquares[SimContext::ART_NUM_LINES][SimContext::ART_NUM_MTHS_RECORD];
 		/** Standard deviation of HVL drops stratified by ART line and month to record */
 		double HVLDropsAtMonthStdDev[SimContext::ART_NUM_LINES][SimContext::ART_NUM_MTHS_RECORD];
 		/** Distribution at ART initiation, stratified by ART line x CD4 x HVL */
@@ -1387,7 +1387,7 @@ public:
 		/** Average number of STI interruptions stratified by ART line */
 		double numSTIInterruptionsMean[SimContext::ART_NUM_LINES];
 		/** Total duration of STI interruptions stratified by ART line */
-		double monthsOnSTIInterruptionSum[SimContext::ART_NUM_LINES];
+		FixedPointSum monthsOnSTIInterruptionSum[SimContext::ART_NUM_LINES];
 		/** Average duration of STI interruptions stratified by ART line */
 		double monthsOnSTIInterruptionMean[SimContext::ART_NUM_LINES];
 	}; /* end ARTStats */
@@ -1594,49 +1594,49 @@ public:
 		int numGenderOnART[SimContext::GENDER_NUM][SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
 		int numGenderPositive[SimContext::GENDER_NUM];
 		/** Sum of all QOL modifiers applied that month -- reported at Ben Linas's request, 2/3/2010 -- errhode */
-		double sumQOLModifiers;
+		FixedPointSum sumQOLModifiers;
 
 		/** Prop respond stratified by care state */
 		/** HIV-negative patients draw a baseline PTR logit value, but their PTR isn't used until they become HIV+ */
-		double propRespSum;
+		FixedPointSum propRespSum;
 		double propRespMean;
-		double propRespSumSquares;
+		FixedPointSum propRespSumSquares;
 		double propRespStdDev;
-		double propRespSumCare[SimContext::HIV_CARE_NUM];
+		FixedPointSum propRespSumCare[SimContext::HIV_CARE_NUM];
 		double propRespMeanCare[SimContext::HIV_CARE_NUM];
-		double propRespSumSquaresCare[SimContext::HIV_CARE_NUM];
+		FixedPointSum propRespSumSquaresCare[SimContext::HIV_CARE_NUM];
 		double propRespStdDevCare[SimContext::HIV_CARE_NUM];
-		double propRespSumInCareOffART;
-		double propRespSumOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
-		double propRespSumPositive;
+		FixedPointSum propRespSumInCareOffART;
+		FixedPointSum propRespSumOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
+		FixedPointSum propRespSumPositive;
 		double propRespMeanInCareOffART;
 		double propRespMeanOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
 		double propRespMeanPositive;
-		double propRespSumSquaresInCareOffART;
-		double propRespSumSquaresOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
-		double propRespSumSquaresPositive;
+		FixedPointSum propRespSumSquaresInCareOffART;
+		FixedPointSum propRespSumSquaresOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
+		FixedPointSum propRespSumSquaresPositive;
 		double propRespStdDevInCareOffART;
 		double propRespStdDevOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
 		double propRespStdDevPositive;
 
 		/** age stratified by care state */
-		double ageSum;
+		FixedPointSum ageSum;
 		double ageMean;
-		double ageSumSquares;
+		FixedPointSum ageSumSquares;
 		double ageStdDev;
-		double ageSumCare[SimContext::HIV_CARE_NUM];
+		FixedPointSum ageSumCare[SimContext::HIV_CARE_NUM];
 		double ageMeanCare[SimContext::HIV_CARE_NUM];
-		double ageSumSquaresCare[SimContext::HIV_CARE_NUM];
+		FixedPointSum ageSumSquaresCare[SimContext::HIV_CARE_NUM];
 		double ageStdDevCare[SimContext::HIV_CARE_NUM];
-		double ageSumInCareOffART;
-		double ageSumOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
-		double ageSumPositive;
+		FixedPointSum ageSumInCareOffART;
+		FixedPointSum ageSumOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
+		FixedPointSum ageSumPositive;
 		double ageMeanInCareOffART;
 		double ageMeanOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
 		double ageMeanPositive;
-		double ageSumSquaresInCareOffART;
-		double ageSumSquaresOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
-		double ageSumSquaresPositive;
+		FixedPointSum ageSumSquaresInCareOffART;
+		FixedPointSum ageSumSquaresOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
+		FixedPointSum ageSumSquaresPositive;
 		double ageStdDevInCareOffART;
 		double ageStdDevOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
 		double ageStdDevPositive;
@@ -1655,70 +1655,70 @@ public:
 
 		// true and observed CD4 and HVL
 		/** Total true CD4 for HIV+ patients Average true CD4 for HIV+ patients (Absolute CD4 metric only) this month */
-		double trueCD4Sum;
+		FixedPointSum trueCD4Sum;
 		/** Average true CD4 for HIV+ patients (Absolute CD4 metric only) this month */
 		double trueCD4Mean;
 		/** Total sum of squares of true CD4 for HIV+ patients this month */
-		double trueCD4SumSquares;
+		FixedPointSum trueCD4SumSquares;
 		/** Standard deviation of true CD4 for HIV+ patients this month */
 		double trueCD4StdDev;
 		/** True CD4 (Absolute CD4 metric only) stratified by care status - includes HIV- for inclusion in output tables with other inputs that do apply to HIV- patients but only HIV+ patients should be included in calculations since HIV- patients have no CD4 counts */
-		double trueCD4SumCare[SimContext::HIV_CARE_NUM];
+		FixedPointSum trueCD4SumCare[SimContext::HIV_CARE_NUM];
 		double trueCD4MeanCare[SimContext::HIV_CARE_NUM];
-		double trueCD4SumSquaresCare[SimContext::HIV_CARE_NUM];
+		FixedPointSum trueCD4SumSquaresCare[SimContext::HIV_CARE_NUM];
 		double trueCD4StdDevCare[SimContext::HIV_CARE_NUM];
-		double trueCD4SumInCareOffART;
-		double trueCD4SumOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
+		FixedPointSum trueCD4SumInCareOffART;
+		FixedPointSum trueCD4SumOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
 		double trueCD4MeanInCareOffART;
 		double trueCD4MeanOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
-		double trueCD4SumSquaresInCareOffART;
-		double trueCD4SumSquaresOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
+		FixedPointSum trueCD4SumSquaresInCareOffART;
+		FixedPointSum trueCD4SumSquaresOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
 		double trueCD4StdDevInCareOffART;
 		double trueCD4StdDevOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
 
 		/** Total observed CD4 in HIV+ patients with absolute CD4 counts this month */
-		double observedCD4Sum;
+		FixedPointSum observedCD4Sum;
 		/** Average observed CD4 in HIV+ patients with absolute CD4 counts this month */
 		double observedCD4Mean;
 		/** Total sum of squares of observed CD4 in HIV+ patients with absolute CD4 counts this month */
-		double observedCD4SumSquares;
+		FixedPointSum observedCD4SumSquares;
 		/** Standard deviation of observed CD4 in HIV+ patients with absolute CD4 counts this month */
 		double observedCD4StdDev;
 		/** observed CD4 stratified by care status - HIV- patients are included because the outputs go into tables that contain other inputs applicable to HIV- patients but only HIV+ patients have observed CD4 counts so HIV- patients should not be included in calculations */
-		double observedCD4SumCare[SimContext::HIV_CARE_NUM];
+		FixedPointSum observedCD4SumCare[SimContext::HIV_CARE_NUM];
 		double observedCD4MeanCare[SimContext::HIV_CARE_NUM];
-		double observedCD4SumSquaresCare[SimContext::HIV_CARE_NUM];
+		FixedPointSum observedCD4SumSquaresCare[SimContext::HIV_CARE_NUM];
 		double observedCD4StdDevCare[SimContext::HIV_CARE_NUM];
-		double observedCD4SumInCareOffART;
-		double observedCD4SumOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
+		FixedPointSum observedCD4SumInCareOffART;
+		FixedPointSum observedCD4SumOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
 		double observedCD4MeanInCareOffART;
 		double observedCD4MeanOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
-		double observedCD4SumSquaresInCareOffART;
-		double observedCD4SumSquaresOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
+		FixedPointSum observedCD4SumSquaresInCareOffART;
+		FixedPointSum observedCD4SumSquaresOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
 		double observedCD4StdDevInCareOffART;
 		double observedCD4StdDevOnART[SimContext::ART_NUM_LINES][SimContext::ART_EFF_NUM_TYPES];
 		/** Total true CD4 percentage (Peds early patients) this month */
-		double trueCD4PercentageSum;
+		FixedPointSum trueCD4PercentageSum;
 		/** Average true CD4 percentage (Peds early patients) this month */
 		double trueCD4PercentageMean;
 		/** Total sum of squares of true CD4 percentage (Peds early patients) this month */
-		double trueCD4PercentageSumSquares;
+		FixedPointSum trueCD4PercentageSumSquares;
 		/** Standard deviation of true CD4 percentage (Peds early patients) this month */
 		double trueCD4PercentageStdDev;
 		/** Total true HVL this month */
-		double trueHVLSum;
+		FixedPointSum trueHVLSum;
 		/** Average true HVL this month */
 		double trueHVLMean;
 		/** Total sum of squares of true HVL this month */
-		double trueHVLSumSquares;
+		FixedPointSum trueHVLSumSquares;
 		/** Standard deviation of true HVL this month */
 		double trueHVLStdDev;
 		/** Total observed HVL this month */
-		double observedHVLSum;
+		FixedPointSum observedHVLSum;
 		/** Average observed HVL this month */
 		double observedHVLMean;
 		/** Total sum of squares of observed HVL this month */
-		double observedHVLSumSquares;
+		FixedPointSum observedHVLSumSquares;
 		/** Standard deviation of observed HVL this month */
 		double observedHVLStdDev;
 		/** distribution of true CD4 stratified by ART state x CD4 */
@@ -1741,9 +1741,9 @@ public:
 		/** distribution of true CD4/HVL stratified by ART state x CD4 x HVL */
 		int trueCD4HVLARTDistribution[SimContext::ART_NUM_STATES][SimContext::CD4_NUM_STRATA][SimContext::HVL_NUM_STRATA];
 		/** number of transmissions per month calculated by community viral load */
-		double numTransmissions;
-		double numTransmissionsHVL[SimContext::HVL_NUM_STRATA];
-		double numTransmissionsRisk[SimContext::TRANSM_RISK_NUM];
+		FixedPointSum numTransmissions;
+		FixedPointSum numTransmissionsHVL[SimContext::HVL_NUM_STRATA];
+		FixedPointSum numTransmissionsRisk[SimContext::TRANSM_RISK_NUM];
 		/** number in each ART efficacy state */
 		int numARTEfficacyState[SimContext::ART_EFF_NUM_TYPES];
 		/** number with primary OIs, stratified by OI type */
@@ -1803,47 +1803,47 @@ public:
 		int numDeathsWithoutCHRMs;
 		// costs of various testing and total monthly cost
 		/** Monthly costs of CD4 testing */
-		double costsCD4Testing;
+		FixedPointSum costsCD4Testing;
 		/** Monthly costs of HVL testing */
-		double costsHVLTesting;
+		FixedPointSum costsHVLTesting;
 		/** Monthly costs of clinic visits */
-		double costsClinicVisits;
+		FixedPointSum costsClinicVisits;
 		/** Monthly costs for EID visits */
-		double costsEIDVisits;
+		FixedPointSum costsEIDVisits;
 		/** Monthly PrEP costs */
-		double costsPrEP;
+		FixedPointSum costsPrEP;
 		/** Monthly costs of HIV testing */
-		double costsHIVTests;
+		FixedPointSum costsHIVTests;
 		/** Monthly costs of miscellaneous HIV */
-		double costsHIVMisc;
+		FixedPointSum costsHIVMisc;
 		/** Monthly costs of Lab Staging Testing */
-		double costsLabStagingTests;
+		FixedPointSum costsLabStagingTests;
 		/** Monthly Costs for EID tests */
-		double costsEIDTests;
+		FixedPointSum costsEIDTests;
 		/** Monthly costs for Infant HIV Proph Administration */
-		double costsInfantHIVProphDirect;
+		FixedPointSum costsInfantHIVProphDirect;
 		/** Monthly costs for Infant HIV Proph Toxicity*/
-		double costsInfantHIVProphTox;
+		FixedPointSum costsInfantHIVProphTox;
 		/** Monthly costs of miscellaneous Lab Staging */
-		double costsLabStagingMisc;
+		FixedPointSum costsLabStagingMisc;
 		/** Monthly Costs for EID misc costs */
-		double costsEIDMisc;
+		FixedPointSum costsEIDMisc;
 		/**costs due to adherence interventions*/
-		double costsInterventionStartup;
-		double costsInterventionMonthly;
+		FixedPointSum costsInterventionStartup;
+		FixedPointSum costsInterventionMonthly;
 
 		/** Monthly costs total */
-		double totalMonthlyCohortCosts;
+		FixedPointSum totalMonthlyCohortCosts;
 		/** Monthly TB costs total */
-		double totalMonthlyTBCohortCosts;
+		FixedPointSum totalMonthlyTBCohortCosts;
 		/** Total discounted costs stratified by cost type */
-		double totalMonthlyCohortCostsType[SimContext::COST_NUM_TYPES];
+		FixedPointSum totalMonthlyCohortCostsType[SimContext::COST_NUM_TYPES];
 		/** costs of prophylaxis, stratified by OI type x proph line */
-		double costsProph[SimContext::OI_NUM][SimContext::PROPH_NUM];
+		FixedPointSum costsProph[SimContext::OI_NUM][SimContext::PROPH_NUM];
 		/** costs of ART, stratified by ART line */
-		double costsART[SimContext::ART_NUM_LINES];
+		FixedPointSum costsART[SimContext::ART_NUM_LINES];
 		/** costs of CHRMs, stratified by CHRM */
-		double costsCHRMs[SimContext::CHRM_NUM];
+		FixedPointSum costsCHRMs[SimContext::CHRM_NUM];
 		/** cumulative costs up to month */
 		double cumulativeCohortCosts;
 		double cumulativeCohortCostsType[SimContext::COST_NUM_TYPES];
@@ -1930,14 +1930,29 @@ public:
 	const LTFUStats *getLTFUStats();
 	const ProphStats *getProphStats();
 	const ARTStats *getARTStats();
+	const PatientSummary *getPatientSummary(unsigned int patientNum);
 	const TimeSummary *getTimeSummary(unsigned int timePeriod);
 	const OrphanStats * getOrphanStats(unsigned int timePeriod);
 
 	/* Functions to calculate final aggregate statistics and to write out the stats file */
 	void initRunStats(bool isDynamic);
+	void merge(const RunStats &other);
 	void finalizeStats();
 	void writeStatsFile();
 
+	/* Functions to write out the totals of a shard of the cohort to a partial statistics file and to read them back for merging */
+	void writePartialStatsFile(CostStats *costStats, int shardNum, int numShards);
+	void readPartialStatsFile(CostStats *costStats, int shardNum, int numShards);
+	/* Functions to save the totals of a whole cohort in a result cache entry and to restore them, see ResultCache */
+	void writeCachedStats(CostStats *costStats, FILE *file);
+	void readCachedStats(CostStats *costStats, FILE *file);
+	/** Version of the partial statistics file format, must be increased whenever the statistics subclasses change */
+	static const int PARTIAL_STATS_FORMAT_VERSION = 3;
+
+	/* Accessor functions for the patient number offset used when this object is a shard of a larger cohort */
+	void setPatientNumOffset(int offset);
+	int getPatientNumOffset();
+
 private:
 	/** Pointer to the associated simulation context */
 	SimContext *simContext;
@@ -1950,6 +1965,10 @@ private:
 	string orphanFileName;
 	/** Orphans output file pointer */
 	FILE *orphanFile;
+	/** Number of patients simulated before the first patient of this object, non-zero only for shards of a larger cohort */
+	int patientNumOffset;
+	/** True once finalizeStats has turned the totals into averages, after which no more shards may be merged */
+	bool isFinalized;
 
 	/** Statistics subclass object */
 	PopulationSummary popSummary;
@@ -2003,6 +2022,31 @@ private:
 	void initTimeSummary(TimeSummary *currTime, bool isDynamic = false);
 	void initOrphanStats(OrphanStats *currTime);
 
+	/* Functions to add the statistics of another RunStats object, called by merge */
+	void mergePopulationSummary(const RunStats &other);
+	void mergeHIVScreening(const RunStats &other);
+	void mergeInitialDistributions(const RunStats &other);
+	void mergeCHRMsStats(const RunStats &other);
+	void mergeOIStats(const RunStats &other);
+	void mergeDeathStats(const RunStats &other);
+	void mergeOverallSurvival(const RunStats &other);
+	void mergeOverallCosts(const RunStats &other);
+	void mergeTBStats(const RunStats &other);
+	void mergeLTFUStats(const RunStats &other);
+	void mergeProphStats(const RunStats &other);
+	void mergeARTStats(const RunStats &other);
+	void mergeTimeSummary(TimeSummary *currTime, const TimeSummary *otherTime);
+	void mergeOrphanStats(OrphanStats *currTime, const OrphanStats *otherTime);
+	void updateCumulativeTimeSummaries();
+
+	/* Functions to write and read the totals in a partial statistics file, called by writePartialStatsFile and readPartialStatsFile */
+	string getPartialStatsFileName(int shardNum, int numShards);
+	int getPartialStatsLayoutSize();
+	void writePartialStats(FILE *file);
+	void readPartialStats(FILE *file);
+	void writePartialPopulationSummary(FILE *file);
+	void readPartialPopulationSummary(FILE *file);
+
 	/* Functions to finalize aggregate statistics before printing out */
 	void finalizePopulationSummary();
 	void finalizeHIVScreening();
@@ -2103,6 +2147,24 @@ inline const RunStats::ARTStats *RunStats::getARTStats() {
 	return &artStats;
 }
 
+/** \brief setPatientNumOffset sets the number of patients simulated before the first patient of this object */
+inline void RunStats::setPatientNumOffset(int offset) {
+	patientNumOffset = offset;
+}
+
+/** \brief getPatientNumOffset returns the number of patients simulated before the first patient of this object */
+inline int RunStats::getPatientNumOffset() {
+	return patientNumOffset;
+}
+
+/** \brief getPatientSummary returns a const pointer to the PatientSummary of the given patient of this object,
+	returns null if there is no such patient */
+inline const RunStats::PatientSummary *RunStats::getPatientSummary(unsigned int patientNum) {
+	if (patientNum < patients.size())
+		return &patients[patientNum];
+	return NULL;
+}
+
 /** \brief getTimeSummary returns a const pointer to the specified TimeSummary object,
 	returns null if one does not exist for this time period */
 inline const RunStats::TimeSummary *RunStats::getTimeSummary(unsigned int timePeriod) {
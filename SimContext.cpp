@@ -1,33 +1,170 @@
 #include "include.h"
 
-/* Constructor takes run name as parameter */
-SimContext::SimContext(string runName) {
+/** Build of CEPAC that wrote a binary input cache: the compile time of this file, which is recompiled whenever the input classes change */
+const char *SimContext::INPUT_CACHE_BUILD_STAMP = __DATE__ " " __TIME__;
+/** Label on the first line of a scenario overlay file */
+const char *SimContext::OVERLAY_BASE_LABEL = "BaseInputFile";
+/** Base input files of the scenario overlay files, guarded by overlayBasesMutex */
+map<string, SimContext::OverlayBase> SimContext::overlayBases;
+mutex SimContext::overlayBasesMutex;
+
+/* Constructor takes run name as parameter, and the name of the .in or .ovl file if it is not the run name with .in */
+SimContext::SimContext(string runName, string inputFileName) {
 
 	counter=0;
-	inputFileName = runName;
-	inputFileName.append(".in");
-	runSpecsInputs.runName = runName;
+	numPatientsToTrace = MAX_NUM_TRACES;
+	runSeed = 0;
+	/* Clear the labels so that the bytes after their ends are the same for any run with the same inputs, as the result cache hashes them */
+	memset(RISK_FACT_STRS, 0, sizeof(RISK_FACT_STRS));
+	memset(OI_STRS, 0, sizeof(OI_STRS));
+	memset(DTH_CAUSES_STRS, 0, sizeof(DTH_CAUSES_STRS));
+	memset(CHRM_STRS, 0, sizeof(CHRM_STRS));
+	this->inputFileName = inputFileName;
+	if (inputFileName.empty()) {
+		this->inputFileName = runName;
+		this->inputFileName.append(CepacUtil::FILE_EXTENSION_FOR_INPUT);
+	}
+	for (int i = 0; i < NUM_INPUT_TABS; i++)
+		inputTabEnds[i] = -1;
+	runSpecsInputs = make_shared<RunSpecsInputs>();
+	outputInputs = make_shared<OutputInputs>();
+	cohortInputs = make_shared<CohortInputs>();
+	treatmentInputs = make_shared<TreatmentInputs>();
+	ltfuInputs = make_shared<LTFUInputs>();
+	heterogeneityInputs = make_shared<HeterogeneityInputs>();
+	stiInputs = make_shared<STIInputs>();
+	natHistInputs = make_shared<NatHistInputs>();
+	chrmsInputs = make_shared<CHRMsInputs>();
+	costInputs = make_shared<CostInputs>();
+	tbInputs = make_shared<TBInputs>();
+	qolInputs = make_shared<QOLInputs>();
+	testingInputs = make_shared<HIVTestInputs>();
+	pedsInputs = make_shared<PedsInputs>();
+	pedsCostInputs = make_shared<PedsCostInputs>();
+	eidInputs = make_shared<EIDInputs>();
+	adolescentInputs = make_shared<AdolescentInputs>();
+	runSpecsInputs->runName = runName;
 }
 
-/* Destructor cleans up the allocated memory for art and proph inputs */
+/* Destructor, the input blocks are freed once no SimContext shares them */
 SimContext::~SimContext(void) {
+}
+
+/* releaseAllocatedInputs releases the art and proph inputs and clears their pointers */
+void SimContext::releaseAllocatedInputs() {
+	for (int i = 0; i < ART_NUM_LINES; i++) {
+		artInputs[i].reset();
+		pedsARTInputs[i].reset();
+		adolescentARTInputs[i].reset();
+	}
+	for (int i = 0; i < PROPH_NUM_TYPES; i++) {
+		for (int j = 0; j < OI_NUM; j++) {
+			for (int k = 0; k < PROPH_NUM; k++) {
+				prophsInputs[i][j][k].reset();
+				pedsProphsInputs[i][j][k].reset();
+			}
+		}
+	}
+}
+
+/* shareInputs makes this SimContext use all the inputs of another SimContext, sharing its blocks of inputs rather than
+	copying them; either SimContext copies a block only when it changes it */
+void SimContext::shareInputs(const SimContext *source) {
+	memcpy(RISK_FACT_STRS, source->RISK_FACT_STRS, sizeof(RISK_FACT_STRS));
+	memcpy(OI_STRS, source->OI_STRS, sizeof(OI_STRS));
+	memcpy(DTH_CAUSES_STRS, source->DTH_CAUSES_STRS, sizeof(DTH_CAUSES_STRS));
+	memcpy(CHRM_STRS, source->CHRM_STRS, sizeof(CHRM_STRS));
+	numPatientsToTrace = source->numPatientsToTrace;
+	inputIssues = source->inputIssues;
+	runSpecsInputs = source->runSpecsInputs;
+	outputInputs = source->outputInputs;
+	cohortInputs = source->cohortInputs;
+	treatmentInputs = source->treatmentInputs;
+	ltfuInputs = source->ltfuInputs;
+	heterogeneityInputs = source->heterogeneityInputs;
+	stiInputs = source->stiInputs;
+	natHistInputs = source->natHistInputs;
+	chrmsInputs = source->chrmsInputs;
+	costInputs = source->costInputs;
+	tbInputs = source->tbInputs;
+	qolInputs = source->qolInputs;
+	testingInputs = source->testingInputs;
+	pedsInputs = source->pedsInputs;
+	pedsCostInputs = source->pedsCostInputs;
+	eidInputs = source->eidInputs;
+	adolescentInputs = source->adolescentInputs;
 	for (int i = 0; i < ART_NUM_LINES; i++) {
-		delete artInputs[i];
-		delete pedsARTInputs[i];
-		delete adolescentARTInputs[i];
+		artInputs[i] = source->artInputs[i];
+		pedsARTInputs[i] = source->pedsARTInputs[i];
+		adolescentARTInputs[i] = source->adolescentARTInputs[i];
 	}
 	for (int i = 0; i < PROPH_NUM_TYPES; i++) {
 		for (int j = 0; j < OI_NUM; j++) {
 			for (int k = 0; k < PROPH_NUM; k++) {
-				delete prophsInputs[i][j][k];
-				delete pedsProphsInputs[i][j][k];
+				prophsInputs[i][j][k] = source->prophsInputs[i][j][k];
+				pedsProphsInputs[i][j][k] = source->pedsProphsInputs[i][j][k];
 			}
 		}
 	}
 }
 
-/* Initialize the number of patients to trace*/
-int SimContext::numPatientsToTrace = MAX_NUM_TRACES;
+/* detachInputsOfTab gives this SimContext its own copy of the input classes the given tab of INPUT_TABS reads into,
+	and releases the art or proph inputs the tab allocates, before the tab is read again */
+void SimContext::detachInputsOfTab(int tabNum) {
+	void (SimContext::*readFunction)(InputReader *inputFile) = INPUT_TABS[tabNum].readFunction;
+	if (readFunction == &SimContext::readRunSpecsInputs)
+		detachInputs(runSpecsInputs);
+	else if (readFunction == &SimContext::readOutputInputs)
+		detachInputs(outputInputs);
+	else if (readFunction == &SimContext::readCohortInputs)
+		detachInputs(cohortInputs);
+	else if ((readFunction == &SimContext::readTreatmentInputsPart1) || (readFunction == &SimContext::readTreatmentInputsPart2))
+		detachInputs(treatmentInputs);
+	else if (readFunction == &SimContext::readLTFUInputs)
+		detachInputs(ltfuInputs);
+	else if (readFunction == &SimContext::readHeterogeneityInputs)
+		detachInputs(heterogeneityInputs);
+	else if (readFunction == &SimContext::readSTIInputs)
+		detachInputs(stiInputs);
+	else if (readFunction == &SimContext::readNatHistInputs)
+		detachInputs(natHistInputs);
+	else if (readFunction == &SimContext::readCHRMsInputs)
+		detachInputs(chrmsInputs);
+	else if (readFunction == &SimContext::readCostInputs)
+		detachInputs(costInputs);
+	else if (readFunction == &SimContext::readTBInputs)
+		detachInputs(tbInputs);
+	else if (readFunction == &SimContext::readQOLInputs)
+		detachInputs(qolInputs);
+	else if (readFunction == &SimContext::readHIVTestInputs)
+		detachInputs(testingInputs);
+	else if (readFunction == &SimContext::readPedsInputs)
+		detachInputs(pedsInputs);
+	else if (readFunction == &SimContext::readPedsCostInputs)
+		detachInputs(pedsCostInputs);
+	else if (readFunction == &SimContext::readEIDInputs)
+		detachInputs(eidInputs);
+	else if (readFunction == &SimContext::readAdolescentInputs)
+		detachInputs(adolescentInputs);
+	for (int i = 0; i < ART_NUM_LINES; i++) {
+		if (readFunction == &SimContext::readARTInputs)
+			artInputs[i].reset();
+		if (readFunction == &SimContext::readPedsARTInputs)
+			pedsARTInputs[i].reset();
+		if (readFunction == &SimContext::readAdolescentARTInputs)
+			adolescentARTInputs[i].reset();
+	}
+	for (int i = 0; i < PROPH_NUM_TYPES; i++) {
+		for (int j = 0; j < OI_NUM; j++) {
+			for (int k = 0; k < PROPH_NUM; k++) {
+				if (readFunction == &SimContext::readProphInputs)
+					prophsInputs[i][j][k].reset();
+				if (readFunction == &SimContext::readPedsProphInputs)
+					pedsProphsInputs[i][j][k].reset();
+			}
+		}
+	}
+}
 
 /* Initialize the constant character strings */
 const char *SimContext::CD4_STRATA_STRS[] = {
@@ -45,15 +182,9 @@ const char *SimContext::GENDER_STRS[] = {
 const char *SimContext::TRANSM_RISK_STRS[] = {
 	"MSM", "IDU", "Other"
 };
-char SimContext::OI_STRS[SimContext::OI_NUM][32];	// OI_STRS is set during readRunSpecsInputs
-char SimContext::DTH_CAUSES_STRS[SimContext::DTH_NUM_CAUSES][32]; 	// DTH_CAUSES_STRS is set during readRunSpecsInputs, readCHRMsInputs, and readCohortInputs
 const char *SimContext::HIST_OI_CATS_STRS[] = {
 	"NoOIHist", "MildOIHist", "SevrOIHist"
 };
-char SimContext::CHRM_STRS[SimContext::CHRM_NUM][32];	// CHRM_STRS is set during readCHRMsInputs
-
-char SimContext::RISK_FACT_STRS[SimContext::RISK_FACT_NUM][32];	// RISK_FACT_STRS is set during readCohortInputs
-
 const char *SimContext::CHRM_AGE_CAT_STRS[]={
 		"CHRMs Age Bucket 1","CHRMs Age Bucket 2","CHRMs Age Bucket 3","CHRMs Age Bucket 4","CHRMs Age Bucket 5","CHRMs Age Bucket 6","CHRMs Age Bucket 7"
 };
@@ -167,104 +298,896 @@ const char *SimContext::PEDS_CD4_PERC_STRS[] = {
 	"0-5perc", "5-10perc", "10-15perc", "15-20perc", "20-25perc", "25-30perc", "30-35perc", ">35perc"
 };
 
+/* The tabs of the input file in the order they are read.  A tab's stage is later than the stages of the tabs
+	whose inputs it uses: the Cohort and Treatment tabs and the STI inputs look up the OI names read with the
+	RunSpecs, the HIVTest, Peds and Adolescent tabs use the Cohort inputs and risk factor names, the cost tabs
+	look up every cause of death, including the CHRMs, and the EID, PedsProph, PedsART and PedsCost tabs use
+	whether the Peds model is enabled, as the AdolescentART tab does the Adolescent module, to skip the tab when
+	it is disabled.  Those five tabs are marked as having dependent tabs */
+const SimContext::InputTab SimContext::INPUT_TABS[] = {
+	{&SimContext::readRunSpecsInputs, "Runset", 0, true},
+	{&SimContext::readOutputInputs, "NumPatientsToTrace", 0, false},
+	{&SimContext::readCohortInputs, "InitCD4", 1, true},
+	{&SimContext::readLTFUInputs, "UseLTFU", 0, false},
+	{&SimContext::readHeterogeneityInputs, "PropRespBaseline", 0, false},
+	{&SimContext::readHIVTestInputs, "EnableHIVtest", 2, false},
+	{&SimContext::readNatHistInputs, "HIVDthRateRatio", 0, false},
+	{&SimContext::readCHRMsInputs, "CHRMstrs", 0, true},
+	{&SimContext::readQOLInputs, "QOLRoutine", 0, false},
+	{&SimContext::readCostInputs, "CostAgeBounds", 2, false},
+	{&SimContext::readTreatmentInputsPart1, "IntvlClinicVisit", 1, false},
+	{&SimContext::readARTInputs, "ART1Id", 0, false},
+	{&SimContext::readTreatmentInputsPart2, "EnableSTIforART", 1, false},
+	{&SimContext::readProphInputs, "OI1_PriProph1", 0, false},
+	{&SimContext::readSTIInputs, "STIstart_CD4", 1, false},
+	{&SimContext::readTBInputs, "EnableTB", 0, false},
+	{&SimContext::readPedsInputs, "EnablePeds", 2, true},
+	{&SimContext::readPedsProphInputs, "OI1_PriProph1Peds", 3, false},
+	{&SimContext::readPedsARTInputs, "ART1IdPeds", 3, false},
+	{&SimContext::readPedsCostInputs, "Peds1CostAcuteOI_noART_treated", 3, false},
+	{&SimContext::readEIDInputs, "EnableHIVtestEID", 3, false},
+	{&SimContext::readAdolescentInputs, "EnableAdolescent", 2, true},
+	{&SimContext::readAdolescentARTInputs, "ART1IdAYA", 3, false}
+};
+
 /* readInputs function reads in all the inputs from the given input file,
 	throws exception if there is an error */
 void SimContext::readInputs() {
-	/* Open the input file for reading */
+	/* Scenario overlay files are read on top of the inputs of their base input file */
 	CepacUtil::changeDirectoryToInputs();
-	inputFile = CepacUtil::openFile(inputFileName.c_str(), "r");
-	if (inputFile == NULL) {
+	size_t overlayLength = strlen(CepacUtil::FILE_EXTENSION_FOR_OVERLAY);
+	if ((inputFileName.size() > overlayLength) &&
+			(inputFileName.compare(inputFileName.size() - overlayLength, overlayLength, CepacUtil::FILE_EXTENSION_FOR_OVERLAY) == 0)) {
+		readOverlayInputs();
+		return;
+	}
+
+	/* Load the inputs from the binary input cache if it was written from this version of the input file */
+	unsigned long long inputFileHash = 0;
+	if (CepacUtil::useInputCache) {
+		inputFileHash = CepacUtil::getFileHash(inputFileName.c_str());
+		if ((inputFileHash != 0) && readInputCache(inputFileHash))
+			return;
+	}
+
+	/* Open the input file for reading */
+	InputReader *inputFile = new InputReader();
+	if (!inputFile->open(inputFileName.c_str())) {
+		delete inputFile;
 		string errorString = "   ERROR - Could not open input file ";
 		errorString.append(inputFileName);
 		throw errorString;
 	}
 
 	/* Read all the input data from the file */
-	readRunSpecsInputs();
-	readOutputInputs();
-	readCohortInputs();
-	readLTFUInputs();
-	readHeterogeneityInputs();
-	readHIVTestInputs();
-	readNatHistInputs();
-	readCHRMsInputs();
-	readQOLInputs();
-	readCostInputs();
-	readTreatmentInputsPart1();
-	readARTInputs();
-	readTreatmentInputsPart2();
-	readProphInputs();
-	readSTIInputs();
-	readTBInputs();
-	readPedsInputs();
-	readPedsProphInputs();
-	readPedsARTInputs();
-	readPedsCostInputs();
-	readEIDInputs();
-	readAdolescentInputs();
-	readAdolescentARTInputs();
+	try {
+		readInputTabs(inputFile);
+		recordInputIssues(inputFile, inputFileName);
+	}
+	catch (string &errorString) {
+		delete inputFile;
+		throw;
+	}
 
 	/* Close the input file */
-	CepacUtil::closeFile(inputFile);
+	delete inputFile;
+
+	/* Cache the inputs unless there were warnings or issues, which would not be repeated when the cache is loaded */
+	if (CepacUtil::useInputCache && (inputFileHash != 0) && (counter == 0) && inputIssues.empty())
+		writeInputCache(inputFileHash);
 } /* end readInputs */
 
+/* readInputTabs reads all the tabs of the input file, one after another unless they can be read in parallel,
+	and records where each tab ended */
+void SimContext::readInputTabs(InputReader *inputFile) {
+	if ((CepacUtil::numInputThreads > 1) && readInputTabsInParallel(inputFile))
+		return;
+	for (int i = 0; i < NUM_INPUT_TABS; i++) {
+		detachInputsOfTab(i);
+		(this->*INPUT_TABS[i].readFunction)(inputFile);
+		inputTabEnds[i] = inputFile->getPosition();
+	}
+} /* end readInputTabs */
+
+/* getInputFileName returns the name of the .in or .ovl file the inputs are read from */
+string SimContext::getInputFileName() {
+	return inputFileName;
+} /* end getInputFileName */
+
+/* getInputIssues returns the labels that were missing and the values that were not numbers when the inputs were read */
+const vector<SimContext::InputIssue> &SimContext::getInputIssues() {
+	return inputIssues;
+} /* end getInputIssues */
+
+/* readOverlayInputs reads a scenario overlay file: the inputs of its base input file, which is read once for all
+	the overlays on it, with the values after some of its labels replaced.  The first line of the overlay is
+	BaseInputFile and the name of the base input file, and each other line is a label followed by its new values,
+	which replace as many values after the label; label#n replaces the values after its nth occurrence.  Only the
+	tabs of the base file holding replaced values are read again, from the base file with the values replaced, so
+	the values go through the same reading and checks as a full input file.  Tabs of later stages are read again
+	too if they use the inputs of one of those tabs, and if a tab read again does not end where it did in the base
+	file, the whole base file with the values replaced is read instead */
+void SimContext::readOverlayInputs() {
+	/* Read the name of the base input file and the values to replace */
+	InputReader overlayFile;
+	if (!overlayFile.open(inputFileName.c_str())) {
+		string errorString = "   ERROR - Could not open overlay file ";
+		errorString.append(inputFileName);
+		throw errorString;
+	}
+	char buffer[InputReader::MAX_TOKEN_LENGTH + 1];
+	if ((overlayFile.scan("%512s", buffer) != 1) || (strcmp(buffer, OVERLAY_BASE_LABEL) != 0) ||
+			overlayFile.isAtLineEnd() || (overlayFile.scan("%512s", buffer) != 1)) {
+		string errorString = "   ERROR - Overlay file ";
+		errorString.append(inputFileName);
+		errorString.append(" does not start with ");
+		errorString.append(OVERLAY_BASE_LABEL);
+		errorString.append(" and the name of its base input file");
+		throw errorString;
+	}
+	string baseFileName = buffer;
+	vector<OverlayValue> overlayValues;
+	while (overlayFile.scan("%512s", buffer) == 1) {
+		OverlayValue overlayValue;
+		overlayValue.label = buffer;
+		overlayValue.occurrence = 1;
+		overlayValue.firstValue = 0;
+		size_t occurrenceStart = overlayValue.label.rfind('#');
+		if ((occurrenceStart != string::npos) && (occurrenceStart > 0)) {
+			overlayValue.occurrence = atoi(overlayValue.label.c_str() + occurrenceStart + 1);
+			overlayValue.label.erase(occurrenceStart);
+		}
+		while (!overlayFile.isAtLineEnd() && (overlayFile.scan("%512s", buffer) == 1))
+			overlayValue.values.push_back(buffer);
+		if (overlayValue.values.empty() || (overlayValue.occurrence < 1)) {
+			string errorString = "   ERROR - Overlay file ";
+			errorString.append(inputFileName);
+			errorString.append(" has no values or an invalid occurrence for label ");
+			errorString.append(overlayValue.label);
+			throw errorString;
+		}
+		overlayValues.push_back(overlayValue);
+	}
+	readOverlayValues(baseFileName, overlayValues);
+} /* end readOverlayInputs */
+
+/* readOverlayValues reads the inputs of a base input file with the given values replaced, as readOverlayInputs
+	describes; the base input file is read the first time it is used */
+void SimContext::readOverlayValues(string baseFileName, const vector<OverlayValue> &overlayValues) {
+	char buffer[InputReader::MAX_TOKEN_LENGTH + 1];
+	OverlayBase base = getOverlayBase(baseFileName);
+
+	/* Find the values to replace in the base input file, which must follow the label as the values read with it do */
+	vector<OverlayPatch> patches;
+	for (unsigned int i = 0; i < overlayValues.size(); i++) {
+		const OverlayValue &overlayValue = overlayValues[i];
+		long labelStart = -1;
+		for (int j = 0; (j < overlayValue.occurrence) && ((j == 0) || (labelStart >= 0)); j++)
+			labelStart = base.inputFile->findToken(overlayValue.label.c_str(), labelStart);
+		if (labelStart < 0) {
+			string errorString = "   ERROR - Label ";
+			errorString.append(overlayValue.label);
+			errorString.append(" of overlay file ");
+			errorString.append(inputFileName);
+			errorString.append(" is not in base input file ");
+			errorString.append(baseFileName);
+			throw errorString;
+		}
+		InputReader valueReader;
+		valueReader.openView(base.inputFile, labelStart + (long) overlayValue.label.size());
+		for (int j = -overlayValue.firstValue; j < (int) overlayValue.values.size(); j++) {
+			if (valueReader.scan("%512s", buffer) != 1) {
+				string errorString = "   ERROR - Overlay file ";
+				errorString.append(inputFileName);
+				errorString.append(" replaces more values after label ");
+				errorString.append(overlayValue.label);
+				errorString.append(" than there are in base input file ");
+				errorString.append(baseFileName);
+				throw errorString;
+			}
+			if (j < 0)
+				continue;
+			OverlayPatch patch;
+			patch.end = valueReader.getPosition();
+			patch.start = patch.end - (long) strlen(buffer);
+			patch.value = overlayValue.values[j];
+			patches.push_back(patch);
+		}
+	}
+	sort(patches.begin(), patches.end());
+	for (unsigned int i = 1; i < patches.size(); i++) {
+		if (patches[i].start < patches[i - 1].end) {
+			string errorString = "   ERROR - Overlay file ";
+			errorString.append(inputFileName);
+			errorString.append(" replaces the same value of the base input file more than once");
+			throw errorString;
+		}
+	}
+
+	/* Find the tabs holding the replaced values, and the tabs that use their inputs */
+	bool isTabToRead[NUM_INPUT_TABS];
+	for (int i = 0; i < NUM_INPUT_TABS; i++)
+		isTabToRead[i] = false;
+	for (unsigned int i = 0; i < patches.size(); i++) {
+		int tabNum = 0;
+		while ((tabNum < NUM_INPUT_TABS) && (patches[i].start >= base.simContext->inputTabEnds[tabNum]))
+			tabNum++;
+		if (tabNum == NUM_INPUT_TABS) {
+			string errorString = "   ERROR - Overlay file ";
+			errorString.append(inputFileName);
+			errorString.append(" replaces a value after the last input of base input file ");
+			errorString.append(baseFileName);
+			throw errorString;
+		}
+		isTabToRead[tabNum] = true;
+	}
+	for (int i = 0; i < NUM_INPUT_TABS; i++) {
+		if (isTabToRead[i] && INPUT_TABS[i].hasDependentTabs) {
+			for (int j = 0; j < NUM_INPUT_TABS; j++) {
+				if (INPUT_TABS[j].stage > INPUT_TABS[i].stage)
+					isTabToRead[j] = true;
+			}
+		}
+	}
+
+	/* Share the base inputs and read the tabs again from the base file with the values replaced, into copies of
+		the blocks of inputs they read into */
+	const char *baseContents = base.inputFile->getContents();
+	string contents;
+	long copiedLength = 0;
+	for (unsigned int i = 0; i < patches.size(); i++) {
+		contents.append(baseContents + copiedLength, patches[i].start - copiedLength);
+		contents.append(patches[i].value);
+		copiedLength = patches[i].end;
+	}
+	contents.append(baseContents + copiedLength, base.inputFile->getLength() - copiedLength);
+	InputReader *inputFile = new InputReader();
+	inputFile->openContents(&contents);
+
+	string runName = runSpecsInputs->runName;
+	shareInputs(base.simContext);
+	detachInputs(runSpecsInputs);
+	runSpecsInputs->runName = runName;
+	try {
+		bool isSameLayout = true;
+		for (int i = 0; (i < NUM_INPUT_TABS) && isSameLayout; i++) {
+			long tabStart = (i == 0) ? 0 : getOverlayOffset(base.simContext->inputTabEnds[i - 1], patches);
+			inputTabEnds[i] = getOverlayOffset(base.simContext->inputTabEnds[i], patches);
+			if (!isTabToRead[i])
+				continue;
+			detachInputsOfTab(i);
+			inputFile->setPosition(tabStart);
+			(this->*INPUT_TABS[i].readFunction)(inputFile);
+			if (inputFile->getPosition() != inputTabEnds[i])
+				isSameLayout = false;
+		}
+		if (!isSameLayout) {
+			inputFile->setPosition(0);
+			readInputTabs(inputFile);
+		}
+		recordInputIssues(inputFile, baseFileName);
+	}
+	catch (string &errorString) {
+		delete inputFile;
+		throw;
+	}
+	delete inputFile;
+} /* end readOverlayValues */
+
+/* getOverlayBase returns the base input file of scenario overlays with the given name and its inputs, reading it
+	the first time it is used; throws the error if the base input file cannot be read */
+SimContext::OverlayBase SimContext::getOverlayBase(string baseFileName) {
+	lock_guard<mutex> lock(overlayBasesMutex);
+	map<string, OverlayBase>::iterator existingBase = overlayBases.find(baseFileName);
+	if (existingBase != overlayBases.end())
+		return existingBase->second;
+
+	OverlayBase base;
+	base.inputFile = new InputReader();
+	if (!base.inputFile->open(baseFileName.c_str())) {
+		delete base.inputFile;
+		string errorString = "   ERROR - Could not open base input file ";
+		errorString.append(baseFileName);
+		throw errorString;
+	}
+	base.simContext = new SimContext(CepacUtil::getRunName(baseFileName), baseFileName);
+	try {
+		base.simContext->readInputTabs(base.inputFile);
+		base.simContext->recordInputIssues(base.inputFile, baseFileName);
+	}
+	catch (string &errorString) {
+		delete base.simContext;
+		delete base.inputFile;
+		throw;
+	}
+	overlayBases[baseFileName] = base;
+	return base;
+} /* end getOverlayBase */
+
+/* getOverlayOffset returns the offset in the base input file with the overlay's values replaced of a given offset
+	in the base input file, which is not inside a replaced value */
+long SimContext::getOverlayOffset(long baseOffset, const vector<OverlayPatch> &patches) {
+	long offset = baseOffset;
+	for (unsigned int i = 0; (i < patches.size()) && (patches[i].end <= baseOffset); i++)
+		offset += (long) patches[i].value.size() - (patches[i].end - patches[i].start);
+	return offset;
+} /* end getOverlayOffset */
+
+/* deleteOverlayBases frees the base inputs kept for the scenario overlay files, once all of them are read */
+void SimContext::deleteOverlayBases() {
+	lock_guard<mutex> lock(overlayBasesMutex);
+	for (map<string, OverlayBase>::iterator i = overlayBases.begin(); i != overlayBases.end(); i++) {
+		delete i->second.simContext;
+		delete i->second.inputFile;
+	}
+	overlayBases.clear();
+} /* end deleteOverlayBases */
+
+/* readInputTabsInParallel reads the tabs of the input file on CepacUtil::numInputThreads threads, returns false
+	if they have to be read one after another instead.  Each tab is read from its own view of the file, starting
+	at the first occurrence of its first label after the start of the previous tab, and the tabs of each stage of
+	INPUT_TABS are read at once after the tabs of the earlier stages.  The tabs are read into a separate SimContext
+	whose inputs are only taken if they are the same as reading the tabs in order gives: no tab may throw an error
+	or miss a label, and reading on from where each tab ended must find the next tab's first label where its view
+	started.  Otherwise this SimContext is unchanged and the caller reads the tabs in order, which prints any
+	errors and warnings in the order of the file */
+bool SimContext::readInputTabsInParallel(InputReader *inputFile) {
+	/* Find the start of each tab and open a view of the file there */
+	InputReader tabReaders[NUM_INPUT_TABS];
+	long tabStarts[NUM_INPUT_TABS];
+	tabStarts[0] = 0;
+	tabReaders[0].openView(inputFile, 0);
+	for (int i = 1; i < NUM_INPUT_TABS; i++) {
+		tabStarts[i] = inputFile->findToken(INPUT_TABS[i].firstLabel, tabStarts[i - 1]);
+		if (tabStarts[i] < 0)
+			return false;
+		tabReaders[i].openView(inputFile, tabStarts[i]);
+	}
+
+	/* Read the tabs stage by stage, the calling thread is one of the workers */
+	SimContext *tabContext = new SimContext(runSpecsInputs->runName);
+	char tabFailed[NUM_INPUT_TABS];
+	memset(tabFailed, 0, sizeof(tabFailed));
+	for (int stage = 0; stage < NUM_INPUT_TAB_STAGES; stage++) {
+		int numTabsInStage = 0;
+		for (int i = 0; i < NUM_INPUT_TABS; i++) {
+			if (INPUT_TABS[i].stage == stage)
+				numTabsInStage++;
+		}
+		atomic<int> nextTab(0);
+		vector<thread> workers;
+		for (int i = 1; (i < CepacUtil::numInputThreads) && (i < numTabsInStage); i++)
+			workers.push_back(thread(&SimContext::readInputTabsOfStage, tabContext, stage, tabReaders, &nextTab, tabFailed));
+		tabContext->readInputTabsOfStage(stage, tabReaders, &nextTab, tabFailed);
+		for (unsigned int i = 0; i < workers.size(); i++)
+			workers[i].join();
+	}
+
+	/* Check that the tabs were read as they would have been in order */
+	bool isSameAsInOrder = true;
+	for (int i = 0; i < NUM_INPUT_TABS; i++) {
+		if (tabFailed[i] || (tabReaders[i].getNumFailedSearches() > 0) || (tabReaders[i].getNumBadValues() > 0))
+			isSameAsInOrder = false;
+	}
+	for (int i = 1; isSameAsInOrder && (i < NUM_INPUT_TABS); i++) {
+		InputReader nextTabReader;
+		nextTabReader.openView(inputFile, tabReaders[i - 1].getPosition());
+		long labelLength = (long) strlen(INPUT_TABS[i].firstLabel);
+		if (!nextTabReader.skipPast(INPUT_TABS[i].firstLabel) || (nextTabReader.getPosition() != tabStarts[i] + labelLength))
+			isSameAsInOrder = false;
+	}
+	if (isSameAsInOrder) {
+		shareInputs(tabContext);
+		for (int i = 0; i < NUM_INPUT_TABS; i++)
+			inputTabEnds[i] = tabReaders[i].getPosition();
+	}
+	delete tabContext;
+	return isSameAsInOrder;
+} /* end readInputTabsInParallel */
+
+/* readInputTabsOfStage is run by each thread reading the tabs of a stage, reading the next tab of the stage not
+	yet taken by another thread until there are none left; errors are recorded in tabFailed and reported later */
+void SimContext::readInputTabsOfStage(int stage, InputReader *tabReaders, atomic<int> *nextTab, char *tabFailed) {
+	while (true) {
+		int tabNum = (*nextTab)++;
+		if (tabNum >= NUM_INPUT_TABS)
+			return;
+		if (INPUT_TABS[tabNum].stage != stage)
+			continue;
+		try {
+			(this->*INPUT_TABS[tabNum].readFunction)(&tabReaders[tabNum]);
+		}
+		catch (string &errorString) {
+			tabFailed[tabNum] = 1;
+		}
+	}
+} /* end readInputTabsOfStage */
+
+/* skipDisabledTab is called by the read function of a tab whose module is disabled, after the enable input, and moves
+	the input file to the first label of the next tab so the rest of the tab is not read.  Returns false, and the tab
+	is read in full, if all tabs are to be read or the next tab's label is missing, which reading the tab then reports.
+	The inputs of a skipped tab are left at zero; their getters stop the run if the simulation reads them */
+bool SimContext::skipDisabledTab(void (SimContext::*readFunction)(InputReader *inputFile), InputReader *inputFile) {
+	if (!CepacUtil::skipDisabledInputTabs)
+		return false;
+	int tabNum = 0;
+	while (INPUT_TABS[tabNum].readFunction != readFunction)
+		tabNum++;
+	if (tabNum == NUM_INPUT_TABS - 1) {
+		inputFile->setPosition(inputFile->getLength());
+		return true;
+	}
+	long nextTabStart = inputFile->findToken(INPUT_TABS[tabNum + 1].firstLabel, inputFile->getPosition() - 1);
+	if (nextTabStart < 0)
+		return false;
+	inputFile->setPosition(nextTabStart);
+	return true;
+} /* end skipDisabledTab */
+
+/* reportSkippedTabRead is called by the getters of the inputs of a tab that was skipped since its module is disabled;
+	those inputs were never read, so rather than simulate with them the run is stopped */
+void SimContext::reportSkippedTabRead(const char *tabName) {
+	printf("   ERROR - The %s inputs of %s were used although the tab was skipped since its module is disabled, run with --read-all-tabs\n",
+		tabName, inputFileName.c_str());
+	fflush(stdout);
+	abort();
+} /* end reportSkippedTabRead */
+
+/* writeCachedInputs and readCachedInputs write and read the allocated inputs of an ART line or prophylaxis, which may be NULL */
+template <class T> void SimContext::writeCachedInputs(FILE *file, const T *inputs) {
+	bool isPresent = (inputs != NULL);
+	CepacUtil::writeBinary(file, isPresent);
+	if (isPresent)
+		CepacUtil::writeBinary(file, *inputs);
+} /* end writeCachedInputs */
+
+template <class T> void SimContext::readCachedInputs(FILE *file, shared_ptr<T> *inputsPointer) {
+	bool isPresent;
+	CepacUtil::readBinary(file, &isPresent);
+	if (!isPresent)
+		return;
+	*inputsPointer = make_shared<T>();
+	CepacUtil::readBinary(file, inputsPointer->get());
+} /* end readCachedInputs */
+
+/* getInputCacheFileName returns the name of the binary input cache of the input file, the run name followed by .inb */
+string SimContext::getInputCacheFileName() {
+	string cacheFileName = runSpecsInputs->runName;
+	cacheFileName.append(CepacUtil::FILE_EXTENSION_FOR_INPUT_CACHE);
+	return cacheFileName;
+} /* end getInputCacheFileName */
+
+/* getInputCacheLayoutSize returns the combined size of the input classes, used with the build stamp to reject caches of other builds */
+long long SimContext::getInputCacheLayoutSize() {
+	return (long long) (sizeof(SimContext) + sizeof(RunSpecsInputs) + sizeof(OutputInputs) + sizeof(CohortInputs) +
+		sizeof(TreatmentInputs) + sizeof(LTFUInputs) + sizeof(HeterogeneityInputs) + sizeof(STIInputs) + sizeof(ProphInputs) +
+		sizeof(ARTInputs) + sizeof(ARTInputs::ARTToxicity) + sizeof(NatHistInputs) + sizeof(CHRMsInputs) + sizeof(CostInputs) +
+		sizeof(TBInputs) + sizeof(QOLInputs) + sizeof(HIVTestInputs) + sizeof(PedsInputs) + sizeof(PedsARTInputs) +
+		sizeof(PedsCostInputs) + sizeof(EIDInputs) + sizeof(AdolescentInputs) + sizeof(AdolescentARTInputs));
+} /* end getInputCacheLayoutSize */
+
+/* writeInputCache writes all the inputs to the binary input cache of the input file, keyed by the hash of the input file
+	and the version of CEPAC.  The cache is written to a temporary file that is then renamed, so that other processes
+	sharing the inputs directory never read a partly written cache.  Failing to write the cache is not an error. */
+void SimContext::writeInputCache(unsigned long long inputFileHash) {
+	string cacheFileName = getInputCacheFileName();
+	string tempFileName = cacheFileName;
+	tempFileName.append(CepacUtil::FILE_EXTENSION_FOR_TEMP);
+	FILE *file = CepacUtil::openFile(tempFileName.c_str(), "wb");
+	if (file == NULL)
+		return;
+	setvbuf(file, NULL, _IOFBF, INPUT_CACHE_BUFFER_SIZE);
+
+	char fileTag[8] = "CEPACIB";
+	int formatVersion = INPUT_CACHE_FORMAT_VERSION;
+	char inputVersion[16] = {0};
+	char buildStamp[32] = {0};
+	strncpy(inputVersion, CepacUtil::CEPAC_INPUT_VERSION, sizeof(inputVersion) - 1);
+	strncpy(buildStamp, INPUT_CACHE_BUILD_STAMP, sizeof(buildStamp) - 1);
+	CepacUtil::writeBinary(file, fileTag);
+	CepacUtil::writeBinary(file, formatVersion);
+	CepacUtil::writeBinary(file, inputVersion);
+	CepacUtil::writeBinary(file, buildStamp);
+	CepacUtil::writeBinary(file, inputFileHash);
+	CepacUtil::writeBinary(file, getInputCacheLayoutSize());
+	CepacUtil::writeBinary(file, CepacUtil::skipDisabledInputTabs);
+	writeInputValues(file);
+	CepacUtil::writeBinary(file, fileTag);
+
+	bool isWriteError = (fflush(file) != 0) || (ferror(file) != 0);
+	CepacUtil::closeFile(file);
+	if (isWriteError) {
+		remove(tempFileName.c_str());
+		return;
+	}
+	/* rename does not replace an existing file on Windows */
+	remove(cacheFileName.c_str());
+	if (rename(tempFileName.c_str(), cacheFileName.c_str()) != 0)
+		remove(tempFileName.c_str());
+} /* end writeInputCache */
+
+/* writeInputValues writes the values of all the inputs as the binary input cache stores them, without the run name;
+	it is also used to key the result cache by the inputs of a run rather than by the text of its input file */
+void SimContext::writeInputValues(FILE *file) {
+	/* Labels and settings read from the input file */
+	CepacUtil::writeBinary(file, numPatientsToTrace);
+	CepacUtil::writeBinary(file, RISK_FACT_STRS);
+	CepacUtil::writeBinary(file, OI_STRS);
+	CepacUtil::writeBinary(file, DTH_CAUSES_STRS);
+	CepacUtil::writeBinary(file, CHRM_STRS);
+
+	/* Input classes, in the order they are read from the input file */
+	writeCachedRunSpecsInputs(file);
+	CepacUtil::writeBinary(file, *outputInputs);
+	CepacUtil::writeBinary(file, *cohortInputs);
+	CepacUtil::writeBinary(file, *ltfuInputs);
+	CepacUtil::writeBinary(file, *heterogeneityInputs);
+	CepacUtil::writeBinary(file, *testingInputs);
+	CepacUtil::writeBinary(file, *natHistInputs);
+	CepacUtil::writeBinary(file, *chrmsInputs);
+	CepacUtil::writeBinary(file, *qolInputs);
+	CepacUtil::writeBinary(file, *costInputs);
+	CepacUtil::writeBinary(file, *treatmentInputs);
+	for (int i = 0; i < ART_NUM_LINES; i++)
+		writeCachedARTInputs(file, artInputs[i].get());
+	for (int i = 0; i < PROPH_NUM_TYPES; i++)
+		for (int j = 0; j < OI_NUM; j++)
+			for (int k = 0; k < PROPH_NUM; k++)
+				writeCachedInputs(file, prophsInputs[i][j][k].get());
+	CepacUtil::writeBinary(file, *stiInputs);
+	CepacUtil::writeBinary(file, *tbInputs);
+	CepacUtil::writeBinary(file, *pedsInputs);
+	for (int i = 0; i < PROPH_NUM_TYPES; i++)
+		for (int j = 0; j < OI_NUM; j++)
+			for (int k = 0; k < PROPH_NUM; k++)
+				writeCachedInputs(file, pedsProphsInputs[i][j][k].get());
+	for (int i = 0; i < ART_NUM_LINES; i++)
+		writeCachedInputs(file, pedsARTInputs[i].get());
+	CepacUtil::writeBinary(file, *pedsCostInputs);
+	CepacUtil::writeBinary(file, *eidInputs);
+	CepacUtil::writeBinary(file, *adolescentInputs);
+	for (int i = 0; i < ART_NUM_LINES; i++)
+		writeCachedInputs(file, adolescentARTInputs[i].get());
+} /* end writeInputValues */
+
+/* readInputCache loads all the inputs from the binary input cache of the input file, returning false if there is no cache,
+	or it was written for a different version of the input file or by a different build of CEPAC, or it is incomplete.
+	The inputs must then be read from the input file. */
+bool SimContext::readInputCache(unsigned long long inputFileHash) {
+	string cacheFileName = getInputCacheFileName();
+	FILE *file = CepacUtil::openFile(cacheFileName.c_str(), "rb");
+	if (file == NULL)
+		return false;
+	setvbuf(file, NULL, _IOFBF, INPUT_CACHE_BUFFER_SIZE);
+
+	bool isLoaded = false;
+	try {
+		char fileTag[8];
+		int formatVersion;
+		char inputVersion[16];
+		char buildStamp[32];
+		unsigned long long fileInputHash;
+		long long layoutSize;
+		bool isSkippingDisabledTabs;
+		CepacUtil::readBinary(file, &fileTag);
+		CepacUtil::readBinary(file, &formatVersion);
+		CepacUtil::readBinary(file, &inputVersion);
+		CepacUtil::readBinary(file, &buildStamp);
+		CepacUtil::readBinary(file, &fileInputHash);
+		CepacUtil::readBinary(file, &layoutSize);
+		CepacUtil::readBinary(file, &isSkippingDisabledTabs);
+		inputVersion[sizeof(inputVersion) - 1] = '\0';
+		buildStamp[sizeof(buildStamp) - 1] = '\0';
+		if ((strncmp(fileTag, "CEPACIB", sizeof(fileTag)) == 0) && (formatVersion == INPUT_CACHE_FORMAT_VERSION) &&
+				(strcmp(inputVersion, CepacUtil::CEPAC_INPUT_VERSION) == 0) && (strcmp(buildStamp, INPUT_CACHE_BUILD_STAMP) == 0) &&
+				(fileInputHash == inputFileHash) && (layoutSize == getInputCacheLayoutSize()) &&
+				(isSkippingDisabledTabs == CepacUtil::skipDisabledInputTabs)) {
+			CepacUtil::readBinary(file, &numPatientsToTrace);
+			CepacUtil::readBinary(file, &RISK_FACT_STRS);
+			CepacUtil::readBinary(file, &OI_STRS);
+			CepacUtil::readBinary(file, &DTH_CAUSES_STRS);
+			CepacUtil::readBinary(file, &CHRM_STRS);
+
+			readCachedRunSpecsInputs(file);
+			CepacUtil::readBinary(file, outputInputs.get());
+			CepacUtil::readBinary(file, cohortInputs.get());
+			CepacUtil::readBinary(file, ltfuInputs.get());
+			CepacUtil::readBinary(file, heterogeneityInputs.get());
+			CepacUtil::readBinary(file, testingInputs.get());
+			CepacUtil::readBinary(file, natHistInputs.get());
+			CepacUtil::readBinary(file, chrmsInputs.get());
+			CepacUtil::readBinary(file, qolInputs.get());
+			CepacUtil::readBinary(file, costInputs.get());
+			CepacUtil::readBinary(file, treatmentInputs.get());
+			for (int i = 0; i < ART_NUM_LINES; i++)
+				readCachedARTInputs(file, &artInputs[i]);
+			for (int i = 0; i < PROPH_NUM_TYPES; i++)
+				for (int j = 0; j < OI_NUM; j++)
+					for (int k = 0; k < PROPH_NUM; k++)
+						readCachedInputs(file, &prophsInputs[i][j][k]);
+			CepacUtil::readBinary(file, stiInputs.get());
+			CepacUtil::readBinary(file, tbInputs.get());
+			CepacUtil::readBinary(file, pedsInputs.get());
+			for (int i = 0; i < PROPH_NUM_TYPES; i++)
+				for (int j = 0; j < OI_NUM; j++)
+					for (int k = 0; k < PROPH_NUM; k++)
+						readCachedInputs(file, &pedsProphsInputs[i][j][k]);
+			for (int i = 0; i < ART_NUM_LINES; i++)
+				readCachedInputs(file, &pedsARTInputs[i]);
+			CepacUtil::readBinary(file, pedsCostInputs.get());
+			CepacUtil::readBinary(file, eidInputs.get());
+			CepacUtil::readBinary(file, adolescentInputs.get());
+			for (int i = 0; i < ART_NUM_LINES; i++)
+				readCachedInputs(file, &adolescentARTInputs[i]);
+			CepacUtil::readBinary(file, &fileTag);
+			isLoaded = (strncmp(fileTag, "CEPACIB", sizeof(fileTag)) == 0) && (fgetc(file) == EOF);
+		}
+	}
+	catch (string &errorString) {
+		isLoaded = false;
+	}
+	CepacUtil::closeFile(file);
+
+	/* Discard anything loaded from a cache that could not be used, the input file will be read instead */
+	if (!isLoaded)
+		releaseAllocatedInputs();
+	return isLoaded;
+} /* end readInputCache */
+
+/* writeCachedString and readCachedString write and read a string as its length followed by its characters */
+void SimContext::writeCachedString(FILE *file, const string &value) {
+	int length = (int) value.size();
+	CepacUtil::writeBinary(file, length);
+	fwrite(value.data(), 1, length, file);
+} /* end writeCachedString */
+
+void SimContext::readCachedString(FILE *file, string *value) {
+	int length;
+	CepacUtil::readBinary(file, &length);
+	if ((length < 0) || (length > MAX_CACHED_STRING_LENGTH)) {
+		string errorString = "   ERROR - Input cache has an invalid string";
+		throw errorString;
+	}
+	value->resize(length);
+	if ((length > 0) && (fread(&(*value)[0], 1, length, file) != (size_t) length)) {
+		string errorString = "   ERROR - Input cache ended before all the inputs were read";
+		throw errorString;
+	}
+} /* end readCachedString */
+
+/* writeCachedRunSpecsInputs and readCachedRunSpecsInputs write and read the RunSpecsInputs one member at a time, since
+	it holds strings; any member added to RunSpecsInputs must be added to both */
+void SimContext::writeCachedRunSpecsInputs(FILE *file) {
+	writeCachedString(file, runSpecsInputs->runSetName);
+	CepacUtil::writeBinary(file, runSpecsInputs->numCohorts);
+	CepacUtil::writeBinary(file, runSpecsInputs->discountFactor);
+	CepacUtil::writeBinary(file, runSpecsInputs->originalDiscRate);
+	CepacUtil::writeBinary(file, runSpecsInputs->maxPatientCD4);
+	CepacUtil::writeBinary(file, runSpecsInputs->monthRecordARTEfficacy);
+	CepacUtil::writeBinary(file, runSpecsInputs->randomSeedByTime);
+	writeCachedString(file, runSpecsInputs->userProgramLocale);
+	writeCachedString(file, runSpecsInputs->inputVersion);
+	writeCachedString(file, runSpecsInputs->modelVersion);
+	CepacUtil::writeBinary(file, runSpecsInputs->OIsIncludeTB);
+	CepacUtil::writeBinary(file, runSpecsInputs->OIsFractionOfBenefit);
+	CepacUtil::writeBinary(file, runSpecsInputs->severeOIs);
+	CepacUtil::writeBinary(file, runSpecsInputs->CD4StrataUpperBounds);
+	CepacUtil::writeBinary(file, runSpecsInputs->longitLoggingLevel);
+	CepacUtil::writeBinary(file, runSpecsInputs->firstOIsLongitLogging);
+	CepacUtil::writeBinary(file, runSpecsInputs->enableOIHistoryLogging);
+	CepacUtil::writeBinary(file, runSpecsInputs->numARTFailuresForOIHistoryLogging);
+	CepacUtil::writeBinary(file, runSpecsInputs->CD4BoundsForOIHistoryLogging);
+	CepacUtil::writeBinary(file, runSpecsInputs->HVLBoundsForOIHistoryLogging);
+	CepacUtil::writeBinary(file, runSpecsInputs->OIsToExcludeOIHistoryLogging);
+	CepacUtil::writeBinary(file, runSpecsInputs->enableMultipleDiscountRates);
+	CepacUtil::writeBinary(file, runSpecsInputs->multDiscountRatesCost);
+	CepacUtil::writeBinary(file, runSpecsInputs->multDiscountRatesBenefit);
+} /* end writeCachedRunSpecsInputs */
+
+void SimContext::readCachedRunSpecsInputs(FILE *file) {
+	readCachedString(file, &runSpecsInputs->runSetName);
+	CepacUtil::readBinary(file, &runSpecsInputs->numCohorts);
+	CepacUtil::readBinary(file, &runSpecsInputs->discountFactor);
+	CepacUtil::readBinary(file, &runSpecsInputs->originalDiscRate);
+	CepacUtil::readBinary(file, &runSpecsInputs->maxPatientCD4);
+	CepacUtil::readBinary(file, &runSpecsInputs->monthRecordARTEfficacy);
+	CepacUtil::readBinary(file, &runSpecsInputs->randomSeedByTime);
+	readCachedString(file, &runSpecsInputs->userProgramLocale);
+	readCachedString(file, &runSpecsInputs->inputVersion);
+	readCachedString(file, &runSpecsInputs->modelVersion);
+	CepacUtil::readBinary(file, &runSpecsInputs->OIsIncludeTB);
+	CepacUtil::readBinary(file, &runSpecsInputs->OIsFractionOfBenefit);
+	CepacUtil::readBinary(file, &runSpecsInputs->severeOIs);
+	CepacUtil::readBinary(file, &runSpecsInputs->CD4StrataUpperBounds);
+	CepacUtil::readBinary(file, &runSpecsInputs->longitLoggingLevel);
+	CepacUtil::readBinary(file, &runSpecsInputs->firstOIsLongitLogging);
+	CepacUtil::readBinary(file, &runSpecsInputs->enableOIHistoryLogging);
+	CepacUtil::readBinary(file, &runSpecsInputs->numARTFailuresForOIHistoryLogging);
+	CepacUtil::readBinary(file, &runSpecsInputs->CD4BoundsForOIHistoryLogging);
+	CepacUtil::readBinary(file, &runSpecsInputs->HVLBoundsForOIHistoryLogging);
+	CepacUtil::readBinary(file, &runSpecsInputs->OIsToExcludeOIHistoryLogging);
+	CepacUtil::readBinary(file, &runSpecsInputs->enableMultipleDiscountRates);
+	CepacUtil::readBinary(file, &runSpecsInputs->multDiscountRatesCost);
+	CepacUtil::readBinary(file, &runSpecsInputs->multDiscountRatesBenefit);
+} /* end readCachedRunSpecsInputs */
+
+/* writeCachedARTInputs and readCachedARTInputs write and read the inputs of an ART line one member at a time, since the
+	toxicities hold strings; any member added to ARTInputs or ARTToxicity must be added to both */
+void SimContext::writeCachedARTInputs(FILE *file, const ARTInputs *artInput) {
+	bool isPresent = (artInput != NULL);
+	CepacUtil::writeBinary(file, isPresent);
+	if (!isPresent)
+		return;
+	CepacUtil::writeBinary(file, artInput->costInitial);
+	CepacUtil::writeBinary(file, artInput->costMonthly);
+	CepacUtil::writeBinary(file, artInput->efficacyTimeHorizon);
+	CepacUtil::writeBinary(file, artInput->efficacyTimeHorizonResuppression);
+	CepacUtil::writeBinary(file, artInput->forceFailAtMonth);
+	CepacUtil::writeBinary(file, artInput->stageBoundsCD4ChangeOnSuppART);
+	CepacUtil::writeBinary(file, artInput->stageBoundCD4ChangeOnARTFail);
+	CepacUtil::writeBinary(file, artInput->CD4ChangeOnSuppARTMean);
+	CepacUtil::writeBinary(file, artInput->CD4ChangeOnSuppARTStdDev);
+	CepacUtil::writeBinary(file, artInput->CD4MultiplierOnFailedART);
+	CepacUtil::writeBinary(file, artInput->secondaryCD4ChangeOnARTStdDev);
+	CepacUtil::writeBinary(file, artInput->monthlyCD4MultiplierOffARTPreSetpoint);
+	CepacUtil::writeBinary(file, artInput->monthlyCD4MultiplierOffARTPostSetpoint);
+	CepacUtil::writeBinary(file, artInput->monthlyProbHVLChange);
+	CepacUtil::writeBinary(file, artInput->monthlyNumStrataHVLChange);
+	for (int i = 0; i < ART_NUM_SUBREGIMENS; i++) {
+		for (int j = 0; j < ART_NUM_TOX_SEVERITY; j++) {
+			for (int k = 0; k < ART_NUM_TOX_PER_SEVERITY; k++) {
+				const ARTInputs::ARTToxicity &toxicity = artInput->toxicity[i][j][k];
+				writeCachedString(file, toxicity.toxicityName);
+				CepacUtil::writeBinary(file, toxicity.probToxicity);
+				CepacUtil::writeBinary(file, toxicity.timeToToxicityMean);
+				CepacUtil::writeBinary(file, toxicity.timeToToxicityStdDev);
+				CepacUtil::writeBinary(file, toxicity.QOLModifier);
+				CepacUtil::writeBinary(file, toxicity.QOLDuration);
+				CepacUtil::writeBinary(file, toxicity.costAmount);
+				CepacUtil::writeBinary(file, toxicity.costDuration);
+				CepacUtil::writeBinary(file, toxicity.switchARTRegimenOnToxicity);
+				CepacUtil::writeBinary(file, toxicity.switchSubRegimenOnToxicity);
+				CepacUtil::writeBinary(file, toxicity.timeToChronicDeathImpact);
+				CepacUtil::writeBinary(file, toxicity.chronicToxDeathRateRatio);
+				CepacUtil::writeBinary(file, toxicity.chronicDeathDuration);
+				CepacUtil::writeBinary(file, toxicity.acuteMajorToxDeathRateRatio);
+				CepacUtil::writeBinary(file, toxicity.costAcuteDeathMajorToxicity);
+			}
+		}
+	}
+	CepacUtil::writeBinary(file, artInput->monthsToSwitchSubRegimen);
+	CepacUtil::writeBinary(file, artInput->propMthCostNonResponders);
+	CepacUtil::writeBinary(file, artInput->probRestartARTRegimenAfterFailure);
+	CepacUtil::writeBinary(file, artInput->maxRestartAttempts);
+	CepacUtil::writeBinary(file, artInput->propRespondARTRegimenLogitMean);
+	CepacUtil::writeBinary(file, artInput->propRespondARTRegimenLogitStdDev);
+	CepacUtil::writeBinary(file, artInput->propRespondARTRegimenLogitDistribution);
+	CepacUtil::writeBinary(file, artInput->propRespondARTRegimenUseDuration);
+	CepacUtil::writeBinary(file, artInput->propRespondARTRegimenDurationMean);
+	CepacUtil::writeBinary(file, artInput->propRespondARTRegimenDurationStdDev);
+	CepacUtil::writeBinary(file, artInput->responseTypeThresholds);
+	CepacUtil::writeBinary(file, artInput->responseTypeValues);
+	CepacUtil::writeBinary(file, artInput->responseTypeExponents);
+	CepacUtil::writeBinary(file, artInput->applyARTEffectOnFailed);
+} /* end writeCachedARTInputs */
+
+void SimContext::readCachedARTInputs(FILE *file, shared_ptr<ARTInputs> *artInputPointer) {
+	bool isPresent;
+	CepacUtil::readBinary(file, &isPresent);
+	if (!isPresent)
+		return;
+	*artInputPointer = make_shared<ARTInputs>();
+	ARTInputs *artInput = artInputPointer->get();
+	CepacUtil::readBinary(file, &artInput->costInitial);
+	CepacUtil::readBinary(file, &artInput->costMonthly);
+	CepacUtil::readBinary(file, &artInput->efficacyTimeHorizon);
+	CepacUtil::readBinary(file, &artInput->efficacyTimeHorizonResuppression);
+	CepacUtil::readBinary(file, &artInput->forceFailAtMonth);
+	CepacUtil::readBinary(file, &artInput->stageBoundsCD4ChangeOnSuppART);
+	CepacUtil::readBinary(file, &artInput->stageBoundCD4ChangeOnARTFail);
+	CepacUtil::readBinary(file, &artInput->CD4ChangeOnSuppARTMean);
+	CepacUtil::readBinary(file, &artInput->CD4ChangeOnSuppARTStdDev);
+	CepacUtil::readBinary(file, &artInput->CD4MultiplierOnFailedART);
+	CepacUtil::readBinary(file, &artInput->secondaryCD4ChangeOnARTStdDev);
+	CepacUtil::readBinary(file, &artInput->monthlyCD4MultiplierOffARTPreSetpoint);
+	CepacUtil::readBinary(file, &artInput->monthlyCD4MultiplierOffARTPostSetpoint);
+	CepacUtil::readBinary(file, &artInput->monthlyProbHVLChange);
+	CepacUtil::readBinary(file, &artInput->monthlyNumStrataHVLChange);
+	for (int i = 0; i < ART_NUM_SUBREGIMENS; i++) {
+		for (int j = 0; j < ART_NUM_TOX_SEVERITY; j++) {
+			for (int k = 0; k < ART_NUM_TOX_PER_SEVERITY; k++) {
+				ARTInputs::ARTToxicity &toxicity = artInput->toxicity[i][j][k];
+				readCachedString(file, &toxicity.toxicityName);
+				CepacUtil::readBinary(file, &toxicity.probToxicity);
+				CepacUtil::readBinary(file, &toxicity.timeToToxicityMean);
+				CepacUtil::readBinary(file, &toxicity.timeToToxicityStdDev);
+				CepacUtil::readBinary(file, &toxicity.QOLModifier);
+				CepacUtil::readBinary(file, &toxicity.QOLDuration);
+				CepacUtil::readBinary(file, &toxicity.costAmount);
+				CepacUtil::readBinary(file, &toxicity.costDuration);
+				CepacUtil::readBinary(file, &toxicity.switchARTRegimenOnToxicity);
+				CepacUtil::readBinary(file, &toxicity.switchSubRegimenOnToxicity);
+				CepacUtil::readBinary(file, &toxicity.timeToChronicDeathImpact);
+				CepacUtil::readBinary(file, &toxicity.chronicToxDeathRateRatio);
+				CepacUtil::readBinary(file, &toxicity.chronicDeathDuration);
+				CepacUtil::readBinary(file, &toxicity.acuteMajorToxDeathRateRatio);
+				CepacUtil::readBinary(file, &toxicity.costAcuteDeathMajorToxicity);
+			}
+		}
+	}
+	CepacUtil::readBinary(file, &artInput->monthsToSwitchSubRegimen);
+	CepacUtil::readBinary(file, &artInput->propMthCostNonResponders);
+	CepacUtil::readBinary(file, &artInput->probRestartARTRegimenAfterFailure);
+	CepacUtil::readBinary(file, &artInput->maxRestartAttempts);
+	CepacUtil::readBinary(file, &artInput->propRespondARTRegimenLogitMean);
+	CepacUtil::readBinary(file, &artInput->propRespondARTRegimenLogitStdDev);
+	CepacUtil::readBinary(file, &artInput->propRespondARTRegimenLogitDistribution);
+	CepacUtil::readBinary(file, &artInput->propRespondARTRegimenUseDuration);
+	CepacUtil::readBinary(file, &artInput->propRespondARTRegimenDurationMean);
+	CepacUtil::readBinary(file, &artInput->propRespondARTRegimenDurationStdDev);
+	CepacUtil::readBinary(file, &artInput->responseTypeThresholds);
+	CepacUtil::readBinary(file, &artInput->responseTypeValues);
+	CepacUtil::readBinary(file, &artInput->responseTypeExponents);
+	CepacUtil::readBinary(file, &artInput->applyARTEffectOnFailed);
+} /* end readCachedARTInputs */
+
 /* readRunSpecsInputs reads data from the RunSpecs tab of the input sheet */
-void SimContext::readRunSpecsInputs() {
+void SimContext::readRunSpecsInputs(InputReader *inputFile) {
 	char buffer[256];
-	int i, tempBool;
+	int i, tempBool, tempInt;
 	// read in name of set this run belongs to
 	readAndSkipPast( "Runset", inputFile );
-	fscanf( inputFile, "%299s", buffer );
-	runSpecsInputs.runSetName = buffer;
+	inputFile->scan( "%255s", buffer );
+	runSpecsInputs->runSetName = buffer;
 	// read in cohort size
 	readAndSkipPast( "CohortSize", inputFile );
-	fscanf( inputFile, "%ld", &runSpecsInputs.numCohorts );
+	inputFile->scan( "%d", &runSpecsInputs->numCohorts );
 	// read in discount rate, convert to monthly rate from yearly
 	readAndSkipPast( "DiscFactor", inputFile );
-	fscanf( inputFile, "%lf", &runSpecsInputs.originalDiscRate );
-	runSpecsInputs.discountFactor = pow(1.0 + runSpecsInputs.originalDiscRate, 1.0 / 12.0);
+	inputFile->scan( "%lf", &runSpecsInputs->originalDiscRate );
+	runSpecsInputs->discountFactor = pow(1.0 + runSpecsInputs->originalDiscRate, 1.0 / 12.0);
 	// read in max actual CD4 count for patient
 	readAndSkipPast( "MaxPatCD4", inputFile );
-	fscanf( inputFile, "%lf", &runSpecsInputs.maxPatientCD4 );
+	inputFile->scan( "%lf", &runSpecsInputs->maxPatientCD4 );
 
 	// read in mth times A - C to rec ART eff
 	readAndSkipPast( "MthRecARTEffA", inputFile );
-	fscanf( inputFile, "%d", &runSpecsInputs.monthRecordARTEfficacy[0] );
+	inputFile->scan( "%d", &runSpecsInputs->monthRecordARTEfficacy[0] );
 	readAndSkipPast( "MthRecARTEffB", inputFile );
-	fscanf( inputFile, "%d", &runSpecsInputs.monthRecordARTEfficacy[1] );
+	inputFile->scan( "%d", &runSpecsInputs->monthRecordARTEfficacy[1] );
 	readAndSkipPast( "MthRecARTEffC", inputFile );
-	fscanf( inputFile, "%d", &runSpecsInputs.monthRecordARTEfficacy[2] );
+	inputFile->scan( "%d", &runSpecsInputs->monthRecordARTEfficacy[2] );
 	// read in whether to use time to init rand seeds
 	readAndSkipPast( "RandSeedByTime", inputFile );
-	fscanf( inputFile, "%d", &tempBool);
-	runSpecsInputs.randomSeedByTime = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool);
+	runSpecsInputs->randomSeedByTime = (bool) tempBool;
 	// read in user locale
 	readAndSkipPast( "UserLocale", inputFile );
-	fscanf( inputFile, " %32s", buffer );
-	runSpecsInputs.userProgramLocale = buffer;
+	inputFile->scan( " %32s", buffer );
+	runSpecsInputs->userProgramLocale = buffer;
 
 	// read in input's internal version
 	readAndSkipPast( "InpVer", inputFile );
-	fscanf( inputFile, " %20s", buffer );
+	inputFile->scan( " %20s", buffer );
 	// Verify input version, throw error if it does not match up
 	if (strcmp(buffer, CepacUtil::CEPAC_INPUT_VERSION) != 0) {
 		string errorString = "   ERROR - Input file version incompatible with the CEPAC executable";
 		throw errorString;
 	}
-	runSpecsInputs.inputVersion = buffer;
+	runSpecsInputs->inputVersion = buffer;
 	// read in the model version
 	readAndSkipPast( "ModelVer", inputFile );
-	fscanf( inputFile, " %20s", buffer );
-	runSpecsInputs.modelVersion = buffer;
+	inputFile->scan( " %20s", buffer );
+	runSpecsInputs->modelVersion = buffer;
 
 	// read in whether to model TB as an OI when the TB tab is disabled; this allows the program to apply the TB-specific OI death rate ratio
 	readAndSkipPast( "IncludeTB_AsOI", inputFile);
-	fscanf( inputFile,"%d", &tempBool );
-	runSpecsInputs.OIsIncludeTB = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool );
+	runSpecsInputs->OIsIncludeTB = (bool) tempBool;
 	// read in user defined OI names, and set causes of death names
 	readAndSkipPast( "OIstrs", inputFile );
 	for ( i = 0; i < OI_NUM; ++i ) {
-		fscanf( inputFile, " %32s", OI_STRS[i] );
+		inputFile->scan( " %32s", OI_STRS[i] );
 		strcpy(DTH_CAUSES_STRS[i], OI_STRS[i]);
 	}
 	strcpy(DTH_CAUSES_STRS[DTH_HIV], "HIV");
@@ -278,169 +1201,170 @@ void SimContext::readRunSpecsInputs() {
 
 	// read in whether to output monthly cohort summaries to file
 	readAndSkipPast( "LongitLogCohort", inputFile );
-	fscanf( inputFile, "%d", &runSpecsInputs.longitLoggingLevel );
+	inputFile->scan( "%d", &tempInt );
+	runSpecsInputs->longitLoggingLevel = (LONGIT_SUMM_TYPE) tempInt;
 	// read in OIs considered as first OIs in the log
 	readAndSkipPast( "LongitLogFirstOIs", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%d", &(runSpecsInputs.firstOIsLongitLogging[i]) );
+		inputFile->scan( "%d", &(runSpecsInputs->firstOIsLongitLogging[i]) );
 
 	// read in whether to output CD4 distribution of OI histories
 	readAndSkipPast( "LogPriorOIHistProb", inputFile );
-	fscanf( inputFile, "%d", &tempBool);
-	runSpecsInputs.enableOIHistoryLogging = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool);
+	runSpecsInputs->enableOIHistoryLogging = (bool) tempBool;
 	// read in the number of ART failures pat has to log OI hists
 	readAndSkipPast( "LogOIHistwithARTfails", inputFile );
-	fscanf( inputFile, "%d", &runSpecsInputs.numARTFailuresForOIHistoryLogging );
+	inputFile->scan( "%d", &runSpecsInputs->numARTFailuresForOIHistoryLogging );
 	// read in CD4 bounds to constrain when pat mths are included in OI hist logging
 	readAndSkipPast( "LogOIHistwithCD4", inputFile );
-	fscanf( inputFile, "%lf %lf", &(runSpecsInputs.CD4BoundsForOIHistoryLogging[LOWER_BOUND]), &(runSpecsInputs.CD4BoundsForOIHistoryLogging[UPPER_BOUND]) );
+	inputFile->scan( "%lf %lf", &(runSpecsInputs->CD4BoundsForOIHistoryLogging[LOWER_BOUND]), &(runSpecsInputs->CD4BoundsForOIHistoryLogging[UPPER_BOUND]) );
 	// read in HVL bnds to constrain when pat mths included in OI hist logging
 	readAndSkipPast( "LogOIHistwithHVL", inputFile );
-	fscanf( inputFile, "%d %d", &(runSpecsInputs.HVLBoundsForOIHistoryLogging[LOWER_BOUND]), &(runSpecsInputs.HVLBoundsForOIHistoryLogging[UPPER_BOUND]) );
+	inputFile->scan( "%d %d", &(runSpecsInputs->HVLBoundsForOIHistoryLogging[LOWER_BOUND]), &(runSpecsInputs->HVLBoundsForOIHistoryLogging[UPPER_BOUND]) );
 	// read in whether to excl pat mths from OI hist log if there's OI hist of given OI
 	readAndSkipPast( "LogOIHistExcludeOITypes", inputFile );
 	for ( i = 0; i < OI_NUM; ++i ) {
-		fscanf( inputFile, "%d", &tempBool);
-		runSpecsInputs.OIsToExcludeOIHistoryLogging[i] = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		runSpecsInputs->OIsToExcludeOIHistoryLogging[i] = (bool) tempBool;
 	}
 	// read in OI Fraction of Benefit
 	readAndSkipPast( "FOB_OIs", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(runSpecsInputs.OIsFractionOfBenefit[i]) );
+		inputFile->scan( "%lf", &(runSpecsInputs->OIsFractionOfBenefit[i]) );
 	// read in severe OI classification
 	readAndSkipPast( "Severe_OIs", inputFile );
 	for ( i = 0; i < OI_NUM; ++i ) {
-		fscanf( inputFile, "%d", &tempBool);
-		runSpecsInputs.severeOIs[i] = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		runSpecsInputs->severeOIs[i] = (bool) tempBool;
 	}
 	// read in CD4 count boundaries for strata
 	readAndSkipPast( "CD4Bounds", inputFile );
 	for ( i = CD4__HI; i >= CD4_VLO; i-- )
-		fscanf( inputFile, "%lf", &(runSpecsInputs.CD4StrataUpperBounds[i]) );
+		inputFile->scan( "%lf", &(runSpecsInputs->CD4StrataUpperBounds[i]) );
 
 	// read in whether to enable Multiple disocunt rates
 	readAndSkipPast( "EnableMultDiscountOutput", inputFile );
-	fscanf( inputFile, "%d", &tempBool );
-	runSpecsInputs.enableMultipleDiscountRates = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool );
+	runSpecsInputs->enableMultipleDiscountRates = (bool) tempBool;
 
 	// read in multiple discount rate, convert to monthly rate from yearly
 	readAndSkipPast( "DiscountRatesCost", inputFile );
 	for (i = 0; i < NUM_DISCOUNT_RATES; i++){
 		double annualDiscountRate;
-		fscanf( inputFile, "%lf", &annualDiscountRate);
-		runSpecsInputs.multDiscountRatesCost[i] = pow(1.0+annualDiscountRate, 1.0/12.0);
+		inputFile->scan( "%lf", &annualDiscountRate);
+		runSpecsInputs->multDiscountRatesCost[i] = pow(1.0+annualDiscountRate, 1.0/12.0);
 	}
 
 	// read in multiple discount rate, convert to monthly rate from yearly
 	readAndSkipPast( "DiscountRatesBenefit", inputFile );
 	for (i = 0; i < NUM_DISCOUNT_RATES; i++){
 		double annualDiscountRate;
-		fscanf( inputFile, "%lf", &annualDiscountRate);
-		runSpecsInputs.multDiscountRatesBenefit[i] = pow(1.0+annualDiscountRate, 1.0/12.0);
+		inputFile->scan( "%lf", &annualDiscountRate);
+		runSpecsInputs->multDiscountRatesBenefit[i] = pow(1.0+annualDiscountRate, 1.0/12.0);
 	}
 
 
 } /* end readRunSpecsInputs */
 
 /* readOutputInputs reads data from the Output tab of the input sheet */
-void SimContext::readOutputInputs() {
+void SimContext::readOutputInputs(InputReader *inputFile) {
 	int i, tempBool;
 
 	readAndSkipPast("NumPatientsToTrace", inputFile);
-	fscanf(inputFile, "%d", &(outputInputs.traceNumSelection));
-	numPatientsToTrace = min(outputInputs.traceNumSelection, MAX_NUM_TRACES);
+	inputFile->scan("%d", &(outputInputs->traceNumSelection));
+	numPatientsToTrace = min(outputInputs->traceNumSelection, MAX_NUM_TRACES);
 	//read in sub cohort parameters
 	readAndSkipPast("EnableSubCohorts", inputFile);
-	fscanf(inputFile, "%d", &tempBool);
-	outputInputs.enableSubCohorts = (bool) tempBool;
+	inputFile->scan("%d", &tempBool);
+	outputInputs->enableSubCohorts = (bool) tempBool;
 	readAndSkipPast("SubCohortValues", inputFile);
 	for (i = 0; i < MAX_NUM_SUBCOHORTS; i++)
-		fscanf(inputFile, "%ld", &(outputInputs.subCohorts[i]));
+		inputFile->scan("%d", &(outputInputs->subCohorts[i]));
 
 	//read in cost output parameters
 	readAndSkipPast("EnableDetailedCosts", inputFile);
-	fscanf(inputFile, "%d", &tempBool);
-	outputInputs.enableDetailedCostOutputs = (bool) tempBool;
+	inputFile->scan("%d", &tempBool);
+	outputInputs->enableDetailedCostOutputs = (bool) tempBool;
 }
 
 /* readCohortInputs reads data from the Cohort tab of the input sheet */
-void SimContext::readCohortInputs() {
+void SimContext::readCohortInputs(InputReader *inputFile) {
 	int i, j, k, tempInt, tempBool;
 	double dTemp;
 	char scratch[256];
 
 	// read in popul initial CD4 distrib
 	readAndSkipPast( "InitCD4", inputFile );
-	fscanf(inputFile,"%lf %lf", &(cohortInputs.initialCD4Mean), &(cohortInputs.initialCD4StdDev));
+	inputFile->scan("%lf %lf", &(cohortInputs->initialCD4Mean), &(cohortInputs->initialCD4StdDev));
 	readAndSkipPast("UseSqRtTransform", inputFile);
-	fscanf(inputFile, "%d", &tempBool);
-	cohortInputs.enableSquareRootTransform = (bool) tempBool;
+	inputFile->scan("%d", &tempBool);
+	cohortInputs->enableSquareRootTransform = (bool) tempBool;
 
 	// read in popul initial HVL distrib
 	for ( j = CD4_NUM_STRATA - 1; j >= 0; --j ) {
 		readAndSkipPast( "InitHVL", inputFile );
 		readAndSkipPast( CD4_STRATA_STRS[j], inputFile );
 		for ( i = HVL_NUM_STRATA - 1; i >= HVL_VLO; --i )
-			fscanf( inputFile, "%lf", &(cohortInputs.initialHVLDistribution[j][i]) );
+			inputFile->scan( "%lf", &(cohortInputs->initialHVLDistribution[j][i]) );
 	}
 	// read in popul initial age (mths) distrib
 	readAndSkipPast( "InitAge", inputFile );
-	fscanf(inputFile,"%lf %lf", &cohortInputs.initialAgeMean, &cohortInputs.initialAgeStdDev);
+	inputFile->scan("%lf %lf", &cohortInputs->initialAgeMean, &cohortInputs->initialAgeStdDev);
 
     // read in custom age dist bool
 	readAndSkipPast( "InitAgeCustomDist", inputFile );
-	fscanf(inputFile, "%d", &tempBool);
-	cohortInputs.useCustomAgeDist = (bool) tempBool;
+	inputFile->scan("%d", &tempBool);
+	cohortInputs->useCustomAgeDist = (bool) tempBool;
 
     // store age dist strata mins/maxes in same array!
     readAndSkipPast( "AgeStratMins", inputFile );
     for (i = 0; i < INIT_AGE_NUM_STRATA; ++i) {
-        fscanf(inputFile, "%lf", &cohortInputs.ageStrata[i] );
+        inputFile->scan("%lf", &cohortInputs->ageStrata[i] );
     }
     readAndSkipPast( "AgeStratMaxes", inputFile );
     for (i = 0; i < INIT_AGE_NUM_STRATA; ++i) {
-        fscanf(inputFile, "%lf", &cohortInputs.ageStrata[INIT_AGE_NUM_STRATA + i] );
+        inputFile->scan("%lf", &cohortInputs->ageStrata[INIT_AGE_NUM_STRATA + i] );
     }
 
     // read in age strata probabilites as CDF
     readAndSkipPast( "AgeStratProbs", inputFile );
     for (i = 0; i < INIT_AGE_NUM_STRATA; ++i) {
-        fscanf(inputFile, "%lf", &cohortInputs.ageProbs[i]);
+        inputFile->scan("%lf", &cohortInputs->ageProbs[i]);
         if (i > 0)
-            cohortInputs.ageProbs[i] += cohortInputs.ageProbs[i - 1];
+            cohortInputs->ageProbs[i] += cohortInputs->ageProbs[i - 1];
     }
 
 	// read in male percentage of cohort
 	readAndSkipPast( "InitGender", inputFile );
-	fscanf( inputFile, "%lf", &cohortInputs.maleGenderDistribution );
+	inputFile->scan( "%lf", &cohortInputs->maleGenderDistribution );
 	// read in OI proph noncompliance prob and degree
 	readAndSkipPast( "ProphNonCompliance", inputFile );
-	fscanf( inputFile, "%lf %lf", &cohortInputs.OIProphNonComplianceRisk, &cohortInputs.OIProphNonComplianceDegree );
+	inputFile->scan( "%lf %lf", &cohortInputs->OIProphNonComplianceRisk, &cohortInputs->OIProphNonComplianceDegree );
 
 	// read in distribution of clinic visit patient types
 	readAndSkipPast( "PatClinicTypes", inputFile );
 	dTemp = 1.0;
 	for ( i = 0; i < CLINIC_VISITS_NUM - 1; ++i ) {
-		fscanf( inputFile, "%lf", &(cohortInputs.clinicVisitTypeDistribution[i]) );
-		dTemp -= cohortInputs.clinicVisitTypeDistribution[i];
+		inputFile->scan( "%lf", &(cohortInputs->clinicVisitTypeDistribution[i]) );
+		dTemp -= cohortInputs->clinicVisitTypeDistribution[i];
 	}
-	cohortInputs.clinicVisitTypeDistribution[CLINIC_VISITS_NUM - 1] = dTemp;
+	cohortInputs->clinicVisitTypeDistribution[CLINIC_VISITS_NUM - 1] = dTemp;
 	// read in distribution of proph and ART implement patient types
 	readAndSkipPast( "PatTreatmentTypes", inputFile );
 	dTemp = 1.0;
 	for ( i = 0; i < THERAPY_IMPL_NUM - 1; ++i ) {
-		fscanf( inputFile, "%lf", &(cohortInputs.therapyImplementationDistribution[i]) );
-		dTemp -= cohortInputs.therapyImplementationDistribution[i];
+		inputFile->scan( "%lf", &(cohortInputs->therapyImplementationDistribution[i]) );
+		dTemp -= cohortInputs->therapyImplementationDistribution[i];
 	}
-	cohortInputs.therapyImplementationDistribution[THERAPY_IMPL_NUM - 1] = dTemp;
+	cohortInputs->therapyImplementationDistribution[THERAPY_IMPL_NUM - 1] = dTemp;
 	// read in distribution of CD4 response types on ART
 	readAndSkipPast("PatCD4ResponeTypeOnART", inputFile);
 	dTemp = 1.0;
 	for (i = 0; i < CD4_RESPONSE_NUM_TYPES - 1; i++) {
-		fscanf(inputFile, "%lf", &(cohortInputs.CD4ResponseTypeOnARTDistribution[i]));
-		dTemp -= cohortInputs.CD4ResponseTypeOnARTDistribution[i];
+		inputFile->scan("%lf", &(cohortInputs->CD4ResponseTypeOnARTDistribution[i]));
+		dTemp -= cohortInputs->CD4ResponseTypeOnARTDistribution[i];
 	}
-	cohortInputs.CD4ResponseTypeOnARTDistribution[CD4_RESPONSE_NUM_TYPES - 1] = dTemp;
+	cohortInputs->CD4ResponseTypeOnARTDistribution[CD4_RESPONSE_NUM_TYPES - 1] = dTemp;
 
 	// read in popul prob of prev OI histories
 	readAndSkipPast( "PriorOIHistAtEntry", inputFile );
@@ -449,420 +1373,420 @@ void SimContext::readCohortInputs() {
 		for ( k = HVL_NUM_STRATA - 1; k >= 0; --k ) {
 			readAndSkipPast( HVL_STRATA_STRS[k], inputFile );
 			for ( j = CD4_NUM_STRATA - 1; j >= 0; --j )
-				fscanf( inputFile, "%lf", &(cohortInputs.probOIHistoryAtEntry[j][k][i]) );
+				inputFile->scan( "%lf", &(cohortInputs->probOIHistoryAtEntry[j][k][i]) );
 		}
 	}
 
 	// read in prevalence and incidence of generic risk factors, along with string labels for them 
 	readAndSkipPast("ProbRiskFactorPrev", inputFile);
 	for (int i = 0; i < RISK_FACT_NUM; i++) {
-		fscanf(inputFile, "%lf ", &(cohortInputs.probRiskFactorPrev[i]));
+		inputFile->scan("%lf ", &(cohortInputs->probRiskFactorPrev[i]));
 	}
 	readAndSkipPast("ProbRiskFactorIncid", inputFile);
 	for (int i = 0; i < RISK_FACT_NUM; i++) {
-		fscanf(inputFile, "%lf ", &(cohortInputs.probRiskFactorIncid[i]));
+		inputFile->scan("%lf ", &(cohortInputs->probRiskFactorIncid[i]));
 	}
 	readAndSkipPast( "GenRiskFactorStrs", inputFile);
 	for (int i = 0; i < RISK_FACT_NUM; i++) {
-		fscanf( inputFile, "%32s", RISK_FACT_STRS[i] );
+		inputFile->scan( "%32s", RISK_FACT_STRS[i] );
 		strcpy(DTH_CAUSES_STRS[DTH_RISK_1 + i], RISK_FACT_STRS[i]);
 	}
 
 	//Read in transmission inputs
 	readAndSkipPast("ShowTransmissionOutput", inputFile);
-	fscanf(inputFile, "%d", &tempBool);
-	cohortInputs.showTransmissionOutput = (bool) tempBool;
+	inputFile->scan("%d", &tempBool);
+	cohortInputs->showTransmissionOutput = (bool) tempBool;
 
 	for ( k = HVL_NUM_STRATA - 1; k >= 0; --k ) {
 		readAndSkipPast2( "TransmissionRateOnART", HVL_STRATA_STRS[k], inputFile );
 		for ( j = CD4_NUM_STRATA - 1; j >= 0; --j )
-			fscanf( inputFile, "%lf", &(cohortInputs.transmRateOnART[j][k]) );
+			inputFile->scan( "%lf", &(cohortInputs->transmRateOnART[j][k]) );
 	}
 	readAndSkipPast2( "TransmissionRateOnART", "Acute", inputFile );
 	for ( j = CD4_NUM_STRATA - 1; j >= 0; --j )
-		fscanf( inputFile, "%lf", &(cohortInputs.transmRateOnARTAcute[j]) );
+		inputFile->scan( "%lf", &(cohortInputs->transmRateOnARTAcute[j]) );
 
 	for ( k = HVL_NUM_STRATA - 1; k >= 0; --k ) {
 		readAndSkipPast2( "TransmissionRateOffART", HVL_STRATA_STRS[k], inputFile );
 		for ( j = CD4_NUM_STRATA - 1; j >= 0; --j )
-			fscanf( inputFile, "%lf", &(cohortInputs.transmRateOffART[j][k]) );
+			inputFile->scan( "%lf", &(cohortInputs->transmRateOffART[j][k]) );
 	}
 	readAndSkipPast2( "TransmissionRateOffART", "Acute", inputFile );
 	for ( j = CD4_NUM_STRATA - 1; j >= 0; --j )
-		fscanf( inputFile, "%lf", &(cohortInputs.transmRateOffARTAcute[j]) );
+		inputFile->scan( "%lf", &(cohortInputs->transmRateOffARTAcute[j]) );
 
 	readAndSkipPast("TransmissionUseHIVTestAcuteDef", inputFile);
-	fscanf(inputFile, "%d", &tempBool);
-	cohortInputs.transmUseHIVTestAcuteDefinition = (bool) tempBool;
+	inputFile->scan("%d", &tempBool);
+	cohortInputs->transmUseHIVTestAcuteDefinition = (bool) tempBool;
 
 	readAndSkipPast("TransmissionAcuteDuration", inputFile);
-	fscanf(inputFile, "%d", &(cohortInputs.transmAcuteDuration));
+	inputFile->scan("%d", &(cohortInputs->transmAcuteDuration));
 
 	readAndSkipPast("IntvlTransmissionRateMultiplier", inputFile);
 	for (i = 0; i < 2; i++)
-		fscanf(inputFile, "%d", &(cohortInputs.transmRateMultInterval[i]));
+		inputFile->scan("%d", &(cohortInputs->transmRateMultInterval[i]));
 
 	readAndSkipPast("TransmissionRateMultiplier", inputFile);
 	for (i = 0; i < 3; i++)
-		fscanf(inputFile, "%lf", &(cohortInputs.transmRateMult[i]));
+		inputFile->scan("%lf", &(cohortInputs->transmRateMult[i]));
 
 	for ( i = 0; i < TRANSM_RISK_NUM; i++){
 		readAndSkipPast2("TransmissionRiskDistribution", TRANSM_RISK_STRS[i], inputFile);
 		for (j = 0; j < TRANSM_RISK_AGE_NUM; j++){
-			fscanf(inputFile, "%lf", &(cohortInputs.transmRiskDistrib[GENDER_MALE][j][i]));
+			inputFile->scan("%lf", &(cohortInputs->transmRiskDistrib[GENDER_MALE][j][i]));
 		}
 		for (j = 0; j < TRANSM_RISK_AGE_NUM; j++){
-			fscanf(inputFile, "%lf", &(cohortInputs.transmRiskDistrib[GENDER_FEMALE][j][i]));
+			inputFile->scan("%lf", &(cohortInputs->transmRiskDistrib[GENDER_FEMALE][j][i]));
 		}
 	}
 
 	readAndSkipPast("TransmissionRiskMultiplierBounds", inputFile);
 	for ( i = 0; i < 2; i++){
-		fscanf( inputFile, "%d", &(cohortInputs.transmRiskMultBounds[i]));
+		inputFile->scan( "%d", &(cohortInputs->transmRiskMultBounds[i]));
 	}
 
 	for (i = 0; i < 3; i++){
 		sprintf(scratch, "TransmissionRiskMultiplier_T%d", i + 1);
 		readAndSkipPast(scratch, inputFile);
 		for ( j = 0; j < TRANSM_RISK_NUM; j++){
-			fscanf( inputFile, "%lf", &(cohortInputs.transmRiskMult[j][i]));
+			inputFile->scan( "%lf", &(cohortInputs->transmRiskMult[j][i]));
 		}
 	}
 
 	readAndSkipPast("UseDynamicTransmission", inputFile);
-	fscanf(inputFile, "%d", &tempBool);
-	cohortInputs.useDynamicTransm = (bool) tempBool;
-	cohortInputs.updateDynamicTransmInc = true;
+	inputFile->scan("%d", &tempBool);
+	cohortInputs->useDynamicTransm = (bool) tempBool;
+	cohortInputs->updateDynamicTransmInc = true;
 
 	readAndSkipPast("DynamicTransmissionNumTransmissionsHRG", inputFile);
-	fscanf(inputFile, "%lf", &(cohortInputs.dynamicTransmHRGTransmissions));
+	inputFile->scan("%lf", &(cohortInputs->dynamicTransmHRGTransmissions));
 	readAndSkipPast("DynamicTransmissionPropHRGAttrib", inputFile);
-	fscanf(inputFile, "%lf", &(cohortInputs.dynamicTransmPropHRGAttributable));
+	inputFile->scan("%lf", &(cohortInputs->dynamicTransmPropHRGAttributable));
 	readAndSkipPast("DynamicTransmissionNumHIVPosHRG", inputFile);
-	fscanf(inputFile, "%lf", &(cohortInputs.dynamicTransmNumHIVPosHRG));
+	inputFile->scan("%lf", &(cohortInputs->dynamicTransmNumHIVPosHRG));
 	readAndSkipPast("DynamicTransmissionNumHIVNegHRG", inputFile);
-	fscanf(inputFile, "%lf", &(cohortInputs.dynamicTransmNumHIVNegHRG));
+	inputFile->scan("%lf", &(cohortInputs->dynamicTransmNumHIVNegHRG));
 	readAndSkipPast("DynamicTransmissionWarmupSize", inputFile);
-	fscanf(inputFile, "%d", &(cohortInputs.dynamicTransmWarmupSize));
+	inputFile->scan("%d", &(cohortInputs->dynamicTransmWarmupSize));
 
 	readAndSkipPast("DynamicTransmissionKeepPrEPAfterWarmup", inputFile);
-	fscanf(inputFile, "%d", &tempBool);
-	cohortInputs.keepPrEPAfterWarmup = (bool) tempBool;
+	inputFile->scan("%d", &tempBool);
+	cohortInputs->keepPrEPAfterWarmup = (bool) tempBool;
 	readAndSkipPast("DynamicTransmissionUsePrEPDuringWarmup", inputFile);
-	fscanf(inputFile, "%d", &tempBool);
-	cohortInputs.usePrEPDuringWarmup = (bool) tempBool;
+	inputFile->scan("%d", &tempBool);
+	cohortInputs->usePrEPDuringWarmup = (bool) tempBool;
 
 	readAndSkipPast("TransmissionUseEndLifeHVLAdjust", inputFile);
-	fscanf(inputFile, "%d", &tempBool);
-	cohortInputs.useTransmEndLifeHVLAdjustment = (bool) tempBool;
+	inputFile->scan("%d", &tempBool);
+	cohortInputs->useTransmEndLifeHVLAdjustment = (bool) tempBool;
 
 	readAndSkipPast("TransmissionEndLifeAdjustCD4Threshold", inputFile);
-	fscanf(inputFile, "%lf", &(cohortInputs.transmEndLifeHVLAdjustmentCD4Threshold));
+	inputFile->scan("%lf", &(cohortInputs->transmEndLifeHVLAdjustmentCD4Threshold));
 
 	readAndSkipPast("TransmissionEndLifeAdjustARTLineThreshold", inputFile);
-	fscanf(inputFile, "%d", &tempInt);
-	cohortInputs.transmEndLifeHVLAdjustmentARTLineThreshold = tempInt - 1;
+	inputFile->scan("%d", &tempInt);
+	cohortInputs->transmEndLifeHVLAdjustmentARTLineThreshold = tempInt - 1;
 } /* end readCohortInputs */
 
 /* readTreatmentInputsPart1 reads data from the Treatment tab of the input sheet, 
 	split in the middle for the reading of ARTs tab */
-void SimContext::readTreatmentInputsPart1() {
+void SimContext::readTreatmentInputsPart1(InputReader *inputFile) {
 	int i, j, tempBool;
 
 	// read in clinic visit interval
 	readAndSkipPast( "IntvlClinicVisit", inputFile );
-	fscanf( inputFile, "%d", &(treatmentInputs.clinicVisitInterval) );
+	inputFile->scan( "%d", &(treatmentInputs->clinicVisitInterval) );
 	// read in probabilities of detecting patient's prior OI history
 	readAndSkipPast( "ProbDetOI_Entry", inputFile );
 	for ( j = 0; j < OI_NUM; ++j )
-		fscanf( inputFile, "%lf", &(treatmentInputs.probDetectOIAtEntry[j]) );
+		inputFile->scan( "%lf", &(treatmentInputs->probDetectOIAtEntry[j]) );
 	readAndSkipPast( "ProbDetOI_LastVst", inputFile );
 	for ( j = 0; j < OI_NUM; ++j )
-		fscanf( inputFile, "%lf", &(treatmentInputs.probDetectOISinceLastVisit[j]) );
+		inputFile->scan( "%lf", &(treatmentInputs->probDetectOISinceLastVisit[j]) );
 	// read in probabilities of switching to secondary proph at OI event
 	readAndSkipPast( "ProbSwitchSecProph", inputFile );
 	for ( j = 0; j < OI_NUM; ++j )
-		fscanf( inputFile, "%lf", &(treatmentInputs.probSwitchSecondaryProph[j]) );
+		inputFile->scan( "%lf", &(treatmentInputs->probSwitchSecondaryProph[j]) );
 
 	// read in CD4 and on ART months thresholds used for testing frequency
 	readAndSkipPast( "IntvlCD4Tst_CD4Threshold", inputFile );
-	fscanf( inputFile, "%lf", &treatmentInputs.testingIntervalCD4Threshold );
+	inputFile->scan( "%lf", &treatmentInputs->testingIntervalCD4Threshold );
 	readAndSkipPast("IntvlCD4Tst_MonthsThreshold", inputFile);
-	fscanf( inputFile, "%d %d", &treatmentInputs.testingIntervalARTMonthsThreshold,
-			&treatmentInputs.testingIntervalLastARTMonthsThreshold);
+	inputFile->scan( "%d %d", &treatmentInputs->testingIntervalARTMonthsThreshold,
+			&treatmentInputs->testingIntervalLastARTMonthsThreshold);
 	// read in CD4/HVL test intervals
 	readAndSkipPast( "IntvlCD4Tst", inputFile );
-	fscanf( inputFile, "%d %d %d %d %d %d %d",
-		&treatmentInputs.CD4TestingIntervalPreARTHighCD4, &treatmentInputs.CD4TestingIntervalPreARTLowCD4,
-		&treatmentInputs.CD4TestingIntervalOnART[0], &treatmentInputs.CD4TestingIntervalOnART[1],
-		&treatmentInputs.CD4TestingIntervalOnLastART[0], &treatmentInputs.CD4TestingIntervalOnLastART[1],
-		&treatmentInputs.CD4TestingIntervalPostART);
+	inputFile->scan( "%d %d %d %d %d %d %d",
+		&treatmentInputs->CD4TestingIntervalPreARTHighCD4, &treatmentInputs->CD4TestingIntervalPreARTLowCD4,
+		&treatmentInputs->CD4TestingIntervalOnART[0], &treatmentInputs->CD4TestingIntervalOnART[1],
+		&treatmentInputs->CD4TestingIntervalOnLastART[0], &treatmentInputs->CD4TestingIntervalOnLastART[1],
+		&treatmentInputs->CD4TestingIntervalPostART);
 	readAndSkipPast( "IntvlHVLTst", inputFile );
-	fscanf( inputFile, "%d %d %d %d %d %d %d",
-		&treatmentInputs.HVLTestingIntervalPreARTHighCD4, &treatmentInputs.HVLTestingIntervalPreARTLowCD4,
-		&treatmentInputs.HVLTestingIntervalOnART[0], &treatmentInputs.HVLTestingIntervalOnART[1],
-		&treatmentInputs.HVLTestingIntervalOnLastART[0], &treatmentInputs.HVLTestingIntervalOnLastART[1],
-		&treatmentInputs.HVLTestingIntervalPostART );
+	inputFile->scan( "%d %d %d %d %d %d %d",
+		&treatmentInputs->HVLTestingIntervalPreARTHighCD4, &treatmentInputs->HVLTestingIntervalPreARTLowCD4,
+		&treatmentInputs->HVLTestingIntervalOnART[0], &treatmentInputs->HVLTestingIntervalOnART[1],
+		&treatmentInputs->HVLTestingIntervalOnLastART[0], &treatmentInputs->HVLTestingIntervalOnLastART[1],
+		&treatmentInputs->HVLTestingIntervalPostART );
 
 	// read in HVL test err prob (lower & higher)
 	readAndSkipPast( "HVLtestErrProb", inputFile );
-	fscanf( inputFile, "%lf %lf", &treatmentInputs.probHVLTestErrorHigher, &treatmentInputs.probHVLTestErrorLower );
+	inputFile->scan( "%lf %lf", &treatmentInputs->probHVLTestErrorHigher, &treatmentInputs->probHVLTestErrorLower );
 	// read in CD4 test err deviation and bias
 	readAndSkipPast( "CD4testErrSDev", inputFile );
-	fscanf( inputFile, "%lf", &treatmentInputs.CD4TestStdDevPercentage );
+	inputFile->scan( "%lf", &treatmentInputs->CD4TestStdDevPercentage );
 	readAndSkipPast( "CD4testBiasMean", inputFile );
-	fscanf( inputFile, "%lf", &treatmentInputs.CD4TestBiasMean );
+	inputFile->scan( "%lf", &treatmentInputs->CD4TestBiasMean );
 	readAndSkipPast( "CD4testBiasSdev", inputFile );
-	fscanf( inputFile, "%lf", &treatmentInputs.CD4TestBiasStdDevPercentage );
+	inputFile->scan( "%lf", &treatmentInputs->CD4TestBiasStdDevPercentage );
 
 	// read in whether to perform ART obsv fail CD4/HVL tests outside clinic visit
 	readAndSkipPast( "ObsvARTFailTestOnRegClinicVst", inputFile );
-	fscanf( inputFile, "%d", &tempBool);
-	treatmentInputs.ARTFailureOnlyAtRegularVisit = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool);
+	treatmentInputs->ARTFailureOnlyAtRegularVisit = (bool) tempBool;
 	// read in numbers of CD4/HVL tests outside clinic visit at ART initiation
 	readAndSkipPast( "ARTInitHVLTestsWOClinicVst", inputFile );
-	fscanf( inputFile, "%d", &treatmentInputs.numARTInitialHVLTests );
+	inputFile->scan( "%d", &treatmentInputs->numARTInitialHVLTests );
 	readAndSkipPast( "ARTInitCD4TestsWOClinicVst", inputFile );
-	fscanf( inputFile, "%d", &treatmentInputs.numARTInitialCD4Tests );
+	inputFile->scan( "%d", &treatmentInputs->numARTInitialCD4Tests );
 	// read in if OI visits are not treated as regular clinic visits
 	readAndSkipPast( "OIVstAsNotSchedClinicVst", inputFile );
-	fscanf( inputFile, "%d", &tempBool);
-	treatmentInputs.emergencyVisitIsNotRegularVisit = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool);
+	treatmentInputs->emergencyVisitIsNotRegularVisit = (bool) tempBool;
 
 	// read in months to lag of cd4/hvl testing availability
 	readAndSkipPast( "LagToCD4Test", inputFile );
-	fscanf( inputFile, "%d", &treatmentInputs.CD4TestingLag );
+	inputFile->scan( "%d", &treatmentInputs->CD4TestingLag );
 	readAndSkipPast( "LagToHVLTest", inputFile );
-	fscanf( inputFile, "%d", &treatmentInputs.HVLTestingLag );
+	inputFile->scan( "%d", &treatmentInputs->HVLTestingLag );
 
 	//read in criteria to end CD4 monitoring for this line of ART
 	readAndSkipPast( "StopCD4MonitoringEnable", inputFile );
-	fscanf( inputFile, "%d", &tempBool);
-	treatmentInputs.cd4MonitoringStopEnable = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool);
+	treatmentInputs->cd4MonitoringStopEnable = (bool) tempBool;
 
 	readAndSkipPast( "StopCD4MonitoringThreshold", inputFile );
-	fscanf( inputFile, "%lf", &treatmentInputs.cd4MonitoringStopThreshold );
+	inputFile->scan( "%lf", &treatmentInputs->cd4MonitoringStopThreshold );
 	readAndSkipPast( "StopCD4MonitoringMthsPostARTInit", inputFile );
-	fscanf( inputFile, "%d", &treatmentInputs.cd4MonitoringStopMthsPostARTInit );
+	inputFile->scan( "%d", &treatmentInputs->cd4MonitoringStopMthsPostARTInit );
 
 	//ART starting criteria
 	// read in CD4 bounds
 	readAndSkipPast2( "ARTstart_CD4", "upp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(treatmentInputs.startART[i].CD4BoundsOnly[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->startART[i].CD4BoundsOnly[UPPER_BOUND]) );
 	readAndSkipPast2( "ARTstart_CD4", "lwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(treatmentInputs.startART[i].CD4BoundsOnly[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->startART[i].CD4BoundsOnly[LOWER_BOUND]) );
 	// read in HVL bounds to administer ARTs
 	readAndSkipPast2( "ARTstart_HVL", "upp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(treatmentInputs.startART[i].HVLBoundsOnly[UPPER_BOUND]) );
+		inputFile->scan( "%d", &(treatmentInputs->startART[i].HVLBoundsOnly[UPPER_BOUND]) );
 	readAndSkipPast2( "ARTstart_HVL", "lwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(treatmentInputs.startART[i].HVLBoundsOnly[LOWER_BOUND]) );
+		inputFile->scan( "%d", &(treatmentInputs->startART[i].HVLBoundsOnly[LOWER_BOUND]) );
 	// read in CD4 & HVL bounds to administer ARTs
 	readAndSkipPast2( "ARTstart_CD4HVL", "CD4upp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(treatmentInputs.startART[i].CD4BoundsWithHVL[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->startART[i].CD4BoundsWithHVL[UPPER_BOUND]) );
 	readAndSkipPast2( "ARTstart_CD4HVL", "CD4lwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(treatmentInputs.startART[i].CD4BoundsWithHVL[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->startART[i].CD4BoundsWithHVL[LOWER_BOUND]) );
 	readAndSkipPast2( "ARTstart_CD4HVL", "HVLupp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(treatmentInputs.startART[i].HVLBoundsWithCD4[UPPER_BOUND]) );
+		inputFile->scan( "%d", &(treatmentInputs->startART[i].HVLBoundsWithCD4[UPPER_BOUND]) );
 	readAndSkipPast2( "ARTstart_CD4HVL", "HVLlwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(treatmentInputs.startART[i].HVLBoundsWithCD4[LOWER_BOUND]) );
+		inputFile->scan( "%d", &(treatmentInputs->startART[i].HVLBoundsWithCD4[LOWER_BOUND]) );
 	// read in OI criteria to administer ARTs
 	for (j = 0; j < OI_NUM; ++j) {
 		readAndSkipPast2( "ARTstart_OIs", OI_STRS[j], inputFile );
 		for (i = 0; i < ART_NUM_LINES; ++i) {
-			fscanf( inputFile, "%d", &tempBool);
-			treatmentInputs.startART[i].OIHistory[j] = (bool) tempBool;
+			inputFile->scan( "%d", &tempBool);
+			treatmentInputs->startART[i].OIHistory[j] = (bool) tempBool;
 		}
 	}
 	readAndSkipPast2( "ARTstart_OIs", "numOIs", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(treatmentInputs.startART[i].numOIs) );
+		inputFile->scan( "%d", &(treatmentInputs->startART[i].numOIs) );
 	// read in CD4 & OI criteria to administer ARTs
 	readAndSkipPast2( "ARTstart_CD4OI", "CD4upp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(treatmentInputs.startART[i].CD4BoundsWithOIs[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->startART[i].CD4BoundsWithOIs[UPPER_BOUND]) );
 	readAndSkipPast2( "ARTstart_CD4OI", "CD4lwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(treatmentInputs.startART[i].CD4BoundsWithOIs[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->startART[i].CD4BoundsWithOIs[LOWER_BOUND]) );
 	for (j = 0; j < OI_NUM; ++j) {
 		readAndSkipPast2( "ARTstart_CD4OI", OI_STRS[j], inputFile );
 		for (i = 0; i < ART_NUM_LINES; ++i) {
-			fscanf( inputFile, "%d", &tempBool);
-			treatmentInputs.startART[i].OIHistoryWithCD4[j] = (bool) tempBool;
+			inputFile->scan( "%d", &tempBool);
+			treatmentInputs->startART[i].OIHistoryWithCD4[j] = (bool) tempBool;
 		}
 	}
 
 	readAndSkipPast2( "ARTstart", "obsvFailFPSuppression", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i){
-		fscanf( inputFile, "%d", &tempBool);
-		treatmentInputs.startART[i].ensureSuppFalsePositiveFailure = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		treatmentInputs->startART[i].ensureSuppFalsePositiveFailure = (bool) tempBool;
 	}
 
 	// read in minimum/maximum mth # to start ART
 	readAndSkipPast2( "ARTstart", "minMthNum", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(treatmentInputs.startART[i].minMonthNum) );
+		inputFile->scan( "%d", &(treatmentInputs->startART[i].minMonthNum) );
 
 	readAndSkipPast2( "ARTstart", "maxMthNum", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(treatmentInputs.startART[i].maxMonthNum) );
+		inputFile->scan( "%d", &(treatmentInputs->startART[i].maxMonthNum) );
 
 	readAndSkipPast2( "ARTstart", "MthsSincePrevRegStop", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(treatmentInputs.startART[i].monthsSincePrevRegimen) );
+		inputFile->scan( "%d", &(treatmentInputs->startART[i].monthsSincePrevRegimen) );
 } /* endReadTreatmentInputsPart1 */
 
 /* readTreatmentInputsPart2 reads data from the second half of the Treatment tab of the input sheet, split in the middle for the reading of ARTs tab */
-void SimContext::readTreatmentInputsPart2() {
+void SimContext::readTreatmentInputsPart2(InputReader *inputFile) {
 	int i, j, tempBool, tempInt;
 	char buffer[256];
 
 	// read in whether to enable interruption of ART
 	readAndSkipPast( "EnableSTIforART", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i ) {
-		fscanf( inputFile, "%d", &tempBool);
-		treatmentInputs.enableSTIForART[i] = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		treatmentInputs->enableSTIForART[i] = (bool) tempBool;
 	}
 
 	// ART Failure parameters
 	// read in # HVL lvls to incr for fail diag
 	readAndSkipPast( "ARTfail_hvlNumIncr", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.failART[i].HVLNumIncrease) );
+		inputFile->scan( "%d", &(treatmentInputs->failART[i].HVLNumIncrease) );
 	// read in absolute HVL counts for fail diag
 	readAndSkipPast( "ARTfail_hvlAbsol", inputFile );
 	readAndSkipPast( "uppBnd", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.failART[i].HVLBounds[UPPER_BOUND]) );
+		inputFile->scan( "%d", &(treatmentInputs->failART[i].HVLBounds[UPPER_BOUND]) );
 	readAndSkipPast( "ARTfail_hvlAbsol", inputFile );
 	readAndSkipPast( "lwrBnd", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.failART[i].HVLBounds[LOWER_BOUND]) );
+		inputFile->scan( "%d", &(treatmentInputs->failART[i].HVLBounds[LOWER_BOUND]) );
 	// read in true/false use HVL as setpoint for fail diag
 	readAndSkipPast( "ARTfail_hvlAtSetptAsFailDiag", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i ) {
-		fscanf( inputFile, "%d", &tempBool);
-		treatmentInputs.failART[i].HVLFailAtSetpoint = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		treatmentInputs->failART[i].HVLFailAtSetpoint = (bool) tempBool;
 	}
 	// read in # of months before using HVL criteria
 	readAndSkipPast( "ARTfail_hvlMthsFromInit", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.failART[i].HVLMonthsFromInit) );
+		inputFile->scan( "%d", &(treatmentInputs->failART[i].HVLMonthsFromInit) );
 	// read in CD4 percentage to decr for fail diag
 	readAndSkipPast( "ARTfail_cd4PercDrop", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.failART[i].CD4PercentageDrop) );
+		inputFile->scan( "%lf", &(treatmentInputs->failART[i].CD4PercentageDrop) );
 	// read in true/false use CD4 as below pre-ART nadir for fail diag
 	readAndSkipPast( "ARTfail_cd4BelowPreARTNadir", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i ) {
-		fscanf( inputFile, "%d", &tempBool);
-		treatmentInputs.failART[i].CD4BelowPreARTNadir = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		treatmentInputs->failART[i].CD4BelowPreARTNadir = (bool) tempBool;
 	}
 	// read in absolute CD4 counts as OR criteria for fail diag
 	readAndSkipPast( "ARTfail_cd4AbsolOR", inputFile );
 	readAndSkipPast( "uppBnd", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.failART[i].CD4BoundsOR[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->failART[i].CD4BoundsOR[UPPER_BOUND]) );
 	readAndSkipPast( "ARTfail_cd4AbsolOR", inputFile );
 	readAndSkipPast( "lwrBnd", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.failART[i].CD4BoundsOR[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->failART[i].CD4BoundsOR[LOWER_BOUND]) );
 	// read in absolute CD4 counts as AND criteria for fail diag
 	readAndSkipPast( "ARTfail_cd4AbsolAND", inputFile );
 	readAndSkipPast( "uppBnd", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.failART[i].CD4BoundsAND[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->failART[i].CD4BoundsAND[UPPER_BOUND]) );
 	readAndSkipPast( "ARTfail_cd4AbsolAND", inputFile );
 	readAndSkipPast( "lwrBnd", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.failART[i].CD4BoundsAND[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->failART[i].CD4BoundsAND[LOWER_BOUND]) );
 	// read in # of months before using CD4 criteria
 	readAndSkipPast( "ARTfail_cd4MthsFromInit", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.failART[i].CD4MonthsFromInit) );
+		inputFile->scan( "%d", &(treatmentInputs->failART[i].CD4MonthsFromInit) );
 	// read in whether to treat OI event as ART fail diag
 	for ( j = 0; j < OI_NUM; ++j ) {
 		readAndSkipPast( "ARTfail_OIs", inputFile );
 		readAndSkipPast( OI_STRS[j], inputFile );
 		for ( i = 0; i < ART_NUM_LINES; ++i ){
-			fscanf( inputFile, "%d", &tempInt);
-			treatmentInputs.failART[i].OIsEvent[j] = (ART_FAIL_BY_OI) tempInt;
+			inputFile->scan( "%d", &tempInt);
+			treatmentInputs->failART[i].OIsEvent[j] = (ART_FAIL_BY_OI) tempInt;
 		}
 	}
 	readAndSkipPast( "ARTfail_OIsMinNum", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.failART[i].OIsMinNum) );
+		inputFile->scan( "%d", &(treatmentInputs->failART[i].OIsMinNum) );
 	readAndSkipPast( "ARTfail_OIsMthsFromInit", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.failART[i].OIsMonthsFromInit) );
+		inputFile->scan( "%d", &(treatmentInputs->failART[i].OIsMonthsFromInit) );
 	// read in ART failure diagnoses criteria parameters
 	readAndSkipPast( "ARTfail_diagNumTestsFail", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.failART[i].diagnoseNumTestsFail) );
+		inputFile->scan( "%d", &(treatmentInputs->failART[i].diagnoseNumTestsFail) );
 	readAndSkipPast( "ARTfail_diagUseHVLTestsConfirm", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i ) {
-		fscanf( inputFile, "%d", &tempBool);
-		treatmentInputs.failART[i].diagnoseUseHVLTestsConfirm = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		treatmentInputs->failART[i].diagnoseUseHVLTestsConfirm = (bool) tempBool;
 	}
 	readAndSkipPast( "ARTfail_diagUseCD4TestsConfirm", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i ) {
-		fscanf( inputFile, "%d", &tempBool);
-		treatmentInputs.failART[i].diagnoseUseCD4TestsConfirm = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		treatmentInputs->failART[i].diagnoseUseCD4TestsConfirm = (bool) tempBool;
 	}
 	readAndSkipPast( "ARTfail_diagNumTestsConfirm", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.failART[i].diagnoseNumTestsConfirm) );
+		inputFile->scan( "%d", &(treatmentInputs->failART[i].diagnoseNumTestsConfirm) );
 
 	//read in ART stopping policy
 	// read in maximum number of months to be on ART
 	readAndSkipPast( "ARTstop_MaxMthsOnART", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.stopART[i].maxMonthsOnART));
+		inputFile->scan( "%d", &(treatmentInputs->stopART[i].maxMonthsOnART));
 	// read in stop on major toxicity
 	readAndSkipPast("ARTstop_MajorToxicity", inputFile);
 	for (i = 0; i < ART_NUM_LINES; i++) {
-		fscanf(inputFile, "%d", &tempBool);
-		treatmentInputs.stopART[i].withMajorToxicty = (bool) tempBool;
+		inputFile->scan("%d", &tempBool);
+		treatmentInputs->stopART[i].withMajorToxicty = (bool) tempBool;
 	}
 	// read in criteria to use after failure has been observed
 	readAndSkipPast( "ARTstop_OnFailImmed", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i ) {
-		fscanf( inputFile, "%d", &tempBool);
-		treatmentInputs.stopART[i].afterFailImmediate = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		treatmentInputs->stopART[i].afterFailImmediate = (bool) tempBool;
 	}
 	readAndSkipPast( "ARTstop_OnFailBelowCD4", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.stopART[i].afterFailCD4LowerBound));
+		inputFile->scan( "%lf", &(treatmentInputs->stopART[i].afterFailCD4LowerBound));
 	readAndSkipPast( "ARTstop_OnFailSevereOI", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i ) {
-		fscanf( inputFile, "%d", &tempBool);
-		treatmentInputs.stopART[i].afterFailWithSevereOI = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		treatmentInputs->stopART[i].afterFailWithSevereOI = (bool) tempBool;
 	}
 	readAndSkipPast( "ARTstop_OnFailMthsAfterObsv", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.stopART[i].afterFailMonthsFromObserved));
+		inputFile->scan( "%d", &(treatmentInputs->stopART[i].afterFailMonthsFromObserved));
 	// read in minimum month number to stop ART
 	readAndSkipPast( "ARTstop_OnFailMinMthNum", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.stopART[i].afterFailMinMonthNum) );
+		inputFile->scan( "%d", &(treatmentInputs->stopART[i].afterFailMinMonthNum) );
 	readAndSkipPast( "ARTstop_OnFailMthsFromInit", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.stopART[i].afterFailMonthsFromInit) );
+		inputFile->scan( "%d", &(treatmentInputs->stopART[i].afterFailMonthsFromInit) );
 
 	//Read in next line if stopping for major tox
 	readAndSkipPast( "ARTStopMajorToxNextLine", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i){
-		fscanf( inputFile, "%d", &tempInt);
+		inputFile->scan( "%d", &tempInt);
 		if (tempInt != NOT_APPL)
 			tempInt--;
-		treatmentInputs.stopART[i].nextLineAfterMajorTox = tempInt;
+		treatmentInputs->stopART[i].nextLineAfterMajorTox = tempInt;
 	}
 
 	// read in ART resistance penalty parameters
@@ -870,325 +1794,325 @@ void SimContext::readTreatmentInputsPart2() {
 		sprintf(buffer, "reg_%d", i + 1);
 		readAndSkipPast2("ARTresistRed_initSucc", buffer, inputFile);
 		for (j = 0; j < ART_NUM_LINES; j++) {
-			fscanf(inputFile, "%lf", &(treatmentInputs.ARTResistancePriorRegimen[i][j]));
+			inputFile->scan("%lf", &(treatmentInputs->ARTResistancePriorRegimen[i][j]));
 		}
 	}
 	readAndSkipPast( "ARTresistRed_HVL", inputFile );
 	for (i = HVL_NUM_STRATA - 1; i >= 0; --i) {
-		fscanf(inputFile, "%lf", &(treatmentInputs.ARTResistanceHVL[i]));
+		inputFile->scan("%lf", &(treatmentInputs->ARTResistanceHVL[i]));
 	}
 
 	// read in primary OI proph regimen starting criteria
 	readAndSkipPast( "PriProphStart", inputFile );
 	readAndSkipPast( "boolFlag", inputFile );
 	for ( i = 0; i < OI_NUM; ++i ) {
-		fscanf( inputFile, "%d", &tempBool);
-		treatmentInputs.startProph[PROPH_PRIMARY][i].useOrEvaluation = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		treatmentInputs->startProph[PROPH_PRIMARY][i].useOrEvaluation = (bool) tempBool;
 	}
 	readAndSkipPast( "PriProphStart", inputFile );
 	readAndSkipPast( "curCD4upp", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.startProph[PROPH_PRIMARY][i].currCD4Bounds[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->startProph[PROPH_PRIMARY][i].currCD4Bounds[UPPER_BOUND]) );
 	readAndSkipPast( "PriProphStart", inputFile );
 	readAndSkipPast( "curCD4lwr", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.startProph[PROPH_PRIMARY][i].currCD4Bounds[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->startProph[PROPH_PRIMARY][i].currCD4Bounds[LOWER_BOUND]) );
 	readAndSkipPast( "PriProphStart", inputFile );
 	readAndSkipPast( "minCD4upp", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.startProph[PROPH_PRIMARY][i].minCD4Bounds[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->startProph[PROPH_PRIMARY][i].minCD4Bounds[UPPER_BOUND]) );
 	readAndSkipPast( "PriProphStart", inputFile );
 	readAndSkipPast( "minCD4lwr", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.startProph[PROPH_PRIMARY][i].minCD4Bounds[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->startProph[PROPH_PRIMARY][i].minCD4Bounds[LOWER_BOUND]) );
 	for ( j = 0; j < OI_NUM; ++j ) {
 		readAndSkipPast( "PriProphStart", inputFile );
 		readAndSkipPast( OI_STRS[j], inputFile );
 		for ( i = 0; i < OI_NUM; ++i )
-			fscanf( inputFile, "%d", &(treatmentInputs.startProph[PROPH_PRIMARY][i].OIHistory[j]) );
+			inputFile->scan( "%d", &(treatmentInputs->startProph[PROPH_PRIMARY][i].OIHistory[j]) );
 	}
 	readAndSkipPast( "PriProphStart", inputFile );
 	readAndSkipPast( "minMthNum", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.startProph[PROPH_PRIMARY][i].minMonthNum) );
+		inputFile->scan( "%d", &(treatmentInputs->startProph[PROPH_PRIMARY][i].minMonthNum) );
 
 	// read in primary OI proph regimen stopping criteria
 	readAndSkipPast( "PriProphStop", inputFile );
 	readAndSkipPast( "boolFlag", inputFile );
 	for ( i = 0; i < OI_NUM; ++i ) {
-		fscanf( inputFile, "%d", &tempBool);
-		treatmentInputs.stopProph[PROPH_PRIMARY][i].useOrEvaluation = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		treatmentInputs->stopProph[PROPH_PRIMARY][i].useOrEvaluation = (bool) tempBool;
 	}
 	readAndSkipPast( "PriProphStop", inputFile );
 	readAndSkipPast( "curCD4upp", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.stopProph[PROPH_PRIMARY][i].currCD4Bounds[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->stopProph[PROPH_PRIMARY][i].currCD4Bounds[UPPER_BOUND]) );
 	readAndSkipPast( "PriProphStop", inputFile );
 	readAndSkipPast( "curCD4lwr", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.stopProph[PROPH_PRIMARY][i].currCD4Bounds[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->stopProph[PROPH_PRIMARY][i].currCD4Bounds[LOWER_BOUND]) );
 	readAndSkipPast( "PriProphStop", inputFile );
 	readAndSkipPast( "minCD4upp", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.stopProph[PROPH_PRIMARY][i].minCD4Bounds[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->stopProph[PROPH_PRIMARY][i].minCD4Bounds[UPPER_BOUND]) );
 	readAndSkipPast( "PriProphStop", inputFile );
 	readAndSkipPast( "minCD4lwr", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.stopProph[PROPH_PRIMARY][i].minCD4Bounds[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->stopProph[PROPH_PRIMARY][i].minCD4Bounds[LOWER_BOUND]) );
 	for ( j = 0; j < OI_NUM; ++j ) {
 		readAndSkipPast( "PriProphStop", inputFile );
 		readAndSkipPast( OI_STRS[j], inputFile );
 		for ( i = 0; i < OI_NUM; ++i )
-			fscanf( inputFile, "%d", &(treatmentInputs.stopProph[PROPH_PRIMARY][i].OIHistory[j]) );
+			inputFile->scan( "%d", &(treatmentInputs->stopProph[PROPH_PRIMARY][i].OIHistory[j]) );
 	}
 	readAndSkipPast( "PriProphStop", inputFile );
 	readAndSkipPast( "minMthNum", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.stopProph[PROPH_PRIMARY][i].minMonthNum) );
+		inputFile->scan( "%d", &(treatmentInputs->stopProph[PROPH_PRIMARY][i].minMonthNum) );
 	readAndSkipPast( "PriProphStop", inputFile );
 	readAndSkipPast( "mthsOnProph", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.stopProph[PROPH_PRIMARY][i].monthsOnProph) );
+		inputFile->scan( "%d", &(treatmentInputs->stopProph[PROPH_PRIMARY][i].monthsOnProph) );
 
 	// read in secondart OI proph regimen starting criteria
 	readAndSkipPast( "SecProphStart", inputFile );
 	readAndSkipPast( "boolFlag", inputFile );
 	for ( i = 0; i < OI_NUM; ++i ){
-		fscanf( inputFile, "%d", &tempBool);
-		treatmentInputs.startProph[PROPH_SECONDARY][i].useOrEvaluation = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		treatmentInputs->startProph[PROPH_SECONDARY][i].useOrEvaluation = (bool) tempBool;
 	}	
 	readAndSkipPast( "SecProphStart", inputFile );
 	readAndSkipPast( "curCD4upp", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.startProph[PROPH_SECONDARY][i].currCD4Bounds[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->startProph[PROPH_SECONDARY][i].currCD4Bounds[UPPER_BOUND]) );
 	readAndSkipPast( "SecProphStart", inputFile );
 	readAndSkipPast( "curCD4lwr", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.startProph[PROPH_SECONDARY][i].currCD4Bounds[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->startProph[PROPH_SECONDARY][i].currCD4Bounds[LOWER_BOUND]) );
 	readAndSkipPast( "SecProphStart", inputFile );
 	readAndSkipPast( "minCD4upp", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.startProph[PROPH_SECONDARY][i].minCD4Bounds[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->startProph[PROPH_SECONDARY][i].minCD4Bounds[UPPER_BOUND]) );
 	readAndSkipPast( "SecProphStart", inputFile );
 	readAndSkipPast( "minCD4lwr", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.startProph[PROPH_SECONDARY][i].minCD4Bounds[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->startProph[PROPH_SECONDARY][i].minCD4Bounds[LOWER_BOUND]) );
 	for ( j = 0; j < OI_NUM; ++j ) {
 		readAndSkipPast( "SecProphStart", inputFile );
 		readAndSkipPast( OI_STRS[j], inputFile );
 		for ( i = 0; i < OI_NUM; ++i )
-			fscanf( inputFile, "%d", &(treatmentInputs.startProph[PROPH_SECONDARY][i].OIHistory[j]) );
+			inputFile->scan( "%d", &(treatmentInputs->startProph[PROPH_SECONDARY][i].OIHistory[j]) );
 	}
 	readAndSkipPast( "SecProphStart", inputFile );
 	readAndSkipPast( "minMthNum", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.startProph[PROPH_SECONDARY][i].minMonthNum) );
+		inputFile->scan( "%d", &(treatmentInputs->startProph[PROPH_SECONDARY][i].minMonthNum) );
 
 	// read in secondary OI proph regimen stopping criteria
 	readAndSkipPast( "SecProphStop", inputFile );
 	readAndSkipPast( "boolFlag", inputFile );
 	for ( i = 0; i < OI_NUM; ++i ){
-		fscanf( inputFile, "%d", &tempBool);
-		treatmentInputs.stopProph[PROPH_SECONDARY][i].useOrEvaluation = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		treatmentInputs->stopProph[PROPH_SECONDARY][i].useOrEvaluation = (bool) tempBool;
 	}	
 	readAndSkipPast( "SecProphStop", inputFile );
 	readAndSkipPast( "curCD4upp", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.stopProph[PROPH_SECONDARY][i].currCD4Bounds[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->stopProph[PROPH_SECONDARY][i].currCD4Bounds[UPPER_BOUND]) );
 	readAndSkipPast( "SecProphStop", inputFile );
 	readAndSkipPast( "curCD4lwr", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.stopProph[PROPH_SECONDARY][i].currCD4Bounds[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->stopProph[PROPH_SECONDARY][i].currCD4Bounds[LOWER_BOUND]) );
 	readAndSkipPast( "SecProphStop", inputFile );
 	readAndSkipPast( "minCD4upp", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.stopProph[PROPH_SECONDARY][i].minCD4Bounds[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->stopProph[PROPH_SECONDARY][i].minCD4Bounds[UPPER_BOUND]) );
 	readAndSkipPast( "SecProphStop", inputFile );
 	readAndSkipPast( "minCD4lwr", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(treatmentInputs.stopProph[PROPH_SECONDARY][i].minCD4Bounds[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(treatmentInputs->stopProph[PROPH_SECONDARY][i].minCD4Bounds[LOWER_BOUND]) );
 	for ( j = 0; j < OI_NUM; ++j ) {
 		readAndSkipPast( "SecProphStop", inputFile );
 		readAndSkipPast( OI_STRS[j], inputFile );
 		for ( i = 0; i < OI_NUM; ++i )
-			fscanf( inputFile, "%d", &(treatmentInputs.stopProph[PROPH_SECONDARY][i].OIHistory[j]) );
+			inputFile->scan( "%d", &(treatmentInputs->stopProph[PROPH_SECONDARY][i].OIHistory[j]) );
 	}
 	readAndSkipPast( "SecProphStop", inputFile );
 	readAndSkipPast( "minMthNum", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.stopProph[PROPH_SECONDARY][i].minMonthNum) );
+		inputFile->scan( "%d", &(treatmentInputs->stopProph[PROPH_SECONDARY][i].minMonthNum) );
 	readAndSkipPast( "SecProphStop", inputFile );
 	readAndSkipPast( "mthsOnProph", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%d", &(treatmentInputs.stopProph[PROPH_SECONDARY][i].monthsOnProph) );
+		inputFile->scan( "%d", &(treatmentInputs->stopProph[PROPH_SECONDARY][i].monthsOnProph) );
 } /* end readTreatmentInputsPart2 */
 
 /* readLTFUInputs reads data from the LTFU tab of the input sheet */
-void SimContext::readLTFUInputs() {
+void SimContext::readLTFUInputs(InputReader *inputFile) {
 	int tempBool;
 	char scratch[256];
 
 	// read in LTFU variables
 	readAndSkipPast( "UseLTFU", inputFile);
-	fscanf( inputFile, "%d", &tempBool);
-	ltfuInputs.useLTFU = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool);
+	ltfuInputs->useLTFU = (bool) tempBool;
 	readAndSkipPast( "PropRespLTFUPreART", inputFile);
-	fscanf( inputFile, "%lf %lf", &(ltfuInputs.propRespondLTFUPreARTLogitMean),
-		&(ltfuInputs.propRespondLTFUPreARTLogitStdDev));
+	inputFile->scan( "%lf %lf", &(ltfuInputs->propRespondLTFUPreARTLogitMean),
+		&(ltfuInputs->propRespondLTFUPreARTLogitStdDev));
 
 	readAndSkipPast( "UseInterventionHetOutcomes", inputFile);
-	fscanf( inputFile, "%d", &tempBool);
-	ltfuInputs.useInterventionLTFU = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool);
+	ltfuInputs->useInterventionLTFU = (bool) tempBool;
 
 	readAndSkipPast("HetOutcomes", inputFile);
 	readAndSkipPast("LTFU",inputFile);
-	fscanf(inputFile, "%lf %lf %lf %lf", &(ltfuInputs.responseThresholdLTFU[0]), &(ltfuInputs.responseThresholdLTFU[1]),&(ltfuInputs.responseValueLTFU[0]),&(ltfuInputs.responseValueLTFU[1]));
+	inputFile->scan("%lf %lf %lf %lf", &(ltfuInputs->responseThresholdLTFU[0]), &(ltfuInputs->responseThresholdLTFU[1]),&(ltfuInputs->responseValueLTFU[0]),&(ltfuInputs->responseValueLTFU[1]));
 
 	for (int i = 0; i < HET_INTV_NUM_PERIODS; i++){
 		sprintf( scratch, "HetOutcomesPeriod%d", i );
 		readAndSkipPast( scratch, inputFile );
 		readAndSkipPast("LTFU",inputFile);
-		fscanf(inputFile, "%lf %lf %lf %lf", &(ltfuInputs.responseThresholdPeriodLTFU[i][0]), &(ltfuInputs.responseThresholdPeriodLTFU[i][1]),
-				&(ltfuInputs.responseValuePeriodLTFU[i][0]),&(ltfuInputs.responseValuePeriodLTFU[i][1]));
+		inputFile->scan("%lf %lf %lf %lf", &(ltfuInputs->responseThresholdPeriodLTFU[i][0]), &(ltfuInputs->responseThresholdPeriodLTFU[i][1]),
+				&(ltfuInputs->responseValuePeriodLTFU[i][0]),&(ltfuInputs->responseValuePeriodLTFU[i][1]));
 	}
 
 	readAndSkipPast("HetOutcomesOffIntervention", inputFile);
 	readAndSkipPast("LTFU",inputFile);
-	fscanf(inputFile, "%lf %lf %lf %lf", &(ltfuInputs.responseThresholdLTFUOffIntervention[0]), &(ltfuInputs.responseThresholdLTFUOffIntervention[1]),
-			&(ltfuInputs.responseValueLTFUOffIntervention[0]),&(ltfuInputs.responseValueLTFUOffIntervention[1]));
+	inputFile->scan("%lf %lf %lf %lf", &(ltfuInputs->responseThresholdLTFUOffIntervention[0]), &(ltfuInputs->responseThresholdLTFUOffIntervention[1]),
+			&(ltfuInputs->responseValueLTFUOffIntervention[0]),&(ltfuInputs->responseValueLTFUOffIntervention[1]));
 
 
 	readAndSkipPast("PropGenMedCostsByState",inputFile);
-	fscanf(inputFile, "%lf %lf %lf %lf", &(ltfuInputs.propGeneralMedicineCost[HIV_CARE_UNDETECTED]), &(ltfuInputs.propGeneralMedicineCost[HIV_CARE_UNLINKED]), &(ltfuInputs.propGeneralMedicineCost[HIV_CARE_IN_CARE]), &(ltfuInputs.propGeneralMedicineCost[HIV_CARE_LTFU]));
-	ltfuInputs.propGeneralMedicineCost[HIV_CARE_NEG] = 1.0;
-	ltfuInputs.propGeneralMedicineCost[HIV_CARE_RTC] = ltfuInputs.propGeneralMedicineCost[HIV_CARE_IN_CARE];
+	inputFile->scan("%lf %lf %lf %lf", &(ltfuInputs->propGeneralMedicineCost[HIV_CARE_UNDETECTED]), &(ltfuInputs->propGeneralMedicineCost[HIV_CARE_UNLINKED]), &(ltfuInputs->propGeneralMedicineCost[HIV_CARE_IN_CARE]), &(ltfuInputs->propGeneralMedicineCost[HIV_CARE_LTFU]));
+	ltfuInputs->propGeneralMedicineCost[HIV_CARE_NEG] = 1.0;
+	ltfuInputs->propGeneralMedicineCost[HIV_CARE_RTC] = ltfuInputs->propGeneralMedicineCost[HIV_CARE_IN_CARE];
 
 	readAndSkipPast("PropInterventionCostsByState",inputFile);
-	fscanf(inputFile, "%lf %lf %lf %lf", &(ltfuInputs.propInterventionCost[HIV_CARE_UNDETECTED]), &(ltfuInputs.propInterventionCost[HIV_CARE_UNLINKED]),
-			&(ltfuInputs.propInterventionCost[HIV_CARE_IN_CARE]), &(ltfuInputs.propInterventionCost[HIV_CARE_LTFU]));
-	ltfuInputs.propInterventionCost[HIV_CARE_NEG] = 1.0;
-	ltfuInputs.propInterventionCost[HIV_CARE_RTC] = ltfuInputs.propInterventionCost[HIV_CARE_IN_CARE];
+	inputFile->scan("%lf %lf %lf %lf", &(ltfuInputs->propInterventionCost[HIV_CARE_UNDETECTED]), &(ltfuInputs->propInterventionCost[HIV_CARE_UNLINKED]),
+			&(ltfuInputs->propInterventionCost[HIV_CARE_IN_CARE]), &(ltfuInputs->propInterventionCost[HIV_CARE_LTFU]));
+	ltfuInputs->propInterventionCost[HIV_CARE_NEG] = 1.0;
+	ltfuInputs->propInterventionCost[HIV_CARE_RTC] = ltfuInputs->propInterventionCost[HIV_CARE_IN_CARE];
 
 
 	readAndSkipPast( "pLTFUOIProph", inputFile);
-	fscanf( inputFile, "%lf", &ltfuInputs.probRemainOnOIProph);
+	inputFile->scan( "%lf", &ltfuInputs->probRemainOnOIProph);
 	readAndSkipPast( "pLTFUOITreat", inputFile);
-	fscanf( inputFile, "%lf", &ltfuInputs.probRemainOnOITreatment);
+	inputFile->scan( "%lf", &ltfuInputs->probRemainOnOITreatment);
 
 	//Return to Care variables...
 	readAndSkipPast( "RTCMinMonthsLost", inputFile);
-	fscanf( inputFile, "%d", &ltfuInputs.minMonthsRemainLost);
+	inputFile->scan( "%d", &ltfuInputs->minMonthsRemainLost);
 	readAndSkipPast( "RTCBackground", inputFile);
-	fscanf( inputFile, "%lf", &(ltfuInputs.regressionCoefficientsRTC[RTC_BACKGROUND]));
+	inputFile->scan( "%lf", &(ltfuInputs->regressionCoefficientsRTC[RTC_BACKGROUND]));
 	readAndSkipPast( "RTCCD4", inputFile);
-	fscanf( inputFile, "%lf", &(ltfuInputs.regressionCoefficientsRTC[RTC_CD4]));
+	inputFile->scan( "%lf", &(ltfuInputs->regressionCoefficientsRTC[RTC_CD4]));
 	readAndSkipPast( "RTCAcuteSevereOI", inputFile);
-	fscanf( inputFile, "%lf", &(ltfuInputs.regressionCoefficientsRTC[RTC_ACUTESEVEREOI]));
+	inputFile->scan( "%lf", &(ltfuInputs->regressionCoefficientsRTC[RTC_ACUTESEVEREOI]));
 	readAndSkipPast( "RTCAcuteMildOI", inputFile);
-	fscanf( inputFile, "%lf", &(ltfuInputs.regressionCoefficientsRTC[RTC_ACUTEMILDOI]));
+	inputFile->scan( "%lf", &(ltfuInputs->regressionCoefficientsRTC[RTC_ACUTEMILDOI]));
 	readAndSkipPast( "RTCTBPosDiagnosis", inputFile);
-	fscanf( inputFile, "%lf", &(ltfuInputs.regressionCoefficientsRTC[RTC_TBPOS]));
+	inputFile->scan( "%lf", &(ltfuInputs->regressionCoefficientsRTC[RTC_TBPOS]));
 	readAndSkipPast( "RTCCD4Threshold", inputFile);
-	fscanf( inputFile, "%lf", &ltfuInputs.CD4ThresholdRTC);
+	inputFile->scan( "%lf", &ltfuInputs->CD4ThresholdRTC);
 	readAndSkipPast("RTCSevereOIType", inputFile);
 	for (int i = 0; i < OI_NUM; i++) {
-		fscanf(inputFile, "%d ", &tempBool);
-		ltfuInputs.severeOIsRTC[i] = (bool) tempBool;
+		inputFile->scan("%d ", &tempBool);
+		ltfuInputs->severeOIsRTC[i] = (bool) tempBool;
 	}
 	readAndSkipPast( "RTCMaxTimePrevOnART", inputFile);
-	fscanf( inputFile, "%d", &ltfuInputs.maxMonthsAfterObservedFailureToRestartRegimen);
+	inputFile->scan( "%d", &ltfuInputs->maxMonthsAfterObservedFailureToRestartRegimen);
 	readAndSkipPast( "RTCProbTakeSameART", inputFile);
-	fscanf( inputFile, "%lf", &ltfuInputs.probRestartRegimenWithoutObservedFailure);
+	inputFile->scan( "%lf", &ltfuInputs->probRestartRegimenWithoutObservedFailure);
 	readAndSkipPast( "RTCRecheckARTPolicies", inputFile);
-	fscanf( inputFile, "%d", &tempBool);
-	ltfuInputs.recheckARTStartPoliciesAtRTC = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool);
+	ltfuInputs->recheckARTStartPoliciesAtRTC = (bool) tempBool;
 
 	readAndSkipPast( "RTCProbSuppByPrevOutcome", inputFile);
-	fscanf( inputFile, "%d", &tempBool);
-	ltfuInputs.useProbSuppByPrevOutcome = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool);
+	ltfuInputs->useProbSuppByPrevOutcome = (bool) tempBool;
 	readAndSkipPast( "RTCProbSuppPrevFail", inputFile);
 	for (int i = 0; i < ART_NUM_LINES; i++) {
-		fscanf(inputFile, "%lf", &(ltfuInputs.probSuppressionWhenReturnToFailed[i]));
+		inputFile->scan("%lf", &(ltfuInputs->probSuppressionWhenReturnToFailed[i]));
 	}
 	readAndSkipPast( "RTCProbSuppPrevSupp", inputFile);
 	for (int i = 0; i < ART_NUM_LINES; i++) {
-		fscanf(inputFile, "%lf", &(ltfuInputs.probSuppressionWhenReturnToSuppressed[i]));
+		inputFile->scan("%lf", &(ltfuInputs->probSuppressionWhenReturnToSuppressed[i]));
 	}
 
 	readAndSkipPast( "RTCProbResumeIntervention", inputFile);
-	fscanf(inputFile, "%lf", &(ltfuInputs.probResumeInterventionRTC));
+	inputFile->scan("%lf", &(ltfuInputs->probResumeInterventionRTC));
 
 	readAndSkipPast( "RTCResumeInterventionCost", inputFile);
-	fscanf(inputFile, "%lf", &(ltfuInputs.costResumeInterventionRTC));
+	inputFile->scan("%lf", &(ltfuInputs->costResumeInterventionRTC));
 } /* end readLTFUInputs */
 
 /* readHeterogeneityInputs reads data from the Heterogeneity tab of the input sheet */
-void SimContext::readHeterogeneityInputs() {
+void SimContext::readHeterogeneityInputs(InputReader *inputFile) {
 	int tempBool, tempInt;
 	// read in the propensity to respond coefficients
 	readAndSkipPast("PropRespBaseline", inputFile);
-	fscanf(inputFile, "%lf %lf", &(heterogeneityInputs.propRespondBaselineLogitMean),
-			&(heterogeneityInputs.propRespondBaselineLogitStdDev));
+	inputFile->scan("%lf %lf", &(heterogeneityInputs->propRespondBaselineLogitMean),
+			&(heterogeneityInputs->propRespondBaselineLogitStdDev));
 	readAndSkipPast("PropRespAge", inputFile);
 	for (int i = 0; i < RESP_AGE_CAT_NUM; i++) {
-		fscanf(inputFile, "%lf ", &(heterogeneityInputs.propRespondAge[i]));
+		inputFile->scan("%lf ", &(heterogeneityInputs->propRespondAge[i]));
 	}
 
 	readAndSkipPast("PropRespPedsAge", inputFile);
-	fscanf(inputFile, "%lf %lf", &(heterogeneityInputs.propRespondAgeEarly),&(heterogeneityInputs.propRespondAgeLate));
+	inputFile->scan("%lf %lf", &(heterogeneityInputs->propRespondAgeEarly),&(heterogeneityInputs->propRespondAgeLate));
 
 	readAndSkipPast("PropRespCD4", inputFile);
 	for (int i = CD4_NUM_STRATA - 1; i >= 0; i--) {
-		fscanf(inputFile, "%lf ", &(heterogeneityInputs.propRespondCD4[i]));
+		inputFile->scan("%lf ", &(heterogeneityInputs->propRespondCD4[i]));
 	}
 	readAndSkipPast("PropRespFemale", inputFile);
-	fscanf(inputFile, "%lf", &(heterogeneityInputs.propRespondFemale));
+	inputFile->scan("%lf", &(heterogeneityInputs->propRespondFemale));
 	readAndSkipPast("PropRespHistOIs", inputFile);
-	fscanf(inputFile, "%lf", &(heterogeneityInputs.propRespondHistoryOIs));
+	inputFile->scan("%lf", &(heterogeneityInputs->propRespondHistoryOIs));
 	readAndSkipPast("PropRespPriorARTTox", inputFile);
-	fscanf(inputFile, "%lf", &(heterogeneityInputs.propRespondPriorARTToxicity));
+	inputFile->scan("%lf", &(heterogeneityInputs->propRespondPriorARTToxicity));
 	readAndSkipPast("PropRespRiskFactors", inputFile);
 	for (int i = 0; i < RISK_FACT_NUM; i++) {
-		fscanf(inputFile, "%lf ", &(heterogeneityInputs.propRespondRiskFactor[i]));
+		inputFile->scan("%lf ", &(heterogeneityInputs->propRespondRiskFactor[i]));
 	}
 
 	readAndSkipPast( "UseIntervention", inputFile);
 	for (int i = 0; i < HET_INTV_NUM_PERIODS; i++){
-		fscanf( inputFile, "%d", &tempBool);
-		heterogeneityInputs.useIntervention[i] = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		heterogeneityInputs->useIntervention[i] = (bool) tempBool;
 	}
 
 	readAndSkipPast("InterventionDurationMean", inputFile);
 	for (int i = 0; i < HET_INTV_NUM_PERIODS; i++)
-		fscanf(inputFile, "%lf", &(heterogeneityInputs.interventionDurationMean[i]));
+		inputFile->scan("%lf", &(heterogeneityInputs->interventionDurationMean[i]));
 	readAndSkipPast("InterventionDurationSD", inputFile);
 	for (int i = 0; i < HET_INTV_NUM_PERIODS; i++)
-		fscanf(inputFile, "%lf", &(heterogeneityInputs.interventionDurationSD[i]));
+		inputFile->scan("%lf", &(heterogeneityInputs->interventionDurationSD[i]));
 
 
 	readAndSkipPast("InterventionPropAdjustmentMean", inputFile);
 	for (int i = 0; i < HET_INTV_NUM_PERIODS; i++)
-		fscanf(inputFile, "%lf", &(heterogeneityInputs.interventionAdjustmentMean[i]));
+		inputFile->scan("%lf", &(heterogeneityInputs->interventionAdjustmentMean[i]));
 	readAndSkipPast("InterventionPropAdjustmentSD", inputFile);
 	for (int i = 0; i < HET_INTV_NUM_PERIODS; i++)
-		fscanf(inputFile, "%lf", &(heterogeneityInputs.interventionAdjustmentSD[i]));
+		inputFile->scan("%lf", &(heterogeneityInputs->interventionAdjustmentSD[i]));
 
 	readAndSkipPast("InterventionPropAdjustmentDistribution", inputFile);
 	for (int i = 0; i < HET_INTV_NUM_PERIODS; i++){
-		fscanf(inputFile, "%d", &tempInt);
-		heterogeneityInputs.interventionAdjustmentDistribution[i] = (HET_ART_LOGIT_DISTRIBUTION) tempInt;
+		inputFile->scan("%d", &tempInt);
+		heterogeneityInputs->interventionAdjustmentDistribution[i] = (HET_ART_LOGIT_DISTRIBUTION) tempInt;
 	}
 
 	readAndSkipPast("InterventionCostStartup", inputFile);
 	for (int i = 0; i < HET_INTV_NUM_PERIODS; i++)
-		fscanf(inputFile, "%lf", &(heterogeneityInputs.interventionCostInit[i]));
+		inputFile->scan("%lf", &(heterogeneityInputs->interventionCostInit[i]));
 	readAndSkipPast("InterventionCostMonthly", inputFile);
 	for (int i = 0; i < HET_INTV_NUM_PERIODS; i++)
-		fscanf(inputFile, "%lf", &(heterogeneityInputs.interventionCostMonthly[i]));
+		inputFile->scan("%lf", &(heterogeneityInputs->interventionCostMonthly[i]));
 } /* end readHeterogeneityInputs */
 
 /* readSTIInputs reads data from the STI tab of the input sheet */
-void SimContext::readSTIInputs() {
+void SimContext::readSTIInputs(InputReader *inputFile) {
 	char tmpBuf1[256], tmpBuf2[256];
 	int i, j, tempBool;
 
@@ -1196,152 +2120,152 @@ void SimContext::readSTIInputs() {
 	// read in CD4 bounds
 	readAndSkipPast2( "STIstart_CD4", "upp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(stiInputs.firstInterruption[i].CD4BoundsOnly[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(stiInputs->firstInterruption[i].CD4BoundsOnly[UPPER_BOUND]) );
 	readAndSkipPast2( "STIstart_CD4", "lwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(stiInputs.firstInterruption[i].CD4BoundsOnly[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(stiInputs->firstInterruption[i].CD4BoundsOnly[LOWER_BOUND]) );
 	// read in HVL bounds to begin STI
 	readAndSkipPast2( "STIstart_HVL", "upp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(stiInputs.firstInterruption[i].HVLBoundsOnly[UPPER_BOUND]) );
+		inputFile->scan( "%d", &(stiInputs->firstInterruption[i].HVLBoundsOnly[UPPER_BOUND]) );
 	readAndSkipPast2( "STIstart_HVL", "lwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(stiInputs.firstInterruption[i].HVLBoundsOnly[LOWER_BOUND]) );
+		inputFile->scan( "%d", &(stiInputs->firstInterruption[i].HVLBoundsOnly[LOWER_BOUND]) );
 	// read in CD4 & HVL bounds to begin STI
 	readAndSkipPast2( "STIstart_CD4HVL", "CD4upp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(stiInputs.firstInterruption[i].CD4BoundsWithHVL[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(stiInputs->firstInterruption[i].CD4BoundsWithHVL[UPPER_BOUND]) );
 	readAndSkipPast2( "STIstart_CD4HVL", "CD4lwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(stiInputs.firstInterruption[i].CD4BoundsWithHVL[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(stiInputs->firstInterruption[i].CD4BoundsWithHVL[LOWER_BOUND]) );
 	readAndSkipPast2( "STIstart_CD4HVL", "HVLupp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(stiInputs.firstInterruption[i].HVLBoundsWithCD4[UPPER_BOUND]) );
+		inputFile->scan( "%d", &(stiInputs->firstInterruption[i].HVLBoundsWithCD4[UPPER_BOUND]) );
 	readAndSkipPast2( "STIstart_CD4HVL", "HVLlwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(stiInputs.firstInterruption[i].HVLBoundsWithCD4[LOWER_BOUND]) );
+		inputFile->scan( "%d", &(stiInputs->firstInterruption[i].HVLBoundsWithCD4[LOWER_BOUND]) );
 	// read in OI criteria to begin STI
 	for (j = 0; j < OI_NUM; ++j) {
 		readAndSkipPast2( "STIstart_OIs", OI_STRS[j], inputFile );
 		for (i = 0; i < ART_NUM_LINES; ++i) {
-			fscanf( inputFile, "%d", &tempBool);
-			stiInputs.firstInterruption[i].OIHistory[j] = (bool) tempBool;
+			inputFile->scan( "%d", &tempBool);
+			stiInputs->firstInterruption[i].OIHistory[j] = (bool) tempBool;
 		}
 	}
 	readAndSkipPast2( "STIstart_OIs", "numOIs", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(stiInputs.firstInterruption[i].numOIs) );
+		inputFile->scan( "%d", &(stiInputs->firstInterruption[i].numOIs) );
 	// read in CD4 & OI criteria to begin STI
 	readAndSkipPast2( "STIstart_CD4OI", "CD4upp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(stiInputs.firstInterruption[i].CD4BoundsWithOIs[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(stiInputs->firstInterruption[i].CD4BoundsWithOIs[UPPER_BOUND]) );
 	readAndSkipPast2( "STIstart_CD4OI", "CD4lwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(stiInputs.firstInterruption[i].CD4BoundsWithOIs[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(stiInputs->firstInterruption[i].CD4BoundsWithOIs[LOWER_BOUND]) );
 	for (j = 0; j < OI_NUM; ++j) {
 		readAndSkipPast2( "STIstart_CD4OI", OI_STRS[j], inputFile );
 		for (i = 0; i < ART_NUM_LINES; ++i) {
-			fscanf( inputFile, "%d", &tempBool);
-			stiInputs.firstInterruption[i].OIHistoryWithCD4[j] = (bool) tempBool;
+			inputFile->scan( "%d", &tempBool);
+			stiInputs->firstInterruption[i].OIHistoryWithCD4[j] = (bool) tempBool;
 		}
 	}
 	// read in minimum mth # to beginSTI
 	readAndSkipPast2( "STIstart", "minMthNum", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(stiInputs.firstInterruption[i].minMonthNum) );
+		inputFile->scan( "%d", &(stiInputs->firstInterruption[i].minMonthNum) );
 	readAndSkipPast2( "STIstart", "minMthNum_ARTinit", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(stiInputs.firstInterruption[i].monthsSinceARTStart) );
+		inputFile->scan( "%d", &(stiInputs->firstInterruption[i].monthsSinceARTStart) );
 
 	// read in STI ART restarting parameters
 	readAndSkipPast2( "STI_restartART", "cd4upp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(stiInputs.ARTRestartCD4Bounds[i][UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(stiInputs->ARTRestartCD4Bounds[i][UPPER_BOUND]) );
 	readAndSkipPast2( "STI_restartART", "cd4lwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(stiInputs.ARTRestartCD4Bounds[i][LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(stiInputs->ARTRestartCD4Bounds[i][LOWER_BOUND]) );
 	readAndSkipPast2( "STI_restartART", "hvlupp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(stiInputs.ARTRestartHVLBounds[i][UPPER_BOUND]) );
+		inputFile->scan( "%d", &(stiInputs->ARTRestartHVLBounds[i][UPPER_BOUND]) );
 	readAndSkipPast2( "STI_restartART", "hvllwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(stiInputs.ARTRestartHVLBounds[i][LOWER_BOUND]) );
+		inputFile->scan( "%d", &(stiInputs->ARTRestartHVLBounds[i][LOWER_BOUND]) );
 
 	// read in STI ART successive interruption parameters
 	readAndSkipPast2( "STI_restopART", "cd4upp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(stiInputs.ARTRestopCD4Bounds[i][UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(stiInputs->ARTRestopCD4Bounds[i][UPPER_BOUND]) );
 	readAndSkipPast2( "STI_restopART", "cd4lwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(stiInputs.ARTRestopCD4Bounds[i][LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(stiInputs->ARTRestopCD4Bounds[i][LOWER_BOUND]) );
 	readAndSkipPast2( "STI_restopART", "hvlupp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(stiInputs.ARTRestopHVLBounds[i][UPPER_BOUND]) );
+		inputFile->scan( "%d", &(stiInputs->ARTRestopHVLBounds[i][UPPER_BOUND]) );
 	readAndSkipPast2( "STI_restopART", "hvllwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(stiInputs.ARTRestopHVLBounds[i][LOWER_BOUND]) );
+		inputFile->scan( "%d", &(stiInputs->ARTRestopHVLBounds[i][LOWER_BOUND]) );
 
 	// read in STI endpoint parameters
 	// read in CD4 bounds
 	readAndSkipPast2( "STIendpt_CD4", "upp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(stiInputs.endpoint[i].CD4BoundsOnly[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(stiInputs->endpoint[i].CD4BoundsOnly[UPPER_BOUND]) );
 	readAndSkipPast2( "STIendpt_CD4", "lwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(stiInputs.endpoint[i].CD4BoundsOnly[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(stiInputs->endpoint[i].CD4BoundsOnly[LOWER_BOUND]) );
 	// read in HVL bounds for STI endpoint
 	readAndSkipPast2( "STIendpt_HVL", "upp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(stiInputs.endpoint[i].HVLBoundsOnly[UPPER_BOUND]) );
+		inputFile->scan( "%d", &(stiInputs->endpoint[i].HVLBoundsOnly[UPPER_BOUND]) );
 	readAndSkipPast2( "STIendpt_HVL", "lwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(stiInputs.endpoint[i].HVLBoundsOnly[LOWER_BOUND]) );
+		inputFile->scan( "%d", &(stiInputs->endpoint[i].HVLBoundsOnly[LOWER_BOUND]) );
 	// read in CD4 & HVL bounds for STI endpoint
 	readAndSkipPast2( "STIendpt_CD4HVL", "CD4upp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(stiInputs.endpoint[i].CD4BoundsWithHVL[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(stiInputs->endpoint[i].CD4BoundsWithHVL[UPPER_BOUND]) );
 	readAndSkipPast2( "STIendpt_CD4HVL", "CD4lwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(stiInputs.endpoint[i].CD4BoundsWithHVL[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(stiInputs->endpoint[i].CD4BoundsWithHVL[LOWER_BOUND]) );
 	readAndSkipPast2( "STIendpt_CD4HVL", "HVLupp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(stiInputs.endpoint[i].HVLBoundsWithCD4[UPPER_BOUND]) );
+		inputFile->scan( "%d", &(stiInputs->endpoint[i].HVLBoundsWithCD4[UPPER_BOUND]) );
 	readAndSkipPast2( "STIendpt_CD4HVL", "HVLlwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(stiInputs.endpoint[i].HVLBoundsWithCD4[LOWER_BOUND]) );
+		inputFile->scan( "%d", &(stiInputs->endpoint[i].HVLBoundsWithCD4[LOWER_BOUND]) );
 	// read in OI criteria for STI endpoint
 	for (j = 0; j < OI_NUM; ++j) {
 		readAndSkipPast2( "STIendpt_OIs", OI_STRS[j], inputFile );
 		for (i = 0; i < ART_NUM_LINES; ++i) {
-			fscanf( inputFile, "%d", &tempBool);
-			stiInputs.endpoint[i].OIHistory[j] = (bool) tempBool;
+			inputFile->scan( "%d", &tempBool);
+			stiInputs->endpoint[i].OIHistory[j] = (bool) tempBool;
 		}
 	}
 	readAndSkipPast2( "STIendpt_OIs", "numOIs", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(stiInputs.endpoint[i].numOIs) );
+		inputFile->scan( "%d", &(stiInputs->endpoint[i].numOIs) );
 	// read in CD4 & OI criteria for STI endpoint
 	readAndSkipPast2( "STIendpt_CD4OI", "CD4upp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(stiInputs.endpoint[i].CD4BoundsWithOIs[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(stiInputs->endpoint[i].CD4BoundsWithOIs[UPPER_BOUND]) );
 	readAndSkipPast2( "STIendpt_CD4OI", "CD4lwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%lf", &(stiInputs.endpoint[i].CD4BoundsWithOIs[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(stiInputs->endpoint[i].CD4BoundsWithOIs[LOWER_BOUND]) );
 	for (j = 0; j < OI_NUM; ++j) {
 		readAndSkipPast2( "STIendpt_CD4OI", OI_STRS[j], inputFile );
 		for (i = 0; i < ART_NUM_LINES; ++i) {
-			fscanf( inputFile, "%d", &tempBool);
-			stiInputs.endpoint[i].OIHistoryWithCD4[j] = (bool) tempBool;
+			inputFile->scan( "%d", &tempBool);
+			stiInputs->endpoint[i].OIHistoryWithCD4[j] = (bool) tempBool;
 		}
 	}
 	// read in minimum mth # for STI endpoint
 	readAndSkipPast2( "STIendpt", "minMthNum", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(stiInputs.endpoint[i].monthsSinceSTIStart) );
+		inputFile->scan( "%d", &(stiInputs->endpoint[i].monthsSinceSTIStart) );
 } /* end readSTIInputs */
 
 /* readProphInputs reads data from the Prophs tab of the input sheet */
-void SimContext::readProphInputs() {
+void SimContext::readProphInputs(InputReader *inputFile) {
 	char scratch[256], buffer[256];
 	int i, j, k, tempBool;
 
@@ -1353,67 +2277,67 @@ void SimContext::readProphInputs() {
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "Id", inputFile );
 			int idNum;
-			fscanf( inputFile, " %d", &idNum);
+			inputFile->scan( " %d", &idNum);
 
 
 
 			// continue to next proph if this one is unspecified
 			if (idNum == NOT_APPL) {
-				prophsInputs[PROPH_PRIMARY][k][i] = NULL;
+				prophsInputs[PROPH_PRIMARY][k][i].reset();
 
 				continue;
 			}
 			// allocate a proph input structure
-			prophsInputs[PROPH_PRIMARY][k][i] = new ProphInputs();
+			prophsInputs[PROPH_PRIMARY][k][i] = make_shared<ProphInputs>();
 
 			// read in OI proph efficacy (for primary proph, primary OIs only in LDC model)
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "EffPriOIs", inputFile );
 
 			for ( j = 0; j < OI_NUM; ++j ){
-				fscanf( inputFile, "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->primaryOIEfficacy[j]) );
+				inputFile->scan( "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->primaryOIEfficacy[j]) );
 
 			}
 			// read in OI primary proph efficacy on secondary OIs
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "EffSecOIs", inputFile );
 			for ( j = 0; j < OI_NUM; ++j )
-				fscanf( inputFile, "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->secondaryOIEfficacy[j]) );
+				inputFile->scan( "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->secondaryOIEfficacy[j]) );
 
 			// read in proph resist prob, level of proph resistance, time of proph resistance,
 			// cost factor of proph resistance, and death rate ratio for proph resistance for the primary proph
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "Resist", inputFile );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->monthlyProbResistance) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->percentResistance) );
-			fscanf( inputFile, "%d", &(prophsInputs[PROPH_PRIMARY][k][i]->timeOfResistance) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->costFactorResistance) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->deathRateRatioResistance) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->monthlyProbResistance) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->percentResistance) );
+			inputFile->scan( "%d", &(prophsInputs[PROPH_PRIMARY][k][i]->timeOfResistance) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->costFactorResistance) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->deathRateRatioResistance) );
 
 			// read in min & maj tox for proph
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "Tox", inputFile );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->probMinorToxicity) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->probMajorToxicity) );
-			fscanf( inputFile, "%d", &(prophsInputs[PROPH_PRIMARY][k][i]->monthsToToxicity) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->deathRateRatioMajorToxicity) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->probMinorToxicity) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->probMajorToxicity) );
+			inputFile->scan( "%d", &(prophsInputs[PROPH_PRIMARY][k][i]->monthsToToxicity) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->deathRateRatioMajorToxicity) );
 
 			// read in costs and QOL for proph
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "CostQOL", inputFile );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->costMonthly) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->costMinorToxicity) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->QOLMinorToxicity) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->costMajorToxicity) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->QOLMajorToxicity) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->costMonthly) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->costMinorToxicity) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->QOLMinorToxicity) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->costMajorToxicity) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_PRIMARY][k][i]->QOLMajorToxicity) );
 
 			// read in proph switching inputs
 			readAndSkipPast(scratch, inputFile);
 			readAndSkipPast("Switch", inputFile);
-			fscanf( inputFile, "%d", &(prophsInputs[PROPH_PRIMARY][k][i]->monthsToSwitch) );
-			fscanf( inputFile, "%d", &tempBool);
+			inputFile->scan( "%d", &(prophsInputs[PROPH_PRIMARY][k][i]->monthsToSwitch) );
+			inputFile->scan( "%d", &tempBool);
 			prophsInputs[PROPH_PRIMARY][k][i]->switchOnMinorToxicity = (bool) tempBool;
-			fscanf( inputFile, "%d", &tempBool);
+			inputFile->scan( "%d", &tempBool);
 			prophsInputs[PROPH_PRIMARY][k][i]->switchOnMajorToxicity = (bool) tempBool;
 		}
 	}
@@ -1425,165 +2349,165 @@ void SimContext::readProphInputs() {
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "Id", inputFile );
 			int idNum;
-			fscanf( inputFile, " %d", &idNum);
+			inputFile->scan( " %d", &idNum);
 			// continue to next proph if this one is unspecified
 			if (idNum == NOT_APPL) {
-				prophsInputs[PROPH_SECONDARY][k][i] = NULL;
+				prophsInputs[PROPH_SECONDARY][k][i].reset();
 				continue;
 			}
 			// allocate a proph input structure
-			prophsInputs[PROPH_SECONDARY][k][i] = new ProphInputs();
+			prophsInputs[PROPH_SECONDARY][k][i] = make_shared<ProphInputs>();
 
 			// read in OI proph efficacy (for primary proph, primary OIs only in LDC model)
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "EffPriOIs", inputFile );
 			for ( j = 0; j < OI_NUM; ++j )
-				fscanf( inputFile, "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->primaryOIEfficacy[j]) );
+				inputFile->scan( "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->primaryOIEfficacy[j]) );
 
 			// read in OI primary proph efficacy on secondary OIs
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "EffSecOIs", inputFile );
 			for ( j = 0; j < OI_NUM; ++j )
-				fscanf( inputFile, "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->secondaryOIEfficacy[j]) );
+				inputFile->scan( "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->secondaryOIEfficacy[j]) );
 
 			// read in proph resist prob, level of proph resistance, time of proph resistance,
 			// cost factor of proph resistance, and death rate ratio for proph resistance for the secondary proph
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "Resist", inputFile );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->monthlyProbResistance) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->percentResistance) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->timeOfResistance) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->costFactorResistance) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->deathRateRatioResistance) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->monthlyProbResistance) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->percentResistance) );
+			inputFile->scan( "%d", &(prophsInputs[PROPH_SECONDARY][k][i]->timeOfResistance) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->costFactorResistance) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->deathRateRatioResistance) );
 
 			// read in min & maj tox for proph
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "Tox", inputFile );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->probMinorToxicity) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->probMajorToxicity) );
-			fscanf( inputFile, "%d", &(prophsInputs[PROPH_SECONDARY][k][i]->monthsToToxicity) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->deathRateRatioMajorToxicity) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->probMinorToxicity) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->probMajorToxicity) );
+			inputFile->scan( "%d", &(prophsInputs[PROPH_SECONDARY][k][i]->monthsToToxicity) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->deathRateRatioMajorToxicity) );
 
 			// read in costs and QOL for proph
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "CostQOL", inputFile );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->costMonthly) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->costMinorToxicity) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->QOLMinorToxicity) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->costMajorToxicity) );
-			fscanf( inputFile, "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->QOLMajorToxicity) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->costMonthly) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->costMinorToxicity) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->QOLMinorToxicity) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->costMajorToxicity) );
+			inputFile->scan( "%lf", &(prophsInputs[PROPH_SECONDARY][k][i]->QOLMajorToxicity) );
 
 			// read in proph switching inputs
 			readAndSkipPast(scratch, inputFile);
 			readAndSkipPast("Switch", inputFile);
-			fscanf( inputFile, "%d", &(prophsInputs[PROPH_SECONDARY][k][i]->monthsToSwitch) );
-			fscanf( inputFile, "%d", &tempBool);
+			inputFile->scan( "%d", &(prophsInputs[PROPH_SECONDARY][k][i]->monthsToSwitch) );
+			inputFile->scan( "%d", &tempBool);
 			prophsInputs[PROPH_SECONDARY][k][i]->switchOnMinorToxicity = (bool) tempBool;
-			fscanf( inputFile, "%d", &tempBool);
+			inputFile->scan( "%d", &tempBool);
 			prophsInputs[PROPH_SECONDARY][k][i]->switchOnMajorToxicity = (bool) tempBool;
 		}
 	}
 } /* end readProphInputs */
 
 /* readARTInputs reads data from the ARTs tab of the input sheet */
-void SimContext::readARTInputs() {
+void SimContext::readARTInputs(InputReader *inputFile) {
 	char tmpBuf[256], buffer[256];
 	int i, j, k, tempBool, tempInt;
 	double tempCost;
-	FILE *file = inputFile;
+	InputReader *file = inputFile;
 
 	for (int artNum = 1; artNum <= ART_NUM_LINES; artNum++) {
 		// read in regimen id num and name
 		sprintf(tmpBuf, "ART%dId", artNum);
 		readAndSkipPast( tmpBuf, file );
 		int idNum;
-		fscanf( file, " %d", &idNum );
+		file->scan( " %d", &idNum );
 		// skip to next regimen if this one is not specified
 		if (idNum == NOT_APPL) {
-			artInputs[artNum - 1] = NULL;
+			artInputs[artNum - 1].reset();
 			continue;
 		}
 		// create new regimen input structure
-		artInputs[artNum - 1] = new ARTInputs();
+		artInputs[artNum - 1] = make_shared<ARTInputs>();
 		ARTInputs &artInput = *(artInputs[artNum - 1]);
 
 		// read in one-time startup cost
 		sprintf(tmpBuf, "ART%dInitCost", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &artInput.costInitial );
+		file->scan( "%lf", &artInput.costInitial );
 		// read in additional cost from the treatment tab and add to initial cost
 		sprintf(tmpBuf, "ART%dInitCostAdd", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &tempCost );
+		file->scan( "%lf", &tempCost );
 		artInput.costInitial += tempCost;
 		// read in monthly cost
 		sprintf(tmpBuf, "ART%dMthCost", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &artInput.costMonthly );
+		file->scan( "%lf", &artInput.costMonthly );
 		// read in additional cost from the treatment tab and add to monthly cost
 		sprintf(tmpBuf, "ART%dMthCostAdd", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &tempCost );
+		file->scan( "%lf", &tempCost );
 		artInput.costMonthly += tempCost;
 
 		// read in efficacy time horizon
 		sprintf(tmpBuf, "ART%dEffTimeHorizon", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d", &artInput.efficacyTimeHorizon );
+		file->scan( "%d", &artInput.efficacyTimeHorizon );
 
 		sprintf(tmpBuf, "ART%dResuppEffTimeHorizon", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d", &artInput.efficacyTimeHorizonResuppression );
+		file->scan( "%d", &artInput.efficacyTimeHorizonResuppression );
 
 		// read in mth by which all would fail
 		sprintf(tmpBuf, "ART%dMthForceFail", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d", &artInput.forceFailAtMonth );
+		file->scan( "%d", &artInput.forceFailAtMonth );
 
 		// read in CD4 effect on ART
 		sprintf(tmpBuf, "ART%dMthStageCD4Eff_Succ", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d %d", &(artInput.stageBoundsCD4ChangeOnSuppART[0]), &(artInput.stageBoundsCD4ChangeOnSuppART[1]));
+		file->scan( "%d %d", &(artInput.stageBoundsCD4ChangeOnSuppART[0]), &(artInput.stageBoundsCD4ChangeOnSuppART[1]));
 		for (j = 0; j < CD4_RESPONSE_NUM_TYPES; j++) {
 			sprintf(tmpBuf, "ART%dCD4EffSlope_Succ", artNum);
 			readAndSkipPast2( tmpBuf, CD4_RESPONSE_STRS[j], file );
-			fscanf( file, "%lf %lf %lf %lf %lf %lf",
+			file->scan( "%lf %lf %lf %lf %lf %lf",
 				&(artInput.CD4ChangeOnSuppARTMean[j][0]), &(artInput.CD4ChangeOnSuppARTStdDev[j][0]),
 				&(artInput.CD4ChangeOnSuppARTMean[j][1]), &(artInput.CD4ChangeOnSuppARTStdDev[j][1]),
 				&(artInput.CD4ChangeOnSuppARTMean[j][2]), &(artInput.CD4ChangeOnSuppARTStdDev[j][2]));
 		}
 		sprintf(tmpBuf, "ART%dMthStageCD4Eff_Fail", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d", &(artInput.stageBoundCD4ChangeOnARTFail));
+		file->scan( "%d", &(artInput.stageBoundCD4ChangeOnARTFail));
 		for (j = 0; j < CD4_RESPONSE_NUM_TYPES; j++) {
 			sprintf(tmpBuf, "ART%dCD4EffMult_Fail", artNum);
 			readAndSkipPast2( tmpBuf, CD4_RESPONSE_STRS[j], file);
-			fscanf( file, "%lf %lf",
+			file->scan( "%lf %lf",
 				&(artInput.CD4MultiplierOnFailedART[j][0]),
 				&(artInput.CD4MultiplierOnFailedART[j][1]));
 		}
 		sprintf(tmpBuf, "ART%dMthCD4SecStdDev", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &artInput.secondaryCD4ChangeOnARTStdDev);
+		file->scan( "%lf", &artInput.secondaryCD4ChangeOnARTStdDev);
 
 		// read in CD4 effect off ART
 		sprintf(tmpBuf, "ART%dCD4EffOffART_Succ", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf %lf", &(artInput.monthlyCD4MultiplierOffARTPreSetpoint[ART_EFF_SUCCESS]),
+		file->scan( "%lf %lf", &(artInput.monthlyCD4MultiplierOffARTPreSetpoint[ART_EFF_SUCCESS]),
 			&(artInput.monthlyCD4MultiplierOffARTPostSetpoint[ART_EFF_SUCCESS]) );
 		sprintf(tmpBuf, "ART%dCD4EffOffART_Fail", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf %lf", &(artInput.monthlyCD4MultiplierOffARTPreSetpoint[ART_EFF_FAILURE]),
+		file->scan( "%lf %lf", &(artInput.monthlyCD4MultiplierOffARTPreSetpoint[ART_EFF_FAILURE]),
 			&(artInput.monthlyCD4MultiplierOffARTPostSetpoint[ART_EFF_FAILURE]) );
 
 		// read in HVL change probability
 		sprintf(tmpBuf, "ART%dHVLChgProb", artNum);
 		readAndSkipPast( tmpBuf, file );
 		readAndSkipPast( "Supp", file );
-		fscanf( file, "%lf %d", &(artInput.monthlyProbHVLChange[ART_EFF_SUCCESS]), &(artInput.monthlyNumStrataHVLChange[ART_EFF_SUCCESS]) );
+		file->scan( "%lf %d", &(artInput.monthlyProbHVLChange[ART_EFF_SUCCESS]), &(artInput.monthlyNumStrataHVLChange[ART_EFF_SUCCESS]) );
 		readAndSkipPast( tmpBuf, file );
 		readAndSkipPast( "Fail", file );
-		fscanf( file, "%lf %d", &(artInput.monthlyProbHVLChange[ART_EFF_FAILURE]), &(artInput.monthlyNumStrataHVLChange[ART_EFF_FAILURE]) );
+		file->scan( "%lf %d", &(artInput.monthlyProbHVLChange[ART_EFF_FAILURE]), &(artInput.monthlyNumStrataHVLChange[ART_EFF_FAILURE]) );
 
 		//read in toxicity structure
 		for (i = 0; i < ART_NUM_SUBREGIMENS; i++) {
@@ -1592,11 +2516,11 @@ void SimContext::readARTInputs() {
 					sprintf(tmpBuf, "ART%dToxicity1.%d",artNum, i);
 					readAndSkipPast( tmpBuf, file );
 					//read in name of toxicity
-					fscanf( file, "%32s", buffer);
+					file->scan( "%32s", buffer);
 					artInput.toxicity[i][j][k].toxicityName = buffer;
 					//these parameters are shared by all toxicities
 					int qolDur, costDur;
-					fscanf( file, "%lf %lf %lf %lf %d %lf %d %d",
+					file->scan( "%lf %lf %lf %lf %d %lf %d %d",
 						&(artInput.toxicity[i][j][k].probToxicity),
 						&(artInput.toxicity[i][j][k].timeToToxicityMean),
 						&(artInput.toxicity[i][j][k].timeToToxicityStdDev),
@@ -1610,7 +2534,7 @@ void SimContext::readARTInputs() {
 					//depending in the severity if the toxicity, there might be extra parameters
 					if (j == ART_TOX_CHRONIC) {
 						int deathDur;
-						fscanf( file, "%d %d %lf %d",
+						file->scan( "%d %d %lf %d",
                             &(tempInt),
 							&(artInput.toxicity[i][j][k].timeToChronicDeathImpact),
 							&(artInput.toxicity[i][j][k].chronicToxDeathRateRatio),
@@ -1621,7 +2545,7 @@ void SimContext::readARTInputs() {
 						artInput.toxicity[i][j][k].chronicDeathDuration = (ART_TOX_DUR) deathDur;
 					}
 					else if (j == ART_TOX_MAJOR) {
-						fscanf( file, "%lf %lf",
+						file->scan( "%lf %lf",
 							 &(artInput.toxicity[i][j][k].acuteMajorToxDeathRateRatio),
 							 &(artInput.toxicity[i][j][k].costAcuteDeathMajorToxicity));
 					}
@@ -1630,188 +2554,188 @@ void SimContext::readARTInputs() {
 			sprintf(tmpBuf, "ART%dToxicity1.%d",artNum, i);
 			readAndSkipPast( tmpBuf, file );
 			readAndSkipPast("TimeToSwitch", file);
-			fscanf( file, "%d",&(artInput.monthsToSwitchSubRegimen[i]));
+			file->scan( "%d",&(artInput.monthsToSwitchSubRegimen[i]));
 		}
 
 		//read regimen specific heterogeneity inputs
 		sprintf(tmpBuf, "ART%dPropMthCostNonResponders", artNum);
 		readAndSkipPast(tmpBuf, file);
-		fscanf(file, "%lf", &(artInput.propMthCostNonResponders));
+		file->scan("%lf", &(artInput.propMthCostNonResponders));
 
 		sprintf(tmpBuf, "ART%dProbRestartRegimen", artNum);
 		readAndSkipPast(tmpBuf, file);
-		fscanf(file, "%lf %lf %lf", &(artInput.probRestartARTRegimenAfterFailure[RESP_TYPE_FULL]),&(artInput.probRestartARTRegimenAfterFailure[RESP_TYPE_PARTIAL]),&(artInput.probRestartARTRegimenAfterFailure[RESP_TYPE_NON]));
+		file->scan("%lf %lf %lf", &(artInput.probRestartARTRegimenAfterFailure[RESP_TYPE_FULL]),&(artInput.probRestartARTRegimenAfterFailure[RESP_TYPE_PARTIAL]),&(artInput.probRestartARTRegimenAfterFailure[RESP_TYPE_NON]));
 
 		sprintf(tmpBuf, "ART%dMaxResuppAttempts", artNum);
 		readAndSkipPast(tmpBuf, file);
-		fscanf(file, "%d", &(artInput.maxRestartAttempts));
+		file->scan("%d", &(artInput.maxRestartAttempts));
 
 		sprintf(tmpBuf, "ART%dHetPropRespRegCoeff", artNum);
 		readAndSkipPast(tmpBuf, file);
-		fscanf(file, "%lf %lf", &(artInput.propRespondARTRegimenLogitMean), &(artInput.propRespondARTRegimenLogitStdDev));
+		file->scan("%lf %lf", &(artInput.propRespondARTRegimenLogitMean), &(artInput.propRespondARTRegimenLogitStdDev));
 		sprintf(tmpBuf, "ART%dHetPropRespRegCoeffDistribution", artNum);
 		readAndSkipPast(tmpBuf, file);
-		fscanf(file, "%d", &(artInput.propRespondARTRegimenLogitDistribution));
+		file->scan("%d", &(artInput.propRespondARTRegimenLogitDistribution));
 		sprintf(tmpBuf, "ART%dHetPropRespRegCoeffUseDuration", artNum);
 		readAndSkipPast(tmpBuf, file);
-		fscanf(file, "%d", &tempBool);
+		file->scan("%d", &tempBool);
 		artInput.propRespondARTRegimenUseDuration = (bool) tempBool;
 		sprintf(tmpBuf, "ART%dHetPropRespRegCoeffDuration", artNum);
 		readAndSkipPast(tmpBuf, file);
-		fscanf(file, "%lf %lf", &(artInput.propRespondARTRegimenDurationMean), &(artInput.propRespondARTRegimenDurationStdDev));
+		file->scan("%lf %lf", &(artInput.propRespondARTRegimenDurationMean), &(artInput.propRespondARTRegimenDurationStdDev));
 
 		sprintf(tmpBuf, "ART%dHetOutcomes", artNum);
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("Supp",file);
-		fscanf(file, "%lf %lf %lf %lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_SUPP][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_SUPP][1]),&(artInput.responseTypeValues[HET_OUTCOME_SUPP][0]),&(artInput.responseTypeValues[HET_OUTCOME_SUPP][1]), &(artInput.responseTypeExponents[HET_OUTCOME_SUPP]));
+		file->scan("%lf %lf %lf %lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_SUPP][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_SUPP][1]),&(artInput.responseTypeValues[HET_OUTCOME_SUPP][0]),&(artInput.responseTypeValues[HET_OUTCOME_SUPP][1]), &(artInput.responseTypeExponents[HET_OUTCOME_SUPP]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("LateFail",file);
-		fscanf(file, "%lf %lf %lf %lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_LATEFAIL][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_LATEFAIL][1]),&(artInput.responseTypeValues[HET_OUTCOME_LATEFAIL][0]),&(artInput.responseTypeValues[HET_OUTCOME_LATEFAIL][1]), &(artInput.responseTypeExponents[HET_OUTCOME_LATEFAIL]));
+		file->scan("%lf %lf %lf %lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_LATEFAIL][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_LATEFAIL][1]),&(artInput.responseTypeValues[HET_OUTCOME_LATEFAIL][0]),&(artInput.responseTypeValues[HET_OUTCOME_LATEFAIL][1]), &(artInput.responseTypeExponents[HET_OUTCOME_LATEFAIL]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("ARTEffectOI",file);
-		fscanf(file, "%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_OI][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_OI][1]));
+		file->scan("%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_OI][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_OI][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("ARTEffectCHRMs",file);
-		fscanf(file, "%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_CHRMS][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_CHRMS][1]));
+		file->scan("%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_CHRMS][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_CHRMS][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("ARTEffectMort",file);
-		fscanf(file, "%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_MORT][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_MORT][1]));
+		file->scan("%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_MORT][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_MORT][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("Resist",file);
-		fscanf(file, "%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_RESIST][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_RESIST][1]));
+		file->scan("%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_RESIST][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_RESIST][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("Tox",file);
-		fscanf(file, "%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_TOX][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_TOX][1]));
+		file->scan("%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_TOX][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_TOX][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("Cost",file);
-		fscanf(file, "%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_COST][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_COST][1]));
+		file->scan("%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_COST][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_COST][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("RestartAfterFail",file);
-		fscanf(file, "%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_RESTART][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_RESTART][1]));
+		file->scan("%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_RESTART][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_RESTART][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("Resuppression",file);
-		fscanf(file, "%lf %lf %lf %lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_RESUPP][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_RESUPP][1]),&(artInput.responseTypeValues[HET_OUTCOME_RESUPP][0]),&(artInput.responseTypeValues[HET_OUTCOME_RESUPP][1]), &(artInput.responseTypeExponents[HET_OUTCOME_RESUPP]));
+		file->scan("%lf %lf %lf %lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_RESUPP][0]), &(artInput.responseTypeThresholds[HET_OUTCOME_RESUPP][1]),&(artInput.responseTypeValues[HET_OUTCOME_RESUPP][0]),&(artInput.responseTypeValues[HET_OUTCOME_RESUPP][1]), &(artInput.responseTypeExponents[HET_OUTCOME_RESUPP]));
         sprintf(tmpBuf, "ART%dARTEffectOnFail", artNum);
         readAndSkipPast(tmpBuf, file);
-        fscanf(file, "%d", &tempBool);
+        file->scan("%d", &tempBool);
         artInput.applyARTEffectOnFailed = (bool) tempBool;
 
 	}
 } /* end readARTInputs */
 
 /* readNatHistInputs reads data from the NatHist tab of the input sheet */
-void SimContext::readNatHistInputs() {
+void SimContext::readNatHistInputs(InputReader *inputFile) {
 	int i, j;
 	// read in death rate ratios for HIV and ART
 	readAndSkipPast( "HIVDthRateRatio", inputFile );
 	for ( i = CD4_NUM_STRATA - 1; i >= 0; --i )
-		fscanf(inputFile, "%lf", &(natHistInputs.HIVDeathRateRatio[i]));
+		inputFile->scan("%lf", &(natHistInputs->HIVDeathRateRatio[i]));
 	readAndSkipPast("ARTDthRateRatio", inputFile);
-	fscanf(inputFile, "%lf", &(natHistInputs.ARTDeathRateRatio));
+	inputFile->scan("%lf", &(natHistInputs->ARTDeathRateRatio));
 	// read in acute OI prob w/ no OI hist, not on ART
 	for ( j = CD4_NUM_STRATA - 1; j >= 0; --j ) {
 		readAndSkipPast( "OIProb_NoHist_noART", inputFile );
 		readAndSkipPast( CD4_STRATA_STRS[j], inputFile );
 		for ( i = 0; i < OI_NUM; ++i )
-			fscanf( inputFile, "%lf", &(natHistInputs.monthlyOIProbOffART[j][i][HIST_N]) );
+			inputFile->scan( "%lf", &(natHistInputs->monthlyOIProbOffART[j][i][HIST_N]) );
 	}
 	// read in acute OI prob w/ OI hist, not on ART
 	for ( j = CD4_NUM_STRATA - 1; j >= 0; --j ) {
 		readAndSkipPast( "OIProb_Hist_noART", inputFile );
 		readAndSkipPast( CD4_STRATA_STRS[j], inputFile );
 		for ( i = 0; i < OI_NUM; ++i )
-			fscanf( inputFile, "%lf", &(natHistInputs.monthlyOIProbOffART[j][i][HIST_Y]) );
+			inputFile->scan( "%lf", &(natHistInputs->monthlyOIProbOffART[j][i][HIST_Y]) );
 	}
 	// read in acute OI prob on ART multipliers
 	for ( j = CD4_NUM_STRATA - 1; j >= 0; --j ) {
 		readAndSkipPast( "OIProb_onART_Mult", inputFile );
 		readAndSkipPast( CD4_STRATA_STRS[j], inputFile );
 		for ( i = 0; i < OI_NUM; ++i )
-			fscanf( inputFile, "%lf", &(natHistInputs.monthlyOIProbOnARTMult[j][i]) );
+			inputFile->scan( "%lf", &(natHistInputs->monthlyOIProbOnARTMult[j][i]) );
 	}
 	// read in death rate ratios for acute cases of severe OIs and TB modeled as a severe OI
 	readAndSkipPast( "AcuteOIDthRateRatio", inputFile );
 	for ( i = CD4_NUM_STRATA - 1; i >= 0; --i )
-		fscanf( inputFile, "%lf", &(natHistInputs.acuteOIDeathRateRatio[i]));
+		inputFile->scan( "%lf", &(natHistInputs->acuteOIDeathRateRatio[i]));
 	readAndSkipPast( "AcuteOIDthRateRatioTB", inputFile );
 	for ( i = CD4_NUM_STRATA - 1; i >= 0; --i )
-		fscanf( inputFile, "%lf", &(natHistInputs.acuteOIDeathRateRatioTB[i]));
+		inputFile->scan( "%lf", &(natHistInputs->acuteOIDeathRateRatioTB[i]));
 	// read in death rate ratios for having a history of a severe OI or TB modeled as a severe OI, and their durations
 	readAndSkipPast( "SevrOI_HistDthRateRatio", inputFile);
-	fscanf( inputFile, "%lf", &(natHistInputs.severeOIHistDeathRateRatio));
+	inputFile->scan( "%lf", &(natHistInputs->severeOIHistDeathRateRatio));
 	readAndSkipPast( "SevrOI_HistEffectDuration", inputFile);
-	fscanf( inputFile, "%d", &(natHistInputs.severeOIHistEffectDuration));
+	inputFile->scan( "%d", &(natHistInputs->severeOIHistEffectDuration));
 	readAndSkipPast( "TB_OI_HistDthRateRatio", inputFile);
-	fscanf( inputFile, "%lf", &(natHistInputs.TB_OIHistDeathRateRatio));
+	inputFile->scan( "%lf", &(natHistInputs->TB_OIHistDeathRateRatio));
 	readAndSkipPast( "TB_OI_HistEffectDuration", inputFile);
-	fscanf( inputFile, "%d", &(natHistInputs.TB_OIHistEffectDuration));
+	inputFile->scan( "%d", &(natHistInputs->TB_OIHistEffectDuration));
 	// read in generic risk factor death rate ratios
 	readAndSkipPast( "GenRiskDthRateRatio", inputFile);
 	for( i = 0; i<RISK_FACT_NUM; ++i)
-		fscanf( inputFile, "%lf", &(natHistInputs.genericRiskDeathRateRatio[i]));
+		inputFile->scan( "%lf", &(natHistInputs->genericRiskDeathRateRatio[i]));
 	// read in nat hist (Mellors) decl
 	for ( j = CD4_NUM_STRATA - 1; j >= 0; --j ) {
 		readAndSkipPast( "BslCD4Decl_Mean", inputFile );
 		readAndSkipPast( CD4_STRATA_STRS[j], inputFile );
 		for ( i = HVL_NUM_STRATA - 1; i >= HVL_VLO; --i )
-			fscanf( inputFile, "%lf", &(natHistInputs.monthlyCD4DeclineMean[j][i]) );
+			inputFile->scan( "%lf", &(natHistInputs->monthlyCD4DeclineMean[j][i]) );
 		readAndSkipPast( "BslCD4Decl_SDev", inputFile );
 		readAndSkipPast( CD4_STRATA_STRS[j], inputFile );
 		for ( i = HVL_NUM_STRATA - 1; i >= HVL_VLO; --i )
-			fscanf( inputFile, "%lf", &(natHistInputs.monthlyCD4DeclineStdDev[j][i]) );
+			inputFile->scan( "%lf", &(natHistInputs->monthlyCD4DeclineStdDev[j][i]) );
 	}
 
 	readAndSkipPast( "BslCD4Decl_BtwSbjct", inputFile);
 	//read in between subject cd4 decline.  This std dev is used to draw between subject cd4 decline for each patient once per run
-	fscanf( inputFile, "%lf", &(natHistInputs.monthlyCD4DeclineBtwSubject) );
+	inputFile->scan( "%lf", &(natHistInputs->monthlyCD4DeclineBtwSubject) );
 
 	// read in background death rates
 	readAndSkipPast( "BackgroundDthRate_Male", inputFile );
 	for ( i = AGE_STARTING; i < AGE_YRS; ++i )
-		fscanf( inputFile, "%lf", &(natHistInputs.monthlyBackgroundDeathRate[GENDER_MALE][i]) );
+		inputFile->scan( "%lf", &(natHistInputs->monthlyBackgroundDeathRate[GENDER_MALE][i]) );
 	readAndSkipPast( "BackgroundDthRate_Female", inputFile );
 	for ( i = AGE_STARTING; i < AGE_YRS; ++i )
-		fscanf( inputFile, "%lf", &(natHistInputs.monthlyBackgroundDeathRate[GENDER_FEMALE][i]) );
+		inputFile->scan( "%lf", &(natHistInputs->monthlyBackgroundDeathRate[GENDER_FEMALE][i]) );
 	// read in the background mortality modifier type
 	readAndSkipPast( "BackgroundMortModifierType", inputFile) ;
-	fscanf(inputFile, "%d", &(natHistInputs.backgroundMortModifierType));
+	inputFile->scan("%d", &(natHistInputs->backgroundMortModifierType));
 	// read in background mortality modifier
     readAndSkipPast( "BackgroundMortModifier", inputFile) ;
-    fscanf( inputFile, "%lf", &(natHistInputs.backgroundMortModifier) );
+    inputFile->scan( "%lf", &(natHistInputs->backgroundMortModifier) );
 } /* end readNatHistInputs */
 
 /* readCHRMsInputs reads data from the CHRMs tab of the input sheet */
-void SimContext::readCHRMsInputs() {
+void SimContext::readCHRMsInputs(InputReader *inputFile) {
 	char scratch[256];
 	int tempBool;
 
 	// Read in CHRMs names
 	readAndSkipPast("CHRMstrs", inputFile);
 	for (int i = 0; i < CHRM_NUM; i++) {
-		fscanf( inputFile, "%32s", CHRM_STRS[i] );
+		inputFile->scan( "%32s", CHRM_STRS[i] );
 		strcpy(DTH_CAUSES_STRS[DTH_CHRM_1 + i], CHRM_STRS[i]);
 	}
 
 	//Output CHRMs output
 	readAndSkipPast("ShowCHRMOutput", inputFile);
-	fscanf(inputFile,"%d", &tempBool);
-	chrmsInputs.showCHRMsOutput = (bool) tempBool;
+	inputFile->scan("%d", &tempBool);
+	chrmsInputs->showCHRMsOutput = (bool) tempBool;
 
 	//Orphans input
 	readAndSkipPast("EnableOrphans", inputFile);
-	fscanf(inputFile,"%d", &tempBool);
-	chrmsInputs.enableOrphans = (bool) tempBool;
+	inputFile->scan("%d", &tempBool);
+	chrmsInputs->enableOrphans = (bool) tempBool;
 
 	readAndSkipPast("ShowOrphansOutput", inputFile);
-	fscanf(inputFile,"%d", &tempBool);
-	chrmsInputs.showOrphansOutput = (bool) tempBool;
+	inputFile->scan("%d", &tempBool);
+	chrmsInputs->showOrphansOutput = (bool) tempBool;
 
 	//CHRMs Age Bounds
 	for (int i = 0; i < CHRM_NUM; i++) {
 		sprintf(scratch, "CHRMAgeCat%s", CHRM_STRS[i]);
 		readAndSkipPast(scratch, inputFile);
 		for (int l = 0; l < CHRM_AGE_CAT_NUM-1; l++)
-			fscanf(inputFile, "%d", &(chrmsInputs.ageBounds[i][l]));
+			inputFile->scan("%d", &(chrmsInputs->ageBounds[i][l]));
 	}
 	
 	// CHRMs stage durations and std. deviations
@@ -1820,15 +2744,15 @@ void SimContext::readCHRMsInputs() {
             sprintf(scratch, "Duration%dandSD%s", i, CHRM_STRS[j]);
             readAndSkipPast(scratch, inputFile);
             for (int k = 0; k < 2; k++){
-                fscanf( inputFile, "%lf", &(chrmsInputs.durationCHRMSstage[i][j][k]));
+                inputFile->scan( "%lf", &(chrmsInputs->durationCHRMSstage[i][j][k]));
             }
         }
 	}
 
     // Square root transformation settings
 	readAndSkipPast("CHRMDurationUseSqrtTrans", inputFile);
-	fscanf(inputFile,"%d", &tempBool);
-	chrmsInputs.enableCHRMSDurationSqrtTransform = (bool) tempBool;
+	inputFile->scan("%d", &tempBool);
+	chrmsInputs->enableCHRMSDurationSqrtTransform = (bool) tempBool;
 
 	// Read in probability of prevalent CHRMs, modifiers, and months since start
 	for (int i = 0; i < CHRM_NUM; i++) {
@@ -1836,14 +2760,14 @@ void SimContext::readCHRMsInputs() {
 		readAndSkipPast2(scratch, "HIVneg", inputFile);
 		for (int k = 0; k < GENDER_NUM; k++) {
 			for (int l = 0; l < CHRM_AGE_CAT_NUM; l++) {
-				fscanf(inputFile, "%lf", &(chrmsInputs.probPrevalentCHRMsHIVneg[i][k][l]));
+				inputFile->scan("%lf", &(chrmsInputs->probPrevalentCHRMsHIVneg[i][k][l]));
 			}
 		}
 		for (int j = CD4_NUM_STRATA - 1; j >= 0; j--) {
 			readAndSkipPast2(scratch, CD4_STRATA_STRS[j], inputFile);
 			for (int k = 0; k < GENDER_NUM; k++) {
 				for (int l = 0; l < CHRM_AGE_CAT_NUM; l++) {
-					fscanf(inputFile, "%lf", &(chrmsInputs.probPrevalentCHRMs[i][j][k][l]));
+					inputFile->scan("%lf", &(chrmsInputs->probPrevalentCHRMs[i][j][k][l]));
 				}
 			}
 		}
@@ -1851,38 +2775,38 @@ void SimContext::readCHRMsInputs() {
 	for (int i = 0; i < CHRM_NUM; i++) {
 		readAndSkipPast2("PrevCHRMRiskLogit", CHRM_STRS[i], inputFile);
 		for (int j = 0; j < RISK_FACT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(chrmsInputs.probPrevalentCHRMsRiskFactorLogit[i][j]));
+			inputFile->scan("%lf", &(chrmsInputs->probPrevalentCHRMsRiskFactorLogit[i][j]));
 		}
 	}
 	for (int i = 0; i < CHRM_NUM; i++) {
 		readAndSkipPast2("PrevCHRMNumMonths", CHRM_STRS[i], inputFile);
-		fscanf(inputFile, "%lf %lf", &(chrmsInputs.prevalentCHRMsMonthsSinceStartMean[i]),
-				&(chrmsInputs.prevalentCHRMsMonthsSinceStartStdDev[i]));
+		inputFile->scan("%lf %lf", &(chrmsInputs->prevalentCHRMsMonthsSinceStartMean[i]),
+				&(chrmsInputs->prevalentCHRMsMonthsSinceStartStdDev[i]));
 	}
 
 	for (int i = 0; i < CHRM_NUM; i++) {
 		readAndSkipPast2("PrevCHRMNumMonthsOrphans", CHRM_STRS[i], inputFile);
 		for (int j = 0; j < CHRM_ORPHANS_AGE_CAT_NUM; j++)
-			fscanf(inputFile, "%d", &(chrmsInputs.prevalentCHRMsMonthsSinceStartOrphans[i][j]));
+			inputFile->scan("%d", &(chrmsInputs->prevalentCHRMsMonthsSinceStartOrphans[i][j]));
 	}
 
 	// Read in probability of incident CHRMs and modifiers
 	readAndSkipPast("MinMthsSincePrevCHRMSOrphans", inputFile);
-	fscanf(inputFile,"%d", &(chrmsInputs.incidentCHRMsMonthsSincePreviousOrphans));
+	inputFile->scan("%d", &(chrmsInputs->incidentCHRMsMonthsSincePreviousOrphans));
 
 	for (int i = 0; i < CHRM_NUM; i++) {
 		sprintf(scratch, "ProbIncidCHRM_%s", CHRM_STRS[i]);
 		readAndSkipPast2(scratch, "HIVneg", inputFile);
 		for (int k = 0; k < GENDER_NUM; k++) {
 			for (int l = 0; l < CHRM_AGE_CAT_NUM; l++) {
-				fscanf(inputFile, "%lf", &(chrmsInputs.probIncidentCHRMsHIVneg[i][k][l]));
+				inputFile->scan("%lf", &(chrmsInputs->probIncidentCHRMsHIVneg[i][k][l]));
 			}
 		}
 		for (int j = CD4_NUM_STRATA - 1; j >= 0; j--) {
 			readAndSkipPast2(scratch, CD4_STRATA_STRS[j], inputFile);
 			for (int k = 0; k < GENDER_NUM; k++) {
 				for (int l = 0; l < CHRM_AGE_CAT_NUM; l++) {
-					fscanf(inputFile, "%lf", &(chrmsInputs.probIncidentCHRMs[i][j][k][l]));
+					inputFile->scan("%lf", &(chrmsInputs->probIncidentCHRMs[i][j][k][l]));
 				}
 			}
 		}
@@ -1890,19 +2814,19 @@ void SimContext::readCHRMsInputs() {
 	for (int i = 0; i < CHRM_NUM; i++) {
 		readAndSkipPast2("IncidCHRMOnARTMult", CHRM_STRS[i], inputFile);
 		for (int j = CD4_NUM_STRATA - 1; j >= 0; j--) {
-			fscanf(inputFile, "%lf", &(chrmsInputs.probIncidentCHRMsOnARTMult[i][j]));
+			inputFile->scan("%lf", &(chrmsInputs->probIncidentCHRMsOnARTMult[i][j]));
 		}
 	}
 	for (int i = 0; i < CHRM_NUM; i++) {
 		readAndSkipPast2("IncidCHRMRiskLogit", CHRM_STRS[i], inputFile);
 		for (int j = 0; j < RISK_FACT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(chrmsInputs.probIncidentCHRMsRiskFactorLogit[i][j]));
+			inputFile->scan("%lf", &(chrmsInputs->probIncidentCHRMsRiskFactorLogit[i][j]));
 		}
 	}
 	for (int i = 0; i < CHRM_NUM; i++) {
 		readAndSkipPast2("IncidCHRMHistoryLogit", CHRM_STRS[i], inputFile);
 		for (int j = 0; j < CHRM_NUM; j++) {
-			fscanf(inputFile, "%lf", &(chrmsInputs.probIncidentCHRMsPriorHistoryLogit[i][j]));
+			inputFile->scan("%lf", &(chrmsInputs->probIncidentCHRMsPriorHistoryLogit[i][j]));
 		}
 	}
 
@@ -1913,7 +2837,7 @@ void SimContext::readCHRMsInputs() {
 			readAndSkipPast( scratch, inputFile );
 				for (int l = 0; l < GENDER_NUM; l++) {
 					for (int m = 0; m < CHRM_AGE_CAT_NUM; m++) {
-						fscanf(inputFile, "%lf", &(chrmsInputs.CHRMsDeathRateRatio[i][j][l][m]));
+						inputFile->scan("%lf", &(chrmsInputs->CHRMsDeathRateRatio[i][j][l][m]));
 				}
 			}
 		}
@@ -1928,13 +2852,13 @@ void SimContext::readCHRMsInputs() {
 			readAndSkipPast(scratch, inputFile);
 			for (int k = 0; k < GENDER_NUM; k++) {
 				for (int l = 0; l < CHRM_AGE_CAT_NUM; l++) {
-					fscanf(inputFile, "%lf", &(chrmsInputs.costCHRMs[i][j][k][l]));
+					inputFile->scan("%lf", &(chrmsInputs->costCHRMs[i][j][k][l]));
 				}
 			}
 		}
 		sprintf(scratch, "CostDeathCHRM_%s", CHRM_STRS[i]);
 		readAndSkipPast(scratch, inputFile);
-		fscanf(inputFile, "%lf", &(chrmsInputs.costDeathCHRMs[i]));
+		inputFile->scan("%lf", &(chrmsInputs->costDeathCHRMs[i]));
 	}
 
 	// Read in QOL of CHRMs for each stage
@@ -1946,24 +2870,24 @@ void SimContext::readCHRMsInputs() {
 			readAndSkipPast(scratch, inputFile);
 			for (int k = 0; k < GENDER_NUM; k++) {
 				for (int l = 0; l < CHRM_AGE_CAT_NUM; l++) {
-					fscanf(inputFile, "%lf", &(chrmsInputs.QOLModCHRMs[i][j][k][l]));
+					inputFile->scan("%lf", &(chrmsInputs->QOLModCHRMs[i][j][k][l]));
 				}
 			}
 		}
 		sprintf(scratch, "QOLModDeathCHRM_%s", CHRM_STRS[i]);
 		readAndSkipPast(scratch, inputFile);
-		fscanf(inputFile, "%lf", &(chrmsInputs.QOLModDeathCHRMs[i]));
+		inputFile->scan("%lf", &(chrmsInputs->QOLModDeathCHRMs[i]));
 	}
 
 	// Read in QOL modifiers for multiple CHRMs
 	readAndSkipPast("QOLModMultipleCHRMs",inputFile);
 	for (int i = 0; i < CHRM_NUM-1; i++) {
-		fscanf(inputFile, "%lf", &(chrmsInputs.QOLModMultipleCHRMs[i]));
+		inputFile->scan("%lf", &(chrmsInputs->QOLModMultipleCHRMs[i]));
 	}
 } /* end readCHRMsInputs */
 
 /* readCostInputs reads data from the Cost tab of the input sheet */
-void SimContext::readCostInputs() {
+void SimContext::readCostInputs(InputReader *inputFile) {
 	char tmpBuf[256];
 	int i, j, k;
 
@@ -1971,7 +2895,7 @@ void SimContext::readCostInputs() {
 	readAndSkipPast( "CostAgeBounds", inputFile );
 	readAndSkipPast( "EndYr", inputFile );
 	for (i = 0; i < COST_AGE_CAT_NUM - 1; ++i) {
-		fscanf( inputFile, "%d", &(costInputs.costAgeBounds[i]));
+		inputFile->scan( "%d", &(costInputs->costAgeBounds[i]));
 	}
 
 	for (int t=1; t <= COST_AGE_CAT_NUM; t++){
@@ -1981,7 +2905,7 @@ void SimContext::readCostInputs() {
 			readAndSkipPast( tmpBuf, inputFile );
 			readAndSkipPast( OI_STRS[i], inputFile );
 			for (j = 0; j < COST_NUM_TYPES; j++) {
-				fscanf(inputFile, "%lf", &(costInputs.acuteOICostTreated[t-1][ART_OFF_STATE][i][j]) );
+				inputFile->scan("%lf", &(costInputs->acuteOICostTreated[t-1][ART_OFF_STATE][i][j]) );
 			}
 		}
 		for ( i = 0; i < OI_NUM; ++i ) {
@@ -1989,7 +2913,7 @@ void SimContext::readCostInputs() {
 			readAndSkipPast( tmpBuf, inputFile );
 			readAndSkipPast( OI_STRS[i], inputFile );
 			for (j = 0; j < COST_NUM_TYPES; j++) {
-				fscanf(inputFile, "%lf", &(costInputs.acuteOICostUntreated[t-1][ART_OFF_STATE][i][j]) );
+				inputFile->scan("%lf", &(costInputs->acuteOICostUntreated[t-1][ART_OFF_STATE][i][j]) );
 			}
 		}
 		for ( i = 0; i < OI_NUM; ++i ) {
@@ -1997,7 +2921,7 @@ void SimContext::readCostInputs() {
 			readAndSkipPast( tmpBuf, inputFile );
 			readAndSkipPast( OI_STRS[i], inputFile );
 			for (j = 0; j < COST_NUM_TYPES; j++) {
-				fscanf(inputFile, "%lf", &(costInputs.acuteOICostTreated[t-1][ART_ON_STATE][i][j]) );
+				inputFile->scan("%lf", &(costInputs->acuteOICostTreated[t-1][ART_ON_STATE][i][j]) );
 			}
 		}
 		for ( i = 0; i < OI_NUM; ++i ) {
@@ -2005,19 +2929,19 @@ void SimContext::readCostInputs() {
 			readAndSkipPast( tmpBuf, inputFile );
 			readAndSkipPast( OI_STRS[i], inputFile );
 			for (j = 0; j < COST_NUM_TYPES; j++) {
-				fscanf(inputFile, "%lf", &(costInputs.acuteOICostUntreated[t-1][ART_ON_STATE][i][j]) );
+				inputFile->scan("%lf", &(costInputs->acuteOICostUntreated[t-1][ART_ON_STATE][i][j]) );
 			}
 		}
 		// read in CD4 / HVL test costs
 		sprintf(tmpBuf, "AgeCat%dCostCD4Test", t);
 		readAndSkipPast( tmpBuf, inputFile );
 		for (i = 0; i < COST_NUM_TYPES; i++) {
-			fscanf(inputFile, "%lf", &(costInputs.CD4TestCost[t-1][i]) );
+			inputFile->scan("%lf", &(costInputs->CD4TestCost[t-1][i]) );
 		}
 		sprintf(tmpBuf, "AgeCat%dCostHVLTest", t);
 		readAndSkipPast( tmpBuf, inputFile );
 		for (i = 0; i < COST_NUM_TYPES; i++) {
-			fscanf(inputFile, "%lf", &(costInputs.HVLTestCost[t-1][i]) );
+			inputFile->scan("%lf", &(costInputs->HVLTestCost[t-1][i]) );
 		}
 		// read in death from OI costs
 		for ( i = 0; i < DTH_NUM_CAUSES_BASIC; ++i ) {
@@ -2025,7 +2949,7 @@ void SimContext::readCostInputs() {
 			readAndSkipPast( tmpBuf, inputFile );
 			readAndSkipPast( DTH_CAUSES_STRS[i], inputFile);
 			for (j = 0; j < COST_NUM_TYPES; j++) {
-				fscanf(inputFile, "%lf", &(costInputs.deathCostTreated[t-1][ART_OFF_STATE][i][j]) );
+				inputFile->scan("%lf", &(costInputs->deathCostTreated[t-1][ART_OFF_STATE][i][j]) );
 			}
 		}
 		for ( i = 0; i < DTH_NUM_CAUSES_BASIC; ++i ) {
@@ -2033,7 +2957,7 @@ void SimContext::readCostInputs() {
 			readAndSkipPast( tmpBuf, inputFile );
 			readAndSkipPast( DTH_CAUSES_STRS[i], inputFile);
 			for (j = 0; j < COST_NUM_TYPES; j++) {
-				fscanf(inputFile, "%lf", &(costInputs.deathCostUntreated[t-1][ART_OFF_STATE][i][j]) );
+				inputFile->scan("%lf", &(costInputs->deathCostUntreated[t-1][ART_OFF_STATE][i][j]) );
 			}
 		}
 		for ( i = 0; i < DTH_NUM_CAUSES_BASIC; ++i ) {
@@ -2041,7 +2965,7 @@ void SimContext::readCostInputs() {
 			readAndSkipPast( tmpBuf, inputFile );
 			readAndSkipPast( DTH_CAUSES_STRS[i], inputFile);
 			for (j = 0; j < COST_NUM_TYPES; j++) {
-				fscanf(inputFile, "%lf", &(costInputs.deathCostTreated[t-1][ART_ON_STATE][i][j]) );
+				inputFile->scan("%lf", &(costInputs->deathCostTreated[t-1][ART_ON_STATE][i][j]) );
 			}
 		}
 		for ( i = 0; i < DTH_NUM_CAUSES_BASIC; ++i ) {
@@ -2049,7 +2973,7 @@ void SimContext::readCostInputs() {
 			readAndSkipPast( tmpBuf, inputFile );
 			readAndSkipPast( DTH_CAUSES_STRS[i], inputFile);
 			for (j = 0; j < COST_NUM_TYPES; j++) {
-				fscanf(inputFile, "%lf", &(costInputs.deathCostUntreated[t-1][ART_ON_STATE][i][j]) );
+				inputFile->scan("%lf", &(costInputs->deathCostUntreated[t-1][ART_ON_STATE][i][j]) );
 			}
 		}
 	}
@@ -2058,25 +2982,25 @@ void SimContext::readCostInputs() {
 	readAndSkipPast("CostGenMed_dmed", inputFile);
 	for (i = 0; i < GENDER_NUM; i++) {
 		for (j = 0; j < COST_AGE_CAT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(costInputs.generalMedicineCost[i][j][COST_DIR_MED]));
+			inputFile->scan("%lf", &(costInputs->generalMedicineCost[i][j][COST_DIR_MED]));
 		}
 	}
 	readAndSkipPast("CostGenMed_nmed", inputFile);
 	for (i = 0; i < GENDER_NUM; i++) {
 		for (j = 0; j < COST_AGE_CAT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(costInputs.generalMedicineCost[i][j][COST_DIR_NONMED]));
+			inputFile->scan("%lf", &(costInputs->generalMedicineCost[i][j][COST_DIR_NONMED]));
 		}
 	}
 	readAndSkipPast("CostGenMed_time", inputFile);
 	for (i = 0; i < GENDER_NUM; i++) {
 		for (j = 0; j < COST_AGE_CAT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(costInputs.generalMedicineCost[i][j][COST_TIME]));
+			inputFile->scan("%lf", &(costInputs->generalMedicineCost[i][j][COST_TIME]));
 		}
 	}
 	readAndSkipPast("CostGenMed_indr", inputFile);
 	for (i = 0; i < GENDER_NUM; i++) {
 		for (j = 0; j < COST_AGE_CAT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(costInputs.generalMedicineCost[i][j][COST_INDIR]));
+			inputFile->scan("%lf", &(costInputs->generalMedicineCost[i][j][COST_INDIR]));
 		}
 	}
 	// read in routine care costs for HIV positive, not on ART
@@ -2084,25 +3008,25 @@ void SimContext::readCostInputs() {
 		readAndSkipPast2("CostRoutine_HIVpos_noART_dmed", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < GENDER_NUM; j++) {
 			for (k = 0; k < COST_AGE_CAT_NUM; k++) {
-				fscanf(inputFile, "%lf", &(costInputs.routineCareCostHIVPositive[ART_OFF_STATE][i][j][k][COST_DIR_MED]));
+				inputFile->scan("%lf", &(costInputs->routineCareCostHIVPositive[ART_OFF_STATE][i][j][k][COST_DIR_MED]));
 			}
 		}
 		readAndSkipPast2("CostRoutine_HIVpos_noART_nmed", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < GENDER_NUM; j++) {
 			for (k = 0; k < COST_AGE_CAT_NUM; k++) {
-				fscanf(inputFile, "%lf", &(costInputs.routineCareCostHIVPositive[ART_OFF_STATE][i][j][k][COST_DIR_NONMED]));
+				inputFile->scan("%lf", &(costInputs->routineCareCostHIVPositive[ART_OFF_STATE][i][j][k][COST_DIR_NONMED]));
 			}
 		}
 		readAndSkipPast2("CostRoutine_HIVpos_noART_time", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < GENDER_NUM; j++) {
 			for (k = 0; k < COST_AGE_CAT_NUM; k++) {
-				fscanf(inputFile, "%lf", &(costInputs.routineCareCostHIVPositive[ART_OFF_STATE][i][j][k][COST_TIME]));
+				inputFile->scan("%lf", &(costInputs->routineCareCostHIVPositive[ART_OFF_STATE][i][j][k][COST_TIME]));
 			}
 		}
 		readAndSkipPast2("CostRoutine_HIVpos_noART_indr", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < GENDER_NUM; j++) {
 			for (k = 0; k < COST_AGE_CAT_NUM; k++) {
-				fscanf(inputFile, "%lf", &(costInputs.routineCareCostHIVPositive[ART_OFF_STATE][i][j][k][COST_INDIR]));
+				inputFile->scan("%lf", &(costInputs->routineCareCostHIVPositive[ART_OFF_STATE][i][j][k][COST_INDIR]));
 			}
 		}
 	}
@@ -2111,25 +3035,25 @@ void SimContext::readCostInputs() {
 		readAndSkipPast2("CostRoutine_HIVpos_onART_dmed", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < GENDER_NUM; j++) {
 			for (k = 0; k < COST_AGE_CAT_NUM; k++) {
-				fscanf(inputFile, "%lf", &(costInputs.routineCareCostHIVPositive[ART_ON_STATE][i][j][k][COST_DIR_MED]));
+				inputFile->scan("%lf", &(costInputs->routineCareCostHIVPositive[ART_ON_STATE][i][j][k][COST_DIR_MED]));
 			}
 		}
 		readAndSkipPast2("CostRoutine_HIVpos_onART_nmed", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < GENDER_NUM; j++) {
 			for (k = 0; k < COST_AGE_CAT_NUM; k++) {
-				fscanf(inputFile, "%lf", &(costInputs.routineCareCostHIVPositive[ART_ON_STATE][i][j][k][COST_DIR_NONMED]));
+				inputFile->scan("%lf", &(costInputs->routineCareCostHIVPositive[ART_ON_STATE][i][j][k][COST_DIR_NONMED]));
 			}
 		}
 		readAndSkipPast2("CostRoutine_HIVpos_onART_time", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < GENDER_NUM; j++) {
 			for (k = 0; k < COST_AGE_CAT_NUM; k++) {
-				fscanf(inputFile, "%lf", &(costInputs.routineCareCostHIVPositive[ART_ON_STATE][i][j][k][COST_TIME]));
+				inputFile->scan("%lf", &(costInputs->routineCareCostHIVPositive[ART_ON_STATE][i][j][k][COST_TIME]));
 			}
 		}
 		readAndSkipPast2("CostRoutine_HIVpos_onART_indr", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < GENDER_NUM; j++) {
 			for (k = 0; k < COST_AGE_CAT_NUM; k++) {
-				fscanf(inputFile, "%lf", &(costInputs.routineCareCostHIVPositive[ART_ON_STATE][i][j][k][COST_INDIR]));
+				inputFile->scan("%lf", &(costInputs->routineCareCostHIVPositive[ART_ON_STATE][i][j][k][COST_INDIR]));
 			}
 		}
 	}
@@ -2138,56 +3062,56 @@ void SimContext::readCostInputs() {
 	readAndSkipPast("CostNeg_dmed", inputFile);
 	for (i = 0; i < GENDER_NUM; i++) {
 		for (j = 0; j < COST_AGE_CAT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(costInputs.routineCareCostHIVNegative[i][j][COST_DIR_MED]));
+			inputFile->scan("%lf", &(costInputs->routineCareCostHIVNegative[i][j][COST_DIR_MED]));
 		}
 	}
 	readAndSkipPast("CostNeg_nmed", inputFile);
 	for (i = 0; i < GENDER_NUM; i++) {
 		for (j = 0; j < COST_AGE_CAT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(costInputs.routineCareCostHIVNegative[i][j][COST_DIR_NONMED]));
+			inputFile->scan("%lf", &(costInputs->routineCareCostHIVNegative[i][j][COST_DIR_NONMED]));
 		}
 	}
 	readAndSkipPast("CostNeg_time", inputFile);
 	for (i = 0; i < GENDER_NUM; i++) {
 		for (j = 0; j < COST_AGE_CAT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(costInputs.routineCareCostHIVNegative[i][j][COST_TIME]));
+			inputFile->scan("%lf", &(costInputs->routineCareCostHIVNegative[i][j][COST_TIME]));
 		}
 	}
 	readAndSkipPast("CostNeg_indr", inputFile);
 	for (i = 0; i < GENDER_NUM; i++) {
 		for (j = 0; j < COST_AGE_CAT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(costInputs.routineCareCostHIVNegative[i][j][COST_INDIR]));
+			inputFile->scan("%lf", &(costInputs->routineCareCostHIVNegative[i][j][COST_INDIR]));
 		}
 	}
 	readAndSkipPast("CostNegStopAge", inputFile);
-	fscanf(inputFile, "%d", &(costInputs.routineCareCostHIVNegativeStopAge));
+	inputFile->scan("%d", &(costInputs->routineCareCostHIVNegativeStopAge));
 
 	readAndSkipPast("CostUndet_dmed", inputFile);
 	for (i = 0; i < GENDER_NUM; i++) {
 		for (j = 0; j < COST_AGE_CAT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(costInputs.routineCareCostHIVPositiveUndetected[i][j][COST_DIR_MED]));
+			inputFile->scan("%lf", &(costInputs->routineCareCostHIVPositiveUndetected[i][j][COST_DIR_MED]));
 		}
 	}
 	readAndSkipPast("CostUndet_nmed", inputFile);
 	for (i = 0; i < GENDER_NUM; i++) {
 		for (j = 0; j < COST_AGE_CAT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(costInputs.routineCareCostHIVPositiveUndetected[i][j][COST_DIR_NONMED]));
+			inputFile->scan("%lf", &(costInputs->routineCareCostHIVPositiveUndetected[i][j][COST_DIR_NONMED]));
 		}
 	}
 	readAndSkipPast("CostUndet_time", inputFile);
 	for (i = 0; i < GENDER_NUM; i++) {
 		for (j = 0; j < COST_AGE_CAT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(costInputs.routineCareCostHIVPositiveUndetected[i][j][COST_TIME]));
+			inputFile->scan("%lf", &(costInputs->routineCareCostHIVPositiveUndetected[i][j][COST_TIME]));
 		}
 	}
 	readAndSkipPast("CostUndet_indr", inputFile);
 	for (i = 0; i < GENDER_NUM; i++) {
 		for (j = 0; j < COST_AGE_CAT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(costInputs.routineCareCostHIVPositiveUndetected[i][j][COST_INDIR]));
+			inputFile->scan("%lf", &(costInputs->routineCareCostHIVPositiveUndetected[i][j][COST_INDIR]));
 		}
 	}
 	readAndSkipPast("CostUndetStopAge", inputFile);
-	fscanf(inputFile, "%d", &(costInputs.routineCareCostHIVPositiveUndetectedStopAge));
+	inputFile->scan("%d", &(costInputs->routineCareCostHIVPositiveUndetectedStopAge));
 
 	// read in contact/clinic vist costs
 	for (int t=1; t <= COST_AGE_CAT_NUM; t++){
@@ -2196,7 +3120,7 @@ void SimContext::readCostInputs() {
 				sprintf(tmpBuf, "AgeCat%dCostVisit_%s_routine", t, GENDER_STRS[i]);
 				readAndSkipPast2( tmpBuf, CD4_STRATA_STRS[j], inputFile );
 				for (k = 0; k < COST_NUM_TYPES; k++) {
-					fscanf(inputFile, "%lf", &(costInputs.clinicVisitCostRoutine[t-1][i][j][k]) );
+					inputFile->scan("%lf", &(costInputs->clinicVisitCostRoutine[t-1][i][j][k]) );
 				}
 			}
 		}
@@ -2204,388 +3128,391 @@ void SimContext::readCostInputs() {
 } /* end readCostInputs */
 
 /* readTBInputs reads data from the TB tab of the input sheet */
-void SimContext::readTBInputs() {
+void SimContext::readTBInputs(InputReader *inputFile) {
 	char tmpBuf[256], tmpBuf2[256];
 	int i, j, k, tempBool, tempInt;
-	FILE *file = inputFile;
+	InputReader *file = inputFile;
 
 	// read in enable tb toggle
 	readAndSkipPast("EnableTB", inputFile);
-	fscanf( file, "%d", &tempBool);
-	tbInputs.enableTB = (bool) tempBool;
+	file->scan( "%d", &tempBool);
+	tbInputs->enableTB = (bool) tempBool;
+	tbInputs->isTabSkipped = !tbInputs->enableTB && skipDisabledTab(&SimContext::readTBInputs, inputFile);
+	if (tbInputs->isTabSkipped)
+		return;
 
 	readAndSkipPast("TBClinicIntegrated", inputFile);
-	fscanf( file, "%d", &tempBool);
-	tbInputs.isIntegrated = (bool) tempBool;
+	file->scan( "%d", &tempBool);
+	tbInputs->isIntegrated = (bool) tempBool;
 
 	// read in TB distribution at entry
 	readAndSkipPast2( "ProbTB_Entry", "HIV_Neg", file );
 	for (j = 0; j < TB_NUM_STATES; j++)
-		fscanf( file, "%lf", &(tbInputs.distributionTBStateAtEntryHIVNeg[j]));
+		file->scan( "%lf", &(tbInputs->distributionTBStateAtEntryHIVNeg[j]));
 
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
 		readAndSkipPast2( "ProbTB_Entry", CD4_STRATA_STRS[i], file );
 		for (j = 0; j < TB_NUM_STATES; j++)
-			fscanf( file, "%lf", &(tbInputs.distributionTBStateAtEntryHIVPos[i][j]));
+			file->scan( "%lf", &(tbInputs->distributionTBStateAtEntryHIVPos[i][j]));
 	}
 
 	//Read in tb strain at entry
 	readAndSkipPast( "DistTB_Entry_Strain", file );
 	for (i = 0; i < TB_NUM_STRAINS; ++i)
-		fscanf( file, "%lf", &(tbInputs.distributionTBStrainAtEntry[i]));
+		file->scan( "%lf", &(tbInputs->distributionTBStrainAtEntry[i]));
 
 	readAndSkipPast( "MthsSinceInitTBTreatStop_Entry", file );
-	fscanf( file, "%lf %lf",  &(tbInputs.monthsSinceInitTreatStopMean),  &(tbInputs.monthsSinceInitTreatStopStdDev));
+	file->scan( "%lf %lf",  &(tbInputs->monthsSinceInitTreatStopMean),  &(tbInputs->monthsSinceInitTreatStopStdDev));
 
 	//Read in tracker variables
 	readAndSkipPast2( "ProbSputum_Entry", "HIV_Neg", file );
 	for (j = 0; j < TB_NUM_STATES; j++)
-		fscanf( file, "%lf", &(tbInputs.distributionTBTrackerAtEntryHIVNeg[TB_TRACKER_SPUTUM_HI][j]));
+		file->scan( "%lf", &(tbInputs->distributionTBTrackerAtEntryHIVNeg[TB_TRACKER_SPUTUM_HI][j]));
 
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
 		readAndSkipPast2( "ProbSputum_Entry", CD4_STRATA_STRS[i], file );
 		for (j = 0; j < TB_NUM_STATES; j++)
-			fscanf( file, "%lf", &(tbInputs.distributionTBTrackerAtEntryHIVPos[i][TB_TRACKER_SPUTUM_HI][j]));
+			file->scan( "%lf", &(tbInputs->distributionTBTrackerAtEntryHIVPos[i][TB_TRACKER_SPUTUM_HI][j]));
 	}
 
 	readAndSkipPast2( "ProbImmune_Entry", "HIV_Neg", file );
 	for (j = 0; j < TB_NUM_STATES; j++)
-		fscanf( file, "%lf", &(tbInputs.distributionTBTrackerAtEntryHIVNeg[TB_TRACKER_IMMUNE_REACTIVE][j]));
+		file->scan( "%lf", &(tbInputs->distributionTBTrackerAtEntryHIVNeg[TB_TRACKER_IMMUNE_REACTIVE][j]));
 
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
 		readAndSkipPast2( "ProbImmune_Entry", CD4_STRATA_STRS[i], file );
 		for (j = 0; j < TB_NUM_STATES; j++)
-			fscanf( file, "%lf", &(tbInputs.distributionTBTrackerAtEntryHIVPos[i][TB_TRACKER_IMMUNE_REACTIVE][j]));
+			file->scan( "%lf", &(tbInputs->distributionTBTrackerAtEntryHIVPos[i][TB_TRACKER_IMMUNE_REACTIVE][j]));
 	}
 
 	readAndSkipPast2( "ProbSymptoms_Entry", "HIV_Neg", file );
 	for (j = 0; j < TB_NUM_STATES; j++)
-		fscanf( file, "%lf", &(tbInputs.distributionTBTrackerAtEntryHIVNeg[TB_TRACKER_SYMPTOMS][j]));
+		file->scan( "%lf", &(tbInputs->distributionTBTrackerAtEntryHIVNeg[TB_TRACKER_SYMPTOMS][j]));
 
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
 		readAndSkipPast2( "ProbSymptoms_Entry", CD4_STRATA_STRS[i], file );
 		for (j = 0; j < TB_NUM_STATES; j++)
-			fscanf( file, "%lf", &(tbInputs.distributionTBTrackerAtEntryHIVPos[i][TB_TRACKER_SYMPTOMS][j]));
+			file->scan( "%lf", &(tbInputs->distributionTBTrackerAtEntryHIVPos[i][TB_TRACKER_SYMPTOMS][j]));
 	}
 
 	// nat hist
 	//Prob infection or reinfection
 	readAndSkipPast2( "ProbMthTBIncid", "HIV_Neg", file );
 	for (j = 0; j < TB_INFECT_NUM_AGE_CAT; j++)
-		fscanf( file, "%lf", &(tbInputs.probInfectionHIVNeg[j]));
+		file->scan( "%lf", &(tbInputs->probInfectionHIVNeg[j]));
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
 		readAndSkipPast2( "ProbMthTBIncid", CD4_STRATA_STRS[i], file );
 		for (j = 0; j < TB_INFECT_NUM_AGE_CAT; j++)
-			fscanf( file, "%lf", &(tbInputs.probInfectionHIVPos[i][j]));
+			file->scan( "%lf", &(tbInputs->probInfectionHIVPos[i][j]));
 	}
 
 	readAndSkipPast( "TBInfectionMultiplier", file );
 	for (j = 0; j < TB_NUM_STATES; j++)
-		fscanf( file, "%lf", &(tbInputs.infectionMultiplier[j]));
+		file->scan( "%lf", &(tbInputs->infectionMultiplier[j]));
 
 	//prob immune reactive on infection
 	readAndSkipPast( "ProbImmune_Infection", file );
-	fscanf( file, "%lf", &(tbInputs.probImmuneReactiveOnInfectionHIVNeg));
+	file->scan( "%lf", &(tbInputs->probImmuneReactiveOnInfectionHIVNeg));
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
-		fscanf( file, "%lf", &(tbInputs.probImmuneReactiveOnInfectionHIVPos[i]));
+		file->scan( "%lf", &(tbInputs->probImmuneReactiveOnInfectionHIVPos[i]));
 	}
 
 	//Nat Hist Activation
 	readAndSkipPast( "TBActivationMthThreshold", file );
-	fscanf( file, "%d", &(tbInputs.probActivateMthThreshold));
+	file->scan( "%d", &(tbInputs->probActivateMthThreshold));
 
 	readAndSkipPast( "TBActivationProbActivate1", file );
-	fscanf( file, "%lf", &(tbInputs.probActivateHIVNeg[0]));
+	file->scan( "%lf", &(tbInputs->probActivateHIVNeg[0]));
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
-		fscanf( file, "%lf", &(tbInputs.probActivateHIVPos[0][i]));
+		file->scan( "%lf", &(tbInputs->probActivateHIVPos[0][i]));
 	}
 
 	readAndSkipPast( "TBActivationProbActivate2", file );
-	fscanf( file, "%lf", &(tbInputs.probActivateHIVNeg[1]));
+	file->scan( "%lf", &(tbInputs->probActivateHIVNeg[1]));
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
-		fscanf( file, "%lf", &(tbInputs.probActivateHIVPos[1][i]));
+		file->scan( "%lf", &(tbInputs->probActivateHIVPos[1][i]));
 	}
 
 	readAndSkipPast( "TBActivationPropPulm", file );
-	fscanf( file, "%lf", &(tbInputs.probPulmonaryOnActivationHIVNeg));
+	file->scan( "%lf", &(tbInputs->probPulmonaryOnActivationHIVNeg));
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
-		fscanf( file, "%lf", &(tbInputs.probPulmonaryOnActivationHIVPos[i]));
+		file->scan( "%lf", &(tbInputs->probPulmonaryOnActivationHIVPos[i]));
 	}
 
 	readAndSkipPast( "ProbSputumHiOnActivation", file );
-	fscanf( file, "%lf", &(tbInputs.probSputumHiOnActivationPulmHIVNeg));
+	file->scan( "%lf", &(tbInputs->probSputumHiOnActivationPulmHIVNeg));
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
-		fscanf( file, "%lf", &(tbInputs.probSputumHiOnActivationPulmHIVPos[i]));
+		file->scan( "%lf", &(tbInputs->probSputumHiOnActivationPulmHIVPos[i]));
 	}
 
 
 	//Nat Hist Relapse
 	readAndSkipPast( "TBIncidenceRelapse", file );
-	fscanf( file, "%lf %lf %d %d", &(tbInputs.probRelapseTtoARateMultiplier), &(tbInputs.probRelapseTtoAExponent), &(tbInputs.probRelapseTtoAThreshold),&(tbInputs.probRelapseEffHorizon));
+	file->scan( "%lf %lf %d %d", &(tbInputs->probRelapseTtoARateMultiplier), &(tbInputs->probRelapseTtoAExponent), &(tbInputs->probRelapseTtoAThreshold),&(tbInputs->probRelapseEffHorizon));
 
 	readAndSkipPast( "TBRelapseFCD4", file );
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
-		fscanf( file, "%lf", &(tbInputs.probRelapseTtoAFCD4[i]));
+		file->scan( "%lf", &(tbInputs->probRelapseTtoAFCD4[i]));
 	}
 	readAndSkipPast( "TBTreatDefaultRelapseMult", file);
-	fscanf( file, "%lf", &(tbInputs.relapseRateMultTBTreatDefault));
+	file->scan( "%lf", &(tbInputs->relapseRateMultTBTreatDefault));
 
 	readAndSkipPast( "TBRelapsePropPulm", file );
-	fscanf( file, "%lf", &(tbInputs.probPulmonaryOnRelapseHIVNeg));
+	file->scan( "%lf", &(tbInputs->probPulmonaryOnRelapseHIVNeg));
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
-		fscanf( file, "%lf", &(tbInputs.probPulmonaryOnRelapseHIVPos[i]));
+		file->scan( "%lf", &(tbInputs->probPulmonaryOnRelapseHIVPos[i]));
 	}
 
 	readAndSkipPast( "ProbSputumHiOnRelapse", file );
-	fscanf( file, "%lf", &(tbInputs.probSputumHiOnRelapsePulmHIVNeg));
+	file->scan( "%lf", &(tbInputs->probSputumHiOnRelapsePulmHIVNeg));
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
-		fscanf( file, "%lf", &(tbInputs.probSputumHiOnRelapsePulmHIVPos[i]));
+		file->scan( "%lf", &(tbInputs->probSputumHiOnRelapsePulmHIVPos[i]));
 	}
 
 	readAndSkipPast( "TBRelapseMthUnfavorableOutcome", file );
-	fscanf( file, "%d", &(tbInputs.monthRelapseUnfavorableOutcome));
+	file->scan( "%d", &(tbInputs->monthRelapseUnfavorableOutcome));
 
 	// read in TB Sypmtoms monthly incidence
 	readAndSkipPast2( "TBSymptomsIncidence", "HIV_Neg", file );
 	for (j = 0; j < TB_NUM_STATES; j++)
-		fscanf( file, "%lf", &(tbInputs.probTBSymptomsMonthHIVNeg[j]));
+		file->scan( "%lf", &(tbInputs->probTBSymptomsMonthHIVNeg[j]));
 
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
 		readAndSkipPast2( "TBSymptomsIncidence", CD4_STRATA_STRS[i], file );
 		for (j = 0; j < TB_NUM_STATES; j++)
-			fscanf( file, "%lf", &(tbInputs.probTBSymptomsMonthHIVPos[i][j]));
+			file->scan( "%lf", &(tbInputs->probTBSymptomsMonthHIVPos[i][j]));
 	}
 
 	// read in death rate ratios for active TB 
 	readAndSkipPast2( "TBDthRateRatio", "HIV_Neg", file );
-	fscanf( file, "%lf %lf", &(tbInputs.TBDeathRateRatioActivePulmHIVneg),&(tbInputs.TBDeathRateRatioExtraPulmHIVneg) );
+	file->scan( "%lf %lf", &(tbInputs->TBDeathRateRatioActivePulmHIVneg),&(tbInputs->TBDeathRateRatioExtraPulmHIVneg) );
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
 		readAndSkipPast2( "TBDthRateRatio", CD4_STRATA_STRS[i], file );
-		fscanf( file, "%lf %lf", &(tbInputs.TBDeathRateRatioActivePulmHIVPos[i]), &(tbInputs.TBDeathRateRatioExtraPulmHIVPos[i]));
+		file->scan( "%lf %lf", &(tbInputs->TBDeathRateRatioActivePulmHIVPos[i]), &(tbInputs->TBDeathRateRatioExtraPulmHIVPos[i]));
 	}
 
 	// read in death rate ratios and stage bounds for TB treatment success and failure
 	readAndSkipPast("TBDthRateRatioTxSuccessBounds", inputFile);
 	for ( i = 0; i < 2; i++){
-		fscanf( inputFile, "%d", &(tbInputs.TBDeathRateRatioTxSuccessBounds[i]));
+		inputFile->scan( "%d", &(tbInputs->TBDeathRateRatioTxSuccessBounds[i]));
 	}
 	for( i = 0; i < 3; i++ ){
 		sprintf(tmpBuf, "TBDthRateRatioTxSuccessHIVNeg_T%d", i + 1);
 		readAndSkipPast(tmpBuf, inputFile);
-		fscanf( file, "%lf", &(tbInputs.TBDeathRateRatioTreatmentSuccessHIVNeg[i]));
+		file->scan( "%lf", &(tbInputs->TBDeathRateRatioTreatmentSuccessHIVNeg[i]));
 		sprintf(tmpBuf, "TBDthRateRatioTxSuccessHIVPos_T%d", i + 1);	
 		readAndSkipPast(tmpBuf, inputFile);
 		for ( j = CD4_NUM_STRATA - 1; j >= 0; --j){
-			fscanf( inputFile, "%lf", &(tbInputs.TBDeathRateRatioTreatmentSuccessHIVPos[i][j]));
+			inputFile->scan( "%lf", &(tbInputs->TBDeathRateRatioTreatmentSuccessHIVPos[i][j]));
 		}
 	}
 	
 	readAndSkipPast("TBDthRateRatioTxFailureBounds", inputFile);
 	for ( i = 0; i < 2; i++){
-		fscanf( inputFile, "%d", &(tbInputs.TBDeathRateRatioTxFailureBounds[i]));
+		inputFile->scan( "%d", &(tbInputs->TBDeathRateRatioTxFailureBounds[i]));
 	}
 	for (i = 0; i < 3; i++){
 		sprintf(tmpBuf, "TBDthRateRatioTxFailureHIVNeg_T%d", i + 1);
 		readAndSkipPast(tmpBuf, inputFile);
-		fscanf( file, "%lf", &(tbInputs.TBDeathRateRatioTreatmentFailureHIVNeg[i]));
+		file->scan( "%lf", &(tbInputs->TBDeathRateRatioTreatmentFailureHIVNeg[i]));
 		sprintf(tmpBuf, "TBDthRateRatioTxFailureHIVPos_T%d", i + 1);
 		readAndSkipPast(tmpBuf, inputFile);
 		for ( j = CD4_NUM_STRATA - 1; j >= 0; --j){
-			fscanf( inputFile, "%lf", &(tbInputs.TBDeathRateRatioTreatmentFailureHIVPos[i][j]));
+			inputFile->scan( "%lf", &(tbInputs->TBDeathRateRatioTreatmentFailureHIVPos[i][j]));
 		}
 	}
 	
 	// read in natural history multipliers by calendar month
 	readAndSkipPast( "NatHistMultType", file );
-	fscanf( file, "%d", &tempInt);
-	tbInputs.natHistMultType = (TB_MULT_TYPE) tempInt;
+	file->scan( "%d", &tempInt);
+	tbInputs->natHistMultType = (TB_MULT_TYPE) tempInt;
 	
 	readAndSkipPast( "NatHistMultTimeBounds", file );
-	fscanf( file, "%d %d", &(tbInputs.natHistMultTimeBounds[0]), &(tbInputs.natHistMultTimeBounds[1]));
+	file->scan( "%d %d", &(tbInputs->natHistMultTimeBounds[0]), &(tbInputs->natHistMultTimeBounds[1]));
 
 	readAndSkipPast( "NatHistMultTime", file );
-	fscanf( file, "%lf %lf %lf", &(tbInputs.natHistMultTime[0]), &(tbInputs.natHistMultTime[1]),&(tbInputs.natHistMultTime[2]));
+	file->scan( "%lf %lf %lf", &(tbInputs->natHistMultTime[0]), &(tbInputs->natHistMultTime[1]),&(tbInputs->natHistMultTime[2]));
 
 	// self cure inputs
 	readAndSkipPast( "TBSelfCureEnable", file );
-	fscanf( file, "%d", &tempBool);
-	tbInputs.enableSelfCure = (bool) tempBool;
+	file->scan( "%d", &tempBool);
+	tbInputs->enableSelfCure = (bool) tempBool;
 
 	readAndSkipPast( "TBMonthOfSelfCure", file );
-	fscanf( file, "%d", &(tbInputs.selfCureTime));
+	file->scan( "%d", &(tbInputs->selfCureTime));
 
 	// prophylaxis policy for TB
 	readAndSkipPast( "TBProphOrder", file );
 	for(i = 0; i < TB_NUM_PROPHS; i++)
-		fscanf( file, "%d", &(tbInputs.prophOrder[i]));
+		file->scan( "%d", &(tbInputs->prophOrder[i]));
 
 	readAndSkipPast( "TBProphDuration", file );
 	for(i = 0; i < TB_NUM_PROPHS; i++)
-		fscanf( file, "%d", &(tbInputs.prophDuration[i]));
+		file->scan( "%d", &(tbInputs->prophDuration[i]));
 	readAndSkipPast( "TBProphMaxRestarts", file );
 	for(i = 0; i < TB_NUM_PROPHS; i++)
-		fscanf( file, "%d", &(tbInputs.maxRestarts[i]));
+		file->scan( "%d", &(tbInputs->maxRestarts[i]));
 
 	readAndSkipPast( "TBProphStartKnownPos", file );
-	fscanf( file, "%d", &tempBool);
-	tbInputs.startProphUseOrEvaluationKnownPos = (bool) tempBool;
-	fscanf( file, "%d", &tempBool);
-	tbInputs.startProphAllKnownPos = (bool) tempBool;
-	fscanf( file, "%lf %lf", &(tbInputs.startProphObservedCD4Bounds[UPPER_BOUND]),
-			&(tbInputs.startProphObservedCD4Bounds[LOWER_BOUND]));
-	fscanf( file, "%d", &(tbInputs.startProphARTStatusKnownPos));
-	fscanf( file, "%d", &(tbInputs.startProphHistTBDiagKnownPos));
-	fscanf( file, "%d", &(tbInputs.startProphHistTreatmentKnownPos));
-	fscanf( file, "%d", &(tbInputs.startProphImmuneReactiveKnownPos));
+	file->scan( "%d", &tempBool);
+	tbInputs->startProphUseOrEvaluationKnownPos = (bool) tempBool;
+	file->scan( "%d", &tempBool);
+	tbInputs->startProphAllKnownPos = (bool) tempBool;
+	file->scan( "%lf %lf", &(tbInputs->startProphObservedCD4Bounds[UPPER_BOUND]),
+			&(tbInputs->startProphObservedCD4Bounds[LOWER_BOUND]));
+	file->scan( "%d", &(tbInputs->startProphARTStatusKnownPos));
+	file->scan( "%d", &(tbInputs->startProphHistTBDiagKnownPos));
+	file->scan( "%d", &(tbInputs->startProphHistTreatmentKnownPos));
+	file->scan( "%d", &(tbInputs->startProphImmuneReactiveKnownPos));
 
 	readAndSkipPast( "TBProphStartNotKnownPos", file );
-	fscanf( file, "%d", &tempBool);
-	tbInputs.startProphUseOrEvaluationNotKnownPos = (bool) tempBool;
-	fscanf( file, "%d", &tempBool);
-	tbInputs.startProphAllNotKnownPos = (bool) tempBool;
-	fscanf( file, "%d", &(tbInputs.startProphHistTBDiagNotKnownPos));
-	fscanf( file, "%d", &(tbInputs.startProphHistTreatmentNotKnownPos));
-	fscanf( file, "%d", &(tbInputs.startProphImmuneReactiveNotKnownPos));
+	file->scan( "%d", &tempBool);
+	tbInputs->startProphUseOrEvaluationNotKnownPos = (bool) tempBool;
+	file->scan( "%d", &tempBool);
+	tbInputs->startProphAllNotKnownPos = (bool) tempBool;
+	file->scan( "%d", &(tbInputs->startProphHistTBDiagNotKnownPos));
+	file->scan( "%d", &(tbInputs->startProphHistTreatmentNotKnownPos));
+	file->scan( "%d", &(tbInputs->startProphImmuneReactiveNotKnownPos));
 
 	readAndSkipPast( "TBProphStartPropToReceiveUponQual", file);
-	fscanf(file, "%lf %lf %lf", &(tbInputs.probReceiveProphNotKnownPos), &(tbInputs.probReceiveProphKnownPosOffART),&(tbInputs.probReceiveProphOnART));
+	file->scan("%lf %lf %lf", &(tbInputs->probReceiveProphNotKnownPos), &(tbInputs->probReceiveProphKnownPosOffART),&(tbInputs->probReceiveProphOnART));
 	readAndSkipPast( "TBProphStartLagToStart", file);
-	fscanf(file, "%lf %lf", &(tbInputs.monthsLagToStartProphMean), &(tbInputs.monthsLagToStartProphStdDev));
+	file->scan("%lf %lf", &(tbInputs->monthsLagToStartProphMean), &(tbInputs->monthsLagToStartProphStdDev));
 	readAndSkipPast( "TBProphStopMthDropoutProb", file);
-	fscanf(file, "%lf", &(tbInputs.probDropoffProph));
+	file->scan("%lf", &(tbInputs->probDropoffProph));
 
 	readAndSkipPast( "TBProphStopKnownPos", file );
-	fscanf( file, "%d", &tempBool);
-	tbInputs.stopProphUseOrEvaluationKnownPos = (bool) tempBool;
-	fscanf( file, "%lf %lf", &(tbInputs.stopProphObservedCD4Bounds[UPPER_BOUND]),
-			&(tbInputs.stopProphObservedCD4Bounds[LOWER_BOUND]));
-	fscanf( file, "%d", &(tbInputs.stopProphNumMonthsKnownPos));
-	fscanf( file, "%d", &tempBool);
-	tbInputs.stopProphAfterTBDiagKnownPos = (bool) tempBool;
-	fscanf( file, "%d", &tempBool);
-	tbInputs.stopProphMajorToxKnownPos = (bool) tempBool;
+	file->scan( "%d", &tempBool);
+	tbInputs->stopProphUseOrEvaluationKnownPos = (bool) tempBool;
+	file->scan( "%lf %lf", &(tbInputs->stopProphObservedCD4Bounds[UPPER_BOUND]),
+			&(tbInputs->stopProphObservedCD4Bounds[LOWER_BOUND]));
+	file->scan( "%d", &(tbInputs->stopProphNumMonthsKnownPos));
+	file->scan( "%d", &tempBool);
+	tbInputs->stopProphAfterTBDiagKnownPos = (bool) tempBool;
+	file->scan( "%d", &tempBool);
+	tbInputs->stopProphMajorToxKnownPos = (bool) tempBool;
 
 	readAndSkipPast( "TBProphStopNotKnownPos", file );
-	fscanf( file, "%d", &tempBool);
-	tbInputs.stopProphUseOrEvaluationNotKnownPos = (bool) tempBool;
-	fscanf( file, "%d", &(tbInputs.stopProphNumMonthsNotKnownPos));
-	fscanf( file, "%d", &tempBool);
-	tbInputs.stopProphAfterTBDiagNotKnownPos = (bool) tempBool;
-	fscanf( file, "%d", &tempBool);
-	tbInputs.stopProphMajorToxNotKnownPos = (bool) tempBool;
+	file->scan( "%d", &tempBool);
+	tbInputs->stopProphUseOrEvaluationNotKnownPos = (bool) tempBool;
+	file->scan( "%d", &(tbInputs->stopProphNumMonthsNotKnownPos));
+	file->scan( "%d", &tempBool);
+	tbInputs->stopProphAfterTBDiagNotKnownPos = (bool) tempBool;
+	file->scan( "%d", &tempBool);
+	tbInputs->stopProphMajorToxNotKnownPos = (bool) tempBool;
 
 	readAndSkipPast( "TBProphMoveToNextAfterTox",file);
-	fscanf( file, "%d", &tempBool);
-	tbInputs.moveToNextProphAfterTox = (bool) tempBool;
+	file->scan( "%d", &tempBool);
+	tbInputs->moveToNextProphAfterTox = (bool) tempBool;
 
 	//prophylaxis efficacy and cost for TB
 	for (int prophNum = 0; prophNum < TB_NUM_PROPHS; ++prophNum) {
-		TBInputs::TBProph &tbProph = tbInputs.tbProphInputs[prophNum];
+		TBInputs::TBProph &tbProph = tbInputs->tbProphInputs[prophNum];
 
 		sprintf(tmpBuf, "OnTBProph%dEffInfect", prophNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbProph.efficacyInfectionHIVNeg[0]));
+		file->scan( "%lf", &(tbProph.efficacyInfectionHIVNeg[0]));
 
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j){
-			fscanf( file, "%lf", &(tbProph.efficacyInfectionHIVPos[j][0]));
+			file->scan( "%lf", &(tbProph.efficacyInfectionHIVPos[j][0]));
 		}
 		sprintf(tmpBuf, "PostTBProph%dEffInfect", prophNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbProph.efficacyInfectionHIVNeg[1]));
+		file->scan( "%lf", &(tbProph.efficacyInfectionHIVNeg[1]));
 
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j){
-			fscanf( file, "%lf", &(tbProph.efficacyInfectionHIVPos[j][1]));
+			file->scan( "%lf", &(tbProph.efficacyInfectionHIVPos[j][1]));
 		}
-		fscanf( file, "%d", &(tbProph.monthsOfEfficacyInfection));
-		fscanf( file, "%d", &(tbProph.decayPeriodInfection));
+		file->scan( "%d", &(tbProph.monthsOfEfficacyInfection));
+		file->scan( "%d", &(tbProph.decayPeriodInfection));
 
 		sprintf(tmpBuf, "OnTBProph%dEffActivate", prophNum);
 		readAndSkipPast2( tmpBuf,"DS", file );
-		fscanf( file, "%lf", &(tbProph.efficacyActivationHIVNeg[TB_STRAIN_DS][0]));
+		file->scan( "%lf", &(tbProph.efficacyActivationHIVNeg[TB_STRAIN_DS][0]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbProph.efficacyActivationHIVPos[TB_STRAIN_DS][j][0]));
+			file->scan( "%lf", &(tbProph.efficacyActivationHIVPos[TB_STRAIN_DS][j][0]));
 
 		sprintf(tmpBuf, "OnTBProph%dEffActivate", prophNum);
 		readAndSkipPast2( tmpBuf,"MDR", file );
-		fscanf( file, "%lf", &(tbProph.efficacyActivationHIVNeg[TB_STRAIN_MDR][0]));
+		file->scan( "%lf", &(tbProph.efficacyActivationHIVNeg[TB_STRAIN_MDR][0]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbProph.efficacyActivationHIVPos[TB_STRAIN_MDR][j][0]));
+			file->scan( "%lf", &(tbProph.efficacyActivationHIVPos[TB_STRAIN_MDR][j][0]));
 
 		sprintf(tmpBuf, "OnTBProph%dEffActivate", prophNum);
 		readAndSkipPast2( tmpBuf,"XDR", file );
-		fscanf( file, "%lf", &(tbProph.efficacyActivationHIVNeg[TB_STRAIN_XDR][0]));
+		file->scan( "%lf", &(tbProph.efficacyActivationHIVNeg[TB_STRAIN_XDR][0]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbProph.efficacyActivationHIVPos[TB_STRAIN_XDR][j][0]));
+			file->scan( "%lf", &(tbProph.efficacyActivationHIVPos[TB_STRAIN_XDR][j][0]));
 
 		sprintf(tmpBuf, "PostTBProph%dEffActivate", prophNum);
 		readAndSkipPast2( tmpBuf,"DS", file );
-		fscanf( file, "%lf", &(tbProph.efficacyActivationHIVNeg[TB_STRAIN_DS][1]));
+		file->scan( "%lf", &(tbProph.efficacyActivationHIVNeg[TB_STRAIN_DS][1]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbProph.efficacyActivationHIVPos[TB_STRAIN_DS][j][1]));
-		fscanf( file, "%d", &(tbProph.monthsOfEfficacyActivation[TB_STRAIN_DS]));
-		fscanf( file, "%d", &(tbProph.decayPeriodActivation[TB_STRAIN_DS]));
+			file->scan( "%lf", &(tbProph.efficacyActivationHIVPos[TB_STRAIN_DS][j][1]));
+		file->scan( "%d", &(tbProph.monthsOfEfficacyActivation[TB_STRAIN_DS]));
+		file->scan( "%d", &(tbProph.decayPeriodActivation[TB_STRAIN_DS]));
 
 		sprintf(tmpBuf, "PostTBProph%dEffActivate", prophNum);
 		readAndSkipPast2( tmpBuf,"MDR", file );
-		fscanf( file, "%lf", &(tbProph.efficacyActivationHIVNeg[TB_STRAIN_MDR][1]));
+		file->scan( "%lf", &(tbProph.efficacyActivationHIVNeg[TB_STRAIN_MDR][1]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbProph.efficacyActivationHIVPos[TB_STRAIN_MDR][j][1]));
-		fscanf( file, "%d", &(tbProph.monthsOfEfficacyActivation[TB_STRAIN_MDR]));
-		fscanf( file, "%d", &(tbProph.decayPeriodActivation[TB_STRAIN_MDR]));
+			file->scan( "%lf", &(tbProph.efficacyActivationHIVPos[TB_STRAIN_MDR][j][1]));
+		file->scan( "%d", &(tbProph.monthsOfEfficacyActivation[TB_STRAIN_MDR]));
+		file->scan( "%d", &(tbProph.decayPeriodActivation[TB_STRAIN_MDR]));
 
 		sprintf(tmpBuf, "PostTBProph%dEffActivate", prophNum);
 		readAndSkipPast2( tmpBuf,"XDR", file );
-		fscanf( file, "%lf", &(tbProph.efficacyActivationHIVNeg[TB_STRAIN_XDR][1]));
+		file->scan( "%lf", &(tbProph.efficacyActivationHIVNeg[TB_STRAIN_XDR][1]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbProph.efficacyActivationHIVPos[TB_STRAIN_XDR][j][1]));
-		fscanf( file, "%d", &(tbProph.monthsOfEfficacyActivation[TB_STRAIN_XDR]));
-		fscanf( file, "%d", &(tbProph.decayPeriodActivation[TB_STRAIN_XDR]));
+			file->scan( "%lf", &(tbProph.efficacyActivationHIVPos[TB_STRAIN_XDR][j][1]));
+		file->scan( "%d", &(tbProph.monthsOfEfficacyActivation[TB_STRAIN_XDR]));
+		file->scan( "%d", &(tbProph.decayPeriodActivation[TB_STRAIN_XDR]));
 		
 		sprintf(tmpBuf, "OnTBProph%dEffReinfect", prophNum);
 		readAndSkipPast2( tmpBuf,"DS", file );
-		fscanf( file, "%lf", &(tbProph.efficacyReinfectionHIVNeg[TB_STRAIN_DS][0]));
+		file->scan( "%lf", &(tbProph.efficacyReinfectionHIVNeg[TB_STRAIN_DS][0]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbProph.efficacyReinfectionHIVPos[TB_STRAIN_DS][j][0]));
+			file->scan( "%lf", &(tbProph.efficacyReinfectionHIVPos[TB_STRAIN_DS][j][0]));
 		
 		sprintf(tmpBuf, "OnTBProph%dEffReinfect", prophNum);
 		readAndSkipPast2( tmpBuf,"MDR", file );
-		fscanf( file, "%lf", &(tbProph.efficacyReinfectionHIVNeg[TB_STRAIN_MDR][0]));
+		file->scan( "%lf", &(tbProph.efficacyReinfectionHIVNeg[TB_STRAIN_MDR][0]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbProph.efficacyReinfectionHIVPos[TB_STRAIN_MDR][j][0]));
+			file->scan( "%lf", &(tbProph.efficacyReinfectionHIVPos[TB_STRAIN_MDR][j][0]));
 		
 		sprintf(tmpBuf, "OnTBProph%dEffReinfect", prophNum);
 		readAndSkipPast2( tmpBuf,"XDR", file );
-		fscanf( file, "%lf", &(tbProph.efficacyReinfectionHIVNeg[TB_STRAIN_XDR][0]));
+		file->scan( "%lf", &(tbProph.efficacyReinfectionHIVNeg[TB_STRAIN_XDR][0]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbProph.efficacyReinfectionHIVPos[TB_STRAIN_XDR][j][0]));
+			file->scan( "%lf", &(tbProph.efficacyReinfectionHIVPos[TB_STRAIN_XDR][j][0]));
 
 		sprintf(tmpBuf, "PostTBProph%dEffReinfect", prophNum);
 		readAndSkipPast2( tmpBuf,"DS", file );
-		fscanf( file, "%lf", &(tbProph.efficacyReinfectionHIVNeg[TB_STRAIN_DS][1]));
+		file->scan( "%lf", &(tbProph.efficacyReinfectionHIVNeg[TB_STRAIN_DS][1]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbProph.efficacyReinfectionHIVPos[TB_STRAIN_DS][j][1]));
-		fscanf( file, "%d", &(tbProph.monthsOfEfficacyReinfection[TB_STRAIN_DS]));
-		fscanf( file, "%d", &(tbProph.decayPeriodReinfection[TB_STRAIN_DS]));
+			file->scan( "%lf", &(tbProph.efficacyReinfectionHIVPos[TB_STRAIN_DS][j][1]));
+		file->scan( "%d", &(tbProph.monthsOfEfficacyReinfection[TB_STRAIN_DS]));
+		file->scan( "%d", &(tbProph.decayPeriodReinfection[TB_STRAIN_DS]));
 
 		sprintf(tmpBuf, "PostTBProph%dEffReinfect", prophNum);
 		readAndSkipPast2( tmpBuf,"MDR", file );
-		fscanf( file, "%lf", &(tbProph.efficacyReinfectionHIVNeg[TB_STRAIN_MDR][1]));
+		file->scan( "%lf", &(tbProph.efficacyReinfectionHIVNeg[TB_STRAIN_MDR][1]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbProph.efficacyReinfectionHIVPos[TB_STRAIN_MDR][j][1]));
-		fscanf( file, "%d", &(tbProph.monthsOfEfficacyReinfection[TB_STRAIN_MDR]));
-		fscanf( file, "%d", &(tbProph.decayPeriodReinfection[TB_STRAIN_MDR]));
+			file->scan( "%lf", &(tbProph.efficacyReinfectionHIVPos[TB_STRAIN_MDR][j][1]));
+		file->scan( "%d", &(tbProph.monthsOfEfficacyReinfection[TB_STRAIN_MDR]));
+		file->scan( "%d", &(tbProph.decayPeriodReinfection[TB_STRAIN_MDR]));
 
 		sprintf(tmpBuf, "PostTBProph%dEffReinfect", prophNum);
 		readAndSkipPast2( tmpBuf,"XDR", file );
-		fscanf( file, "%lf", &(tbProph.efficacyReinfectionHIVNeg[TB_STRAIN_XDR][1]));
+		file->scan( "%lf", &(tbProph.efficacyReinfectionHIVNeg[TB_STRAIN_XDR][1]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbProph.efficacyReinfectionHIVPos[TB_STRAIN_XDR][j][1]));
-		fscanf( file, "%d", &(tbProph.monthsOfEfficacyReinfection[TB_STRAIN_XDR]));
-		fscanf( file, "%d", &(tbProph.decayPeriodReinfection[TB_STRAIN_XDR]));
+			file->scan( "%lf", &(tbProph.efficacyReinfectionHIVPos[TB_STRAIN_XDR][j][1]));
+		file->scan( "%d", &(tbProph.monthsOfEfficacyReinfection[TB_STRAIN_XDR]));
+		file->scan( "%d", &(tbProph.decayPeriodReinfection[TB_STRAIN_XDR]));
 
 		sprintf(tmpBuf, "TBProph%dCostQOL", prophNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf %lf %lf %lf %lf", &(tbProph.costMonthly),
+		file->scan( "%lf %lf %lf %lf %lf", &(tbProph.costMonthly),
 			&(tbProph.costMinorToxicity),
 			&(tbProph.QOLModifierMinorToxicity),
 			&(tbProph.costMajorToxicity),
@@ -2593,1323 +3520,1326 @@ void SimContext::readTBInputs() {
 
 		sprintf(tmpBuf, "TBProph%dToxicity", prophNum);
 		readAndSkipPast2( tmpBuf, "Minor", file );
-		fscanf( file, "%lf %lf %lf ", &(tbProph.probMinorToxicityHIVNeg), &(tbProph.probMinorToxicityOffART), &(tbProph.probMinorToxicityOnART));
+		file->scan( "%lf %lf %lf ", &(tbProph.probMinorToxicityHIVNeg), &(tbProph.probMinorToxicityOffART), &(tbProph.probMinorToxicityOnART));
 		
 		sprintf(tmpBuf, "TBProph%dToxicity", prophNum);
 		readAndSkipPast2( tmpBuf, "Major", file );
-		fscanf( file, "%lf %lf %lf %lf", &(tbProph.probMajorToxicityHIVNeg), &(tbProph.probMajorToxicityOffART), &(tbProph.probMajorToxicityOnART),
+		file->scan( "%lf %lf %lf %lf", &(tbProph.probMajorToxicityHIVNeg), &(tbProph.probMajorToxicityOffART), &(tbProph.probMajorToxicityOnART),
 			&(tbProph.deathRateRatioMajorToxicity));
 
 		sprintf(tmpBuf, "TBProph%dProbResist", prophNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbProph.probResistanceInActiveStates) );
+		file->scan( "%lf", &(tbProph.probResistanceInActiveStates) );
 	}
 
 	//TB LTFU
 	readAndSkipPast("UseTBLTFU", inputFile);
-	fscanf( file, "%d", &tempBool);
-	tbInputs.useTBLTFU = (bool) tempBool;
+	file->scan( "%d", &tempBool);
+	tbInputs->useTBLTFU = (bool) tempBool;
 
 	readAndSkipPast( "MthsToLongTermEffects", file );
-	fscanf( file, "%d", &(tbInputs.monthsToLongTermEffectsLTFU));
+	file->scan( "%d", &(tbInputs->monthsToLongTermEffectsLTFU));
 
 	readAndSkipPast( "TBMaxMthsLTFU", file );
-	fscanf( file, "%d", &(tbInputs.maxMonthsLTFU));
+	file->scan( "%d", &(tbInputs->maxMonthsLTFU));
 
 	readAndSkipPast( "TBProbLTFU_Stage1", file );
 	for (j = 0; j < TB_NUM_STATES; j++)
-		fscanf( file, "%lf", &(tbInputs.probLTFU[0][j]));
+		file->scan( "%lf", &(tbInputs->probLTFU[0][j]));
 	readAndSkipPast( "TBProbLTFU_Stage2", file );
 	for (j = 0; j < TB_NUM_STATES; j++)
-		fscanf( file, "%lf", &(tbInputs.probLTFU[1][j]));
+		file->scan( "%lf", &(tbInputs->probLTFU[1][j]));
 
 	readAndSkipPast( "TBProbRTCHIVNeg", file );
 	for (j = 0; j < TB_NUM_STATES; j++)
-		fscanf( file, "%lf", &(tbInputs.probRTCHIVNeg[j]));
+		file->scan( "%lf", &(tbInputs->probRTCHIVNeg[j]));
 
 	readAndSkipPast( "TBProbRTCHIVPos", file );
 	for (j = 0; j < TB_NUM_STATES; j++)
-		fscanf( file, "%lf", &(tbInputs.probRTCHIVPos[j]));
+		file->scan( "%lf", &(tbInputs->probRTCHIVPos[j]));
 
 	readAndSkipPast( "TBProphStartWhileHIVLTFU", file );
-	fscanf( file, "%d", &tempBool);
-	tbInputs.allowTBProphStartWhileHIVLTFU = (bool) tempBool;
+	file->scan( "%d", &tempBool);
+	tbInputs->allowTBProphStartWhileHIVLTFU = (bool) tempBool;
 
 	readAndSkipPast( "TBProphStopWhileHIVLTFUProb", file );
-	fscanf( file, "%lf", &(tbInputs.probStopTBProphAtHIVLTFU));
+	file->scan( "%lf", &(tbInputs->probStopTBProphAtHIVLTFU));
 	
 	readAndSkipPast( "TBRTCRestartReg", file );
 	for (j = 0; j < TB_RTC_TIME_CAT_NUM; j++)
-		fscanf( file, "%lf", &(tbInputs.rtcProbRestart[j]));
+		file->scan( "%lf", &(tbInputs->rtcProbRestart[j]));
 
 	readAndSkipPast( "TBRTCResumeReg", file );
 	for (j = 0; j < TB_RTC_TIME_CAT_NUM; j++)
-		fscanf( file, "%lf", &(tbInputs.rtcProbResume[j]));
+		file->scan( "%lf", &(tbInputs->rtcProbResume[j]));
 
 	readAndSkipPast( "TBRTCRetest", file );
 	for (j = 0; j < TB_RTC_TIME_CAT_NUM; j++)
-		fscanf( file, "%lf", &(tbInputs.rtcProbRetest[j]));
+		file->scan( "%lf", &(tbInputs->rtcProbRetest[j]));
 
 	readAndSkipPast( "TBRTCNextReg", file );
 	for (j = 0; j < TB_RTC_TIME_CAT_NUM; j++)
-		fscanf( file, "%lf", &(tbInputs.rtcProbNext[j]));
+		file->scan( "%lf", &(tbInputs->rtcProbNext[j]));
 
 	//TB Costs
 	readAndSkipPast( "CostsTBUntreated", file );
 	for (i = 0; i < COST_NUM_TYPES; i++) {
-		fscanf( file, "%lf", &(tbInputs.untreatedCosts[i]));
+		file->scan( "%lf", &(tbInputs->untreatedCosts[i]));
 	}
 
 	readAndSkipPast2( "CostsTBTreated", "Visit", file );
 	for (i = 0; i < COST_NUM_TYPES; i++) {
-		fscanf( file, "%lf", &(tbInputs.treatedCostsVisit[i]));
+		file->scan( "%lf", &(tbInputs->treatedCostsVisit[i]));
 	}
-	fscanf( file, "%d", &(tbInputs.frequencyVisitCosts));
+	file->scan( "%d", &(tbInputs->frequencyVisitCosts));
 
 	readAndSkipPast2( "CostsTBTreated", "Medication", file );
 	for (i = 0; i < COST_NUM_TYPES; i++) {
-		fscanf( file, "%lf", &(tbInputs.treatedCostsMed[i]));
+		file->scan( "%lf", &(tbInputs->treatedCostsMed[i]));
 	}
-	fscanf( file, "%d", &(tbInputs.frequencyMedCosts));
+	file->scan( "%d", &(tbInputs->frequencyMedCosts));
 
 	readAndSkipPast2( "CostsTBDeath", "Adult", file );
 	for (i = 0; i < COST_NUM_TYPES; i++) {
-		fscanf( file, "%lf", &(tbInputs.costTBDeath[i]));
+		file->scan( "%lf", &(tbInputs->costTBDeath[i]));
 	}
 	for (i = 1; i <=PEDS_COST_AGE_CAT_NUM; i++){
 		// read in acute OI costs
 		sprintf(tmpBuf, "Peds%dCostsTBDeath", i);
 		readAndSkipPast( tmpBuf, inputFile );
 		for (j = 0; j < COST_NUM_TYPES; j++) {
-			fscanf(inputFile, "%lf", &(tbInputs.costTBDeathPeds[i-1][j]) );
+			inputFile->scan("%lf", &(tbInputs->costTBDeathPeds[i-1][j]) );
 		}
 	}
 	readAndSkipPast("QOLActiveTB", file);
-	fscanf(file, "%lf", &(tbInputs.QOLModActiveTB));
+	file->scan("%lf", &(tbInputs->QOLModActiveTB));
 	readAndSkipPast("QOLDeathActiveTB", file);
-	fscanf(file, "%lf", &(tbInputs.QOLModDeathActiveTB));
+	file->scan("%lf", &(tbInputs->QOLModDeathActiveTB));
 	
 	//TB Diagnostics
 	readAndSkipPast("EnableTBDiagnostics", inputFile);
-	fscanf( file, "%d", &tempBool );
-	tbInputs.enableTBDiagnostics = (bool) tempBool;
+	file->scan( "%d", &tempBool );
+	tbInputs->enableTBDiagnostics = (bool) tempBool;
 
 	readAndSkipPast("AllowMultipleTestsSameMonth", inputFile);
-	fscanf( file, "%d", &tempBool );
-	tbInputs.allowMultipleTests = (bool) tempBool;
+	file->scan( "%d", &tempBool );
+	tbInputs->allowMultipleTests = (bool) tempBool;
 
 	//Init Policy
 	readAndSkipPast( "TBDiagInitPolicyAndOr", file );
-	fscanf( file, "%d", &tempBool );
-	tbInputs.TBDiagnosticsInitPoliciesUseOrEvaluation = (bool) tempBool;
+	file->scan( "%d", &tempBool );
+	tbInputs->TBDiagnosticsInitPoliciesUseOrEvaluation = (bool) tempBool;
 
 	readAndSkipPast( "TBDiagInitPolicy", file );
 	for (i = 0; i < TB_DIAG_INIT_POLICY_NUM; i++){
-		fscanf( file, "%d", &tempBool );
-		tbInputs.TBDiagnosticsInitPolicies[i] = (bool) tempBool;
+		file->scan( "%d", &tempBool );
+		tbInputs->TBDiagnosticsInitPolicies[i] = (bool) tempBool;
 	}
 
 	readAndSkipPast( "TBDiagInitPolicySymptomsProb", file );
-	fscanf( file, "%lf", &(tbInputs.TBDiagnosticsInitSymptomsProb) );
+	file->scan( "%lf", &(tbInputs->TBDiagnosticsInitSymptomsProb) );
 
 	readAndSkipPast( "TBDiagInitPolicyCD4Bounds", file );
-	fscanf( file, "%lf %lf", &(tbInputs.TBDiagnosticsInitCD4Bounds[0]),&(tbInputs.TBDiagnosticsInitCD4Bounds[1]) );
+	file->scan( "%lf %lf", &(tbInputs->TBDiagnosticsInitCD4Bounds[0]),&(tbInputs->TBDiagnosticsInitCD4Bounds[1]) );
 	readAndSkipPast( "TBDiagInitPolicyCalendarMth", file );
-	fscanf( file, "%d", &(tbInputs.TBDiagnosticsInitMonth) );
+	file->scan( "%d", &(tbInputs->TBDiagnosticsInitMonth) );
 
 
 	readAndSkipPast( "TBDiagInitPolicyMthIntvlProb", file );
-	fscanf( file, "%lf", &(tbInputs.TBDiagnosticsInitIntervalProb) );
+	file->scan( "%lf", &(tbInputs->TBDiagnosticsInitIntervalProb) );
 	readAndSkipPast( "TBDiagInitPolicyMthIntvlBounds", file );
 	for (i = 0; i < TB_DIAG_INIT_POLICY_INTV_NUM-1; i++)
-		fscanf( file, "%d", &(tbInputs.TBDiagnosticsInitIntervalBounds[i]) );
+		file->scan( "%d", &(tbInputs->TBDiagnosticsInitIntervalBounds[i]) );
 
 	readAndSkipPast( "TBDiagInitPolicyMthIntvl", file );
 	for (i = 0; i < TB_DIAG_INIT_POLICY_INTV_NUM; i++)
-		fscanf( file, "%d", &(tbInputs.TBDiagnosticsInitInterval[i]) );
+		file->scan( "%d", &(tbInputs->TBDiagnosticsInitInterval[i]) );
 	readAndSkipPast( "TBDiagInitMinMthsPostTreatment", file );
-	fscanf( file, "%d", &(tbInputs.TBDiagnosticsInitMinMthsPostTreat) );
+	file->scan( "%d", &(tbInputs->TBDiagnosticsInitMinMthsPostTreat) );
 
 	//Diagnostics Test order
 	readAndSkipPast( "TBDiagTestOrderNeverTreat", file );
 	for (i = 0; i < TB_DIAG_TEST_ORDER_NUM; i++)
-		fscanf( file, "%d", &(tbInputs.TBDiagnosticsTestOrder[0][i]));
+		file->scan( "%d", &(tbInputs->TBDiagnosticsTestOrder[0][i]));
 	readAndSkipPast( "TBDiagTestOrderNeverTreatDST", file );
 	for (i = 0; i < TB_DIAG_TEST_ORDER_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticsTestOrderDST[0][i] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticsTestOrderDST[0][i] = (bool) tempBool;
 	}
 
 	readAndSkipPast( "TBDiagTestOrderEverTreat", file );
 	for (i = 0; i < TB_DIAG_TEST_ORDER_NUM; i++)
-		fscanf( file, "%d", &(tbInputs.TBDiagnosticsTestOrder[1][i]));
+		file->scan( "%d", &(tbInputs->TBDiagnosticsTestOrder[1][i]));
 	readAndSkipPast( "TBDiagTestOrderEverTreatDST", file );
 	for (i = 0; i < TB_DIAG_TEST_ORDER_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticsTestOrderDST[1][i] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticsTestOrderDST[1][i] = (bool) tempBool;
 	}
 
 	readAndSkipPast2( "TBDiagStartInTreat", "HIVNeg", file );
 	for (i = 0; i < TB_NUM_STATES; i++)
-		fscanf( file, "%lf", &(tbInputs.TBDiagnosticsInitInTreatmentHIVNeg[i]));
+		file->scan( "%lf", &(tbInputs->TBDiagnosticsInitInTreatmentHIVNeg[i]));
 
 	readAndSkipPast2( "TBDiagStartInTreat", "HIVPos", file );
 	for (i = 0; i < TB_NUM_STATES; i++)
-		fscanf( file, "%lf", &(tbInputs.TBDiagnosticsInitInTreatmentHIVPos[i]));	
+		file->scan( "%lf", &(tbInputs->TBDiagnosticsInitInTreatmentHIVPos[i]));	
 
 	//Test Sequence Matrix
 	readAndSkipPast2( "TBDiagSeq", "2Tests", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticSequenceMatrix2Tests[i] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticSequenceMatrix2Tests[i] = (bool) tempBool;
 	}
 
 	readAndSkipPast2( "TBDiagSeq", "3Tests1Pos", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticSequenceMatrix3Tests[i][TB_DIAG_STATUS_POS] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticSequenceMatrix3Tests[i][TB_DIAG_STATUS_POS] = (bool) tempBool;
 	}
 	readAndSkipPast2( "TBDiagSeq", "3Tests1Neg", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticSequenceMatrix3Tests[i][TB_DIAG_STATUS_NEG] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticSequenceMatrix3Tests[i][TB_DIAG_STATUS_NEG] = (bool) tempBool;
 	}
 
 	readAndSkipPast2( "TBDiagSeq", "4Tests2Pos1Pos", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticSequenceMatrix4Tests[i][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_POS] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticSequenceMatrix4Tests[i][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_POS] = (bool) tempBool;
 	}
 	readAndSkipPast2( "TBDiagSeq", "4Tests2Pos1Neg", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticSequenceMatrix4Tests[i][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_POS] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticSequenceMatrix4Tests[i][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_POS] = (bool) tempBool;
 	}
 	readAndSkipPast2( "TBDiagSeq", "4Tests2Neg1Pos", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticSequenceMatrix4Tests[i][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_NEG] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticSequenceMatrix4Tests[i][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_NEG] = (bool) tempBool;
 	}
 	readAndSkipPast2( "TBDiagSeq", "4Tests2Neg1Neg", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticSequenceMatrix4Tests[i][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_NEG] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticSequenceMatrix4Tests[i][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_NEG] = (bool) tempBool;
 	}
 
 	//Result Interpretation matrix
 	readAndSkipPast( "TBDiagAllowIncomplete", file );
-	fscanf( file, "%d", &tempBool);
-	tbInputs.TBDiagnosticAllowIncomplete = (bool) tempBool;
+	file->scan( "%d", &tempBool);
+	tbInputs->TBDiagnosticAllowIncomplete = (bool) tempBool;
 
 	readAndSkipPast( "TBDiagAllowNoDiagnosis", file );
-	fscanf( file, "%d", &tempBool);
-	tbInputs.TBDiagnosticAllowNoDiagnosis = (bool) tempBool;
+	file->scan( "%d", &tempBool);
+	tbInputs->TBDiagnosticAllowNoDiagnosis = (bool) tempBool;
 
 	readAndSkipPast2( "TBDiagResultMatrix", "1Test", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticResultMatrix1Test[i] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticResultMatrix1Test[i] = (bool) tempBool;
 	}
 
 	readAndSkipPast2( "TBDiagResultMatrix", "2Tests1Pos", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticResultMatrix2Tests[i][TB_DIAG_STATUS_POS] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticResultMatrix2Tests[i][TB_DIAG_STATUS_POS] = (bool) tempBool;
 	}
 	readAndSkipPast2( "TBDiagResultMatrix", "2Tests1Neg", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticResultMatrix2Tests[i][TB_DIAG_STATUS_NEG] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticResultMatrix2Tests[i][TB_DIAG_STATUS_NEG] = (bool) tempBool;
 	}
 
 	readAndSkipPast2( "TBDiagResultMatrix", "3Tests2Pos1Pos", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticResultMatrix3Tests[i][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_POS] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticResultMatrix3Tests[i][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_POS] = (bool) tempBool;
 	}
 	readAndSkipPast2( "TBDiagResultMatrix", "3Tests2Pos1Neg", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticResultMatrix3Tests[i][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_POS] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticResultMatrix3Tests[i][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_POS] = (bool) tempBool;
 	}
 	readAndSkipPast2( "TBDiagResultMatrix", "3Tests2Neg1Pos", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticResultMatrix3Tests[i][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_NEG] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticResultMatrix3Tests[i][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_NEG] = (bool) tempBool;
 	}
 	readAndSkipPast2( "TBDiagResultMatrix", "3Tests2Neg1Neg", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticResultMatrix3Tests[i][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_NEG] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticResultMatrix3Tests[i][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_NEG] = (bool) tempBool;
 	}
 
 	readAndSkipPast2( "TBDiagResultMatrix", "4Tests3Pos2Pos1Pos", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticResultMatrix4Tests[i][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_POS] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticResultMatrix4Tests[i][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_POS] = (bool) tempBool;
 	}
 	readAndSkipPast2( "TBDiagResultMatrix", "4Tests3Pos2Pos1Neg", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticResultMatrix4Tests[i][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_POS] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticResultMatrix4Tests[i][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_POS] = (bool) tempBool;
 	}
 	readAndSkipPast2( "TBDiagResultMatrix", "4Tests3Pos2Neg1Pos", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticResultMatrix4Tests[i][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_POS] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticResultMatrix4Tests[i][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_POS] = (bool) tempBool;
 	}
 	readAndSkipPast2( "TBDiagResultMatrix", "4Tests3Pos2Neg1Neg", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticResultMatrix4Tests[i][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_POS] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticResultMatrix4Tests[i][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_POS] = (bool) tempBool;
 	}
 	readAndSkipPast2( "TBDiagResultMatrix", "4Tests3Neg2Pos1Pos", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticResultMatrix4Tests[i][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_NEG] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticResultMatrix4Tests[i][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_NEG] = (bool) tempBool;
 	}
 	readAndSkipPast2( "TBDiagResultMatrix", "4Tests3Neg2Pos1Neg", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticResultMatrix4Tests[i][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_NEG] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticResultMatrix4Tests[i][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_NEG] = (bool) tempBool;
 	}
 	readAndSkipPast2( "TBDiagResultMatrix", "4Tests3Neg2Neg1Pos", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticResultMatrix4Tests[i][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_NEG] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticResultMatrix4Tests[i][TB_DIAG_STATUS_POS][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_NEG] = (bool) tempBool;
 	}
 	readAndSkipPast2( "TBDiagResultMatrix", "4Tests3Neg2Neg1Neg", file );
 	for ( i = 0; i < TB_DIAG_STATUS_NUM; i++){
-		fscanf( file, "%d", &tempBool);
-		tbInputs.TBDiagnosticResultMatrix4Tests[i][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_NEG] = (bool) tempBool;
+		file->scan( "%d", &tempBool);
+		tbInputs->TBDiagnosticResultMatrix4Tests[i][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_NEG][TB_DIAG_STATUS_NEG] = (bool) tempBool;
 	}
 
 	//prob of linkage
 	readAndSkipPast( "TBDiagProbLinkTBTreatmentIntegrated", file );
-	fscanf( file, "%lf", &(tbInputs.probLinkTBTreatmentIntegrated));
+	file->scan( "%lf", &(tbInputs->probLinkTBTreatmentIntegrated));
 	readAndSkipPast( "TBDiagProbLinkTBTreatmentUnintegrated", file );
-	fscanf( file, "%lf", &(tbInputs.probLinkTBTreatmentNonIntegrated));
+	file->scan( "%lf", &(tbInputs->probLinkTBTreatmentNonIntegrated));
 	readAndSkipPast( "TBDiagRTCForHIVUponLinkageIntegrated", file);
-	fscanf( file, "%d", &tempBool );
-	tbInputs.RTCForHIVUponLinkageIntegrated = (bool) tempBool;
+	file->scan( "%d", &tempBool );
+	tbInputs->RTCForHIVUponLinkageIntegrated = (bool) tempBool;
 
 	//read prob of hiv det upon tb linkage
 	readAndSkipPast( "TBDiagProbHIVDetUponTBLinkageIntegrated", file );
-	fscanf( file, "%lf", &(tbInputs.probHIVDetUponLinkageIntegrated));
+	file->scan( "%lf", &(tbInputs->probHIVDetUponLinkageIntegrated));
 	readAndSkipPast( "TBDiagProbHIVDetUponTBLinkageUnintegrated", file );
-	fscanf( file, "%lf", &(tbInputs.probHIVDetUponLinkageNonIntegrated));
+	file->scan( "%lf", &(tbInputs->probHIVDetUponLinkageNonIntegrated));
 
 	for (int testNum = 0; testNum < TB_NUM_TESTS; testNum++) {
-		TBInputs::TBTest &tbTest = tbInputs.TBTests[testNum];
+		TBInputs::TBTest &tbTest = tbInputs->TBTests[testNum];
 
 		//read in test accuracy
 		sprintf(tmpBuf, "TBTest%dPosProb", testNum);
 		readAndSkipPast2( tmpBuf, "HIV_Neg", file );
 		for (i = 0; i < TB_NUM_STATES; i++)
-			fscanf( file, "%lf", &(tbTest.probPositiveHIVNeg[i]));
+			file->scan( "%lf", &(tbTest.probPositiveHIVNeg[i]));
 
 		sprintf(tmpBuf, "TBTest%dPosProb", testNum);
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j) {
 			readAndSkipPast2( tmpBuf, CD4_STRATA_STRS[j], file );
 			for (i = 0; i < TB_NUM_STATES; i++)
-				fscanf( file, "%lf", &(tbTest.probPositiveHIVPos[i][j]));
+				file->scan( "%lf", &(tbTest.probPositiveHIVPos[i][j]));
 		}
 
 		//Prob accept and return
 		sprintf(tmpBuf, "TBTest%dProbAccept", testNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf(file, "%lf", &(tbTest.probAccept));
+		file->scan("%lf", &(tbTest.probAccept));
 
 		sprintf(tmpBuf, "TBTest%dProbPickup", testNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf(file, "%lf", &(tbTest.probPickup));
+		file->scan("%lf", &(tbTest.probPickup));
 
 		sprintf(tmpBuf, "TBTest%dLagToReset", testNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf(file, "%d", &(tbTest.monthsToReset));
+		file->scan("%d", &(tbTest.monthsToReset));
 
 		sprintf(tmpBuf, "TBTest%dMonthsToPickup", testNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf(file, "%lf %lf", &(tbTest.timeToPickupMean), &(tbTest.timeToPickupStdDev));
+		file->scan("%lf %lf", &(tbTest.timeToPickupMean), &(tbTest.timeToPickupStdDev));
 
 		//DST
 		sprintf(tmpBuf, "TBTest%dDSTPosProb", testNum);
 		readAndSkipPast2( tmpBuf, "DS", file );
 		for(i = 0; i < TB_NUM_STRAINS; i++)
-			fscanf(file, "%lf", &(tbTest.DSTMatrixObsvTrue[TB_STRAIN_DS][i]));
-		fscanf(file, "%d", &(tbTest.DSTMonthsToResult[TB_STRAIN_DS]));
+			file->scan("%lf", &(tbTest.DSTMatrixObsvTrue[TB_STRAIN_DS][i]));
+		file->scan("%d", &(tbTest.DSTMonthsToResult[TB_STRAIN_DS]));
 
 
 		sprintf(tmpBuf, "TBTest%dDSTPosProb", testNum);
 		readAndSkipPast2( tmpBuf, "MDR", file );
 		for(i = 0; i < TB_NUM_STRAINS; i++)
-			fscanf(file, "%lf", &(tbTest.DSTMatrixObsvTrue[TB_STRAIN_MDR][i]));
-		fscanf(file, "%d", &(tbTest.DSTMonthsToResult[TB_STRAIN_MDR]));
+			file->scan("%lf", &(tbTest.DSTMatrixObsvTrue[TB_STRAIN_MDR][i]));
+		file->scan("%d", &(tbTest.DSTMonthsToResult[TB_STRAIN_MDR]));
 
 
 		sprintf(tmpBuf, "TBTest%dDSTPosProb", testNum);
 		readAndSkipPast2( tmpBuf, "XDR", file );
 		for(i = 0; i < TB_NUM_STRAINS; i++)
-			fscanf(file, "%lf", &(tbTest.DSTMatrixObsvTrue[TB_STRAIN_XDR][i]));
-		fscanf(file, "%d", &(tbTest.DSTMonthsToResult[TB_STRAIN_XDR]));
+			file->scan("%lf", &(tbTest.DSTMatrixObsvTrue[TB_STRAIN_XDR][i]));
+		file->scan("%d", &(tbTest.DSTMonthsToResult[TB_STRAIN_XDR]));
 
 
 		sprintf(tmpBuf, "TBTest%dDSTLinked", testNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d", &tempBool);
+		file->scan( "%d", &tempBool);
 		tbTest.DSTLinked = (bool) tempBool;
 
 		sprintf(tmpBuf, "TBTest%dDSTProbPickup", testNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbTest.DSTProbPickup));
+		file->scan( "%lf", &(tbTest.DSTProbPickup));
 
 		//Prob Empiric
 		sprintf(tmpBuf, "TBTest%dProbEmpiricWaitingResultsHIVNegSymptomatic", testNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbTest.probEmpiricAwaitingResultsSymptomaticHIVNeg));
+		file->scan( "%lf", &(tbTest.probEmpiricAwaitingResultsSymptomaticHIVNeg));
 
 		sprintf(tmpBuf, "TBTest%dProbEmpiricWaitingResultsHIVPosSymptomatic", testNum);
 		readAndSkipPast( tmpBuf, file );
 		for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
-			fscanf( file, "%lf", &(tbTest.probEmpiricAwaitingResultsSymptomaticHIVPos[i]));
+			file->scan( "%lf", &(tbTest.probEmpiricAwaitingResultsSymptomaticHIVPos[i]));
 		}
 
 		sprintf(tmpBuf, "TBTest%dProbEmpiricWaitingResultsHIVNegAsymptomatic", testNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbTest.probEmpiricAwaitingResultsAsymptomaticHIVNeg));
+		file->scan( "%lf", &(tbTest.probEmpiricAwaitingResultsAsymptomaticHIVNeg));
 
 		sprintf(tmpBuf, "TBTest%dProbEmpiricWaitingResultsHIVPosAsymptomatic", testNum);
 		readAndSkipPast( tmpBuf, file );
 		for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
-			fscanf( file, "%lf", &(tbTest.probEmpiricAwaitingResultsAsymptomaticHIVPos[i]));
+			file->scan( "%lf", &(tbTest.probEmpiricAwaitingResultsAsymptomaticHIVPos[i]));
 		}
 
 		sprintf(tmpBuf, "TBTest%dProbEmpiricPositiveResultHIVNegSymptomatic", testNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbTest.probEmpiricPositiveResultSymptomaticHIVNeg));
+		file->scan( "%lf", &(tbTest.probEmpiricPositiveResultSymptomaticHIVNeg));
 
 		sprintf(tmpBuf, "TBTest%dProbEmpiricPositiveResultHIVPosSymptomatic", testNum);
 		readAndSkipPast( tmpBuf, file );
 		for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
-			fscanf( file, "%lf", &(tbTest.probEmpiricPositiveResultSymptomaticHIVPos[i]));
+			file->scan( "%lf", &(tbTest.probEmpiricPositiveResultSymptomaticHIVPos[i]));
 		}
 
 		sprintf(tmpBuf, "TBTest%dProbEmpiricPositiveResultHIVNegAsymptomatic", testNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbTest.probEmpiricPositiveResultAsymptomaticHIVNeg));
+		file->scan( "%lf", &(tbTest.probEmpiricPositiveResultAsymptomaticHIVNeg));
 
 		sprintf(tmpBuf, "TBTest%dProbEmpiricPositiveResultHIVPosAsymptomatic", testNum);
 		readAndSkipPast( tmpBuf, file );
 		for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
-			fscanf( file, "%lf", &(tbTest.probEmpiricPositiveResultAsymptomaticHIVPos[i]));
+			file->scan( "%lf", &(tbTest.probEmpiricPositiveResultAsymptomaticHIVPos[i]));
 		}
 
 		sprintf(tmpBuf, "TBTest%dProbEmpiricTestOfferHIVNegSymptomatic", testNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbTest.probEmpiricTestOfferSymptomaticHIVNeg));
+		file->scan( "%lf", &(tbTest.probEmpiricTestOfferSymptomaticHIVNeg));
 
 		sprintf(tmpBuf, "TBTest%dProbEmpiricTestOfferHIVPosSymptomatic", testNum);
 		readAndSkipPast( tmpBuf, file );
 		for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
-			fscanf( file, "%lf", &(tbTest.probEmpiricTestOfferSymptomaticHIVPos[i]));
+			file->scan( "%lf", &(tbTest.probEmpiricTestOfferSymptomaticHIVPos[i]));
 		}
 
 		sprintf(tmpBuf, "TBTest%dProbEmpiricTestOfferHIVNegAsymptomatic", testNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbTest.probEmpiricTestOfferAsymptomaticHIVNeg));
+		file->scan( "%lf", &(tbTest.probEmpiricTestOfferAsymptomaticHIVNeg));
 
 		sprintf(tmpBuf, "TBTest%dProbEmpiricTestOfferHIVPosAsymptomatic", testNum);
 		readAndSkipPast( tmpBuf, file );
 		for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
-			fscanf( file, "%lf", &(tbTest.probEmpiricTestOfferAsymptomaticHIVPos[i]));
+			file->scan( "%lf", &(tbTest.probEmpiricTestOfferAsymptomaticHIVPos[i]));
 		}
 
 		sprintf(tmpBuf, "TBTest%dProbStopEmpiric", testNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf %lf", &(tbTest.probStopEmpiricSymptomatic), &(tbTest.probStopEmpiricAsymptomatic));
+		file->scan( "%lf %lf", &(tbTest.probStopEmpiricSymptomatic), &(tbTest.probStopEmpiricAsymptomatic));
 
 		//Cost and QOL of test
 		sprintf(tmpBuf, "TBTest%dInitialCost", testNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbTest.initCost));
+		file->scan( "%lf", &(tbTest.initCost));
 
 		sprintf(tmpBuf, "TBTest%dQOLMod", testNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbTest.QOLMod));
+		file->scan( "%lf", &(tbTest.QOLMod));
 
 		sprintf(tmpBuf, "TBTest%dCostDST", testNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbTest.DSTCost));
+		file->scan( "%lf", &(tbTest.DSTCost));
 	}
 
 	//TB Treatment
 	//Order of regimens
 	readAndSkipPast2( "TBTreatProbInitialNeverTreat","DS", file );
 	for (i = 0; i < TB_NUM_TREATMENTS; i++)
-		fscanf( file, "%lf", &(tbInputs.TBTreatmentProbInitialLine[0][TB_STRAIN_DS][i]));
+		file->scan( "%lf", &(tbInputs->TBTreatmentProbInitialLine[0][TB_STRAIN_DS][i]));
 	readAndSkipPast2( "TBTreatProbInitialNeverTreat","MDR", file );
 	for (i = 0; i < TB_NUM_TREATMENTS; i++)
-		fscanf( file, "%lf", &(tbInputs.TBTreatmentProbInitialLine[0][TB_STRAIN_MDR][i]));
+		file->scan( "%lf", &(tbInputs->TBTreatmentProbInitialLine[0][TB_STRAIN_MDR][i]));
 	readAndSkipPast2( "TBTreatProbInitialNeverTreat","XDR", file );
 	for (i = 0; i < TB_NUM_TREATMENTS; i++)
-		fscanf( file, "%lf", &(tbInputs.TBTreatmentProbInitialLine[0][TB_STRAIN_XDR][i]));
+		file->scan( "%lf", &(tbInputs->TBTreatmentProbInitialLine[0][TB_STRAIN_XDR][i]));
 
 	readAndSkipPast2( "TBTreatProbInitialEverTreat","DS", file );
 	for (i = 0; i < TB_NUM_TREATMENTS; i++)
-		fscanf( file, "%lf", &(tbInputs.TBTreatmentProbInitialLine[1][TB_STRAIN_DS][i]));
+		file->scan( "%lf", &(tbInputs->TBTreatmentProbInitialLine[1][TB_STRAIN_DS][i]));
 	readAndSkipPast2( "TBTreatProbInitialEverTreat","MDR", file );
 	for (i = 0; i < TB_NUM_TREATMENTS; i++)
-		fscanf( file, "%lf", &(tbInputs.TBTreatmentProbInitialLine[1][TB_STRAIN_MDR][i]));
+		file->scan( "%lf", &(tbInputs->TBTreatmentProbInitialLine[1][TB_STRAIN_MDR][i]));
 	readAndSkipPast2( "TBTreatProbInitialEverTreat","XDR", file );
 	for (i = 0; i < TB_NUM_TREATMENTS; i++)
-		fscanf( file, "%lf", &(tbInputs.TBTreatmentProbInitialLine[1][TB_STRAIN_XDR][i]));
+		file->scan( "%lf", &(tbInputs->TBTreatmentProbInitialLine[1][TB_STRAIN_XDR][i]));
 
 	readAndSkipPast( "TBTreatProbRepeatLine", file );
 	for (i = 0; i < TB_NUM_TREATMENTS; i++)
-		fscanf( file, "%lf", &(tbInputs.TBTreatmentProbRepeatLine[i]));
+		file->scan( "%lf", &(tbInputs->TBTreatmentProbRepeatLine[i]));
 	readAndSkipPast( "TBTreatNumRepeats", file );
 	for (i = 0; i < TB_NUM_TREATMENTS; i++)
-		fscanf( file, "%d", &(tbInputs.TBTreatmentMaxRepeats[i]));
+		file->scan( "%d", &(tbInputs->TBTreatmentMaxRepeats[i]));
 	readAndSkipPast( "TBTreatProbResistAfterFail", file );
 	for (i = 0; i < TB_NUM_TREATMENTS; i++)
-		fscanf( file, "%lf", &(tbInputs.TBTreatmentProbResistAfterFail[i]));
+		file->scan( "%lf", &(tbInputs->TBTreatmentProbResistAfterFail[i]));
 	readAndSkipPast( "TBTreatProbResistAfterDefault", file );
 	for (i = 0; i < TB_NUM_TREATMENTS; i++)
-		fscanf( file, "%lf", &(tbInputs.TBTreatmentProbResistAfterDefault[i]));
+		file->scan( "%lf", &(tbInputs->TBTreatmentProbResistAfterDefault[i]));
 
 	readAndSkipPast( "TBTreatProbEmpiricMDR", file );
-	fscanf( file, "%lf", &(tbInputs.probEmpiricWithObservedHistMDR));
+	file->scan( "%lf", &(tbInputs->probEmpiricWithObservedHistMDR));
 	readAndSkipPast( "TBTreatProbEmpiricXDR", file );
-	fscanf( file, "%lf", &(tbInputs.probEmpiricWithObservedHistXDR));
+	file->scan( "%lf", &(tbInputs->probEmpiricWithObservedHistXDR));
 
 	readAndSkipPast( "TBTreatEmpiricNum", file );
 	for (i = 0; i < TB_NUM_STRAINS; i++)
-		fscanf( file, "%d", &(tbInputs.empiricTreatmentNum[i]));
+		file->scan( "%d", &(tbInputs->empiricTreatmentNum[i]));
 
 	//TB Treatments
 	for (int treatNum = 0; treatNum < TB_NUM_TREATMENTS; treatNum++) {
-		TBInputs::TBTreatment &tbTreat = tbInputs.TBTreatments[treatNum];
+		TBInputs::TBTreatment &tbTreat = tbInputs->TBTreatments[treatNum];
 		int tempInt;
 
 		//treatment duration
 		sprintf(tmpBuf, "TBTreat%dStage1Duration", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d", &(tbTreat.stage1Duration));
+		file->scan( "%d", &(tbTreat.stage1Duration));
 		sprintf(tmpBuf, "TBTreat%dStage2Duration", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d", &tempInt);
+		file->scan( "%d", &tempInt);
 		tbTreat.totalDuration = tbTreat.stage1Duration + tempInt;
 
 		//cost of treatment
 		sprintf(tmpBuf, "TBTreat%dCost", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf %lf %lf", &(tbTreat.costInitial), &(tbTreat.costMonthly[0]), &(tbTreat.costMonthly[1]));
+		file->scan( "%lf %lf %lf", &(tbTreat.costInitial), &(tbTreat.costMonthly[0]), &(tbTreat.costMonthly[1]));
 
 		//prob success
 		sprintf(tmpBuf, "TBTreat%dProbSuccess", treatNum);
 		readAndSkipPast2( tmpBuf, "HIV_Neg", file );
 		for (i = 0; i < TB_NUM_STRAINS; i++)
-			fscanf( file, "%lf", &(tbTreat.probSuccessHIVNeg[i]));
+			file->scan( "%lf", &(tbTreat.probSuccessHIVNeg[i]));
 
 
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j) {
 			sprintf(tmpBuf, "TBTreat%dProbSuccess", treatNum);
 			readAndSkipPast2( tmpBuf, CD4_STRATA_STRS[j], file );
 			for (i = 0; i < TB_NUM_STRAINS; i++)
-				fscanf( file, "%lf", &(tbTreat.probSuccessHIVPos[i][j]));
+				file->scan( "%lf", &(tbTreat.probSuccessHIVPos[i][j]));
 		}
 
 		//Toxicities
 		sprintf(tmpBuf, "TBTreat%dToxProbHIVNeg", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf %lf %lf %lf", &(tbTreat.probMinorToxHIVNeg[0]), &(tbTreat.probMajorToxHIVNeg[0]), &(tbTreat.probMinorToxHIVNeg[1]), &(tbTreat.probMajorToxHIVNeg[1]));
+		file->scan( "%lf %lf %lf %lf", &(tbTreat.probMinorToxHIVNeg[0]), &(tbTreat.probMajorToxHIVNeg[0]), &(tbTreat.probMinorToxHIVNeg[1]), &(tbTreat.probMajorToxHIVNeg[1]));
 		
 		sprintf(tmpBuf, "TBTreat%dToxProbHIVPos_offART", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf %lf %lf %lf", &(tbTreat.probMinorToxOffARTHIVPos[0]), &(tbTreat.probMajorToxOffARTHIVPos[0]), &(tbTreat.probMinorToxOffARTHIVPos[1]), &(tbTreat.probMajorToxOffARTHIVPos[1]));
+		file->scan( "%lf %lf %lf %lf", &(tbTreat.probMinorToxOffARTHIVPos[0]), &(tbTreat.probMajorToxOffARTHIVPos[0]), &(tbTreat.probMinorToxOffARTHIVPos[1]), &(tbTreat.probMajorToxOffARTHIVPos[1]));
 
 		sprintf(tmpBuf, "TBTreat%dToxProbHIVPos_onART", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf %lf %lf %lf", &(tbTreat.probMinorToxOnARTHIVPos[0]), &(tbTreat.probMajorToxOnARTHIVPos[0]), &(tbTreat.probMinorToxOnARTHIVPos[1]), &(tbTreat.probMajorToxOnARTHIVPos[1]));
+		file->scan( "%lf %lf %lf %lf", &(tbTreat.probMinorToxOnARTHIVPos[0]), &(tbTreat.probMajorToxOnARTHIVPos[0]), &(tbTreat.probMinorToxOnARTHIVPos[1]), &(tbTreat.probMajorToxOnARTHIVPos[1]));
 
 		sprintf(tmpBuf, "TBTreat%dDthRateRatioMajTox", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbTreat.deathRateRatioMajorToxicity));
+		file->scan( "%lf", &(tbTreat.deathRateRatioMajorToxicity));
 
 		sprintf(tmpBuf, "TBTreat%dToxCostHIVNeg", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf %lf %lf %lf", &(tbTreat.costMinorToxHIVNeg),&(tbTreat.QOLModMinorToxHIVNeg),
+		file->scan( "%lf %lf %lf %lf", &(tbTreat.costMinorToxHIVNeg),&(tbTreat.QOLModMinorToxHIVNeg),
 				&(tbTreat.costMajorToxHIVNeg),&(tbTreat.QOLModMajorToxHIVNeg));
 
 		sprintf(tmpBuf, "TBTreat%dToxCostHIVPos", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf %lf %lf %lf", &(tbTreat.costMinorToxHIVPos),&(tbTreat.QOLModMinorToxHIVPos),
+		file->scan( "%lf %lf %lf %lf", &(tbTreat.costMinorToxHIVPos),&(tbTreat.QOLModMinorToxHIVPos),
 				&(tbTreat.costMajorToxHIVPos),&(tbTreat.QOLModMajorToxHIVPos));
 
 		//Obsv early fail
 		sprintf(tmpBuf, "TBTreat%dProbObsvEarlyFail", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbTreat.probObsvEarlyFail));
+		file->scan( "%lf", &(tbTreat.probObsvEarlyFail));
 
 		sprintf(tmpBuf, "TBTreat%dProbEarlyFailObsvWithTBTest", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbTreat.probEarlyFailObservedWithTBTest));
+		file->scan( "%lf", &(tbTreat.probEarlyFailObservedWithTBTest));
 
 		sprintf(tmpBuf, "TBTreat%dObsvFailTBTestCost", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbTreat.costObsvEarlyFailTBTest));
+		file->scan( "%lf", &(tbTreat.costObsvEarlyFailTBTest));
 
 		sprintf(tmpBuf, "TBTreat%dProbSwitchOnObsvEarlyFail", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbTreat.probSwitchEarlyFail));
+		file->scan( "%lf", &(tbTreat.probSwitchEarlyFail));
 
 		sprintf(tmpBuf, "TBTreat%dNextTreatNumOnObsvEarlyFail", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d", &(tbTreat.nextTreatNumEarlyFail));
+		file->scan( "%d", &(tbTreat.nextTreatNumEarlyFail));
 
 		sprintf(tmpBuf, "TBTreat%dNextTreatNumOnRegularFail", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d", &(tbTreat.nextTreatNumNormalFail));
+		file->scan( "%d", &(tbTreat.nextTreatNumNormalFail));
 
 		//Efficacy of treatment against infection, activation and reinfection
 		sprintf(tmpBuf, "TBTreat%dEffInfect", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbTreat.efficacyInfectionHIVNeg));
+		file->scan( "%lf", &(tbTreat.efficacyInfectionHIVNeg));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j){
-			fscanf( file, "%lf", &(tbTreat.efficacyInfectionHIVPos[j]));
+			file->scan( "%lf", &(tbTreat.efficacyInfectionHIVPos[j]));
 		}
-		fscanf( file, "%d", &(tbTreat.monthsOfEfficacyInfection));
+		file->scan( "%d", &(tbTreat.monthsOfEfficacyInfection));
 
 		sprintf(tmpBuf, "TBTreat%dEffActivate", treatNum);
 		readAndSkipPast2( tmpBuf,"DS", file );
-		fscanf( file, "%lf", &(tbTreat.efficacyActivationHIVNeg[TB_STRAIN_DS]));
+		file->scan( "%lf", &(tbTreat.efficacyActivationHIVNeg[TB_STRAIN_DS]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbTreat.efficacyActivationHIVPos[TB_STRAIN_DS][j]));
-		fscanf( file, "%d", &(tbTreat.monthsOfEfficacyActivation[TB_STRAIN_DS]));
+			file->scan( "%lf", &(tbTreat.efficacyActivationHIVPos[TB_STRAIN_DS][j]));
+		file->scan( "%d", &(tbTreat.monthsOfEfficacyActivation[TB_STRAIN_DS]));
 
 		sprintf(tmpBuf, "TBTreat%dEffActivate", treatNum);
 		readAndSkipPast2( tmpBuf,"MDR", file );
-		fscanf( file, "%lf", &(tbTreat.efficacyActivationHIVNeg[TB_STRAIN_MDR]));
+		file->scan( "%lf", &(tbTreat.efficacyActivationHIVNeg[TB_STRAIN_MDR]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbTreat.efficacyActivationHIVPos[TB_STRAIN_MDR][j]));
-		fscanf( file, "%d", &(tbTreat.monthsOfEfficacyActivation[TB_STRAIN_MDR]));
+			file->scan( "%lf", &(tbTreat.efficacyActivationHIVPos[TB_STRAIN_MDR][j]));
+		file->scan( "%d", &(tbTreat.monthsOfEfficacyActivation[TB_STRAIN_MDR]));
 
 		sprintf(tmpBuf, "TBTreat%dEffActivate", treatNum);
 		readAndSkipPast2( tmpBuf,"XDR", file );
-		fscanf( file, "%lf", &(tbTreat.efficacyActivationHIVNeg[TB_STRAIN_XDR]));
+		file->scan( "%lf", &(tbTreat.efficacyActivationHIVNeg[TB_STRAIN_XDR]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbTreat.efficacyActivationHIVPos[TB_STRAIN_XDR][j]));
-		fscanf( file, "%d", &(tbTreat.monthsOfEfficacyActivation[TB_STRAIN_XDR]));
+			file->scan( "%lf", &(tbTreat.efficacyActivationHIVPos[TB_STRAIN_XDR][j]));
+		file->scan( "%d", &(tbTreat.monthsOfEfficacyActivation[TB_STRAIN_XDR]));
 
 		sprintf(tmpBuf, "TBTreat%dEffReinfect", treatNum);
 		readAndSkipPast2( tmpBuf,"DS", file );
-		fscanf( file, "%lf", &(tbTreat.efficacyReinfectionHIVNeg[TB_STRAIN_DS]));
+		file->scan( "%lf", &(tbTreat.efficacyReinfectionHIVNeg[TB_STRAIN_DS]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbTreat.efficacyReinfectionHIVPos[TB_STRAIN_DS][j]));
-		fscanf( file, "%d", &(tbTreat.monthsOfEfficacyReinfection[TB_STRAIN_DS]));
+			file->scan( "%lf", &(tbTreat.efficacyReinfectionHIVPos[TB_STRAIN_DS][j]));
+		file->scan( "%d", &(tbTreat.monthsOfEfficacyReinfection[TB_STRAIN_DS]));
 
 		sprintf(tmpBuf, "TBTreat%dEffReinfect", treatNum);
 		readAndSkipPast2( tmpBuf,"MDR", file );
-		fscanf( file, "%lf", &(tbTreat.efficacyReinfectionHIVNeg[TB_STRAIN_MDR]));
+		file->scan( "%lf", &(tbTreat.efficacyReinfectionHIVNeg[TB_STRAIN_MDR]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbTreat.efficacyReinfectionHIVPos[TB_STRAIN_MDR][j]));
-		fscanf( file, "%d", &(tbTreat.monthsOfEfficacyReinfection[TB_STRAIN_MDR]));
+			file->scan( "%lf", &(tbTreat.efficacyReinfectionHIVPos[TB_STRAIN_MDR][j]));
+		file->scan( "%d", &(tbTreat.monthsOfEfficacyReinfection[TB_STRAIN_MDR]));
 
 		sprintf(tmpBuf, "TBTreat%dEffReinfect", treatNum);
 		readAndSkipPast2( tmpBuf,"XDR", file );
-		fscanf( file, "%lf", &(tbTreat.efficacyReinfectionHIVNeg[TB_STRAIN_XDR]));
+		file->scan( "%lf", &(tbTreat.efficacyReinfectionHIVNeg[TB_STRAIN_XDR]));
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j)
-			fscanf( file, "%lf", &(tbTreat.efficacyReinfectionHIVPos[TB_STRAIN_XDR][j]));
-		fscanf( file, "%d", &(tbTreat.monthsOfEfficacyReinfection[TB_STRAIN_XDR]));
+			file->scan( "%lf", &(tbTreat.efficacyReinfectionHIVPos[TB_STRAIN_XDR][j]));
+		file->scan( "%d", &(tbTreat.monthsOfEfficacyReinfection[TB_STRAIN_XDR]));
 
 		sprintf(tmpBuf, "TBTreat%dRelapseMult", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &(tbTreat.relapseMult));
+		file->scan( "%lf", &(tbTreat.relapseMult));
 		sprintf(tmpBuf, "TBTreat%dRelapseMultDuration", treatNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d", &(tbTreat.relapseMultDuration));
+		file->scan( "%d", &(tbTreat.relapseMultDuration));
 
 	}
 } /* end readTBInputs */
 
 /* readQOLInputs reads data from the QOL tab of the input sheet */
-void SimContext::readQOLInputs() {
+void SimContext::readQOLInputs(InputReader *inputFile) {
 	int i, j, tempInt;
 
 	// read in routine QOL, which is the base QoL for HIV+ detected patients 
 	for ( j = 0; j < HIST_EXT_NUM; ++j ) {
 		if (j == HIST_EXT_MILD){
 			for ( i = CD4_NUM_STRATA - 1; i >= 0; --i )
-				qolInputs.routineCareQOL[i][j] = qolInputs.routineCareQOL[i][HIST_EXT_N];
+				qolInputs->routineCareQOL[i][j] = qolInputs->routineCareQOL[i][HIST_EXT_N];
 		}
 		else{
 		readAndSkipPast( "QOLRoutine", inputFile );
 			readAndSkipPast( HIST_OI_CATS_STRS[j], inputFile );
 			for ( i = CD4_NUM_STRATA - 1; i >= 0; --i )
-			fscanf( inputFile, "%lf", &(qolInputs.routineCareQOL[i][j]) );
+			inputFile->scan( "%lf", &(qolInputs->routineCareQOL[i][j]) );
 		}
 	}
 	readAndSkipPast( "QOLRoutineOIHistEffectDuration", inputFile);
 	for ( i = CD4_NUM_STRATA - 1; i >= 0; --i )
-		fscanf( inputFile, "%d", &(qolInputs.routineCareQOLSevereOIHistDuration[i]) );
+		inputFile->scan( "%d", &(qolInputs->routineCareQOLSevereOIHistDuration[i]) );
 
 	// read in acute OI QOL
 	readAndSkipPast( "QOLAcuteOI", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(qolInputs.acuteOIQOL[i]) );
+		inputFile->scan( "%lf", &(qolInputs->acuteOIQOL[i]) );
 	// read in death QOL
 	readAndSkipPast( "QOLDeath", inputFile );
 	for ( i = 0; i < DTH_NUM_CAUSES_BASIC; ++i )
-		fscanf( inputFile, "%lf", &(qolInputs.deathBasicQOL[i]) );
+		inputFile->scan( "%lf", &(qolInputs->deathBasicQOL[i]) );
 
 	// read in background QOL, applied to all patients regardless of HIV status
 	readAndSkipPast( "QOLBackgroundMale", inputFile );
 	for (i = 0; i < AGE_YRS; i++) {
-		fscanf(inputFile, "%lf", &(qolInputs.backgroundQOL[GENDER_MALE][i]));
+		inputFile->scan("%lf", &(qolInputs->backgroundQOL[GENDER_MALE][i]));
 	}
 	readAndSkipPast( "QOLBackgroundFemale", inputFile );
 	for (i = 0; i < AGE_YRS; i++) {
-		fscanf(inputFile, "%lf", &(qolInputs.backgroundQOL[GENDER_FEMALE][i]));
+		inputFile->scan("%lf", &(qolInputs->backgroundQOL[GENDER_FEMALE][i]));
 	}
 	readAndSkipPast("QOLCalculationType", inputFile);
-	fscanf(inputFile,"%d",&tempInt);
-	qolInputs.QOLCalculationType = (QOL_CALC_TYPE) tempInt;
+	inputFile->scan("%d",&tempInt);
+	qolInputs->QOLCalculationType = (QOL_CALC_TYPE) tempInt;
 } /* end readQOLInputs */
 
 /* readHIVTestInputs reads data from the HIVTest tab of the input sheet */
-void SimContext::readHIVTestInputs() {
+void SimContext::readHIVTestInputs(InputReader *inputFile) {
 	char buffer[256];
 	int i, j, k, tempBool;
 
 	// read in enable HIV testing module
 	readAndSkipPast( "EnableHIVtest", inputFile );
-	fscanf( inputFile, "%d", &tempBool);
-	testingInputs.enableHIVTesting = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool);
+	testingInputs->enableHIVTesting = (bool) tempBool;
 	// read in HIV test available
 	readAndSkipPast( "HIVtestAvail", inputFile );
-	fscanf( inputFile, "%d", &tempBool);
-	testingInputs.HIVTestAvailable = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool);
+	testingInputs->HIVTestAvailable = (bool) tempBool;
 	//read in whether to enable PrEP - if Dynamic Transmission is enabled, the warmup run inputs for enabling/disabling PrEP override the HIVTest tab ones; see also ConsoleMain.cpp
 	readAndSkipPast( "PrEPEnable", inputFile );
-	fscanf( inputFile, "%d", &tempBool);
-	if(cohortInputs.useDynamicTransm){
-		testingInputs.enablePrEP = cohortInputs.usePrEPDuringWarmup;
+	inputFile->scan( "%d", &tempBool);
+	if(cohortInputs->useDynamicTransm){
+		testingInputs->enablePrEP = cohortInputs->usePrEPDuringWarmup;
 	}
 	else{
-		testingInputs.enablePrEP = (bool) tempBool;
+		testingInputs->enablePrEP = (bool) tempBool;
 	}
 
 	//read in CD4 test available
 	readAndSkipPast( "CD4testAvail", inputFile );
-	fscanf( inputFile, "%d", &tempBool);
-	testingInputs.CD4TestAvailable = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool);
+	testingInputs->CD4TestAvailable = (bool) tempBool;
 	// read in whether to use alt HIV+ stopping rule
 	readAndSkipPast( "AltStopRuleEnable", inputFile );
-	fscanf( inputFile, "%d", &tempBool);
-	testingInputs.useAlternateStoppingRule = (bool) tempBool;
-	if (testingInputs.enableHIVTesting != true)
-		testingInputs.useAlternateStoppingRule = false;
+	inputFile->scan( "%d", &tempBool);
+	testingInputs->useAlternateStoppingRule = (bool) tempBool;
+	if (testingInputs->enableHIVTesting != true)
+		testingInputs->useAlternateStoppingRule = false;
 	readAndSkipPast( "AltStopRuleTotHIV", inputFile );
-	fscanf( inputFile, "%ld", &testingInputs.totalCohortsWithHIVPositiveLimit );
+	inputFile->scan( "%d", &testingInputs->totalCohortsWithHIVPositiveLimit );
 	readAndSkipPast( "AltStopRuleTotCohort", inputFile );
-	fscanf( inputFile, "%ld", &testingInputs.totalCohortsLimit );
+	inputFile->scan( "%d", &testingInputs->totalCohortsLimit );
 
     // read in HIV incidence age bins
 	readAndSkipPast( "IncidenceAgeBins", inputFile );
 	readAndSkipPast( "EndYr", inputFile );
 	for (i = 0; i < AGE_CAT_HIV_INC; ++i) {
-		fscanf( inputFile, "%d", &(testingInputs.HIVIncAgeBounds[i]));
+		inputFile->scan( "%d", &(testingInputs->HIVIncAgeBounds[i]));
 	}
 
 	// read in distribution of HIV patient states
 	readAndSkipPast( "HIVdistNeg", inputFile );
-	fscanf( inputFile, "%lf", &(testingInputs.initialHIVDistribution[HIV_INF_NEG]) );
+	inputFile->scan( "%lf", &(testingInputs->initialHIVDistribution[HIV_INF_NEG]) );
 	readAndSkipPast( "HIVdistPosAcute", inputFile );
-	fscanf( inputFile, "%lf", &(testingInputs.initialHIVDistribution[HIV_INF_ACUTE_SYN]) );
+	inputFile->scan( "%lf", &(testingInputs->initialHIVDistribution[HIV_INF_ACUTE_SYN]) );
 	readAndSkipPast( "HIVdistPosChr", inputFile );
-	fscanf( inputFile, "%lf", &(testingInputs.initialHIVDistribution[HIV_INF_ASYMP_CHR_POS]) );
-	testingInputs.initialHIVDistribution[HIV_INF_SYMP_CHR_POS] = 0.0;
+	inputFile->scan( "%lf", &(testingInputs->initialHIVDistribution[HIV_INF_ASYMP_CHR_POS]) );
+	testingInputs->initialHIVDistribution[HIV_INF_SYMP_CHR_POS] = 0.0;
 
 	readAndSkipPast( "HIVNegRiskDist", inputFile );
-	fscanf( inputFile, "%lf %lf", &(testingInputs.initialRiskDistribution[HIV_BEHAV_HI]),&(testingInputs.initialRiskDistribution[HIV_BEHAV_LO]) );
+	inputFile->scan( "%lf %lf", &(testingInputs->initialRiskDistribution[HIV_BEHAV_HI]),&(testingInputs->initialRiskDistribution[HIV_BEHAV_LO]) );
 
 	// read in distribution of inital CD4s and HVLs for acute HIV infections
 	readAndSkipPast( "HIVacuteCD4dist", inputFile );
-	fscanf( inputFile, "%lf %lf", &(testingInputs.initialAcuteCD4DistributionMean),
-		&(testingInputs.initialAcuteCD4DistributionStdDev) );
+	inputFile->scan( "%lf %lf", &(testingInputs->initialAcuteCD4DistributionMean),
+		&(testingInputs->initialAcuteCD4DistributionStdDev) );
 	readAndSkipPast( "HIVacuteHVLdist", inputFile );
 	for ( k = HVL_NUM_STRATA - 1; k >= 0; --k ) {
-		fscanf( inputFile, "%lf", &(testingInputs.initialAcuteHVLDistribution[0][k]) );
+		inputFile->scan( "%lf", &(testingInputs->initialAcuteHVLDistribution[0][k]) );
 		for (i = 1; i < CD4_NUM_STRATA; ++i)
-			testingInputs.initialAcuteHVLDistribution[i][k] = testingInputs.initialAcuteHVLDistribution[0][k];
+			testingInputs->initialAcuteHVLDistribution[i][k] = testingInputs->initialAcuteHVLDistribution[0][k];
 	}
 
 	// read in monthly HIV infection rate for HIV neg's
 	readAndSkipPast( "HIVmthIncidMale", inputFile );
 	readAndSkipPast( "hiRisk", inputFile );
 	for (i = 0; i < AGE_CAT_HIV_INC; ++i) {
-		fscanf( inputFile, "%lf", &(testingInputs.probHIVInfection[GENDER_MALE][i][HIV_BEHAV_HI]));
+		inputFile->scan( "%lf", &(testingInputs->probHIVInfection[GENDER_MALE][i][HIV_BEHAV_HI]));
 	}
 	readAndSkipPast( "HIVmthIncidMale", inputFile );
 	readAndSkipPast( "loRisk", inputFile );
 	for (i = 0; i < AGE_CAT_HIV_INC; ++i) {
-		fscanf( inputFile, "%lf", &(testingInputs.probHIVInfection[GENDER_MALE][i][HIV_BEHAV_LO]));
+		inputFile->scan( "%lf", &(testingInputs->probHIVInfection[GENDER_MALE][i][HIV_BEHAV_LO]));
 	}
 	readAndSkipPast( "HIVmthIncidFemale", inputFile );
 	readAndSkipPast( "hiRisk", inputFile );
 	for (i = 0; i < AGE_CAT_HIV_INC; ++i) {
-		fscanf( inputFile, "%lf", &(testingInputs.probHIVInfection[GENDER_FEMALE][i][HIV_BEHAV_HI]));
+		inputFile->scan( "%lf", &(testingInputs->probHIVInfection[GENDER_FEMALE][i][HIV_BEHAV_HI]));
 	}
 	readAndSkipPast( "HIVmthIncidFemale", inputFile );
 	readAndSkipPast( "loRisk", inputFile );
 	for (i = 0; i < AGE_CAT_HIV_INC; ++i) {
-		fscanf( inputFile, "%lf", &(testingInputs.probHIVInfection[GENDER_FEMALE][i][HIV_BEHAV_LO]));
+		inputFile->scan( "%lf", &(testingInputs->probHIVInfection[GENDER_FEMALE][i][HIV_BEHAV_LO]));
 	}
 
 	readAndSkipPast( "UseHIVIncidReductionMult", inputFile );
-	fscanf( inputFile, "%d", &tempBool);
-	testingInputs.useHIVIncReductionMult = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool);
+	testingInputs->useHIVIncReductionMult = (bool) tempBool;
 	readAndSkipPast("HIVIncidReductionMult",inputFile);
 	for (int i = 0; i < INC_REDUC_PERIODS_NUM; i++) {
-		fscanf(inputFile, "%lf", &(testingInputs.HIVIncReducMultipliers[i]));
+		inputFile->scan("%lf", &(testingInputs->HIVIncReducMultipliers[i]));
 	}
 	
-	testingInputs.HIVIncReducStageBounds[0] = 1;
+	testingInputs->HIVIncReducStageBounds[0] = 1;
 	readAndSkipPast("HIVIncidReductionMultBounds",inputFile);
 	for (int i = 1; i < INC_REDUC_PERIODS_NUM; i++) {
-		fscanf(inputFile, "%d", &(testingInputs.HIVIncReducStageBounds[i]));
+		inputFile->scan("%d", &(testingInputs->HIVIncReducStageBounds[i]));
 	}
 	// read in number of mths from acute HIV to chronic HIV state
 	readAndSkipPast( "MthsAcuteToChrHIV", inputFile );
-	fscanf( inputFile, "%d", &(testingInputs.monthsFromAcuteToChronic) );
+	inputFile->scan( "%d", &(testingInputs->monthsFromAcuteToChronic) );
 	// read in CD4 transitions from HIV acute to chronic
 	readAndSkipPast( "MeanCD4ChgAtChrHIVTrans", inputFile );
 	for (i = HVL_NUM_STRATA - 1; i >= 0; --i)
-		fscanf( inputFile, "%lf", &(testingInputs.CD4ChangeAtChronicHIVMean[i]) );
+		inputFile->scan( "%lf", &(testingInputs->CD4ChangeAtChronicHIVMean[i]) );
 	readAndSkipPast( "SDevCD4ChgAtChrHIVTrans", inputFile );
 	for (i = HVL_NUM_STRATA - 1; i >= 0; --i)
-		fscanf( inputFile, "%lf", &(testingInputs.CD4ChangeAtChronicHIVStdDev[i]) );
+		inputFile->scan( "%lf", &(testingInputs->CD4ChangeAtChronicHIVStdDev[i]) );
 	// read in HVL transitions from HIV acute to chronic
 	for (i = HVL_NUM_STRATA - 1; i >= 0; --i) {
 		readAndSkipPast( "HVLDistribAtChrHIVTrans", inputFile );
 		readAndSkipPast( HVL_STRATA_STRS[i], inputFile );
 		for ( j = HVL_NUM_STRATA - 1; j >= 0; --j )
-			fscanf( inputFile, "%lf", &(testingInputs.HVLDistributionAtChronicHIV[i][j]) );
+			inputFile->scan( "%lf", &(testingInputs->HVLDistributionAtChronicHIV[i][j]) );
 	}
 	// read in probability of being initially detected as HIV positive upon model entry
 	readAndSkipPast( "HIVdetectAcute", inputFile );
-	fscanf( inputFile, "%lf", &(testingInputs.probHIVDetectionInitial[HIV_POS_ACUTE_SYN]));
+	inputFile->scan( "%lf", &(testingInputs->probHIVDetectionInitial[HIV_POS_ACUTE_SYN]));
 	readAndSkipPast( "HIVdetectAsympChr", inputFile );
-	fscanf( inputFile, "%lf", &(testingInputs.probHIVDetectionInitial[HIV_POS_ASYMP_CHR_POS]));
+	inputFile->scan( "%lf", &(testingInputs->probHIVDetectionInitial[HIV_POS_ASYMP_CHR_POS]));
 	readAndSkipPast( "HIVdetectSympChr", inputFile );
-	fscanf( inputFile, "%lf", &(testingInputs.probHIVDetectionInitial[HIV_POS_SYMP_CHR_POS]));
+	inputFile->scan( "%lf", &(testingInputs->probHIVDetectionInitial[HIV_POS_SYMP_CHR_POS]));
 
 	// read in probability that someone who hasn't been detected gets detected when they get a particular OI
 	readAndSkipPast( "HIVProbDetAtOI", inputFile );
 	for (i = 0; i < OI_NUM; ++i) {
-		fscanf( inputFile, "%lf", &(testingInputs.probHIVDetectionWithOI[i]) );
+		inputFile->scan( "%lf", &(testingInputs->probHIVDetectionWithOI[i]) );
 	}
 	// read in probability that someone who has been detected by a particular OI will subsequently link to HIV care
 	readAndSkipPast( "HIVProbLinkAtOIDet", inputFile );
 	for (i = 0; i < OI_NUM; ++i) {
-		fscanf( inputFile, "%lf", &(testingInputs.probLinkToCareWithOIDet[i]) );
+		inputFile->scan( "%lf", &(testingInputs->probLinkToCareWithOIDet[i]) );
 	}
 	// read in monthly costs and QOL for special undet HIV+ states
 	readAndSkipPast( "HIVundetCD4Cost", inputFile );
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i)
-		fscanf( inputFile, "%lf", &(testingInputs.monthCostHIVUndetected[i]) );
+		inputFile->scan( "%lf", &(testingInputs->monthCostHIVUndetected[i]) );
 	readAndSkipPast( "HIVundetCD4QOL", inputFile );
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i)
-		fscanf( inputFile, "%lf", &(testingInputs.monthQOLHIVUndetected[i]) );	
+		inputFile->scan( "%lf", &(testingInputs->monthQOLHIVUndetected[i]) );	
 
 	// read in death costs for special HIV- and undet HIV+ states
 	readAndSkipPast( "HIVnegDthCost", inputFile );
-	fscanf( inputFile, "%lf", &(testingInputs.deathCostHIVNegative) );
+	inputFile->scan( "%lf", &(testingInputs->deathCostHIVNegative) );
 	readAndSkipPast( "HIVundetHIVDthCost", inputFile );
-	fscanf( inputFile, "%lf", &(testingInputs.HIVDeathCostHIVUndetected) );
+	inputFile->scan( "%lf", &(testingInputs->HIVDeathCostHIVUndetected) );
 	readAndSkipPast( "HIVundetBgMortDthCost", inputFile );
-	fscanf( inputFile, "%lf", &(testingInputs.backgroundMortDeathCostHIVUndetected) );
+	inputFile->scan( "%lf", &(testingInputs->backgroundMortDeathCostHIVUndetected) );
 
 	// read in death QOLs for special HIV- and undet HIV+ states
 	readAndSkipPast( "HIVnegDthQOL", inputFile );
-	fscanf( inputFile, "%lf", &(testingInputs.deathQOLHIVNegative) );
+	inputFile->scan( "%lf", &(testingInputs->deathQOLHIVNegative) );
 	readAndSkipPast( "HIVundetHIVDthQOL", inputFile );
-	fscanf( inputFile, "%lf", &(testingInputs.HIVDeathQOLHIVUndetected) );
+	inputFile->scan( "%lf", &(testingInputs->HIVDeathQOLHIVUndetected) );
 	readAndSkipPast( "HIVundetBgMortDthQOL", inputFile );
-	fscanf( inputFile, "%lf", &(testingInputs.backgroundMortDeathQOLHIVUndetected) );
+	inputFile->scan( "%lf", &(testingInputs->backgroundMortDeathQOLHIVUndetected) );
 
 	// read in frequency of screening and stop age for user-defined HIV tests
 	readAndSkipPast( "HIVtestStartAge", inputFile );
-	fscanf( inputFile, "%d", &(testingInputs.HIVRegularTestingStartAge) );
+	inputFile->scan( "%d", &(testingInputs->HIVRegularTestingStartAge) );
 	readAndSkipPast( "HIVtestStopAge", inputFile );
-	fscanf( inputFile, "%d", &(testingInputs.HIVRegularTestingStopAge) );
+	inputFile->scan( "%d", &(testingInputs->HIVRegularTestingStopAge) );
 	readAndSkipPast( "HIVtestFreqInterval", inputFile );
 	for (i = 0; i < HIV_TEST_FREQ_NUM; ++i)
-		fscanf( inputFile, "%d", &(testingInputs.HIVTestingInterval[i]) );
+		inputFile->scan( "%d", &(testingInputs->HIVTestingInterval[i]) );
 	readAndSkipPast( "HIVtestFreqProb", inputFile );
 	for (i = 0; i < HIV_TEST_FREQ_NUM; ++i)
-		fscanf( inputFile, "%lf", &(testingInputs.HIVTestingProbability[i]) );
+		inputFile->scan( "%lf", &(testingInputs->HIVTestingProbability[i]) );
 	
 	// read in enrollment characteristics of user-defined HIV screening program
 	for (j = 0; j < TEST_ACCEPT_NUM; ++j) {
 		sprintf( buffer, "HIVtestAcceptDist%d", j+1 );
 		readAndSkipPast( buffer, inputFile );
-		fscanf( inputFile, "%lf %lf %lf %lf %lf",
-			&(testingInputs.HIVTestAcceptDistribution[HIV_EXT_INF_NEG_HI][j]),
-			&(testingInputs.HIVTestAcceptDistribution[HIV_EXT_INF_NEG_LO][j]),
-			&(testingInputs.HIVTestAcceptDistribution[HIV_EXT_INF_ASYMP_CHR_POS][j]),
-			&(testingInputs.HIVTestAcceptDistribution[HIV_EXT_INF_SYMP_CHR_POS][j]),
-			&(testingInputs.HIVTestAcceptDistribution[HIV_EXT_INF_ACUTE_SYN][j]) );
+		inputFile->scan( "%lf %lf %lf %lf %lf",
+			&(testingInputs->HIVTestAcceptDistribution[HIV_EXT_INF_NEG_HI][j]),
+			&(testingInputs->HIVTestAcceptDistribution[HIV_EXT_INF_NEG_LO][j]),
+			&(testingInputs->HIVTestAcceptDistribution[HIV_EXT_INF_ASYMP_CHR_POS][j]),
+			&(testingInputs->HIVTestAcceptDistribution[HIV_EXT_INF_SYMP_CHR_POS][j]),
+			&(testingInputs->HIVTestAcceptDistribution[HIV_EXT_INF_ACUTE_SYN][j]) );
 	}
 	for (j = 0; j < TEST_ACCEPT_NUM; ++j) {
 		sprintf( buffer, "HIVtestAcceptProb%d", j+1 );
 		readAndSkipPast( buffer, inputFile );
-		fscanf( inputFile, "%lf %lf %lf %lf %lf",
-			&(testingInputs.HIVTestAcceptProb[HIV_EXT_INF_NEG_HI][j]),
-			&(testingInputs.HIVTestAcceptProb[HIV_EXT_INF_NEG_LO][j]),
-			&(testingInputs.HIVTestAcceptProb[HIV_EXT_INF_ASYMP_CHR_POS][j]),
-			&(testingInputs.HIVTestAcceptProb[HIV_EXT_INF_SYMP_CHR_POS][j]),
-			&(testingInputs.HIVTestAcceptProb[HIV_EXT_INF_ACUTE_SYN][j]) );
+		inputFile->scan( "%lf %lf %lf %lf %lf",
+			&(testingInputs->HIVTestAcceptProb[HIV_EXT_INF_NEG_HI][j]),
+			&(testingInputs->HIVTestAcceptProb[HIV_EXT_INF_NEG_LO][j]),
+			&(testingInputs->HIVTestAcceptProb[HIV_EXT_INF_ASYMP_CHR_POS][j]),
+			&(testingInputs->HIVTestAcceptProb[HIV_EXT_INF_SYMP_CHR_POS][j]),
+			&(testingInputs->HIVTestAcceptProb[HIV_EXT_INF_ACUTE_SYN][j]) );
 	}
 	// read in characteristics of user-defined HIV tests
 	readAndSkipPast( "HIVtestRetProb", inputFile );
-	fscanf( inputFile, "%lf %lf %lf %lf",
-		&(testingInputs.HIVTestReturnProb[HIV_EXT_INF_NEG_HI]),
-		&(testingInputs.HIVTestReturnProb[HIV_EXT_INF_ASYMP_CHR_POS]),
-		&(testingInputs.HIVTestReturnProb[HIV_EXT_INF_SYMP_CHR_POS]),
-		&(testingInputs.HIVTestReturnProb[HIV_EXT_INF_ACUTE_SYN]) );
-	testingInputs.HIVTestReturnProb[HIV_EXT_INF_NEG_LO] = testingInputs.HIVTestReturnProb[HIV_EXT_INF_NEG_HI];
+	inputFile->scan( "%lf %lf %lf %lf",
+		&(testingInputs->HIVTestReturnProb[HIV_EXT_INF_NEG_HI]),
+		&(testingInputs->HIVTestReturnProb[HIV_EXT_INF_ASYMP_CHR_POS]),
+		&(testingInputs->HIVTestReturnProb[HIV_EXT_INF_SYMP_CHR_POS]),
+		&(testingInputs->HIVTestReturnProb[HIV_EXT_INF_ACUTE_SYN]) );
+	testingInputs->HIVTestReturnProb[HIV_EXT_INF_NEG_LO] = testingInputs->HIVTestReturnProb[HIV_EXT_INF_NEG_HI];
 	readAndSkipPast( "HIVtestPosProb", inputFile );
-	fscanf( inputFile, "%lf %lf %lf %lf",
-		&(testingInputs.HIVTestPositiveProb[HIV_INF_NEG]),
-		&(testingInputs.HIVTestPositiveProb[HIV_INF_ASYMP_CHR_POS]),
-		&(testingInputs.HIVTestPositiveProb[HIV_INF_SYMP_CHR_POS]),
-		&(testingInputs.HIVTestPositiveProb[HIV_INF_ACUTE_SYN]) );
+	inputFile->scan( "%lf %lf %lf %lf",
+		&(testingInputs->HIVTestPositiveProb[HIV_INF_NEG]),
+		&(testingInputs->HIVTestPositiveProb[HIV_INF_ASYMP_CHR_POS]),
+		&(testingInputs->HIVTestPositiveProb[HIV_INF_SYMP_CHR_POS]),
+		&(testingInputs->HIVTestPositiveProb[HIV_INF_ACUTE_SYN]) );
 	readAndSkipPast( "HIVtestPosCost", inputFile );
-	fscanf( inputFile, "%lf %lf %lf %lf",
-		&(testingInputs.HIVTestPositiveCost[HIV_INF_NEG]),
-		&(testingInputs.HIVTestPositiveCost[HIV_INF_ASYMP_CHR_POS]),
-		&(testingInputs.HIVTestPositiveCost[HIV_INF_SYMP_CHR_POS]),
-		&(testingInputs.HIVTestPositiveCost[HIV_INF_ACUTE_SYN]) );
+	inputFile->scan( "%lf %lf %lf %lf",
+		&(testingInputs->HIVTestPositiveCost[HIV_INF_NEG]),
+		&(testingInputs->HIVTestPositiveCost[HIV_INF_ASYMP_CHR_POS]),
+		&(testingInputs->HIVTestPositiveCost[HIV_INF_SYMP_CHR_POS]),
+		&(testingInputs->HIVTestPositiveCost[HIV_INF_ACUTE_SYN]) );
 	readAndSkipPast( "HIVtestNegCost", inputFile );
-	fscanf( inputFile, "%lf %lf %lf %lf",
-		&(testingInputs.HIVTestNegativeCost[HIV_INF_NEG]),
-		&(testingInputs.HIVTestNegativeCost[HIV_INF_ASYMP_CHR_POS]),
-		&(testingInputs.HIVTestNegativeCost[HIV_INF_SYMP_CHR_POS]),
-		&(testingInputs.HIVTestNegativeCost[HIV_INF_ACUTE_SYN]) );
+	inputFile->scan( "%lf %lf %lf %lf",
+		&(testingInputs->HIVTestNegativeCost[HIV_INF_NEG]),
+		&(testingInputs->HIVTestNegativeCost[HIV_INF_ASYMP_CHR_POS]),
+		&(testingInputs->HIVTestNegativeCost[HIV_INF_SYMP_CHR_POS]),
+		&(testingInputs->HIVTestNegativeCost[HIV_INF_ACUTE_SYN]) );
 	readAndSkipPast( "HIVtestPosQOLMod", inputFile );
-	fscanf( inputFile, "%lf %lf %lf %lf",
-		&(testingInputs.HIVTestPositiveQOLModifier[HIV_INF_NEG]),
-		&(testingInputs.HIVTestPositiveQOLModifier[HIV_INF_ASYMP_CHR_POS]),
-		&(testingInputs.HIVTestPositiveQOLModifier[HIV_INF_SYMP_CHR_POS]),
-		&(testingInputs.HIVTestPositiveQOLModifier[HIV_INF_ACUTE_SYN]) );
+	inputFile->scan( "%lf %lf %lf %lf",
+		&(testingInputs->HIVTestPositiveQOLModifier[HIV_INF_NEG]),
+		&(testingInputs->HIVTestPositiveQOLModifier[HIV_INF_ASYMP_CHR_POS]),
+		&(testingInputs->HIVTestPositiveQOLModifier[HIV_INF_SYMP_CHR_POS]),
+		&(testingInputs->HIVTestPositiveQOLModifier[HIV_INF_ACUTE_SYN]) );
 	readAndSkipPast( "HIVtestNegQOLMod", inputFile );
-	fscanf( inputFile, "%lf %lf %lf %lf",
-		&(testingInputs.HIVTestNegativeQOLModifier[HIV_INF_NEG]),
-		&(testingInputs.HIVTestNegativeQOLModifier[HIV_INF_ASYMP_CHR_POS]),
-		&(testingInputs.HIVTestNegativeQOLModifier[HIV_INF_SYMP_CHR_POS]),
-		&(testingInputs.HIVTestNegativeQOLModifier[HIV_INF_ACUTE_SYN]) );
+	inputFile->scan( "%lf %lf %lf %lf",
+		&(testingInputs->HIVTestNegativeQOLModifier[HIV_INF_NEG]),
+		&(testingInputs->HIVTestNegativeQOLModifier[HIV_INF_ASYMP_CHR_POS]),
+		&(testingInputs->HIVTestNegativeQOLModifier[HIV_INF_SYMP_CHR_POS]),
+		&(testingInputs->HIVTestNegativeQOLModifier[HIV_INF_ACUTE_SYN]) );
 	readAndSkipPast( "HIVtestCost", inputFile );
-	fscanf( inputFile, "%lf %lf %lf %lf",
-		&(testingInputs.HIVTestCost[HIV_EXT_INF_NEG_HI]),
-		&(testingInputs.HIVTestCost[HIV_EXT_INF_ASYMP_CHR_POS]),
-		&(testingInputs.HIVTestCost[HIV_EXT_INF_SYMP_CHR_POS]),
-		&(testingInputs.HIVTestCost[HIV_EXT_INF_ACUTE_SYN]) );
-	testingInputs.HIVTestCost[HIV_EXT_INF_NEG_LO] = testingInputs.HIVTestCost[HIV_EXT_INF_NEG_HI];
+	inputFile->scan( "%lf %lf %lf %lf",
+		&(testingInputs->HIVTestCost[HIV_EXT_INF_NEG_HI]),
+		&(testingInputs->HIVTestCost[HIV_EXT_INF_ASYMP_CHR_POS]),
+		&(testingInputs->HIVTestCost[HIV_EXT_INF_SYMP_CHR_POS]),
+		&(testingInputs->HIVTestCost[HIV_EXT_INF_ACUTE_SYN]) );
+	testingInputs->HIVTestCost[HIV_EXT_INF_NEG_LO] = testingInputs->HIVTestCost[HIV_EXT_INF_NEG_HI];
 
 	// read in costs of user-defined HIV testing program 
 	readAndSkipPast( "HIVtestStartupCost", inputFile );
-	fscanf( inputFile, "%lf %lf %lf %lf %lf",
-		&(testingInputs.HIVTestInitialCost[HIV_EXT_INF_NEG_HI]),
-		&(testingInputs.HIVTestInitialCost[HIV_EXT_INF_NEG_LO]),
-		&(testingInputs.HIVTestInitialCost[HIV_EXT_INF_ASYMP_CHR_POS]),
-		&(testingInputs.HIVTestInitialCost[HIV_EXT_INF_SYMP_CHR_POS]),
-		&(testingInputs.HIVTestInitialCost[HIV_EXT_INF_ACUTE_SYN]) );
+	inputFile->scan( "%lf %lf %lf %lf %lf",
+		&(testingInputs->HIVTestInitialCost[HIV_EXT_INF_NEG_HI]),
+		&(testingInputs->HIVTestInitialCost[HIV_EXT_INF_NEG_LO]),
+		&(testingInputs->HIVTestInitialCost[HIV_EXT_INF_ASYMP_CHR_POS]),
+		&(testingInputs->HIVTestInitialCost[HIV_EXT_INF_SYMP_CHR_POS]),
+		&(testingInputs->HIVTestInitialCost[HIV_EXT_INF_ACUTE_SYN]) );
 	readAndSkipPast( "HIVtestNonRetCost", inputFile );
-	fscanf( inputFile, "%lf %lf %lf %lf %lf",
-		&(testingInputs.HIVTestNonReturnCost[HIV_EXT_INF_NEG_HI]),
-		&(testingInputs.HIVTestNonReturnCost[HIV_EXT_INF_NEG_LO]),
-		&(testingInputs.HIVTestNonReturnCost[HIV_EXT_INF_ASYMP_CHR_POS]),
-		&(testingInputs.HIVTestNonReturnCost[HIV_EXT_INF_SYMP_CHR_POS]),
-		&(testingInputs.HIVTestNonReturnCost[HIV_EXT_INF_ACUTE_SYN]) );
+	inputFile->scan( "%lf %lf %lf %lf %lf",
+		&(testingInputs->HIVTestNonReturnCost[HIV_EXT_INF_NEG_HI]),
+		&(testingInputs->HIVTestNonReturnCost[HIV_EXT_INF_NEG_LO]),
+		&(testingInputs->HIVTestNonReturnCost[HIV_EXT_INF_ASYMP_CHR_POS]),
+		&(testingInputs->HIVTestNonReturnCost[HIV_EXT_INF_SYMP_CHR_POS]),
+		&(testingInputs->HIVTestNonReturnCost[HIV_EXT_INF_ACUTE_SYN]) );
 
 	// read in background HIV testing inputs
 	readAndSkipPast( "HIVtestBgAcceptProb", inputFile );
-	fscanf( inputFile, "%lf %lf %lf %lf %lf",
-		&(testingInputs.HIVBackgroundAcceptProb[HIV_EXT_INF_NEG_HI]),
-		&(testingInputs.HIVBackgroundAcceptProb[HIV_EXT_INF_NEG_LO]),
-		&(testingInputs.HIVBackgroundAcceptProb[HIV_EXT_INF_ASYMP_CHR_POS]),
-		&(testingInputs.HIVBackgroundAcceptProb[HIV_EXT_INF_SYMP_CHR_POS]),
-		&(testingInputs.HIVBackgroundAcceptProb[HIV_EXT_INF_ACUTE_SYN])
+	inputFile->scan( "%lf %lf %lf %lf %lf",
+		&(testingInputs->HIVBackgroundAcceptProb[HIV_EXT_INF_NEG_HI]),
+		&(testingInputs->HIVBackgroundAcceptProb[HIV_EXT_INF_NEG_LO]),
+		&(testingInputs->HIVBackgroundAcceptProb[HIV_EXT_INF_ASYMP_CHR_POS]),
+		&(testingInputs->HIVBackgroundAcceptProb[HIV_EXT_INF_SYMP_CHR_POS]),
+		&(testingInputs->HIVBackgroundAcceptProb[HIV_EXT_INF_ACUTE_SYN])
 	);
 	readAndSkipPast( "HIVtestBgReturnProb", inputFile );
-	fscanf( inputFile, "%lf %lf %lf %lf %lf",
-		&(testingInputs.HIVBackgroundReturnProb[HIV_EXT_INF_NEG_HI]),
-		&(testingInputs.HIVBackgroundReturnProb[HIV_EXT_INF_NEG_LO]),
-		&(testingInputs.HIVBackgroundReturnProb[HIV_EXT_INF_ASYMP_CHR_POS]),
-		&(testingInputs.HIVBackgroundReturnProb[HIV_EXT_INF_SYMP_CHR_POS]),
-		&(testingInputs.HIVBackgroundReturnProb[HIV_EXT_INF_ACUTE_SYN])
+	inputFile->scan( "%lf %lf %lf %lf %lf",
+		&(testingInputs->HIVBackgroundReturnProb[HIV_EXT_INF_NEG_HI]),
+		&(testingInputs->HIVBackgroundReturnProb[HIV_EXT_INF_NEG_LO]),
+		&(testingInputs->HIVBackgroundReturnProb[HIV_EXT_INF_ASYMP_CHR_POS]),
+		&(testingInputs->HIVBackgroundReturnProb[HIV_EXT_INF_SYMP_CHR_POS]),
+		&(testingInputs->HIVBackgroundReturnProb[HIV_EXT_INF_ACUTE_SYN])
 	);
 	readAndSkipPast( "HIVtestBgPosProb", inputFile );
-	fscanf( inputFile, "%lf %lf %lf %lf %lf",
-		&(testingInputs.HIVBackgroundPositiveProb[HIV_EXT_INF_NEG_HI]),
-		&(testingInputs.HIVBackgroundPositiveProb[HIV_EXT_INF_NEG_LO]),
-		&(testingInputs.HIVBackgroundPositiveProb[HIV_EXT_INF_ASYMP_CHR_POS]),
-		&(testingInputs.HIVBackgroundPositiveProb[HIV_EXT_INF_SYMP_CHR_POS]),
-		&(testingInputs.HIVBackgroundPositiveProb[HIV_EXT_INF_ACUTE_SYN])
+	inputFile->scan( "%lf %lf %lf %lf %lf",
+		&(testingInputs->HIVBackgroundPositiveProb[HIV_EXT_INF_NEG_HI]),
+		&(testingInputs->HIVBackgroundPositiveProb[HIV_EXT_INF_NEG_LO]),
+		&(testingInputs->HIVBackgroundPositiveProb[HIV_EXT_INF_ASYMP_CHR_POS]),
+		&(testingInputs->HIVBackgroundPositiveProb[HIV_EXT_INF_SYMP_CHR_POS]),
+		&(testingInputs->HIVBackgroundPositiveProb[HIV_EXT_INF_ACUTE_SYN])
 	);
 	readAndSkipPast( "HIVtestBgTestCost", inputFile );
-	fscanf( inputFile, "%lf %lf %lf %lf %lf",
-		&(testingInputs.HIVBackgroundTestCost[HIV_EXT_INF_NEG_HI]),
-		&(testingInputs.HIVBackgroundTestCost[HIV_EXT_INF_NEG_LO]),
-		&(testingInputs.HIVBackgroundTestCost[HIV_EXT_INF_ASYMP_CHR_POS]),
-		&(testingInputs.HIVBackgroundTestCost[HIV_EXT_INF_SYMP_CHR_POS]),
-		&(testingInputs.HIVBackgroundTestCost[HIV_EXT_INF_ACUTE_SYN])
+	inputFile->scan( "%lf %lf %lf %lf %lf",
+		&(testingInputs->HIVBackgroundTestCost[HIV_EXT_INF_NEG_HI]),
+		&(testingInputs->HIVBackgroundTestCost[HIV_EXT_INF_NEG_LO]),
+		&(testingInputs->HIVBackgroundTestCost[HIV_EXT_INF_ASYMP_CHR_POS]),
+		&(testingInputs->HIVBackgroundTestCost[HIV_EXT_INF_SYMP_CHR_POS]),
+		&(testingInputs->HIVBackgroundTestCost[HIV_EXT_INF_ACUTE_SYN])
 	);
 	readAndSkipPast( "HIVtestBgTestPosCost", inputFile );
-	fscanf( inputFile, "%lf %lf %lf %lf %lf",
-		&(testingInputs.HIVBackgroundPositiveCost[HIV_EXT_INF_NEG_HI]),
-		&(testingInputs.HIVBackgroundPositiveCost[HIV_EXT_INF_NEG_LO]),
-		&(testingInputs.HIVBackgroundPositiveCost[HIV_EXT_INF_ASYMP_CHR_POS]),
-		&(testingInputs.HIVBackgroundPositiveCost[HIV_EXT_INF_SYMP_CHR_POS]),
-		&(testingInputs.HIVBackgroundPositiveCost[HIV_EXT_INF_ACUTE_SYN])
+	inputFile->scan( "%lf %lf %lf %lf %lf",
+		&(testingInputs->HIVBackgroundPositiveCost[HIV_EXT_INF_NEG_HI]),
+		&(testingInputs->HIVBackgroundPositiveCost[HIV_EXT_INF_NEG_LO]),
+		&(testingInputs->HIVBackgroundPositiveCost[HIV_EXT_INF_ASYMP_CHR_POS]),
+		&(testingInputs->HIVBackgroundPositiveCost[HIV_EXT_INF_SYMP_CHR_POS]),
+		&(testingInputs->HIVBackgroundPositiveCost[HIV_EXT_INF_ACUTE_SYN])
 	);
 	readAndSkipPast( "HIVtestBgTestNegCost", inputFile );
-	fscanf( inputFile, "%lf %lf %lf %lf %lf",
-		&(testingInputs.HIVBackgroundNegativeCost[HIV_EXT_INF_NEG_HI]),
-		&(testingInputs.HIVBackgroundNegativeCost[HIV_EXT_INF_NEG_LO]),
-		&(testingInputs.HIVBackgroundNegativeCost[HIV_EXT_INF_ASYMP_CHR_POS]),
-		&(testingInputs.HIVBackgroundNegativeCost[HIV_EXT_INF_SYMP_CHR_POS]),
-		&(testingInputs.HIVBackgroundNegativeCost[HIV_EXT_INF_ACUTE_SYN])
+	inputFile->scan( "%lf %lf %lf %lf %lf",
+		&(testingInputs->HIVBackgroundNegativeCost[HIV_EXT_INF_NEG_HI]),
+		&(testingInputs->HIVBackgroundNegativeCost[HIV_EXT_INF_NEG_LO]),
+		&(testingInputs->HIVBackgroundNegativeCost[HIV_EXT_INF_ASYMP_CHR_POS]),
+		&(testingInputs->HIVBackgroundNegativeCost[HIV_EXT_INF_SYMP_CHR_POS]),
+		&(testingInputs->HIVBackgroundNegativeCost[HIV_EXT_INF_ACUTE_SYN])
 	);
 
 	readAndSkipPast( "HIVtestBgStartAge", inputFile );
-	fscanf( inputFile, "%d",&(testingInputs.HIVBackgroundStartAge));
+	inputFile->scan( "%d",&(testingInputs->HIVBackgroundStartAge));
 	readAndSkipPast( "HIVtestBgProbLink", inputFile );
-	fscanf( inputFile, "%lf",&(testingInputs.HIVBackgroundProbLinkage));
+	inputFile->scan( "%lf",&(testingInputs->HIVBackgroundProbLinkage));
 	
 	// read in inputs common to both user-defined and background HIV tests
 	readAndSkipPast( "HIVtestDetectCost", inputFile );
-	fscanf( inputFile, "%lf %lf %lf",
-		&(testingInputs.HIVTestDetectionCost[HIV_POS_ASYMP_CHR_POS]),
-		&(testingInputs.HIVTestDetectionCost[HIV_POS_SYMP_CHR_POS]),
-		&(testingInputs.HIVTestDetectionCost[HIV_POS_ACUTE_SYN]) );
+	inputFile->scan( "%lf %lf %lf",
+		&(testingInputs->HIVTestDetectionCost[HIV_POS_ASYMP_CHR_POS]),
+		&(testingInputs->HIVTestDetectionCost[HIV_POS_SYMP_CHR_POS]),
+		&(testingInputs->HIVTestDetectionCost[HIV_POS_ACUTE_SYN]) );
 
 	// read in PrEP inputs
 	readAndSkipPast( "PrEPDropoutThreshold", inputFile );
-	fscanf( inputFile, "%d", &(testingInputs.PrEPDropoutThreshold));
+	inputFile->scan( "%d", &(testingInputs->PrEPDropoutThreshold));
 	readAndSkipPast( "DropoutThresholdRefPrEPStart", inputFile );
-	fscanf( inputFile, "%d", &tempBool);
-	testingInputs.dropoutThresholdFromPrEPStart = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool);
+	testingInputs->dropoutThresholdFromPrEPStart = (bool) tempBool;
 	readAndSkipPast( "PrEPHIVtestAcceptProb", inputFile );
 	for (i = 0; i < HIV_BEHAV_NUM; ++i)
-		fscanf( inputFile, "%lf", &(testingInputs.PrEPHIVTestAcceptProb[i]));
+		inputFile->scan( "%lf", &(testingInputs->PrEPHIVTestAcceptProb[i]));
 	readAndSkipPast( "PrEPInitDist", inputFile );
 	for (i = 0; i < HIV_BEHAV_NUM; ++i)
-		fscanf( inputFile, "%lf", &(testingInputs.PrEPInitialDistribution[i]));
+		inputFile->scan( "%lf", &(testingInputs->PrEPInitialDistribution[i]));
 	
 	readAndSkipPast( "PrEPJoinAfterRollout", inputFile );
 	for (i = 0; i < HIV_BEHAV_NUM; ++i){
-		fscanf( inputFile, "%d", &tempBool);
-		testingInputs.PrEPAfterRollout[i] = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		testingInputs->PrEPAfterRollout[i] = (bool) tempBool;
 	}
 	readAndSkipPast( "PrEPDropoutPreThreshold", inputFile );
 	for (i = 0; i < HIV_BEHAV_NUM; ++i)
-		fscanf( inputFile, "%lf", &(testingInputs.PrEPDropoutPreThreshold[i]));
+		inputFile->scan( "%lf", &(testingInputs->PrEPDropoutPreThreshold[i]));
 	readAndSkipPast( "PrEPDropoutPostThreshold", inputFile );
 	for (i = 0; i < HIV_BEHAV_NUM; ++i)
-		fscanf( inputFile, "%lf", &(testingInputs.PrEPDropoutPostThreshold[i]));	
+		inputFile->scan( "%lf", &(testingInputs->PrEPDropoutPostThreshold[i]));	
 	readAndSkipPast( "PrEPCoverage", inputFile );
 	for (i = 0; i < HIV_BEHAV_NUM; ++i)
-		fscanf( inputFile, "%lf", &(testingInputs.PrEPCoverage[i]));
+		inputFile->scan( "%lf", &(testingInputs->PrEPCoverage[i]));
 	readAndSkipPast( "PrEPDuration", inputFile );
 	for (i = 0; i < HIV_BEHAV_NUM; ++i)
-		fscanf( inputFile, "%d", &(testingInputs.PrEPRolloutDuration[i]));
+		inputFile->scan( "%d", &(testingInputs->PrEPRolloutDuration[i]));
 	readAndSkipPast( "PrEPShape", inputFile );
 	for (i = 0; i < HIV_BEHAV_NUM; ++i)
-		fscanf( inputFile, "%lf", &(testingInputs.PrEPShape[i]));
+		inputFile->scan( "%lf", &(testingInputs->PrEPShape[i]));
 	
     readAndSkipPast( "PrEPStartupCost", inputFile );
 	for (i = 0; i < HIV_BEHAV_NUM; ++i)
-		fscanf( inputFile, "%lf", &(testingInputs.costPrEPInitial[i]));
+		inputFile->scan( "%lf", &(testingInputs->costPrEPInitial[i]));
     readAndSkipPast( "PrEPMonthlyCost", inputFile );
 	for (i = 0; i < HIV_BEHAV_NUM; ++i)
-		fscanf( inputFile, "%lf", &(testingInputs.costPrEPMonthly[i]));
+		inputFile->scan( "%lf", &(testingInputs->costPrEPMonthly[i]));
 	readAndSkipPast( "PrEPQoLMod", inputFile );
 	for (i = 0; i < HIV_BEHAV_NUM; ++i)
-		fscanf( inputFile, "%lf", &(testingInputs.PrEPQOL[i]));
+		inputFile->scan( "%lf", &(testingInputs->PrEPQOL[i]));
 
 	readAndSkipPast( "PrepIncidMale", inputFile );
 	readAndSkipPast( "hiRisk", inputFile );
 	for (i = 0; i < AGE_CAT_HIV_INC; ++i) {
-		fscanf( inputFile, "%lf", &(testingInputs.PrEPIncidence[GENDER_MALE][i][HIV_BEHAV_HI]));
+		inputFile->scan( "%lf", &(testingInputs->PrEPIncidence[GENDER_MALE][i][HIV_BEHAV_HI]));
 	}
 	readAndSkipPast( "PrepIncidMale", inputFile );
 	readAndSkipPast( "loRisk", inputFile );
 	for (i = 0; i < AGE_CAT_HIV_INC; ++i) {
-		fscanf( inputFile, "%lf", &(testingInputs.PrEPIncidence[GENDER_MALE][i][HIV_BEHAV_LO]));
+		inputFile->scan( "%lf", &(testingInputs->PrEPIncidence[GENDER_MALE][i][HIV_BEHAV_LO]));
 	}
 	readAndSkipPast( "PrepIncidFemale", inputFile );
 	readAndSkipPast( "hiRisk", inputFile );
 	for (i = 0; i < AGE_CAT_HIV_INC; ++i) {
-		fscanf( inputFile, "%lf", &(testingInputs.PrEPIncidence[GENDER_FEMALE][i][HIV_BEHAV_HI]));
+		inputFile->scan( "%lf", &(testingInputs->PrEPIncidence[GENDER_FEMALE][i][HIV_BEHAV_HI]));
 	}
 	readAndSkipPast( "PrepIncidFemale", inputFile );
 	readAndSkipPast( "loRisk", inputFile );
 	for (i = 0; i < AGE_CAT_HIV_INC; ++i) {
-		fscanf( inputFile, "%lf", &(testingInputs.PrEPIncidence[GENDER_FEMALE][i][HIV_BEHAV_LO]));
+		inputFile->scan( "%lf", &(testingInputs->PrEPIncidence[GENDER_FEMALE][i][HIV_BEHAV_LO]));
 	}
 
 	//Read in Lab Staging (CD4) characteristics
 	readAndSkipPast( "CD4TestAcceptProb", inputFile );
-	fscanf( inputFile, "%lf %lf %lf",
-			&(testingInputs.CD4TestAcceptProb[HIV_POS_ASYMP_CHR_POS]),
-			&(testingInputs.CD4TestAcceptProb[HIV_POS_SYMP_CHR_POS]),
-			&(testingInputs.CD4TestAcceptProb[HIV_POS_ACUTE_SYN]));
+	inputFile->scan( "%lf %lf %lf",
+			&(testingInputs->CD4TestAcceptProb[HIV_POS_ASYMP_CHR_POS]),
+			&(testingInputs->CD4TestAcceptProb[HIV_POS_SYMP_CHR_POS]),
+			&(testingInputs->CD4TestAcceptProb[HIV_POS_ACUTE_SYN]));
 	readAndSkipPast( "CD4TestRetProb", inputFile );
-	fscanf( inputFile, "%lf %lf %lf",
-			&(testingInputs.CD4TestReturnProb[HIV_POS_ASYMP_CHR_POS]),
-			&(testingInputs.CD4TestReturnProb[HIV_POS_SYMP_CHR_POS]),
-			&(testingInputs.CD4TestReturnProb[HIV_POS_ACUTE_SYN]));
+	inputFile->scan( "%lf %lf %lf",
+			&(testingInputs->CD4TestReturnProb[HIV_POS_ASYMP_CHR_POS]),
+			&(testingInputs->CD4TestReturnProb[HIV_POS_SYMP_CHR_POS]),
+			&(testingInputs->CD4TestReturnProb[HIV_POS_ACUTE_SYN]));
 	readAndSkipPast( "CD4TestStartupCost", inputFile );
-	fscanf( inputFile, "%lf %lf %lf",
-			&(testingInputs.CD4TestInitialCost[HIV_POS_ASYMP_CHR_POS]),
-			&(testingInputs.CD4TestInitialCost[HIV_POS_SYMP_CHR_POS]),
-			&(testingInputs.CD4TestInitialCost[HIV_POS_ACUTE_SYN]));
+	inputFile->scan( "%lf %lf %lf",
+			&(testingInputs->CD4TestInitialCost[HIV_POS_ASYMP_CHR_POS]),
+			&(testingInputs->CD4TestInitialCost[HIV_POS_SYMP_CHR_POS]),
+			&(testingInputs->CD4TestInitialCost[HIV_POS_ACUTE_SYN]));
 	readAndSkipPast( "CD4TestCost", inputFile );
-	fscanf( inputFile, "%lf %lf %lf",
-			&(testingInputs.CD4TestCost[HIV_POS_ASYMP_CHR_POS]),
-			&(testingInputs.CD4TestCost[HIV_POS_SYMP_CHR_POS]),
-			&(testingInputs.CD4TestCost[HIV_POS_ACUTE_SYN]));
+	inputFile->scan( "%lf %lf %lf",
+			&(testingInputs->CD4TestCost[HIV_POS_ASYMP_CHR_POS]),
+			&(testingInputs->CD4TestCost[HIV_POS_SYMP_CHR_POS]),
+			&(testingInputs->CD4TestCost[HIV_POS_ACUTE_SYN]));
 	readAndSkipPast( "CD4TestNonRetCost", inputFile );
-	fscanf( inputFile, "%lf %lf %lf",
-			&(testingInputs.CD4TestNonReturnCost[HIV_POS_ASYMP_CHR_POS]),
-			&(testingInputs.CD4TestNonReturnCost[HIV_POS_SYMP_CHR_POS]),
-			&(testingInputs.CD4TestNonReturnCost[HIV_POS_ACUTE_SYN]));
+	inputFile->scan( "%lf %lf %lf",
+			&(testingInputs->CD4TestNonReturnCost[HIV_POS_ASYMP_CHR_POS]),
+			&(testingInputs->CD4TestNonReturnCost[HIV_POS_SYMP_CHR_POS]),
+			&(testingInputs->CD4TestNonReturnCost[HIV_POS_ACUTE_SYN]));
 	readAndSkipPast( "CD4TestRetCost", inputFile );
-	fscanf( inputFile, "%lf %lf %lf",
-			&(testingInputs.CD4TestReturnCost[HIV_POS_ASYMP_CHR_POS]),
-			&(testingInputs.CD4TestReturnCost[HIV_POS_SYMP_CHR_POS]),
-			&(testingInputs.CD4TestReturnCost[HIV_POS_ACUTE_SYN]));
+	inputFile->scan( "%lf %lf %lf",
+			&(testingInputs->CD4TestReturnCost[HIV_POS_ASYMP_CHR_POS]),
+			&(testingInputs->CD4TestReturnCost[HIV_POS_SYMP_CHR_POS]),
+			&(testingInputs->CD4TestReturnCost[HIV_POS_ACUTE_SYN]));
 	readAndSkipPast( "LabStageStdDev", inputFile );
-	fscanf( inputFile, "%lf", &(testingInputs.CD4TestStdDevPercentage));
+	inputFile->scan( "%lf", &(testingInputs->CD4TestStdDevPercentage));
 	readAndSkipPast( "LabStageBiasMean", inputFile );
-	fscanf( inputFile, "%lf", &(testingInputs.CD4TestBiasMean));
+	inputFile->scan( "%lf", &(testingInputs->CD4TestBiasMean));
 	readAndSkipPast( "LabStageBiasStdDevPerc", inputFile );
-	fscanf( inputFile, "%lf", &(testingInputs.CD4TestBiasStdDevPercentage));
+	inputFile->scan( "%lf", &(testingInputs->CD4TestBiasStdDevPercentage));
 
 	//Read Lab Staging Linkage probabilities
 	readAndSkipPast( "CD4TestLinkProb", inputFile );
 	for (i=CD4_NUM_STRATA-1; i >= 0; i--){
-		fscanf( inputFile, "%lf", &(testingInputs.CD4TestLinkageProb[i]));
+		inputFile->scan( "%lf", &(testingInputs->CD4TestLinkageProb[i]));
 	}
 } /* end readHIVTestInputs */
 
 /* readPedsInputs reads data from the Peds tab of the input sheet */
-void SimContext::readPedsInputs() {
+void SimContext::readPedsInputs(InputReader *inputFile) {
 	int i, j, k,tempBool;
 	int tempInt;
 	char scratch[256];
 
 	// read in enable pediatrics module, initial HIV state, and BF status
 	readAndSkipPast("EnablePeds", inputFile);
-	fscanf(inputFile, "%d", &tempBool);
-	pedsInputs.enablePediatricsModel = (bool) tempBool;
+	inputFile->scan("%d", &tempBool);
+	pedsInputs->enablePediatricsModel = (bool) tempBool;
+	pedsInputs->isTabSkipped = !pedsInputs->enablePediatricsModel && skipDisabledTab(&SimContext::readPedsInputs, inputFile);
+	if (pedsInputs->isTabSkipped)
+		return;
 
 	// read in initial age (mths) distrib
 	readAndSkipPast( "InitAgePeds", inputFile );
-	fscanf(inputFile,"%lf %lf", &pedsInputs.initialAgeMean, &pedsInputs.initialAgeStdDev);
+	inputFile->scan("%lf %lf", &pedsInputs->initialAgeMean, &pedsInputs->initialAgeStdDev);
 
 	//read in maternal characteristics
 	readAndSkipPast( "DistMatStat", inputFile );
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-		fscanf(inputFile,"%lf", &pedsInputs.maternalStatusDistribution[i]);
+		inputFile->scan("%lf", &pedsInputs->maternalStatusDistribution[i]);
 	readAndSkipPast( "ProbInfectionMom", inputFile );
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-		fscanf(inputFile,"%lf", &pedsInputs.probMotherIncidentInfection[i]);
+		inputFile->scan("%lf", &pedsInputs->probMotherIncidentInfection[i]);
 	readAndSkipPast( "ProbMatMort", inputFile );
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-		fscanf(inputFile,"%lf", &pedsInputs.probMaternalDeath[i]);
+		inputFile->scan("%lf", &pedsInputs->probMaternalDeath[i]);
 
 	readAndSkipPast( "ProbMatStatKnown", inputFile );
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-		fscanf(inputFile,"%lf", &pedsInputs.probMotherStatusKnownPregnancy[i]);
+		inputFile->scan("%lf", &pedsInputs->probMotherStatusKnownPregnancy[i]);
 	readAndSkipPast( "ProbMatStatKnownBF", inputFile );
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-		fscanf(inputFile,"%lf", &pedsInputs.probMotherStatusBecomeKnown[i]);
+		inputFile->scan("%lf", &pedsInputs->probMotherStatusBecomeKnown[i]);
 	readAndSkipPast( "ProbMomOnARTPreg", inputFile );
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-		fscanf(inputFile,"%lf", &pedsInputs.probMotherOnARTInitial[i]);
+		inputFile->scan("%lf", &pedsInputs->probMotherOnARTInitial[i]);
 	readAndSkipPast( "ProbMomSuppressed", inputFile );
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-		fscanf(inputFile,"%lf", &pedsInputs.probMotherOnSuppressedART[i]);
+		inputFile->scan("%lf", &pedsInputs->probMotherOnSuppressedART[i]);
 
 	readAndSkipPast( "ProbMomKnownSuppressed", inputFile );
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-		fscanf(inputFile,"%lf", &pedsInputs.probMotherKnownSuppressed[i]);
+		inputFile->scan("%lf", &pedsInputs->probMotherKnownSuppressed[i]);
 	readAndSkipPast( "ProbMomKnownNotSuppressed", inputFile );
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-		fscanf(inputFile,"%lf", &pedsInputs.probMotherKnownNotSuppressed[i]);
+		inputFile->scan("%lf", &pedsInputs->probMotherKnownNotSuppressed[i]);
 	readAndSkipPast( "ProbMomLowHVL", inputFile );
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-		fscanf(inputFile,"%lf", &pedsInputs.probMotherLowHVL[i]);
+		inputFile->scan("%lf", &pedsInputs->probMotherLowHVL[i]);
 
 	readAndSkipPast( "DistEarlyVTHIVIU", inputFile );
-	fscanf(inputFile,"%lf", &pedsInputs.propEarlyVTHIVIU);
+	inputFile->scan("%lf", &pedsInputs->propEarlyVTHIVIU);
 
 	readAndSkipPast2( "ProbEarlyVTHIVOnART", "Suppressed", inputFile );
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-		fscanf(inputFile,"%lf", &pedsInputs.earlyVTHIVDistributionMotherOnArtSuppressed[i]);
+		inputFile->scan("%lf", &pedsInputs->earlyVTHIVDistributionMotherOnArtSuppressed[i]);
 	readAndSkipPast2( "ProbEarlyVTHIVOnART", "NotSuppressedLowHVL", inputFile );
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-		fscanf(inputFile,"%lf", &pedsInputs.earlyVTHIVDistributionMotherOnArtNotSuppressedLowHVL[i]);
+		inputFile->scan("%lf", &pedsInputs->earlyVTHIVDistributionMotherOnArtNotSuppressedLowHVL[i]);
 	readAndSkipPast2( "ProbEarlyVTHIVOnART", "NotSuppressedHighHVL", inputFile );
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-		fscanf(inputFile,"%lf", &pedsInputs.earlyVTHIVDistributionMotherOnArtNotSuppressedHighHVL[i]);
+		inputFile->scan("%lf", &pedsInputs->earlyVTHIVDistributionMotherOnArtNotSuppressedHighHVL[i]);
 	readAndSkipPast( "ProbEarlyVTHIVOffART", inputFile );
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-		fscanf(inputFile,"%lf", &pedsInputs.earlyVTHIVDistributionMotherOffArt[i]);
+		inputFile->scan("%lf", &pedsInputs->earlyVTHIVDistributionMotherOffArt[i]);
 
 	readAndSkipPast2("ProbPPVTHIVOnART", "Suppressed", inputFile);
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-		fscanf(inputFile,"%lf", &pedsInputs.probVTHIVPPMotherOnARTSuppressed[i]);
+		inputFile->scan("%lf", &pedsInputs->probVTHIVPPMotherOnARTSuppressed[i]);
 	readAndSkipPast2("ProbPPVTHIVOnART", "NotSuppressedLowHVL", inputFile);
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-		fscanf(inputFile,"%lf", &pedsInputs.probVTHIVPPMotherOnARTNotSuppressedLowHVL[i]);
+		inputFile->scan("%lf", &pedsInputs->probVTHIVPPMotherOnARTNotSuppressedLowHVL[i]);
 	readAndSkipPast2("ProbPPVTHIVOnART", "NotSuppressedHighHVL", inputFile);
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-		fscanf(inputFile,"%lf", &pedsInputs.probVTHIVPPMotherOnARTNotSuppressedHighHVL[i]);
+		inputFile->scan("%lf", &pedsInputs->probVTHIVPPMotherOnARTNotSuppressedHighHVL[i]);
 
 	readAndSkipPast2("ProbPPVTHIVOffART", "EBF", inputFile);
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++){
-		fscanf(inputFile,"%lf", &pedsInputs.probVTHIVPPMotherOffART[i][PEDS_BF_EXCL]);
+		inputFile->scan("%lf", &pedsInputs->probVTHIVPPMotherOffART[i][PEDS_BF_EXCL]);
 	}
 	readAndSkipPast2("ProbPPVTHIVOffART", "MBF", inputFile);
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++){
-		fscanf(inputFile,"%lf", &pedsInputs.probVTHIVPPMotherOffART[i][PEDS_BF_MIXED]);
+		inputFile->scan("%lf", &pedsInputs->probVTHIVPPMotherOffART[i][PEDS_BF_MIXED]);
 	}
 	readAndSkipPast2("ProbPPVTHIVOffART", "CBF", inputFile);
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++){
-		fscanf(inputFile,"%lf", &pedsInputs.probVTHIVPPMotherOffART[i][PEDS_BF_COMP]);
+		inputFile->scan("%lf", &pedsInputs->probVTHIVPPMotherOffART[i][PEDS_BF_COMP]);
 	}
 	for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++){
-		pedsInputs.probVTHIVPPMotherOffART[i][PEDS_BF_REPL] = 0.0;
+		pedsInputs->probVTHIVPPMotherOffART[i][PEDS_BF_REPL] = 0.0;
 	}
 
 	readAndSkipPast("BreastfedDist", inputFile);
-	fscanf(inputFile, "%lf", &(pedsInputs.initialBFDistribution[PEDS_BF_EXCL]));
-	fscanf(inputFile, "%lf", &(pedsInputs.initialBFDistribution[PEDS_BF_MIXED]));
-	pedsInputs.initialBFDistribution[PEDS_BF_COMP] = 0.0;
-	pedsInputs.initialBFDistribution[PEDS_BF_REPL] = 1 - pedsInputs.initialBFDistribution[PEDS_BF_EXCL] - pedsInputs.initialBFDistribution[PEDS_BF_MIXED];
+	inputFile->scan("%lf", &(pedsInputs->initialBFDistribution[PEDS_BF_EXCL]));
+	inputFile->scan("%lf", &(pedsInputs->initialBFDistribution[PEDS_BF_MIXED]));
+	pedsInputs->initialBFDistribution[PEDS_BF_COMP] = 0.0;
+	pedsInputs->initialBFDistribution[PEDS_BF_REPL] = 1 - pedsInputs->initialBFDistribution[PEDS_BF_EXCL] - pedsInputs->initialBFDistribution[PEDS_BF_MIXED];
 
 	readAndSkipPast("BreastfedStopAge", inputFile);
-	fscanf(inputFile, " %lf %lf %lf", &(pedsInputs.initialBFStopAgeMean), &(pedsInputs.initialBFStopAgeStdDev), &(pedsInputs.initialBFStopAgeMax));
+	inputFile->scan(" %lf %lf %lf", &(pedsInputs->initialBFStopAgeMean), &(pedsInputs->initialBFStopAgeStdDev), &(pedsInputs->initialBFStopAgeMax));
 
 	readAndSkipPast("ProbStopBFWhenVSKnownNotSuppressedLowHVL", inputFile);
-	fscanf(inputFile, "%lf", &(pedsInputs.probStopBFNotSuppressedLowHVL));
+	inputFile->scan("%lf", &(pedsInputs->probStopBFNotSuppressedLowHVL));
 	readAndSkipPast("ProbStopBFWhenVSKnownNotSuppressedHighHVL", inputFile);
-	fscanf(inputFile, "%lf", &(pedsInputs.probStopBFNotSuppressedHighHVL));
+	inputFile->scan("%lf", &(pedsInputs->probStopBFNotSuppressedHighHVL));
 
 	// read in initial CD4 percentage
 	readAndSkipPast("InitCD4PercPrevIU", inputFile);
-	fscanf(inputFile, "%lf %lf", &(pedsInputs.initialCD4PercentageIUMean),
-			&(pedsInputs.initialCD4PercentageIUStdDev));
+	inputFile->scan("%lf %lf", &(pedsInputs->initialCD4PercentageIUMean),
+			&(pedsInputs->initialCD4PercentageIUStdDev));
 	readAndSkipPast("InitCD4PercPrevIP", inputFile);
-	fscanf(inputFile, "%lf %lf", &(pedsInputs.initialCD4PercentageIPMean),
-			&(pedsInputs.initialCD4PercentageIPStdDev));
+	inputFile->scan("%lf %lf", &(pedsInputs->initialCD4PercentageIPMean),
+			&(pedsInputs->initialCD4PercentageIPStdDev));
 	for (i = 0; i < PEDS_AGE_INFANT_NUM-1; i++) {
 		readAndSkipPast2("InitCD4PercIncidPP", PEDS_AGE_CAT_STRS[i], inputFile);
-		fscanf(inputFile, "%lf %lf", &(pedsInputs.initialCD4PercentagePPMean[i]),
-				&(pedsInputs.initialCD4PercentagePPStdDev[i]));
+		inputFile->scan("%lf %lf", &(pedsInputs->initialCD4PercentagePPMean[i]),
+				&(pedsInputs->initialCD4PercentagePPStdDev[i]));
 	}
 	// last infant age cat covers 18 months and up for PP infections
 	readAndSkipPast2("InitCD4PercIncidPP", "18+mth", inputFile);
-	fscanf(inputFile, "%lf %lf", &(pedsInputs.initialCD4PercentagePPMean[PEDS_AGE_INFANT_NUM-1]),
-	&(pedsInputs.initialCD4PercentagePPStdDev[PEDS_AGE_INFANT_NUM-1]));
+	inputFile->scan("%lf %lf", &(pedsInputs->initialCD4PercentagePPMean[PEDS_AGE_INFANT_NUM-1]),
+	&(pedsInputs->initialCD4PercentagePPStdDev[PEDS_AGE_INFANT_NUM-1]));
 
 	// read in initial HVL strata
 	readAndSkipPast("InitHVLPrevIU", inputFile);
 	for (j = HVL_NUM_STRATA - 1; j >= 0; j--) {
-		fscanf(inputFile, "%lf ", &(pedsInputs.initialHVLDistributionIU[j]));
+		inputFile->scan("%lf ", &(pedsInputs->initialHVLDistributionIU[j]));
 	}
 	readAndSkipPast("InitHVLPrevIP", inputFile);
 	for (j = HVL_NUM_STRATA - 1; j >= 0; j--) {
-		fscanf(inputFile, "%lf ", &(pedsInputs.initialHVLDistributionIP[j]));
+		inputFile->scan("%lf ", &(pedsInputs->initialHVLDistributionIP[j]));
 	}
 	for (i = 0; i < PEDS_AGE_INFANT_NUM-1; i++) {
 		readAndSkipPast2("InitHVLIncidPP", PEDS_AGE_CAT_STRS[i], inputFile);
 		for (j = HVL_NUM_STRATA - 1; j >= 0; j--) {
-			fscanf(inputFile, "%lf ", &(pedsInputs.initialHVLDistributionPP[i][j]));
+			inputFile->scan("%lf ", &(pedsInputs->initialHVLDistributionPP[i][j]));
 		}
 	}
 	// last infant age cat covers 18 months and up for PP infections
 	readAndSkipPast2("InitHVLIncidPP", "18+mth", inputFile);
 	for (j = HVL_NUM_STRATA - 1; j >= 0; j--) {
-		fscanf(inputFile, "%lf ", &(pedsInputs.initialHVLDistributionPP[PEDS_AGE_INFANT_NUM-1][j]));
+		inputFile->scan("%lf ", &(pedsInputs->initialHVLDistributionPP[PEDS_AGE_INFANT_NUM-1][j]));
 	}
 
 	// read in the mapping from age and CD4% to adult CD4 strata
 	for (i = 0; i < PEDS_AGE_EARLY_NUM; i++) {
 		readAndSkipPast2("AdultCD4Strata", PEDS_AGE_CAT_STRS[i], inputFile);
 		for (j = 0; j < PEDS_CD4_PERC_NUM; j++) {
-			fscanf(inputFile, "%d ", &tempInt);
-			pedsInputs.adultCD4Strata[i][j] = (CD4_STRATA) tempInt;
+			inputFile->scan("%d ", &tempInt);
+			pedsInputs->adultCD4Strata[i][j] = (CD4_STRATA) tempInt;
 		}
 	}
 
 	//read in post partum maternal ART distribution
 	readAndSkipPast("UsePPMaternalARTStatus", inputFile);
-	fscanf(inputFile, "%d", &tempBool);
-	pedsInputs.usePPMaternalARTStatus = (bool) tempBool;
+	inputFile->scan("%d", &tempBool);
+	pedsInputs->usePPMaternalARTStatus = (bool) tempBool;
 	readAndSkipPast2("PPMaternalARTStatusOnART", "Suppressed", inputFile);
 	for (i = 0; i < PEDS_PP_MATERNAL_ART_STATUS_NUM; i++)
-		fscanf(inputFile, "%lf ", &(pedsInputs.ppMaternalARTStatusProbSuppressed[i]));
+		inputFile->scan("%lf ", &(pedsInputs->ppMaternalARTStatusProbSuppressed[i]));
 	readAndSkipPast2("PPMaternalARTStatusOnART", "NotSuppressedLowHVL", inputFile);
 	for (i = 0; i < PEDS_PP_MATERNAL_ART_STATUS_NUM; i++)
-		fscanf(inputFile, "%lf ", &(pedsInputs.ppMaternalARTStatusProbNotSuppressedLowHVL[i]));
+		inputFile->scan("%lf ", &(pedsInputs->ppMaternalARTStatusProbNotSuppressedLowHVL[i]));
 	readAndSkipPast2("PPMaternalARTStatusOnART", "NotSuppressedHighHVL", inputFile);
 	for (i = 0; i < PEDS_PP_MATERNAL_ART_STATUS_NUM; i++)
-		fscanf(inputFile, "%lf ", &(pedsInputs.ppMaternalARTStatusProbNotSuppressedHighHVL[i]));
+		inputFile->scan("%lf ", &(pedsInputs->ppMaternalARTStatusProbNotSuppressedHighHVL[i]));
 	readAndSkipPast("PPMaternalARTStatusOffART", inputFile);
 	for (i = 0; i < PEDS_PP_MATERNAL_ART_STATUS_NUM; i++)
-		fscanf(inputFile, "%lf ", &(pedsInputs.ppMaternalARTStatusProbOffART[i]));
+		inputFile->scan("%lf ", &(pedsInputs->ppMaternalARTStatusProbOffART[i]));
 	readAndSkipPast("PPMaternalARTStatusVSKnown", inputFile);
 	for (i = 0; i < PEDS_PP_MATERNAL_ART_STATUS_NUM; i++)
-		fscanf(inputFile, "%lf ", &(pedsInputs.ppMaternalARTStatusProbSuppressionKnown[i]));
+		inputFile->scan("%lf ", &(pedsInputs->ppMaternalARTStatusProbSuppressionKnown[i]));
 
 
 	// read in the monthly natural history CD4% decline
 	for (i = 0; i < PEDS_AGE_EARLY_NUM; i++) {
 		readAndSkipPast2("CD4PercDeclinePrevIU", PEDS_AGE_CAT_STRS[i], inputFile);
 		for (j = 0; j < PEDS_CD4_PERC_NUM; j++) {
-			fscanf(inputFile, "%lf ", &(pedsInputs.monthlyCD4PercentDecline[PEDS_HIV_POS_IU][i][j]));
+			inputFile->scan("%lf ", &(pedsInputs->monthlyCD4PercentDecline[PEDS_HIV_POS_IU][i][j]));
 		}
 	}
 	for (i = 0; i < PEDS_AGE_EARLY_NUM; i++) {
 		readAndSkipPast2("CD4PercDeclinePrevIP", PEDS_AGE_CAT_STRS[i], inputFile);
 		for (j = 0; j < PEDS_CD4_PERC_NUM; j++) {
-			fscanf(inputFile, "%lf ", &(pedsInputs.monthlyCD4PercentDecline[PEDS_HIV_POS_IP][i][j]));
+			inputFile->scan("%lf ", &(pedsInputs->monthlyCD4PercentDecline[PEDS_HIV_POS_IP][i][j]));
 		}
 	}
 	for (i = 0; i < PEDS_AGE_EARLY_NUM; i++) {
 		readAndSkipPast2("CD4PercDeclineIncidPP", PEDS_AGE_CAT_STRS[i], inputFile);
 		for (j = 0; j < PEDS_CD4_PERC_NUM; j++) {
-			fscanf(inputFile, "%lf ", &(pedsInputs.monthlyCD4PercentDecline[PEDS_HIV_POS_PP][i][j]));
+			inputFile->scan("%lf ", &(pedsInputs->monthlyCD4PercentDecline[PEDS_HIV_POS_PP][i][j]));
 		}
 	}
 
 	// read in the transition from CD4% to absolute CD4
 	for (i = 0; i < PEDS_CD4_PERC_NUM; i++) {
 		readAndSkipPast2("CD4PercTransition", PEDS_CD4_PERC_STRS[i], inputFile);
-		fscanf(inputFile, "%lf %lf", &(pedsInputs.absoluteCD4TransitionMean[i]),
-				&(pedsInputs.absoluteCD4TransitionStdDev[i]));
+		inputFile->scan("%lf %lf", &(pedsInputs->absoluteCD4TransitionMean[i]),
+				&(pedsInputs->absoluteCD4TransitionStdDev[i]));
 	}
 
 	// read in the transition from childhood HVL to adult setpoint HVL
 	for (i = HVL_NUM_STRATA - 1; i >= 0; i--) {
 		readAndSkipPast2("HVLTransPeds", HVL_STRATA_STRS[i], inputFile);
 		for (j = HVL_NUM_STRATA - 1; j >= 0; j--) {
-			fscanf(inputFile, "%lf ", &(pedsInputs.setpointHVLTransition[i][j]));
+			inputFile->scan("%lf ", &(pedsInputs->setpointHVLTransition[i][j]));
 		}
 	}
 	
@@ -3917,65 +4847,65 @@ void SimContext::readPedsInputs() {
 	for (i = 0; i < PEDS_AGE_EARLY_NUM; i++) {
 		readAndSkipPast2("HIVDthRateRatio_PedsEarly", PEDS_AGE_CAT_STRS[i], inputFile);
 		for (j = 0; j < PEDS_CD4_PERC_NUM; j++) {
-			fscanf(inputFile, "%lf ", &(pedsInputs.HIVDeathRateRatioPedsEarly[i][j]));
+			inputFile->scan("%lf ", &(pedsInputs->HIVDeathRateRatioPedsEarly[i][j]));
 		}
 	}
 	
 	// read in HIV death rate ratios for late childhood
 	readAndSkipPast( "HIVDthRateRatio_PedsLate", inputFile );
 	for ( i = CD4_NUM_STRATA - 1; i >= 0; --i )
-		fscanf(inputFile, "%lf", &(pedsInputs.HIVDeathRateRatioPedsLate[i]));
+		inputFile->scan("%lf", &(pedsInputs->HIVDeathRateRatioPedsLate[i]));
 	
 	//read in the death rate ratios and durations for maternal mortality and replacement fed, for HIV negative and positive patients in early and late childhood
 	readAndSkipPast("MatMortDeathRateRatioEarly", inputFile);
-	fscanf(inputFile, "%lf %lf ", &(pedsInputs.maternalMortDeathRateRatioEarlyHIVNeg),&(pedsInputs.maternalMortDeathRateRatioEarlyHIVPos));
+	inputFile->scan("%lf %lf ", &(pedsInputs->maternalMortDeathRateRatioEarlyHIVNeg),&(pedsInputs->maternalMortDeathRateRatioEarlyHIVPos));
 	readAndSkipPast("MatMortDeathRateRatioDurationEarly", inputFile);
-	fscanf(inputFile, "%d ", &(pedsInputs.durationMaternalMortDeathRateRatioEarly));
+	inputFile->scan("%d ", &(pedsInputs->durationMaternalMortDeathRateRatioEarly));
 	readAndSkipPast("ReplFedDeathRateRatioEarly", inputFile);
-	fscanf(inputFile, "%lf %lf ", &(pedsInputs.replacementFedDeathRateRatioEarlyHIVNeg), &(pedsInputs.replacementFedDeathRateRatioEarlyHIVPos));
+	inputFile->scan("%lf %lf ", &(pedsInputs->replacementFedDeathRateRatioEarlyHIVNeg), &(pedsInputs->replacementFedDeathRateRatioEarlyHIVPos));
 	readAndSkipPast("ReplFedDeathRateRatioDurationEarly", inputFile);
-	fscanf(inputFile, "%d ", &(pedsInputs.durationReplacementFedDeathRateRatioEarly));
+	inputFile->scan("%d ", &(pedsInputs->durationReplacementFedDeathRateRatioEarly));
 	readAndSkipPast("MatMortDeathRateRatioLate", inputFile);
-	fscanf(inputFile, "%lf %lf ", &(pedsInputs.maternalMortDeathRateRatioLateHIVNeg),&(pedsInputs.maternalMortDeathRateRatioLateHIVPos));
+	inputFile->scan("%lf %lf ", &(pedsInputs->maternalMortDeathRateRatioLateHIVNeg),&(pedsInputs->maternalMortDeathRateRatioLateHIVPos));
 	readAndSkipPast("MatMortDeathRateRatioDurationLate", inputFile);
-	fscanf(inputFile, "%d ", &(pedsInputs.durationMaternalMortDeathRateRatioLate));
+	inputFile->scan("%d ", &(pedsInputs->durationMaternalMortDeathRateRatioLate));
 	
 	// read in the death rate ratios for the generic risk factors for all Peds age categories
 	for (i = 0; i<RISK_FACT_NUM; i++){
 		readAndSkipPast2( "GenRiskDthRateRatio_Peds", RISK_FACT_STRS[i], inputFile );
 		for(j = 0;j<PEDS_AGE_CHILD_NUM;j++){
-			fscanf( inputFile, "%lf", &pedsInputs.genericRiskDeathRateRatio[i][j]);
+			inputFile->scan( "%lf", &pedsInputs->genericRiskDeathRateRatio[i][j]);
 		}
 	}
 	
 	// read in the background death rates and exposed uninfected background death rates for early childhood; late childhood uses adult inputs from the NatHist tab
 	readAndSkipPast("BackgroundDthRate_MalePedsEarly", inputFile);
 	for (i = 0; i < PEDS_AGE_EARLY_NUM; i++) {
-		fscanf(inputFile, "%lf ", &(pedsInputs.backgroundDeathRateEarly[GENDER_MALE][i]));
+		inputFile->scan("%lf ", &(pedsInputs->backgroundDeathRateEarly[GENDER_MALE][i]));
 	}
 	readAndSkipPast("BackgroundDthRate_FemalePedsEarly", inputFile);
 	for (i = 0; i < PEDS_AGE_EARLY_NUM; i++) {
-		fscanf(inputFile, "%lf ", &(pedsInputs.backgroundDeathRateEarly[GENDER_FEMALE][i]));
+		inputFile->scan("%lf ", &(pedsInputs->backgroundDeathRateEarly[GENDER_FEMALE][i]));
 	}
 	readAndSkipPast("BackgroundDthRateExposed_MalePedsEarly", inputFile);
 	for (i = 0; i < PEDS_AGE_EARLY_NUM; i++) {
-		fscanf(inputFile, "%lf ", &(pedsInputs.backgroundDeathRateExposedUninfectedEarly[GENDER_MALE][i]));
+		inputFile->scan("%lf ", &(pedsInputs->backgroundDeathRateExposedUninfectedEarly[GENDER_MALE][i]));
 	}
 	readAndSkipPast("BackgroundDthRateExposed_FemalePedsEarly", inputFile);
 	for (i = 0; i < PEDS_AGE_EARLY_NUM; i++) {
-		fscanf(inputFile, "%lf ", &(pedsInputs.backgroundDeathRateExposedUninfectedEarly[GENDER_FEMALE][i]));
+		inputFile->scan("%lf ", &(pedsInputs->backgroundDeathRateExposedUninfectedEarly[GENDER_FEMALE][i]));
 	}
 	
 	// read in whether to use the exposed uninfected definitions
 	readAndSkipPast("UseExposedDefPeds", inputFile);
-	fscanf( inputFile, "%d", &tempBool);
-	pedsInputs.useExposedUninfectedDefs = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool);
+	pedsInputs->useExposedUninfectedDefs = (bool) tempBool;
 	
 	// read in the exposed uninfected definitions for the HEU death rate ratios
 	readAndSkipPast("ExposedDefEarly", inputFile);
 	for (i = 0; i < PEDS_EXPOSED_CONDITIONS_NUM; i++){
-		fscanf( inputFile, "%d", &tempBool);
-		pedsInputs.exposedUninfectedDefsEarly[i] = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		pedsInputs->exposedUninfectedDefsEarly[i] = (bool) tempBool;
 	}
 	
 	// read in the probability of acute OIs, for early and late childhood
@@ -3984,27 +4914,27 @@ void SimContext::readPedsInputs() {
 		for (j = 0; j < PEDS_AGE_EARLY_NUM; j++) {
 			readAndSkipPast2(scratch, PEDS_AGE_CAT_STRS[j], inputFile);
 			for (k = 0; k < PEDS_CD4_PERC_NUM; k++) {
-				fscanf(inputFile, "%lf ", &(pedsInputs.probAcuteOIEarly[i][j][k][HIST_N]));
+				inputFile->scan("%lf ", &(pedsInputs->probAcuteOIEarly[i][j][k][HIST_N]));
 			}
 		}
 		sprintf(scratch, "Prob_%s_WithHist", OI_STRS[i]);
 		for (j = 0; j < PEDS_AGE_EARLY_NUM; j++) {
 			readAndSkipPast2(scratch, PEDS_AGE_CAT_STRS[j], inputFile);
 			for (k = 0; k < PEDS_CD4_PERC_NUM; k++) {
-				fscanf(inputFile, "%lf ", &(pedsInputs.probAcuteOIEarly[i][j][k][HIST_Y]));
+				inputFile->scan("%lf ", &(pedsInputs->probAcuteOIEarly[i][j][k][HIST_Y]));
 			}
 		}
 	}
 	for (i = CD4_NUM_STRATA - 1; i >= 0; i--) {
 		readAndSkipPast2("ProbOIsNoHistLate", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < OI_NUM; j++) {
-			fscanf(inputFile, "%lf ", &(pedsInputs.probAcuteOILate[j][i][HIST_N]));
+			inputFile->scan("%lf ", &(pedsInputs->probAcuteOILate[j][i][HIST_N]));
 		}
 	}
 	for (i = CD4_NUM_STRATA - 1; i >= 0; i--) {
 		readAndSkipPast2("ProbOIsWithHistLate", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < OI_NUM; j++) {
-			fscanf(inputFile, "%lf ", &(pedsInputs.probAcuteOILate[j][i][HIST_Y]));
+			inputFile->scan("%lf ", &(pedsInputs->probAcuteOILate[j][i][HIST_Y]));
 		}
 	}
 	
@@ -4012,84 +4942,84 @@ void SimContext::readPedsInputs() {
 	for (i = 0; i < PEDS_CD4_PERC_NUM; i++) {
 		readAndSkipPast2("AcuteOIDthRateRatio_PedsEarly", PEDS_CD4_PERC_STRS[i], inputFile);
 		for (j = 0; j < PEDS_AGE_EARLY_NUM; j++) {
-			fscanf(inputFile, "%lf ", &(pedsInputs.acuteOIDeathRateRatioPedsEarly[i][j]));
+			inputFile->scan("%lf ", &(pedsInputs->acuteOIDeathRateRatioPedsEarly[i][j]));
 		}
 	}
 	for (i = 0; i < PEDS_CD4_PERC_NUM; i++) {
 		readAndSkipPast2("AcuteOIDthRateRatioTB_PedsEarly", PEDS_CD4_PERC_STRS[i], inputFile);
 		for (j = 0; j < PEDS_AGE_EARLY_NUM; j++) {
-			fscanf(inputFile, "%lf ", &(pedsInputs.acuteOIDeathRateRatioTBPedsEarly[i][j]));
+			inputFile->scan("%lf ", &(pedsInputs->acuteOIDeathRateRatioTBPedsEarly[i][j]));
 		}
 	}
 	// read in death rate ratios for having a history of a severe OI or TB modeled as a severe OI in early childhood, and their durations
 	readAndSkipPast("SevrOI_HistDthRateRatio_PedsEarly", inputFile);
 	for (i = 0; i < PEDS_AGE_EARLY_NUM; i++) 
-		fscanf(inputFile, "%lf ", &(pedsInputs.severeOIHistDeathRateRatioPedsEarly[i]));
+		inputFile->scan("%lf ", &(pedsInputs->severeOIHistDeathRateRatioPedsEarly[i]));
 	readAndSkipPast("SevrOI_HistEffectDuration_PedsEarly", inputFile);
-	fscanf(inputFile, "%d ", &(pedsInputs.severeOIHistEffectDurationPedsEarly));
+	inputFile->scan("%d ", &(pedsInputs->severeOIHistEffectDurationPedsEarly));
 	readAndSkipPast("TB_OI_HistDthRateRatio_PedsEarly", inputFile);
 	for (i = 0; i < PEDS_AGE_EARLY_NUM; i++) 
-		fscanf(inputFile, "%lf ", &(pedsInputs.TB_OIHistDeathRateRatioPedsEarly[i]));
+		inputFile->scan("%lf ", &(pedsInputs->TB_OIHistDeathRateRatioPedsEarly[i]));
 	readAndSkipPast("TB_OI_HistEffectDuration_PedsEarly", inputFile);
-	fscanf(inputFile, "%d ", &(pedsInputs.TB_OIHistEffectDurationPedsEarly));
+	inputFile->scan("%d ", &(pedsInputs->TB_OIHistEffectDurationPedsEarly));
 		
 	// read in death rate ratios for acute cases of severe OIs and TB modeled as a severe OI in late childhood
 	readAndSkipPast("AcuteOIDthRateRatio_PedsLate", inputFile);
 	for ( i = CD4_NUM_STRATA - 1; i >= 0; --i )
-		fscanf( inputFile, "%lf", &(pedsInputs.acuteOIDeathRateRatioPedsLate[i]));
+		inputFile->scan( "%lf", &(pedsInputs->acuteOIDeathRateRatioPedsLate[i]));
 	readAndSkipPast( "AcuteOIDthRateRatioTB_PedsLate", inputFile );
 	for ( i = CD4_NUM_STRATA - 1; i >= 0; --i )
-		fscanf( inputFile, "%lf", &(pedsInputs.acuteOIDeathRateRatioTBPedsLate[i]));
+		inputFile->scan( "%lf", &(pedsInputs->acuteOIDeathRateRatioTBPedsLate[i]));
 
 	// read in death rate ratios for having a history of a severe OI or TB modeled as a severe OI in late childhood, and their durations
 	readAndSkipPast( "SevrOI_HistDthRateRatio_PedsLate", inputFile);
-	fscanf( inputFile, "%lf", &(pedsInputs.severeOIHistDeathRateRatioPedsLate));
+	inputFile->scan( "%lf", &(pedsInputs->severeOIHistDeathRateRatioPedsLate));
 	readAndSkipPast( "SevrOI_HistEffectDuration_PedsLate", inputFile);
-	fscanf( inputFile, "%d", &(pedsInputs.severeOIHistEffectDurationPedsLate));
+	inputFile->scan( "%d", &(pedsInputs->severeOIHistEffectDurationPedsLate));
 	// read in death rate ratios for having a history of a severe OI or TB modeled as a severe OI in late childhood, and their durations
 	readAndSkipPast( "TB_OI_HistDthRateRatio_PedsLate", inputFile);
-	fscanf( inputFile, "%lf", &(pedsInputs.TB_OIHistDeathRateRatioPedsLate));
+	inputFile->scan( "%lf", &(pedsInputs->TB_OIHistDeathRateRatioPedsLate));
 	readAndSkipPast( "TB_OI_HistEffectDuration_PedsLate", inputFile);
-	fscanf( inputFile, "%d", &(pedsInputs.TB_OIHistEffectDurationPedsLate));
+	inputFile->scan( "%d", &(pedsInputs->TB_OIHistEffectDurationPedsLate));
 
 	// read in ART policies inputs
 	// read in maximum cd4 percentages and testing intervals
 	readAndSkipPast("MaxPedsCD4Perc", inputFile);
 	for (i = 0; i < PEDS_AGE_EARLY_NUM; i++) {
-		fscanf(inputFile, "%lf", &(pedsInputs.maxCD4Percentage[i]));
+		inputFile->scan("%lf", &(pedsInputs->maxCD4Percentage[i]));
 	}
 	readAndSkipPast("IntvlCD4TstPreARTPeds", inputFile);
-	fscanf(inputFile, "%d %d", &(pedsInputs.CD4TestingIntervalPreARTEarly),
-			&(pedsInputs.CD4TestingIntervalPreARTLate));
+	inputFile->scan("%d %d", &(pedsInputs->CD4TestingIntervalPreARTEarly),
+			&(pedsInputs->CD4TestingIntervalPreARTLate));
 	readAndSkipPast("IntvlHVLTstPreARTPeds", inputFile);
-	fscanf(inputFile, "%d %d", &(pedsInputs.HVLTestingIntervalPreARTEarly),
-			&(pedsInputs.HVLTestingIntervalPreARTLate));
+	inputFile->scan("%d %d", &(pedsInputs->HVLTestingIntervalPreARTEarly),
+			&(pedsInputs->HVLTestingIntervalPreARTLate));
 	
 	// read in the ART death rate ratios and their stage bounds for all Peds age categories
 	readAndSkipPast("MthStageARTDthRateRatioPeds", inputFile);
-	fscanf(inputFile, "%d %d", &(pedsInputs.stageBoundsARTDeathRateRatioPeds[0]),
-			&(pedsInputs.stageBoundsARTDeathRateRatioPeds[1]));
+	inputFile->scan("%d %d", &(pedsInputs->stageBoundsARTDeathRateRatioPeds[0]),
+			&(pedsInputs->stageBoundsARTDeathRateRatioPeds[1]));
 	for (i = 0; i < 3; i++) {
 		sprintf(scratch, "ARTDthRateRatio_Peds_T%d", i+1 );
 		readAndSkipPast(scratch, inputFile);
 		for(j = 0; j < PEDS_AGE_CHILD_NUM; j++){
-			fscanf(inputFile, "%lf", &(pedsInputs.ARTDeathRateRatio[j][i]));
+			inputFile->scan("%lf", &(pedsInputs->ARTDeathRateRatio[j][i]));
 		}
 	}
 	// read in ART effect rate multipliers for OIs
 	readAndSkipPast("MthStageRateMultOIsPedsEarly", inputFile);
-	fscanf(inputFile, "%d %d", &(pedsInputs.stageBoundsMonthlyOIProbOnARTMultEarly[0]),
-			&(pedsInputs.stageBoundsMonthlyOIProbOnARTMultEarly[1]));
+	inputFile->scan("%d %d", &(pedsInputs->stageBoundsMonthlyOIProbOnARTMultEarly[0]),
+			&(pedsInputs->stageBoundsMonthlyOIProbOnARTMultEarly[1]));
 	for (i = 0; i < PEDS_CD4_PERC_NUM; i++) {
 		readAndSkipPast2("RateMultOIsPedsEarly", PEDS_CD4_PERC_STRS[i], inputFile);
 		for (j = 0; j < 3; j++) {
-			fscanf(inputFile, "%lf", &(pedsInputs.monthlyOIProbOnARTMultEarly[i][j]));
+			inputFile->scan("%lf", &(pedsInputs->monthlyOIProbOnARTMultEarly[i][j]));
 		}
 	}
 	for (i = CD4_NUM_STRATA - 1; i >= 0; i--) {
 		readAndSkipPast2("RateMultOIsPedsLate", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < OI_NUM; j++) {
-			fscanf(inputFile, "%lf", &(pedsInputs.monthlyOIProbOnARTMultLate[i][j]));
+			inputFile->scan("%lf", &(pedsInputs->monthlyOIProbOnARTMultLate[i][j]));
 		}
 	}
 
@@ -4097,311 +5027,314 @@ void SimContext::readPedsInputs() {
 	readAndSkipPast( "PriProphStartPeds", inputFile );
 	readAndSkipPast( "agelwr", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.startProph[PROPH_PRIMARY].ageBounds[LOWER_BOUND][i]) );
+		inputFile->scan( "%lf", &(pedsInputs->startProph[PROPH_PRIMARY].ageBounds[LOWER_BOUND][i]) );
 	readAndSkipPast( "PriProphStartPeds", inputFile );
 	readAndSkipPast( "ageupp", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.startProph[PROPH_PRIMARY].ageBounds[UPPER_BOUND][i]) );
+		inputFile->scan( "%lf", &(pedsInputs->startProph[PROPH_PRIMARY].ageBounds[UPPER_BOUND][i]) );
 
 	readAndSkipPast( "PriProphStartPeds", inputFile );
 	readAndSkipPast( "cd4Percupp", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.startProph[PROPH_PRIMARY].currCD4PercBounds[UPPER_BOUND][i]) );
+		inputFile->scan( "%lf", &(pedsInputs->startProph[PROPH_PRIMARY].currCD4PercBounds[UPPER_BOUND][i]) );
 	readAndSkipPast( "PriProphStartPeds", inputFile );
 	readAndSkipPast( "cd4Perclwr", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.startProph[PROPH_PRIMARY].currCD4PercBounds[LOWER_BOUND][i]) );
+		inputFile->scan( "%lf", &(pedsInputs->startProph[PROPH_PRIMARY].currCD4PercBounds[LOWER_BOUND][i]) );
 
 	for ( j = 0; j < OI_NUM; ++j ) {
 		readAndSkipPast( "PriProphStartPeds", inputFile );
 		readAndSkipPast( OI_STRS[j], inputFile );
 		for ( i = 0; i < OI_NUM; ++i )
-			fscanf( inputFile, "%d", &(pedsInputs.startProph[PROPH_PRIMARY].OIHistory[j][i]) );
+			inputFile->scan( "%d", &(pedsInputs->startProph[PROPH_PRIMARY].OIHistory[j][i]) );
 	}
 
 	readAndSkipPast( "PriProphStartPeds_CondFirst", inputFile );
-	fscanf( inputFile, "%d", &tempInt);
-	pedsInputs.startProph[PROPH_PRIMARY].firstCondition=(CONDITIONS_TYPE) tempInt;
+	inputFile->scan( "%d", &tempInt);
+	pedsInputs->startProph[PROPH_PRIMARY].firstCondition=(CONDITIONS_TYPE) tempInt;
 	readAndSkipPast( "PriProphStartPeds_CondSecond", inputFile );
-	fscanf( inputFile, "%d", &tempInt);
-	pedsInputs.startProph[PROPH_PRIMARY].secondCondition=(CONDITIONS_TYPE) tempInt;
+	inputFile->scan( "%d", &tempInt);
+	pedsInputs->startProph[PROPH_PRIMARY].secondCondition=(CONDITIONS_TYPE) tempInt;
 	readAndSkipPast( "PriProphStartPeds_CondPar", inputFile );
-	fscanf( inputFile, "%d", &tempInt);
-	pedsInputs.startProph[PROPH_PRIMARY].parDirection=(DIRECTIONS_TYPE) tempInt;
+	inputFile->scan( "%d", &tempInt);
+	pedsInputs->startProph[PROPH_PRIMARY].parDirection=(DIRECTIONS_TYPE) tempInt;
 
 	// read in primary OI proph regimen stopping criteria
 	readAndSkipPast( "PriProphStopPeds", inputFile );
 	readAndSkipPast( "agelwr", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.stopProph[PROPH_PRIMARY].ageLowerBound[i]) );
+		inputFile->scan( "%lf", &(pedsInputs->stopProph[PROPH_PRIMARY].ageLowerBound[i]) );
 	readAndSkipPast( "PriProphStopPeds", inputFile );
 	readAndSkipPast( "CD4Perclwr", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.stopProph[PROPH_PRIMARY].currCD4PercLowerBound[i]) );
+		inputFile->scan( "%lf", &(pedsInputs->stopProph[PROPH_PRIMARY].currCD4PercLowerBound[i]) );
 	for ( j = 0; j < OI_NUM; ++j ) {
 		readAndSkipPast( "PriProphStopPeds", inputFile );
 		readAndSkipPast( OI_STRS[j], inputFile );
 		for ( i = 0; i < OI_NUM; ++i )
-			fscanf( inputFile, "%d", &(pedsInputs.stopProph[PROPH_PRIMARY].OIHistory[j][i]) );
+			inputFile->scan( "%d", &(pedsInputs->stopProph[PROPH_PRIMARY].OIHistory[j][i]) );
 	}
 	readAndSkipPast( "PriProphStopPeds", inputFile );
 	readAndSkipPast( "mthsOnProph", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%d", &(pedsInputs.stopProph[PROPH_PRIMARY].monthsOnProph[i]) );
+		inputFile->scan( "%d", &(pedsInputs->stopProph[PROPH_PRIMARY].monthsOnProph[i]) );
 
 	readAndSkipPast( "PriProphStopPeds_CondFirst", inputFile );
-	fscanf( inputFile, "%d", &tempInt);
-	pedsInputs.stopProph[PROPH_PRIMARY].firstCondition=(CONDITIONS_TYPE) tempInt;
+	inputFile->scan( "%d", &tempInt);
+	pedsInputs->stopProph[PROPH_PRIMARY].firstCondition=(CONDITIONS_TYPE) tempInt;
 	readAndSkipPast( "PriProphStopPeds_CondSecond", inputFile );
-	fscanf( inputFile, "%d", &tempInt);
-	pedsInputs.stopProph[PROPH_PRIMARY].secondCondition=(CONDITIONS_TYPE) tempInt;
+	inputFile->scan( "%d", &tempInt);
+	pedsInputs->stopProph[PROPH_PRIMARY].secondCondition=(CONDITIONS_TYPE) tempInt;
 	readAndSkipPast( "PriProphStopPeds_CondPar", inputFile );
-	fscanf( inputFile, "%d", &tempInt);
-	pedsInputs.stopProph[PROPH_PRIMARY].parDirection=(DIRECTIONS_TYPE) tempInt;
+	inputFile->scan( "%d", &tempInt);
+	pedsInputs->stopProph[PROPH_PRIMARY].parDirection=(DIRECTIONS_TYPE) tempInt;
 
 	// read in secondary OI proph regimen starting criteria
 	readAndSkipPast( "SecProphStartPeds", inputFile );
 	readAndSkipPast( "agelwr", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.startProph[PROPH_SECONDARY].ageBounds[LOWER_BOUND][i]) );
+		inputFile->scan( "%lf", &(pedsInputs->startProph[PROPH_SECONDARY].ageBounds[LOWER_BOUND][i]) );
 	readAndSkipPast( "SecProphStartPeds", inputFile );
 	readAndSkipPast( "ageupp", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.startProph[PROPH_SECONDARY].ageBounds[UPPER_BOUND][i]) );
+		inputFile->scan( "%lf", &(pedsInputs->startProph[PROPH_SECONDARY].ageBounds[UPPER_BOUND][i]) );
 
 	readAndSkipPast( "SecProphStartPeds", inputFile );
 	readAndSkipPast( "cd4Percupp", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.startProph[PROPH_SECONDARY].currCD4PercBounds[UPPER_BOUND][i]) );
+		inputFile->scan( "%lf", &(pedsInputs->startProph[PROPH_SECONDARY].currCD4PercBounds[UPPER_BOUND][i]) );
 	readAndSkipPast( "SecProphStartPeds", inputFile );
 	readAndSkipPast( "cd4Perclwr", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.startProph[PROPH_SECONDARY].currCD4PercBounds[LOWER_BOUND][i]) );
+		inputFile->scan( "%lf", &(pedsInputs->startProph[PROPH_SECONDARY].currCD4PercBounds[LOWER_BOUND][i]) );
 
 	for ( j = 0; j < OI_NUM; ++j ) {
 		readAndSkipPast( "SecProphStartPeds", inputFile );
 		readAndSkipPast( OI_STRS[j], inputFile );
 		for ( i = 0; i < OI_NUM; ++i )
-			fscanf( inputFile, "%d", &(pedsInputs.startProph[PROPH_SECONDARY].OIHistory[j][i]) );
+			inputFile->scan( "%d", &(pedsInputs->startProph[PROPH_SECONDARY].OIHistory[j][i]) );
 	}
 
 	readAndSkipPast( "SecProphStartPeds_CondFirst", inputFile );
-	fscanf( inputFile, "%d", &tempInt);
-	pedsInputs.startProph[PROPH_SECONDARY].firstCondition=(CONDITIONS_TYPE) tempInt;
+	inputFile->scan( "%d", &tempInt);
+	pedsInputs->startProph[PROPH_SECONDARY].firstCondition=(CONDITIONS_TYPE) tempInt;
 	readAndSkipPast( "SecProphStartPeds_CondSecond", inputFile );
-	fscanf( inputFile, "%d", &tempInt);
-	pedsInputs.startProph[PROPH_SECONDARY].secondCondition=(CONDITIONS_TYPE) tempInt;
+	inputFile->scan( "%d", &tempInt);
+	pedsInputs->startProph[PROPH_SECONDARY].secondCondition=(CONDITIONS_TYPE) tempInt;
 	readAndSkipPast( "SecProphStartPeds_CondPar", inputFile );
-	fscanf( inputFile, "%d", &tempInt);
-	pedsInputs.startProph[PROPH_SECONDARY].parDirection=(DIRECTIONS_TYPE) tempInt;
+	inputFile->scan( "%d", &tempInt);
+	pedsInputs->startProph[PROPH_SECONDARY].parDirection=(DIRECTIONS_TYPE) tempInt;
 
 	// read in primary OI proph regimen stopping criteria
 	readAndSkipPast( "SecProphStopPeds", inputFile );
 	readAndSkipPast( "agelwr", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.stopProph[PROPH_SECONDARY].ageLowerBound[i]) );
+		inputFile->scan( "%lf", &(pedsInputs->stopProph[PROPH_SECONDARY].ageLowerBound[i]) );
 	readAndSkipPast( "SecProphStopPeds", inputFile );
 	readAndSkipPast( "CD4Perclwr", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.stopProph[PROPH_SECONDARY].currCD4PercLowerBound[i]) );
+		inputFile->scan( "%lf", &(pedsInputs->stopProph[PROPH_SECONDARY].currCD4PercLowerBound[i]) );
 	for ( j = 0; j < OI_NUM; ++j ) {
 		readAndSkipPast( "SecProphStopPeds", inputFile );
 		readAndSkipPast( OI_STRS[j], inputFile );
 		for ( i = 0; i < OI_NUM; ++i )
-			fscanf( inputFile, "%d", &(pedsInputs.stopProph[PROPH_SECONDARY].OIHistory[j][i]) );
+			inputFile->scan( "%d", &(pedsInputs->stopProph[PROPH_SECONDARY].OIHistory[j][i]) );
 	}
 	readAndSkipPast( "SecProphStopPeds", inputFile );
 	readAndSkipPast( "mthsOnProph", inputFile );
 	for ( i = 0; i < OI_NUM; ++i )
-		fscanf( inputFile, "%d", &(pedsInputs.stopProph[PROPH_SECONDARY].monthsOnProph[i]) );
+		inputFile->scan( "%d", &(pedsInputs->stopProph[PROPH_SECONDARY].monthsOnProph[i]) );
 
 	readAndSkipPast( "SecProphStopPeds_CondFirst", inputFile );
-	fscanf( inputFile, "%d", &tempInt);
-	pedsInputs.stopProph[PROPH_SECONDARY].firstCondition=(CONDITIONS_TYPE) tempInt;
+	inputFile->scan( "%d", &tempInt);
+	pedsInputs->stopProph[PROPH_SECONDARY].firstCondition=(CONDITIONS_TYPE) tempInt;
 	readAndSkipPast( "SecProphStopPeds_CondSecond", inputFile );
-	fscanf( inputFile, "%d", &tempInt);
-	pedsInputs.stopProph[PROPH_SECONDARY].secondCondition=(CONDITIONS_TYPE) tempInt;
+	inputFile->scan( "%d", &tempInt);
+	pedsInputs->stopProph[PROPH_SECONDARY].secondCondition=(CONDITIONS_TYPE) tempInt;
 	readAndSkipPast( "SecProphStopPeds_CondPar", inputFile );
-	fscanf( inputFile, "%d", &tempInt);
-	pedsInputs.stopProph[PROPH_SECONDARY].parDirection=(DIRECTIONS_TYPE) tempInt;
+	inputFile->scan( "%d", &tempInt);
+	pedsInputs->stopProph[PROPH_SECONDARY].parDirection=(DIRECTIONS_TYPE) tempInt;
 
 	//Peds ART starting criteria
 	// read in CD4 bounds
 	readAndSkipPast( "PedsARTstartMthStage", inputFile );
 	for (i=0;i<(NUM_ART_START_CD4PERC_PEDS-1);i++){
-		fscanf(inputFile, "%d",&(pedsInputs.startART.CD4PercStageMonths[i]));
+		inputFile->scan("%d",&(pedsInputs->startART.CD4PercStageMonths[i]));
 	}
 	for (i=0;i<NUM_ART_START_CD4PERC_PEDS;i++){
 		sprintf(scratch, "PedsARTstart_CD4Perc%d", i);
 		readAndSkipPast2( scratch, "upp", inputFile );
 		for (j=0;j<ART_NUM_LINES;j++){
-			fscanf(inputFile, "%lf", &(pedsInputs.startART.CD4PercBounds[i][j][UPPER_BOUND]));
+			inputFile->scan("%lf", &(pedsInputs->startART.CD4PercBounds[i][j][UPPER_BOUND]));
 		}
 		readAndSkipPast2( scratch, "lwr", inputFile );
 		for (j = 0; j < ART_NUM_LINES; ++j)
-			fscanf( inputFile, "%lf", &(pedsInputs.startART.CD4PercBounds[i][j][LOWER_BOUND]) );
+			inputFile->scan( "%lf", &(pedsInputs->startART.CD4PercBounds[i][j][LOWER_BOUND]) );
 	}
 
 	// read in HVL bounds to administer ARTs
 	readAndSkipPast2( "PedsARTstart_HVL", "upp", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(pedsInputs.startART.HVLBounds[i][UPPER_BOUND]) );
+		inputFile->scan( "%d", &(pedsInputs->startART.HVLBounds[i][UPPER_BOUND]) );
 	readAndSkipPast2( "PedsARTstart_HVL", "lwr", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(pedsInputs.startART.HVLBounds[i][LOWER_BOUND]) );
+		inputFile->scan( "%d", &(pedsInputs->startART.HVLBounds[i][LOWER_BOUND]) );
 
 	// read in OI criteria to administer ARTs
 	for (j = 0; j < OI_NUM; ++j) {
 		readAndSkipPast2( "PedsARTstart_OIs", OI_STRS[j], inputFile );
 		for (i = 0; i < ART_NUM_LINES; ++i) {
-			fscanf( inputFile, "%d", &tempBool);
-			pedsInputs.startART.OIHistory[i][j] = (bool) tempBool;
+			inputFile->scan( "%d", &tempBool);
+			pedsInputs->startART.OIHistory[i][j] = (bool) tempBool;
 		}
 	}
 	readAndSkipPast2( "PedsARTstart_OIs", "numOIs", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(pedsInputs.startART.numOIs[i]) );
+		inputFile->scan( "%d", &(pedsInputs->startART.numOIs[i]) );
 
 	// read in minimum mth # to start ART
 	readAndSkipPast2( "PedsARTstart", "minMthNum", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(pedsInputs.startART.minMonthNum[i]) );
+		inputFile->scan( "%d", &(pedsInputs->startART.minMonthNum[i]) );
 	readAndSkipPast2( "PedsARTstart", "MthsSincePrevRegStop", inputFile );
 	for (i = 0; i < ART_NUM_LINES; ++i)
-		fscanf( inputFile, "%d", &(pedsInputs.startART.monthsSincePrevRegimen[i]) );
+		inputFile->scan( "%d", &(pedsInputs->startART.monthsSincePrevRegimen[i]) );
 
 	// ART Failure parameters
 	// read in # HVL lvls to incr for fail diag
 	readAndSkipPast( "PedsARTfail_hvlNumIncr", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(pedsInputs.failART[i].HVLNumIncrease) );
+		inputFile->scan( "%d", &(pedsInputs->failART[i].HVLNumIncrease) );
 	// read in absolute HVL counts for fail diag
 	readAndSkipPast( "PedsARTfail_hvlAbsol", inputFile );
 	readAndSkipPast( "uppBnd", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(pedsInputs.failART[i].HVLBounds[UPPER_BOUND]) );
+		inputFile->scan( "%d", &(pedsInputs->failART[i].HVLBounds[UPPER_BOUND]) );
 	readAndSkipPast( "PedsARTfail_hvlAbsol", inputFile );
 	readAndSkipPast( "lwrBnd", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(pedsInputs.failART[i].HVLBounds[LOWER_BOUND]) );
+		inputFile->scan( "%d", &(pedsInputs->failART[i].HVLBounds[LOWER_BOUND]) );
 	// read in true/false use HVL as setpoint for fail diag
 	readAndSkipPast( "PedsARTfail_hvlAtSetptAsFailDiag", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i ) {
-		fscanf( inputFile, "%d", &tempBool);
-		pedsInputs.failART[i].HVLFailAtSetpoint = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		pedsInputs->failART[i].HVLFailAtSetpoint = (bool) tempBool;
 	}
 	// read in # of months before using HVL criteria
 	readAndSkipPast( "PedsARTfail_hvlMthsFromInit", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(pedsInputs.failART[i].HVLMonthsFromInit) );
+		inputFile->scan( "%d", &(pedsInputs->failART[i].HVLMonthsFromInit) );
 	// read in CD4 percentage to decr for fail diag
 	readAndSkipPast( "PedsARTfail_cd4PercDrop", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.failART[i].CD4PercPercentageDrop) );
+		inputFile->scan( "%lf", &(pedsInputs->failART[i].CD4PercPercentageDrop) );
 	// read in true/false use CD4 as below pre-ART nadir for fail diag
 	readAndSkipPast( "PedsARTfail_cd4BelowPreARTNadir", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i ) {
-		fscanf( inputFile, "%d", &tempBool);
-		pedsInputs.failART[i].CD4PercBelowPreARTNadir = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		pedsInputs->failART[i].CD4PercBelowPreARTNadir = (bool) tempBool;
 	}
 	// read in absolute CD4 counts as OR criteria for fail diag
 	readAndSkipPast( "PedsARTfail_cd4AbsolOR", inputFile );
 	readAndSkipPast( "uppBnd", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.failART[i].CD4PercBoundsOR[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(pedsInputs->failART[i].CD4PercBoundsOR[UPPER_BOUND]) );
 	readAndSkipPast( "PedsARTfail_cd4AbsolOR", inputFile );
 	readAndSkipPast( "lwrBnd", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.failART[i].CD4PercBoundsOR[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(pedsInputs->failART[i].CD4PercBoundsOR[LOWER_BOUND]) );
 	// read in absolute CD4 counts as AND criteria for fail diag
 	readAndSkipPast( "PedsARTfail_cd4AbsolAND", inputFile );
 	readAndSkipPast( "uppBnd", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.failART[i].CD4PercBoundsAND[UPPER_BOUND]) );
+		inputFile->scan( "%lf", &(pedsInputs->failART[i].CD4PercBoundsAND[UPPER_BOUND]) );
 	readAndSkipPast( "PedsARTfail_cd4AbsolAND", inputFile );
 	readAndSkipPast( "lwrBnd", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.failART[i].CD4PercBoundsAND[LOWER_BOUND]) );
+		inputFile->scan( "%lf", &(pedsInputs->failART[i].CD4PercBoundsAND[LOWER_BOUND]) );
 	// read in # of months before using CD4 criteria
 	readAndSkipPast( "PedsARTfail_cd4MthsFromInit", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(pedsInputs.failART[i].CD4PercMonthsFromInit) );
+		inputFile->scan( "%d", &(pedsInputs->failART[i].CD4PercMonthsFromInit) );
 	// read in whether to treat OI event as ART fail diag
 	for ( j = 0; j < OI_NUM; ++j ) {
 		readAndSkipPast( "PedsARTfail_OIs", inputFile );
 		readAndSkipPast( OI_STRS[j], inputFile );
 		for ( i = 0; i < ART_NUM_LINES; ++i ){
-			fscanf( inputFile, "%d", &tempInt);
-			pedsInputs.failART[i].OIsEvent[j] = (ART_FAIL_BY_OI) tempInt;
+			inputFile->scan( "%d", &tempInt);
+			pedsInputs->failART[i].OIsEvent[j] = (ART_FAIL_BY_OI) tempInt;
 		}	
 	}
 	readAndSkipPast( "PedsARTfail_OIsMinNum", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(pedsInputs.failART[i].OIsMinNum) );
+		inputFile->scan( "%d", &(pedsInputs->failART[i].OIsMinNum) );
 	readAndSkipPast( "PedsARTfail_OIsMthsFromInit", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(pedsInputs.failART[i].OIsMonthsFromInit) );
+		inputFile->scan( "%d", &(pedsInputs->failART[i].OIsMonthsFromInit) );
 	// read in ART failure diagnoses criteria parameters
 	readAndSkipPast( "PedsARTfail_diagNumTestsFail", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(pedsInputs.failART[i].diagnoseNumTestsFail) );
+		inputFile->scan( "%d", &(pedsInputs->failART[i].diagnoseNumTestsFail) );
 	readAndSkipPast( "PedsARTfail_diagUseHVLTestsConfirm", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i ) {
-		fscanf( inputFile, "%d", &tempBool);
-		pedsInputs.failART[i].diagnoseUseHVLTestsConfirm = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		pedsInputs->failART[i].diagnoseUseHVLTestsConfirm = (bool) tempBool;
 	}
 	readAndSkipPast( "PedsARTfail_diagUseCD4TestsConfirm", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i ) {
-		fscanf( inputFile, "%d", &tempBool);
-		pedsInputs.failART[i].diagnoseUseCD4TestsConfirm = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		pedsInputs->failART[i].diagnoseUseCD4TestsConfirm = (bool) tempBool;
 	}
 	readAndSkipPast( "PedsARTfail_diagNumTestsConfirm", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(pedsInputs.failART[i].diagnoseNumTestsConfirm) );
+		inputFile->scan( "%d", &(pedsInputs->failART[i].diagnoseNumTestsConfirm) );
 
 	//read in ART stopping policy
 	// read in maximum number of months to be on ART
 	readAndSkipPast( "PedsARTstop_MaxMthsOnART", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(pedsInputs.stopART[i].maxMonthsOnART));
+		inputFile->scan( "%d", &(pedsInputs->stopART[i].maxMonthsOnART));
 	// read in stop on major toxicity
 	readAndSkipPast("PedsARTstop_MajorToxicity", inputFile);
 	for (i = 0; i < ART_NUM_LINES; i++) {
-		fscanf(inputFile, "%d", &tempBool);
-		pedsInputs.stopART[i].withMajorToxicty = (bool) tempBool;
+		inputFile->scan("%d", &tempBool);
+		pedsInputs->stopART[i].withMajorToxicty = (bool) tempBool;
 	}
 	// read in criteria to use after failure has been observed
 	readAndSkipPast( "PedsARTstop_OnFailImmed", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i ) {
-		fscanf( inputFile, "%d", &tempBool);
-		pedsInputs.stopART[i].afterFailImmediate = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		pedsInputs->stopART[i].afterFailImmediate = (bool) tempBool;
 	}
 	readAndSkipPast( "PedsARTstop_OnFailBelowCD4", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%lf", &(pedsInputs.stopART[i].afterFailCD4PercLowerBound));
+		inputFile->scan( "%lf", &(pedsInputs->stopART[i].afterFailCD4PercLowerBound));
 	readAndSkipPast( "PedsARTstop_OnFailSevereOI", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i ) {
-		fscanf( inputFile, "%d", &tempBool);
-		pedsInputs.stopART[i].afterFailWithSevereOI = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		pedsInputs->stopART[i].afterFailWithSevereOI = (bool) tempBool;
 	}
 	readAndSkipPast( "PedsARTstop_OnFailMthsAfterObsv", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(pedsInputs.stopART[i].afterFailMonthsFromObserved));
+		inputFile->scan( "%d", &(pedsInputs->stopART[i].afterFailMonthsFromObserved));
 	// read in minimum month number to stop ART
 	readAndSkipPast( "PedsARTstop_OnFailMinMthNum", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(pedsInputs.stopART[i].afterFailMinMonthNum) );
+		inputFile->scan( "%d", &(pedsInputs->stopART[i].afterFailMinMonthNum) );
 	readAndSkipPast( "PedsARTstop_OnFailMthsFromInit", inputFile );
 	for ( i = 0; i < ART_NUM_LINES; ++i )
-		fscanf( inputFile, "%d", &(pedsInputs.stopART[i].afterFailMonthsFromInit) );
+		inputFile->scan( "%d", &(pedsInputs->stopART[i].afterFailMonthsFromInit) );
 } /* end readPedsInputs */
 
 
 /* readPedsProphInputs reads data from the PedsProphs tab of the input sheet */
-void SimContext::readPedsProphInputs() {
+void SimContext::readPedsProphInputs(InputReader *inputFile) {
 	char scratch[256], buffer[256];
 	int i, j, k, tempBool;
 
+	if (!pedsInputs->enablePediatricsModel && skipDisabledTab(&SimContext::readPedsProphInputs, inputFile))
+		return;
+
 	for ( k = 0; k < OI_NUM; ++k) {
 		for ( i = 0; i < PROPH_NUM; ++i ) {
 			// read in OI proph id and name
@@ -4409,61 +5342,61 @@ void SimContext::readPedsProphInputs() {
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "Id", inputFile );
 			int idNum;
-			fscanf( inputFile, " %d", &idNum);
+			inputFile->scan( " %d", &idNum);
 			// continue to next proph if this one is unspecified
 			if (idNum == NOT_APPL) {
-				pedsProphsInputs[PROPH_PRIMARY][k][i] = NULL;
+				pedsProphsInputs[PROPH_PRIMARY][k][i].reset();
 				continue;
 			}
 			// allocate a proph input structure
-			pedsProphsInputs[PROPH_PRIMARY][k][i] = new ProphInputs();
+			pedsProphsInputs[PROPH_PRIMARY][k][i] = make_shared<ProphInputs>();
 
 			// read in OI proph efficacy (for primary proph, primary OIs only in LDC model)
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "EffPriOIs", inputFile );
 			for ( j = 0; j < OI_NUM; ++j )
-				fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->primaryOIEfficacy[j]) );
+				inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->primaryOIEfficacy[j]) );
 
 			// read in OI primary proph efficacy on secondary OIs
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "EffSecOIs", inputFile );
 			for ( j = 0; j < OI_NUM; ++j )
-				fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->secondaryOIEfficacy[j]) );
+				inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->secondaryOIEfficacy[j]) );
 
 			// read in proph resist prob, level of proph resistance, time of proph resistance,
 			// cost factor of proph resistance, and death rate ratio for proph resistance for the primary Peds proph
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "Resist", inputFile );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->monthlyProbResistance) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->percentResistance) );
-			fscanf( inputFile, "%d", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->timeOfResistance) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->costFactorResistance) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->deathRateRatioResistance) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->monthlyProbResistance) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->percentResistance) );
+			inputFile->scan( "%d", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->timeOfResistance) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->costFactorResistance) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->deathRateRatioResistance) );
 
 			// read in min & maj tox for proph
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "Tox", inputFile );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->probMinorToxicity) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->probMajorToxicity) );
-			fscanf( inputFile, "%d", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->monthsToToxicity) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->deathRateRatioMajorToxicity) );	
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->probMinorToxicity) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->probMajorToxicity) );
+			inputFile->scan( "%d", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->monthsToToxicity) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->deathRateRatioMajorToxicity) );	
 
 			// read in costs and QOL for proph
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "CostQOL", inputFile );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->costMonthly) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->costMinorToxicity) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->QOLMinorToxicity) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->costMajorToxicity) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->QOLMajorToxicity) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->costMonthly) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->costMinorToxicity) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->QOLMinorToxicity) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->costMajorToxicity) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->QOLMajorToxicity) );
 
 			// read in proph switching inputs
 			readAndSkipPast(scratch, inputFile);
 			readAndSkipPast("Switch", inputFile);
-			fscanf( inputFile, "%d", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->monthsToSwitch) );
-			fscanf( inputFile, "%d", &tempBool);
+			inputFile->scan( "%d", &(pedsProphsInputs[PROPH_PRIMARY][k][i]->monthsToSwitch) );
+			inputFile->scan( "%d", &tempBool);
 			pedsProphsInputs[PROPH_PRIMARY][k][i]->switchOnMinorToxicity = (bool) tempBool;
-			fscanf( inputFile, "%d", &tempBool);
+			inputFile->scan( "%d", &tempBool);
 			pedsProphsInputs[PROPH_PRIMARY][k][i]->switchOnMajorToxicity = (bool) tempBool;
 		}
 	}
@@ -4475,120 +5408,123 @@ void SimContext::readPedsProphInputs() {
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "Id", inputFile );
 			int idNum;
-			fscanf( inputFile, " %d", &idNum);
+			inputFile->scan( " %d", &idNum);
 			// continue to next proph if this one is unspecified
 			if (idNum == NOT_APPL) {
-				pedsProphsInputs[PROPH_SECONDARY][k][i] = NULL;
+				pedsProphsInputs[PROPH_SECONDARY][k][i].reset();
 				continue;
 			}
 			// allocate a proph input structure
-			pedsProphsInputs[PROPH_SECONDARY][k][i] = new ProphInputs();
+			pedsProphsInputs[PROPH_SECONDARY][k][i] = make_shared<ProphInputs>();
 
 			// read in OI proph efficacy (for primary proph, primary OIs only in LDC model)
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "EffPriOIs", inputFile );
 			for ( j = 0; j < OI_NUM; ++j )
-				fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->primaryOIEfficacy[j]) );
+				inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->primaryOIEfficacy[j]) );
 
 			// read in OI primary proph efficacy on secondary OIs
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "EffSecOIs", inputFile );
 			for ( j = 0; j < OI_NUM; ++j )
-				fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->secondaryOIEfficacy[j]) );
+				inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->secondaryOIEfficacy[j]) );
 
 			// read in proph resist prob, level of proph resistance, time of proph resistance,
 			// cost factor of proph resistance, and death rate ratio for proph resistance for the secondary Peds proph
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "Resist", inputFile );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->monthlyProbResistance) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->percentResistance) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->timeOfResistance) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->costFactorResistance) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->deathRateRatioResistance) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->monthlyProbResistance) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->percentResistance) );
+			inputFile->scan( "%d", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->timeOfResistance) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->costFactorResistance) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->deathRateRatioResistance) );
 
 			// read in min & maj tox for proph
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "Tox", inputFile );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->probMinorToxicity) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->probMajorToxicity) );
-			fscanf( inputFile, "%d", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->monthsToToxicity) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->deathRateRatioMajorToxicity) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->probMinorToxicity) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->probMajorToxicity) );
+			inputFile->scan( "%d", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->monthsToToxicity) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->deathRateRatioMajorToxicity) );
 
 			// read in costs and QOL for proph
 			readAndSkipPast( scratch, inputFile );
 			readAndSkipPast( "CostQOL", inputFile );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->costMonthly) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->costMinorToxicity) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->QOLMinorToxicity) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->costMajorToxicity) );
-			fscanf( inputFile, "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->QOLMajorToxicity) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->costMonthly) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->costMinorToxicity) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->QOLMinorToxicity) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->costMajorToxicity) );
+			inputFile->scan( "%lf", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->QOLMajorToxicity) );
 
 			// read in proph switching inputs
 			readAndSkipPast(scratch, inputFile);
 			readAndSkipPast("Switch", inputFile);
-			fscanf( inputFile, "%d", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->monthsToSwitch) );
-			fscanf( inputFile, "%d", &tempBool);
+			inputFile->scan( "%d", &(pedsProphsInputs[PROPH_SECONDARY][k][i]->monthsToSwitch) );
+			inputFile->scan( "%d", &tempBool);
 			pedsProphsInputs[PROPH_SECONDARY][k][i]->switchOnMinorToxicity = (bool) tempBool;
-			fscanf( inputFile, "%d", &tempBool);
+			inputFile->scan( "%d", &tempBool);
 			pedsProphsInputs[PROPH_SECONDARY][k][i]->switchOnMajorToxicity = (bool) tempBool;
 		}
 	}
 } /* end readPedsProphInputs */
 
 /* readPedsARTInputs reads data from the ARTs tab of the input sheet */
-void SimContext::readPedsARTInputs() {
+void SimContext::readPedsARTInputs(InputReader *inputFile) {
 	char tmpBuf[256], tmpBuf2[256];
 	int i, j, k, tempBool;
 	double tempCost;
-	FILE *file = inputFile;
+	InputReader *file = inputFile;
+
+	if (!pedsInputs->enablePediatricsModel && skipDisabledTab(&SimContext::readPedsARTInputs, inputFile))
+		return;
 
 	for (int artNum = 1; artNum <= ART_NUM_LINES; artNum++) {
 		// read in regimen id num and name
 		sprintf(tmpBuf, "ART%dIdPeds", artNum);
 		readAndSkipPast( tmpBuf, file );
 		int idNum;
-		fscanf( file, " %d", &idNum );
+		file->scan( " %d", &idNum );
 		// skip to next regimen if this one is not specified
 		if (idNum == NOT_APPL) {
-			pedsARTInputs[artNum - 1] = NULL;
+			pedsARTInputs[artNum - 1].reset();
 			continue;
 		}
 		// create new regimen input structure
-		pedsARTInputs[artNum - 1] = new PedsARTInputs();
+		pedsARTInputs[artNum - 1] = make_shared<PedsARTInputs>();
 		PedsARTInputs &pedsART = *(pedsARTInputs[artNum - 1]);
 
 		// read in one-time startup cost
 		sprintf(tmpBuf, "ART%dInitCostPeds", artNum);
 		readAndSkipPast( tmpBuf, file );
 		for (i = 0; i < PEDS_ART_COST_AGE_CAT_NUM; i++)
-			fscanf( file, "%lf", &pedsART.costInitial[i]);
+			file->scan( "%lf", &pedsART.costInitial[i]);
 		// read in monthly cost
 		sprintf(tmpBuf, "ART%dMthCostPeds", artNum);
 		readAndSkipPast( tmpBuf, file );
 		for (i = 0; i < PEDS_ART_COST_AGE_CAT_NUM; i++)
-			fscanf( file, "%lf", &pedsART.costMonthly[i]);
+			file->scan( "%lf", &pedsART.costMonthly[i]);
 
 		// read in efficacy time horizon
 		sprintf(tmpBuf, "ART%dEffTimeHorizonPeds", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d %d", &pedsART.efficacyTimeHorizonEarly, &pedsART.efficacyTimeHorizonLate );
+		file->scan( "%d %d", &pedsART.efficacyTimeHorizonEarly, &pedsART.efficacyTimeHorizonLate );
 
 		// read in mth by which all would fail
 		sprintf(tmpBuf, "ART%dMthForceFailPeds", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d %d", &pedsART.forceFailAtMonthEarly, &pedsART.forceFailAtMonthLate );
+		file->scan( "%d %d", &pedsART.forceFailAtMonthEarly, &pedsART.forceFailAtMonthLate );
 
 		// read in CD4 effect on ART
 		sprintf(tmpBuf, "ART%dMthStageCD4Eff_SuccPedsEarly", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d %d", &(pedsART.stageBoundsCD4PercentageChangeOnSuppARTEarly[0]),
+		file->scan( "%d %d", &(pedsART.stageBoundsCD4PercentageChangeOnSuppARTEarly[0]),
 				&(pedsART.stageBoundsCD4PercentageChangeOnSuppARTEarly[1]));
 		sprintf(tmpBuf, "ART%dCD4EffSlope_SuccPedsEarly", artNum);
 		for (j = 0; j < PEDS_AGE_EARLY_NUM; j++) {
 			for (k = 0; k < CD4_RESPONSE_NUM_TYPES; k++) {
 				sprintf(tmpBuf2, "%s%s", PEDS_AGE_CAT_STRS[j], CD4_RESPONSE_STRS[k]);
 				readAndSkipPast2( tmpBuf, tmpBuf2, file );
-				fscanf( file, "%lf %lf %lf %lf %lf %lf",
+				file->scan( "%lf %lf %lf %lf %lf %lf",
 					&(pedsART.CD4PercentageChangeOnSuppARTMeanEarly[j][k][0]), &(pedsART.CD4PercentageChangeOnSuppARTStdDevEarly[j][k][0]),
 					&(pedsART.CD4PercentageChangeOnSuppARTMeanEarly[j][k][1]), &(pedsART.CD4PercentageChangeOnSuppARTStdDevEarly[j][k][1]),
 					&(pedsART.CD4PercentageChangeOnSuppARTMeanEarly[j][k][2]), &(pedsART.CD4PercentageChangeOnSuppARTStdDevEarly[j][k][2]));
@@ -4596,12 +5532,12 @@ void SimContext::readPedsARTInputs() {
 		}
 		sprintf(tmpBuf, "ART%dMthStageCD4Eff_SuccPedsLate", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d %d", &(pedsART.stageBoundsCD4ChangeOnSuppARTLate[0]),
+		file->scan( "%d %d", &(pedsART.stageBoundsCD4ChangeOnSuppARTLate[0]),
 				&(pedsART.stageBoundsCD4ChangeOnSuppARTLate[1]));
 		sprintf(tmpBuf, "ART%dCD4EffSlope_SuccPedsLate", artNum);
 		for (j = 0; j < CD4_RESPONSE_NUM_TYPES; j++) {
 			readAndSkipPast2(tmpBuf, CD4_RESPONSE_STRS[j], file);
-			fscanf(file, "%lf %lf %lf %lf %lf %lf",
+			file->scan("%lf %lf %lf %lf %lf %lf",
 				&(pedsART.CD4ChangeOnSuppARTMeanLate[j][0]), &(pedsART.CD4ChangeOnSuppARTStdDevLate[j][0]),
 				&(pedsART.CD4ChangeOnSuppARTMeanLate[j][1]), &(pedsART.CD4ChangeOnSuppARTStdDevLate[j][1]),
 				&(pedsART.CD4ChangeOnSuppARTMeanLate[j][2]), &(pedsART.CD4ChangeOnSuppARTStdDevLate[j][2]));
@@ -4609,164 +5545,164 @@ void SimContext::readPedsARTInputs() {
 		
 		sprintf(tmpBuf, "ART%dMthStageCD4Eff_FailPedsEarly", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d", &(pedsART.stageBoundCD4PercentageChangeOnARTFailEarly));
+		file->scan( "%d", &(pedsART.stageBoundCD4PercentageChangeOnARTFailEarly));
 		sprintf(tmpBuf, "ART%dCD4EffMult_FailPedsEarly", artNum);
 		for (j = 0; j < CD4_RESPONSE_NUM_TYPES; j++) {
 			readAndSkipPast2(tmpBuf, CD4_RESPONSE_STRS[j], file);
-			fscanf( file, "%lf %lf",
+			file->scan( "%lf %lf",
 				&(pedsART.CD4PercentageMultiplierOnFailedARTEarly[j][0]),
 				&(pedsART.CD4PercentageMultiplierOnFailedARTEarly[j][1]));
 		}
 		sprintf(tmpBuf, "ART%dMthCD4SecStdDevPedsEarly", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &pedsART.secondaryCD4PercentageChangeOnARTStdDevEarly);
+		file->scan( "%lf", &pedsART.secondaryCD4PercentageChangeOnARTStdDevEarly);
 		sprintf(tmpBuf, "ART%dMthStageCD4Eff_FailPedsLate", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d", &(pedsART.stageBoundCD4ChangeOnARTFailLate));
+		file->scan( "%d", &(pedsART.stageBoundCD4ChangeOnARTFailLate));
 		sprintf(tmpBuf, "ART%dCD4EffMult_FailPedsLate", artNum);
 		for (j = 0; j < CD4_RESPONSE_NUM_TYPES; j++) {
 			readAndSkipPast2(tmpBuf, CD4_RESPONSE_STRS[j], file);
-			fscanf( file, "%lf %lf",
+			file->scan( "%lf %lf",
 				&(pedsART.CD4MultiplierOnFailedARTLate[j][0]),
 				&(pedsART.CD4MultiplierOnFailedARTLate[j][1]));
 		}
 		sprintf(tmpBuf, "ART%dMthCD4SecStdDevPedsLate", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf", &pedsART.secondaryCD4ChangeOnARTStdDevLate);
+		file->scan( "%lf", &pedsART.secondaryCD4ChangeOnARTStdDevLate);
 
 		// read in CD4 effect off ART
 		sprintf(tmpBuf, "ART%dCD4EffOffART_SuccPedsEarly", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf %lf", &(pedsART.monthlyCD4PercentageMultiplierOffARTPreSetpointEarly[ART_EFF_SUCCESS]),
+		file->scan( "%lf %lf", &(pedsART.monthlyCD4PercentageMultiplierOffARTPreSetpointEarly[ART_EFF_SUCCESS]),
 			&(pedsART.monthlyCD4PercentageMultiplierOffARTPostSetpointEarly[ART_EFF_SUCCESS]) );
 		sprintf(tmpBuf, "ART%dCD4EffOffART_FailPedsEarly", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf %lf", &(pedsART.monthlyCD4PercentageMultiplierOffARTPreSetpointEarly[ART_EFF_FAILURE]),
+		file->scan( "%lf %lf", &(pedsART.monthlyCD4PercentageMultiplierOffARTPreSetpointEarly[ART_EFF_FAILURE]),
 			&(pedsART.monthlyCD4PercentageMultiplierOffARTPostSetpointEarly[ART_EFF_FAILURE]) );
 		sprintf(tmpBuf, "ART%dCD4EffOffART_SuccPedsLate", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf %lf", &(pedsART.monthlyCD4MultiplierOffARTPreSetpointLate[ART_EFF_SUCCESS]),
+		file->scan( "%lf %lf", &(pedsART.monthlyCD4MultiplierOffARTPreSetpointLate[ART_EFF_SUCCESS]),
 			&(pedsART.monthlyCD4MultiplierOffARTPostSetpointLate[ART_EFF_SUCCESS]) );
 		sprintf(tmpBuf, "ART%dCD4EffOffART_FailPedsLate", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%lf %lf", &(pedsART.monthlyCD4MultiplierOffARTPreSetpointLate[ART_EFF_FAILURE]),
+		file->scan( "%lf %lf", &(pedsART.monthlyCD4MultiplierOffARTPreSetpointLate[ART_EFF_FAILURE]),
 			&(pedsART.monthlyCD4MultiplierOffARTPostSetpointLate[ART_EFF_FAILURE]) );
 
 		// read in HVL change probability
 		sprintf(tmpBuf, "ART%dHVLChgProbPedsEarly", artNum);
 		readAndSkipPast2( tmpBuf, "Supp", file );
-		fscanf( file, "%lf %d", &(pedsART.monthlyProbHVLChangeEarly[ART_EFF_SUCCESS]),
+		file->scan( "%lf %d", &(pedsART.monthlyProbHVLChangeEarly[ART_EFF_SUCCESS]),
 				&(pedsART.monthlyNumStrataHVLChangeEarly[ART_EFF_SUCCESS]) );
 		
 		sprintf(tmpBuf, "ART%dHVLChgProbPedsEarly", artNum);
 		readAndSkipPast2( tmpBuf, "Fail", file );
-		fscanf( file, "%lf %d", &(pedsART.monthlyProbHVLChangeEarly[ART_EFF_FAILURE]),
+		file->scan( "%lf %d", &(pedsART.monthlyProbHVLChangeEarly[ART_EFF_FAILURE]),
 				&(pedsART.monthlyNumStrataHVLChangeEarly[ART_EFF_FAILURE]) );
 		sprintf(tmpBuf, "ART%dHVLChgProbPedsLate", artNum);
 		readAndSkipPast2( tmpBuf, "Supp", file );
-		fscanf( file, "%lf %d", &(pedsART.monthlyProbHVLChangeLate[ART_EFF_SUCCESS]),
+		file->scan( "%lf %d", &(pedsART.monthlyProbHVLChangeLate[ART_EFF_SUCCESS]),
 				&(pedsART.monthlyNumStrataHVLChangeLate[ART_EFF_SUCCESS]) );
 		sprintf(tmpBuf, "ART%dHVLChgProbPedsLate", artNum);
 		readAndSkipPast2( tmpBuf, "Fail", file );
-		fscanf( file, "%lf %d", &(pedsART.monthlyProbHVLChangeLate[ART_EFF_FAILURE]),
+		file->scan( "%lf %d", &(pedsART.monthlyProbHVLChangeLate[ART_EFF_FAILURE]),
 				&(pedsART.monthlyNumStrataHVLChangeLate[ART_EFF_FAILURE]) );
 
 		//read regimen specific heterogeneity inputs
 		sprintf(tmpBuf, "PedsART%dPropMthCostNonRespondersEarly", artNum);
 		readAndSkipPast(tmpBuf, file);
-		fscanf(file, "%lf", &(pedsART.propMthCostNonRespondersEarly));
+		file->scan("%lf", &(pedsART.propMthCostNonRespondersEarly));
 
 		sprintf(tmpBuf, "PedsART%dProbRestartRegimenEarly", artNum);
 		readAndSkipPast(tmpBuf, file);
-		fscanf(file, "%lf %lf %lf", &(pedsART.probRestartARTRegimenAfterFailureEarly[RESP_TYPE_FULL]),&(pedsART.probRestartARTRegimenAfterFailureEarly[RESP_TYPE_PARTIAL]),&(pedsART.probRestartARTRegimenAfterFailureEarly[RESP_TYPE_NON]));
+		file->scan("%lf %lf %lf", &(pedsART.probRestartARTRegimenAfterFailureEarly[RESP_TYPE_FULL]),&(pedsART.probRestartARTRegimenAfterFailureEarly[RESP_TYPE_PARTIAL]),&(pedsART.probRestartARTRegimenAfterFailureEarly[RESP_TYPE_NON]));
 
 		sprintf(tmpBuf, "PedsART%dHetPropRespRegCoeffEarly", artNum);
 		readAndSkipPast(tmpBuf, file);
-		fscanf(file, "%lf %lf", &(pedsART.propRespondARTRegimenLogitMeanEarly), &(pedsART.propRespondARTRegimenLogitStdDevEarly));
+		file->scan("%lf %lf", &(pedsART.propRespondARTRegimenLogitMeanEarly), &(pedsART.propRespondARTRegimenLogitStdDevEarly));
 
 		sprintf(tmpBuf, "PedsART%dHetOutcomesEarly", artNum);
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("Supp",file);
-		fscanf(file, "%lf %lf %lf %lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_SUPP][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_SUPP][1]),&(pedsART.responseTypeValuesEarly[HET_OUTCOME_SUPP][0]),&(pedsART.responseTypeValuesEarly[HET_OUTCOME_SUPP][1]), &(pedsART.responseTypeExponentsEarly[HET_OUTCOME_SUPP]));
+		file->scan("%lf %lf %lf %lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_SUPP][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_SUPP][1]),&(pedsART.responseTypeValuesEarly[HET_OUTCOME_SUPP][0]),&(pedsART.responseTypeValuesEarly[HET_OUTCOME_SUPP][1]), &(pedsART.responseTypeExponentsEarly[HET_OUTCOME_SUPP]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("LateFail",file);
-		fscanf(file, "%lf %lf %lf %lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_LATEFAIL][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_LATEFAIL][1]),&(pedsART.responseTypeValuesEarly[HET_OUTCOME_LATEFAIL][0]),&(pedsART.responseTypeValuesEarly[HET_OUTCOME_LATEFAIL][1]), &(pedsART.responseTypeExponentsEarly[HET_OUTCOME_LATEFAIL]));
+		file->scan("%lf %lf %lf %lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_LATEFAIL][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_LATEFAIL][1]),&(pedsART.responseTypeValuesEarly[HET_OUTCOME_LATEFAIL][0]),&(pedsART.responseTypeValuesEarly[HET_OUTCOME_LATEFAIL][1]), &(pedsART.responseTypeExponentsEarly[HET_OUTCOME_LATEFAIL]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("ARTEffectOI",file);
-		fscanf(file, "%lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_ARTEFFECT_OI][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_ARTEFFECT_OI][1]));
+		file->scan("%lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_ARTEFFECT_OI][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_ARTEFFECT_OI][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("ARTEffectCHRMs",file);
-		fscanf(file, "%lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_ARTEFFECT_CHRMS][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_ARTEFFECT_CHRMS][1]));
+		file->scan("%lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_ARTEFFECT_CHRMS][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_ARTEFFECT_CHRMS][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("ARTEffectMort",file);
-		fscanf(file, "%lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_ARTEFFECT_MORT][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_ARTEFFECT_MORT][1]));
+		file->scan("%lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_ARTEFFECT_MORT][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_ARTEFFECT_MORT][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("Resist",file);
-		fscanf(file, "%lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_RESIST][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_RESIST][1]));
+		file->scan("%lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_RESIST][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_RESIST][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("Tox",file);
-		fscanf(file, "%lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_TOX][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_TOX][1]));
+		file->scan("%lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_TOX][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_TOX][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("Cost",file);
-		fscanf(file, "%lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_COST][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_COST][1]));
+		file->scan("%lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_COST][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_COST][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("RestartAfterFail",file);
-		fscanf(file, "%lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_RESTART][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_RESTART][1]));
+		file->scan("%lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_RESTART][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_RESTART][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("Resuppression",file);
-		fscanf(file, "%lf %lf %lf %lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_RESUPP][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_RESUPP][1]),&(pedsART.responseTypeValuesEarly[HET_OUTCOME_RESUPP][0]),&(pedsART.responseTypeValuesEarly[HET_OUTCOME_RESUPP][1]), &(pedsART.responseTypeExponentsEarly[HET_OUTCOME_RESUPP]));
+		file->scan("%lf %lf %lf %lf %lf", &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_RESUPP][0]), &(pedsART.responseTypeThresholdsEarly[HET_OUTCOME_RESUPP][1]),&(pedsART.responseTypeValuesEarly[HET_OUTCOME_RESUPP][0]),&(pedsART.responseTypeValuesEarly[HET_OUTCOME_RESUPP][1]), &(pedsART.responseTypeExponentsEarly[HET_OUTCOME_RESUPP]));
 
 		sprintf(tmpBuf, "PedsART%dARTEffectOnFailedARTEarly", artNum);
 		readAndSkipPast(tmpBuf, file);
-		fscanf(file, "%d", &tempBool);
+		file->scan("%d", &tempBool);
         pedsART.applyARTEffectOnFailedARTEarly = (bool) tempBool;
 		
 		sprintf(tmpBuf, "PedsART%dPropMthCostNonRespondersLate", artNum);
 		readAndSkipPast(tmpBuf, file);
-		fscanf(file, "%lf", &(pedsART.propMthCostNonRespondersLate));
+		file->scan("%lf", &(pedsART.propMthCostNonRespondersLate));
 
 		sprintf(tmpBuf, "PedsART%dProbRestartRegimenLate", artNum);
 		readAndSkipPast(tmpBuf, file);
-		fscanf(file, "%lf %lf %lf", &(pedsART.probRestartARTRegimenAfterFailureLate[RESP_TYPE_FULL]),&(pedsART.probRestartARTRegimenAfterFailureLate[RESP_TYPE_PARTIAL]),&(pedsART.probRestartARTRegimenAfterFailureLate[RESP_TYPE_NON]));
+		file->scan("%lf %lf %lf", &(pedsART.probRestartARTRegimenAfterFailureLate[RESP_TYPE_FULL]),&(pedsART.probRestartARTRegimenAfterFailureLate[RESP_TYPE_PARTIAL]),&(pedsART.probRestartARTRegimenAfterFailureLate[RESP_TYPE_NON]));
 
 		sprintf(tmpBuf, "PedsART%dHetPropRespRegCoeffLate", artNum);
 		readAndSkipPast(tmpBuf, file);
-		fscanf(file, "%lf %lf", &(pedsART.propRespondARTRegimenLogitMeanLate), &(pedsART.propRespondARTRegimenLogitStdDevLate));
+		file->scan("%lf %lf", &(pedsART.propRespondARTRegimenLogitMeanLate), &(pedsART.propRespondARTRegimenLogitStdDevLate));
 
 		sprintf(tmpBuf, "PedsART%dHetOutcomesLate", artNum);
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("Supp",file);
-		fscanf(file, "%lf %lf %lf %lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_SUPP][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_SUPP][1]),&(pedsART.responseTypeValuesLate[HET_OUTCOME_SUPP][0]),&(pedsART.responseTypeValuesLate[HET_OUTCOME_SUPP][1]), &(pedsART.responseTypeExponentsLate[HET_OUTCOME_SUPP]));
+		file->scan("%lf %lf %lf %lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_SUPP][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_SUPP][1]),&(pedsART.responseTypeValuesLate[HET_OUTCOME_SUPP][0]),&(pedsART.responseTypeValuesLate[HET_OUTCOME_SUPP][1]), &(pedsART.responseTypeExponentsLate[HET_OUTCOME_SUPP]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("LateFail",file);
-		fscanf(file, "%lf %lf %lf %lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_LATEFAIL][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_LATEFAIL][1]),&(pedsART.responseTypeValuesLate[HET_OUTCOME_LATEFAIL][0]),&(pedsART.responseTypeValuesLate[HET_OUTCOME_LATEFAIL][1]), &(pedsART.responseTypeExponentsLate[HET_OUTCOME_LATEFAIL]));
+		file->scan("%lf %lf %lf %lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_LATEFAIL][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_LATEFAIL][1]),&(pedsART.responseTypeValuesLate[HET_OUTCOME_LATEFAIL][0]),&(pedsART.responseTypeValuesLate[HET_OUTCOME_LATEFAIL][1]), &(pedsART.responseTypeExponentsLate[HET_OUTCOME_LATEFAIL]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("ARTEffectOI",file);
-		fscanf(file, "%lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_ARTEFFECT_OI][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_ARTEFFECT_OI][1]));
+		file->scan("%lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_ARTEFFECT_OI][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_ARTEFFECT_OI][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("ARTEffectCHRMs",file);
-		fscanf(file, "%lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_ARTEFFECT_CHRMS][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_ARTEFFECT_CHRMS][1]));
+		file->scan("%lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_ARTEFFECT_CHRMS][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_ARTEFFECT_CHRMS][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("ARTEffectMort",file);
-		fscanf(file, "%lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_ARTEFFECT_MORT][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_ARTEFFECT_MORT][1]));
+		file->scan("%lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_ARTEFFECT_MORT][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_ARTEFFECT_MORT][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("Resist",file);
-		fscanf(file, "%lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_RESIST][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_RESIST][1]));
+		file->scan("%lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_RESIST][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_RESIST][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("Tox",file);
-		fscanf(file, "%lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_TOX][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_TOX][1]));
+		file->scan("%lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_TOX][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_TOX][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("Cost",file);
-		fscanf(file, "%lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_COST][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_COST][1]));
+		file->scan("%lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_COST][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_COST][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("RestartAfterFail",file);
-		fscanf(file, "%lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_RESTART][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_RESTART][1]));
+		file->scan("%lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_RESTART][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_RESTART][1]));
 		readAndSkipPast(tmpBuf, file);
 		readAndSkipPast("Resuppression",file);
-		fscanf(file, "%lf %lf %lf %lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_RESUPP][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_RESUPP][1]),&(pedsART.responseTypeValuesLate[HET_OUTCOME_RESUPP][0]),&(pedsART.responseTypeValuesLate[HET_OUTCOME_RESUPP][1]), &(pedsART.responseTypeExponentsLate[HET_OUTCOME_RESUPP]));
+		file->scan("%lf %lf %lf %lf %lf", &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_RESUPP][0]), &(pedsART.responseTypeThresholdsLate[HET_OUTCOME_RESUPP][1]),&(pedsART.responseTypeValuesLate[HET_OUTCOME_RESUPP][0]),&(pedsART.responseTypeValuesLate[HET_OUTCOME_RESUPP][1]), &(pedsART.responseTypeExponentsLate[HET_OUTCOME_RESUPP]));
 		sprintf(tmpBuf, "PedsART%dARTEffectOnFailedARTLate", artNum);
 		readAndSkipPast(tmpBuf, file);
-		fscanf(file, "%d", &tempBool);
+		file->scan("%d", &tempBool);
         pedsART.applyARTEffectOnFailedARTLate = (bool) tempBool;
 
 	}
@@ -4774,10 +5710,13 @@ void SimContext::readPedsARTInputs() {
 
 
 /* readPedsCostInputs reads data from the PedsCost tab of the input sheet */
-void SimContext::readPedsCostInputs() {
+void SimContext::readPedsCostInputs(InputReader *inputFile) {
 	char tmpBuf[256];
 	int i, j, k;
 
+	if (!pedsInputs->enablePediatricsModel && skipDisabledTab(&SimContext::readPedsCostInputs, inputFile))
+		return;
+
 	for (int t=1; t <=PEDS_COST_AGE_CAT_NUM;t++){
 		// read in acute OI costs
 		for ( i = 0; i < OI_NUM; ++i ) {
@@ -4785,7 +5724,7 @@ void SimContext::readPedsCostInputs() {
 			readAndSkipPast( tmpBuf, inputFile );
 			readAndSkipPast( OI_STRS[i], inputFile );
 			for (j = 0; j < COST_NUM_TYPES; j++) {
-				fscanf(inputFile, "%lf", &(pedsCostInputs.acuteOICostTreated[t-1][ART_OFF_STATE][i][j]) );
+				inputFile->scan("%lf", &(pedsCostInputs->acuteOICostTreated[t-1][ART_OFF_STATE][i][j]) );
 			}
 		}
 		for ( i = 0; i < OI_NUM; ++i ) {
@@ -4793,7 +5732,7 @@ void SimContext::readPedsCostInputs() {
 			readAndSkipPast( tmpBuf, inputFile );
 			readAndSkipPast( OI_STRS[i], inputFile );
 			for (j = 0; j < COST_NUM_TYPES; j++) {
-				fscanf(inputFile, "%lf", &(pedsCostInputs.acuteOICostUntreated[t-1][ART_OFF_STATE][i][j]) );
+				inputFile->scan("%lf", &(pedsCostInputs->acuteOICostUntreated[t-1][ART_OFF_STATE][i][j]) );
 			}
 		}
 		for ( i = 0; i < OI_NUM; ++i ) {
@@ -4801,7 +5740,7 @@ void SimContext::readPedsCostInputs() {
 			readAndSkipPast( tmpBuf, inputFile );
 			readAndSkipPast( OI_STRS[i], inputFile );
 			for (j = 0; j < COST_NUM_TYPES; j++) {
-				fscanf(inputFile, "%lf", &(pedsCostInputs.acuteOICostTreated[t-1][ART_ON_STATE][i][j]) );
+				inputFile->scan("%lf", &(pedsCostInputs->acuteOICostTreated[t-1][ART_ON_STATE][i][j]) );
 			}
 		}
 		for ( i = 0; i < OI_NUM; ++i ) {
@@ -4809,7 +5748,7 @@ void SimContext::readPedsCostInputs() {
 			readAndSkipPast( tmpBuf, inputFile );
 			readAndSkipPast( OI_STRS[i], inputFile );
 			for (j = 0; j < COST_NUM_TYPES; j++) {
-				fscanf(inputFile, "%lf", &(pedsCostInputs.acuteOICostUntreated[t-1][ART_ON_STATE][i][j]) );
+				inputFile->scan("%lf", &(pedsCostInputs->acuteOICostUntreated[t-1][ART_ON_STATE][i][j]) );
 			}
 		}
 
@@ -4817,12 +5756,12 @@ void SimContext::readPedsCostInputs() {
 		sprintf(tmpBuf, "Peds%dCostCD4Test", t);
 		readAndSkipPast( tmpBuf, inputFile );
 		for (i = 0; i < COST_NUM_TYPES; i++) {
-			fscanf(inputFile, "%lf", &(pedsCostInputs.CD4TestCost[t-1][i]) );
+			inputFile->scan("%lf", &(pedsCostInputs->CD4TestCost[t-1][i]) );
 		}
 		sprintf(tmpBuf, "Peds%dCostHVLTest", t);
 		readAndSkipPast( tmpBuf, inputFile );
 		for (i = 0; i < COST_NUM_TYPES; i++) {
-			fscanf(inputFile, "%lf", &(pedsCostInputs.HVLTestCost[t-1][i]) );
+			inputFile->scan("%lf", &(pedsCostInputs->HVLTestCost[t-1][i]) );
 		}
 
 		// read in death from OI costs
@@ -4831,7 +5770,7 @@ void SimContext::readPedsCostInputs() {
 			readAndSkipPast( tmpBuf, inputFile );
 			readAndSkipPast( DTH_CAUSES_STRS[i], inputFile);
 			for (j = 0; j < COST_NUM_TYPES; j++) {
-				fscanf(inputFile, "%lf", &(pedsCostInputs.deathCostTreated[t-1][ART_OFF_STATE][i][j]) );
+				inputFile->scan("%lf", &(pedsCostInputs->deathCostTreated[t-1][ART_OFF_STATE][i][j]) );
 			}
 		}
 		for ( i = 0; i < DTH_NUM_CAUSES_BASIC; ++i ) {
@@ -4839,7 +5778,7 @@ void SimContext::readPedsCostInputs() {
 			readAndSkipPast( tmpBuf, inputFile );
 			readAndSkipPast( DTH_CAUSES_STRS[i], inputFile);
 			for (j = 0; j < COST_NUM_TYPES; j++) {
-				fscanf(inputFile, "%lf", &(pedsCostInputs.deathCostUntreated[t-1][ART_OFF_STATE][i][j]) );
+				inputFile->scan("%lf", &(pedsCostInputs->deathCostUntreated[t-1][ART_OFF_STATE][i][j]) );
 			}
 		}
 		for ( i = 0; i < DTH_NUM_CAUSES_BASIC; ++i ) {
@@ -4847,7 +5786,7 @@ void SimContext::readPedsCostInputs() {
 			readAndSkipPast( tmpBuf, inputFile );
 			readAndSkipPast( DTH_CAUSES_STRS[i], inputFile);
 			for (j = 0; j < COST_NUM_TYPES; j++) {
-				fscanf(inputFile, "%lf", &(pedsCostInputs.deathCostTreated[t-1][ART_ON_STATE][i][j]) );
+				inputFile->scan("%lf", &(pedsCostInputs->deathCostTreated[t-1][ART_ON_STATE][i][j]) );
 			}
 		}
 		for ( i = 0; i < DTH_NUM_CAUSES_BASIC; ++i ) {
@@ -4855,7 +5794,7 @@ void SimContext::readPedsCostInputs() {
 			readAndSkipPast( tmpBuf, inputFile );
 			readAndSkipPast( DTH_CAUSES_STRS[i], inputFile);
 			for (j = 0; j < COST_NUM_TYPES; j++) {
-				fscanf(inputFile, "%lf", &(pedsCostInputs.deathCostUntreated[t-1][ART_ON_STATE][i][j]) );
+				inputFile->scan("%lf", &(pedsCostInputs->deathCostUntreated[t-1][ART_ON_STATE][i][j]) );
 			}
 		}
 	}
@@ -4864,25 +5803,25 @@ void SimContext::readPedsCostInputs() {
 	readAndSkipPast("PedsCostRoutine_HIVneg_dmed", inputFile);
 	for (i = 0; i < GENDER_NUM; i++) {
 		for (j = 0; j < PEDS_COST_AGE_CAT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(pedsCostInputs.routineCareCostHIVNegative[i][j][COST_DIR_MED]));
+			inputFile->scan("%lf", &(pedsCostInputs->routineCareCostHIVNegative[i][j][COST_DIR_MED]));
 		}
 	}
 	readAndSkipPast("PedsCostRoutine_HIVneg_nmed", inputFile);
 	for (i = 0; i < GENDER_NUM; i++) {
 		for (j = 0; j < PEDS_COST_AGE_CAT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(pedsCostInputs.routineCareCostHIVNegative[i][j][COST_DIR_NONMED]));
+			inputFile->scan("%lf", &(pedsCostInputs->routineCareCostHIVNegative[i][j][COST_DIR_NONMED]));
 		}
 	}
 	readAndSkipPast("PedsCostRoutine_HIVneg_time", inputFile);
 	for (i = 0; i < GENDER_NUM; i++) {
 		for (j = 0; j < PEDS_COST_AGE_CAT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(pedsCostInputs.routineCareCostHIVNegative[i][j][COST_TIME]));
+			inputFile->scan("%lf", &(pedsCostInputs->routineCareCostHIVNegative[i][j][COST_TIME]));
 		}
 	}
 	readAndSkipPast("PedsCostRoutine_HIVneg_indr", inputFile);
 	for (i = 0; i < GENDER_NUM; i++) {
 		for (j = 0; j < PEDS_COST_AGE_CAT_NUM; j++) {
-			fscanf(inputFile, "%lf", &(pedsCostInputs.routineCareCostHIVNegative[i][j][COST_INDIR]));
+			inputFile->scan("%lf", &(pedsCostInputs->routineCareCostHIVNegative[i][j][COST_INDIR]));
 		}
 	}
 	// read in routine care costs for HIV positive, not on ART
@@ -4890,25 +5829,25 @@ void SimContext::readPedsCostInputs() {
 		readAndSkipPast2("PedsCostRoutine_HIVpos_noART_dmed", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < GENDER_NUM; j++) {
 			for (k = 0; k < PEDS_COST_AGE_CAT_NUM; k++) {
-				fscanf(inputFile, "%lf", &(pedsCostInputs.routineCareCostHIVPositive[ART_OFF_STATE][i][j][k][COST_DIR_MED]));
+				inputFile->scan("%lf", &(pedsCostInputs->routineCareCostHIVPositive[ART_OFF_STATE][i][j][k][COST_DIR_MED]));
 				}
 		}
 		readAndSkipPast2("PedsCostRoutine_HIVpos_noART_nmed", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < GENDER_NUM; j++) {
 			for (k = 0; k < PEDS_COST_AGE_CAT_NUM; k++) {
-				fscanf(inputFile, "%lf", &(pedsCostInputs.routineCareCostHIVPositive[ART_OFF_STATE][i][j][k][COST_DIR_NONMED]));
+				inputFile->scan("%lf", &(pedsCostInputs->routineCareCostHIVPositive[ART_OFF_STATE][i][j][k][COST_DIR_NONMED]));
 			}
 		}
 		readAndSkipPast2("PedsCostRoutine_HIVpos_noART_time", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < GENDER_NUM; j++) {
 			for (k = 0; k < PEDS_COST_AGE_CAT_NUM; k++) {
-				fscanf(inputFile, "%lf", &(pedsCostInputs.routineCareCostHIVPositive[ART_OFF_STATE][i][j][k][COST_TIME]));
+				inputFile->scan("%lf", &(pedsCostInputs->routineCareCostHIVPositive[ART_OFF_STATE][i][j][k][COST_TIME]));
 			}
 		}
 		readAndSkipPast2("PedsCostRoutine_HIVpos_noART_indr", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < GENDER_NUM; j++) {
 			for (k = 0; k < PEDS_COST_AGE_CAT_NUM; k++) {
-				fscanf(inputFile, "%lf", &(pedsCostInputs.routineCareCostHIVPositive[ART_OFF_STATE][i][j][k][COST_INDIR]));
+				inputFile->scan("%lf", &(pedsCostInputs->routineCareCostHIVPositive[ART_OFF_STATE][i][j][k][COST_INDIR]));
 			}
 		}
 	}
@@ -4917,270 +5856,273 @@ void SimContext::readPedsCostInputs() {
 		readAndSkipPast2("PedsCostRoutine_HIVpos_onART_dmed", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < GENDER_NUM; j++) {
 			for (k = 0; k < PEDS_COST_AGE_CAT_NUM; k++) {
-				fscanf(inputFile, "%lf", &(pedsCostInputs.routineCareCostHIVPositive[ART_ON_STATE][i][j][k][COST_DIR_MED]));
+				inputFile->scan("%lf", &(pedsCostInputs->routineCareCostHIVPositive[ART_ON_STATE][i][j][k][COST_DIR_MED]));
 
 			}
 		}
 		readAndSkipPast2("PedsCostRoutine_HIVpos_onART_nmed", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < GENDER_NUM; j++) {
 			for (k = 0; k < PEDS_COST_AGE_CAT_NUM; k++) {
-				fscanf(inputFile, "%lf", &(pedsCostInputs.routineCareCostHIVPositive[ART_ON_STATE][i][j][k][COST_DIR_NONMED]));
+				inputFile->scan("%lf", &(pedsCostInputs->routineCareCostHIVPositive[ART_ON_STATE][i][j][k][COST_DIR_NONMED]));
 			}
 		}
 		readAndSkipPast2("PedsCostRoutine_HIVpos_onART_time", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < GENDER_NUM; j++) {
 			for (k = 0; k < PEDS_COST_AGE_CAT_NUM; k++) {
-				fscanf(inputFile, "%lf", &(pedsCostInputs.routineCareCostHIVPositive[ART_ON_STATE][i][j][k][COST_TIME]));
+				inputFile->scan("%lf", &(pedsCostInputs->routineCareCostHIVPositive[ART_ON_STATE][i][j][k][COST_TIME]));
 			}
 		}
 		readAndSkipPast2("PedsCostRoutine_HIVpos_onART_indr", CD4_STRATA_STRS[i], inputFile);
 		for (j = 0; j < GENDER_NUM; j++) {
 			for (k = 0; k < PEDS_COST_AGE_CAT_NUM; k++) {
-				fscanf(inputFile, "%lf", &(pedsCostInputs.routineCareCostHIVPositive[ART_ON_STATE][i][j][k][COST_INDIR]));
+				inputFile->scan("%lf", &(pedsCostInputs->routineCareCostHIVPositive[ART_ON_STATE][i][j][k][COST_INDIR]));
 			}
 		}
 	}
 } /* end readPedsCostInputs */
 
 /* readEIDInputs reads data from the EID tab of the input sheet */
-void SimContext::readEIDInputs() {
+void SimContext::readEIDInputs(InputReader *inputFile) {
 	int tempBool, i;
 	char tmpBuf[256];
 
 	// read in enable EID HIV testing module
 	readAndSkipPast( "EnableHIVtestEID", inputFile );
-	fscanf( inputFile, "%d", &tempBool);
-	eidInputs.enableHIVTestingEID = (bool) tempBool;
-	if (!pedsInputs.enablePediatricsModel)
-		eidInputs.enableHIVTestingEID = false;
+	inputFile->scan( "%d", &tempBool);
+	eidInputs->enableHIVTestingEID = (bool) tempBool;
+	if (!pedsInputs->enablePediatricsModel)
+		eidInputs->enableHIVTestingEID = false;
+	eidInputs->isTabSkipped = !eidInputs->enableHIVTestingEID && skipDisabledTab(&SimContext::readEIDInputs, inputFile);
+	if (eidInputs->isTabSkipped)
+		return;
 	// read in whether to use alt HIV+ stopping rule
 	readAndSkipPast( "AltStopRuleEnableEID", inputFile );
-	fscanf( inputFile, "%d", &tempBool);
-	eidInputs.useAlternateStoppingRuleEID = (bool) tempBool;
-	if (eidInputs.enableHIVTestingEID != true)
-		eidInputs.useAlternateStoppingRuleEID = false;
+	inputFile->scan( "%d", &tempBool);
+	eidInputs->useAlternateStoppingRuleEID = (bool) tempBool;
+	if (eidInputs->enableHIVTestingEID != true)
+		eidInputs->useAlternateStoppingRuleEID = false;
 	readAndSkipPast( "AltStopRuleTotHIVEID", inputFile );
-	fscanf( inputFile, "%ld", &eidInputs.totalCohortsWithHIVPositiveLimitEID );
+	inputFile->scan( "%d", &eidInputs->totalCohortsWithHIVPositiveLimitEID );
 	readAndSkipPast( "AltStopRuleTotCohortEID", inputFile );
-	fscanf( inputFile, "%ld", &eidInputs.totalCohortsLimitEID );
+	inputFile->scan( "%d", &eidInputs->totalCohortsLimitEID );
 
 	//Read in Testing Administration inputs for EID
 	readAndSkipPast( "EIDTestingAdminAssayUnknownPos", inputFile );
 	for(i = 0; i < EID_NUM_ASSAYS; i++)
-		fscanf( inputFile, "%d", &eidInputs.testingAdminAssay[PEDS_MATERNAL_KNOWLEDGE_NOT_KNOWN_POSITIVE][i]);
+		inputFile->scan( "%d", &eidInputs->testingAdminAssay[PEDS_MATERNAL_KNOWLEDGE_NOT_KNOWN_POSITIVE][i]);
 	readAndSkipPast( "EIDTestingAdminAgeUnknownPos", inputFile );
 	for(i = 0; i < EID_NUM_ASSAYS; i++)
-		fscanf( inputFile, "%d", &eidInputs.testingAdminAge[PEDS_MATERNAL_KNOWLEDGE_NOT_KNOWN_POSITIVE][i]);
+		inputFile->scan( "%d", &eidInputs->testingAdminAge[PEDS_MATERNAL_KNOWLEDGE_NOT_KNOWN_POSITIVE][i]);
 	readAndSkipPast( "EIDTestingAdminProbPresentUnknownPos", inputFile );
 	for(i = 0; i < EID_NUM_ASSAYS; i++)
-		fscanf( inputFile, "%lf", &eidInputs.testingAdminProbPresent[PEDS_MATERNAL_KNOWLEDGE_NOT_KNOWN_POSITIVE][i]);
+		inputFile->scan( "%lf", &eidInputs->testingAdminProbPresent[PEDS_MATERNAL_KNOWLEDGE_NOT_KNOWN_POSITIVE][i]);
 	readAndSkipPast( "EIDTestingAdminProbNonMaternalUnknownPos", inputFile );
 	for(i = 0; i < EID_NUM_ASSAYS; i++)
-		fscanf( inputFile, "%lf", &eidInputs.testingAdminProbNonMaternalCaregiver[PEDS_MATERNAL_KNOWLEDGE_NOT_KNOWN_POSITIVE][i]);
+		inputFile->scan( "%lf", &eidInputs->testingAdminProbNonMaternalCaregiver[PEDS_MATERNAL_KNOWLEDGE_NOT_KNOWN_POSITIVE][i]);
 	readAndSkipPast( "EIDTestingAdminEIDVisitUnknownPos", inputFile );
 	for(i = 0; i < EID_NUM_ASSAYS; i++){
-		fscanf( inputFile, "%d", &tempBool);
-		eidInputs.testingAdminIsEIDVisit[PEDS_MATERNAL_KNOWLEDGE_NOT_KNOWN_POSITIVE][i] = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		eidInputs->testingAdminIsEIDVisit[PEDS_MATERNAL_KNOWLEDGE_NOT_KNOWN_POSITIVE][i] = (bool) tempBool;
 	}
 	readAndSkipPast( "EIDTestingAdminReofferUnknownPos", inputFile );
 	for(i = 0; i < EID_NUM_ASSAYS; i++){
-		fscanf( inputFile, "%d", &tempBool);
-		eidInputs.testingAdminReofferTestIfMissed[PEDS_MATERNAL_KNOWLEDGE_NOT_KNOWN_POSITIVE][i] = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		eidInputs->testingAdminReofferTestIfMissed[PEDS_MATERNAL_KNOWLEDGE_NOT_KNOWN_POSITIVE][i] = (bool) tempBool;
 	}
 
 
 	readAndSkipPast( "EIDTestingAdminAssayKnownPos", inputFile );
 	for(i = 0; i < EID_NUM_ASSAYS; i++)
-		fscanf( inputFile, "%d", &eidInputs.testingAdminAssay[PEDS_MATERNAL_KNOWLEDGE_KNOWN_POSITIVE][i]);
+		inputFile->scan( "%d", &eidInputs->testingAdminAssay[PEDS_MATERNAL_KNOWLEDGE_KNOWN_POSITIVE][i]);
 	readAndSkipPast( "EIDTestingAdminAgeKnownPos", inputFile );
 	for(i = 0; i < EID_NUM_ASSAYS; i++)
-		fscanf( inputFile, "%d", &eidInputs.testingAdminAge[PEDS_MATERNAL_KNOWLEDGE_KNOWN_POSITIVE][i]);
+		inputFile->scan( "%d", &eidInputs->testingAdminAge[PEDS_MATERNAL_KNOWLEDGE_KNOWN_POSITIVE][i]);
 	readAndSkipPast( "EIDTestingAdminProbPresentKnownPos", inputFile );
 	for(i = 0; i < EID_NUM_ASSAYS; i++)
-		fscanf( inputFile, "%lf", &eidInputs.testingAdminProbPresent[PEDS_MATERNAL_KNOWLEDGE_KNOWN_POSITIVE][i]);
+		inputFile->scan( "%lf", &eidInputs->testingAdminProbPresent[PEDS_MATERNAL_KNOWLEDGE_KNOWN_POSITIVE][i]);
 	readAndSkipPast( "EIDTestingAdminProbNonMaternalKnownPos", inputFile );
 	for(i = 0; i < EID_NUM_ASSAYS; i++)
-		fscanf( inputFile, "%lf", &eidInputs.testingAdminProbNonMaternalCaregiver[PEDS_MATERNAL_KNOWLEDGE_KNOWN_POSITIVE][i]);
+		inputFile->scan( "%lf", &eidInputs->testingAdminProbNonMaternalCaregiver[PEDS_MATERNAL_KNOWLEDGE_KNOWN_POSITIVE][i]);
 	readAndSkipPast( "EIDTestingAdminEIDVisitKnownPos", inputFile );
 	for(i = 0; i < EID_NUM_ASSAYS; i++){
-		fscanf( inputFile, "%d", &tempBool);
-		eidInputs.testingAdminIsEIDVisit[PEDS_MATERNAL_KNOWLEDGE_KNOWN_POSITIVE][i] = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		eidInputs->testingAdminIsEIDVisit[PEDS_MATERNAL_KNOWLEDGE_KNOWN_POSITIVE][i] = (bool) tempBool;
 	}
 	readAndSkipPast( "EIDTestingAdminReofferKnownPos", inputFile );
 	for(i = 0; i < EID_NUM_ASSAYS; i++){
-		fscanf( inputFile, "%d", &tempBool);
-		eidInputs.testingAdminReofferTestIfMissed[PEDS_MATERNAL_KNOWLEDGE_KNOWN_POSITIVE][i] = (bool) tempBool;
+		inputFile->scan( "%d", &tempBool);
+		eidInputs->testingAdminReofferTestIfMissed[PEDS_MATERNAL_KNOWLEDGE_KNOWN_POSITIVE][i] = (bool) tempBool;
 	}
 
 	//Read in age of seroreversion
 	readAndSkipPast( "EIDAgeSeroreversion", inputFile );
-	fscanf( inputFile, "%d %d", &eidInputs.ageOfSeroreversionMean, &eidInputs.ageOfSeroreversionStdDev);
+	inputFile->scan( "%d %d", &eidInputs->ageOfSeroreversionMean, &eidInputs->ageOfSeroreversionStdDev);
 
 	//Read in prob multipliers
 	readAndSkipPast( "EIDMultProbPresentIfMissedVisit", inputFile );
-	fscanf( inputFile, "%lf", &eidInputs.probMultMissedVisit);
+	inputFile->scan( "%lf", &eidInputs->probMultMissedVisit);
 	readAndSkipPast( "EIDMultProbOfferIfNonMaternal", inputFile );
-	fscanf( inputFile, "%lf", &eidInputs.probMultNonMaternalCaregiver);
+	inputFile->scan( "%lf", &eidInputs->probMultNonMaternalCaregiver);
 	readAndSkipPast( "EIDProbKnowledgePriorResult", inputFile );
-	fscanf( inputFile, "%lf", &eidInputs.probKnowedgePriorResult);
+	inputFile->scan( "%lf", &eidInputs->probKnowedgePriorResult);
 
 	//Read in visit costs
 	readAndSkipPast( "EIDCostVisit", inputFile );
 	for(i = 0; i < EID_COST_VISIT_NUM; i++)
-		fscanf( inputFile, "%lf", &eidInputs.costVisit[i]);
+		inputFile->scan( "%lf", &eidInputs->costVisit[i]);
 
 	/** Pediatric HIV TEST Cohort Characteristics */
 	readAndSkipPast( "EIDProbDetectionOnOI", inputFile );
 	for (i = 0; i < OI_NUM; ++i) {
-		fscanf( inputFile, "%lf", &eidInputs.probHIVDetectionWithOI[i] );
+		inputFile->scan( "%lf", &eidInputs->probHIVDetectionWithOI[i] );
 	}
 
 	readAndSkipPast( "EIDProbOIDetectionConfirmedLabTest", inputFile );
-	fscanf( inputFile, "%lf", &eidInputs.probHIVDetectionWithOIConfirmedByLab );
+	inputFile->scan( "%lf", &eidInputs->probHIVDetectionWithOIConfirmedByLab );
 
 	readAndSkipPast( "EIDOILabTestMonthsThreshold", inputFile );
-	fscanf( inputFile, "%d", &eidInputs.hivDetectionWithOIMonthsThreshold );
+	inputFile->scan( "%d", &eidInputs->hivDetectionWithOIMonthsThreshold );
 
 	readAndSkipPast( "EIDOIAssayUnknownPos", inputFile );
-	fscanf( inputFile, "%d %d", &eidInputs.hivDetectionWithOIAssayBeforeN1[PEDS_MATERNAL_KNOWLEDGE_NOT_KNOWN_POSITIVE],
-			&eidInputs.hivDetectionWithOIAssayAfterN1[PEDS_MATERNAL_KNOWLEDGE_NOT_KNOWN_POSITIVE]);
+	inputFile->scan( "%d %d", &eidInputs->hivDetectionWithOIAssayBeforeN1[PEDS_MATERNAL_KNOWLEDGE_NOT_KNOWN_POSITIVE],
+			&eidInputs->hivDetectionWithOIAssayAfterN1[PEDS_MATERNAL_KNOWLEDGE_NOT_KNOWN_POSITIVE]);
 
 	readAndSkipPast( "EIDOIAssayKnownPos", inputFile );
-	fscanf( inputFile, "%d %d", &eidInputs.hivDetectionWithOIAssayBeforeN1[PEDS_MATERNAL_KNOWLEDGE_KNOWN_POSITIVE],
-			&eidInputs.hivDetectionWithOIAssayAfterN1[PEDS_MATERNAL_KNOWLEDGE_KNOWN_POSITIVE]);
+	inputFile->scan( "%d %d", &eidInputs->hivDetectionWithOIAssayBeforeN1[PEDS_MATERNAL_KNOWLEDGE_KNOWN_POSITIVE],
+			&eidInputs->hivDetectionWithOIAssayAfterN1[PEDS_MATERNAL_KNOWLEDGE_KNOWN_POSITIVE]);
 
 	/** Infant HIV Proph */
 
 	for (int prophNum = 0; prophNum < INFANT_HIV_PROPHS_NUM; ++prophNum){
-        EIDInputs::InfantHIVProph &infantProph = eidInputs.infantHIVProphs[prophNum];
+        EIDInputs::InfantHIVProph &infantProph = eidInputs->infantHIVProphs[prophNum];
 
         // Eligibility
         sprintf(tmpBuf, "InfantHIVProph%dEnable", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
-        fscanf( inputFile, "%d", &tempBool);
+        inputFile->scan( "%d", &tempBool);
         infantProph.infantProphEnabled = (bool) tempBool;
 
         sprintf(tmpBuf, "InfantHIVProph%dMaxAge", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
-        fscanf( inputFile, "%d", &infantProph.infantProphMaxAge);
+        inputFile->scan( "%d", &infantProph.infantProphMaxAge);
 
         sprintf(tmpBuf, "InfantHIVProph%dMaternalHIVStatusKnown", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
-        fscanf( inputFile, "%d", &infantProph.infantProphEligibilityMaternalStatusKnown);
+        inputFile->scan( "%d", &infantProph.infantProphEligibilityMaternalStatusKnown);
         sprintf(tmpBuf, "InfantHIVProph%dMaternalHIVStatusPositive", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
-        fscanf( inputFile, "%d", &infantProph.infantProphEligibilityMaternalStatusPos);
+        inputFile->scan( "%d", &infantProph.infantProphEligibilityMaternalStatusPos);
         sprintf(tmpBuf, "InfantHIVProph%dMotherOnART", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
-        fscanf( inputFile, "%d", &infantProph.infantProphEligibilityMotherOnART);
+        inputFile->scan( "%d", &infantProph.infantProphEligibilityMotherOnART);
         sprintf(tmpBuf, "InfantHIVProph%dMaternalVSKnownDelivery", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
-        fscanf( inputFile, "%d", &infantProph.infantProphEligibilityMaternalVSKnownDelivery);
+        inputFile->scan( "%d", &infantProph.infantProphEligibilityMaternalVSKnownDelivery);
         sprintf(tmpBuf, "InfantHIVProph%dMotherSuppressedDelivery", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
-        fscanf( inputFile, "%d", &infantProph.infantProphEligibilityMotherSuppressedDelivery);
+        inputFile->scan( "%d", &infantProph.infantProphEligibilityMotherSuppressedDelivery);
         sprintf(tmpBuf, "InfantHIVProph%dMotherHVLHighDelivery", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
-        fscanf( inputFile, "%d", &infantProph.infantProphEligibilityMotherHVLHighDelivery);
+        inputFile->scan( "%d", &infantProph.infantProphEligibilityMotherHVLHighDelivery);
         sprintf(tmpBuf, "InfantHIVProph%dMaternalVSKnown", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
-        fscanf( inputFile, "%d", &infantProph.infantProphEligibilityMaternalVSKnown);
+        inputFile->scan( "%d", &infantProph.infantProphEligibilityMaternalVSKnown);
         sprintf(tmpBuf, "InfantHIVProph%dMotherSuppressed", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
-        fscanf( inputFile, "%d", &infantProph.infantProphEligibilityMotherSuppressed);
+        inputFile->scan( "%d", &infantProph.infantProphEligibilityMotherSuppressed);
         sprintf(tmpBuf, "InfantHIVProph%dMotherHVLHigh", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
-        fscanf( inputFile, "%d", &infantProph.infantProphEligibilityMotherHVLHigh);
+        inputFile->scan( "%d", &infantProph.infantProphEligibilityMotherHVLHigh);
         sprintf(tmpBuf, "InfantHIVProph%dStopOnPosEID", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
-        fscanf( inputFile, "%d", &tempBool);
+        inputFile->scan( "%d", &tempBool);
         infantProph.infantProphEligibilityStopOnPosEID = (bool) tempBool;
 
 	//Administration
         sprintf(tmpBuf, "InfantHIVProph%dAdminProb", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
         for (i = 0; i < INFANT_PROPH_AGES_NUM; ++i) {
-            fscanf( inputFile, "%lf", &infantProph.infantProphProb[i] );
+            inputFile->scan( "%lf", &infantProph.infantProphProb[i] );
         }
         sprintf(tmpBuf, "InfantHIVProph%dAdminEIDNegMonths", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
         for (i = 0; i < INFANT_PROPH_AGES_NUM; ++i) {
-            fscanf( inputFile, "%d", &infantProph.infantProphNegEIDMonths[i] );
+            inputFile->scan( "%d", &infantProph.infantProphNegEIDMonths[i] );
 	}
 
 	//Cost
         sprintf(tmpBuf, "InfantHIVProph%dStartupCost", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
         for (i = 0; i < INFANT_PROPH_COST_AGES_NUM; ++i) {
-            fscanf( inputFile, "%lf", &infantProph.infantProphStartupCost[i] );
+            inputFile->scan( "%lf", &infantProph.infantProphStartupCost[i] );
         }
         sprintf(tmpBuf, "InfantHIVProph%dDoseCost", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
         for (i = 0; i < INFANT_PROPH_COST_AGES_NUM; ++i) {
-            fscanf( inputFile, "%lf", &infantProph.infantProphDoseCost[i] );
+            inputFile->scan( "%lf", &infantProph.infantProphDoseCost[i] );
         }
         sprintf(tmpBuf, "InfantHIVProph%dEffHorizon", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
-        fscanf( inputFile, "%d", &infantProph.infantProphEffHorizon);
+        inputFile->scan( "%d", &infantProph.infantProphEffHorizon);
         sprintf(tmpBuf, "InfantHIVProph%dDecayTime", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
-        fscanf( inputFile, "%d", &infantProph.infantProphDecayTime);
+        inputFile->scan( "%d", &infantProph.infantProphDecayTime);
         sprintf(tmpBuf, "InfantHIVProph%dProbSubsequentEff", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
-        fscanf( inputFile, "%lf", &infantProph.infantProphProbEff);
+        inputFile->scan( "%lf", &infantProph.infantProphProbEff);
 
 	//Tox
         sprintf(tmpBuf, "InfantHIVProph%dMajorTox", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
-        fscanf( inputFile, "%lf", &infantProph.infantProphMajorToxProb);
-        fscanf( inputFile, "%lf", &infantProph.infantProphMajorToxQOLMod);
-        fscanf( inputFile, "%lf", &infantProph.infantProphMajorToxCost);
-        fscanf( inputFile, "%lf", &infantProph.infantProphMajorToxDeathRateRatio);
-		fscanf( inputFile, "%d", &infantProph.infantProphMajorToxDeathRateRatioDuration);
-        fscanf( inputFile, "%lf", &infantProph.infantProphMajorToxDeathCost);
-        fscanf( inputFile, "%d", &tempBool);
+        inputFile->scan( "%lf", &infantProph.infantProphMajorToxProb);
+        inputFile->scan( "%lf", &infantProph.infantProphMajorToxQOLMod);
+        inputFile->scan( "%lf", &infantProph.infantProphMajorToxCost);
+        inputFile->scan( "%lf", &infantProph.infantProphMajorToxDeathRateRatio);
+		inputFile->scan( "%d", &infantProph.infantProphMajorToxDeathRateRatioDuration);
+        inputFile->scan( "%lf", &infantProph.infantProphMajorToxDeathCost);
+        inputFile->scan( "%d", &tempBool);
         infantProph.infantProphMajorToxStopOnTox = (bool) tempBool;
 
         sprintf(tmpBuf, "InfantHIVProph%dMinorTox", prophNum);
         readAndSkipPast( tmpBuf, inputFile );
-        fscanf( inputFile, "%lf", &infantProph.infantProphMinorToxProb);
-        fscanf( inputFile, "%lf", &infantProph.infantProphMinorToxQOLMod);
-        fscanf( inputFile, "%lf", &infantProph.infantProphMinorToxCost);
+        inputFile->scan( "%lf", &infantProph.infantProphMinorToxProb);
+        inputFile->scan( "%lf", &infantProph.infantProphMinorToxQOLMod);
+        inputFile->scan( "%lf", &infantProph.infantProphMinorToxCost);
 
 
 	//PP VTHIV mult
 		sprintf(tmpBuf,"InfantHIVProph%dPPVTHIVThreshold", prophNum );
 		readAndSkipPast( tmpBuf, inputFile);
-		fscanf( inputFile, "%d", &infantProph.infantProphVTHIVPPMultAgeThreshold);
+		inputFile->scan( "%d", &infantProph.infantProphVTHIVPPMultAgeThreshold);
 
 		sprintf(tmpBuf, "InfantHIVProph%dPPVTHIVMultOnARTPre", prophNum);
 		readAndSkipPast2( tmpBuf, "Suppressed", inputFile);
 		for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-			fscanf(inputFile,"%lf", &infantProph.infantProphVTHIVPPMultMotherOnARTSuppressed[i][0]);
+			inputFile->scan("%lf", &infantProph.infantProphVTHIVPPMultMotherOnARTSuppressed[i][0]);
 
 		sprintf(tmpBuf, "InfantHIVProph%dPPVTHIVMultOnARTPre", prophNum);
 		readAndSkipPast2( tmpBuf, "NotSuppressedLowHVL", inputFile);
 		for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-			fscanf(inputFile,"%lf", &infantProph.infantProphVTHIVPPMultMotherOnARTNotSuppressedLowHVL[i][0]);
+			inputFile->scan("%lf", &infantProph.infantProphVTHIVPPMultMotherOnARTNotSuppressedLowHVL[i][0]);
 		sprintf(tmpBuf,"InfantHIVProph%dPPVTHIVMultOnARTPre", prophNum);
 		readAndSkipPast2( tmpBuf, "NotSuppressedHighHVL", inputFile);
 		for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-			fscanf(inputFile,"%lf", &infantProph.infantProphVTHIVPPMultMotherOnARTNotSuppressedHighHVL[i][0]);
+			inputFile->scan("%lf", &infantProph.infantProphVTHIVPPMultMotherOnARTNotSuppressedHighHVL[i][0]);
 
 		sprintf(tmpBuf, "InfantHIVProph%dPPVTHIVMultOffARTPre", prophNum);
 		readAndSkipPast2( tmpBuf, "EBF", inputFile);
 		for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++){
-			fscanf(inputFile,"%lf", &infantProph.infantProphVTHIVPPMultMotherOffART[i][PEDS_BF_EXCL][0]);
+			inputFile->scan("%lf", &infantProph.infantProphVTHIVPPMultMotherOffART[i][PEDS_BF_EXCL][0]);
 		}
 		sprintf(tmpBuf, "InfantHIVProph%dPPVTHIVMultOffARTPre", prophNum);
 		readAndSkipPast2( tmpBuf, "MBF", inputFile);
 		for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++){
-			fscanf(inputFile,"%lf", &infantProph.infantProphVTHIVPPMultMotherOffART[i][PEDS_BF_MIXED][0]);
+			inputFile->scan("%lf", &infantProph.infantProphVTHIVPPMultMotherOffART[i][PEDS_BF_MIXED][0]);
 		}
 		sprintf(tmpBuf, "InfantHIVProph%dPPVTHIVMultOffARTPre", prophNum);
 		readAndSkipPast2( tmpBuf, "CBF",inputFile);
 		for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++){
-			fscanf(inputFile,"%lf", &infantProph.infantProphVTHIVPPMultMotherOffART[i][PEDS_BF_COMP][0]);
+			inputFile->scan("%lf", &infantProph.infantProphVTHIVPPMultMotherOffART[i][PEDS_BF_COMP][0]);
 		}
 		for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++){
 			infantProph.infantProphVTHIVPPMultMotherOffART[i][PEDS_BF_REPL][0] = 0.0;
@@ -5189,30 +6131,30 @@ void SimContext::readEIDInputs() {
 		sprintf(tmpBuf, "InfantHIVProph%dPPVTHIVMultOnARTPost", prophNum);
 		readAndSkipPast2( tmpBuf, "Suppressed", inputFile);
 		for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-			fscanf(inputFile,"%lf", &infantProph.infantProphVTHIVPPMultMotherOnARTSuppressed[i][1]);
+			inputFile->scan("%lf", &infantProph.infantProphVTHIVPPMultMotherOnARTSuppressed[i][1]);
 		sprintf(tmpBuf, "InfantHIVProph%dPPVTHIVMultOnARTPost", prophNum);
 		readAndSkipPast2( tmpBuf, "NotSuppressedLowHVL", inputFile);
 		for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-			fscanf(inputFile,"%lf", &infantProph.infantProphVTHIVPPMultMotherOnARTNotSuppressedLowHVL[i][1]);
+			inputFile->scan("%lf", &infantProph.infantProphVTHIVPPMultMotherOnARTNotSuppressedLowHVL[i][1]);
 		sprintf(tmpBuf, "InfantHIVProph%dPPVTHIVMultOnARTPost", prophNum);
 		readAndSkipPast2( tmpBuf, "NotSuppressedHighHVL", inputFile);
 		for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++)
-			fscanf(inputFile,"%lf", &infantProph.infantProphVTHIVPPMultMotherOnARTNotSuppressedHighHVL[i][1]);
+			inputFile->scan("%lf", &infantProph.infantProphVTHIVPPMultMotherOnARTNotSuppressedHighHVL[i][1]);
 
 		sprintf(tmpBuf, "InfantHIVProph%dPPVTHIVMultOffARTPost", prophNum);
 		readAndSkipPast2( tmpBuf, "EBF", inputFile);
 		for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++){
-			fscanf(inputFile,"%lf", &infantProph.infantProphVTHIVPPMultMotherOffART[i][PEDS_BF_EXCL][1]);
+			inputFile->scan("%lf", &infantProph.infantProphVTHIVPPMultMotherOffART[i][PEDS_BF_EXCL][1]);
 		}
 		sprintf(tmpBuf, "InfantHIVProph%dPPVTHIVMultOffARTPost", prophNum);
 		readAndSkipPast2( tmpBuf, "MBF", inputFile);
 		for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++){
-			fscanf(inputFile,"%lf", &infantProph.infantProphVTHIVPPMultMotherOffART[i][PEDS_BF_MIXED][1]);
+			inputFile->scan("%lf", &infantProph.infantProphVTHIVPPMultMotherOffART[i][PEDS_BF_MIXED][1]);
 		}
 		sprintf(tmpBuf, "InfantHIVProph%dPPVTHIVMultOffARTPost", prophNum);
 		readAndSkipPast2( tmpBuf, "CBF", inputFile);
 		for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++){
-			fscanf(inputFile,"%lf", &infantProph.infantProphVTHIVPPMultMotherOffART[i][PEDS_BF_COMP][1]);
+			inputFile->scan("%lf", &infantProph.infantProphVTHIVPPMultMotherOffART[i][PEDS_BF_COMP][1]);
 		}
 		for (int i = 0; i < PEDS_MATERNAL_STATUS_NUM; i++){
 			infantProph.infantProphVTHIVPPMultMotherOffART[i][PEDS_BF_REPL][1] = 0.0;
@@ -5221,160 +6163,163 @@ void SimContext::readEIDInputs() {
 
 
 	for (int testNum = 0; testNum < EID_NUM_TESTS; testNum++) {
-		EIDInputs::EIDTest &eidTest = eidInputs.EIDTests[testNum];
+		EIDInputs::EIDTest &eidTest = eidInputs->EIDTests[testNum];
 
 		//read in whether this tests costs (cost of test, result return etc) should count in the EID costs or EID test costs category. If not they are counted as misc costs
 		sprintf(tmpBuf, "EIDHIVTest%dCountTowardEIDCosts", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
-		fscanf( inputFile, "%d", &tempBool);
+		inputFile->scan( "%d", &tempBool);
 		eidTest.includeInEIDCosts = (bool) tempBool;
 
 		//Read in probabilities of being offered and accepting the test
 		sprintf(tmpBuf, "EIDHIVTest%dProbOfferedTest", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
-		fscanf( inputFile, "%lf", &eidTest.EIDTestOfferProb);
+		inputFile->scan( "%lf", &eidTest.EIDTestOfferProb);
 
 		sprintf(tmpBuf, "EIDHIVTest%dProbAcceptTest", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
-		fscanf( inputFile, "%lf", &eidTest.EIDTestAcceptProb);
+		inputFile->scan( "%lf", &eidTest.EIDTestAcceptProb);
 
 		//Read in test costs
 		sprintf(tmpBuf, "EIDHIVTest%dTestCost", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
-		fscanf( inputFile, "%lf", &eidTest.EIDTestCost);
+		inputFile->scan( "%lf", &eidTest.EIDTestCost);
 
 		sprintf(tmpBuf, "EIDHIVTest%dCostResult", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
-		fscanf( inputFile, "%lf", &eidTest.EIDTestResultReturnCost);
+		inputFile->scan( "%lf", &eidTest.EIDTestResultReturnCost);
 
 		sprintf(tmpBuf, "EIDHIVTest%dCostNegResult", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
-		fscanf( inputFile, "%lf", &eidTest.EIDTestNegativeResultReturnCost);
+		inputFile->scan( "%lf", &eidTest.EIDTestNegativeResultReturnCost);
 
 		sprintf(tmpBuf, "EIDHIVTest%dCostPosResult", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
-		fscanf( inputFile, "%lf", &eidTest.EIDTestPositiveResultReturnCost);
+		inputFile->scan( "%lf", &eidTest.EIDTestPositiveResultReturnCost);
 
 		//read in test characteristics
 		sprintf(tmpBuf, "EIDHIVTest%dResultReturnProbLab", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
-		fscanf( inputFile, "%lf", &eidTest.EIDTestResultReturnProbLab);
+		inputFile->scan( "%lf", &eidTest.EIDTestResultReturnProbLab);
 
 		sprintf(tmpBuf, "EIDHIVTest%dResultReturnProbPatient", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
-		fscanf( inputFile, "%lf", &eidTest.EIDTestResultReturnProbPatient);
+		inputFile->scan( "%lf", &eidTest.EIDTestResultReturnProbPatient);
 
 		sprintf(tmpBuf, "EIDHIVTest%dResultReturnTime", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
-		fscanf( inputFile, "%d %d", &eidTest.EIDTestReturnTimeMean, &eidTest.EIDTestReturnTimeStdDev);
+		inputFile->scan( "%d %d", &eidTest.EIDTestReturnTimeMean, &eidTest.EIDTestReturnTimeStdDev);
 
 		//Sensitivity
 		sprintf(tmpBuf, "EIDHIVTest%dSensitivityIU", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
 		for(i=0; i<EID_TEST_AGE_CATEGORY_NUM;i++)
-			fscanf( inputFile, "%lf", &eidTest.EIDSensitivityIU[i]);
+			inputFile->scan( "%lf", &eidTest.EIDSensitivityIU[i]);
 
 		sprintf(tmpBuf, "EIDHIVTest%dSensitivityIP", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
 		for(i=0; i<EID_TEST_AGE_CATEGORY_NUM;i++)
-			fscanf( inputFile, "%lf", &eidTest.EIDSensitivityIP[i]);
+			inputFile->scan( "%lf", &eidTest.EIDSensitivityIP[i]);
 
 		sprintf(tmpBuf, "EIDHIVTest%dSensitivityPPBeforeSR", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
 		for(i=0; i<EID_TEST_AGE_CATEGORY_NUM;i++)
-			fscanf( inputFile, "%lf", &eidTest.EIDSensitivityPPBeforeSRMotherInfectedPreDelivery[i]);
+			inputFile->scan( "%lf", &eidTest.EIDSensitivityPPBeforeSRMotherInfectedPreDelivery[i]);
 
 		sprintf(tmpBuf, "EIDHIVTest%dSensitivityPPAfterSR", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
 		for(i=0; i<EID_TEST_AGE_CATEGORY_NUM;i++)
-			fscanf( inputFile, "%lf", &eidTest.EIDSensitivityPPAfterSRMotherInfectedPreDelivery[i]);
+			inputFile->scan( "%lf", &eidTest.EIDSensitivityPPAfterSRMotherInfectedPreDelivery[i]);
 
 		sprintf(tmpBuf, "EIDHIVTest%dSensitivityPPDuringBF", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
 		for(i=0; i<EID_TEST_AGE_CATEGORY_NUM;i++)
-			fscanf( inputFile, "%lf", &eidTest.EIDSensitivityPPMotherInfectedPostDelivery[i]);
+			inputFile->scan( "%lf", &eidTest.EIDSensitivityPPMotherInfectedPostDelivery[i]);
 
 		sprintf(tmpBuf, "EIDHIVTest%dSensitivityMultiplierIfMaternalARTPregnancy", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
 		for(i=0; i<EID_TEST_AGE_CATEGORY_NUM;i++)
-			fscanf( inputFile, "%lf", &eidTest.EIDSensitivityMultiplierMaternalART[i]);
+			inputFile->scan( "%lf", &eidTest.EIDSensitivityMultiplierMaternalART[i]);
 
 		for (int prophNum = 0; prophNum < INFANT_HIV_PROPHS_NUM; ++prophNum){
             sprintf(tmpBuf, "EIDHIVTest%dSensitivityMultiplierInfantHIVProph%d", testNum, prophNum);
             readAndSkipPast( tmpBuf, inputFile );
             for(i=0; i<EID_TEST_AGE_CATEGORY_NUM;i++)
-                fscanf( inputFile, "%lf", &eidTest.EIDSensitivityMultiplierInfantHIVProph[prophNum][i]);
+                inputFile->scan( "%lf", &eidTest.EIDSensitivityMultiplierInfantHIVProph[prophNum][i]);
         }
 
 		//Specificity
 		sprintf(tmpBuf, "EIDHIVTest%dSpecificityHEUBeforeSR", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
 		for(i=0; i<EID_TEST_AGE_CATEGORY_NUM;i++)
-			fscanf( inputFile, "%lf", &eidTest.EIDSpecificityHEUBeforeSRMotherInfectedPreDelivery[i]);
+			inputFile->scan( "%lf", &eidTest.EIDSpecificityHEUBeforeSRMotherInfectedPreDelivery[i]);
 
 		sprintf(tmpBuf, "EIDHIVTest%dSpecificityHEUAfterSR", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
 		for(i=0; i<EID_TEST_AGE_CATEGORY_NUM;i++)
-			fscanf( inputFile, "%lf", &eidTest.EIDSpecificityHEUAfterSRMotherInfectedPreDelivery[i]);
+			inputFile->scan( "%lf", &eidTest.EIDSpecificityHEUAfterSRMotherInfectedPreDelivery[i]);
 
 		sprintf(tmpBuf, "EIDHIVTest%dSpecificityUninfectedMother", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
 		for(i=0; i<EID_TEST_AGE_CATEGORY_NUM;i++)
-			fscanf( inputFile, "%lf", &eidTest.EIDSpecificityMotherUninfected[i]);
+			inputFile->scan( "%lf", &eidTest.EIDSpecificityMotherUninfected[i]);
 
 		sprintf(tmpBuf, "EIDHIVTest%dSpecificityMotherInfectedBF", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
 		for(i=0; i<EID_TEST_AGE_CATEGORY_NUM;i++)
-			fscanf( inputFile, "%lf", &eidTest.EIDSpecificityMotherInfectedPostDelivery[i]);
+			inputFile->scan( "%lf", &eidTest.EIDSpecificityMotherInfectedPostDelivery[i]);
 
 		for (int prophNum = 0; prophNum < INFANT_HIV_PROPHS_NUM; ++prophNum){
             sprintf(tmpBuf, "EIDHIVTest%dSpecificityMultiplierInfantHIVProph%d", testNum, prophNum);
             readAndSkipPast( tmpBuf, inputFile );
             for(i=0; i<EID_TEST_AGE_CATEGORY_NUM;i++)
-                fscanf( inputFile, "%lf", &eidTest.EIDSpecificityMultiplierInfantHIVProph[prophNum][i]);
+                inputFile->scan( "%lf", &eidTest.EIDSpecificityMultiplierInfantHIVProph[prophNum][i]);
         }
 
 		//Confirmatory Tests
 		sprintf(tmpBuf, "EIDHIVTest%dConfAssay", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
-		fscanf( inputFile, "%d %d", &eidTest.EIDFirstConfirmatoryTestAssay, &eidTest.EIDSecondConfirmatoryTestAssay);
+		inputFile->scan( "%d %d", &eidTest.EIDFirstConfirmatoryTestAssay, &eidTest.EIDSecondConfirmatoryTestAssay);
 
 		sprintf(tmpBuf, "EIDHIVTest%dConfDelay", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
-		fscanf( inputFile, "%d %d", &eidTest.EIDFirstConfirmatoryTestDelay, &eidTest.EIDSecondConfirmatoryTestDelay);
+		inputFile->scan( "%d %d", &eidTest.EIDFirstConfirmatoryTestDelay, &eidTest.EIDSecondConfirmatoryTestDelay);
 
 		sprintf(tmpBuf, "EIDHIVTest%dProbLink", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
-		fscanf( inputFile, "%lf", &eidTest.EIDProbLinkage);
+		inputFile->scan( "%lf", &eidTest.EIDProbLinkage);
 
 		sprintf(tmpBuf, "EIDHIVTest%dProbMaternalStatusBecomeKnownUponResult", testNum);
 		readAndSkipPast( tmpBuf, inputFile );
-		fscanf( inputFile, "%lf", &eidTest.EIDProbMaternalStatusKnownOnPosResult);
+		inputFile->scan( "%lf", &eidTest.EIDProbMaternalStatusKnownOnPosResult);
 	} // end reading in EID HIV test inputs 
 } /* end readEIDInputs */
 
 /* readAdolescentInputs reads data from the Adolescent tab of the input sheet */
-void SimContext::readAdolescentInputs() {
+void SimContext::readAdolescentInputs(InputReader *inputFile) {
 	int tempBool, i,j,k;
 	char tmpBuf[256];
 
 	// read in enable Adolescent and age transitions
 	readAndSkipPast( "EnableAdolescent", inputFile );
-	fscanf( inputFile, "%d", &tempBool);
-	adolescentInputs.enableAdolescent = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool);
+	adolescentInputs->enableAdolescent = (bool) tempBool;
+	adolescentInputs->isTabSkipped = !adolescentInputs->enableAdolescent && skipDisabledTab(&SimContext::readAdolescentInputs, inputFile);
+	if (adolescentInputs->isTabSkipped)
+		return;
 
 	readAndSkipPast( "TransitionToAdult", inputFile );
-	fscanf( inputFile, "%d", &tempBool);
-	adolescentInputs.transitionToAdult = (bool) tempBool;
+	inputFile->scan( "%d", &tempBool);
+	adolescentInputs->transitionToAdult = (bool) tempBool;
 	readAndSkipPast( "AgeTransitionToAdult", inputFile );
-	fscanf( inputFile, "%d", &adolescentInputs.ageTransitionToAdult );
+	inputFile->scan( "%d", &adolescentInputs->ageTransitionToAdult );
 
 	readAndSkipPast( "AgeTransitionFromPeds", inputFile );
-	fscanf( inputFile, "%d", &adolescentInputs.ageTransitionFromPeds );
+	inputFile->scan( "%d", &adolescentInputs->ageTransitionFromPeds );
 
 	readAndSkipPast( "AdolescentAgeBounds", inputFile );
 	for (i=0;i<ADOLESCENT_NUM_AGES-1;i++)
-		fscanf( inputFile, "%d", &adolescentInputs.ageBounds[i] );
+		inputFile->scan( "%d", &adolescentInputs->ageBounds[i] );
 
 	//Read in Adolescent Natural History
 	for ( i = CD4_NUM_STRATA - 1; i >= 0; --i ) {
@@ -5382,13 +6327,13 @@ void SimContext::readAdolescentInputs() {
 		for ( j = HVL_NUM_STRATA - 1; j >= HVL_VLO; --j ){
 			readAndSkipPast2( tmpBuf, HVL_STRATA_STRS[j], inputFile );
 			for (k = 0;k<ADOLESCENT_NUM_AGES; k++)
-				fscanf( inputFile, "%lf", &(adolescentInputs.monthlyCD4DeclineMean[i][j][k]) );
+				inputFile->scan( "%lf", &(adolescentInputs->monthlyCD4DeclineMean[i][j][k]) );
 		}	
 		sprintf( tmpBuf, "BslCD4Decl_StdDev_Adolescent_%s", CD4_STRATA_STRS[i]);
 		for ( j = HVL_NUM_STRATA - 1; j >= HVL_VLO; --j ){
 			readAndSkipPast2( tmpBuf, HVL_STRATA_STRS[j], inputFile );
 			for (k = 0;k<ADOLESCENT_NUM_AGES; k++)
-				fscanf( inputFile, "%lf", &(adolescentInputs.monthlyCD4DeclineStdDev[i][j][k]) );
+				inputFile->scan( "%lf", &(adolescentInputs->monthlyCD4DeclineStdDev[i][j][k]) );
 		}	
 	}
 	
@@ -5398,13 +6343,13 @@ void SimContext::readAdolescentInputs() {
 			sprintf(tmpBuf, "Prob_%s_NoHist_OffART_Adolescent", OI_STRS[i]);
 			readAndSkipPast2( tmpBuf,CD4_STRATA_STRS[j], inputFile );
 			for (k = 0; k < ADOLESCENT_NUM_AGES; k++)
-				fscanf( inputFile, "%lf", &adolescentInputs.monthlyOIProbOffART[j][i][HIST_N][k]);
+				inputFile->scan( "%lf", &adolescentInputs->monthlyOIProbOffART[j][i][HIST_N][k]);
 		}
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j) {
 			sprintf(tmpBuf, "Prob_%s_WithHist_OffART_Adolescent", OI_STRS[i]);
 			readAndSkipPast2( tmpBuf,CD4_STRATA_STRS[j], inputFile );
 			for (k = 0; k < ADOLESCENT_NUM_AGES; k++)
-				fscanf( inputFile, "%lf", &adolescentInputs.monthlyOIProbOffART[j][i][HIST_Y][k]);
+				inputFile->scan( "%lf", &adolescentInputs->monthlyOIProbOffART[j][i][HIST_Y][k]);
 		}
 	}
 	for (i = 0; i < OI_NUM; i++){
@@ -5412,30 +6357,30 @@ void SimContext::readAdolescentInputs() {
 			sprintf(tmpBuf, "Prob_%s_NoHist_OnART_Adolescent", OI_STRS[i]);
 			readAndSkipPast2( tmpBuf,CD4_STRATA_STRS[j], inputFile );
 			for (k = 0; k < ADOLESCENT_NUM_AGES; k++)
-				fscanf( inputFile, "%lf", &adolescentInputs.monthlyOIProbOnART[j][i][HIST_N][k]);
+				inputFile->scan( "%lf", &adolescentInputs->monthlyOIProbOnART[j][i][HIST_N][k]);
 
 		}
 		for (j = CD4_NUM_STRATA - 1; j >= 0; --j) {
 			sprintf(tmpBuf, "Prob_%s_WithHist_OnART_Adolescent", OI_STRS[i]);
 			readAndSkipPast2( tmpBuf,CD4_STRATA_STRS[j], inputFile );
 			for (k = 0; k < ADOLESCENT_NUM_AGES; k++)
-				fscanf( inputFile, "%lf", &adolescentInputs.monthlyOIProbOnART[j][i][HIST_Y][k]);
+				inputFile->scan( "%lf", &adolescentInputs->monthlyOIProbOnART[j][i][HIST_Y][k]);
 		}
 	}
 	//HIV and ART death rate ratios
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
 		readAndSkipPast2( "HIVDthRateRatio_Adolescent",CD4_STRATA_STRS[i], inputFile );
 		for (j = 0;j<ADOLESCENT_NUM_AGES;j++)
-			fscanf( inputFile, "%lf", &adolescentInputs.HIVDeathRateRatio[i][j]);
+			inputFile->scan( "%lf", &adolescentInputs->HIVDeathRateRatio[i][j]);
 	}
 	readAndSkipPast( "ARTDthRateRatio_Adolescent", inputFile );
 	for (i = 0;i<ADOLESCENT_NUM_AGES;i++)
-			fscanf( inputFile, "%lf", &adolescentInputs.ARTDeathRateRatio[i]);
+			inputFile->scan( "%lf", &adolescentInputs->ARTDeathRateRatio[i]);
 	//Death rate ratios for generic risk factors 
 	for (i = 0; i<RISK_FACT_NUM; i++){
 		readAndSkipPast2( "GenRiskDthRateRatio_Adolescent",RISK_FACT_STRS[i], inputFile );
 		for(j = 0;j<ADOLESCENT_NUM_AGES;j++){
-			fscanf( inputFile, "%lf", &adolescentInputs.genericRiskDeathRateRatio[i][j]);
+			inputFile->scan( "%lf", &adolescentInputs->genericRiskDeathRateRatio[i][j]);
 		}	
 	}
 
@@ -5443,24 +6388,24 @@ void SimContext::readAdolescentInputs() {
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
 		readAndSkipPast2( "AcuteOIDthRateRatio_Adolescent",CD4_STRATA_STRS[i], inputFile );
 		for (j = 0;j<ADOLESCENT_NUM_AGES;j++)
-			fscanf( inputFile, "%lf", &adolescentInputs.acuteOIDeathRateRatio[i][j]);
+			inputFile->scan( "%lf", &adolescentInputs->acuteOIDeathRateRatio[i][j]);
 	}
 	for (i = CD4_NUM_STRATA - 1; i >= 0; --i) {
 		readAndSkipPast2( "AcuteOIDthRateRatioTB_Adolescent",CD4_STRATA_STRS[i], inputFile );
 		for (j = 0;j<ADOLESCENT_NUM_AGES;j++)
-			fscanf( inputFile, "%lf", &adolescentInputs.acuteOIDeathRateRatioTB[i][j]);
+			inputFile->scan( "%lf", &adolescentInputs->acuteOIDeathRateRatioTB[i][j]);
 	}
 	//Death rate ratios for having a history of a severe OI or TB modeled as a severe OI, and their durations
 	readAndSkipPast("SevrOI_HistDthRateRatio_Adolescent", inputFile);
 	for (i = 0; i<ADOLESCENT_NUM_AGES; i++)
-		fscanf( inputFile, "%lf", &(adolescentInputs.severeOIHistDeathRateRatio[i]));
+		inputFile->scan( "%lf", &(adolescentInputs->severeOIHistDeathRateRatio[i]));
 	readAndSkipPast( "SevrOI_HistEffectDuration_Adolescent", inputFile);
-	fscanf( inputFile, "%d", &(adolescentInputs.severeOIHistEffectDuration));
+	inputFile->scan( "%d", &(adolescentInputs->severeOIHistEffectDuration));
 	readAndSkipPast("TB_OI_HistDthRateRatio_Adolescent", inputFile);
 	for (i = 0; i<ADOLESCENT_NUM_AGES; i++)
-		fscanf( inputFile, "%lf", &(adolescentInputs.TB_OIHistDeathRateRatio[i]));
+		inputFile->scan( "%lf", &(adolescentInputs->TB_OIHistDeathRateRatio[i]));
 	readAndSkipPast( "TB_OI_HistEffectDuration_Adolescent", inputFile);
-	fscanf( inputFile, "%d", &(adolescentInputs.TB_OIHistEffectDuration));
+	inputFile->scan( "%d", &(adolescentInputs->TB_OIHistEffectDuration));
 	
 	
 } /* end readAdolescentInputs */
@@ -5468,208 +6413,416 @@ void SimContext::readAdolescentInputs() {
 
 
 /* readAdolescentARTInputs reads data from the AdolescentART tab of the input sheet */
-void SimContext::readAdolescentARTInputs() {
+void SimContext::readAdolescentARTInputs(InputReader *inputFile) {
 	char tmpBuf[256], buffer[256];
 	int i, j, k, tempBool;
 	double tempCost;
-	FILE *file = inputFile;
+	InputReader *file = inputFile;
+
+	if (!adolescentInputs->enableAdolescent && skipDisabledTab(&SimContext::readAdolescentARTInputs, inputFile))
+		return;
 
 	for (int artNum = 1; artNum <= ART_NUM_LINES; artNum++) {
 		// read in regimen id num and name
 		sprintf(tmpBuf, "ART%dIdAYA", artNum);
 		readAndSkipPast( tmpBuf, file );
 		int idNum;
-		fscanf( file, " %d", &idNum );
+		file->scan( " %d", &idNum );
 		// skip to next regimen if this one is not specified
 		if (idNum == NOT_APPL) {
-			adolescentARTInputs[artNum - 1] = NULL;
+			adolescentARTInputs[artNum - 1].reset();
 			continue;
 		}
 		// create new regimen input structure
-		adolescentARTInputs[artNum - 1] = new AdolescentARTInputs();
+		adolescentARTInputs[artNum - 1] = make_shared<AdolescentARTInputs>();
 		AdolescentARTInputs &artInput = *(adolescentARTInputs[artNum - 1]);
 
 		// read in one-time startup cost
 		sprintf(tmpBuf, "AYAART%dInitCost", artNum);
 		readAndSkipPast( tmpBuf, file );
 		for (i = 0; i < ADOLESCENT_NUM_AGES; i++)
-			fscanf( file, "%lf", &artInput.costInitial[i] );
+			file->scan( "%lf", &artInput.costInitial[i] );
 
 		// read in monthly cost
 		sprintf(tmpBuf, "AYAART%dMthCost", artNum);
 		readAndSkipPast( tmpBuf, file );
 		for (i = 0; i < ADOLESCENT_NUM_AGES; i++)
-			fscanf( file, "%lf", &artInput.costMonthly[i] );
+			file->scan( "%lf", &artInput.costMonthly[i] );
 
 		// read in efficacy time horizon
 		sprintf(tmpBuf, "AYAART%dEffTimeHorizon", artNum);
 		readAndSkipPast( tmpBuf, file );
 		for (i = 0; i < ADOLESCENT_NUM_AGES; i++)
-			fscanf( file, "%d", &artInput.efficacyTimeHorizon[i] );
+			file->scan( "%d", &artInput.efficacyTimeHorizon[i] );
 
 		// read in mth by which all would fail
 		sprintf(tmpBuf, "AYAART%dMthForceFail", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d", &artInput.forceFailAtMonth );	
+		file->scan( "%d", &artInput.forceFailAtMonth );	
 
 		sprintf(tmpBuf, "AYAART%dAgeBounds", artNum);
 		readAndSkipPast( tmpBuf, inputFile );
 		for (i=0;i<ADOLESCENT_NUM_ART_AGES-1;i++)
-			fscanf( inputFile, "%d", &artInput.ageBounds[i]);
+			inputFile->scan( "%d", &artInput.ageBounds[i]);
 
 		// read in CD4 effect on ART
 		sprintf(tmpBuf, "AYAART%dMthStageCD4Eff_Succ", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d %d", &(artInput.stageBoundsCD4ChangeOnSuppART[0]), &(artInput.stageBoundsCD4ChangeOnSuppART[1]));
+		file->scan( "%d %d", &(artInput.stageBoundsCD4ChangeOnSuppART[0]), &(artInput.stageBoundsCD4ChangeOnSuppART[1]));
 		for(i=0; i < 3; i++){
 			sprintf(tmpBuf, "AYAART%dCD4EffSlope_Succ_Mean%d", artNum,i);
 			readAndSkipPast( tmpBuf, file );
 			for (j = 0; j < ADOLESCENT_NUM_ART_AGES; j++)
-				fscanf( file, "%lf",&(artInput.CD4ChangeOnSuppARTMean[i][j]));
+				file->scan( "%lf",&(artInput.CD4ChangeOnSuppARTMean[i][j]));
 
 			sprintf(tmpBuf, "AYAART%dCD4EffSlope_Succ_SD%d", artNum,i);
 			readAndSkipPast( tmpBuf, file );
 			for (j = 0; j < ADOLESCENT_NUM_ART_AGES; j++)
-				fscanf( file, "%lf",&(artInput.CD4ChangeOnSuppARTStdDev[i][j]));
+				file->scan( "%lf",&(artInput.CD4ChangeOnSuppARTStdDev[i][j]));
 		}
 
 		sprintf(tmpBuf, "AYAART%dMthStageCD4Eff_Fail", artNum);
 		readAndSkipPast( tmpBuf, file );
-		fscanf( file, "%d", &(artInput.stageBoundCD4ChangeOnARTFail));
+		file->scan( "%d", &(artInput.stageBoundCD4ChangeOnARTFail));
 		for(i=0; i < 2; i++){
 			sprintf(tmpBuf, "AYAART%dCD4EffMult_Fail%d", artNum,i);
 			readAndSkipPast( tmpBuf,file);
 			for (j = 0; j < ADOLESCENT_NUM_ART_AGES; j++)
-				fscanf( file, "%lf",&(artInput.CD4MultiplierOnFailedART[i][j]));
+				file->scan( "%lf",&(artInput.CD4MultiplierOnFailedART[i][j]));
 		}
 
 		sprintf(tmpBuf, "AYAART%dMthCD4SecStdDev", artNum);
 		readAndSkipPast( tmpBuf, file );
 		for (j = 0; j < ADOLESCENT_NUM_ART_AGES; j++)
-			fscanf( file, "%lf", &artInput.secondaryCD4ChangeOnARTStdDev[j]);
+			file->scan( "%lf", &artInput.secondaryCD4ChangeOnARTStdDev[j]);
 
 		// read in CD4 effect off ART
 		sprintf(tmpBuf, "AYAART%dCD4EffOffART_Supp_PreSetpoint", artNum);
 		readAndSkipPast( tmpBuf, file );
 		for (j = 0; j < ADOLESCENT_NUM_ART_AGES; j++)
-			fscanf( file, "%lf", &(artInput.monthlyCD4MultiplierOffARTSuppPreSetpoint[j]));
+			file->scan( "%lf", &(artInput.monthlyCD4MultiplierOffARTSuppPreSetpoint[j]));
 
 		sprintf(tmpBuf, "AYAART%dCD4EffOffART_Supp_PostSetpoint", artNum);
 		readAndSkipPast( tmpBuf, file );
 		for (j = 0; j < ADOLESCENT_NUM_ART_AGES; j++)
-			fscanf( file, "%lf", &(artInput.monthlyCD4MultiplierOffARTSuppPostSetpoint[j]));
+			file->scan( "%lf", &(artInput.monthlyCD4MultiplierOffARTSuppPostSetpoint[j]));
 
 		sprintf(tmpBuf, "AYAART%dCD4EffOffART_Fail_PreSetpoint", artNum);
 		readAndSkipPast( tmpBuf, file );
 		for (j = 0; j < ADOLESCENT_NUM_ART_AGES; j++)
-			fscanf( file, "%lf", &(artInput.monthlyCD4MultiplierOffARTFailPreSetpoint[j]));
+			file->scan( "%lf", &(artInput.monthlyCD4MultiplierOffARTFailPreSetpoint[j]));
 
 		sprintf(tmpBuf, "AYAART%dCD4EffOffART_Fail_PostSetpoint", artNum);
 		readAndSkipPast( tmpBuf, file );
 		for (j = 0; j < ADOLESCENT_NUM_ART_AGES; j++)
-			fscanf( file, "%lf", &(artInput.monthlyCD4MultiplierOffARTFailPostSetpoint[j]));
+			file->scan( "%lf", &(artInput.monthlyCD4MultiplierOffARTFailPostSetpoint[j]));
 
 		// read in HVL change probability
 		sprintf(tmpBuf, "AYAART%dHVLChgProb_Supp", artNum);
 		readAndSkipPast( tmpBuf, file );
 		for (j = 0; j < ADOLESCENT_NUM_ART_AGES; j++)
-			fscanf( file, "%lf", &(artInput.monthlyProbHVLChangeSupp[j]));
+			file->scan( "%lf", &(artInput.monthlyProbHVLChangeSupp[j]));
 
 		sprintf(tmpBuf, "AYAART%dHVLChgProb_SuppStrataChg", artNum);
 		readAndSkipPast( tmpBuf, file );
 		for (j = 0; j < ADOLESCENT_NUM_ART_AGES; j++)
-			fscanf( file, "%d", &(artInput.monthlyNumStrataHVLChangeSupp[j]));
+			file->scan( "%d", &(artInput.monthlyNumStrataHVLChangeSupp[j]));
 
 		sprintf(tmpBuf, "AYAART%dHVLChgProb_Fail", artNum);
 		readAndSkipPast( tmpBuf, file );
 		for (j = 0; j < ADOLESCENT_NUM_ART_AGES; j++)
-			fscanf( file, "%lf", &(artInput.monthlyProbHVLChangeFail[j]));
+			file->scan( "%lf", &(artInput.monthlyProbHVLChangeFail[j]));
 
 		sprintf(tmpBuf, "AYAART%dHVLChgProb_FailStrataChg", artNum);
 		readAndSkipPast( tmpBuf, file );
 		for (j = 0; j < ADOLESCENT_NUM_ART_AGES; j++)
-			fscanf( file, "%d", &(artInput.monthlyNumStrataHVLChangeFail[j]));
+			file->scan( "%d", &(artInput.monthlyNumStrataHVLChangeFail[j]));
 
 
 		for (i = 0; i < ADOLESCENT_NUM_ART_AGES; i++){
 			sprintf(tmpBuf, "AYAART%dPropMthCostNonResponders_Age%d", artNum, i);
 			readAndSkipPast(tmpBuf, file);
-			fscanf(file, "%lf", &(artInput.propMthCostNonResponders[i]));
+			file->scan("%lf", &(artInput.propMthCostNonResponders[i]));
 
 			sprintf(tmpBuf, "AYAART%dProbRestartRegimen_Age%d", artNum, i);
 			readAndSkipPast(tmpBuf, file);
-			fscanf(file, "%lf %lf %lf", &(artInput.probRestartARTRegimenAfterFailure[RESP_TYPE_FULL][i]),&(artInput.probRestartARTRegimenAfterFailure[RESP_TYPE_PARTIAL][i]),&(artInput.probRestartARTRegimenAfterFailure[RESP_TYPE_NON][i]));
+			file->scan("%lf %lf %lf", &(artInput.probRestartARTRegimenAfterFailure[RESP_TYPE_FULL][i]),&(artInput.probRestartARTRegimenAfterFailure[RESP_TYPE_PARTIAL][i]),&(artInput.probRestartARTRegimenAfterFailure[RESP_TYPE_NON][i]));
 
 			sprintf(tmpBuf, "AYAART%dHetPropRespRegCoeff_Age%d", artNum, i);
 			readAndSkipPast(tmpBuf, file);
-			fscanf(file, "%lf %lf", &(artInput.propRespondARTRegimenLogitMean[i]), &(artInput.propRespondARTRegimenLogitStdDev[i]));
+			file->scan("%lf %lf", &(artInput.propRespondARTRegimenLogitMean[i]), &(artInput.propRespondARTRegimenLogitStdDev[i]));
 
 			sprintf(tmpBuf, "AYAART%dHetOutcomes", artNum);
 			readAndSkipPast(tmpBuf, file);
 			readAndSkipPast("Supp",file);
-			fscanf(file, "%lf %lf %lf %lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_SUPP][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_SUPP][1][i]),&(artInput.responseTypeValues[HET_OUTCOME_SUPP][0][i]),&(artInput.responseTypeValues[HET_OUTCOME_SUPP][1][i]), &(artInput.responseTypeExponents[HET_OUTCOME_SUPP][i]));
+			file->scan("%lf %lf %lf %lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_SUPP][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_SUPP][1][i]),&(artInput.responseTypeValues[HET_OUTCOME_SUPP][0][i]),&(artInput.responseTypeValues[HET_OUTCOME_SUPP][1][i]), &(artInput.responseTypeExponents[HET_OUTCOME_SUPP][i]));
 			readAndSkipPast(tmpBuf, file);
 			readAndSkipPast("LateFail",file);
-			fscanf(file, "%lf %lf %lf %lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_LATEFAIL][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_LATEFAIL][1][i]),&(artInput.responseTypeValues[HET_OUTCOME_LATEFAIL][0][i]),&(artInput.responseTypeValues[HET_OUTCOME_LATEFAIL][1][i]), &(artInput.responseTypeExponents[HET_OUTCOME_LATEFAIL][i]));
+			file->scan("%lf %lf %lf %lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_LATEFAIL][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_LATEFAIL][1][i]),&(artInput.responseTypeValues[HET_OUTCOME_LATEFAIL][0][i]),&(artInput.responseTypeValues[HET_OUTCOME_LATEFAIL][1][i]), &(artInput.responseTypeExponents[HET_OUTCOME_LATEFAIL][i]));
 			readAndSkipPast(tmpBuf, file);
 			readAndSkipPast("ARTEffectOI",file);
-			fscanf(file, "%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_OI][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_OI][1][i]));
+			file->scan("%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_OI][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_OI][1][i]));
 			readAndSkipPast(tmpBuf, file);
 			readAndSkipPast("ARTEffectCHRMs",file);
-			fscanf(file, "%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_CHRMS][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_CHRMS][1][i]));
+			file->scan("%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_CHRMS][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_CHRMS][1][i]));
 			readAndSkipPast(tmpBuf, file);
 			readAndSkipPast("ARTEffectMort",file);
-			fscanf(file, "%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_MORT][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_MORT][1][i]));
+			file->scan("%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_MORT][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_ARTEFFECT_MORT][1][i]));
 			readAndSkipPast(tmpBuf, file);
 			readAndSkipPast("Resist",file);
-			fscanf(file, "%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_RESIST][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_RESIST][1][i]));
+			file->scan("%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_RESIST][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_RESIST][1][i]));
 			readAndSkipPast(tmpBuf, file);
 			readAndSkipPast("Tox",file);
-			fscanf(file, "%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_TOX][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_TOX][1][i]));
+			file->scan("%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_TOX][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_TOX][1][i]));
 			readAndSkipPast(tmpBuf, file);
 			readAndSkipPast("Cost",file);
-			fscanf(file, "%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_COST][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_COST][1][i]));
+			file->scan("%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_COST][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_COST][1][i]));
 			readAndSkipPast(tmpBuf, file);
 			readAndSkipPast("RestartAfterFail",file);
-			fscanf(file, "%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_RESTART][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_RESTART][1][i]));
+			file->scan("%lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_RESTART][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_RESTART][1][i]));
 			readAndSkipPast(tmpBuf, file);
 			readAndSkipPast("Resuppression",file);
-			fscanf(file, "%lf %lf %lf %lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_RESUPP][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_RESUPP][1][i]),&(artInput.responseTypeValues[HET_OUTCOME_RESUPP][0][i]),&(artInput.responseTypeValues[HET_OUTCOME_RESUPP][1][i]), &(artInput.responseTypeExponents[HET_OUTCOME_RESUPP][i]));
+			file->scan("%lf %lf %lf %lf %lf", &(artInput.responseTypeThresholds[HET_OUTCOME_RESUPP][0][i]), &(artInput.responseTypeThresholds[HET_OUTCOME_RESUPP][1][i]),&(artInput.responseTypeValues[HET_OUTCOME_RESUPP][0][i]),&(artInput.responseTypeValues[HET_OUTCOME_RESUPP][1][i]), &(artInput.responseTypeExponents[HET_OUTCOME_RESUPP][i]));
 
 			sprintf(tmpBuf, "AYAART%dARTEffectOnFail_Age%d", artNum, i);
         	readAndSkipPast(tmpBuf, file);
-        	fscanf(file, "%d", &tempBool);
+        	file->scan("%d", &tempBool);
         	artInput.applyARTEffectOnFailed[i] = (bool) tempBool;
 		}
 	}
 } /* end readAdolescentARTInputs */
 
-/* readAndSkipPast and readAndSkipPast2 skip over the given text in the input file - in other words, they move to a position from which the model will grab items that come next in the buffer by scanning the search string into a temporary variable */
-bool SimContext::readAndSkipPast(const char* searchStr, FILE* file) {
-	char temp[513];
-
-	fscanf(file, "%512s", temp);
-
-	while ( strcmp(temp, searchStr) != 0 ) {
-
-		fscanf(file, "%512s", temp);
-
-		if ( feof(file) ) {
-			if(counter<=100){
-				printf("\nWARNING: unexpected end of input file. Looking for %s",searchStr);
-				counter++;
-			}
-
-			return false;
+/* readAndSkipPast and readAndSkipPast2 skip over the given text in the input file - in other words, they move to a position from which the model will grab items that come next in the buffer, as if by scanning the search string into a temporary variable */
+bool SimContext::readAndSkipPast(const char* searchStr, InputReader* file) {
+	long searchStart = file->getPosition();
+	if ( !file->skipPast(searchStr) ) {
+		// a tab read in parallel stops at a missing label, the tabs are then read again in order to print the warnings
+		if (file->isView()) {
+			string errorString = "   ERROR - Tab read in parallel is missing label ";
+			errorString.append(searchStr);
+			throw errorString;
+		}
+		if(counter<=100){
+			printf("\nWARNING: unexpected end of input file. Looking for %s",searchStr);
+			counter++;
+		}
+		// the labels after a missing one are searched for from the end of the file, only the first is an issue
+		if (searchStart < file->getLength()) {
+			InputIssue issue;
+			issue.label = searchStr;
+			issue.lineNumber = file->getLineNumber(searchStart);
+			issue.message = "label not found after this line, the inputs after it were not read";
+			issue.isLabelMissing = true;
+			addInputIssue(issue);
 		}
 
+		return false;
 	}
 	return true;
 }  // readAndSkipPast
 /* readAndSkipPast2 is like readAndSkipPast but skips past two strings in the buffer */
-bool SimContext::readAndSkipPast2( const char* searchStr1, const char* searchStr2, FILE* file ) {
+bool SimContext::readAndSkipPast2( const char* searchStr1, const char* searchStr2, InputReader* file ) {
 	bool ret = readAndSkipPast(searchStr1, file);
 	if (ret == true)
 		ret = readAndSkipPast(searchStr2, file);
 	return ret;
 }  // readAndSkipPast2
+
+/* recordInputIssues adds an input issue for the first value of the input file that was not a number where one was expected,
+	labeled with the first token of its line, and sets the file name of the issues found while reading it */
+void SimContext::recordInputIssues(InputReader *inputFile, string fileName) {
+	for (unsigned int i = 0; i < inputIssues.size(); i++) {
+		if (inputIssues[i].fileName.empty())
+			inputIssues[i].fileName = fileName;
+	}
+	if (inputFile->getNumBadValues() == 0)
+		return;
+	long position = inputFile->getFirstBadValuePosition();
+	const char *contents = inputFile->getContents();
+	long lineStart = position;
+	while ((lineStart > 0) && (contents[lineStart - 1] != '\n'))
+		lineStart--;
+	char buffer[InputReader::MAX_TOKEN_LENGTH + 1];
+	InputReader lineReader;
+	lineReader.openView(inputFile, lineStart);
+	InputIssue issue;
+	if (lineReader.scan("%512s", buffer) == 1)
+		issue.label = buffer;
+	lineReader.setPosition(position);
+	lineReader.scan("%512s", buffer);
+	issue.lineNumber = inputFile->getLineNumber(position);
+	issue.message = "value ";
+	issue.message.append(buffer);
+	issue.message.append(" is not a number");
+	if (inputFile->getNumBadValues() > 1) {
+		char countBuffer[64];
+		sprintf(countBuffer, ", nor are %d later values", inputFile->getNumBadValues() - 1);
+		issue.message.append(countBuffer);
+	}
+	issue.fileName = fileName;
+	issue.isLabelMissing = false;
+	addInputIssue(issue);
+}  // recordInputIssues
+
+/* addInputIssue adds an input issue unless it is already there, as the issues of a base input file are when an
+	overlay reads one of its tabs again */
+void SimContext::addInputIssue(const InputIssue &issue) {
+	for (unsigned int i = 0; i < inputIssues.size(); i++) {
+		if ((inputIssues[i].label == issue.label) && (inputIssues[i].lineNumber == issue.lineNumber) &&
+				(inputIssues[i].message == issue.message))
+			return;
+	}
+	inputIssues.push_back(issue);
+}  // addInputIssue
+
+/* buildDerivedTables precomputes the tables the updaters look up instead of recomputing them from the inputs every
+	patient-month; it must be called again if the inputs the tables are built from change */
+void SimContext::buildDerivedTables() {
+	buildBackgroundDeathRates();
+	buildOIProbabilities();
+	buildHIVPreventionTables();
+}  // buildDerivedTables
+
+/* buildBackgroundDeathRates computes the background death rates of every age, gender and death rate ratio of children
+	as MortalityUpdater applied them each month, so that they are the same to the last bit.  The inputs of the Peds tab
+	are used directly, since they are only looked up for children, when the Peds tab is read */
+void SimContext::buildBackgroundDeathRates() {
+	const double lateRatios[BKGD_MORT_RATIO_NUM_LATE] = {1.0,
+		pedsInputs->maternalMortDeathRateRatioLateHIVNeg, pedsInputs->maternalMortDeathRateRatioLateHIVPos};
+	for (int ratioType = 0; ratioType < BKGD_MORT_RATIO_NUM_LATE; ratioType++) {
+		for (int gender = 0; gender < GENDER_NUM; gender++) {
+			for (int ageYears = 0; ageYears < AGE_YRS; ageYears++) {
+				double backgroundDeathRate = natHistInputs->monthlyBackgroundDeathRate[gender][ageYears];
+				if (ratioType != BKGD_MORT_RATIO_NONE)
+					backgroundDeathRate *= lateRatios[ratioType];
+				backgroundDeathRates[ratioType][gender][ageYears] = modifyBackgroundDeathRate(backgroundDeathRate);
+			}
+		}
+	}
+
+	const double earlyRatios[BKGD_MORT_RATIO_NUM] = {1.0,
+		pedsInputs->maternalMortDeathRateRatioEarlyHIVNeg, pedsInputs->maternalMortDeathRateRatioEarlyHIVPos,
+		pedsInputs->replacementFedDeathRateRatioEarlyHIVNeg, pedsInputs->replacementFedDeathRateRatioEarlyHIVPos};
+	for (int useHEUMortality = 0; useHEUMortality < 2; useHEUMortality++) {
+		for (int ratioType = 0; ratioType < BKGD_MORT_RATIO_NUM; ratioType++) {
+			for (int gender = 0; gender < GENDER_NUM; gender++) {
+				for (int ageCat = 0; ageCat < PEDS_AGE_EARLY_NUM; ageCat++) {
+					double backgroundDeathRate;
+					if (pedsInputs->useExposedUninfectedDefs && useHEUMortality)
+						backgroundDeathRate = pedsInputs->backgroundDeathRateExposedUninfectedEarly[gender][ageCat];
+					else
+						backgroundDeathRate = pedsInputs->backgroundDeathRateEarly[gender][ageCat];
+					if (ratioType != BKGD_MORT_RATIO_NONE)
+						backgroundDeathRate *= earlyRatios[ratioType];
+					backgroundDeathRatesEarly[useHEUMortality][ratioType][gender][ageCat] = modifyBackgroundDeathRate(backgroundDeathRate);
+				}
+			}
+		}
+	}
+}  // buildBackgroundDeathRates
+
+/* modifyBackgroundDeathRate returns a background death rate adjusted by the overall background mortality modifier */
+double SimContext::modifyBackgroundDeathRate(double backgroundDeathRate) {
+	if (natHistInputs->backgroundMortModifierType == MORT_MOD_INCREMENTAL) {
+		/* Incremental method increments probability of death in proportion to the probability of not dying to ensure it stays less than or equal to 1 */
+		double extraBackgroundMortRisk = natHistInputs->backgroundMortModifier;
+		double probDeathBackgroundMort = CepacUtil::rateToProb(backgroundDeathRate);
+		probDeathBackgroundMort = probDeathBackgroundMort + extraBackgroundMortRisk - (probDeathBackgroundMort * extraBackgroundMortRisk);
+		probDeathBackgroundMort = max(probDeathBackgroundMort, 0.0);
+		/* Do data validation check here since it can't be done in the input sheet */
+		if (probDeathBackgroundMort < 1.0)
+			backgroundDeathRate = CepacUtil::probToRate(probDeathBackgroundMort);
+	}
+	else if (natHistInputs->backgroundMortModifierType == MORT_MOD_MULT) {
+		backgroundDeathRate *= natHistInputs->backgroundMortModifier;
+	}
+	return backgroundDeathRate;
+}  // modifyBackgroundDeathRate
+
+/* buildOIProbabilities computes the monthly OI probabilities of adults off ART and of adolescents off and on ART for
+	every pair of current and minimum CD4 strata, blended as AcuteOIUpdater blended them each month.  The OI
+	probabilities of children need no blending and are looked up from the Peds inputs */
+void SimContext::buildOIProbabilities() {
+	for (int currCD4Strata = 0; currCD4Strata < CD4_NUM_STRATA; currCD4Strata++) {
+		for (int minCD4Strata = 0; minCD4Strata < CD4_NUM_STRATA; minCD4Strata++) {
+			for (int oiType = 0; oiType < OI_NUM; oiType++) {
+				double fractionOfBenefit = runSpecsInputs->OIsFractionOfBenefit[oiType];
+				for (int histType = 0; histType < HIST_NUM; histType++) {
+					oiProbsOffART[currCD4Strata][minCD4Strata][oiType][histType] =
+						fractionOfBenefit * natHistInputs->monthlyOIProbOffART[currCD4Strata][oiType][histType] +
+						(1 - fractionOfBenefit) * natHistInputs->monthlyOIProbOffART[minCD4Strata][oiType][histType];
+				}
+			}
+		}
+	}
+
+	oiProbsOffARTAdolescent.clear();
+	oiProbsOnARTAdolescent.clear();
+	if (!adolescentInputs->enableAdolescent)
+		return;
+	int numProbs = CD4_NUM_STRATA * CD4_NUM_STRATA * OI_NUM * HIST_NUM * ADOLESCENT_NUM_AGES;
+	oiProbsOffARTAdolescent.resize(numProbs);
+	oiProbsOnARTAdolescent.resize(numProbs);
+	for (int currCD4Strata = 0; currCD4Strata < CD4_NUM_STRATA; currCD4Strata++) {
+		for (int minCD4Strata = 0; minCD4Strata < CD4_NUM_STRATA; minCD4Strata++) {
+			for (int oiType = 0; oiType < OI_NUM; oiType++) {
+				double fractionOfBenefit = runSpecsInputs->OIsFractionOfBenefit[oiType];
+				for (int histType = 0; histType < HIST_NUM; histType++) {
+					for (int ageCat = 0; ageCat < ADOLESCENT_NUM_AGES; ageCat++) {
+						int index = getAdolescentOIProbIndex((CD4_STRATA) currCD4Strata, (CD4_STRATA) minCD4Strata, oiType, (HIST_TYPE) histType, ageCat);
+						oiProbsOffARTAdolescent[index] =
+							fractionOfBenefit * adolescentInputs->monthlyOIProbOffART[currCD4Strata][oiType][histType][ageCat] +
+							(1 - fractionOfBenefit) * adolescentInputs->monthlyOIProbOffART[minCD4Strata][oiType][histType][ageCat];
+						oiProbsOnARTAdolescent[index] =
+							fractionOfBenefit * adolescentInputs->monthlyOIProbOnART[currCD4Strata][oiType][histType][ageCat] +
+							(1 - fractionOfBenefit) * adolescentInputs->monthlyOIProbOnART[minCD4Strata][oiType][histType][ageCat];
+					}
+				}
+			}
+		}
+	}
+}  // buildOIProbabilities
+
+/* buildHIVPreventionTables computes the monthly probabilities of starting PrEP for the months of the PrEP rollout, or
+	of every month if patients may join after the rollout, and the HIV incidence reduction multiplier of every month up
+	to the last stage bound, as HIVInfectionUpdater computed them each month */
+void SimContext::buildHIVPreventionTables() {
+	for (int risk = 0; risk < HIV_BEHAV_NUM; risk++) {
+		prepUptakeProbs[risk].clear();
+		if (!testingInputs->enableHIVTesting || !testingInputs->enablePrEP)
+			continue;
+		int numMonths = DERIVED_TABLE_MONTHS;
+		if (!testingInputs->PrEPAfterRollout[risk])
+			numMonths = max(min(testingInputs->PrEPRolloutDuration[risk], DERIVED_TABLE_MONTHS), 0);
+		prepUptakeProbs[risk].resize(numMonths);
+		for (int month = 0; month < numMonths; month++)
+			prepUptakeProbs[risk][month] = computePrEPUptakeProb((HIV_BEHAV) risk, month);
+	}
+
+	HIVIncReducStageMultipliers.clear();
+	if (!testingInputs->useHIVIncReductionMult)
+		return;
+	int numMonths = max(min(testingInputs->HIVIncReducStageBounds[INC_REDUC_PERIODS_NUM - 1] + 1, DERIVED_TABLE_MONTHS), 0);
+	HIVIncReducStageMultipliers.resize(numMonths);
+	for (int month = 0; month < numMonths; month++)
+		HIVIncReducStageMultipliers[month] = computeHIVIncReducStageMultiplier(month);
+}  // buildHIVPreventionTables
+
+/* computePrEPUptakeProb returns the probability of starting PrEP in a month from the Weibull distribution of uptake
+	over the rollout duration */
+double SimContext::computePrEPUptakeProb(HIV_BEHAV risk, int month) {
+	double coverage = testingInputs->PrEPCoverage[risk];
+	int duration = testingInputs->PrEPRolloutDuration[risk];
+	double shape = testingInputs->PrEPShape[risk];
+	return 1-pow(1-coverage,(pow(month+1,shape)-pow(month,shape))/pow(duration,shape));
+}  // computePrEPUptakeProb
+
+/* computeHIVIncReducStageMultiplier returns the HIV incidence reduction multiplier of the first stage bound equal to a
+	month, or 1 if there is none; multiplying by 1 leaves the accumulated multiplier unchanged */
+double SimContext::computeHIVIncReducStageMultiplier(int month) {
+	for (int i = 0; i < INC_REDUC_PERIODS_NUM; i++) {
+		if (month == testingInputs->HIVIncReducStageBounds[i])
+			return testingInputs->HIVIncReducMultipliers[i];
+	}
+	return 1.0;
+}  // computeHIVIncReducStageMultiplier
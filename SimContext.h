@@ -13,7 +13,7 @@ class SimContext
 {
 public:
 	/* Constructors and Destructor */
-	SimContext(string runName);
+	SimContext(string runName, string inputFileName = "");
 	~SimContext(void);
 	int counter;
 	/* Misc cohort and simulation constants */
@@ -47,16 +47,17 @@ public:
 	enum DIRECTIONS_TYPE {LEFT,RIGHT};
 	/** The number of generic risk factors used by the model */
 	static const int RISK_FACT_NUM = 5;
-	/** string labels for the generic risk factors */
-	static char RISK_FACT_STRS[RISK_FACT_NUM][32];
+	/** string labels for the generic risk factors, set during readCohortInputs */
+	char RISK_FACT_STRS[RISK_FACT_NUM][32];
 	/** The type of longitudinal summary recording available: none, detailed monthly, brief monthly, detailed yearly */
 	enum LONGIT_SUMM_TYPE {LONGIT_SUMM_NONE, LONGIT_SUMM_MTH_DET, LONGIT_SUMM_MTH_BRF, LONGIT_SUMM_YR_DET};
 	/** A constant used for null values */
 	static const int NOT_APPL = -1;
 	/** The maximum number of patients allowed to be traced - may be temporarily increased for specific projects if deemed necessary */
 	static const int MAX_NUM_TRACES = 100;
-	/** The number of patients to be traced in the trace file (max 100 -- may be modified by GUI or input file input) */
-	static int numPatientsToTrace;
+	/** The number of patients to be traced in the trace file (max 100 -- may be modified by GUI or input file input)
+		The input file dependent labels and settings are members rather than statics so that several input files can be run at once */
+	int numPatientsToTrace;
 	/** The maximum number of subcohorts allowed*/
 	static const int MAX_NUM_SUBCOHORTS = 25;
 	/** The number of transmission risk groups */
@@ -99,7 +100,7 @@ public:
 	enum OI_TYPE {OI_1, OI_2, OI_3, OI_4, OI_5, OI_6, OI_7, OI_8,
 		OI_9, OI_10, OI_11, OI_12, OI_13, OI_14, OI_15, OI_NONE};
 	/** Strings corresponding to SimContext::OI_TYPE from RunSpecs input tab, RunSpecs E20-E34 */
-	static char OI_STRS[OI_NUM][32];	  // from RunSpecs input tab, RunSpecs E20-E34
+	char OI_STRS[OI_NUM][32];	  // from RunSpecs input tab, RunSpecs E20-E34
 	/** The size of SimContext::DTH_CAUSES */
 	static const int DTH_NUM_CAUSES = 38;
 	/** Number of basic death causes (OIs, background mortality and HIV only) */
@@ -112,9 +113,16 @@ public:
 		DTH_CHRM_1, DTH_CHRM_2, DTH_CHRM_3, DTH_CHRM_4, DTH_CHRM_5, DTH_CHRM_6, DTH_CHRM_7, DTH_CHRM_8, DTH_CHRM_9, DTH_CHRM_10,
 		DTH_RISK_1, DTH_RISK_2, DTH_RISK_3, DTH_RISK_4, DTH_RISK_5};
 	/** Strings corresponding to SimContext::DTH_CAUSES filled in with OIs and CHRMs */
-	static char DTH_CAUSES_STRS[DTH_NUM_CAUSES][32];	// filled in with OIs and CHRMs
+	char DTH_CAUSES_STRS[DTH_NUM_CAUSES][32];	// filled in with OIs and CHRMs
 	/** Enum of the PSA background mortality modifier types */
 	enum BACKGROUND_MORT_MOD_TYPES {MORT_MOD_INCREMENTAL, MORT_MOD_MULT};
+	/** Number of death rate ratios that may be applied to the background mortality of children, see SimContext::BKGD_MORT_RATIO_TYPE */
+	static const int BKGD_MORT_RATIO_NUM = 5;
+	/** Number of those death rate ratios that apply in late childhood, which has no replacement feeding ratios */
+	static const int BKGD_MORT_RATIO_NUM_LATE = 3;
+	/** Death rate ratio applied to the background mortality of a child before the overall modifier: none, maternal mortality, or replacement feeding (early childhood only), for HIV negative or positive children */
+	enum BKGD_MORT_RATIO_TYPE {BKGD_MORT_RATIO_NONE, BKGD_MORT_RATIO_MATERNAL_HIV_NEG, BKGD_MORT_RATIO_MATERNAL_HIV_POS,
+		BKGD_MORT_RATIO_REPLACEMENT_FED_HIV_NEG, BKGD_MORT_RATIO_REPLACEMENT_FED_HIV_POS};
 	/** Size of SimContext::HIST_TYPE */
 	static const int HIST_NUM = 2;
 	/** The number of types of OI history (yes or no) */
@@ -140,11 +148,45 @@ public:
 		/** The cost accrued if this death occurs */
 		double costDeath;
 	};
+	/** MortalityRiskList holds the risks of death of a patient for the current month in the order they were added,
+		and the product of their death rate ratios, multiplied in as they are added.  The first DTH_NUM_CAUSES risks are
+		held inline, so that the monthly mortality update does not allocate; more risks, possible only when a cause
+		such as ART toxicity is added several times in one month, are kept in a vector */
+	class MortalityRiskList {
+	public:
+		MortalityRiskList() : numRisks(0), rateRatioProduct(1.0) {}
+		/** clear removes all the risks, at the start of each month */
+		void clear() {
+			numRisks = 0;
+			rateRatioProduct = 1.0;
+			extraRisks.clear();
+		}
+		/** add appends a risk and multiplies its death rate ratio into the product */
+		void add(const MortalityRisk &risk) {
+			if (numRisks < DTH_NUM_CAUSES)
+				inlineRisks[numRisks] = risk;
+			else
+				extraRisks.push_back(risk);
+			numRisks++;
+			rateRatioProduct *= risk.deathRateRatio;
+		}
+		int size() const { return numRisks; }
+		const MortalityRisk &operator[](int i) const {
+			return (i < DTH_NUM_CAUSES) ? inlineRisks[i] : extraRisks[i - DTH_NUM_CAUSES];
+		}
+		/** getRateRatioProduct returns the product of the death rate ratios of all the risks */
+		double getRateRatioProduct() const { return rateRatioProduct; }
+	private:
+		MortalityRisk inlineRisks[DTH_NUM_CAUSES];
+		vector<MortalityRisk> extraRisks;
+		int numRisks;
+		double rateRatioProduct;
+	};
 
 	/* CHRMs constants */
 	static const int CHRM_NUM = 10;
 	enum CHRM_TYPE {CHRM_1, CHRM_2, CHRM_3, CHRM_4, CHRM_5, CHRM_6, CHRM_7, CHRM_8, CHRM_9, CHRM_10};
-	static char CHRM_STRS[CHRM_NUM][32];	  // from CHRMs input tab, CHRMs B4-B7
+	char CHRM_STRS[CHRM_NUM][32];	  // from CHRMs input tab, CHRMs B4-B7
 	static const int CHRM_AGE_CAT_NUM = 7;
 	static const char *CHRM_AGE_CAT_STRS[];
 	static const int CHRM_TIME_PER_NUM = 3;
@@ -1338,6 +1380,8 @@ public:
 		/* Cohort TB initialization inputs */
 		//TB E3
 		bool enableTB;
+		/* True if the rest of the tab was not read since TB is disabled, see skipDisabledTab */
+		bool isTabSkipped;
 		bool isIntegrated;
 
 		//TB D8-H25
@@ -1732,6 +1776,8 @@ public:
 	public:
 		//Peds E2
 		bool enablePediatricsModel;
+		/* True if the rest of the tab and the PedsProph, PedsART and PedsCost tabs were not read since the Peds model is disabled */
+		bool isTabSkipped;
 
 		//Peds C5-C6
 		double initialAgeMean;
@@ -2161,6 +2207,8 @@ public:
 
 		//EID E3-E6
 		bool enableHIVTestingEID;
+		/* True if the rest of the tab was not read since EID HIV testing is disabled */
+		bool isTabSkipped;
 		bool useAlternateStoppingRuleEID;
 		int totalCohortsWithHIVPositiveLimitEID;
 		int totalCohortsLimitEID;
@@ -2213,6 +2261,8 @@ public:
 	public:
 		//Adolescent E2-E8
 		bool enableAdolescent;
+		/* True if the rest of the tab and the AdolescentART tab were not read since the Adolescent module is disabled */
+		bool isTabSkipped;
 		bool transitionToAdult;
 		int ageTransitionToAdult;
 		int ageTransitionFromPeds;
@@ -2304,20 +2354,52 @@ public:
 
 	}; /* end AdolescentARTInputs */
 
+	/** OverlayValue is a line of a scenario overlay file: the values replacing those after an occurrence of a label,
+		starting with its value number firstValue (0 for the first value after the label) */
+	class OverlayValue {
+	public:
+		string label;
+		int occurrence;
+		int firstValue;
+		vector<string> values;
+	};
 
+	/** InputIssue is a problem with the inputs of a run: the label of the inputs it concerns, followed by a sublabel
+		if the label is on several lines, the file and line it was found on, 0 if not known, and a description;
+		isLabelMissing is true if the label was not found, so the inputs after it were not read */
+	class InputIssue {
+	public:
+		string label;
+		string fileName;
+		int lineNumber;
+		string message;
+		bool isLabelMissing;
+	};
 
 
 	/* readInputs function reads in all the inputs from the given input file,
 		throws exception if there is an error */
 	void readInputs();
+	/* readOverlayValues reads the inputs of a base input file with some of its values replaced, as for a scenario overlay */
+	void readOverlayValues(string baseFileName, const vector<OverlayValue> &overlayValues);
+	/* getInputFileName returns the name of the .in or .ovl file the inputs are read from */
+	string getInputFileName();
+	/* getInputIssues returns the labels that were missing and the values that were not numbers when the inputs were read */
+	const vector<InputIssue> &getInputIssues();
+	/* writeInputValues writes the values of all the inputs in binary, as the input cache stores them */
+	void writeInputValues(FILE *file);
+	/* deleteOverlayBases frees the base inputs kept for the scenario overlay files, once all of them are read */
+	static void deleteOverlayBases();
 	/* enablePrEP turns on/off PrEP in the inputs */
 	inline void enablePrEP(bool enable) {
-		testingInputs.enablePrEP = enable;
+		detachInputs(testingInputs);
+		testingInputs->enablePrEP = enable;
 	}
 
 	/* DisableDynamicTransmInc turns off incidence recording for dynamic transmissions after warmup period */
 	inline void disableDynamicTransmInc() {
-		cohortInputs.updateDynamicTransmInc = false;
+		detachInputs(cohortInputs);
+		cohortInputs->updateDynamicTransmInc = false;
 	}
 
 
@@ -2345,98 +2427,234 @@ public:
 	const AdolescentInputs *getAdolescentInputs();
 	const AdolescentARTInputs *getAdolescentARTInputs(int artLineNum);
 
+	/* accessor functions for whether the optional modules are enabled, which may be used when their tabs were skipped */
+	bool isTBEnabled();
+	bool isPedsModelEnabled();
+	bool isEIDTestingEnabled();
+	bool isAdolescentEnabled();
+
+	/* accessor functions for the seed that the patients' random number generators are seeded from */
+	unsigned long getRunSeed();
+	void setRunSeed(unsigned long seed);
+
+	/* buildDerivedTables precomputes the tables the updaters look up instead of recomputing them from the inputs
+		every patient-month; called once the inputs of the run are read */
+	void buildDerivedTables();
+	/* accessor functions for the background death rates after the death rate ratios of children and the overall modifier */
+	double getBackgroundDeathRate(BKGD_MORT_RATIO_TYPE ratioType, GENDER_TYPE gender, int ageYears);
+	double getBackgroundDeathRateEarly(bool useHEUMortality, BKGD_MORT_RATIO_TYPE ratioType, GENDER_TYPE gender, PEDS_AGE_CAT ageCat);
+	/* accessor functions for the monthly OI probabilities blended between the current and minimum CD4 strata by the OI fraction of benefit */
+	double getOIProbOffART(CD4_STRATA currCD4Strata, CD4_STRATA minCD4Strata, int oiType, HIST_TYPE histType);
+	double getOIProbOffARTAdolescent(CD4_STRATA currCD4Strata, CD4_STRATA minCD4Strata, int oiType, HIST_TYPE histType, int ageCat);
+	double getOIProbOnARTAdolescent(CD4_STRATA currCD4Strata, CD4_STRATA minCD4Strata, int oiType, HIST_TYPE histType, int ageCat);
+	/* accessor functions for the monthly probability of starting PrEP, and the HIV incidence reduction multiplier of the stage bound reached in a month */
+	double getPrEPUptakeProb(HIV_BEHAV risk, int month);
+	double getHIVIncReducStageMultiplier(int month);
+
+	/** Version of the layout of the binary input cache, to be increased whenever writeInputCache changes */
+	static const int INPUT_CACHE_FORMAT_VERSION = 2;
+	/** Build of CEPAC that wrote a binary input cache, which may only be loaded by the same build */
+	static const char *INPUT_CACHE_BUILD_STAMP;
+	/** Size of the file buffer used for the binary input cache, so that it is read and written in one call */
+	static const int INPUT_CACHE_BUFFER_SIZE = 1 << 20;
+	/** Longest string accepted from a binary input cache */
+	static const int MAX_CACHED_STRING_LENGTH = 4096;
+	/** Number of tabs of the input file, see INPUT_TABS, and the number of stages they are read in when read in parallel */
+	static const int NUM_INPUT_TABS = 23;
+	static const int NUM_INPUT_TAB_STAGES = 4;
+	/** Label on the first line of a scenario overlay file, followed by the name of its base input file */
+	static const char *OVERLAY_BASE_LABEL;
 
 private:
-	/* Input file name and file pointer */
+	/* Input file name, and the offset in it where each tab ended when it was read from a .in file */
 	string inputFileName;
-	FILE *inputFile;
-
-	/* Classes for storing the input data */
-	RunSpecsInputs runSpecsInputs;
-	OutputInputs outputInputs;
-	CohortInputs cohortInputs;
-	TreatmentInputs treatmentInputs;
-	LTFUInputs ltfuInputs;
-	HeterogeneityInputs heterogeneityInputs;
-	STIInputs stiInputs;
-	ProphInputs *prophsInputs[PROPH_NUM_TYPES][OI_NUM][PROPH_NUM];
-	ProphInputs *pedsProphsInputs[PROPH_NUM_TYPES][OI_NUM][PROPH_NUM];
-	ARTInputs *artInputs[ART_NUM_LINES];
-	NatHistInputs natHistInputs;
-	CHRMsInputs chrmsInputs;
-	CostInputs costInputs;
-	TBInputs tbInputs;
-	QOLInputs qolInputs;
-	HIVTestInputs testingInputs;
-	PedsInputs pedsInputs;
-	PedsARTInputs *pedsARTInputs[ART_NUM_LINES];
-	PedsCostInputs pedsCostInputs;
-	EIDInputs eidInputs;
-	AdolescentInputs adolescentInputs;
-	AdolescentARTInputs *adolescentARTInputs[ART_NUM_LINES];
+	long inputTabEnds[NUM_INPUT_TABS];
+	/* Missing labels and values that were not numbers found while reading the input file, see InputValidator */
+	vector<InputIssue> inputIssues;
+	/* Fixed or time based seed of this run, see CepacUtil::getRunSeed */
+	unsigned long runSeed;
+	/* Monthly background death rates of adults, adolescents and late childhood, by the death rate ratio of late childhood
+		applied to them, and of early childhood, by whether HIV exposed uninfected rates are used and the death rate ratio
+		of early childhood applied to them; each is modified by the overall background mortality modifier, see buildDerivedTables */
+	double backgroundDeathRates[BKGD_MORT_RATIO_NUM_LATE][GENDER_NUM][AGE_YRS];
+	double backgroundDeathRatesEarly[2][BKGD_MORT_RATIO_NUM][GENDER_NUM][PEDS_AGE_EARLY_NUM];
+	/* Monthly OI probabilities of adults off ART, and of adolescents off and on ART, by current and minimum CD4 strata,
+		each blended between the two strata by the OI fraction of benefit; the adolescent ones are laid out as their inputs
+		with the minimum CD4 strata after the current one, and are only built when the adolescent module is enabled */
+	double oiProbsOffART[CD4_NUM_STRATA][CD4_NUM_STRATA][OI_NUM][HIST_NUM];
+	vector<double> oiProbsOffARTAdolescent;
+	vector<double> oiProbsOnARTAdolescent;
+	/* Monthly probabilities of starting PrEP by HIV risk, from the Weibull rollout of PrEP coverage, and the HIV incidence
+		reduction multiplier of the stage bound reached in each month, or 1 in a month without one; both are indexed by
+		month, built only when PrEP or the incidence reduction is enabled, and no longer than DERIVED_TABLE_MONTHS, past
+		which they are computed as they are looked up */
+	vector<double> prepUptakeProbs[HIV_BEHAV_NUM];
+	vector<double> HIVIncReducStageMultipliers;
+	/** Greatest number of months of the tables indexed by month, the months up to the greatest age of a patient */
+	static const int DERIVED_TABLE_MONTHS = AGE_YRS * 12;
+
+	/* Classes for storing the input data, each held through a shared pointer so that SimContexts built from the same
+		inputs, such as scenario overlays of one base input file, share the blocks they do not change.  A block is only
+		changed by a SimContext that holds the only pointer to it, see detachInputs */
+	shared_ptr<RunSpecsInputs> runSpecsInputs;
+	shared_ptr<OutputInputs> outputInputs;
+	shared_ptr<CohortInputs> cohortInputs;
+	shared_ptr<TreatmentInputs> treatmentInputs;
+	shared_ptr<LTFUInputs> ltfuInputs;
+	shared_ptr<HeterogeneityInputs> heterogeneityInputs;
+	shared_ptr<STIInputs> stiInputs;
+	shared_ptr<ProphInputs> prophsInputs[PROPH_NUM_TYPES][OI_NUM][PROPH_NUM];
+	shared_ptr<ProphInputs> pedsProphsInputs[PROPH_NUM_TYPES][OI_NUM][PROPH_NUM];
+	shared_ptr<ARTInputs> artInputs[ART_NUM_LINES];
+	shared_ptr<NatHistInputs> natHistInputs;
+	shared_ptr<CHRMsInputs> chrmsInputs;
+	shared_ptr<CostInputs> costInputs;
+	shared_ptr<TBInputs> tbInputs;
+	shared_ptr<QOLInputs> qolInputs;
+	shared_ptr<HIVTestInputs> testingInputs;
+	shared_ptr<PedsInputs> pedsInputs;
+	shared_ptr<PedsARTInputs> pedsARTInputs[ART_NUM_LINES];
+	shared_ptr<PedsCostInputs> pedsCostInputs;
+	shared_ptr<EIDInputs> eidInputs;
+	shared_ptr<AdolescentInputs> adolescentInputs;
+	shared_ptr<AdolescentARTInputs> adolescentARTInputs[ART_NUM_LINES];
+
+	/** InputTab describes a tab of the input file: the function that reads it, the first label that function skips
+		past, the stage the tab is read in when the tabs are read in parallel, after the tabs it uses inputs from,
+		and whether tabs of later stages use its inputs */
+	class InputTab {
+	public:
+		void (SimContext::*readFunction)(InputReader *inputFile);
+		const char *firstLabel;
+		int stage;
+		bool hasDependentTabs;
+	};
+	static const InputTab INPUT_TABS[];
+
+	/** OverlayPatch replaces the characters from start up to end of the base input file with a value */
+	class OverlayPatch {
+	public:
+		long start;
+		long end;
+		string value;
+		bool operator<(const OverlayPatch &other) const { return start < other.start; }
+	};
+	/** OverlayBase holds a base input file of scenario overlays and its inputs, read when it is first used */
+	class OverlayBase {
+	public:
+		SimContext *simContext;
+		InputReader *inputFile;
+	};
+	static map<string, OverlayBase> overlayBases;
+	static mutex overlayBasesMutex;
 
 	/* Private functions for reading in the inputs, called by readInputs */
-	void readRunSpecsInputs();
-	void readOutputInputs();
-	void readCohortInputs();
-	void readTreatmentInputsPart1();
-	void readTreatmentInputsPart2();
-	void readLTFUInputs();
-	void readHeterogeneityInputs();
-	void readSTIInputs();
-	void readProphInputs();
-	void readPedsProphInputs();
-	void readARTInputs();
-	void readNatHistInputs();
-	void readCHRMsInputs();
-	void readCostInputs();
-	void readTBInputs();
-	void readQOLInputs();
-	void readHIVTestInputs();
-	void readPedsInputs();
-	void readPedsARTInputs();
-	void readPedsCostInputs();
-	void readEIDInputs();
-	void readAdolescentInputs();
-	void readAdolescentARTInputs();
-	bool readAndSkipPast(const char* searchStr, FILE* file);
-	bool readAndSkipPast2(const char* searchStr1, const char *searchStr2, FILE *file);
+	void readRunSpecsInputs(InputReader *inputFile);
+	void readOutputInputs(InputReader *inputFile);
+	void readCohortInputs(InputReader *inputFile);
+	void readTreatmentInputsPart1(InputReader *inputFile);
+	void readTreatmentInputsPart2(InputReader *inputFile);
+	void readLTFUInputs(InputReader *inputFile);
+	void readHeterogeneityInputs(InputReader *inputFile);
+	void readSTIInputs(InputReader *inputFile);
+	void readProphInputs(InputReader *inputFile);
+	void readPedsProphInputs(InputReader *inputFile);
+	void readARTInputs(InputReader *inputFile);
+	void readNatHistInputs(InputReader *inputFile);
+	void readCHRMsInputs(InputReader *inputFile);
+	void readCostInputs(InputReader *inputFile);
+	void readTBInputs(InputReader *inputFile);
+	void readQOLInputs(InputReader *inputFile);
+	void readHIVTestInputs(InputReader *inputFile);
+	void readPedsInputs(InputReader *inputFile);
+	void readPedsARTInputs(InputReader *inputFile);
+	void readPedsCostInputs(InputReader *inputFile);
+	void readEIDInputs(InputReader *inputFile);
+	void readAdolescentInputs(InputReader *inputFile);
+	void readAdolescentARTInputs(InputReader *inputFile);
+	void readInputTabs(InputReader *inputFile);
+	bool readInputTabsInParallel(InputReader *inputFile);
+	void readInputTabsOfStage(int stage, InputReader *tabReaders, atomic<int> *nextTab, char *tabFailed);
+	bool skipDisabledTab(void (SimContext::*readFunction)(InputReader *inputFile), InputReader *inputFile);
+	void reportSkippedTabRead(const char *tabName);
+	bool readAndSkipPast(const char* searchStr, InputReader* file);
+	bool readAndSkipPast2(const char* searchStr1, const char *searchStr2, InputReader *file);
+	void recordInputIssues(InputReader *inputFile, string fileName);
+	void addInputIssue(const InputIssue &issue);
+
+	/* Private functions for building the derived tables, called by buildDerivedTables */
+	void buildBackgroundDeathRates();
+	double modifyBackgroundDeathRate(double backgroundDeathRate);
+	void buildOIProbabilities();
+	static int getAdolescentOIProbIndex(CD4_STRATA currCD4Strata, CD4_STRATA minCD4Strata, int oiType, HIST_TYPE histType, int ageCat);
+	void buildHIVPreventionTables();
+	double computePrEPUptakeProb(HIV_BEHAV risk, int month);
+	double computeHIVIncReducStageMultiplier(int month);
+
+	/* Functions for releasing the allocated art and proph inputs, and for sharing the inputs of another SimContext */
+	void releaseAllocatedInputs();
+	void shareInputs(const SimContext *source);
+	void detachInputsOfTab(int tabNum);
+	/** detachInputs gives this SimContext its own copy of a block of inputs before it changes it, if other SimContexts share the block */
+	template <class T> void detachInputs(shared_ptr<T> &inputs) {
+		if (inputs.use_count() > 1)
+			inputs = make_shared<T>(*inputs);
+	}
+
+	/* Private functions for scenario overlay files, called by readInputs */
+	void readOverlayInputs();
+	static OverlayBase getOverlayBase(string baseFileName);
+	static long getOverlayOffset(long baseOffset, const vector<OverlayPatch> &patches);
+
+	/* Private functions for the binary input cache, called by readInputs */
+	string getInputCacheFileName();
+	long long getInputCacheLayoutSize();
+	void writeInputCache(unsigned long long inputFileHash);
+	bool readInputCache(unsigned long long inputFileHash);
+	void writeCachedString(FILE *file, const string &value);
+	void readCachedString(FILE *file, string *value);
+	void writeCachedRunSpecsInputs(FILE *file);
+	void readCachedRunSpecsInputs(FILE *file);
+	void writeCachedARTInputs(FILE *file, const ARTInputs *artInput);
+	void readCachedARTInputs(FILE *file, shared_ptr<ARTInputs> *artInputPointer);
+	template <class T> void writeCachedInputs(FILE *file, const T *inputs);
+	template <class T> void readCachedInputs(FILE *file, shared_ptr<T> *inputsPointer);
 
 };
 
 /* getRunSpecsInputs returns a const pointer to the RunSpecsInputs data class */
 inline const SimContext::RunSpecsInputs *SimContext::getRunSpecsInputs() {
-	return &runSpecsInputs;
+	return runSpecsInputs.get();
 }
 
 /* getOutputInputs returns a const pointer to the OutputInputs data class */
 inline const SimContext::OutputInputs *SimContext::getOutputInputs() {
-	return &outputInputs;
+	return outputInputs.get();
 }
 
 /* getCohortInputs returns a const pointer to the CohortInputs data class */
 inline const SimContext::CohortInputs *SimContext::getCohortInputs() {
-	return &cohortInputs;
+	return cohortInputs.get();
 }
 
 /* getTreatmentInputs returns a const pointer to the TreatmentInputs data class */
 inline const SimContext::TreatmentInputs *SimContext::getTreatmentInputs() {
-	return &treatmentInputs;
+	return treatmentInputs.get();
 }
 
 /* getLTFUInputs returns a const pointer to the LTFUInputs data class */
 inline const SimContext::LTFUInputs *SimContext::getLTFUInputs() {
-	return &ltfuInputs;
+	return ltfuInputs.get();
 }
 
 /* getHeterogeneityInputs returns a const pointer to the HeterogeneityInputs data class */
 inline const SimContext::HeterogeneityInputs *SimContext::getHeterogeneityInputs() {
-	return &heterogeneityInputs;
+	return heterogeneityInputs.get();
 }
 
 /* getSTIInputs returns a const pointer to the STIInputs data class */
 inline const SimContext::STIInputs *SimContext::getSTIInputs() {
-	return &stiInputs;
+	return stiInputs.get();
 }
 
 /* getProphInputs returns a const pointer to the specified ProphInputs data class */
@@ -2445,7 +2663,7 @@ inline const SimContext::ProphInputs *SimContext::getProphInputs(int prophType,
 	assert(OINum < OI_NUM);
 	assert(prophNum < PROPH_NUM);
 
-	return prophsInputs[prophType][OINum][prophNum];
+	return prophsInputs[prophType][OINum][prophNum].get();
 }
 
 /* getPedsProphInputs returns a const pointer to the specified ProphInputs data class */
@@ -2454,76 +2672,172 @@ inline const SimContext::ProphInputs *SimContext::getPedsProphInputs(int prophTy
 	assert(OINum < OI_NUM);
 	assert(prophNum < PROPH_NUM);
 
-	return pedsProphsInputs[prophType][OINum][prophNum];
+	if (pedsInputs->isTabSkipped)
+		reportSkippedTabRead("PedsProph");
+	return pedsProphsInputs[prophType][OINum][prophNum].get();
 }
 
 /* getARTInputs returns a const pointer to the specified ARTInputs data class */
 inline const SimContext::ARTInputs *SimContext::getARTInputs(int artLineNum) {
 
 	assert(artLineNum < ART_NUM_LINES);
-	return artInputs[artLineNum];
+	return artInputs[artLineNum].get();
 }
 
 /* getNatHistInputs returns a const pointer to the NatHistInputs data class */
 inline const SimContext::NatHistInputs *SimContext::getNatHistInputs() {
-	return &natHistInputs;
+	return natHistInputs.get();
 }
 
 /* getCHRMsInputs returns a const pointer to the CHRMsInputs data class */
 inline const SimContext::CHRMsInputs *SimContext::getCHRMsInputs() {
-	return &chrmsInputs;
+	return chrmsInputs.get();
 }
 
 /* getCostInputs returns a const pointer to the CostInputs data class */
 inline const SimContext::CostInputs *SimContext::getCostInputs() {
-	return &costInputs;
+	return costInputs.get();
 }
 
 /* getTBInputs returns a const pointer to the TBInputs data class */
 inline const SimContext::TBInputs *SimContext::getTBInputs() {
-	return &tbInputs;
+	if (tbInputs->isTabSkipped)
+		reportSkippedTabRead("TB");
+	return tbInputs.get();
 }
 
 /* getQOLInputs returns a const pointer to the QOLInputs data class */
 inline const SimContext::QOLInputs *SimContext::getQOLInputs() {
-	return &qolInputs;
+	return qolInputs.get();
 }
 
 /* getHIVTestInputs returns a const pointer to the HIVTestInputs data class */
 inline const SimContext::HIVTestInputs *SimContext::getHIVTestInputs() {
-	return &testingInputs;
+	return testingInputs.get();
 }
 
 /* getPedsInputs returns a const pointer to the PedsInputs data class */
 inline const SimContext::PedsInputs *SimContext::getPedsInputs() {
-	return &pedsInputs;
+	if (pedsInputs->isTabSkipped)
+		reportSkippedTabRead("Peds");
+	return pedsInputs.get();
 }
 
 /* getPedsARTInputs returns a const pointer to the specified PedsARTInputs data class */
 inline const SimContext::PedsARTInputs *SimContext::getPedsARTInputs(int artLineNum) {
 
 	assert(artLineNum < ART_NUM_LINES);
-	return pedsARTInputs[artLineNum];
+	if (pedsInputs->isTabSkipped)
+		reportSkippedTabRead("PedsART");
+	return pedsARTInputs[artLineNum].get();
 }
 
 /* getCostInputs returns a const pointer to the CostInputs data class */
 inline const SimContext::PedsCostInputs *SimContext::getPedsCostInputs() {
-	return &pedsCostInputs;
+	if (pedsInputs->isTabSkipped)
+		reportSkippedTabRead("PedsCost");
+	return pedsCostInputs.get();
 }
 
 /* getEIDInputs returns a const pointer to the EIDInputs data class */
 inline const SimContext::EIDInputs *SimContext::getEIDInputs() {
-	return &eidInputs;
+	if (eidInputs->isTabSkipped)
+		reportSkippedTabRead("EID");
+	return eidInputs.get();
 }
 
 /* getAdolescentInputs returns a const pointer to the AdolescentInputs data class */
 inline const SimContext::AdolescentInputs *SimContext::getAdolescentInputs() {
-	return &adolescentInputs;
+	if (adolescentInputs->isTabSkipped)
+		reportSkippedTabRead("Adolescent");
+	return adolescentInputs.get();
 }
 
 /* getAdolescentARTInputs returns a const pointer to the specified getAdolescentARTInputs data class */
 inline const SimContext::AdolescentARTInputs *SimContext::getAdolescentARTInputs(int artLineNum) {
 
 	assert(artLineNum < ART_NUM_LINES);
-	return adolescentARTInputs[artLineNum];
+	if (adolescentInputs->isTabSkipped)
+		reportSkippedTabRead("AdolescentART");
+	return adolescentARTInputs[artLineNum].get();
+}
+
+/* isTBEnabled returns whether the TB module is enabled */
+inline bool SimContext::isTBEnabled() {
+	return tbInputs->enableTB;
+}
+
+/* isPedsModelEnabled returns whether the Peds model is enabled */
+inline bool SimContext::isPedsModelEnabled() {
+	return pedsInputs->enablePediatricsModel;
+}
+
+/* isEIDTestingEnabled returns whether EID HIV testing is enabled */
+inline bool SimContext::isEIDTestingEnabled() {
+	return eidInputs->enableHIVTestingEID;
+}
+
+/* isAdolescentEnabled returns whether the Adolescent module is enabled */
+inline bool SimContext::isAdolescentEnabled() {
+	return adolescentInputs->enableAdolescent;
+}
+
+/* getRunSeed returns the seed that the patients' random number generators are seeded from */
+inline unsigned long SimContext::getRunSeed() {
+	return runSeed;
+}
+
+/* setRunSeed sets the seed that the patients' random number generators are seeded from */
+inline void SimContext::setRunSeed(unsigned long seed) {
+	runSeed = seed;
+}
+
+/* getBackgroundDeathRate returns the monthly background death rate of an adult, an adolescent or a child in late
+	childhood with the given death rate ratio, modified by the overall background mortality modifier */
+inline double SimContext::getBackgroundDeathRate(BKGD_MORT_RATIO_TYPE ratioType, GENDER_TYPE gender, int ageYears) {
+	return backgroundDeathRates[ratioType][gender][ageYears];
+}
+
+/* getBackgroundDeathRateEarly returns the monthly background death rate of a child in early childhood with the given
+	death rate ratio, modified by the overall background mortality modifier */
+inline double SimContext::getBackgroundDeathRateEarly(bool useHEUMortality, BKGD_MORT_RATIO_TYPE ratioType, GENDER_TYPE gender, PEDS_AGE_CAT ageCat) {
+	return backgroundDeathRatesEarly[useHEUMortality][ratioType][gender][ageCat];
+}
+
+/* getOIProbOffART returns the monthly probability of an OI for an adult off ART, blended between the current and
+	minimum CD4 strata by the OI fraction of benefit */
+inline double SimContext::getOIProbOffART(CD4_STRATA currCD4Strata, CD4_STRATA minCD4Strata, int oiType, HIST_TYPE histType) {
+	return oiProbsOffART[currCD4Strata][minCD4Strata][oiType][histType];
+}
+
+/* getAdolescentOIProbIndex returns the index of the adolescent OI probabilities of the given strata, OI, history and age category */
+inline int SimContext::getAdolescentOIProbIndex(CD4_STRATA currCD4Strata, CD4_STRATA minCD4Strata, int oiType, HIST_TYPE histType, int ageCat) {
+	return (((currCD4Strata * CD4_NUM_STRATA + minCD4Strata) * OI_NUM + oiType) * HIST_NUM + histType) * ADOLESCENT_NUM_AGES + ageCat;
+}
+
+/* getOIProbOffARTAdolescent returns the monthly probability of an OI for an adolescent off ART, blended between the
+	current and minimum CD4 strata by the OI fraction of benefit */
+inline double SimContext::getOIProbOffARTAdolescent(CD4_STRATA currCD4Strata, CD4_STRATA minCD4Strata, int oiType, HIST_TYPE histType, int ageCat) {
+	return oiProbsOffARTAdolescent[getAdolescentOIProbIndex(currCD4Strata, minCD4Strata, oiType, histType, ageCat)];
+}
+
+/* getOIProbOnARTAdolescent returns the monthly probability of an OI for an adolescent with the full effect of ART,
+	blended between the current and minimum CD4 strata by the OI fraction of benefit */
+inline double SimContext::getOIProbOnARTAdolescent(CD4_STRATA currCD4Strata, CD4_STRATA minCD4Strata, int oiType, HIST_TYPE histType, int ageCat) {
+	return oiProbsOnARTAdolescent[getAdolescentOIProbIndex(currCD4Strata, minCD4Strata, oiType, histType, ageCat)];
+}
+
+/* getPrEPUptakeProb returns the probability that a patient of the given HIV risk starts PrEP in the given month */
+inline double SimContext::getPrEPUptakeProb(HIV_BEHAV risk, int month) {
+	if (month < (int) prepUptakeProbs[risk].size())
+		return prepUptakeProbs[risk][month];
+	return computePrEPUptakeProb(risk, month);
+}
+
+/* getHIVIncReducStageMultiplier returns the HIV incidence reduction multiplier accumulated in the given month, that of
+	the first stage bound equal to the month, or 1 if there is none */
+inline double SimContext::getHIVIncReducStageMultiplier(int month) {
+	if (month < (int) HIVIncReducStageMultipliers.size())
+		return HIVIncReducStageMultipliers[month];
+	return computeHIVIncReducStageMultiplier(month);
 }
@@ -103,6 +103,7 @@ void StateUpdater::setInitialARTState() {
 	patient->artState.hasTakenART = false;
 	patient->artState.numObservedFailures = 0;
 	patient->artState.hadSuccessOnRegimen = false;
+	patient->artState.monthOfPrevRegimenStop = SimContext::NOT_APPL;
 
 	patient->artState.overallCD4Envelope.isActive = false;
 	patient->artState.indivCD4Envelope.isActive = false;
@@ -235,6 +236,9 @@ void StateUpdater::incrementMonth() {
 	patient->pedsState.ageCategoryPediatrics = getAgeCategoryPediatrics(patient->generalState.ageMonths);
 	patient->pedsState.ageCategoryPedsCost = getAgeCategoryPediatricsCost(patient->generalState.ageMonths);
 	patient->pedsState.ageCategoryPedsARTCost = getAgeCategoryPediatricsARTCost(patient->generalState.ageMonths);
+
+	// Key the draws of the new month by the month number if using common random numbers
+	CepacUtil::setRandomMonth(patient);
 } /* end incrementMonth */
 
 /** \brief incrementDiscountFactor adjusts the discounting factor for each new month
@@ -648,7 +652,7 @@ void StateUpdater::setDetectedHIVState(bool isDetected, SimContext::HIV_DET type
 		RunStats::TimeSummary *currTime = getTimeSummaryForUpdate();
 		if(currTime){
 			currTime->numHIVDetections[typeDetection]++;
-			if (simContext->getPedsInputs()->enablePediatricsModel && patient->pedsState.isMotherAlive && !patient->pedsState.maternalStatusKnown){
+			if (simContext->isPedsModelEnabled() && patient->pedsState.isMotherAlive && !patient->pedsState.maternalStatusKnown){
 				currTime->numNewlyDetectedPediatricsMotherStatusUnknown++;
 			}
 		}
@@ -3283,7 +3287,8 @@ void StateUpdater::resetTBTesting(bool removeObsvStrain, bool removePendingDSTRe
 	//Set curr index and next index
 	setCurrTBTestIndex(SimContext::NOT_APPL);
 
-	if (simContext->getTBInputs()->TBDiagnosticsTestOrder[patient->tbState.everOnTreatmentOrEmpiric][0]!=SimContext::NOT_APPL)
+	if (simContext->isTBEnabled() &&
+		(simContext->getTBInputs()->TBDiagnosticsTestOrder[patient->tbState.everOnTreatmentOrEmpiric][0]!=SimContext::NOT_APPL))
 		setNextTBTestIndex(0, true, patient->tbState.everOnTreatmentOrEmpiric);
 	else
 		setNextTBTestIndex(SimContext::NOT_APPL, false);
@@ -4709,7 +4714,7 @@ void StateUpdater::addMortalityRisk(SimContext::DTH_CAUSES causeOfDeath, double
 	deathRisk.causeOfDeath = causeOfDeath;
 	deathRisk.deathRateRatio = deathRateRatio;
 	deathRisk.costDeath = costDeath;
-	patient->diseaseState.mortalityRisks.push_back(deathRisk);
+	patient->diseaseState.mortalityRisks.add(deathRisk);
 } /* end addMortalityRisk */
 
 /** \brief setCauseOfDeath updates the patient state to reflect that death has occurred
@@ -4869,7 +4874,7 @@ void StateUpdater::setCauseOfDeath(SimContext::DTH_CAUSES causeOfDeath) {
 		}
 		
 		// TB death stats
-		if(simContext->getTBInputs()->enableTB){
+		if(simContext->isTBEnabled()){
 			bool unfavorableIndex[SimContext::TB_NUM_UNFAVORABLE];
 			for (int i = 0; i < SimContext::TB_NUM_UNFAVORABLE; i++)
 				unfavorableIndex[i] = patient->tbState.hasUnfavorableOutcome[i];
@@ -5021,68 +5026,9 @@ void StateUpdater::updatePopulationStats() {
 	}
 
 
-	//Add monthly cumulative costs
-	double cumulCohortCosts= 0;
-	double cumulCohortCostsType[SimContext::COST_NUM_TYPES];
-	for (int i = 0; i < SimContext::COST_NUM_TYPES; i++) {
-		cumulCohortCostsType[i] = 0;
-	}
-	double cumulARTCosts = 0;
-	double cumulCD4Costs = 0;
-	double cumulHVLCosts = 0;
-	double cumulHIVTestCosts = 0;
-	double cumulHIVMiscCosts = 0;
+	//Update the monthly cumulative costs and HIV detection and testing numbers
+	runStats->updateCumulativeTimeSummaries();
 
-	for (vector<RunStats::TimeSummary *>::iterator t = runStats->timeSummaries.begin(); t != runStats->timeSummaries.end(); t++) {
-		RunStats::TimeSummary *currTime = *t;
-		cumulCohortCosts += currTime->totalMonthlyCohortCosts;
-		for (int i = 0; i < SimContext::COST_NUM_TYPES; i++) {
-			cumulCohortCostsType[i] += currTime->totalMonthlyCohortCostsType[i];
-		}
-
-		for (int i = 0; i < SimContext::ART_NUM_LINES; i++)
-			cumulARTCosts += currTime->costsART[i];
-		cumulCD4Costs += currTime->costsCD4Testing;
-		cumulHVLCosts += currTime->costsHVLTesting;
-		cumulHIVTestCosts += currTime->costsHIVTests;
-		cumulHIVMiscCosts += currTime->costsHIVMisc;
-		currTime->cumulativeCohortCosts = cumulCohortCosts;
-		for (int i = 0; i < SimContext::COST_NUM_TYPES; i++) {
-			currTime->cumulativeCohortCostsType[i] = cumulCohortCostsType[i];
-		}
-		currTime->cumulativeARTCosts = cumulARTCosts;
-		currTime->cumulativeCD4TestingCosts = cumulCD4Costs;
-		currTime->cumulativeHVLTestingCosts = cumulHVLCosts;
-		currTime->cumulativeHIVTestingCosts = cumulHIVTestCosts;
-		currTime->cumulativeHIVMiscCosts = cumulHIVMiscCosts;
-	}
-
-	// Add cumulative HIV detection and testing numbers
-	int cumulHIVDetections[SimContext::HIV_DET_NUM];
-	for (int i = 0; i < SimContext::HIV_DET_NUM; i++) {
-		cumulHIVDetections[i] = 0;
-	}
-	int cumulHIVTests = 0;
-	int cumulHIVTestsAtInitOffer = 0;
-	int cumulHIVTestsPostStartup = 0;
-		
-	for (vector<RunStats::TimeSummary *>::iterator t = runStats->timeSummaries.begin(); t != runStats->timeSummaries.end(); t++) {
-		RunStats::TimeSummary *currTime = *t;
-
-		for (int i = 0; i < SimContext::HIV_DET_NUM; i++) {
-			cumulHIVDetections[i] += currTime->numHIVDetections[i];
-		}	
-		cumulHIVTests += currTime->numHIVTestsPerformed;
-		cumulHIVTestsAtInitOffer += currTime->numHIVTestsPerformedAtInitOffer;
-		cumulHIVTestsPostStartup += currTime->numHIVTestsPerformedPostStartup;
-			
-		for (int i = 0; i < SimContext::HIV_DET_NUM; i++) {
-			currTime->cumulativeNumHIVDetections[i] = cumulHIVDetections[i];
-		}	
-		currTime->cumulativeNumHIVTests = cumulHIVTests;
-		currTime->cumulativeNumHIVTestsAtInitOffer = cumulHIVTestsAtInitOffer;
-		currTime->cumulativeNumHIVTestsPostStartup = cumulHIVTestsPostStartup;
-	}
 	if(simContext->getOutputInputs()->enableSubCohorts){
 		for (int i = 0; i < SimContext::MAX_NUM_SUBCOHORTS; i++){
 			if (simContext->getOutputInputs()->subCohorts[i]<=0)
@@ -5146,7 +5092,7 @@ void StateUpdater::updatePopulationStats() {
 	}
 
 	//TB unfavorable outcome
-	if(simContext->getTBInputs()->enableTB){
+	if(simContext->isTBEnabled()){
 		bool unfavorableIndex[SimContext::TB_NUM_UNFAVORABLE];
 		for (int i = 0; i < SimContext::TB_NUM_UNFAVORABLE; i++)
 			unfavorableIndex[i] = patient->tbState.hasUnfavorableOutcome[i];
@@ -6927,7 +6873,7 @@ void StateUpdater::updateLongitSurvival() {
 		}
 
 		//TB
-		if (simContext->getTBInputs()->enableTB){
+		if (simContext->isTBEnabled()){
 			currTime->numAliveTB[patient->tbState.currTrueTBDiseaseState]++;
 			for (int i = 0; i < SimContext::TB_NUM_TRACKER; i++){
 				if (patient->tbState.currTrueTBTracker[i]){
@@ -7614,7 +7560,7 @@ int StateUpdater::getAgeCategoryCHRMsMthsStart(int ageMonths) {
  * 
 **/
 SimContext::PEDS_CD4_AGE_CAT StateUpdater::getAgeCategoryCD4Metric(int ageMonths){
-	if(simContext->getPedsInputs()->enablePediatricsModel && ageMonths < 60)
+	if(simContext->isPedsModelEnabled() && ageMonths < 60)
 		return SimContext::CD4_PERC;
 	else
 		return SimContext::CD4_ABSOLUTE;
@@ -7628,7 +7574,7 @@ SimContext::PEDS_CD4_AGE_CAT StateUpdater::getAgeCategoryCD4Metric(int ageMonths
  * \return an integer representing the index of the pediatric age categories
  **/
 SimContext::PEDS_AGE_CAT StateUpdater::getAgeCategoryPediatrics(int ageMonths) {
-	if (!simContext->getPedsInputs()->enablePediatricsModel)
+	if (!simContext->isPedsModelEnabled())
 		return SimContext::PEDS_AGE_ADULT;
 
 	if (ageMonths < 3)
@@ -7663,7 +7609,7 @@ SimContext::PEDS_AGE_CAT StateUpdater::getAgeCategoryPediatrics(int ageMonths) {
  * \return an integer representing the index of the pediatric cost age categories
  **/
 SimContext::PEDS_COST_AGE StateUpdater::getAgeCategoryPediatricsCost(int ageMonths) {
-	if(!simContext->getPedsInputs()->enablePediatricsModel)
+	if(!simContext->isPedsModelEnabled())
 		return SimContext::PEDS_COST_AGE_ADULT;
 
 	if (ageMonths < 24)
@@ -7685,7 +7631,7 @@ SimContext::PEDS_COST_AGE StateUpdater::getAgeCategoryPediatricsCost(int ageMont
  * \return an integer representing the index of the pediatric cost ART age categories
  **/
 SimContext::PEDS_ART_COST_AGE StateUpdater::getAgeCategoryPediatricsARTCost(int ageMonths) {
-	if(!simContext->getPedsInputs()->enablePediatricsModel)
+	if(!simContext->isPedsModelEnabled())
 		return SimContext::PEDS_ART_COST_AGE_ADULT;
 
 	if (ageMonths < 6)
@@ -7724,7 +7670,7 @@ int StateUpdater::getAgeCategoryOutput(int ageMonths) {
  * \return an integer representing the index of the age categories
  **/
 int StateUpdater::getAgeCategoryInfant(int ageMonths) {
-	if(!simContext->getPedsInputs()->enablePediatricsModel)
+	if(!simContext->isPedsModelEnabled())
 		return SimContext::PEDS_AGE_INFANT_NUM-1;
 
 	if (ageMonths < 3)
@@ -7,6 +7,10 @@
 SummaryStats::SummaryStats(string summariesFileName) {
 	this->summariesFileName = summariesFileName;
 	summaries.clear();
+	addedSummaries.clear();
+	labelsRunOrder = -1;
+	memset(oiLabels, 0, sizeof(oiLabels));
+	memset(deathCauseLabels, 0, sizeof(deathCauseLabels));
 } /* end Constructor */
 
 /** \brief Destructor frees allocated Summary objects and clears summaries vector */
@@ -21,15 +25,23 @@ SummaryStats::~SummaryStats(void)
 		runSetVector.clear();
 	}
 	summaries.clear();
+	for (vector<Summary *>::iterator j = addedSummaries.begin(); j != addedSummaries.end(); j++)
+		delete *j;
+	addedSummaries.clear();
 } /* end Destructor */
 
 /** \brief addRunStats adds a new summary to the vector from a RunStats object
+ *
+ * Safe to call concurrently for runs that finish at the same time, the summaries are put back into run order by finalizeStats
  *
  * \param runStats a pointer to the RunStats object that the new Summary object will get its information from
+ * \param simContext a pointer to the SimContext of the run, supplies the OI and death cause labels
+ * \param runOrder an integer giving the position of the run's input file in the list of files to run
  **/
-void SummaryStats::addRunStats(RunStats *runStats) {
+void SummaryStats::addRunStats(RunStats *runStats, SimContext *simContext, int runOrder) {
 	/** Create a new summary object */
 	Summary *summary = new Summary();
+	summary->runOrder = runOrder;
 
 	/** Copy the population summary stats from runStats */
 	const RunStats::PopulationSummary *popSummary = runStats->getPopulationSummary();
@@ -75,8 +87,21 @@ void SummaryStats::addRunStats(RunStats *runStats) {
 	summary->costEffectivenessLYs = 0;
 	summary->costEffectivenessQALYs = 0;
 
-	/** Add the new summary to the appropriate vector, create a new vector if this
-		is the first run of a run set */
+	/** Store the summary, and the labels if this is the latest run so far, the popstats header uses those of the last run */
+	lock_guard<mutex> lock(addMutex);
+	addedSummaries.push_back(summary);
+	if (runOrder > labelsRunOrder) {
+		labelsRunOrder = runOrder;
+		memcpy(oiLabels, simContext->OI_STRS, sizeof(oiLabels));
+		memcpy(deathCauseLabels, simContext->DTH_CAUSES_STRS, sizeof(deathCauseLabels));
+	}
+} /* end addRunStats */
+
+/** \brief addToRunSet adds a summary to the vector of its run set, creating a new vector if this is the first run of the run set
+ *
+ * \param summary a pointer to the Summary to add
+ **/
+void SummaryStats::addToRunSet(Summary *summary) {
 	for (list<vector<Summary *> >::iterator i = summaries.begin(); i != summaries.end(); i++) {
 		vector<Summary *> &runSetVector = *i;
 		if (summary->runSetName.compare(runSetVector[0]->runSetName) == 0) {
@@ -87,10 +112,16 @@ void SummaryStats::addRunStats(RunStats *runStats) {
 	vector<Summary *> runSetVector;
 	runSetVector.push_back(summary);
 	summaries.push_back(runSetVector);
-} /* end addRunStats */
+} /* end addToRunSet */
 
 /** \brief finalizeStats calculates the final cost-effectiveness ratios for each run */
 void SummaryStats::finalizeStats() {
+	/** Group the summaries into run sets in run order, so that the output does not depend on the order the runs finished in */
+	sort(addedSummaries.begin(), addedSummaries.end(), Summary::compareRunOrder());
+	for (vector<Summary *>::iterator j = addedSummaries.begin(); j != addedSummaries.end(); j++)
+		addToRunSet(*j);
+	addedSummaries.clear();
+
 	/** Loop over the run set vectors */
 	for (list<vector<Summary *> >::iterator i = summaries.begin(); i != summaries.end(); i++) {
 		vector<Summary *> &runSetVector = *i;
@@ -329,14 +360,14 @@ void SummaryStats::writeSummariesFileHeader() {
     fprintf(summariesFile, " \tCOST/LY \tCOST/QALY" );
     fprintf(summariesFile, " \tCOST \tLMs \tQALMs" );
 	for (i = 0; i < SimContext::DTH_NUM_CAUSES; ++i)
-		fprintf(summariesFile, " \t%s", SimContext::DTH_CAUSES_STRS[i]);
+		fprintf(summariesFile, " \t%s", deathCauseLabels[i]);
     fprintf(summariesFile, " \t(PREVAL) \t(INCID) \tDET (PREVAL) \tDET (INCID)" );
 	for (i = 0; i < SimContext::OI_NUM; ++i)
-		fprintf(summariesFile, " \t%s", SimContext::OI_STRS[i]);
+		fprintf(summariesFile, " \t%s", oiLabels[i]);
 	for (i = 0; i < SimContext::OI_NUM; ++i)
-		fprintf(summariesFile, " \t%s", SimContext::OI_STRS[i]);
+		fprintf(summariesFile, " \t%s", oiLabels[i]);
 	for (i = 0; i < SimContext::OI_NUM; ++i)
-		fprintf(summariesFile, " \t%s", SimContext::OI_STRS[i]);
+		fprintf(summariesFile, " \t%s", oiLabels[i]);
 	fprintf(summariesFile, " \tCLINIC VISITS" );
 	fprintf(summariesFile, "\n");
     fprintf(summariesFile, "=========\t=========\t=========\t=========\t=====\t====\t=====" );
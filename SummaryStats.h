@@ -23,6 +23,8 @@ public:
 		string runSetName;
 		/** The name of the run corresponding to this summary */
 		string runName;
+		/** The position of the run's input file in the list of files to run */
+		int runOrder;
 		/** The date of the run */
 		string runDate;
 		/** The time the run finished */
@@ -71,10 +73,16 @@ public:
 				return s1->costsAverage < s2->costsAverage;
 			}
 		};
+		/** A struct containing an operator that returns true if the first summary's input file comes before the second's in the list of files to run */
+		struct compareRunOrder {
+			bool operator()(const Summary *s1, const Summary *s2) const {
+				return s1->runOrder < s2->runOrder;
+			}
+		};
 	}; /* end Summary */
 
-	/* addRunStats adds a new summary to the vector from a RunStats object */
-	void addRunStats(RunStats *runStats);
+	/* addRunStats adds a new summary to the vector from a RunStats object, may be called concurrently */
+	void addRunStats(RunStats *runStats, SimContext *simContext, int runOrder);
 	/* finalizeStats calculates the final cost-effectiveness ratios for each run */
 	void finalizeStats();
 	/* writeSummariesFile appends the summary inforation to the popstats.out file */
@@ -86,12 +94,22 @@ private:
 	// TODO: a map from strings to summary vectors would be more efficient, had problems
 	//	using this in VC++
 	list<vector<Summary *> > summaries;
+	/** summaries in the order they were added, grouped into run sets in run order by finalizeStats */
+	vector<Summary *> addedSummaries;
+	/** mutex guarding addedSummaries and the labels, input files may finish concurrently */
+	mutex addMutex;
+	/** OI and death cause labels of the last input file in run order, used for the popstats header */
+	int labelsRunOrder;
+	char oiLabels[SimContext::OI_NUM][32];
+	char deathCauseLabels[SimContext::DTH_NUM_CAUSES][32];
 
 	/** summaries file name */
 	string summariesFileName;
 	/** summaries file pointer */
 	FILE *summariesFile;
 
+	/* adds a summary to the vector of its run set, called by finalizeStats */
+	void addToRunSet(Summary *summary);
 	/* writes out popstats file header */
 	void writeSummariesFileHeader();
 };
@@ -27,11 +27,11 @@ void TBClinicalUpdater::performInitialUpdates() {
 	/** Set the initial TB proph state to not be on or scheduled for TB proph */
 	setInitialTBProphState();
 
-	/** Identify the first available TB proph line */
+	/** Identify the first available TB proph line, there is none if the TB module is disabled and its tab was not read */
 	bool hasNext = false;
 	int prophIndex = SimContext::NOT_APPL;
 	int prophNum =  SimContext::NOT_APPL;
-	for (int i = 0; i < SimContext::TB_NUM_PROPHS; i++) {
+	for (int i = 0; (i < SimContext::TB_NUM_PROPHS) && simContext->isTBEnabled(); i++) {
 		if (simContext->getTBInputs()->prophOrder[i]!= SimContext::NOT_APPL) {
 			hasNext = true;
 			prophIndex = i;
@@ -43,9 +43,9 @@ void TBClinicalUpdater::performInitialUpdates() {
 	setNextTBProph(hasNext, prophIndex, prophNum);
 	setTBDSTTestResultPickup(false, SimContext::TB_STRAIN_DS, -1);
 
-	//Roll for eligibility for interval intitation policy
+	//Roll for eligibility for interval intitation policy, also when TB is disabled so that the later draws are unchanged
 	double randNum = CepacUtil::getRandomDouble(140080, patient);
-	if (randNum < simContext->getTBInputs()->TBDiagnosticsInitIntervalProb)
+	if (simContext->isTBEnabled() && (randNum < simContext->getTBInputs()->TBDiagnosticsInitIntervalProb))
 		setTBInitPolicyIntervalEligible(true);
 	else
 		setTBInitPolicyIntervalEligible(false);
@@ -54,7 +54,7 @@ void TBClinicalUpdater::performInitialUpdates() {
 
 /** \brief performMonthlyUpdates perform all of the state and statistics updates for a simulated month**/
 void TBClinicalUpdater::performMonthlyUpdates() {
-	if (!simContext->getTBInputs()->enableTB)
+	if (!simContext->isTBEnabled())
 		return;
 
 	if (simContext->getTBInputs()->allowMultipleTests){
@@ -653,7 +653,7 @@ void TBClinicalUpdater::performTBLTFUUpdates() {
 
 /** \brief performTBProphProgramUpdates evaluates TB proph policies and alters the treatment program */
 void TBClinicalUpdater::performTBProphProgramUpdates() {
-	if (!simContext->getTBInputs()->enableTB)
+	if (!simContext->isTBEnabled())
 		return;
 	if (patient->getTBState()->careState != SimContext::TB_CARE_UNLINKED)
 		return;
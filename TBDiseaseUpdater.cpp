@@ -15,7 +15,7 @@ void TBDiseaseUpdater::performInitialUpdates() {
 	/** First calls the parent function to perform general updates and initialization */
 	StateUpdater::performInitialUpdates();
 
-	if (!simContext->getTBInputs()->enableTB){
+	if (!simContext->isTBEnabled()){
 		setTBDiseaseState(SimContext::TB_STATE_UNINFECTED, false, SimContext::TB_INFECT_PREVALENT, SimContext::TB_STATE_UNINFECTED);
 		return;
 	}
@@ -94,7 +94,7 @@ void TBDiseaseUpdater::performInitialUpdates() {
  *  - TBDiseaseUpdater::rollForTBSelfCure()
  **/
 void TBDiseaseUpdater::performMonthlyUpdates() {
-	if (!simContext->getTBInputs()->enableTB)
+	if (!simContext->isTBEnabled())
 		return;
 	// Roll for infection/reinfection if in the Uninfected, Latent, Previously Treated, or Treatment Default TB state
 	if (patient->getTBState()->currTrueTBDiseaseState != SimContext::TB_STATE_ACTIVE_PULM && patient->getTBState()->currTrueTBDiseaseState != SimContext::TB_STATE_ACTIVE_EXTRAPULM){
@@ -252,7 +252,7 @@ void TBDiseaseUpdater::rollForTBActivation() {
 				break;
 			}
 		}
-		probActivate = CepacUtil::probRateMultiply(probActivate, simContext->getTBInputs()->natHistMultTime[period]);
+		probActivate = CepacUtil::probRateMultiplyCached(probActivate, simContext->getTBInputs()->natHistMultTime[period]);
 	}	
 
 	// Modify prob by proph efficacy if on TB proph or recently completed a full course
@@ -265,7 +265,7 @@ void TBDiseaseUpdater::rollForTBActivation() {
 		else
 			efficacy = tbInputs->tbProphInputs[prophNum].efficacyActivationHIVPos[tbStrain][cd4Strata][0];
 
-		probActivate = CepacUtil::probRateMultiply(probActivate, 1 - efficacy);
+		probActivate = CepacUtil::probRateMultiplyCached(probActivate, 1 - efficacy);
 	}
 	else if (patient->getTBState()->hasCompletedProph){
 		int recentProphNum = patient->getTBState()->mostRecentProphNum;
@@ -285,7 +285,7 @@ void TBDiseaseUpdater::rollForTBActivation() {
 				// interpolating the efficacy between the original efficacy value and 0
 				efficacy *= (1-propDecay);
 			}
-			probActivate = CepacUtil::probRateMultiply(probActivate, 1 - efficacy);
+			probActivate = CepacUtil::probRateMultiplyCached(probActivate, 1 - efficacy);
 		}
 	}
 
@@ -312,7 +312,7 @@ void TBDiseaseUpdater::rollForTBActivation() {
 		else
 			efficacy = tbInputs->TBTreatments[effectiveTreatNum].efficacyActivationHIVPos[tbStrain][cd4Strata];
 
-		probActivate = CepacUtil::probRateMultiply(probActivate, 1 - efficacy);
+		probActivate = CepacUtil::probRateMultiplyCached(probActivate, 1 - efficacy);
 	}
 
 	//Roll for activation
@@ -431,7 +431,7 @@ void TBDiseaseUpdater::rollForInfection(SimContext::TB_STATE tbState) {
 	}
 
 	// Apply rate multiplier for TB state
-	probInfect = CepacUtil::probRateMultiply(probInfect, tbInputs->infectionMultiplier[tbState]);
+	probInfect = CepacUtil::probRateMultiplyCached(probInfect, tbInputs->infectionMultiplier[tbState]);
 
 	// Modify prob by proph efficacy if on TB proph or recently completed a course
 	if (patient->getTBState()->isOnProph){
@@ -450,7 +450,7 @@ void TBDiseaseUpdater::rollForInfection(SimContext::TB_STATE tbState) {
 			else
 				efficacy = tbInputs->tbProphInputs[prophNum].efficacyReinfectionHIVPos[tbStrain][cd4Strata][0];
 		}		
-		probInfect = CepacUtil::probRateMultiply(probInfect, 1 - efficacy);
+		probInfect = CepacUtil::probRateMultiplyCached(probInfect, 1 - efficacy);
 	}
 	else if (patient->getTBState()->hasCompletedProph){
 		int effHorizon;
@@ -489,7 +489,7 @@ void TBDiseaseUpdater::rollForInfection(SimContext::TB_STATE tbState) {
 				// interpolating the efficacy between the original efficacy value and 0
 				efficacy *= (1-propDecay);
 			}
-			probInfect = CepacUtil::probRateMultiply(probInfect, 1 - efficacy);
+			probInfect = CepacUtil::probRateMultiplyCached(probInfect, 1 - efficacy);
 		}
 	}
 
@@ -534,7 +534,7 @@ void TBDiseaseUpdater::rollForInfection(SimContext::TB_STATE tbState) {
 			else
 				efficacy = tbInputs->TBTreatments[effectiveTreatNum].efficacyReinfectionHIVPos[tbStrain][cd4Strata];
 		}
-		probInfect = CepacUtil::probRateMultiply(probInfect, 1 - efficacy);
+		probInfect = CepacUtil::probRateMultiplyCached(probInfect, 1 - efficacy);
 	}
 
 	// Determine if infection/reinfection occurs
@@ -627,9 +627,9 @@ void TBDiseaseUpdater::rollForRelapse(SimContext::TB_STATE tbState) {
 	else{
 		probRelapse = fCD4 * tbInputs->probRelapseTtoARateMultiplier * exp(-1*min(timeSinceTreatment, tbInputs->probRelapseTtoAThreshold) * tbInputs->probRelapseTtoAExponent);
 		if(tbState == SimContext::TB_STATE_TREAT_DEFAULT){
-			probRelapse = CepacUtil::probRateMultiply(probRelapse, simContext->getTBInputs()->relapseRateMultTBTreatDefault);
+			probRelapse = CepacUtil::probRateMultiplyCached(probRelapse, simContext->getTBInputs()->relapseRateMultTBTreatDefault);
 		}
-		probRelapse = CepacUtil::probRateMultiply(probRelapse, treatMult);
+		probRelapse = CepacUtil::probRateMultiplyCached(probRelapse, treatMult);
 	}
 	//Roll for Relapse
 	double randNum = CepacUtil::getRandomDouble(140180, patient);
@@ -11,6 +11,8 @@ Tracer::Tracer(string runName, SimContext *simContext, int traceLevel) {
 	traceFileName.append(CepacUtil::FILE_EXTENSION_FOR_TRACE);
 	this->traceLevel = traceLevel;
 	this->simContext = simContext;
+	traceFile = NULL;
+	traceHeaderEnd = 0;
 } /* end Constructor */
 
 /** \brief Destructor is empty, no cleanup required */
@@ -18,10 +20,10 @@ Tracer::~Tracer(void) {
 
 } /* end Destructor */
 
-/** \brief openTraceFile opens the trace file for writing */
+/** \brief openTraceFile opens the trace file for writing, and reading back what was traced for the result cache */
 void Tracer::openTraceFile() {
 	CepacUtil::changeDirectoryToResults();
-	traceFile = CepacUtil::openFile(traceFileName.c_str(), "w");
+	traceFile = CepacUtil::openFile(traceFileName.c_str(), "w+");
 } /* end openTraceFile */
 
 /** \brief closeTraceFile closes the trace file */
@@ -31,8 +33,34 @@ void Tracer::closeTraceFile() {
 		return;
 
 	CepacUtil::closeFile(traceFile);
+	traceFile = NULL;
 } /* end closeTraceFile */
 
+/** \brief openTraceBuffer opens an anonymous temporary file to trace into instead of the named trace file
+ *
+ * Used by the parallel cohort runner so that each block of patients can be traced independently and
+ * the output appended to the real trace file in patient order with appendTraceBuffer
+ **/
+void Tracer::openTraceBuffer() {
+	traceFile = tmpfile();
+} /* end openTraceBuffer */
+
+/** \brief appendTraceBuffer copies everything traced so far by another Tracer into this trace file
+ *
+ * \param bufferTracer a Tracer opened with openTraceBuffer, it is left open and positioned at its end
+ **/
+void Tracer::appendTraceBuffer(Tracer *bufferTracer) {
+	// return if either trace file is not valid
+	if ((traceFile == NULL) || (bufferTracer->traceFile == NULL))
+		return;
+
+	char buffer[65536];
+	size_t numRead;
+	rewind(bufferTracer->traceFile);
+	while ((numRead = fread(buffer, 1, sizeof(buffer), bufferTracer->traceFile)) > 0)
+		fwrite(buffer, 1, numRead, traceFile);
+} /* end appendTraceBuffer */
+
 /** \brief printTraceOutputHeader prints out the HVL/CD4 strata information to trace file */
 void Tracer::printTraceHeader() {
 	// return if trace file is not valid
@@ -69,8 +97,52 @@ void Tracer::printTraceHeader() {
 	printTrace(1, "\n\n-----------------------------\n");
 	printTrace(1, "BEGIN SCENARIO %s [%d]\n", runSpecsInputs->runName.c_str(), traceLevel);
 	printTrace(1, "-----------------------------\n");
+	traceHeaderEnd = ftell(traceFile);
 } /* end printTraceHeader */
 
+/** \brief writeCachedTrace writes the length and the text of everything traced after the header to a result cache entry,
+ * so that the trace of a run restored from the cache is that of the run, after a header with the name of the restored run
+ *
+ * \param file a pointer to the result cache FILE, opened for binary writing
+ **/
+void Tracer::writeCachedTrace(FILE *file) {
+	long traceLength = 0;
+	if (traceFile != NULL) {
+		fflush(traceFile);
+		fseek(traceFile, 0, SEEK_END);
+		traceLength = ftell(traceFile) - traceHeaderEnd;
+	}
+	CepacUtil::writeBinary(file, traceLength);
+	if (traceLength <= 0)
+		return;
+
+	char buffer[65536];
+	size_t numRead;
+	fseek(traceFile, traceHeaderEnd, SEEK_SET);
+	while ((numRead = fread(buffer, 1, sizeof(buffer), traceFile)) > 0)
+		fwrite(buffer, 1, numRead, file);
+	fseek(traceFile, 0, SEEK_END);
+} /* end writeCachedTrace */
+
+/** \brief readCachedTrace traces the text written by writeCachedTrace, throwing a string error if the entry ends early,
+ * in which case nothing is traced
+ *
+ * \param file a pointer to the result cache FILE, opened for binary reading and positioned at the saved trace
+ **/
+void Tracer::readCachedTrace(FILE *file) {
+	long traceLength;
+	CepacUtil::readBinary(file, &traceLength);
+	if (traceLength <= 0)
+		return;
+	string traceText((size_t) traceLength, '\0');
+	if (fread(&traceText[0], 1, traceText.size(), file) != traceText.size()) {
+		string errorString = "   ERROR - Result cache entry ends within its trace";
+		throw errorString;
+	}
+	if (traceFile != NULL)
+		fwrite(traceText.data(), 1, traceText.size(), traceFile);
+} /* end readCachedTrace */
+
 /** \brief printTrace prints out the specified text to the trace file if at the specified tracing level
  *
  * \param level an integer representing the trace level of the information to be printed: only prints if level <= this->traceLevel
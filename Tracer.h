@@ -15,9 +15,15 @@ public:
 	/* Functions to open/close the trace file */
 	void openTraceFile();
 	void closeTraceFile();
+	/* Functions to trace into a temporary buffer and later append it to another trace file, used by parallel cohort runs */
+	void openTraceBuffer();
+	void appendTraceBuffer(Tracer *bufferTracer);
 	/* Functions to print the trace header and print tracing text */
 	void printTraceHeader();
 	void printTrace(int level, const char *format, ...);
+	/* Functions to save the text traced after the header in a result cache entry and to trace the saved text, see ResultCache */
+	void writeCachedTrace(FILE *file);
+	void readCachedTrace(FILE *file);
 
 private:
 	/* Local variables for the simulation context, trace file, and tracing level */
@@ -29,4 +35,6 @@ private:
 	FILE *traceFile;
 	/** The level of tracing used */
 	int traceLevel;
+	/** Offset in the trace file where the header printed by printTraceHeader ends */
+	long traceHeaderEnd;
 };
@@ -21,8 +21,18 @@
 #include <iostream>
 #include <vector>
 #include <map>
+#include <set>
+#include <random>
+#include <unordered_map>
 #include <algorithm>
 #include <list>
+#include <thread>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <type_traits>
 using namespace std;
 
 /** Predefine classes that have circular dependencies */
@@ -32,8 +42,14 @@ class RunStats;
 class CostStats;
 class SummaryStats;
 class Patient;
+class InputReader;
+class PSADriver;
 
 /** Include all the class definitions */
+#include "mtrand.h"
+#include "philox.h"
+#include "FixedPointSum.h"
+#include "InputReader.h"
 #include "SimContext.h"
 #include "Tracer.h"
 #include "RunStats.h"
@@ -57,15 +73,21 @@ class Patient;
 #include "CD4HVLUpdater.h"
 #include "EndMonthUpdater.h"
 #include "Patient.h"
-#include "mtrand.h"
+#include "CohortRunner.h"
+#include "PSADriver.h"
+#include "InputValidator.h"
+#include "ResultCache.h"
+#include "RunScheduler.h"
 #include "CepacUtil.h"
 
 
 /** Include platform specific header files */
 #if defined(__linux__)
 	#include <unistd.h>
+	#include <fcntl.h>
 	#include <sys/types.h>
 	#include <sys/stat.h>
+	#include <sys/mman.h>
 	//used to find files in a directory
 	#include <glob.h>
 #elif defined(_WIN32)
@@ -73,7 +95,9 @@ class Patient;
 	#include <direct.h>	//for _mkdir and _CHDIR
 #else //Mac
 	#include <unistd.h>
+	#include <fcntl.h>
 	#include <sys/stat.h>
+	#include <sys/mman.h>
 	#include <glob.h>
 	#include <mach-o/dyld.h>
 #endif
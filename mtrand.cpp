@@ -1,20 +1,70 @@
 // mtrand.cpp, see include file mtrand.h for information
 
 #include "mtrand.h"
-// non-inline function definitions and static member definitions cannot
+// non-inline function definitions cannot
 // reside in header file because of the risk of multiple declarations
 
-// initialization of static private members
-unsigned long MTRand_int32::state[n] = {0x0UL};
-int MTRand_int32::p = 0;
-bool MTRand_int32::init = false;
+#ifdef MTRAND_USE_SSE2
+/** twiddle for four consecutive words, as in MTRand_int32::twiddle */
+static inline __m128i twiddle4(__m128i u, __m128i v) {
+  __m128i y = _mm_or_si128(_mm_and_si128(u, _mm_set1_epi32((int) 0x80000000UL)),
+    _mm_and_si128(v, _mm_set1_epi32(0x7FFFFFFF)));
+// all ones where the low bit of v is set, selecting the matrix A constant
+  __m128i odd = _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(v, _mm_set1_epi32(1)));
+  return _mm_xor_si128(_mm_srli_epi32(y, 1), _mm_and_si128(odd, _mm_set1_epi32((int) 0x9908B0DFUL)));
+}
+#endif
 
+/** generate new state vector and the tempered words drawn from it
+ *
+ * The SSE2 loops update four words at a time.  Each block of four only reads words that are either
+ * final (i + m - n < i) or not yet updated (i + 1 and i + m), exactly as the scalar recurrence does,
+ * so the sequence is the same as the reference MT19937 */
 void MTRand_int32::gen_state() { // generate new state vector
+#ifdef MTRAND_USE_SSE2
+  int i = 0;
+  for (; i + 4 <= (n - m); i += 4) {
+    __m128i u = _mm_loadu_si128((const __m128i *) &state[i]);
+    __m128i v = _mm_loadu_si128((const __m128i *) &state[i + 1]);
+    __m128i w = _mm_loadu_si128((const __m128i *) &state[i + m]);
+    _mm_storeu_si128((__m128i *) &state[i], _mm_xor_si128(w, twiddle4(u, v)));
+  }
+  for (; i < (n - m); ++i)
+    state[i] = state[i + m] ^ twiddle(state[i], state[i + 1]);
+// (n - 1) - (n - m) = 396 words, a multiple of four
+  for (; i < (n - 1); i += 4) {
+    __m128i u = _mm_loadu_si128((const __m128i *) &state[i]);
+    __m128i v = _mm_loadu_si128((const __m128i *) &state[i + 1]);
+    __m128i w = _mm_loadu_si128((const __m128i *) &state[i + m - n]);
+    _mm_storeu_si128((__m128i *) &state[i], _mm_xor_si128(w, twiddle4(u, v)));
+  }
+#else
   for (int i = 0; i < (n - m); ++i)
     state[i] = state[i + m] ^ twiddle(state[i], state[i + 1]);
   for (int i = n - m; i < (n - 1); ++i)
     state[i] = state[i + m - n] ^ twiddle(state[i], state[i + 1]);
+#endif
   state[n - 1] = state[m - 1] ^ twiddle(state[n - 1], state[0]);
+
+// temper the whole state at once, rand_int32() then only reads the buffer
+#ifdef MTRAND_USE_SSE2
+  for (int i = 0; i < n; i += 4) {
+    __m128i x = _mm_loadu_si128((const __m128i *) &state[i]);
+    x = _mm_xor_si128(x, _mm_srli_epi32(x, 11));
+    x = _mm_xor_si128(x, _mm_and_si128(_mm_slli_epi32(x, 7), _mm_set1_epi32((int) 0x9D2C5680UL)));
+    x = _mm_xor_si128(x, _mm_and_si128(_mm_slli_epi32(x, 15), _mm_set1_epi32((int) 0xEFC60000UL)));
+    x = _mm_xor_si128(x, _mm_srli_epi32(x, 18));
+    _mm_storeu_si128((__m128i *) &tempered[i], x);
+  }
+#else
+  for (int i = 0; i < n; ++i) {
+    uint32_t x = state[i];
+    x ^= (x >> 11);
+    x ^= (x << 7) & 0x9D2C5680UL;
+    x ^= (x << 15) & 0xEFC60000UL;
+    tempered[i] = x ^ (x >> 18);
+  }
+#endif
   p = 0; // reset position
 }
 
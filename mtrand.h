@@ -45,11 +45,26 @@
 #ifndef MTRAND_H
 #define MTRAND_H
 
+#include <stdint.h>
+// the state is regenerated and tempered four words at a time with SSE2, which every x86-64 compiler
+// provides without extra flags; other targets use the scalar loops, which give the same sequence;
+// defining MTRAND_NO_SSE2 selects the scalar loops anywhere, e.g. to check them with cepac-random-test
+#if !defined(MTRAND_NO_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define MTRAND_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+/** tag selecting the constructors that leave the generator unseeded */
+struct MTRand_unseeded {};
+
 /** Mersenne Twister random number generator */
 class MTRand_int32 { // Mersenne Twister random number generator
 public:
-/** default constructor: uses default seed only if this is the first instance */
-  MTRand_int32() { if (!init) seed(5489UL); init = true; }
+/** default constructor: uses default seed */
+  MTRand_int32() { seed(5489UL); init = true; }
+/** constructor that leaves the generator unseeded, skipping the default seeding for an owner that always
+    calls seed before the first draw, such as Patient; drawing from it before then is undefined */
+  explicit MTRand_int32(MTRand_unseeded) { p = n; init = false; }
 /** constructor with 32 bit int as seed */
   MTRand_int32(unsigned long s) { seed(s); init = true; }
 /** constructor with array of size 32 bit ints as seed */
@@ -65,20 +80,21 @@ protected: // used by derived classes, otherwise not accessible; use the ()-oper
   unsigned long rand_int32(); // generate 32 bit random integer
 private:
   static const int n = 624, m = 397; // compile time constants
-// the variables below are static (no duplicates can exist)
-  static unsigned long state[n]; // state vector array
-  static int p; // position in state array
-  static bool init; // true if init function is called
+// the variables below are per instance so that each thread can own an independent generator
+  uint32_t state[n]; // state vector array
+  uint32_t tempered[n]; // tempered output words of the current state, filled in bulk by gen_state()
+  int p; // position in state array
+  bool init; // true if init function is called
 // private functions used to generate the pseudo random numbers
-  unsigned long twiddle(unsigned long, unsigned long); // used by gen_state()
-  void gen_state(); // generate new state
+  uint32_t twiddle(uint32_t, uint32_t); // used by gen_state()
+  void gen_state(); // generate new state and temper all of its words
 // make copy constructor and assignment operator unavailable, they don't make sense
   MTRand_int32(const MTRand_int32&); // copy constructor not defined
   void operator=(const MTRand_int32&); // assignment operator not defined
 };
 
 /** inline for speed, must therefore reside in header file */
-inline unsigned long MTRand_int32::twiddle(unsigned long u, unsigned long v) {
+inline uint32_t MTRand_int32::twiddle(uint32_t u, uint32_t v) {
   return (((u & 0x80000000UL) | (v & 0x7FFFFFFFUL)) >> 1)
     ^ ((v & 1UL) ? 0x9908B0DFUL : 0x0UL);
 }
@@ -87,18 +103,16 @@ inline unsigned long MTRand_int32::twiddle(unsigned long u, unsigned long v) {
 inline unsigned long MTRand_int32::rand_int32() { // generate 32 bit random int
   if (p == n) gen_state(); // new state vector needed
 // gen_state() is split off to be non-inline, because it is only called once
-// in every 624 calls and otherwise irand() would become too big to get inlined
-  unsigned long x = state[p++];
-  x ^= (x >> 11);
-  x ^= (x << 7) & 0x9D2C5680UL;
-  x ^= (x << 15) & 0xEFC60000UL;
-  return x ^ (x >> 18);
+// in every 624 calls and otherwise irand() would become too big to get inlined;
+// it also tempers the whole state, so a draw is just a load from the buffer
+  return tempered[p++];
 }
 
 /** generates double floating point numbers in the half-open interval [0, 1) */
 class MTRand : public MTRand_int32 {
 public:
   MTRand() : MTRand_int32() {}
+  explicit MTRand(MTRand_unseeded unseeded) : MTRand_int32(unseeded) {}
   MTRand(unsigned long seed) : MTRand_int32(seed) {}
   MTRand(const unsigned long* seed, int size) : MTRand_int32(seed, size) {}
   ~MTRand() {}
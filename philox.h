@@ -0,0 +1,128 @@
+/** \file philox.h
+// Counter-based random number generator based on the Philox4x32-10 function of
+// Salmon, Moraes, Dror and Shaw, "Parallel Random Numbers: As Easy as 1, 2, 3", SC11 (2011).
+//
+// Unlike MTRand there is no sequential state: each draw is a pure function of a key and a
+// counter, so a patient's draws can be reproduced from its key alone, without stepping
+// through the draws made before it. */
+
+#ifndef PHILOX_H
+#define PHILOX_H
+
+/** Philox4x32-10 block function, maps a 128 bit counter and a 64 bit key to 128 random bits */
+class Philox4x32 {
+public:
+  static void generate(const unsigned int counter[4], const unsigned int key[2], unsigned int out[4]);
+private:
+  static const unsigned int MULT_0 = 0xD2511F53U, MULT_1 = 0xCD9E8D57U; // round multipliers
+  static const unsigned int WEYL_0 = 0x9E3779B9U, WEYL_1 = 0xBB67AE85U; // key schedule increments
+  static const int NUM_ROUNDS = 10;
+};
+
+/** inline for speed, must therefore reside in header file */
+inline void Philox4x32::generate(const unsigned int counter[4], const unsigned int key[2], unsigned int out[4]) {
+  unsigned int c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+  unsigned int k0 = key[0], k1 = key[1];
+  for (int r = 0; r < NUM_ROUNDS; ++r) {
+    unsigned long long p0 = (unsigned long long) MULT_0 * c0;
+    unsigned long long p1 = (unsigned long long) MULT_1 * c2;
+    unsigned int hi0 = (unsigned int) (p0 >> 32), lo0 = (unsigned int) p0;
+    unsigned int hi1 = (unsigned int) (p1 >> 32), lo1 = (unsigned int) p1;
+    c0 = hi1 ^ c1 ^ k0;
+    c1 = lo1;
+    c2 = hi0 ^ c3 ^ k1;
+    c3 = lo0;
+    k0 += WEYL_0;
+    k1 += WEYL_1;
+  }
+  out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+}
+
+/** Counter-based generator for one patient: each draw is keyed by (seed, patient number, call site, draw index, month)
+//  where the draw index counts the previous draws from the same call site for this patient in the current month.
+//  The month stays 0 unless setMonth is called, in which case the draw indices restart every month.
+//  Call site ids must be a fixed set, a loop that redraws until a value is accepted passes the same id every time
+//  and gets the next draw index of that call site */
+class PhiloxRand {
+public:
+  PhiloxRand() { seed(0UL, 0UL); }
+/** reset the generator for a patient, O(1) apart from clearing the call site table */
+  void seed(unsigned long seed, unsigned long patientNum);
+/** sets the month word of the counter, draws made after a month change start again from draw index 0 */
+  void setMonth(int month) { this->month = (unsigned int) month; }
+/** returns a double in the half-open interval [0, 1) with 53 bit resolution */
+  double operator()(int callSiteId);
+/** most distinct call sites one patient may draw from, half the table so that probes stay short and always end */
+  static const int MAX_CALL_SITES = 256;
+private:
+  static const int TABLE_BITS = 9, TABLE_SIZE = 1 << TABLE_BITS; // call site table
+  static const int EMPTY_SLOT = -1;
+  static_assert(MAX_CALL_SITES < TABLE_SIZE, "the call site table must keep an empty slot to end its probes");
+  unsigned int key[2]; // the run seed
+  unsigned int patientNum; // first word of every counter
+  unsigned int month; // last word of every counter
+  int numCallSites; // number of call sites in the table
+  int callSiteIds[TABLE_SIZE]; // open addressing table of call site ids seen for this patient
+  unsigned int drawCounts[TABLE_SIZE]; // number of draws made so far from each call site
+  unsigned int drawMonths[TABLE_SIZE]; // month that the draw count of each call site refers to
+  double spareDraws[TABLE_SIZE]; // second double of the last block generated for each call site, used by the next odd draw
+  int findSlot(int callSiteId);
+  static void reportTooManyCallSites(int callSiteId);
+};
+
+inline void PhiloxRand::seed(unsigned long seed, unsigned long patientNum) {
+  key[0] = (unsigned int) (seed & 0xFFFFFFFFUL);
+  key[1] = 0x43455041U; // fixed second key word
+  this->patientNum = (unsigned int) (patientNum & 0xFFFFFFFFUL);
+  month = 0;
+  numCallSites = 0;
+  for (int i = 0; i < TABLE_SIZE; ++i)
+    callSiteIds[i] = EMPTY_SLOT;
+}
+
+/** find or insert the table slot for a call site with linear probing, restarting its draw count in a new month */
+inline int PhiloxRand::findSlot(int callSiteId) {
+  unsigned int slot = ((unsigned int) callSiteId * 2654435761U) >> (32 - TABLE_BITS);
+  while (callSiteIds[slot] != callSiteId) {
+    if (callSiteIds[slot] == EMPTY_SLOT) {
+      if (numCallSites >= MAX_CALL_SITES)
+        reportTooManyCallSites(callSiteId);
+      numCallSites++;
+      callSiteIds[slot] = callSiteId;
+      drawCounts[slot] = 0;
+      drawMonths[slot] = month;
+      break;
+    }
+    slot = (slot + 1) & (TABLE_SIZE - 1);
+  }
+  if (drawMonths[slot] != month) {
+    drawCounts[slot] = 0;
+    drawMonths[slot] = month;
+  }
+  return slot;
+}
+
+/** stops the run when a patient draws from more call sites than the table holds, which would otherwise fill it */
+inline void PhiloxRand::reportTooManyCallSites(int callSiteId) {
+  printf("   ERROR - A patient drew from random number call site %d after %d other call sites, the most the counter-based generator holds\n",
+    callSiteId, MAX_CALL_SITES);
+  fflush(stdout);
+  abort();
+}
+
+/** draws 2k and 2k+1 of a call site are the two 64 bit halves of the block for counter (patient, call site, k, month) */
+inline double PhiloxRand::operator()(int callSiteId) {
+  int slot = findSlot(callSiteId);
+  unsigned int count = drawCounts[slot]++;
+  if (count & 1U)
+    return spareDraws[slot];
+  unsigned int counter[4] = {patientNum, (unsigned int) callSiteId, count >> 1, month};
+  unsigned int out[4];
+  Philox4x32::generate(counter, key, out);
+  spareDraws[slot] = (static_cast<double>(out[2] >> 5) * 67108864. +
+    static_cast<double>(out[3] >> 6)) * (1. / 9007199254740992.);
+  return (static_cast<double>(out[0] >> 5) * 67108864. +
+    static_cast<double>(out[1] >> 6)) * (1. / 9007199254740992.);
+}
+
+#endif // PHILOX_H